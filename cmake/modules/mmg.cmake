@@ -70,18 +70,21 @@ IF ( LIBMMG_STATIC OR LIBMMG_SHARED )
     ${MMG2D_SOURCE_DIR}/libmmg2d.h
     ${MMG2D_BINARY_DIR}/libmmg2df.h
     ${COMMON_SOURCE_DIR}/libmmgtypes.h
+    ${COMMON_BINARY_DIR}/mmgcmakedefines.h
     ${COMMON_BINARY_DIR}/libmmgtypesf.h
     )
   SET( mmg3d_headers
     ${MMG3D_SOURCE_DIR}/libmmg3d.h
     ${MMG3D_BINARY_DIR}/libmmg3df.h
     ${COMMON_SOURCE_DIR}/libmmgtypes.h
+    ${COMMON_BINARY_DIR}/mmgcmakedefines.h
     ${COMMON_BINARY_DIR}/libmmgtypesf.h
     )
   SET( mmgs_headers
     ${MMGS_SOURCE_DIR}/libmmgs.h
     ${MMGS_BINARY_DIR}/libmmgsf.h
     ${COMMON_SOURCE_DIR}/libmmgtypes.h
+    ${COMMON_BINARY_DIR}/mmgcmakedefines.h
     ${COMMON_BINARY_DIR}/libmmgtypesf.h
     )
   SET( mmg_headers
@@ -118,6 +118,7 @@ SET( mmg2d_headers
   ${MMG2D_SOURCE_DIR}/libmmg2d.h
   ${MMG2D_BINARY_DIR}/libmmg2df.h
   ${COMMON_SOURCE_DIR}/libmmgtypes.h
+  ${COMMON_BINARY_DIR}/mmgcmakedefines.h
   ${COMMON_BINARY_DIR}/libmmgtypesf.h
   )
 
@@ -59,6 +59,18 @@ ELSE()
   SET(CMAKE_C_FLAGS "-DPATTERN ${CMAKE_C_FLAGS}")
 ENDIF()
 
+############################################################################
+#####
+#####         Batch kernels of quality and length
+#####
+############################################################################
+# errno is never read by mmg: without it, the sqrt calls of the batch kernels
+# do not prevent the vectorization
+IF ( CMAKE_COMPILER_IS_GNUCC )
+  SET_SOURCE_FILES_PROPERTIES(${MMG3D_SOURCE_DIR}/quality_3d.c
+    PROPERTIES COMPILE_FLAGS -fno-math-errno)
+ENDIF()
+
 ###############################################################################
 #####
 #####         Sources and libraries
@@ -133,6 +145,7 @@ SET( mmg3d_headers
   ${MMG3D_SOURCE_DIR}/libmmg3d.h
   ${MMG3D_BINARY_DIR}/libmmg3df.h
   ${COMMON_SOURCE_DIR}/libmmgtypes.h
+  ${COMMON_BINARY_DIR}/mmgcmakedefines.h
   ${COMMON_BINARY_DIR}/libmmgtypesf.h
   )
 
@@ -200,6 +213,7 @@ IF ( BUILD_TESTING )
     IF ( TEST_LIBMMG3D )
       SET(LIBMMG3D_EXEC0_a ${EXECUTABLE_OUTPUT_PATH}/libmmg3d_example0_a)
       SET(LIBMMG3D_EXEC0_b ${EXECUTABLE_OUTPUT_PATH}/libmmg3d_example0_b)
+      SET(LIBMMG3D_EXEC0_c ${EXECUTABLE_OUTPUT_PATH}/libmmg3d_example0_c)
       SET(LIBMMG3D_EXEC1   ${EXECUTABLE_OUTPUT_PATH}/libmmg3d_example1)
       SET(LIBMMG3D_EXEC2   ${EXECUTABLE_OUTPUT_PATH}/libmmg3d_example2)
       SET(LIBMMG3D_EXEC4   ${EXECUTABLE_OUTPUT_PATH}/libmmg3d_example4)
@@ -212,6 +226,9 @@ IF ( BUILD_TESTING )
       ADD_TEST(NAME libmmg3d_example0_b COMMAND ${LIBMMG3D_EXEC0_b}
        "${CTEST_OUTPUT_DIR}/libmmg3d_Adaptation_0_b.o.mesh"
         )
+      ADD_TEST(NAME libmmg3d_example0_c COMMAND ${LIBMMG3D_EXEC0_c}
+       "${CTEST_OUTPUT_DIR}/libmmg3d_Adaptation_0_c.o"
+        )
       ADD_TEST(NAME libmmg3d_example1   COMMAND ${LIBMMG3D_EXEC1}
         "${CTEST_OUTPUT_DIR}/libmmg3d_Adaptation_1.o.mesh"
         )
@@ -90,6 +90,7 @@ SET( mmgs_headers
   ${MMGS_SOURCE_DIR}/libmmgs.h
   ${MMGS_BINARY_DIR}/libmmgsf.h
   ${COMMON_SOURCE_DIR}/libmmgtypes.h
+  ${COMMON_BINARY_DIR}/mmgcmakedefines.h
   ${COMMON_BINARY_DIR}/libmmgtypesf.h
   )
 
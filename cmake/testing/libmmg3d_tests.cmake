@@ -29,6 +29,7 @@
 SET ( MMG3D_LIB_TESTS
   libmmg3d_example0_a
   libmmg3d_example0_b
+  libmmg3d_example0_c
   libmmg3d_example1
   libmmg3d_example2
   libmmg3d_example4
@@ -37,6 +38,7 @@ SET ( MMG3D_LIB_TESTS
 SET ( MMG3D_LIB_TESTS_MAIN_PATH
   ${PROJECT_SOURCE_DIR}/libexamples/mmg3d/adaptation_example0/example0_a/main.c
   ${PROJECT_SOURCE_DIR}/libexamples/mmg3d/adaptation_example0/example0_b/main.c
+  ${PROJECT_SOURCE_DIR}/libexamples/mmg3d/adaptation_example0/example0_c/main.c
   ${PROJECT_SOURCE_DIR}/libexamples/mmg3d/adaptation_example1/main.c
   ${PROJECT_SOURCE_DIR}/libexamples/mmg3d/adaptation_example2/main.c
   ${PROJECT_SOURCE_DIR}/libexamples/mmg3d/LagrangianMotion_example0/main.c
@@ -0,0 +1,352 @@
+/* =============================================================================
+**  This file is part of the mmg software package for the tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/Inria/UBordeaux/UPMC, 2004- .
+**
+**  mmg is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  mmg is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with mmg (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the mmg distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * Example of use of the mmg3d library (basic use of mesh adaptation, the
+ * mesh and solution arrays are given to the library and given back without
+ * copy).
+ *
+ * \author Charles Dapogny (LJLL, UPMC)
+ * \author Cécile Dobrzynski (Inria / IMB, Université de Bordeaux)
+ * \author Pascal Frey (LJLL, UPMC)
+ * \author Algiane Froehly (Inria / IMB, Université de Bordeaux)
+ * \version 5
+ * \copyright GNU Lesser General Public License.
+ */
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <signal.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+#include <float.h>
+
+/** Include the mmg3d library hader file */
+// if the header file is in the "include" directory
+// #include "libmmg3d.h"
+// if the header file is in "include/mmg/mmg3d"
+#include "mmg/mmg3d/libmmg3d.h"
+
+int main(int argc,char *argv[]) {
+  MMG5_pMesh      mmgMesh;
+  MMG5_pSol       mmgSol;
+  int             ier,k,typEntity,typSol;
+  /* To save final mesh in a file */
+  FILE*           inm;
+  /* Mesh and solution arrays */
+  MMG5_int        np,ne,nt,na,nc,nr,nreq,*tetra,*tria,*edge;
+  int             *tetraRef,*tetraReq,*triaRef,*triaReq,*edgeRef,*edgeRid;
+  int             *edgeReq,*pointRef,*pointReq,*corner;
+  double          *vertices,*sol;
+  char            *fileout, *solout;
+
+  /* Initial mesh: a cube split in 12 tetrahedra */
+  static const double   Vertices[36] = {
+    0  ,0  ,0  ,  0.5,0  ,0  ,  0.5,0  ,1  ,  0  ,0  ,1  ,
+    0  ,1  ,0  ,  0.5,1  ,0  ,  0.5,1  ,1  ,  0  ,1  ,1  ,
+    1  ,0  ,0  ,  1  ,1  ,0  ,  1  ,0  ,1  ,  1  ,1  ,1   };
+  static const MMG5_int Tetra[48] = {
+    1,  4,  2,  8,   8,  3,  2,  7,   5,  2,  6,  8,   5,  8,  1,  2,
+    7,  2,  8,  6,   2,  4,  3,  8,   9,  2,  3,  7,   7, 11,  9, 12,
+    6,  9, 10,  7,   6,  7,  2,  9,  12,  9,  7, 10,   9,  3, 11,  7 };
+  static const int      TetraRef[12] = { 1,1,1,1,1,1,2,2,2,2,2,2 };
+  static const MMG5_int Tria[60] = {
+    1,  4,  8,   1,  2,  4,   8,  3,  7,   5,  8,  6,   5,  6,  2,
+    5,  2,  1,   5,  1,  8,   7,  6,  8,   4,  3,  8,   2,  3,  4,
+    9,  3,  2,  11,  9, 12,   7, 11, 12,   6,  7, 10,   6, 10,  9,
+    6,  9,  2,  12, 10,  7,  12,  9, 10,   3, 11,  7,   9, 11,  3 };
+
+  fprintf(stdout,"  -- TEST MMG3DLIB \n");
+
+  if ( argc != 2 ) {
+    printf(" Usage: %s fileout\n",argv[0]);
+    return(1);
+  }
+
+  /* Name and path of the mesh file */
+  fileout = (char *) calloc(strlen(argv[1]) + 6, sizeof(char));
+  if ( fileout == NULL ) {
+    perror("  ## Memory problem: calloc");
+    exit(EXIT_FAILURE);
+  }
+  strcpy(fileout,argv[1]);
+  strcat(fileout,".mesh");
+
+  solout = (char *) calloc(strlen(argv[1]) + 5, sizeof(char));
+  if ( solout == NULL ) {
+    perror("  ## Memory problem: calloc");
+    exit(EXIT_FAILURE);
+  }
+  strcpy(solout,argv[1]);
+  strcat(solout,".sol");
+
+  /** ------------------------------ STEP   I -------------------------- */
+  /** 1) Initialisation of mesh and sol structures */
+  mmgMesh = NULL;
+  mmgSol  = NULL;
+
+  MMG3D_Init_mesh(MMG5_ARG_start,
+                  MMG5_ARG_ppMesh,&mmgMesh,MMG5_ARG_ppMet,&mmgSol,
+                  MMG5_ARG_end);
+
+  /** 2) Build mesh in MMG5 format */
+  /** a) give the size of the mesh: 12 vertices, 12 tetra,0 prisms, 20
+   * triangles, 0 quads, 0 edges */
+  if ( MMG3D_Set_meshSize(mmgMesh,12,12,0,20,0,0) != 1 )  exit(EXIT_FAILURE);
+
+  /** b) give the vertices: the array is allocated with malloc and given to
+   * the mesh, that takes its ownership (the references stay to the caller) */
+  vertices = (double*)malloc(36*sizeof(double));
+  if ( !vertices ) {
+    perror("  ## Memory problem: malloc");
+    exit(EXIT_FAILURE);
+  }
+  memcpy(vertices,Vertices,36*sizeof(double));
+  if ( MMG3D_Adopt_vertices(mmgMesh,vertices,NULL) != 1 )  exit(EXIT_FAILURE);
+  vertices = NULL;
+
+  /** c) give the tetrahedra in the same way (after the vertices) */
+  tetra = (MMG5_int*)malloc(48*sizeof(MMG5_int));
+  if ( !tetra ) {
+    perror("  ## Memory problem: malloc");
+    exit(EXIT_FAILURE);
+  }
+  memcpy(tetra,Tetra,48*sizeof(MMG5_int));
+  if ( MMG3D_Adopt_tetrahedra(mmgMesh,tetra,(int*)TetraRef) != 1 )
+    exit(EXIT_FAILURE);
+  tetra = NULL;
+
+  /** d) give the triangles (copied by the mesh) */
+  triaRef = (int*)malloc(20*sizeof(int));
+  if ( !triaRef ) {
+    perror("  ## Memory problem: malloc");
+    exit(EXIT_FAILURE);
+  }
+  for ( k=0; k<20; k++ )  triaRef[k] = k<10 ? 3 : 4;
+  if ( MMG3D_Set_triangles(mmgMesh,(MMG5_int*)Tria,triaRef) != 1 )
+    exit(EXIT_FAILURE);
+  free(triaRef);
+  triaRef = NULL;
+
+  /** 3) Build sol in MMG5 format: the values are given to the solution */
+  if ( MMG3D_Set_solSize(mmgMesh,mmgSol,MMG5_Vertex,12,MMG5_Scalar) != 1 )
+    exit(EXIT_FAILURE);
+
+  sol = (double*)malloc(12*sizeof(double));
+  if ( !sol ) {
+    perror("  ## Memory problem: malloc");
+    exit(EXIT_FAILURE);
+  }
+  for ( k=0; k<12; k++ )  sol[k] = 0.5;
+  if ( MMG3D_Adopt_sols(mmgMesh,mmgSol,sol) != 1 )  exit(EXIT_FAILURE);
+  sol = NULL;
+
+  /** 4) (not mandatory): check if the number of given entities match with mesh size */
+  if ( MMG3D_Chk_meshData(mmgMesh,mmgSol) != 1 ) exit(EXIT_FAILURE);
+
+  /** ------------------------------ STEP  II -------------------------- */
+  /** remesh function */
+  ier = MMG3D_mmg3dlib(mmgMesh,mmgSol);
+
+  if ( ier == MMG5_STRONGFAILURE ) {
+    fprintf(stdout,"BAD ENDING OF MMG3DLIB: UNABLE TO SAVE MESH\n");
+    return(ier);
+  } else if ( ier == MMG5_LOWFAILURE )
+    fprintf(stdout,"BAD ENDING OF MMG3DLIB\n");
+
+  /** ------------------------------ STEP III -------------------------- */
+  /** get results: the arrays of the mesh and of the solution are given back
+   * without copy (they are to free by the caller) */
+  if ( MMG3D_Get_meshSize(mmgMesh,&np,&ne,NULL,&nt,NULL,&na) !=1 )
+    exit(EXIT_FAILURE);
+
+  /** a) the triangles and the edges are copied */
+  tria    = (MMG5_int*)malloc(3*nt*sizeof(MMG5_int));
+  triaRef = (int*)malloc(nt*sizeof(int));
+  triaReq = (int*)malloc(nt*sizeof(int));
+  if ( !tria || !triaRef || !triaReq ) {
+    perror("  ## Memory problem: malloc");
+    exit(EXIT_FAILURE);
+  }
+  for(k=0; k<nt; k++) {
+    if ( MMG3D_Get_triangle(mmgMesh,&tria[3*k],&tria[3*k+1],&tria[3*k+2],
+                            &triaRef[k],&triaReq[k]) != 1 )
+      exit(EXIT_FAILURE);
+  }
+
+  edge    = (MMG5_int*)malloc((2*na+1)*sizeof(MMG5_int));
+  edgeRef = (int*)malloc((na+1)*sizeof(int));
+  edgeRid = (int*)malloc((na+1)*sizeof(int));
+  edgeReq = (int*)malloc((na+1)*sizeof(int));
+  if ( !edge || !edgeRef || !edgeRid || !edgeReq ) {
+    perror("  ## Memory problem: malloc");
+    exit(EXIT_FAILURE);
+  }
+  for(k=0; k<na; k++) {
+    if ( MMG3D_Get_edge(mmgMesh,&edge[2*k],&edge[2*k+1],&edgeRef[k],
+                        &edgeRid[k],&edgeReq[k]) != 1 )
+      exit(EXIT_FAILURE);
+  }
+
+  /** b) the solution, the tetrahedra and the vertices are released */
+  if ( MMG3D_Get_solSize(mmgMesh,mmgSol,&typEntity,&np,&typSol) != 1 )
+    exit(EXIT_FAILURE);
+  if ( ( typEntity != MMG5_Vertex )  || ( typSol != MMG5_Scalar ) )
+    exit(EXIT_FAILURE);
+  if ( MMG3D_Release_sols(mmgMesh,mmgSol,&sol) != 1 )  exit(EXIT_FAILURE);
+
+  tetraRef = (int*)malloc(ne*sizeof(int));
+  tetraReq = (int*)malloc(ne*sizeof(int));
+  if ( !tetraRef || !tetraReq ) {
+    perror("  ## Memory problem: malloc");
+    exit(EXIT_FAILURE);
+  }
+  if ( MMG3D_Release_tetrahedra(mmgMesh,&tetra,tetraRef,tetraReq) != 1 )
+    exit(EXIT_FAILURE);
+
+  pointRef = (int*)malloc(np*sizeof(int));
+  corner   = (int*)malloc(np*sizeof(int));
+  pointReq = (int*)malloc(np*sizeof(int));
+  if ( !pointRef || !corner || !pointReq ) {
+    perror("  ## Memory problem: malloc");
+    exit(EXIT_FAILURE);
+  }
+  if ( MMG3D_Release_vertices(mmgMesh,&vertices,pointRef,corner,pointReq) != 1 )
+    exit(EXIT_FAILURE);
+
+  /** 1) Save the mesh (same file as the example0_b one) */
+  if( !(inm = fopen(fileout,"w")) ) {
+    fprintf(stderr,"  ** UNABLE TO OPEN OUTPUT MESH FILE.\n");
+    exit(EXIT_FAILURE);
+  }
+  fprintf(inm,"MeshVersionFormatted 2\n");
+  fprintf(inm,"\nDimension 3\n");
+
+  nreq = 0; nc = 0;
+  fprintf(inm,"\nVertices\n%lld\n",(long long)np);
+  for(k=0; k<np; k++) {
+    fprintf(inm,"%.15lg %.15lg %.15lg %d \n",vertices[3*k],vertices[3*k+1],
+            vertices[3*k+2],pointRef[k]);
+    if ( corner[k] )  nc++;
+    if ( pointReq[k] )  nreq++;
+  }
+  fprintf(inm,"\nCorners\n%lld\n",(long long)nc);
+  for(k=0; k<np; k++) {
+    if ( corner[k] )  fprintf(inm,"%lld \n",(long long)k+1);
+  }
+  fprintf(inm,"\nRequiredVertices\n%lld\n",(long long)nreq);
+  for(k=0; k<np; k++) {
+    if ( pointReq[k] )  fprintf(inm,"%lld \n",(long long)k+1);
+  }
+
+  nreq = 0;
+  fprintf(inm,"\nTriangles\n%lld\n",(long long)nt);
+  for(k=0; k<nt; k++) {
+    fprintf(inm,"%lld %lld %lld %d \n",(long long)tria[3*k],
+            (long long)tria[3*k+1],(long long)tria[3*k+2],triaRef[k]);
+    if ( triaReq[k] )  nreq++;
+  }
+  fprintf(inm,"\nRequiredTriangles\n%lld\n",(long long)nreq);
+  for(k=0; k<nt; k++) {
+    if ( triaReq[k] )  fprintf(inm,"%lld \n",(long long)k+1);
+  }
+
+  nreq = 0; nr = 0;
+  fprintf(inm,"\nEdges\n%lld\n",(long long)na);
+  for(k=0; k<na; k++) {
+    fprintf(inm,"%lld %lld %d \n",(long long)edge[2*k],(long long)edge[2*k+1],
+            edgeRef[k]);
+    if ( edgeRid[k] )  nr++;
+    if ( edgeReq[k] )  nreq++;
+  }
+  fprintf(inm,"\nRequiredEdges\n%lld\n",(long long)nreq);
+  for(k=0; k<na; k++) {
+    if ( edgeReq[k] )  fprintf(inm,"%lld \n",(long long)k+1);
+  }
+  fprintf(inm,"\nRidges\n%lld\n",(long long)nr);
+  for(k=0; k<na; k++) {
+    if ( edgeRid[k] )  fprintf(inm,"%lld \n",(long long)k+1);
+  }
+
+  nreq = 0;
+  fprintf(inm,"\nTetrahedra\n%lld\n",(long long)ne);
+  for(k=0; k<ne; k++) {
+    fprintf(inm,"%lld %lld %lld %lld %d \n",(long long)tetra[4*k],
+            (long long)tetra[4*k+1],(long long)tetra[4*k+2],
+            (long long)tetra[4*k+3],tetraRef[k]);
+    if ( tetraReq[k] )  nreq++;
+  }
+  fprintf(inm,"\nRequiredTetrahedra\n%lld\n",(long long)nreq);
+  for(k=0; k<ne; k++) {
+    if ( tetraReq[k] )  fprintf(inm,"%lld \n",(long long)k+1);
+  }
+
+  fprintf(inm,"\nEnd\n");
+  fclose(inm);
+
+  /** 2) Save the solution */
+  if( !(inm = fopen(solout,"w")) ) {
+    fprintf(stderr,"  ** UNABLE TO OPEN OUTPUT FILE.\n");
+    exit(EXIT_FAILURE);
+  }
+  fprintf(inm,"MeshVersionFormatted 2\n");
+  fprintf(inm,"\nDimension 3\n");
+  fprintf(inm,"\nSolAtVertices\n%lld\n",(long long)np);
+  fprintf(inm,"1 1 \n\n");
+  for(k=0; k<np; k++) {
+    fprintf(inm,"%.15lg \n",sol[k]);
+  }
+  fprintf(inm,"\nEnd\n");
+  fclose(inm);
+
+  free(vertices);
+  free(pointRef);
+  free(corner);
+  free(pointReq);
+  free(tetra);
+  free(tetraRef);
+  free(tetraReq);
+  free(tria);
+  free(triaRef);
+  free(triaReq);
+  free(edge);
+  free(edgeRef);
+  free(edgeRid);
+  free(edgeReq);
+  free(sol);
+
+  /** 3) Free the MMG3D5 structures */
+  MMG3D_Free_all(MMG5_ARG_start,
+                 MMG5_ARG_ppMesh,&mmgMesh,MMG5_ARG_ppMet,&mmgSol,
+                 MMG5_ARG_end);
+
+  free(fileout);
+  fileout = NULL;
+
+  free(solout);
+  solout = NULL;
+
+  return(ier);
+}
@@ -98,6 +98,12 @@ int main (int argc, char ** argv)
     /* Compute the size of the C pointer for the Fortran programm */
     fprintf(file, "#define MMG5_DATA_PTR_T INTEGER(kind=%d)\n",
             (int)sizeof(void*));
+    /* Kind of the integers used for the entity indices (see MMG5_int) */
+#ifdef MMG5_INT64
+    fprintf(file, "#define MMG5F_INT INTEGER(kind=8)\n");
+#else
+    fprintf(file, "#define MMG5F_INT INTEGER(kind=4)\n");
+#endif
   }
   fclose(file);
 
@@ -71,6 +71,8 @@ void _MMG5_Init_parameters(MMG5_pMesh mesh) {
   mesh->info.nomove   =  0;  /* [0/1]    ,avoid/allow point relocation */
   /** MMG5_IPARAM nmat = 0 */
   mesh->info.nmat = 0;  /* [n]    ,number of user-defined references */
+  /** MMG5_IPARAM_nthreads = 1 */
+  mesh->info.nthreads = 1;  /* [n]  ,number of threads for parallel loops */
 
   /* default values for doubles */
   /** MMG5_DPARAM_angleDetection = \ref _MMG5_ANGEDG */
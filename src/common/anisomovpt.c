@@ -58,7 +58,7 @@ int _MMG5_elementWeight(MMG5_pMesh mesh,MMG5_pSol met, MMG5_pTria pt,
   double         Jacsigma[3][2],Jactmp[3][2],m[6],mo[6],density,to[3],no[3],ll;
   double         dens[3],*n1,*n2,ps1,ps2,intpt[2],ux,uy,uz;
   char           i0,i1,i2,j,nullDens;
-  static char    mmgErr=0;
+  static _MMG5_TLS char    mmgErr=0;
 
   i0 = 0;
   i1 = 1;
@@ -49,11 +49,11 @@ double _MMG5_surf(MMG5_pMesh mesh,double m[3][6],MMG5_pTria ptt) {
   _MMG5_Bezier   b;
   double         surf,dens,J[3][2],mJ[3][2],tJmJ[2][2];
   char           i,nullDens;
-  static char    mmgErr=0;
+  static _MMG5_TLS char    mmgErr=0;
 
   surf = 0.0;
 
-  if ( !_MMG5_bezierCP(mesh,ptt,&b,1) ) return(0.0);
+  if ( !mesh->func.bezierCP(mesh,ptt,&b,1) ) return(0.0);
 
   /* Compute density integrand of volume at the 3 vertices of T */
   nullDens = 0;
@@ -121,7 +121,7 @@ double _MMG5_surf(MMG5_pMesh mesh,double m[3][6],MMG5_pTria ptt) {
  */
 double _MMG5_surftri_ani(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTria ptt) {
   MMG5_pPoint    p[3];
-  int            np[3];
+  MMG5_int       np[3];
   double         ux,uy,uz,m[3][6];
   char           i1,i2;
   int            i;
@@ -169,7 +169,8 @@ double _MMG5_surftri33_ani(MMG5_pMesh mesh,MMG5_pTria ptt,
                            double ma[6], double mb[6], double mc[6]) {
   double         mm[6];
   double         *a,*b,*c,abx,aby,abz,acx,acy,acz,dens[3],surf;
-  int            i,ia,ib,ic;
+  int            i;
+  MMG5_int       ia,ib,ic;
 
   ia = ptt->v[0];
   ib = ptt->v[1];
@@ -225,7 +226,7 @@ void _MMG5_defUninitSize(MMG5_pMesh mesh,MMG5_pSol met,char ismet)
 {
   MMG5_pPoint   ppt;
   double        *m,*n,r[3][3],isqhmax;
-  int           k;
+  MMG5_int      k;
 
   isqhmax = 1.0 / (mesh->info.hmax*mesh->info.hmax);
   for (k=1; k<=mesh->np; k++) {
@@ -434,7 +435,7 @@ int _MMG5_solveDefmetregSys( MMG5_pMesh mesh, double r[3][3], double c[3],
                              double isqhmin, double isqhmax, double hausd)
 {
   double intm[3], kappa[2], vp[2][2], b0[3], b1[3], b2[3];
-  static int mmgWarn0=0;
+  static _MMG5_TLS int mmgWarn0=0;
 
   memset(intm,0x0,3*sizeof(double));
 
@@ -532,7 +533,7 @@ int _MMG5_solveDefmetregSys( MMG5_pMesh mesh, double r[3][3], double c[3],
  * point.
  *
  */
-int _MMG5_solveDefmetrefSys( MMG5_pMesh mesh, MMG5_pPoint p0, int ipref[2],
+int _MMG5_solveDefmetrefSys( MMG5_pMesh mesh, MMG5_pPoint p0, MMG5_int ipref[2],
                              double r[3][3], double c[3],
                              double tAA[6], double tAb[3], double *m,
                              double isqhmin, double isqhmax, double hausd)
@@ -541,7 +542,7 @@ int _MMG5_solveDefmetrefSys( MMG5_pMesh mesh, MMG5_pPoint p0, int ipref[2],
   double       intm[3], kappa[2], vp[2][2], b0[3], b1[3], b2[3], kappacur;
   double       gammasec[3],tau[2], ux, uy, uz, ps1, l, ll, *t, *t1;
   int          i;
-  static char  mmgWarn=0;
+  static _MMG5_TLS char  mmgWarn=0;
 
   memset(intm,0x0,3*sizeof(double));
 
@@ -719,8 +720,8 @@ int _MMG5_solveDefmetrefSys( MMG5_pMesh mesh, MMG5_pPoint p0, int ipref[2],
  * ridge.
  *
  **/
-double _MMG5_ridSizeInTangentDir(MMG5_pMesh mesh, MMG5_pPoint p0, int idp,
-                                 int* iprid, double isqhmin,double isqhmax)
+double _MMG5_ridSizeInTangentDir(MMG5_pMesh mesh, MMG5_pPoint p0, MMG5_int idp,
+                                 MMG5_int* iprid, double isqhmin,double isqhmax)
 {
   int    i;
   double n0[3],tau[3],gammasec[3],c[3],ps,ll,l,m;
@@ -909,7 +910,8 @@ int _MMG5_grad2metSurf(MMG5_pMesh mesh, MMG5_pSol met, MMG5_pTria pt, int i)
   double   mtmp[3][3],val;
   double   /*,l1,l2*/l,dd;
   double   lambda[2],vp[2][2],alpha,beta,mu[3];
-  int      np1,np2,kmin,idx;
+  int      kmin,idx;
+  MMG5_int np1,np2;
   char     i1,i2,ichg;
 
   i1 = _MMG5_inxt2[i];
@@ -47,10 +47,10 @@ extern MMG5_Info  info;
  * Compute average normal of triangles sharing P without crossing ridge.
  *
  */
-int _MMG5_boulen(MMG5_pMesh mesh,int *adjt,int start,int ip,double *nn) {
+int _MMG5_boulen(MMG5_pMesh mesh,MMG5_int *adjt,MMG5_int start,int ip,double *nn) {
   MMG5_pTria    pt;
   double        n[3],dd;
-  int           *adja,k;
+  MMG5_int      *adja,k;
   char          i,i1,i2;
 
   pt = &mesh->tria[start];
@@ -123,11 +123,11 @@ int _MMG5_boulen(MMG5_pMesh mesh,int *adjt,int start,int ip,double *nn) {
  * Compute the tangent to the curve at point \a ip.
  *
  */
-int _MMG5_boulec(MMG5_pMesh mesh,int *adjt,int start,int ip,double *tt) {
+int _MMG5_boulec(MMG5_pMesh mesh,MMG5_int *adjt,MMG5_int start,int ip,double *tt) {
   MMG5_pTria    pt;
   MMG5_pPoint   p0,p1,p2;
   double        dd;
-  int           *adja,k;
+  MMG5_int      *adja,k;
   char          i,i1,i2;
 
   pt = &mesh->tria[start];
@@ -211,10 +211,11 @@ int _MMG5_boulec(MMG5_pMesh mesh,int *adjt,int start,int ip,double *tt) {
  * the vertex \a ip.
  *
  */
-int _MMG5_bouler(MMG5_pMesh mesh,int *adjt,int start,int ip,
-                 int *list,int *listref,int *ng,int *nr,int lmax) {
+int _MMG5_bouler(MMG5_pMesh mesh,MMG5_int *adjt,MMG5_int start,int ip,
+                 MMG5_int *list,int *listref,int *ng,int *nr,int lmax) {
   MMG5_pTria    pt;
-  int           *adja,k,ns;
+  int           ns;
+  MMG5_int      *adja,k;
   char          i,i1,i2;
 
   pt  = &mesh->tria[start];
@@ -38,6 +38,7 @@
 #include <math.h>
 #include <assert.h>
 
+#include "mmgcommon.h"
 #include "eigenv.h"
 
 /* seeking 1.e-05 accuracy */
@@ -84,7 +85,7 @@ static int newton3(double p[4],double x[3]) {
   double      delta,fx,dfx,dxx;
   double      fdx0,fdx1,dx0,dx1,x1,x2;
   int         it,n;
-  static char mmgWarn=0;
+  static _MMG5_TLS char mmgWarn=0;
 
   /* coeffs polynomial, a=1 */
   if ( p[3] != 1. ) {
@@ -47,23 +47,15 @@
  * \remark the ph->s field computation is useless in mmgs.
  *
  */
-int _MMG5_mmgHashTria(MMG5_pMesh mesh, int *adjt, _MMG5_Hash *hash, int chkISO) {
+int _MMG5_mmgHashTria(MMG5_pMesh mesh, MMG5_int *adjt, _MMG5_Hash *hash, int chkISO) {
   MMG5_pTria     pt,pt1;
   _MMG5_hedge    *ph;
-  int            *adja,k,kk,jel,lel,hmax,dup,nmf,ia,ib;
-  char           i,i1,i2,j,l,ok;
-  unsigned int   key;
+  int            dup,nmf;
+  MMG5_int       lel,*adja,jel,key,k,ia,ib;
+  char           i,i1,i2,j,l;
 
-  /* adjust hash table params */
-  hmax = 3.71*mesh->np;
-  hash->siz  = mesh->np;
-  hash->max  = hmax + 1;
-  hash->nxt  = hash->siz;
-  _MMG5_ADD_MEM(mesh,(hash->max+1)*sizeof(_MMG5_hedge),"hash table",return(0));
-  _MMG5_SAFE_CALLOC(hash->item,hash->max+1,_MMG5_hedge,0);
-
-  for (k=hash->siz; k<hash->max; k++)
-    hash->item[k].nxt = k+1;
+  /* adjust hash table params: about 3 edges per vertex */
+  if ( !_MMG5_hashNew(mesh,hash,3*mesh->np,3.71*mesh->np) )  return(0);
 
   if ( mesh->info.ddebug )  fprintf(stdout,"  h- stage 1: init\n");
 
@@ -84,88 +76,56 @@ int _MMG5_mmgHashTria(MMG5_pMesh mesh, int *adjt, _MMG5_Hash *hash, int chkISO)
       /* compute key */
       ia  = MG_MIN(pt->v[i1],pt->v[i2]);
       ib  = MG_MAX(pt->v[i1],pt->v[i2]);
-      key = (_MMG5_KA*ia + _MMG5_KB*ib) % hash->siz;
+      key = _MMG5_hashKey(hash,ia,ib);
       ph  = &hash->item[key];
+      while ( ph->a && !(ph->a == ia && ph->b == ib) ) {
+        key = (key+1) & (hash->siz-1);
+        ph  = &hash->item[key];
+      }
 
       /* store edge */
-      if ( ph->a == 0 ) {
+      if ( !ph->a ) {
         ph->a = ia;
         ph->b = ib;
         ph->k = 3*k + i;
-        ph->nxt = 0;
         ++ph->s;
+        if ( ++hash->nitem >= hash->max && !_MMG5_hashGrow(mesh,hash) )
+          return(0);
         continue;
       }
+
       /* update info about adjacent */
-      ok = 0;
-      while ( ph->a ) {
-        if ( ph->a == ia && ph->b == ib ) {
-          jel = ph->k / 3;
-          j   = ph->k % 3;
-          pt1 = &mesh->tria[jel];
-          /* discard duplicate face */
-          if ( pt1->v[j] == pt->v[i] ) {
-            pt1->v[0] = 0;
-            dup++;
-          }
-          /* update adjacent */
-          else if ( !adjt[3*(jel-1)+1+j] ) {
-            adja[i] = 3*jel + j;
-            adjt[3*(jel-1)+1+j] = 3*k + i;
-            ++ph->s;
-          }
-          /* non-manifold case */
-          else if ( adja[i] != 3*jel+j ) {
-            if ( chkISO && ( (pt->ref == MG_ISO) || (pt->ref < 0)) ) {
-              lel = adjt[3*(jel-1)+1+j]/3;
-              l   = adjt[3*(jel-1)+1+j]%3;
-              adjt[3*(lel-1)+1+l] = 0;
-              adja[i] = 3*jel+j;
-              adjt[3*(jel-1)+1+j] = 3*k + i;
-              (mesh->tria[lel]).tag[l] |= MG_GEO + MG_NOM;
-            }
-            else {
-              pt1->tag[j] |= MG_GEO + MG_NOM;
-            }
-            pt->tag[i] |= MG_GEO + MG_NOM;
-            nmf++;
-            ++ph->s;
-          }
-          ok = 1;
-          break;
+      jel = ph->k / 3;
+      j   = ph->k % 3;
+      pt1 = &mesh->tria[jel];
+      /* discard duplicate face */
+      if ( pt1->v[j] == pt->v[i] ) {
+        pt1->v[0] = 0;
+        dup++;
+      }
+      /* update adjacent */
+      else if ( !adjt[3*(jel-1)+1+j] ) {
+        adja[i] = 3*jel + j;
+        adjt[3*(jel-1)+1+j] = 3*k + i;
+        ++ph->s;
+      }
+      /* non-manifold case */
+      else if ( adja[i] != 3*jel+j ) {
+        if ( chkISO && ( (pt->ref == MG_ISO) || (pt->ref < 0)) ) {
+          lel = adjt[3*(jel-1)+1+j]/3;
+          l   = adjt[3*(jel-1)+1+j]%3;
+          adjt[3*(lel-1)+1+l] = 0;
+          adja[i] = 3*jel+j;
+          adjt[3*(jel-1)+1+j] = 3*k + i;
+          (mesh->tria[lel]).tag[l] |= MG_GEO + MG_NOM;
         }
-        else if ( !ph->nxt ) {
-          ph->nxt = hash->nxt;
-          ph = &hash->item[ph->nxt];
-          assert(ph);
-
-          if ( hash->nxt >= hash->max-1 ) {
-            if ( mesh->info.ddebug ) {
-              fprintf(stderr,"\n  ## Warning: %s: memory alloc problem (edge):"
-                      " %d\n",__func__,hash->max);
-            }
-            _MMG5_TAB_RECALLOC(mesh,hash->item,hash->max,0.2,_MMG5_hedge,
-                               "_MMG5_edge",return(0),0);
-
-            ph = &hash->item[hash->nxt];
-
-            for (kk=ph->nxt; kk<hash->max; kk++)
-              hash->item[kk].nxt = kk+1;
-          }
-
-          hash->nxt = ph->nxt;
-          ph->a = ia;
-          ph->b = ib;
-          ph->k = 3*k + i;
-          ph->nxt = 0;
-          ++ph->s;
-          ok = 1;
-          break;
+        else {
+          pt1->tag[j] |= MG_GEO + MG_NOM;
         }
-        else
-          ph = &hash->item[ph->nxt];
+        pt->tag[i] |= MG_GEO + MG_NOM;
+        nmf++;
+        ++ph->s;
       }
-      assert(ok);
     }
   }
 
@@ -201,45 +161,28 @@ int _MMG5_mmgHashTria(MMG5_pMesh mesh, int *adjt, _MMG5_Hash *hash, int chkISO)
  * Add edge \f$[a;b]\f$ to the hash table.
  *
  */
-int _MMG5_hashEdge(MMG5_pMesh mesh,_MMG5_Hash *hash, int a,int b,int k) {
+int _MMG5_hashEdge(MMG5_pMesh mesh,_MMG5_Hash *hash, MMG5_int a,MMG5_int b,MMG5_int k) {
   _MMG5_hedge  *ph;
-  int          key,ia,ib,j;
+  MMG5_int     key,ia,ib;
 
   ia  = MG_MIN(a,b);
   ib  = MG_MAX(a,b);
-  key = (_MMG5_KA*ia + _MMG5_KB*ib) % hash->siz;
+  key = _MMG5_hashKey(hash,ia,ib);
   ph  = &hash->item[key];
 
-  if ( ph->a == ia && ph->b == ib )
-    return(1);
-  else if ( ph->a ) {
-    while ( ph->nxt && ph->nxt < hash->max ) {
-      ph = &hash->item[ph->nxt];
-      if ( ph->a == ia && ph->b == ib )  return(1);
-    }
-    ph->nxt   = hash->nxt;
-    ph        = &hash->item[hash->nxt];
-
-    if ( hash->nxt >= hash->max-1 ) {
-      if ( mesh->info.ddebug )
-        fprintf(stderr,"\n  ## Warning: %s: memory alloc problem (edge):"
-                " %d\n",__func__,hash->max);
-
-      _MMG5_TAB_RECALLOC(mesh,hash->item,hash->max,0.2,_MMG5_hedge,
-                         "_MMG5_edge",return(0),0);
-      /* ph pointer may be false after realloc */
-      ph        = &hash->item[hash->nxt];
-
-      for (j=ph->nxt; j<hash->max; j++)  hash->item[j].nxt = j+1;
-    }
-    hash->nxt = ph->nxt;
+  while ( ph->a ) {
+    if ( ph->a == ia && ph->b == ib )  return(1);
+    key = (key+1) & (hash->siz-1);
+    ph  = &hash->item[key];
   }
 
   /* insert new edge */
   ph->a = ia;
   ph->b = ib;
   ph->k = k;
-  ph->nxt = 0;
+
+  if ( ++hash->nitem >= hash->max )
+    return(_MMG5_hashGrow(mesh,hash));
 
   return(1);
 }
@@ -255,13 +198,13 @@ int _MMG5_hashEdge(MMG5_pMesh mesh,_MMG5_Hash *hash, int a,int b,int k) {
  * Update the index of the point stored along the edge \f$[a;b]\f$
  *
  */
-int _MMG5_hashUpdate(_MMG5_Hash *hash, int a,int b,int k) {
+int _MMG5_hashUpdate(_MMG5_Hash *hash, MMG5_int a,MMG5_int b,MMG5_int k) {
   _MMG5_hedge  *ph;
-  int          key,ia,ib;
+  MMG5_int     key,ia,ib;
 
   ia  = MG_MIN(a,b);
   ib  = MG_MAX(a,b);
-  key = (_MMG5_KA*ia + _MMG5_KB*ib) % hash->siz;
+  key = _MMG5_hashKey(hash,ia,ib);
   ph  = &hash->item[key];
 
   while ( ph->a ) {
@@ -269,11 +212,8 @@ int _MMG5_hashUpdate(_MMG5_Hash *hash, int a,int b,int k) {
       ph->k = k;
       return 1;
     }
-
-    if ( !ph->nxt ) return 0;
-
-    ph = &hash->item[ph->nxt];
-
+    key = (key+1) & (hash->siz-1);
+    ph  = &hash->item[key];
   }
 
   return 0;
@@ -288,22 +228,21 @@ int _MMG5_hashUpdate(_MMG5_Hash *hash, int a,int b,int k) {
  * Find the index of point stored along  \f$[a;b]\f$.
  *
  */
-int _MMG5_hashGet(_MMG5_Hash *hash,int a,int b) {
+MMG5_int _MMG5_hashGet(_MMG5_Hash *hash,MMG5_int a,MMG5_int b) {
   _MMG5_hedge  *ph;
-  int          key,ia,ib;
+  MMG5_int     key,ia,ib;
 
   if ( !hash->item ) return(0);
 
   ia  = MG_MIN(a,b);
   ib  = MG_MAX(a,b);
-  key = (_MMG5_KA*ia + _MMG5_KB*ib) % hash->siz;
+  key = _MMG5_hashKey(hash,ia,ib);
   ph  = &hash->item[key];
 
-  if ( !ph->a )  return(0);
-  if ( ph->a == ia && ph->b == ib )  return(ph->k);
-  while ( ph->nxt ) {
-    ph = &hash->item[ph->nxt];
+  while ( ph->a ) {
     if ( ph->a == ia && ph->b == ib )  return(ph->k);
+    key = (key+1) & (hash->siz-1);
+    ph  = &hash->item[key];
   }
   return(0);
 }
@@ -311,27 +250,224 @@ int _MMG5_hashGet(_MMG5_Hash *hash,int a,int b) {
 /**
  * \param mesh pointer toward the mesh structure.
  * \param hash pointer toward the hash table of edges.
- * \param hsiz initial size of hash table.
- * \param hmax maximal size of hash table.
+ * \param hsiz expected number of items.
+ * \param hmax maximal number of items.
  * \return 1 if success, 0 if fail.
  *
- * Hash edges or faces.
+ * Allocate a hash table of edges or faces that can store \a hsiz items and
+ * half of \a hmax items without being enlarged (thus it is enlarged at most
+ * once if we store \a hmax items and we use about the same memory than a
+ * chained table of \a hmax items).
  *
  */
-int _MMG5_hashNew(MMG5_pMesh mesh,_MMG5_Hash *hash,int hsiz,int hmax) {
-  int   k;
+int _MMG5_hashNew(MMG5_pMesh mesh,_MMG5_Hash *hash,MMG5_int hsiz,MMG5_int hmax) {
+  MMG5_int nitem;
 
-  /* adjust hash table params */
-  hash->siz  = hsiz+1;
-  hash->max  = hmax + 2;
-  hash->nxt  = hash->siz;
+  hash->item = NULL;
 
-  _MMG5_ADD_MEM(mesh,(hash->max+1)*sizeof(_MMG5_hedge),"hash table",
+  /* adjust hash table params: load factor lower than 3/4 */
+  nitem     = MG_MAX(hsiz,hmax/2);
+  hash->siz = 16;
+  while ( hash->siz - hash->siz/4 <= nitem && hash->siz < (1<<30) )
+    hash->siz <<= 1;
+  hash->max   = hash->siz - hash->siz/4;
+  hash->nitem = 0;
+
+  _MMG5_ADD_MEM(mesh,hash->siz*sizeof(_MMG5_hedge),"hash table",
+                return(0));
+  _MMG5_SAFE_CALLOC(hash->item,hash->siz,_MMG5_hedge,0);
+
+  return(1);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param hash pointer toward the hash table of edges.
+ * \return 1 if success, 0 if fail.
+ *
+ * Double the number of slots of the hash table and re-insert the stored
+ * items (the position of the items change).
+ *
+ */
+int _MMG5_hashGrow(MMG5_pMesh mesh,_MMG5_Hash *hash) {
+  _MMG5_hedge  *old,*ph;
+  int          k;
+  MMG5_int     osiz,key;
+
+  if ( hash->siz >= (1<<30) ) {
+    fprintf(stderr,"\n  ## Error: %s: hash table too large.\n",__func__);
+    return(0);
+  }
+
+  old  = hash->item;
+  osiz = hash->siz;
+
+  _MMG5_ADD_MEM(mesh,2*osiz*sizeof(_MMG5_hedge),"larger hash table",
                 return(0));
-  _MMG5_SAFE_CALLOC(hash->item,hmax+2,_MMG5_hedge,0);
+  _MMG5_SAFE_CALLOC(hash->item,2*osiz,_MMG5_hedge,0);
+  hash->siz = 2*osiz;
+  hash->max = hash->siz - hash->siz/4;
+
+  for (k=0; k<osiz; k++) {
+    if ( !old[k].a )  continue;
+    key = _MMG5_hashKey(hash,old[k].a,old[k].b);
+    ph  = &hash->item[key];
+    while ( ph->a ) {
+      key = (key+1) & (hash->siz-1);
+      ph  = &hash->item[key];
+    }
+    *ph = old[k];
+  }
+  _MMG5_DEL_MEM(mesh,old,osiz*sizeof(_MMG5_hedge));
+
+  return(1);
+}
+
+/** Maximal number of faces of a chain paired in parallel. */
+#define _MMG5_ADJACHAIN 64
+
+/** Face of an element in a chain of the adjacency hash table. */
+typedef struct {
+  MMG5_int l; /*!< Index of the face: \a nface*(k-1)+i+1 for the face \a i of \a k */
+  MMG5_int f[3]; /*!< Sorted vertices of the face */
+} _MMG5_hface;
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param nface number of faces per element.
+ * \param adja pointer toward the adjacency table (used as link table).
+ * \param hcode pointer toward the heads of the chains.
+ * \param key key of the chain to process.
+ * \param fvert function that gives the sorted vertices of a face.
+ * \param buf work buffer.
+ * \param nbuf size of \a buf.
+ * \return 1 if success, 0 if the chain has more than \a nbuf faces.
+ *
+ * Pair the faces of the chain \a key of the adjacency hash table. The faces
+ * are processed by decreasing index and each face is paired with the
+ * unpaired face of highest index with the same vertices, so the result does
+ * not depend on the order of the faces in the chain.
+ *
+ */
+static inline
+int _MMG5_hashAdjaChain(MMG5_pMesh mesh,int nface,MMG5_int *adja,MMG5_int *hcode,
+                        MMG5_int key,_MMG5_hashFaceVert fvert,_MMG5_hface *buf,
+                        int nbuf) {
+  _MMG5_hface tmp;
+  MMG5_int    l;
+  int         n,j,m;
+
+  n = 0;
+  for ( l=hcode[key]; l; l=adja[l] ) {
+    if ( n == nbuf )  return(0);
+    buf[n++].l = l;
+  }
+
+  /* sort by decreasing index */
+  for ( j=1; j<n; ++j ) {
+    tmp = buf[j];
+    for ( m=j; m>0 && buf[m-1].l < tmp.l; --m )
+      buf[m] = buf[m-1];
+    buf[m] = tmp;
+  }
+
+  for ( j=0; j<n; ++j ) {
+    l = buf[j].l;
+    fvert(mesh,(l-1)/nface+1,(int)((l-1)%nface),buf[j].f);
+    adja[l] = 0;
+  }
+
+  for ( j=0; j<n; ++j ) {
+    if ( adja[buf[j].l] )  continue;
+    for ( m=j+1; m<n; ++m ) {
+      if ( adja[buf[m].l] )  continue;
+      if ( buf[m].f[0] == buf[j].f[0] && buf[m].f[1] == buf[j].f[1]
+           && buf[m].f[2] == buf[j].f[2] ) {
+        adja[buf[j].l] = nface*((buf[m].l-1)/nface+1) + (buf[m].l-1)%nface;
+        adja[buf[m].l] = nface*((buf[j].l-1)/nface+1) + (buf[j].l-1)%nface;
+        break;
+      }
+    }
+  }
+  return(1);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param nelt number of elements.
+ * \param nface number of faces per element (4 for tetra, 3 for tria).
+ * \param adja pointer toward the adjacency table (filled with 0).
+ * \param fvert function that gives the sorted vertices of a face.
+ * \return 1 if success, 0 if fail.
+ *
+ * Fill the adjacency table of the elements \a 1 to \a nelt using
+ * mesh->info.nthreads threads. The faces are inserted in a chained hash
+ * table with atomic updates of the chain heads, then the chains are
+ * processed independently. The adjacency of the face \a i of \a k is
+ * \a nface*kk+ii if the face \a ii of \a kk is shared, 0 otherwise; like in
+ * the sequential hashing, a face shared by more than 2 elements is paired
+ * with the face of highest index of the remaining ones.
+ *
+ */
+int _MMG5_hashAdjaPar(MMG5_pMesh mesh,MMG5_int nelt,int nface,MMG5_int *adja,
+                      _MMG5_hashFaceVert fvert) {
+  _MMG5_hface  *hbuf;
+  MMG5_int     *hcode,hsize,k,l,old,f[3];
+  int           i,n;
+  uint64_t      key;
+#ifdef _OPENMP
+  int           nth;
+#endif
+
+  if ( nelt <= 0 )  return(1);
+
+#ifdef _OPENMP
+  nth = MG_MAX(1,mesh->info.nthreads);
+#endif
+
+  hsize = nelt;
+  _MMG5_SAFE_CALLOC(hcode,hsize+1,MMG5_int,0);
+
+  /* stage 1: insert the faces at the head of their chain */
+#pragma omp parallel for num_threads(nth) private(i,l,old,f,key)
+  for ( k=1; k<=nelt; ++k ) {
+    if ( !fvert(mesh,k,0,f) )  continue;
+    for ( i=0; i<nface; ++i ) {
+      if ( i )  fvert(mesh,k,i,f);
+      /* the sum of the vertices keeps close faces in close chains */
+      key = (uint64_t)f[0] + (uint64_t)f[1] + (uint64_t)f[2];
+      key = key % hsize + 1;
+      l   = nface*(k-1) + i + 1;
+#pragma omp atomic capture
+      { old = hcode[key]; hcode[key] = l; }
+      adja[l] = old;
+    }
+  }
 
-  for (k=hash->siz; k<hash->max; k++)
-    hash->item[k].nxt = k+1;
+  /* stage 2: pair the faces of each chain */
+#pragma omp parallel num_threads(nth)
+  {
+    _MMG5_hface buf[_MMG5_ADJACHAIN];
+    MMG5_int    kk;
+
+#pragma omp for schedule(dynamic,1024)
+    for ( kk=1; kk<=hsize; ++kk ) {
+      if ( hcode[kk] && _MMG5_hashAdjaChain(mesh,nface,adja,hcode,kk,fvert,
+                                            buf,_MMG5_ADJACHAIN) )
+        hcode[kk] = 0;
+    }
+  }
+
+  /* long chains */
+  for ( k=1; k<=hsize; ++k ) {
+    if ( !hcode[k] )  continue;
+    n = 0;
+    for ( l=hcode[k]; l; l=adja[l] )  ++n;
+    _MMG5_SAFE_MALLOC(hbuf,n,_MMG5_hface,0);
+    _MMG5_hashAdjaChain(mesh,nface,adja,hcode,k,fvert,hbuf,n);
+    _MMG5_SAFE_FREE(hbuf);
+  }
 
+  _MMG5_SAFE_FREE(hcode);
   return(1);
 }
@@ -51,11 +51,11 @@
  *
  */
 static inline
-double _MMG5_lenEdg(MMG5_pMesh mesh,int np0,int np1,
+double _MMG5_lenEdg(MMG5_pMesh mesh,MMG5_int np0,MMG5_int np1,
                     double *m0,double *m1,char isedg) {
   MMG5_pPoint   p0,p1;
   double        gammaprim0[3],gammaprim1[3],t[3],*n1,*n2,ux,uy,uz,ps1,ps2,l0,l1;
-  static char   mmgWarn=0;
+  static _MMG5_TLS char   mmgWarn=0;
 
   p0 = &mesh->point[np0];
   p1 = &mesh->point[np1];
@@ -195,10 +195,10 @@ double _MMG5_lenEdg(MMG5_pMesh mesh,int np0,int np1,
  *
  */
 static inline
-double _MMG5_lenSurfEdg_ani(MMG5_pMesh mesh,MMG5_pSol met,int np0,int np1,char isedg) {
+double _MMG5_lenSurfEdg_ani(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int np0,MMG5_int np1,char isedg) {
   MMG5_pPoint   p0,p1;
   double        *m0,*m1,met0[6],met1[6],ux,uy,uz;
-  static char   mmgWarn = 0;
+  static _MMG5_TLS char   mmgWarn = 0;
 
   p0 = &mesh->point[np0];
   p1 = &mesh->point[np1];
@@ -262,7 +262,7 @@ double _MMG5_lenSurfEdg_ani(MMG5_pMesh mesh,MMG5_pSol met,int np0,int np1,char i
  */
 static inline
 double _MMG5_lenSurfEdg33_ani(MMG5_pMesh mesh,MMG5_pSol met,
-                              int np0,int np1,char isedg) {
+                              MMG5_int np0,MMG5_int np1,char isedg) {
   double        *m0,*m1;
 
   /* Set metrics */
@@ -286,7 +286,7 @@ double _MMG5_lenSurfEdg33_ani(MMG5_pMesh mesh,MMG5_pSol met,
  *
  */
 static
-inline double _MMG5_lenSurfEdg_iso(MMG5_pMesh mesh,MMG5_pSol met,int ip1,int ip2, char isedg) {
+inline double _MMG5_lenSurfEdg_iso(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int ip1,MMG5_int ip2, char isedg) {
   MMG5_pPoint   p1,p2;
   double   h1,h2,l,r,len;
 
@@ -35,32 +35,15 @@
 
 #include "mmgcommon.h"
 
+#if defined(__unix__) || defined(__unix) || defined(unix) || (defined(__APPLE__) && defined(__MACH__))
+#define _MMG5_USE_MMAP
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 #define sw 4
 #define sd 8
 
-static int _MMG5_swapbin(int sbin)
-{
-  int inv;
-  char *p_in = (char *) &sbin;
-  char *p = (char *)&inv;
-
-
-  p[0] = p_in[3];
-  p[1] = p_in[2];
-  p[2] = p_in[1];
-  p[3] = p_in[0];
-
-  return(inv);
-  /*unsigned char c1, c2, c3, c4;
-
-    c1 = sbin & 255;
-    c2 = (sbin >> 8) & 255;
-    c3 = (sbin >> 16) & 255;
-    c4 = (sbin >> 24) & 255;
-
-    return ((int)c1 << 24) + ((int)c2 << 16) + ((int)c3 << 8) + c4;   */
-
-}
 static float _MMG5_swapf(float sbin)
 {
   float out;
@@ -88,940 +71,1049 @@ static double _MMG5_swapd(double sbin)
   return(out);
 }
 
+/**
+ * \param dst pointer toward the area to swap.
+ * \param len number of bytes to swap.
+ * \param wsiz size of the words (4 or 8 bytes).
+ *
+ * Swap the endianness of the \a len/wsiz words of size \a wsiz stored at \a dst.
+ *
+ */
+static inline
+void _MMG5_swapWords(void *dst,size_t len,int wsiz) {
+  char   *p,tmp;
+  size_t  k;
+  int     i;
+
+  for ( k=0; k<len; k+=wsiz ) {
+    p = (char*)dst + k;
+    for ( i=0; i<wsiz/2; ++i ) {
+      tmp          = p[i];
+      p[i]         = p[wsiz-1-i];
+      p[wsiz-1-i]  = tmp;
+    }
+  }
+}
+
+/**
+ * \param inm pointer toward the binary file.
+ * \param bf pointer toward the binary file structure.
+ * \return 1 if success, 0 if fail.
+ *
+ * Map the whole content of the file \a inm in memory (read it in an allocated
+ * buffer on systems without mmap).
+ *
+ */
 static
-int _MMG5_countBinaryElts(FILE **inm, const int nelts,const int iswp,
-                          int *np, int *na, int* nt,int *nq, int *ne, int *npr)
-{
-  int    typ,num,tagNum,i,k,l,idx;
-  static char mmgWarn = 0;
-
-  k = 0;
-
-  while ( k<nelts ) {
-    fread(&typ,sw,1,(*inm));
-    if(iswp) typ = _MMG5_swapbin(typ);
-
-    switch (typ) {
-    case 1:
-      /* Edge */
-      fread(&num,sw,1,(*inm));
-      fread(&tagNum,sw,1,(*inm));
-      if(iswp) {
-        num = _MMG5_swapbin(num);
-        tagNum = _MMG5_swapbin(tagNum);
-      }
-      for ( idx=0; idx<num; ++idx ) {
-        fread(&i,sw,1,(*inm));
-        for ( l=0; l<tagNum; ++l ) fread(&i,sw,1,(*inm));
-        fread(&i,sw,1,(*inm)); // edge->a
-        fread(&i,sw,1,(*inm)); // edge->b
-      }
-      (*na) += num;
-      k  += num;
-      break;
-    case 2:
-      /* Tria */
-      fread(&num,sw,1,(*inm));
-      fread(&tagNum,sw,1,(*inm));
-      if(iswp) {
-        num = _MMG5_swapbin(num);
-        tagNum = _MMG5_swapbin(tagNum);
-      }
-      for ( idx=0; idx<num; ++idx ) {
-        fread(&i,sw,1,(*inm));
-        for ( l=0; l<tagNum; ++l ) fread(&i,sw,1,(*inm));
-        fread(&i,sw,1,(*inm)); // tria->v[0]
-        fread(&i,sw,1,(*inm)); // tria->v[1]
-        fread(&i,sw,1,(*inm)); // tria->v[2]
-      }
-      (*nt) += num;
-      k  += num;
-      break;
-    case 3:
-      /* Quad */
-      fread(&num,sw,1,(*inm));
-      fread(&tagNum,sw,1,(*inm));
-      if(iswp) {
-        num = _MMG5_swapbin(num);
-        tagNum = _MMG5_swapbin(tagNum);
-      }
-      for ( idx=0; idx<num; ++idx ) {
-        fread(&i,sw,1,(*inm));
-        for ( l=0; l<tagNum; ++l ) fread(&i,sw,1,(*inm));
-        fread(&i,sw,1,(*inm)); // quadra->v[0]
-        fread(&i,sw,1,(*inm)); // quadra->v[1]
-        fread(&i,sw,1,(*inm)); // quadra->v[2]
-        fread(&i,sw,1,(*inm)); // quadra->v[3]
-      }
-      (*nq) += num;
-      k  += num;
-      break;
-    case 4:
-      /* Tetra */
-      fread(&num,sw,1,(*inm));
-      fread(&tagNum,sw,1,(*inm));
-      if(iswp) {
-        num = _MMG5_swapbin(num);
-        tagNum = _MMG5_swapbin(tagNum);
-      }
-      for ( idx=0; idx<num; ++idx ) {
-        fread(&i,sw,1,(*inm));
-        for ( l=0; l<tagNum; ++l ) fread(&i,sw,1,(*inm));
-        fread(&i,sw,1,(*inm)); // tetra->v[0]
-        fread(&i,sw,1,(*inm)); // tetra->v[1]
-        fread(&i,sw,1,(*inm)); // tetra->v[2]
-        fread(&i,sw,1,(*inm)); // tetra->v[3]
-      }
-      (*ne) += num;
-      k  += num;
-      break;
-    case 6:
-      /* Prism */
-      fread(&num,sw,1,(*inm));
-      fread(&tagNum,sw,1,(*inm));
-      if(iswp) {
-        num = _MMG5_swapbin(num);
-        tagNum = _MMG5_swapbin(tagNum);
-      }
-      for ( idx=0; idx<num; ++idx ){
-        fread(&i,sw,1,(*inm));
-        for ( l=0; l<tagNum; ++l ) fread(&i,sw,1,(*inm));
-        fread(&i,sw,1,(*inm)); // prism->v[0]
-        fread(&i,sw,1,(*inm)); // prism->v[1]
-        fread(&i,sw,1,(*inm)); // prism->v[2]
-        fread(&i,sw,1,(*inm)); // prism->v[3]
-        fread(&i,sw,1,(*inm)); // prism->v[4]
-        fread(&i,sw,1,(*inm)); // prism->v[5]
-      }
-      (*npr) += num;
-      k  += num;
-      break;
-    case 15:
-      /* Node */
-      fread(&num,sw,1,(*inm));
-      fread(&tagNum,sw,1,(*inm));
-      if(iswp) {
-        num = _MMG5_swapbin(num);
-        tagNum = _MMG5_swapbin(tagNum);
-      }
-      for ( idx=0; idx<num; ++idx ){
-        fread(&i,sw,1,(*inm));
-        for ( l=0; l<tagNum; ++l ) fread(&i,sw,1,(*inm));
-        fread(&i,sw,1,(*inm)); //node idx
-      }
-      (*np) += num;
-      k  += num;
-      break;
-    default:
-      if ( !mmgWarn ) {
-        fprintf(stderr,"\n  ## Warning: %s: unexpected type of element (%d) for at"
-                " least 1 element (%d).\n",__func__,typ,k);
-        mmgWarn = 1;
+int _MMG5_mapBinFile(FILE *inm,_MMG5_pBinFile bf) {
+#ifdef _MMG5_USE_MMAP
+  struct stat st;
+  int         fd;
+
+  fd = fileno(inm);
+  if ( fd >= 0 && !fstat(fd,&st) && st.st_size > 0 ) {
+    bf->siz = (size_t)st.st_size;
+    bf->buf = mmap(NULL,bf->siz,PROT_READ,MAP_PRIVATE,fd,0);
+    if ( bf->buf != MAP_FAILED ) {
+      /* the blocks are copied in file order */
+      madvise(bf->buf,bf->siz,MADV_SEQUENTIAL);
+      bf->map = 1;
+      return(1);
+    }
+    bf->buf = NULL;
+  }
+#endif
+
+  bf->map = 0;
+  if ( fseek(inm,0,SEEK_END) ) return(0);
+  bf->siz = (size_t)ftell(inm);
+  rewind(inm);
+  if ( !bf->siz ) return(0);
+
+  bf->buf = (char*)malloc(bf->siz);
+  if ( !bf->buf ) {
+    perror("  ## Memory problem: malloc");
+    return(0);
+  }
+  if ( fread(bf->buf,1,bf->siz,inm) != bf->siz ) {
+    free(bf->buf);
+    bf->buf = NULL;
+    return(0);
+  }
+  return(1);
+}
+
+/**
+ * \param bf pointer toward the binary file structure.
+ *
+ * Release the memory mapping (or the buffer) of a binary file.
+ *
+ */
+void _MMG5_closeBinFile(_MMG5_pBinFile bf) {
+
+  if ( !bf->buf ) return;
+
+#ifdef _MMG5_USE_MMAP
+  if ( bf->map ) {
+    munmap(bf->buf,bf->siz);
+    bf->buf = NULL;
+    return;
+  }
+#endif
+  free(bf->buf);
+  bf->buf = NULL;
+}
+
+/**
+ * \param bf pointer toward the binary file structure.
+ * \param pos position of the integer in the file.
+ * \return the integer stored at position \a pos, 0 if \a pos is outside the file.
+ *
+ * Read an integer in a binary file mapped in memory.
+ *
+ */
+int _MMG5_binInt(_MMG5_pBinFile bf,size_t pos) {
+  int val;
+
+  if ( pos + sw > bf->siz ) return(0);
+
+  memcpy(&val,bf->buf+pos,sw);
+  if ( bf->iswp ) _MMG5_swapWords(&val,sw,sw);
+
+  return(val);
+}
+
+/**
+ * \param bf pointer toward the binary file structure.
+ * \param pos position of the first record in the file.
+ * \param nrec number of records to copy.
+ * \param rsiz size of a record in the file.
+ * \param len number of bytes to copy for each record.
+ * \param wsiz size of the copied words (4 or 8 bytes).
+ * \param dst pointer toward the place where to copy the first record.
+ * \param dsiz distance between two records in \a dst.
+ * \return 1 if success, 0 if the records exceed the file.
+ *
+ * Copy the first \a len bytes of \a nrec consecutive records of a binary file
+ * mapped in memory into an array of structures, swapping the words if the file
+ * endianness differs from the machine one.
+ *
+ */
+int _MMG5_binCopy(_MMG5_pBinFile bf,size_t pos,MMG5_int nrec,size_t rsiz,size_t len,
+                  int wsiz,void *dst,size_t dsiz) {
+  const char *src;
+  char       *ptr;
+  MMG5_int    k;
+
+  if ( nrec <= 0 ) return(1);
+
+  if ( pos + (size_t)(nrec-1)*rsiz + len > bf->siz ) {
+    fprintf(stderr,"\n  ## Error: %s: unexpected end of file.\n",__func__);
+    return(0);
+  }
+
+  src = bf->buf + pos;
+  ptr = (char*)dst;
+
+  if ( rsiz == len && dsiz == len ) {
+    /* contiguous records */
+    memcpy(ptr,src,(size_t)nrec*len);
+    if ( bf->iswp ) _MMG5_swapWords(ptr,(size_t)nrec*len,wsiz);
+    return(1);
+  }
+
+  for ( k=0; k<nrec; ++k ) {
+    memcpy(ptr,src,len);
+    if ( bf->iswp ) _MMG5_swapWords(ptr,len,wsiz);
+    src += rsiz;
+    ptr += dsiz;
+  }
+  return(1);
+}
+
+/**
+ * \param bf pointer toward the binary file structure.
+ * \param pos position of the first element in the file.
+ * \param nrec number of elements to copy.
+ * \param nv number of vertices of an element.
+ * \param v pointer toward the vertices of the first element.
+ * \param dsiz size of the element structure.
+ * \return 1 if success, 0 if the elements exceed the file.
+ *
+ * Copy the \a nv vertices and the reference of \a nrec consecutive elements of
+ * a binary file mapped in memory into an array of elements whose reference
+ * follows the vertices. The file stores the integers on 32 bits: if the
+ * entity indices are 64 bits integers, they are converted one by one.
+ *
+ */
+int _MMG5_binCopyElt(_MMG5_pBinFile bf,size_t pos,MMG5_int nrec,int nv,
+                     MMG5_int *v,size_t dsiz) {
+  const char *src;
+  char       *ptr;
+  MMG5_int   k;
+  int        i,val;
+
+  if ( sizeof(MMG5_int) == sw )
+    return(_MMG5_binCopy(bf,pos,nrec,(nv+1)*sw,(nv+1)*sw,sw,v,dsiz));
+
+  if ( nrec <= 0 ) return(1);
+
+  if ( pos + (size_t)nrec*(nv+1)*sw > bf->siz ) {
+    fprintf(stderr,"\n  ## Error: %s: unexpected end of file.\n",__func__);
+    return(0);
+  }
+
+  src = bf->buf + pos;
+  ptr = (char*)v;
+
+  for ( k=0; k<nrec; ++k ) {
+    for ( i=0; i<=nv; ++i ) {
+      memcpy(&val,src,sw);
+      if ( bf->iswp ) _MMG5_swapWords(&val,sw,sw);
+      if ( i < nv )
+        ((MMG5_int*)ptr)[i] = val;
+      else
+        *(int*)(ptr+nv*sizeof(MMG5_int)) = val;
+      src += sw;
+    }
+    ptr += dsiz;
+  }
+  return(1);
+}
+
+/**
+ * \param inm pointer toward the binary file (opened in "rb" mode).
+ * \param bf pointer toward the binary file structure to fill.
+ * \return 1 if success, 0 if fail.
+ *
+ * Map a binary medit file in memory, read its header and locate the data of
+ * each keyword in only one pass over the keyword list.
+ *
+ */
+int _MMG5_openBinFile(FILE *inm,_MMG5_pBinFile bf) {
+  size_t   cur,nxt;
+  int      kw,code,psiz,nel;
+  int64_t  lpos;
+
+  memset(bf,0,sizeof(_MMG5_BinFile));
+
+  if ( !_MMG5_mapBinFile(inm,bf) ) {
+    fprintf(stderr,"  ** UNABLE TO READ THE BINARY FILE.\n");
+    return(0);
+  }
+
+  if ( bf->siz < 2*sw ) {
+    fprintf(stderr,"  ** BAD FILE ENCODING\n");
+    _MMG5_closeBinFile(bf);
+    return(0);
+  }
+
+  memcpy(&code,bf->buf,sw);
+  if ( code == 16777216 )
+    bf->iswp = 1;
+  else if ( code != 1 ) {
+    fprintf(stderr,"  ** BAD FILE ENCODING\n");
+    _MMG5_closeBinFile(bf);
+    return(0);
+  }
+  bf->ver = _MMG5_binInt(bf,sw);
+  if ( bf->ver < 1 || bf->ver > 3 ) {
+    fprintf(stderr,"  ** UNSUPPORTED BINARY FILE VERSION: %d\n",bf->ver);
+    _MMG5_closeBinFile(bf);
+    return(0);
+  }
+
+  /* Since version 3, the positions of the keywords are stored on 64 bits */
+  psiz = ( bf->ver < 3 ) ? sw : sd;
+
+  cur = 2*sw;
+  while ( cur + sw + psiz <= bf->siz ) {
+    kw = _MMG5_binInt(bf,cur);
+    if ( kw == 54 ) break; //End
+
+    if ( psiz == sw )
+      nxt = (size_t)_MMG5_binInt(bf,cur+sw);
+    else {
+      memcpy(&lpos,bf->buf+cur+sw,sd);
+      if ( bf->iswp ) _MMG5_swapWords(&lpos,sd,sd);
+      nxt = (size_t)lpos;
+    }
+
+    if ( kw > 0 && kw < _MMG5_BINKWD && !bf->pos[kw] ) {
+      nel = _MMG5_binInt(bf,cur+sw+psiz);
+      if ( nel > 0 ) {
+        bf->nel[kw] = nel;
+        bf->pos[kw] = cur + sw + psiz + sw;
       }
     }
+
+    if ( nxt <= cur ) break;
+    cur = nxt;
   }
-  return 1;
+
+  return(1);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param bf pointer toward the binary file structure.
+ * \param dim dimension of the vertices coordinates in the file.
+ * \return 1 if success, 0 if fail.
+ *
+ * Copy the coordinates and the references of the \a mesh->np first vertices of
+ * a binary file mapped in memory into the \a mesh->point array.
+ *
+ */
+int _MMG5_binReadPoints(MMG5_pMesh mesh,_MMG5_pBinFile bf,int dim) {
+  MMG5_pPoint ppt;
+  float       fc[3];
+  size_t      csiz;
+  int         i;
+  MMG5_int    k;
+
+  csiz = ( bf->ver < 2 ) ? sw : sd;
+
+  if ( !_MMG5_binCopy(bf,bf->pos[4],mesh->np,dim*csiz+sw,dim*csiz,(int)csiz,
+                      mesh->point[1].c,sizeof(MMG5_Point)) )
+    return(0);
+  if ( !_MMG5_binCopy(bf,bf->pos[4]+dim*csiz,mesh->np,dim*csiz+sw,sw,sw,
+                      &mesh->point[1].ref,sizeof(MMG5_Point)) )
+    return(0);
+
+  if ( bf->ver < 2 ) {
+    /* simple precision coordinates are stored at the beginning of c */
+    for ( k=1; k<=mesh->np; ++k ) {
+      ppt = &mesh->point[k];
+      memcpy(fc,ppt->c,dim*sw);
+      for ( i=0; i<dim; ++i )  ppt->c[i] = (double)fc[i];
+    }
+  }
+  return(1);
+}
+
+/**
+ * \param bf pointer toward the binary file structure.
+ * \param ng number of normals to read.
+ * \param norm array of size 3*ng+1 to fill with the normals (from index 1).
+ * \return 1 if success, 0 if fail.
+ *
+ * Copy the normals of a binary file mapped in memory into \a norm.
+ *
+ */
+int _MMG5_binReadNormals(_MMG5_pBinFile bf,MMG5_int ng,double *norm) {
+  float       fc[3];
+  double      *n;
+  int         k,i;
+
+  if ( bf->ver >= 2 )
+    return(_MMG5_binCopy(bf,bf->pos[60],ng,3*sd,3*sd,sd,&norm[1],3*sd));
+
+  if ( !_MMG5_binCopy(bf,bf->pos[60],ng,3*sw,3*sw,sw,&norm[1],3*sd) )
+    return(0);
+
+  for ( k=1; k<=ng; ++k ) {
+    n = &norm[3*(k-1)+1];
+    memcpy(fc,n,3*sw);
+    for ( i=0; i<3; ++i )  n[i] = (double)fc[i];
+  }
+  return(1);
+}
+
+/** Number of vertices of the elements of each type of block of a gmsh file */
+static const int _MMG5_mshNv[_MMG5_MSHTYP] = {2,3,4,4,6,1};
+
+/**
+ * \param typ gmsh type of element.
+ * \return the index of the block of the elements of type \a typ, -1 if the
+ * type is not supported.
+ *
+ * Blocks of the elements of a gmsh file: 0 for edges, 1 for triangles, 2 for
+ * quadrangles, 3 for tetrahedra, 4 for prisms and 5 for nodes.
+ *
+ */
+static inline
+int _MMG5_mshTypIdx(int typ) {
+  switch ( typ ) {
+  case 1:  return(0); /* Edge */
+  case 2:  return(1); /* Tria */
+  case 3:  return(2); /* Quad */
+  case 4:  return(3); /* Tetra */
+  case 6:  return(4); /* Prism */
+  case 15: return(5); /* Node */
+  }
+  return(-1);
+}
+
+static inline
+int _MMG5_mshSpace(char c) {
+  return ( c==' ' || c=='\n' || c=='\t' || c=='\r' || c=='\v' || c=='\f' );
+}
+
+/**
+ * \param msh pointer toward the gmsh file structure.
+ *
+ * Move the current position of the file after the blank characters.
+ *
+ */
+static inline
+void _MMG5_mshSkipSpaces(_MMG5_pMshFile msh) {
+  while ( msh->cur < msh->bf.siz && _MMG5_mshSpace(msh->bf.buf[msh->cur]) )
+    ++msh->cur;
+}
+
+/**
+ * \param msh pointer toward the gmsh file structure.
+ *
+ * Move the current position of the file after the end of the current line
+ * (and only this one: binary data may follow).
+ *
+ */
+static inline
+void _MMG5_mshEndLine(_MMG5_pMshFile msh) {
+  char c;
+
+  while ( msh->cur < msh->bf.siz ) {
+    c = msh->bf.buf[msh->cur];
+    if ( c!=' ' && c!='\t' && c!='\r' ) break;
+    ++msh->cur;
+  }
+  if ( msh->cur < msh->bf.siz && msh->bf.buf[msh->cur]=='\n' ) ++msh->cur;
+}
+
+/**
+ * \param msh pointer toward the gmsh file structure.
+ *
+ * Move the current position of the file at the beginning of the next line.
+ *
+ */
+static inline
+void _MMG5_mshSkipLine(_MMG5_pMshFile msh) {
+  const char *p;
+
+  if ( msh->cur >= msh->bf.siz ) return;
+
+  p = memchr(msh->bf.buf+msh->cur,'\n',msh->bf.siz-msh->cur);
+  msh->cur = p ? (size_t)(p-msh->bf.buf)+1 : msh->bf.siz;
+}
+
+/**
+ * \param msh pointer toward the gmsh file structure.
+ *
+ * Move the current position of an ascii file to the next keyword (the numbers
+ * of the data fields never contain a '$').
+ *
+ */
+static inline
+void _MMG5_mshNextKeyword(_MMG5_pMshFile msh) {
+  const char *p;
+
+  if ( msh->cur >= msh->bf.siz ) return;
+
+  p = memchr(msh->bf.buf+msh->cur,'$',msh->bf.siz-msh->cur);
+  msh->cur = p ? (size_t)(p-msh->bf.buf) : msh->bf.siz;
+}
+
+/**
+ * \param msh pointer toward the gmsh file structure.
+ * \param tok buffer to fill with the word.
+ * \param len size of \a tok.
+ * \return 1 if success, 0 at the end of the file.
+ *
+ * Read the next word of the file (truncated to \a len-1 characters).
+ *
+ */
+static
+int _MMG5_mshToken(_MMG5_pMshFile msh,char *tok,int len) {
+  int n;
+
+  _MMG5_mshSkipSpaces(msh);
+  if ( msh->cur >= msh->bf.siz ) return(0);
+
+  n = 0;
+  while ( msh->cur < msh->bf.siz && !_MMG5_mshSpace(msh->bf.buf[msh->cur]) ) {
+    if ( n < len-1 ) tok[n++] = msh->bf.buf[msh->cur];
+    ++msh->cur;
+  }
+  tok[n] = '\0';
+
+  return(1);
+}
+
+/**
+ * \param msh pointer toward the gmsh file structure.
+ * \param val pointer toward the integer to fill.
+ * \return 1 if success, 0 if there is no integer at the current position.
+ *
+ * Read an integer written in ascii.
+ *
+ */
+static inline
+int _MMG5_mshAsciiInt(_MMG5_pMshFile msh,MMG5_int *val) {
+  const char *buf;
+  int64_t    v;
+  int        neg;
+
+  _MMG5_mshSkipSpaces(msh);
+
+  buf = msh->bf.buf;
+  neg = 0;
+  if ( msh->cur < msh->bf.siz && (buf[msh->cur]=='-' || buf[msh->cur]=='+') ) {
+    neg = ( buf[msh->cur]=='-' );
+    ++msh->cur;
+  }
+  if ( msh->cur >= msh->bf.siz || buf[msh->cur] < '0' || buf[msh->cur] > '9' )
+    return(0);
+
+  v = 0;
+  while ( msh->cur < msh->bf.siz && buf[msh->cur] >= '0' && buf[msh->cur] <= '9' ) {
+    v = 10*v + (buf[msh->cur]-'0');
+    ++msh->cur;
+  }
+  *val = (MMG5_int)( neg ? -v : v );
+
+  return(1);
+}
+
+/**
+ * \param msh pointer toward the gmsh file structure.
+ * \param val pointer toward the integer to fill.
+ * \return 1 if success, 0 if there is no integer at the current position.
+ *
+ * Read an integer of the data fields (written in ascii or on 32 bits in binary
+ * files).
+ *
+ */
+static inline
+int _MMG5_mshInt(_MMG5_pMshFile msh,MMG5_int *val) {
+  int v;
+
+  if ( !msh->bin ) return(_MMG5_mshAsciiInt(msh,val));
+
+  if ( msh->cur + sw > msh->bf.siz ) return(0);
+
+  memcpy(&v,msh->bf.buf+msh->cur,sw);
+  if ( msh->bf.iswp ) _MMG5_swapWords(&v,sw,sw);
+  msh->cur += sw;
+  *val = v;
+
+  return(1);
+}
+
+/**
+ * \param msh pointer toward the gmsh file structure.
+ * \param ver 1 for simple precision data, 2 for double precision.
+ * \param val pointer toward the real to fill.
+ * \return 1 if success, 0 if there is no real at the current position.
+ *
+ * Read a real of the data fields.
+ *
+ */
+static inline
+int _MMG5_mshReal(_MMG5_pMshFile msh,int ver,double *val) {
+  float  fc;
+  char   tok[64],*end;
+
+  if ( msh->bin ) {
+    if ( ver < 2 ) {
+      if ( msh->cur + sw > msh->bf.siz ) return(0);
+      memcpy(&fc,msh->bf.buf+msh->cur,sw);
+      if ( msh->bf.iswp ) _MMG5_swapWords(&fc,sw,sw);
+      msh->cur += sw;
+      *val = (double)fc;
+    }
+    else {
+      if ( msh->cur + sd > msh->bf.siz ) return(0);
+      memcpy(val,msh->bf.buf+msh->cur,sd);
+      if ( msh->bf.iswp ) _MMG5_swapWords(val,sd,sd);
+      msh->cur += sd;
+    }
+    return(1);
+  }
+
+  if ( !_MMG5_mshToken(msh,tok,64) ) return(0);
+
+  if ( ver < 2 ) {
+    fc   = strtof(tok,&end);
+    *val = (double)fc;
+  }
+  else
+    *val = strtod(tok,&end);
+
+  return( end != tok );
+}
+
+/**
+ * \param msh pointer toward the gmsh file structure.
+ * \param t index of the block of elements.
+ * \param num number of elements to add to the block.
+ * \return 1 if success, 0 if fail.
+ *
+ * Make room for \a num elements at the end of the block \a t.
+ *
+ */
+static
+int _MMG5_mshEltAlloc(_MMG5_pMshFile msh,int t,MMG5_int num) {
+  MMG5_int siz;
+
+  if ( msh->nelt[t] + num <= msh->eltmax[t] ) return(1);
+
+  siz = MG_MAX(2*msh->eltmax[t],msh->nelt[t]+MG_MAX(num,1024));
+  _MMG5_SAFE_REALLOC(msh->elt[t],(size_t)siz*(_MMG5_mshNv[t]+1),MMG5_int,
+                     "elements",0);
+  msh->eltmax[t] = siz;
+
+  return(1);
+}
+
+/**
+ * \param msh pointer toward the gmsh file structure.
+ *
+ * Release the file content and the blocks of elements.
+ *
+ */
+void _MMG5_freeMshFile(_MMG5_pMshFile msh) {
+  int t;
+
+  _MMG5_closeBinFile(&msh->bf);
+  for ( t=0; t<_MMG5_MSHTYP; ++t ) {
+    _MMG5_SAFE_FREE(msh->elt[t]);
+    msh->nelt[t] = msh->eltmax[t] = 0;
+  }
+  _MMG5_SAFE_FREE(msh->posNodeData);
+}
+
+/**
+ * \param msh pointer toward the gmsh file structure.
+ * \param name buffer of size 128 to fill with the solution name (may be NULL).
+ * \param typ pointer toward the type of data (1: scalar, 3: vector, 9: tensor).
+ * \param np pointer toward the number of values.
+ * \return 1 if success, 0 if fail.
+ *
+ * Read the tags of a \a $NodeData field (the current position of the file
+ * being just after the keyword) and move to the first value.
+ *
+ */
+static
+int _MMG5_mshNodeDataTags(_MMG5_pMshFile msh,char *name,int *typ,MMG5_int *np) {
+  MMG5_int    tagNum,val;
+  char        chaine[128];
+  int         k;
+
+  /* String tags: The first one stores the solution name */
+  if ( !_MMG5_mshAsciiInt(msh,&tagNum) ) return(0);
+  _MMG5_mshEndLine(msh);
+
+  if ( name )  name[0] = '\0';
+  for ( k=0; k<tagNum; ++k ) {
+    if ( !k ) {
+      if ( !_MMG5_mshToken(msh,chaine,128) ) return(0);
+      if ( name ) strcpy(name,chaine);
+    }
+    _MMG5_mshSkipLine(msh);
+  }
+
+  /* Real tags ignored */
+  if ( !_MMG5_mshAsciiInt(msh,&tagNum) ) return(0);
+  _MMG5_mshEndLine(msh);
+  for ( k=0; k<tagNum; ++k ) {
+    _MMG5_mshSkipLine(msh);
+  }
+
+  /* Integer tags : allow to recover the number of sols and their types */
+  if ( !_MMG5_mshAsciiInt(msh,&tagNum) ) return(0);
+  if ( tagNum < 3 ) {
+    fprintf(stderr,"   Error: %s: node data: Expected at least 3 tags (%" MMG5_PRId " given).\n",
+            __func__,tagNum);
+    return(0);
+  }
+
+  if ( !_MMG5_mshAsciiInt(msh,&val) ) return(0); //time step;
+  if ( !_MMG5_mshAsciiInt(msh,&val) ) return(0); //type of solution: 1=scalar, 3=vector, 9=tensor ;
+  *typ = (int)val;
+  if ( !_MMG5_mshAsciiInt(msh,np) ) return(0);
+
+  for ( k=3; k<tagNum; ++k ) {
+    if ( !_MMG5_mshAsciiInt(msh,&val) ) return(0);
+  }
+  if ( msh->bin ) _MMG5_mshEndLine(msh);
+
+  return(1);
 }
 
 /**
  * \param mesh pointer toward the mesh
  * \param filename pointer toward the name of file
- * \param inm pointer toward the file pointer
- * \param posNodes pointer toward the position of nodes data in file
- * \param posElts pointer toward the position of elts data in file
- * \param posNodeData pointer toward the list of the positions of data in file
- * \param bin 1 if binary format
- * \param nelts number of elements in file
- * \param nsol number of data in file
+ * \param msh pointer toward the gmsh file structure to fill
  * \return 1 if success, 0 if file is not found, -1 if fail.
  *
- * Begin to read mesh at MSH file format. Read the mesh size informations.
+ * Begin to read mesh at MSH file format. The file is mapped in memory and read
+ * in only one pass: the elements are stored in temporary blocks (one by type
+ * of element) and the positions of the nodes and of the solutions are
+ * saved. Fill the mesh size informations.
  *
  */
 int MMG5_loadMshMesh_part1(MMG5_pMesh mesh,const char *filename,
-                           FILE **inm,
-                           long *posNodes, long *posElts,
-                           long **posNodeData, int *bin, int *iswp,
-                           int *nelts,int *nsols) {
-  double      dbuf[9];
-  float       fbuf[9];
-  int         ver,oneBin,k,i;
-  int         nt,na,nq,ne,npr,np;
-  int         typ,tagNum,posNodeDataSize,initPosNodeDataSize;
+                           _MMG5_pMshFile msh) {
+  FILE        *inm;
+  MMG5_int    *v,k,num,val,tagNum,nelts,np;
+  size_t      rsiz,dsiz;
+  int         ver,oneBin,i,l,t,nv,typ,ref,posNodeDataSize,initPosNodeDataSize;
   char        *ptr,*data,chaine[128],verNum[5];
+  static _MMG5_TLS char mmgWarn = 0;
 
-  ver = oneBin = 0;
-  *posNodes = 0;
-  *posElts = 0;
-  *nelts = 0;
-  *nsols = 0;
-  *bin = 0;
-  *iswp = 0;
+  memset(msh,0,sizeof(_MMG5_MshFile));
+  ver = 0;
   mesh->np = mesh->nt = mesh->ne = 0;
-  nt = na = nq = ne = npr = np = 0;
-
-  _MMG5_SAFE_CALLOC(data,strlen(filename)+7,char,0);
 
   /* Allocation of the posNodeData array: we assume that we have less than 20
    * solutions in the file (for a greater number of sol, posNoteData is
    * reallocated) */
   initPosNodeDataSize = posNodeDataSize = 20;
-  _MMG5_SAFE_CALLOC(*posNodeData,posNodeDataSize,long,0);
+  _MMG5_SAFE_CALLOC(msh->posNodeData,posNodeDataSize,size_t,0);
+
+  _MMG5_SAFE_CALLOC(data,strlen(filename)+7,char,0);
 
   strcpy(data,filename);
   ptr = strstr(data,".msh");
   if ( !ptr ) {
     /* data contains the filename without extension */
     strcat(data,".mshb");
-    if (!(*inm = fopen(data,"rb")) ) {
+    if (!(inm = fopen(data,"rb")) ) {
       ptr  = strstr(data,".msh");
       *ptr = '\0';
       strcat(data,".msh");
-      if( !((*inm) = fopen(data,"rb")) ) {
+      if( !(inm = fopen(data,"rb")) ) {
         fprintf(stderr,"  ** %s  NOT FOUND.\n",data);
         _MMG5_SAFE_FREE(data);
-        _MMG5_SAFE_FREE(*posNodeData);
+        _MMG5_SAFE_FREE(msh->posNodeData);
         return(0);
       }
     }
   }
   else {
-    if( !((*inm) = fopen(data,"rb")) ) {
+    if( !(inm = fopen(data,"rb")) ) {
       fprintf(stderr,"  ** %s  NOT FOUND.\n",data);
       _MMG5_SAFE_FREE(data);
-      _MMG5_SAFE_FREE(*posNodeData);
+      _MMG5_SAFE_FREE(msh->posNodeData);
       return(0);
     }
   }
 
   if ( mesh->info.imprim >= 0 )
     fprintf(stdout,"  %%%% %s OPENED\n",data);
-  _MMG5_SAFE_FREE(data);
 
+  /* The mapping remains valid once the file is closed */
+  if ( !_MMG5_mapBinFile(inm,&msh->bf) ) {
+    fprintf(stderr,"  ** UNABLE TO READ %s.\n",data);
+    _MMG5_SAFE_FREE(data);
+    _MMG5_SAFE_FREE(msh->posNodeData);
+    fclose(inm);
+    return(-1);
+  }
+  _MMG5_SAFE_FREE(data);
+  fclose(inm);
 
   /* Detection of the different fields of the file */
-  strcpy(chaine,"D");
-  while(fscanf((*inm),"%127s ",&chaine[0])!=EOF ) {
-    if(!strncmp(chaine,"$MeshFormat",strlen("$MeshFormat"))) {
-      fscanf((*inm),"%4s %d %d ",verNum,bin,&ver);
+  while ( _MMG5_mshToken(msh,chaine,128) ) {
+    if ( !strcmp(chaine,"$MeshFormat") ) {
+      if ( !_MMG5_mshToken(msh,verNum,5) || !_MMG5_mshAsciiInt(msh,&val) )
+        goto truncated;
+      msh->bin = (int)val;
+      if ( !_MMG5_mshAsciiInt(msh,&val) ) goto truncated;
+      ver = (int)val;
       mesh->ver = ver/4;
       if ( strncmp(verNum,"2.2",3) ) {
         fprintf(stderr,"\n  ## Warning: %s: format version (%s) may be not supported."
                 " Please, use the format version 2.2.\n",__func__,verNum);
       }
-      if ( *bin ) {
-        fread(&oneBin,sw,1,(*inm));
+      if ( msh->bin ) {
+        _MMG5_mshEndLine(msh);
+        if ( msh->cur + sw > msh->bf.siz ) goto truncated;
+        memcpy(&oneBin,msh->bf.buf+msh->cur,sw);
+        msh->cur += sw;
         if ( oneBin!=1 ) {
           assert(oneBin==16777216);
-          *iswp=1;
-          oneBin = _MMG5_swapbin(oneBin);
+          msh->bf.iswp=1;
         }
       }
-      continue;
-    } else if(!strncmp(chaine,"$EndMeshFormat",strlen("EndMeshFormat"))) {
-      continue;
-    } else if(!strncmp(chaine,"$Nodes",strlen("$Nodes"))) {
-      fscanf((*inm),"%d ",&mesh->npi);
-      *posNodes = ftell((*inm));
-      if ( *bin ) {
-        /* Skip the binary nodes data */
-        if ( mesh->ver==1 ) {
-          for ( k=1; k<=mesh->npi; ++k ) {
-            fread(&i,sw,1,(*inm));
-            fread( &fbuf[0],sw,3,(*inm) );
-          }
-        }
-        else {
-          for ( k=1; k<=mesh->npi; ++k ) {
-            fread(&i,sw,1,(*inm));
-            fread( &dbuf[0],sd,3,(*inm) );
-          }
-        }
-      }
-      continue;
-    } else if(!strncmp(chaine,"$EndNodes",strlen("$EndNodes"))) {
-      continue;
-    } else if(!strncmp(chaine,"$NodeData",strlen("$NodeData"))) {
-
-      (*posNodeData)[*nsols] = ftell((*inm));
-      if ( ++(*nsols) == posNodeDataSize ) {
-        _MMG5_SAFE_RECALLOC(*posNodeData,*nsols,
-                            posNodeDataSize+initPosNodeDataSize,
-                            long,"posNodeData",0);
-        posNodeDataSize += initPosNodeDataSize;
-      }
-
-      if ( *bin ) {
-        /* Skip the binary nodes data */
-        /* String tags */
-        fscanf((*inm),"%d ",&tagNum);
-        for ( k=0; k<tagNum; ++k ) {
-          fscanf((*inm),"%*[^\n]%*c");
-        }
-
-        /* Real tags */
-        fscanf((*inm),"%d ",&tagNum);
-        for ( k=0; k<tagNum; ++k ) {
-          fscanf((*inm),"%*[^\n]%*c");
-        }
-
-        /* Integer tags */
-        fscanf((*inm),"%d ",&tagNum);
-        fscanf((*inm),"%d ",&i); //time step
-        fscanf((*inm),"%d ",&typ); //type of solution
-        fscanf((*inm),"%d ",&np);
-        for ( k=3; k<tagNum; ++k ) {
-          fscanf((*inm),"%d",&i);
-        }
-        if ( mesh->ver==1 ) {
-          for ( k=1; k<=np; ++k ) {
-            fread(&i,sw,1,(*inm));
-            fread( &fbuf[0],sw,typ,(*inm) );
-          }
-        }
-        else {
-          for ( k=1; k<=np; ++k ) {
-            fread(&i,sw,1,(*inm));
-            fread( &dbuf[0],sd,typ,(*inm) );
-          }
-        }
-      }
-      continue;
-    } else if(!strncmp(chaine,"$EndNodeData",strlen("$EndNodeData"))) {
-      continue;
-    } else if(!strncmp(chaine,"$Elements",strlen("$Elements"))) {
-      fscanf((*inm),"%d ",nelts);
-      *posElts = ftell((*inm));
-
-      /* Count the elements */
-      if ( !*bin ) {
-        for ( k=0; k<*nelts; ++k) {
-          fscanf((*inm),"%d %d ",&i,&typ);
-          switch (typ) {
-          case 1:
-            /* Edge */
-            ++na;
-            break;
-          case 2:
-            /* Tria */
-            ++nt;
-            break;
-          case 3:
-            /* Quad */
-            ++nq;
-            break;
-          case 4:
-            /* Tetra */
-            ++ne;
-            break;
-          case 6:
-            /* Prism */
-            ++npr;
-            break;
-          case 15:
-            /* Node */
-            ++np;
-            break;
-          }
-          fscanf((*inm),"%*[^\n]%*c");
-        }
-      }
-      else {
-        if ( !_MMG5_countBinaryElts(inm,*nelts,*iswp,&np,&na,&nt,&nq,&ne,&npr) ) {
-          fclose(*inm);
-          _MMG5_SAFE_FREE(*posNodeData);
-          return -1;
-        }
-      }
-      continue;
     }
-    else if(!strncmp(chaine,"$EndElements",strlen("$EndElements"))) {
-      continue;
-    }
-  }
-
-  if ( !mesh->npi ) {
-    fprintf(stderr,"  ** MISSING DATA.\n");
-    fprintf(stderr,"     Check that your mesh contains points and elements.\n");
-    fprintf(stderr,"     Exit program.\n");
-    fclose(*inm);
-    _MMG5_SAFE_FREE(*posNodeData);
-    return(-1);
-  }
-
-  /* memory allocation */
-  mesh->np = mesh->npi;
-  mesh->nt = mesh->nti = nt;
-  mesh->ne = mesh->nei = ne;
-  mesh->na = mesh->nai = na;
-  mesh->nprism = npr;
-  mesh->nquad = nq;
-
-  if ( !mesh->np ) {
-    fprintf(stderr,"  ** MISSING DATA.\n");
-    fprintf(stderr,"     Check that your mesh contains points.\n");
-    fprintf(stderr,"     Exit program.\n");
-    fclose(*inm);
-    _MMG5_SAFE_FREE(*posNodeData);
-    return(-1);
-  }
-  mesh->nsols = *nsols;
-  return 1;
-}
-
-
-/**
- * \param mesh pointer toward the mesh
- * \param sol pointer toward the solutions array
- * \param inm pointer toward the file pointer
- * \param posNodes position of nodes data in file
- * \param posElts position of elts data in file
- * \param posNodeData position of solution data in file
- * \param bin 1 if binary format
- * \param nelts number of elements in file
- * \return 1 if success, 0 if fail.
- *
- * End to read mesh and solution array at MSH file format after the
- * mesh/solution array alloc.
- *
- */
-int MMG5_loadMshMesh_part2(MMG5_pMesh mesh,MMG5_pSol *sol,FILE **inm,
-                           const long posNodes,const long posElts,
-                           const long *posNodeData,const int bin,const int iswp,
-                           const int nelts) {
-  MMG5_pTetra pt;
-  MMG5_pPrism pp;
-  MMG5_pTria  ptt;
-  MMG5_pQuad  pq1;
-  MMG5_pEdge  pa;
-  MMG5_pPoint ppt;
-  MMG5_pSol   psl;
-  double      aux, dbuf[9];
-  float       fbuf[9],fc;
-  int         k,i,l,nref,iadr;
-  int         *ina_t,*ina_a,nt,na,nq,ne,npr;
-  int         nbl_t,nbl_a,typ,tagNum,ref,idx,num;
-  int         v[4],isol;
-  char        chaine[128];
-  static char mmgWarn=0, mmgWarn1=0;
-
-  ina_t = ina_a = NULL;
-
-  /** Second step: read the nodes and elements */
-  rewind((*inm));
-  fseek((*inm),posNodes,SEEK_SET);
-
-  if ( mesh->ver < 2 ) {
-    for ( k=0; k< mesh->np; ++k)
-    {
-      if ( !bin ) {
-        fscanf((*inm),"%d ",&idx);
-        ppt = &mesh->point[idx];
-        for (i=0 ; i<mesh->dim ; i++) {
-          fscanf((*inm),"%f ",&fc);
-          ppt->c[i] = (double) fc;
-        }
-      }
-      else {
-        fread(&idx,sw,1,(*inm));
-        if ( iswp ) idx = _MMG5_swapbin(idx);
-        ppt = &mesh->point[idx];
-        for (i=0 ; i<mesh->dim ; i++) {
-          fread(&fc,sw,1,(*inm));
-          if(iswp) fc=_MMG5_swapf(fc);
-          ppt->c[i] = (double) fc;
-        }
-      }
-      ppt->tag  = MG_NUL;
-      ppt->tmp  = 0;
-      ppt->ref = 0;
-    }
-  }
-  else {
-    for ( k=0; k< mesh->np; ++k)
-    {
-      if ( !bin ) {
-        fscanf((*inm),"%d ",&i);
-        ppt = &mesh->point[i];
-        fscanf((*inm),"%lf %lf %lf ",&ppt->c[0],&ppt->c[1],&ppt->c[2]);
+    else if ( !strcmp(chaine,"$Nodes") ) {
+      if ( !_MMG5_mshAsciiInt(msh,&mesh->npi) ) goto truncated;
+      if ( msh->bin ) {
+        /* Skip the binary nodes data */
+        _MMG5_mshEndLine(msh);
+        msh->posNodes = msh->cur;
+        dsiz = ( mesh->ver==1 ) ? sw : sd;
+        msh->cur += (size_t)mesh->npi*(sw+3*dsiz);
+        if ( msh->cur > msh->bf.siz ) goto truncated;
       }
       else {
-        fread(&i,sw,1,(*inm));
-        if ( iswp ) i = _MMG5_swapbin(i);
-        ppt = &mesh->point[i];
-        for (i=0 ; i<3 ; i++) {
-          fread(&ppt->c[i],sd,1,(*inm));
-          if(iswp) ppt->c[i]=_MMG5_swapd(ppt->c[i]);
-        }
+        msh->posNodes = msh->cur;
+        _MMG5_mshNextKeyword(msh);
       }
-      ppt->tag  = MG_NUL;
-      ppt->tmp  = 0;
-      ppt->ref = 0;
     }
-  }
-
-  rewind((*inm));
-  fseek((*inm),posElts,SEEK_SET);
-
-  nbl_a = nbl_t = nt = na = nq = ne = npr = 0;
-  nref = 0;
-
-  /* Skip triangles and edges with MG_ISO refs */
-  if( mesh->info.iso ) {
-    if ( mesh->nt ) {
-      _MMG5_SAFE_CALLOC(ina_t,mesh->nt+1,int,0);
-    }
-    if ( mesh->na ) {
-      _MMG5_SAFE_CALLOC(ina_a,mesh->na+1,int,0);
-    }
-  }
-
-  if ( !bin ) {
-    for ( k=0; k<nelts; ++k)
-    {
-      fscanf((*inm),"%d %d %d ",&i,&typ, &tagNum);
-      if ( tagNum < 2 ) {
-        fprintf(stderr,"\n  ## Error: %s: elt %d (type %d): Expected at least 2 tags (%d given).\n",
-                __func__,k,typ,tagNum);
-        if ( ina_t ) _MMG5_SAFE_FREE(ina_t);
-        if ( ina_a ) _MMG5_SAFE_FREE(ina_a);
-        fclose(*inm);
-        return(-1);
-      }
-      fscanf((*inm),"%d %d ",&ref,&i);
-      for ( l=2; l<tagNum; ++l ) {
-        fscanf((*inm),"%d ",&i);
+    else if ( !strcmp(chaine,"$NodeData") ) {
+      msh->posNodeData[msh->nsols] = msh->cur;
+      if ( ++msh->nsols == posNodeDataSize ) {
+        _MMG5_SAFE_RECALLOC(msh->posNodeData,msh->nsols,
+                            posNodeDataSize+initPosNodeDataSize,
+                            size_t,"posNodeData",-1);
+        posNodeDataSize += initPosNodeDataSize;
       }
 
-      switch (typ) {
-      case 1:
-        /* Edge */
-        /* Skip edges with MG_ISO refs */
-        if ( !mesh->info.iso ) {
-          pa = &mesh->edge[++na];
-          fscanf((*inm),"%d %d ",&pa->a,&pa->b);
-          pa->ref = abs(ref);
-          pa->tag |= MG_REF;
-        }
-        else {
-          if ( abs(ref)!= MG_ISO ) {
-            pa = &mesh->edge[++na];
-            fscanf((*inm),"%d %d ",&pa->a,&pa->b);
-            pa->ref = abs(ref);
-            pa->tag |= MG_REF;
-            ina_a[na+nbl_a]=na;
-          }
-          else {
-            /* Skip this edge but advance the file pointer */
-            pa = &mesh->edge[0];
-            fscanf((*inm),"%d %d ",&pa->a,&pa->b);
-            ++nbl_a;
-          }
-        }
-        assert( na+nbl_a<=mesh->na );
-        break;
-      case 2:
-        /* Tria */
-        /* Skip triangles with MG_ISO refs */
-        if ( !mesh->info.iso ) {
-          ptt = &mesh->tria[++nt];
-          fscanf((*inm),"%d %d %d ",&ptt->v[0],&ptt->v[1],&ptt->v[2]);
-          ptt->ref = abs(ref);
-        }
-        else {
-          if ( abs(ref)!= MG_ISO ) {
-            ptt = &mesh->tria[++nt];
-            fscanf((*inm),"%d %d %d",&ptt->v[0],&ptt->v[1],&ptt->v[2]);
-            ptt->ref = abs(ref);
-            ina_t[nt+nbl_t]=nt;
-          }
-          else {
-            /* Skip this triangle but advance the file pointer */
-            ptt = &mesh->tria[0];
-            fscanf((*inm),"%d %d %d",&ptt->v[0],&ptt->v[1],&ptt->v[2]);
-            ++nbl_t;
-          }
-        }
-        assert( nt+nbl_t<=mesh->nt );
-        break;
-      case 3:
-        /* Quad */
-        pq1 = &mesh->quadra[++nq];
-        fscanf((*inm),"%d %d %d %d ",&pq1->v[0],&pq1->v[1],&pq1->v[2],&pq1->v[3]);
-        pq1->ref = ref;
-        assert( nq<=mesh->nquad );
-        break;
-      case 4:
-        /* Tetra for mmg3d */
-        if ( mesh->ne ) {
-          pt = &mesh->tetra[++ne];
-          fscanf((*inm),"%d %d %d %d ",&pt->v[0],&pt->v[1],&pt->v[2],&pt->v[3]);
-          pt->ref = abs(ref);
-        } else { /*skip tetra*/
-          fscanf((*inm),"%d %d %d %d ",&v[0],&v[1],&v[2],&v[3]);
-        }
-
-        if(ref < 0) {
-          nref++;
-        }
-
-        assert( ne<=mesh->ne );
-        break;
-      case 6:
-        /* Prism for mmg3d */
-        if ( mesh->nprism )
-        {
-          pp = &mesh->prism[++npr];
-          fscanf((*inm),"%d %d %d %d %d %d ",&pp->v[0],&pp->v[1],&pp->v[2],
-                 &pp->v[3],&pp->v[4],&pp->v[5]);
-          pp->ref = abs(ref);
-        }
-        if(ref < 0) {
-          nref++;
-        }
-        assert( npr<=mesh->nprism );
-        break;
-      case 15:
-        /* Node */
-        fscanf((*inm),"%d ",&l);
-        ppt = &mesh->point[l];
-        ppt->ref = ref;
-        assert( l<=mesh->np );
-        break;
-      default:
-        if ( !mmgWarn ) {
-          fprintf(stderr,"\n  ## Warning: %s: unexpected type for at least 1 element:"
-                  " element %d, type %d\n",__func__,k,typ );
-          mmgWarn = 1;
-        }
+      if ( msh->bin ) {
+        /* Skip the binary nodes data */
+        if ( !_MMG5_mshNodeDataTags(msh,NULL,&typ,&np) ) goto truncated;
+        dsiz = ( mesh->ver==1 ) ? sw : sd;
+        msh->cur += (size_t)np*(sw+typ*dsiz);
+        if ( msh->cur > msh->bf.siz ) goto truncated;
       }
-    }
-  }
-  else {
-    k = 0;
-
-    while ( k<nelts ) {
-      fread(&typ,sw,1,(*inm));
-      if(iswp) typ = _MMG5_swapbin(typ);
-
-      switch (typ) {
-      case 1:
-        /* Edge */
-        fread(&num,sw,1,(*inm));
-        fread(&tagNum,sw,1,(*inm));
-        if(iswp) {
-          num = _MMG5_swapbin(num);
-          tagNum = _MMG5_swapbin(tagNum);
-        }
-        if ( tagNum < 2 ) {
-          fprintf(stderr,"\n  ## Error: %s: Expected at least 2 tags per element (%d given).\n",
-                  __func__,tagNum);
-          if ( ina_t ) _MMG5_SAFE_FREE(ina_t);
-          if ( ina_a ) _MMG5_SAFE_FREE(ina_a);
-          fclose(*inm);
-          return(-1);
-        }
-
-        for ( idx=0; idx<num; ++idx ) {
-          fread(&i,sw,1,(*inm));
-
-          fread(&ref,sw,1,(*inm));
-          fread(&i,sw,1,(*inm));
-
-          for ( l=2; l<tagNum; ++l ) {
-            fread(&i,sw,1,(*inm));
-          }
-
-          if(iswp) ref = _MMG5_swapbin(ref);
-
-          /* Skip edges with MG_ISO refs */
-          if ( !mesh->info.iso ) {
-            pa = &mesh->edge[++na];
-            fread(&pa->a,sw,1,(*inm));
-            fread(&pa->b,sw,1,(*inm));
-            if ( iswp ) {
-              pa->a = _MMG5_swapbin(pa->a);
-              pa->b = _MMG5_swapbin(pa->b);
-            }
-            pa->ref = abs(ref);
-            pa->tag |= MG_REF;
-          }
-          else {
-            if( abs(ref)!= MG_ISO ) {
-              pa = &mesh->edge[++na];
-              fread(&pa->a,sw,1,(*inm));
-              fread(&pa->b,sw,1,(*inm));
-              if ( iswp ) {
-                pa->a = _MMG5_swapbin(pa->a);
-                pa->b = _MMG5_swapbin(pa->b);
-              }
-              pa->ref = abs(ref);
-              pa->tag |= MG_REF;
-              ina_a[na+nbl_a]=na;
-            }
-            else {
-              /* Skip this edge but advance the file pointer */
-              pa = &mesh->edge[0];
-              fread(&pa->a,sw,1,(*inm));
-              fread(&pa->b,sw,1,(*inm));
-              ++nbl_a;
-            }
-          }
-          assert( na+nbl_a<=mesh->na );
-        }
-        k += num;
-
-        break;
-      case 2:
-        /* Tria */
-        fread(&num,sw,1,(*inm));
-        fread(&tagNum,sw,1,(*inm));
-        if(iswp) {
-          num = _MMG5_swapbin(num);
-          tagNum = _MMG5_swapbin(tagNum);
-        }
-        if ( tagNum < 2 ) {
-          fprintf(stderr,"\n  ## Error: %s: Expected at least 2 tags per element (%d given).\n",
-                  __func__,tagNum);
-          if ( ina_t ) _MMG5_SAFE_FREE(ina_t);
-          if ( ina_a ) _MMG5_SAFE_FREE(ina_a);
-          fclose(*inm);
-          return(-1);
-        }
-
-        for ( idx=0; idx<num; ++idx ) {
-          fread(&i,sw,1,(*inm));
-
-          fread(&ref,sw,1,(*inm));
-          fread(&i,sw,1,(*inm));
-
-          for ( l=2; l<tagNum; ++l ) {
-            fread(&i,sw,1,(*inm));
-          }
-
-          if(iswp) ref = _MMG5_swapbin(ref);
-
-          /* Skip triangles with MG_ISO refs */
-          if ( !mesh->info.iso ) {
-            ptt = &mesh->tria[++nt];
-            for ( i=0; i<3 ; ++i ) {
-              fread(&l,sw,1,(*inm));
-              if ( iswp ) l = _MMG5_swapbin(l);
-              ptt->v[i] = l;
-            }
-            ptt->ref = abs(ref);
-          }
-          else {
-            if( abs(ref)!= MG_ISO ) {
-              ptt = &mesh->tria[++nt];
-              for ( i=0; i<3 ; ++i ) {
-                fread(&l,sw,1,(*inm));
-                if ( iswp ) l = _MMG5_swapbin(l);
-                ptt->v[i] = l;
-              }
-              ptt->ref = abs(ref);
-              ina_t[nt+nbl_t]=nt;
-            }
-            else {
-              /* Skip this triangle but advance the file pointer */
-              for ( i=0; i<3 ; ++i ) {
-                fread(&l,sw,1,(*inm));
-              }
-              ++nbl_t;
+      else
+        _MMG5_mshNextKeyword(msh);
+    }
+    else if ( !strcmp(chaine,"$Elements") ) {
+      if ( !_MMG5_mshAsciiInt(msh,&nelts) ) goto truncated;
+
+      /* Read the elements and store them in the block of their type */
+      if ( !msh->bin ) {
+        for ( k=0; k<nelts; ++k) {
+          if ( !_MMG5_mshAsciiInt(msh,&val) || !_MMG5_mshAsciiInt(msh,&val) )
+            goto truncated;
+          typ = (int)val;
+          t   = _MMG5_mshTypIdx(typ);
+          if ( t < 0 ) {
+            if ( !mmgWarn ) {
+              fprintf(stderr,"\n  ## Warning: %s: unexpected type for at least 1 element:"
+                      " element %" MMG5_PRId ", type %d\n",__func__,k,typ );
+              mmgWarn = 1;
             }
-          }
-          assert( nt+nbl_t<=mesh->nt );
-        }
-        k += num;
-        break;
-      case 3:
-        /* Quad */
-        fread(&num,sw,1,(*inm));
-        fread(&tagNum,sw,1,(*inm));
-        if(iswp) {
-          num = _MMG5_swapbin(num);
-          tagNum = _MMG5_swapbin(tagNum);
-        }
-       if ( tagNum < 2 ) {
-          fprintf(stderr,"\n  ## Error: %s: Expected at least 2 tags per element (%d given).\n",
-                  __func__,tagNum);
-          if ( ina_t ) _MMG5_SAFE_FREE(ina_t);
-          if ( ina_a ) _MMG5_SAFE_FREE(ina_a);
-          fclose(*inm);
-          return(-1);
-        }
-
-        for ( idx=0; idx<num; ++idx ) {
-          fread(&i,sw,1,(*inm));
-
-          fread(&ref,sw,1,(*inm));
-          fread(&i,sw,1,(*inm));
-
-          for ( l=2; l<tagNum; ++l ) {
-            fread(&i,sw,1,(*inm));
+            _MMG5_mshSkipLine(msh);
+            continue;
           }
 
-          if(iswp) ref = _MMG5_swapbin(ref);
-
-          pq1 = &mesh->quadra[++nq];
-          for ( i=0; i<4 ; ++i ) {
-            fread(&l,sw,1,(*inm));
-            if ( iswp ) l = _MMG5_swapbin(l);
-            pq1->v[i] = l;
+          if ( !_MMG5_mshAsciiInt(msh,&tagNum) ) goto truncated;
+          if ( tagNum < 2 ) {
+            fprintf(stderr,"\n  ## Error: %s: elt %" MMG5_PRId " (type %d): Expected at least 2 tags (%" MMG5_PRId " given).\n",
+                    __func__,k,typ,tagNum);
+            _MMG5_freeMshFile(msh);
+            return(-1);
+          }
+          if ( !_MMG5_mshAsciiInt(msh,&val) ) goto truncated;
+          ref = (int)val;
+          for ( l=1; l<tagNum; ++l ) {
+            if ( !_MMG5_mshAsciiInt(msh,&val) ) goto truncated;
           }
-          pq1->ref = ref;
-          assert( nq<=mesh->nquad );
-        }
-        k += num;
-        break;
-      case 4:
-        /* Tetra */
-        fread(&num,sw,1,(*inm));
-        fread(&tagNum,sw,1,(*inm));
-        if(iswp) {
-          num = _MMG5_swapbin(num);
-          tagNum = _MMG5_swapbin(tagNum);
-        }
 
-        if ( tagNum < 2 ) {
-          fprintf(stderr,"\n  ## Error: %s: Expected at least 2 tags per element (%d given).\n",
-                  __func__,tagNum);
-          if ( ina_t ) _MMG5_SAFE_FREE(ina_t);
-          if ( ina_a ) _MMG5_SAFE_FREE(ina_a);
-          fclose(*inm);
-          return(-1);
+          if ( !_MMG5_mshEltAlloc(msh,t,1) ) {
+            _MMG5_freeMshFile(msh);
+            return(-1);
+          }
+          nv = _MMG5_mshNv[t];
+          v  = &msh->elt[t][(size_t)msh->nelt[t]*(nv+1)];
+          for ( i=0; i<nv; ++i ) {
+            if ( !_MMG5_mshAsciiInt(msh,&v[i]) ) goto truncated;
+          }
+          v[nv] = ref;
+          ++msh->nelt[t];
         }
-
-        for ( idx=0; idx<num; ++idx ) {
-          fread(&i,sw,1,(*inm));
-
-          fread(&ref,sw,1,(*inm));
-          fread(&i,sw,1,(*inm));
-
-          for ( l=2; l<tagNum; ++l ) {
-            fread(&i,sw,1,(*inm));
+      }
+      else {
+        _MMG5_mshEndLine(msh);
+        for ( k=0; k<nelts; k+=num ) {
+          if ( !_MMG5_mshInt(msh,&val) ) goto truncated;
+          typ = (int)val;
+          if ( !_MMG5_mshInt(msh,&num) || !_MMG5_mshInt(msh,&tagNum) )
+            goto truncated;
+
+          t = _MMG5_mshTypIdx(typ);
+          if ( t < 0 ) {
+            fprintf(stderr,"\n  ## Error: %s: unexpected type of element (%d)\n",
+                    __func__,typ);
+            _MMG5_freeMshFile(msh);
+            return(-1);
           }
+          if ( tagNum < 2 ) {
+            fprintf(stderr,"\n  ## Error: %s: Expected at least 2 tags per element (%" MMG5_PRId " given).\n",
+                    __func__,tagNum);
+            _MMG5_freeMshFile(msh);
+            return(-1);
+          }
+          if ( num <= 0 ) goto truncated;
 
-          if(iswp) ref = _MMG5_swapbin(ref);
+          nv   = _MMG5_mshNv[t];
+          rsiz = (size_t)(1+tagNum+nv)*sw;
+          if ( msh->cur + (size_t)num*rsiz > msh->bf.siz ) goto truncated;
 
-          if ( mesh->ne ) {
-            pt = &mesh->tetra[++ne];
-            for ( i=0; i<4 ; ++i ) {
-              fread(&l,sw,1,(*inm));
-              if ( iswp ) l = _MMG5_swapbin(l);
-              pt->v[i] = l;
-            }
-            pt->ref = abs(ref);
-            assert( ne<=mesh->ne );
+          if ( !_MMG5_mshEltAlloc(msh,t,num) ) {
+            _MMG5_freeMshFile(msh);
+            return(-1);
           }
-          else
-            for ( i=0; i<4 ; ++i )
-              fread(&l,sw,1,(*inm));
-
-          if(ref < 0) {
-            nref++;
+          v = &msh->elt[t][(size_t)msh->nelt[t]*(nv+1)];
+          for ( l=0; l<num; ++l ) {
+            /* Element index then first tag (the reference) */
+            msh->cur += sw;
+            _MMG5_mshInt(msh,&v[nv]);
+            msh->cur += (size_t)(tagNum-1)*sw;
+            for ( i=0; i<nv; ++i )
+              _MMG5_mshInt(msh,&v[i]);
+            v += nv+1;
           }
+          msh->nelt[t] += num;
         }
-        k += num;
-        break;
-      case 6:
-        /* Prism */
-        fread(&num,sw,1,(*inm));
-        fread(&tagNum,sw,1,(*inm));
-        if(iswp) {
-          num = _MMG5_swapbin(num);
-          tagNum = _MMG5_swapbin(tagNum);
-        }
-        if ( tagNum < 2 ) {
-          fprintf(stderr,"\n  ## Error: %s: Expected at least 2 tags per element (%d given).\n",
-                  __func__,tagNum);
-          if ( ina_t ) _MMG5_SAFE_FREE(ina_t);
-          if ( ina_a ) _MMG5_SAFE_FREE(ina_a);
-          fclose(*inm);
-          return(-1);
-        }
+      }
+    }
+  }
 
-        for ( idx=0; idx<num; ++idx ) {
-          fread(&i,sw,1,(*inm));
+  if ( !mesh->npi ) {
+    fprintf(stderr,"  ** MISSING DATA.\n");
+    fprintf(stderr,"     Check that your mesh contains points and elements.\n");
+    fprintf(stderr,"     Exit program.\n");
+    _MMG5_freeMshFile(msh);
+    return(-1);
+  }
 
-          fread(&ref,sw,1,(*inm));
-          fread(&i,sw,1,(*inm));
+  /* memory allocation */
+  mesh->np = mesh->npi;
+  mesh->nt = mesh->nti = msh->nelt[1];
+  mesh->ne = mesh->nei = msh->nelt[3];
+  mesh->na = mesh->nai = msh->nelt[0];
+  mesh->nprism = msh->nelt[4];
+  mesh->nquad = msh->nelt[2];
 
-          for ( l=2; l<tagNum; ++l ) {
-            fread(&i,sw,1,(*inm));
-          }
+  if ( !mesh->np ) {
+    fprintf(stderr,"  ** MISSING DATA.\n");
+    fprintf(stderr,"     Check that your mesh contains points.\n");
+    fprintf(stderr,"     Exit program.\n");
+    _MMG5_freeMshFile(msh);
+    return(-1);
+  }
+  mesh->nsols = msh->nsols;
+  return 1;
 
-          if(iswp) ref = _MMG5_swapbin(ref);
+truncated:
+  fprintf(stderr,"\n  ## Error: %s: unexpected end of file or bad data"
+          " (keyword %s).\n",__func__,chaine);
+  _MMG5_freeMshFile(msh);
+  return(-1);
+}
 
-          if ( mesh->nprism ) {
-            pp = &mesh->prism[++npr];
-            for ( i=0; i<6 ; ++i ) {
-              fread(&l,sw,1,(*inm));
-              if ( iswp ) l = _MMG5_swapbin(l);
-              pp->v[i] = l;
-            }
-            pp->ref = abs(ref);
-            assert( npr<=mesh->nprism );
-          }
-          else {
-            for ( i=0; i<6 ; ++i )
-              fread(&l,sw,1,(*inm));
-          }
 
-          if(ref < 0) {
-            nref++;
-          }
-        }
-        k += num;
-        break;
-      case 15:
-        /* Node */
-        fread(&num,sw,1,(*inm));
-        fread(&tagNum,sw,1,(*inm));
-        if(iswp) {
-          num = _MMG5_swapbin(num);
-          tagNum = _MMG5_swapbin(tagNum);
-        }
-        if ( tagNum < 2 ) {
-          fprintf(stderr,"\n  ## Error: %s: Expected at least 2 tags per element (%d given).\n",
-                  __func__,tagNum);
-          if ( ina_t ) _MMG5_SAFE_FREE(ina_t);
-          if ( ina_a ) _MMG5_SAFE_FREE(ina_a);
-          fclose(*inm);
-          return(-1);
-        }
+/**
+ * \param mesh pointer toward the mesh
+ * \param sol pointer toward the solutions array
+ * \param msh pointer toward the gmsh file structure filled by
+ * MMG5_loadMshMesh_part1 (released by this function)
+ * \return 1 if success, 0 if fail.
+ *
+ * End to read mesh and solution array at MSH file format after the
+ * mesh/solution array alloc: the nodes and the solutions are read from the
+ * file mapped in memory and the elements are moved from their temporary
+ * blocks.
+ *
+ */
+int MMG5_loadMshMesh_part2(MMG5_pMesh mesh,MMG5_pSol *sol,_MMG5_pMshFile msh) {
+  MMG5_pTetra pt;
+  MMG5_pPrism pp;
+  MMG5_pTria  ptt;
+  MMG5_pQuad  pq1;
+  MMG5_pEdge  pa;
+  MMG5_pPoint ppt;
+  MMG5_pSol   psl;
+  double      aux, dbuf[9];
+  int         i,nref;
+  MMG5_int    k,idx,iadr,*v,nt,na,nq,ne,npr;
+  int         typ,ref,isol;
+  char        chaine[128];
+  static _MMG5_TLS char mmgWarn1=0;
+
+  /** Second step: read the nodes and move the elements */
+  msh->cur = msh->posNodes;
+  for ( k=0; k< mesh->np; ++k) {
+    if ( !_MMG5_mshInt(msh,&idx) ) goto truncated;
+    if ( idx < 1 || idx > mesh->np ) {
+      fprintf(stderr,"\n  ## Error: %s: node %" MMG5_PRId ": index %" MMG5_PRId
+              " out of range.\n",__func__,k+1,idx);
+      _MMG5_freeMshFile(msh);
+      return(-1);
+    }
+    ppt = &mesh->point[idx];
+    for ( i=0; i<3; ++i ) {
+      if ( !_MMG5_mshReal(msh,mesh->ver,&ppt->c[i]) ) goto truncated;
+    }
+    ppt->tag  = MG_NUL;
+    ppt->tmp  = 0;
+    ppt->ref = 0;
+  }
 
-        for ( idx=0; idx<num; ++idx ) {
-          fread(&i,sw,1,(*inm));
+  nt = na = nq = ne = npr = 0;
+  nref = 0;
 
-          fread(&ref,sw,1,(*inm));
-          fread(&i,sw,1,(*inm));
+  /* Edges: skip edges with MG_ISO refs */
+  v = msh->elt[0];
+  for ( k=0; k<msh->nelt[0]; ++k, v+=3 ) {
+    ref = (int)v[2];
+    if ( mesh->info.iso && abs(ref) == MG_ISO ) continue;
+
+    pa = &mesh->edge[++na];
+    pa->a = v[0];
+    pa->b = v[1];
+    pa->ref = abs(ref);
+    pa->tag |= MG_REF;
+  }
 
-          for ( l=2; l<tagNum; ++l ) {
-            fread(&i,sw,1,(*inm));
-          }
+  /* Triangles: skip triangles with MG_ISO refs */
+  v = msh->elt[1];
+  for ( k=0; k<msh->nelt[1]; ++k, v+=4 ) {
+    ref = (int)v[3];
+    if ( mesh->info.iso && abs(ref) == MG_ISO ) continue;
 
-          if(iswp) ref = _MMG5_swapbin(ref);
+    ptt = &mesh->tria[++nt];
+    for ( i=0; i<3; ++i )  ptt->v[i] = v[i];
+    ptt->ref = abs(ref);
+  }
 
-          fread(&l,sw,1,(*inm));
-          if(iswp) l = _MMG5_swapbin(l);
-          ppt = &mesh->point[l];
-          ppt->ref = ref;
-          assert( l<=mesh->np );
-        }
-        k += num;
-        break;
-      default:
-        fprintf(stderr,"\n  ## Error: %s: unexpected type of element (%d)\n",
-                __func__,typ);
-        if ( ina_t ) _MMG5_SAFE_FREE(ina_t);
-        if ( ina_a ) _MMG5_SAFE_FREE(ina_a);
-        fclose(*inm);
-        return(-1);
-      }
+  /* Quadrangles */
+  v = msh->elt[2];
+  for ( k=0; k<msh->nelt[2]; ++k, v+=5 ) {
+    pq1 = &mesh->quadra[++nq];
+    for ( i=0; i<4; ++i )  pq1->v[i] = v[i];
+    pq1->ref = (int)v[4];
+  }
+
+  /* Tetra for mmg3d */
+  v = msh->elt[3];
+  for ( k=0; k<msh->nelt[3]; ++k, v+=5 ) {
+    ref = (int)v[4];
+    if ( mesh->ne ) {
+      pt = &mesh->tetra[++ne];
+      for ( i=0; i<4; ++i )  pt->v[i] = v[i];
+      pt->ref = abs(ref);
+    }
+    if(ref < 0) {
+      nref++;
+    }
+  }
+
+  /* Prism for mmg3d */
+  v = msh->elt[4];
+  for ( k=0; k<msh->nelt[4]; ++k, v+=7 ) {
+    ref = (int)v[6];
+    if ( mesh->nprism ) {
+      pp = &mesh->prism[++npr];
+      for ( i=0; i<6; ++i )  pp->v[i] = v[i];
+      pp->ref = abs(ref);
+    }
+    if(ref < 0) {
+      nref++;
     }
   }
 
+  /* Nodes */
+  v = msh->elt[5];
+  for ( k=0; k<msh->nelt[5]; ++k, v+=2 ) {
+    assert( v[0]<=mesh->np );
+    mesh->point[v[0]].ref = (int)v[1];
+  }
 
   if ( mesh->dim==3 && mesh->info.iso ) {
     if ( mesh->nt ) {
@@ -1031,13 +1123,10 @@ int MMG5_loadMshMesh_part2(MMG5_pMesh mesh,MMG5_pSol *sol,FILE **inm,
       else if ( nt < mesh->nt ) {
         _MMG5_ADD_MEM(mesh,(nt-mesh->nt)*sizeof(MMG5_Tria),"triangles",
                       fprintf(stderr,"  Exit program.\n");
-                      fclose(*inm);
-                      if ( ina_t ) _MMG5_SAFE_FREE(ina_t);
-                      if ( ina_a ) _MMG5_SAFE_FREE(ina_a);
+                      _MMG5_freeMshFile(msh);
                       return 0);
         _MMG5_SAFE_RECALLOC(mesh->tria,mesh->nt+1,(nt+1),MMG5_Tria,"triangles",0);
       }
-      _MMG5_SAFE_FREE(ina_t);
       mesh->nt = nt;
     }
     if ( mesh->na ) {
@@ -1046,18 +1135,14 @@ int MMG5_loadMshMesh_part2(MMG5_pMesh mesh,MMG5_pSol *sol,FILE **inm,
       else if ( na < mesh->na ) {
         _MMG5_ADD_MEM(mesh,(na-mesh->na)*sizeof(MMG5_Edge),"edges",
                       fprintf(stderr,"  Exit program.\n");
-                      fclose(*inm);
-                      if ( ina_t ) _MMG5_SAFE_FREE(ina_t);
-                      if ( ina_a ) _MMG5_SAFE_FREE(ina_a);
+                      _MMG5_freeMshFile(msh);
                       return 0);
         _MMG5_SAFE_RECALLOC(mesh->edge,mesh->na+1,(na+1),MMG5_Edge,"edges",0);
       }
-      _MMG5_SAFE_FREE(ina_a);
       mesh->na = na;
     }
   }
 
-
   if(nref) {
     fprintf(stdout,"\n     $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$ \n");
     fprintf(stdout,"         WARNING : %d elements (tetra or prisms) with ref < 0.",nref);
@@ -1134,7 +1219,7 @@ int MMG5_loadMshMesh_part2(MMG5_pMesh mesh,MMG5_pSol *sol,FILE **inm,
 
   if(mesh->xt) {
     fprintf(stdout,"\n     $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$ \n");
-    fprintf(stdout,"         BAD ORIENTATION : vol < 0 -- %8d element(s) reoriented\n",mesh->xt);
+    fprintf(stdout,"         BAD ORIENTATION : vol < 0 -- %8" MMG5_PRId " element(s) reoriented\n",mesh->xt);
     fprintf(stdout,"     $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$ \n\n");
   }
   mesh->xt = 0;
@@ -1150,18 +1235,18 @@ int MMG5_loadMshMesh_part2(MMG5_pMesh mesh,MMG5_pSol *sol,FILE **inm,
 
   /* stats */
   if ( abs(mesh->info.imprim) > 3 ) {
-    fprintf(stdout,"     NUMBER OF VERTICES       %8d\n",mesh->np);
+    fprintf(stdout,"     NUMBER OF VERTICES       %8" MMG5_PRId "\n",mesh->np);
     if ( mesh->ne )
-      fprintf(stdout,"     NUMBER OF TETRAHEDRA     %8d\n",mesh->ne);
+      fprintf(stdout,"     NUMBER OF TETRAHEDRA     %8" MMG5_PRId "\n",mesh->ne);
 
     if ( mesh->nprism )
-      fprintf(stdout,"     NUMBER OF PRISMS         %8d\n",mesh->nprism);
+      fprintf(stdout,"     NUMBER OF PRISMS         %8" MMG5_PRId "\n",mesh->nprism);
     if ( mesh->nt )
-      fprintf(stdout,"     NUMBER OF TRIANGLES      %8d\n",mesh->nt);
+      fprintf(stdout,"     NUMBER OF TRIANGLES      %8" MMG5_PRId "\n",mesh->nt);
     if ( mesh->nquad )
-      fprintf(stdout,"     NUMBER OF QUADRILATERALS %8d\n",mesh->nquad);
+      fprintf(stdout,"     NUMBER OF QUADRILATERALS %8" MMG5_PRId "\n",mesh->nquad);
     if ( mesh->na ) {
-      fprintf(stdout,"     NUMBER OF EDGES          %8d\n",mesh->na);
+      fprintf(stdout,"     NUMBER OF EDGES          %8" MMG5_PRId "\n",mesh->na);
     }
   }
 
@@ -1173,10 +1258,9 @@ int MMG5_loadMshMesh_part2(MMG5_pMesh mesh,MMG5_pSol *sol,FILE **inm,
   psl->type = 1;
 
   for ( isol=0; isol < mesh->nsols; ++isol ) {
-    assert ( posNodeData[isol] );
+    assert ( msh->posNodeData[isol] );
 
-    rewind((*inm));
-    fseek((*inm),posNodeData[isol],SEEK_SET);
+    msh->cur = msh->posNodeData[isol];
 
     psl = *sol + isol;
 
@@ -1184,9 +1268,10 @@ int MMG5_loadMshMesh_part2(MMG5_pMesh mesh,MMG5_pSol *sol,FILE **inm,
     psl->dim = mesh->dim;
     psl->type = 1;
 
-    /* String tags: The first one stores the solution name */
-    fscanf((*inm),"%d ",&tagNum);
-    fscanf(*inm,"%127s",&chaine[0]);
+    if ( !_MMG5_mshNodeDataTags(msh,chaine,&typ,&psl->np) ) {
+      _MMG5_freeMshFile(msh);
+      return(-1);
+    }
 
     if ( !MMG5_Set_inputSolName(mesh,psl,chaine) ) {
       if ( !mmgWarn1 ) {
@@ -1196,38 +1281,11 @@ int MMG5_loadMshMesh_part2(MMG5_pMesh mesh,MMG5_pSol *sol,FILE **inm,
       }
     }
 
-    for ( k=1; k<tagNum; ++k ) {
-      fscanf((*inm),"%*[^\n]%*c");
-    }
-
-    /* Real tags ignored */
-    fscanf((*inm),"%d ",&tagNum);
-    for ( k=0; k<tagNum; ++k ) {
-      fscanf((*inm),"%*[^\n]%*c");
-    }
-
-    /* Integer tags : allow to recover the number of sols and their types */
-    fscanf((*inm),"%d ",&tagNum);
-    if ( tagNum < 3 ) {
-      fprintf(stderr,"   Error: %s: node data: Expected at least 3 tags (%d given).\n",
-              __func__,tagNum);
-      fclose(*inm);
-      return(-1);
-    }
-
-    fscanf((*inm),"%d ",&i); //time step;
-    fscanf((*inm),"%d ",&typ); //type of solution: 1=scalar, 3=vector, 9=tensor ;
-    fscanf((*inm),"%d ",&psl->np);
-
-    for ( k=3; k<tagNum; ++k ) {
-      fscanf((*inm),"%d",&i);
-    }
-
     if ( mesh->np != psl->np ) {
       fprintf(stderr,"  ** MISMATCHES DATA: THE NUMBER OF VERTICES IN "
-              "THE MESH (%d) DIFFERS FROM THE NUMBER OF VERTICES IN "
-              "THE SOLUTION (%d) \n",mesh->np,psl->np);
-      fclose(*inm);
+              "THE MESH (%" MMG5_PRId ") DIFFERS FROM THE NUMBER OF VERTICES IN "
+              "THE SOLUTION (%" MMG5_PRId ") \n",mesh->np,psl->np);
+      _MMG5_freeMshFile(msh);
       return(-1);
     }
 
@@ -1245,7 +1303,7 @@ int MMG5_loadMshMesh_part2(MMG5_pMesh mesh,MMG5_pSol *sol,FILE **inm,
     }
     else {
       fprintf(stderr,"  ** DATA TYPE IGNORED %d \n",typ);
-      fclose(*inm);
+      _MMG5_freeMshFile(msh);
       return(-1);
     }
 
@@ -1255,154 +1313,50 @@ int MMG5_loadMshMesh_part2(MMG5_pMesh mesh,MMG5_pSol *sol,FILE **inm,
 
     _MMG5_ADD_MEM(mesh,(psl->size*(psl->npmax+1))*sizeof(double),"initial solution",
                   fprintf(stderr,"  Exit program.\n");
-                  fclose(*inm);
+                  _MMG5_freeMshFile(msh);
                   return 0);
     _MMG5_SAFE_CALLOC(psl->m,psl->size*(psl->npmax+1),double,0);
 
-    /* isotropic solution */
-    if ( psl->size == 1 ) {
-      if ( psl->ver == 1 ) {
-        for (k=1; k<=psl->np; k++) {
-          if(!bin){
-            fscanf((*inm),"%d ",&idx);
-            fscanf((*inm),"%f ",&fbuf[0]);
-          } else {
-            fread(&idx,sw,1, (*inm));
-            if(iswp) idx = _MMG5_swapbin(idx);
-            fread(&fbuf[0],sw,1,(*inm));
-            if(iswp) fbuf[0]=_MMG5_swapf(fbuf[0]);
-          }
-          psl->m[idx] = fbuf[0];
-        }
-      }
-      else {
-        for (k=1; k<=psl->np; k++) {
-          if(!bin){
-            fscanf((*inm),"%d ",&idx);
-            fscanf((*inm),"%lf ",&dbuf[0]);
-          } else {
-            fread(&idx,sw,1, (*inm));
-            if(iswp) idx = _MMG5_swapbin(idx);
-            fread(&dbuf[0],sd,1,(*inm));
-            if(iswp) dbuf[0]=_MMG5_swapd(dbuf[0]);
-          }
-          psl->m[idx] = dbuf[0];
-        }
+    for (k=1; k<=psl->np; k++) {
+      /* The file stores typ values by node whatever the mesh dimension */
+      if ( !_MMG5_mshInt(msh,&idx) ) goto truncated;
+      if ( idx < 1 || idx > psl->np ) {
+        fprintf(stderr,"\n  ## Error: %s: node data %" MMG5_PRId ": index %"
+                MMG5_PRId " out of range.\n",__func__,k,idx);
+        _MMG5_freeMshFile(msh);
+        return(-1);
       }
-    }
-    /* vector displacement only */
-    else if ( psl->size == psl->dim ) {
-      if ( psl->ver == 1 ) {
-        for (k=1; k<=psl->np; k++) {
-          if(!bin){
-            fscanf((*inm),"%d ",&idx);
-            for (i=0; i<psl->dim; i++) {
-              fscanf((*inm),"%f ",&fbuf[0]);
-              psl->m[psl->dim*idx+i] = fbuf[0];
-            }
-          } else {
-            fread(&idx,sw,1, (*inm));
-            if(iswp) idx = _MMG5_swapbin(idx);
-            for (i=0; i<psl->dim; i++) {
-              fread(&fbuf[0],sw,1,(*inm));
-              if(iswp) fbuf[0]=_MMG5_swapf(fbuf[0]);
-              psl->m[psl->dim*idx+i] = fbuf[0];
-            }
-          }
-        }
+      for ( i=0; i<typ; ++i ) {
+        if ( !_MMG5_mshReal(msh,psl->ver,&dbuf[i]) ) goto truncated;
       }
-      else {
-        for (k=1; k<=psl->np; k++) {
-          if(!bin){
-            fscanf((*inm),"%d ",&idx);
-
-            for (i=0; i<psl->dim; i++) {
-              fscanf((*inm),"%lf ",&dbuf[0]);
-              psl->m[psl->dim*idx+i] = dbuf[0];
-            }
-
-          } else {
-            fread(&idx,sw,1, (*inm));
-            if(iswp) idx = _MMG5_swapbin(idx);
-
-            for (i=0; i<psl->dim; i++) {
-              fread(&dbuf[0],sd,1,(*inm));
-              if(iswp) dbuf[0]=_MMG5_swapd(dbuf[0]);
-              psl->m[psl->dim*idx+i] = dbuf[0];
-            }
 
-          }
-        }
+      /* isotropic solution */
+      if ( psl->size == 1 ) {
+        psl->m[idx] = dbuf[0];
       }
-    }
-    /* anisotropic sol */
-    else {
-      if ( psl->ver == 1 ) {
-        for (k=1; k<=psl->np; k++) {
-          if(!bin){
-            fscanf((*inm),"%d ",&idx);
-            for(i=0 ; i<9 ; i++)
-              fscanf((*inm),"%f ",&fbuf[i]);
-          } else {
-            fread(&idx,sw,1, (*inm));
-            if(iswp) idx = _MMG5_swapbin(idx);
-            for(i=0 ; i<9 ; i++) {
-              fread(&fbuf[i],sw,1,(*inm));
-              if(iswp) fbuf[i]=_MMG5_swapf(fbuf[i]);
-            }
-          }
-
-          assert(fbuf[1]==fbuf[3] && fbuf[2]==fbuf[6] && fbuf[5]==fbuf[7]);
-
-          if ( psl->dim ==2 ) {
-            iadr = 3*idx;
-            psl->m[iadr] = fbuf[0];
-            psl->m[iadr+1] = fbuf[1];
-            psl->m[iadr+2] = fbuf[4];
-          }
-          else {
-            iadr = 6*idx;
-            psl->m[iadr+0] = fbuf[0];
-            psl->m[iadr+1] = fbuf[1];
-            psl->m[iadr+2] = fbuf[2];
-            psl->m[iadr+3] = fbuf[4];
-            psl->m[iadr+4] = fbuf[5];
-            psl->m[iadr+5] = fbuf[8];
-          }
-        }
+      /* vector displacement only */
+      else if ( psl->size == psl->dim ) {
+        for (i=0; i<psl->dim; i++)
+          psl->m[psl->dim*idx+i] = dbuf[i];
       }
+      /* anisotropic sol */
       else {
-        for (k=1; k<=psl->np; k++) {
-          if(!bin){
-            fscanf((*inm),"%d ",&idx);
-            for(i=0 ; i<9 ; i++)
-              fscanf((*inm),"%lf ",&dbuf[i]);
-          } else {
-            fread(&idx,sw,1, (*inm));
-            if(iswp) idx = _MMG5_swapbin(idx);
-            for(i=0 ; i<9 ; i++) {
-              fread(&dbuf[i],sd,1,(*inm));
-              if(iswp) dbuf[i]=_MMG5_swapf(dbuf[i]);
-            }
-          }
-
-          assert(dbuf[1]==dbuf[3] && dbuf[2]==dbuf[6] && dbuf[5]==dbuf[7]);
+        assert(dbuf[1]==dbuf[3] && dbuf[2]==dbuf[6] && dbuf[5]==dbuf[7]);
 
-          if ( psl->dim ==2 ) {
-            iadr = 3*idx;
-            psl->m[iadr  ] = dbuf[0];
-            psl->m[iadr+1] = dbuf[1];
-            psl->m[iadr+2] = dbuf[4];
-          }
-          else {
-            iadr = 6*idx;
-            psl->m[iadr  ] = dbuf[0];
-            psl->m[iadr+1] = dbuf[1];
-            psl->m[iadr+2] = dbuf[2];
-            psl->m[iadr+3] = dbuf[4];
-            psl->m[iadr+4] = dbuf[5];
-            psl->m[iadr+5] = dbuf[8];
-          }
+        if ( psl->dim ==2 ) {
+          iadr = 3*idx;
+          psl->m[iadr  ] = dbuf[0];
+          psl->m[iadr+1] = dbuf[1];
+          psl->m[iadr+2] = dbuf[4];
+        }
+        else {
+          iadr = 6*idx;
+          psl->m[iadr  ] = dbuf[0];
+          psl->m[iadr+1] = dbuf[1];
+          psl->m[iadr+2] = dbuf[2];
+          psl->m[iadr+3] = dbuf[4];
+          psl->m[iadr+4] = dbuf[5];
+          psl->m[iadr+5] = dbuf[8];
         }
       }
     }
@@ -1411,9 +1365,15 @@ int MMG5_loadMshMesh_part2(MMG5_pMesh mesh,MMG5_pSol *sol,FILE **inm,
 
   }
 
-  fclose((*inm));
+  _MMG5_freeMshFile(msh);
 
   return(1);
+
+truncated:
+  fprintf(stderr,"\n  ## Error: %s: unexpected end of file or bad data.\n",
+          __func__);
+  _MMG5_freeMshFile(msh);
+  return(-1);
 }
 
 /**
@@ -1426,7 +1386,7 @@ int MMG5_loadMshMesh_part2(MMG5_pMesh mesh,MMG5_pSol *sol,FILE **inm,
  *
  */
 static inline
-void  MMG5_build3DMetric(MMG5_pMesh mesh,MMG5_pSol sol,int ip,
+void  MMG5_build3DMetric(MMG5_pMesh mesh,MMG5_pSol sol,MMG5_int ip,
                          double dbuf[6]) {
   MMG5_pPoint ppt;
   double      mtmp[3],r[3][3];
@@ -1494,10 +1454,11 @@ int MMG5_saveMshMesh(MMG5_pMesh mesh,MMG5_pSol *sol,const char *filename,
   MMG5_pEdge  pa;
   MMG5_pSol   psl;
   double      dbuf[6];
-  int         bin,k,i,typ,nelts,word, header[3],iadr;
+  int         bin,i,typ,nelts,word, header[3];
+  MMG5_int    k,iadr;
   int         nq,ne,npr,np,nt,na,isol;
   char        *ptr,*data;
-  static char mmgWarn = 0;
+  static _MMG5_TLS char mmgWarn = 0;
 
   bin = 0;
 
@@ -1560,12 +1521,12 @@ int MMG5_saveMshMesh(MMG5_pMesh mesh,MMG5_pSol *sol,const char *filename,
     ppt = &mesh->point[k];
     if ( MG_VOK(ppt) ) {
       if(!bin) {
-        fprintf(inm," %d",ppt->tmp);
+        fprintf(inm," %" MMG5_PRId,ppt->tmp);
         for ( i=0; i<3; ++i )
           fprintf(inm," %.15lg",ppt->c[i]);
         fprintf(inm,"\n");
       } else {
-        fwrite(&ppt->tmp,sw,1,inm);
+        _MMG5_FWRITE_IDX(ppt->tmp,inm);
         fwrite(&ppt->c[0],sd,3,inm);
       }
     }
@@ -1627,14 +1588,14 @@ int MMG5_saveMshMesh(MMG5_pMesh mesh,MMG5_pSol *sol,const char *filename,
     if ( !MG_VOK(ppt) ) continue;
     ++nelts;
 
-    if ( !bin ) fprintf(inm,"%d 15 2 %d %d %d\n",nelts,abs(ppt->ref),
+    if ( !bin ) fprintf(inm,"%d 15 2 %d %d %" MMG5_PRId "\n",nelts,abs(ppt->ref),
                         abs(ppt->ref),ppt->tmp);
     else {
       fwrite(&nelts,sw,1,inm);
       word = abs(ppt->ref);
       fwrite(&word,sw,1,inm);
       fwrite(&word,sw,1,inm);
-      fwrite(&ppt->tmp,sw,1,inm);
+      _MMG5_FWRITE_IDX(ppt->tmp,inm);
     }
   }
 
@@ -1653,14 +1614,14 @@ int MMG5_saveMshMesh(MMG5_pMesh mesh,MMG5_pSol *sol,const char *filename,
     ++nelts;
 
     if(!bin)
-      fprintf(inm,"%d 1 2 %d %d %d %d\n",nelts,pa->ref,pa->ref,
+      fprintf(inm,"%d 1 2 %d %d %" MMG5_PRId " %" MMG5_PRId "\n",nelts,pa->ref,pa->ref,
               mesh->point[pa->a].tmp,mesh->point[pa->b].tmp);
     else {
       fwrite(&nelts,sw,1,inm);
       fwrite(&pa->ref,sw,1,inm);
       fwrite(&pa->ref,sw,1,inm);
-      fwrite(&mesh->point[pa->a].tmp,sw,1,inm);
-      fwrite(&mesh->point[pa->b].tmp,sw,1,inm);
+      _MMG5_FWRITE_IDX(mesh->point[pa->a].tmp,inm);
+      _MMG5_FWRITE_IDX(mesh->point[pa->b].tmp,inm);
     }
   }
 
@@ -1679,16 +1640,16 @@ int MMG5_saveMshMesh(MMG5_pMesh mesh,MMG5_pSol *sol,const char *filename,
     ++nelts;
 
     if(!bin)
-      fprintf(inm,"%d 2 2 %d %d %d %d %d\n",nelts,ptt->ref,ptt->ref,
+      fprintf(inm,"%d 2 2 %d %d %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId "\n",nelts,ptt->ref,ptt->ref,
               mesh->point[ptt->v[0]].tmp,mesh->point[ptt->v[1]].tmp,
               mesh->point[ptt->v[2]].tmp);
     else {
       fwrite(&nelts,sw,1,inm);
       fwrite(&ptt->ref,sw,1,inm);
       fwrite(&ptt->ref,sw,1,inm);
-      fwrite(&mesh->point[ptt->v[0]].tmp,sw,1,inm);
-      fwrite(&mesh->point[ptt->v[1]].tmp,sw,1,inm);
-      fwrite(&mesh->point[ptt->v[2]].tmp,sw,1,inm);
+      _MMG5_FWRITE_IDX(mesh->point[ptt->v[0]].tmp,inm);
+      _MMG5_FWRITE_IDX(mesh->point[ptt->v[1]].tmp,inm);
+      _MMG5_FWRITE_IDX(mesh->point[ptt->v[2]].tmp,inm);
     }
   }
 
@@ -1706,17 +1667,17 @@ int MMG5_saveMshMesh(MMG5_pMesh mesh,MMG5_pSol *sol,const char *filename,
     ++nelts;
 
     if(!bin)
-      fprintf(inm,"%d 3 2 %d %d %d %d %d %d\n",nelts,pq->ref,pq->ref,
+      fprintf(inm,"%d 3 2 %d %d %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId "\n",nelts,pq->ref,pq->ref,
               mesh->point[pq->v[0]].tmp,mesh->point[pq->v[1]].tmp,
               mesh->point[pq->v[2]].tmp,mesh->point[pq->v[3]].tmp);
     else {
       fwrite(&nelts,sw,1,inm);
       fwrite(&pq->ref,sw,1,inm);
       fwrite(&pq->ref,sw,1,inm);
-      fwrite(&mesh->point[pq->v[0]].tmp,sw,1,inm);
-      fwrite(&mesh->point[pq->v[1]].tmp,sw,1,inm);
-      fwrite(&mesh->point[pq->v[2]].tmp,sw,1,inm);
-      fwrite(&mesh->point[pq->v[3]].tmp,sw,1,inm);
+      _MMG5_FWRITE_IDX(mesh->point[pq->v[0]].tmp,inm);
+      _MMG5_FWRITE_IDX(mesh->point[pq->v[1]].tmp,inm);
+      _MMG5_FWRITE_IDX(mesh->point[pq->v[2]].tmp,inm);
+      _MMG5_FWRITE_IDX(mesh->point[pq->v[3]].tmp,inm);
     }
   }
 
@@ -1734,17 +1695,17 @@ int MMG5_saveMshMesh(MMG5_pMesh mesh,MMG5_pSol *sol,const char *filename,
     ++nelts;
 
     if(!bin)
-      fprintf(inm,"%d 4 2 %d %d %d %d %d %d\n",nelts,pt->ref,pt->ref,
+      fprintf(inm,"%d 4 2 %d %d %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId "\n",nelts,pt->ref,pt->ref,
               mesh->point[pt->v[0]].tmp,mesh->point[pt->v[1]].tmp,
               mesh->point[pt->v[2]].tmp,mesh->point[pt->v[3]].tmp);
     else {
       fwrite(&nelts,sw,1,inm);
       fwrite(&pt->ref,sw,1,inm);
       fwrite(&pt->ref,sw,1,inm);
-      fwrite(&mesh->point[pt->v[0]].tmp,sw,1,inm);
-      fwrite(&mesh->point[pt->v[1]].tmp,sw,1,inm);
-      fwrite(&mesh->point[pt->v[2]].tmp,sw,1,inm);
-      fwrite(&mesh->point[pt->v[3]].tmp,sw,1,inm);
+      _MMG5_FWRITE_IDX(mesh->point[pt->v[0]].tmp,inm);
+      _MMG5_FWRITE_IDX(mesh->point[pt->v[1]].tmp,inm);
+      _MMG5_FWRITE_IDX(mesh->point[pt->v[2]].tmp,inm);
+      _MMG5_FWRITE_IDX(mesh->point[pt->v[3]].tmp,inm);
     }
   }
 
@@ -1762,7 +1723,7 @@ int MMG5_saveMshMesh(MMG5_pMesh mesh,MMG5_pSol *sol,const char *filename,
     ++nelts;
 
     if(!bin)
-      fprintf(inm,"%d 6 2 %d %d %d %d %d %d %d %d\n",nelts,pp->ref,pp->ref,
+      fprintf(inm,"%d 6 2 %d %d %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId "\n",nelts,pp->ref,pp->ref,
               mesh->point[pp->v[0]].tmp,mesh->point[pp->v[1]].tmp,
               mesh->point[pp->v[2]].tmp,mesh->point[pp->v[3]].tmp,
               mesh->point[pp->v[4]].tmp,mesh->point[pp->v[5]].tmp);
@@ -1770,12 +1731,12 @@ int MMG5_saveMshMesh(MMG5_pMesh mesh,MMG5_pSol *sol,const char *filename,
       fwrite(&nelts,sw,1,inm);
       fwrite(&pp->ref,sw,1,inm);
       fwrite(&pp->ref,sw,1,inm);
-      fwrite(&mesh->point[pp->v[0]].tmp,sw,1,inm);
-      fwrite(&mesh->point[pp->v[1]].tmp,sw,1,inm);
-      fwrite(&mesh->point[pp->v[2]].tmp,sw,1,inm);
-      fwrite(&mesh->point[pp->v[3]].tmp,sw,1,inm);
-      fwrite(&mesh->point[pp->v[4]].tmp,sw,1,inm);
-      fwrite(&mesh->point[pp->v[5]].tmp,sw,1,inm);
+      _MMG5_FWRITE_IDX(mesh->point[pp->v[0]].tmp,inm);
+      _MMG5_FWRITE_IDX(mesh->point[pp->v[1]].tmp,inm);
+      _MMG5_FWRITE_IDX(mesh->point[pp->v[2]].tmp,inm);
+      _MMG5_FWRITE_IDX(mesh->point[pp->v[3]].tmp,inm);
+      _MMG5_FWRITE_IDX(mesh->point[pp->v[4]].tmp,inm);
+      _MMG5_FWRITE_IDX(mesh->point[pp->v[5]].tmp,inm);
     }
   }
   if ( bin )  fprintf(inm,"\n");
@@ -1851,13 +1812,13 @@ int MMG5_saveMshMesh(MMG5_pMesh mesh,MMG5_pSol *sol,const char *filename,
           dbuf[i] = psl->m[iadr+i];
 
         if ( !bin ) {
-          fprintf(inm,"%d",ppt->tmp);
+          fprintf(inm,"%" MMG5_PRId,ppt->tmp);
           for ( i=0; i<typ; ++i )
             fprintf(inm," %lg",dbuf[i]);
           fprintf(inm,"\n");
         }
         else {
-          fwrite(&ppt->tmp,sw,1,inm);
+          _MMG5_FWRITE_IDX(ppt->tmp,inm);
           fwrite(&dbuf,sd,typ,inm);
         }
       }
@@ -1878,7 +1839,7 @@ int MMG5_saveMshMesh(MMG5_pMesh mesh,MMG5_pSol *sol,const char *filename,
         }
 
         if(!bin) {
-          fprintf(inm,"%d",ppt->tmp);
+          fprintf(inm,"%" MMG5_PRId,ppt->tmp);
           if ( psl->dim==2 ) {
             iadr = k*psl->size;
             fprintf(inm," %.15lg %.15lg %.15lg %.15lg %.15lg %.15lg"
@@ -1892,7 +1853,7 @@ int MMG5_saveMshMesh(MMG5_pMesh mesh,MMG5_pSol *sol,const char *filename,
           }
         }
         else {
-          fwrite(&ppt->tmp,sw,1,inm);
+          _MMG5_FWRITE_IDX(ppt->tmp,inm);
           if ( psl->dim==2 ) {
             iadr = k*psl->size;
             fwrite(&psl->m[iadr],sd,2,inm);
@@ -1940,11 +1901,11 @@ int MMG5_saveMshMesh(MMG5_pMesh mesh,MMG5_pSol *sol,const char *filename,
  *
  */
 int MMG5_loadSolHeader( const char *filename,int meshDim,FILE **inm,int *ver,
-                        int *bin,int *iswp,int *np,int *dim,int *nsols,int **type,
+                        int *bin,int *iswp,MMG5_int *np,MMG5_int *dim,int *nsols,int **type,
                         long *posnp, int imprim) {
-  int         binch,bdim;
-  int         bpos,i;
-  char        *ptr,*data,chaine[128];
+  _MMG5_BinFile bf;
+  int           i;
+  char          *ptr,*data,chaine[128];
 
   *posnp = 0;
   *bin   = 0;
@@ -1997,15 +1958,15 @@ int MMG5_loadSolHeader( const char *filename,int meshDim,FILE **inm,int *ver,
     strcpy(chaine,"DDD");
     while(fscanf(*inm,"%127s",&chaine[0])!=EOF && strncmp(chaine,"End",strlen("End")) ) {
       if(!strncmp(chaine,"Dimension",strlen("Dimension"))) {
-        fscanf(*inm,"%d",dim);
+        fscanf(*inm,"%" MMG5_SCNd,dim);
         if ( *dim!=meshDim ) {
-          fprintf(stderr,"BAD SOL DIMENSION: %d\n",*dim);
+          fprintf(stderr,"BAD SOL DIMENSION: %" MMG5_PRId "\n",*dim);
           fclose(*inm);
           return(-1);
         }
         continue;
       } else if(!strncmp(chaine,"SolAtVertices",strlen("SolAtVertices"))) {
-        fscanf(*inm,"%d",np);
+        fscanf(*inm,"%" MMG5_SCNd,np);
         fscanf(*inm,"%d",nsols);
         _MMG5_SAFE_CALLOC(*type,*nsols,int,-1);
         for ( i=0; i<*nsols; ++i ) {
@@ -2016,52 +1977,36 @@ int MMG5_loadSolHeader( const char *filename,int meshDim,FILE **inm,int *ver,
       }
     }
   } else {
-    fread(&binch,sw,1,*inm);
-    if(binch==16777216) (*iswp)=1;
-    else if(binch!=1) {
-      fprintf(stdout,"BAD FILE ENCODING\n");
+    if ( !_MMG5_openBinFile(*inm,&bf) ) {
       fclose(*inm);
-      return -1;
-    }
-    fread(ver,sw,1,*inm);
-    if ( *iswp ) *ver = _MMG5_swapbin(*ver);
-    while(fread(&binch,sw,1,*inm)!=EOF && binch!=54 ) {
-      if ( *iswp ) binch=_MMG5_swapbin(binch);
-      if(binch==54) break;
-      if(binch==3) {  //Dimension
-        fread(&bdim,sw,1,*inm);  //NulPos=>20
-        if ( *iswp ) bdim=_MMG5_swapbin(bdim);
-        fread(dim,sw,1,*inm);
-        if ( *iswp ) *dim=_MMG5_swapbin(*dim);
-        if ( *dim!=meshDim ) {
-          fprintf(stderr,"BAD SOL DIMENSION: %d\n",*dim);
-          printf("  Exit program.\n");
-          fclose(*inm);
-          return(-1);
-        }
-        continue;
-      } else if(binch==62) {  //SolAtVertices
-        fread(&binch,sw,1,*inm); //Pos
-        if ( *iswp ) binch=_MMG5_swapbin(binch);
-        fread(np,sw,1,*inm);
-        if ( *iswp ) *np=_MMG5_swapbin(*np);
-        fread(nsols,sw,1,*inm); //nb sol
-        if ( *iswp ) *nsols =_MMG5_swapbin(*nsols);
-
-        _MMG5_SAFE_CALLOC(*type,*nsols,int,-1); //typSol
-        for ( i=0; i<*nsols; ++i ) {
-          fread(&((*type)[i]),sw,1,*inm);
-          if ( *iswp ) (*type)[i]=_MMG5_swapbin((*type)[i]);
-        }
-        *posnp = ftell(*inm);
-        break;
-      } else {
-        fread(&bpos,sw,1,*inm); //Pos
-        if ( *iswp ) bpos=_MMG5_swapbin(bpos);
-        rewind(*inm);
-        fseek(*inm,bpos,SEEK_SET);
+      return(-1);
+    }
+    *iswp = bf.iswp;
+    *ver  = bf.ver;
+    *dim  = bf.nel[3]; //Dimension
+    if ( *dim!=meshDim ) {
+      fprintf(stderr,"BAD SOL DIMENSION: %" MMG5_PRId "\n",*dim);
+      printf("  Exit program.\n");
+      _MMG5_closeBinFile(&bf);
+      fclose(*inm);
+      return(-1);
+    }
+    if ( bf.pos[62] ) {  //SolAtVertices
+      *np    = bf.nel[62];
+      *nsols = _MMG5_binInt(&bf,bf.pos[62]);
+      if ( *nsols <= 0 ) {
+        fprintf(stderr,"BAD NUMBER OF SOLUTIONS: %d\n",*nsols);
+        _MMG5_closeBinFile(&bf);
+        fclose(*inm);
+        return(-1);
       }
+      _MMG5_SAFE_CALLOC(*type,*nsols,int,-1); //typSol
+      for ( i=0; i<*nsols; ++i ) {
+        (*type)[i] = _MMG5_binInt(&bf,bf.pos[62]+(i+1)*sw);
+      }
+      *posnp = (long)(bf.pos[62]+(*nsols+1)*sw);
     }
+    _MMG5_closeBinFile(&bf);
   }
 
   return 1;
@@ -2077,7 +2022,7 @@ int MMG5_loadSolHeader( const char *filename,int meshDim,FILE **inm,int *ver,
  * Read the solution value for vertex of index pos in floating precision.
  *
  */
-void MMG5_readFloatSol3D(MMG5_pSol sol,FILE *inm,int bin,int iswp,int pos) {
+void MMG5_readFloatSol3D(MMG5_pSol sol,FILE *inm,int bin,int iswp,MMG5_int pos) {
   float       fbuf[6],tmpf;
   int         i;
 
@@ -2123,7 +2068,7 @@ void MMG5_readFloatSol3D(MMG5_pSol sol,FILE *inm,int bin,int iswp,int pos) {
  * Read the solution value for vertex of index pos in double precision.
  *
  */
-void MMG5_readDoubleSol3D(MMG5_pSol sol,FILE *inm,int bin,int iswp,int pos) {
+void MMG5_readDoubleSol3D(MMG5_pSol sol,FILE *inm,int bin,int iswp,MMG5_int pos) {
   double      dbuf[6],tmpd;
   int         i;
 
@@ -2160,6 +2105,64 @@ void MMG5_readDoubleSol3D(MMG5_pSol sol,FILE *inm,int bin,int iswp,int pos) {
   }
 }
 
+/**
+ * \param sol array of \a nsols allocated sol structures.
+ * \param nsols number of solutions stored in the file.
+ * \param inm pointer toward the binary solution file.
+ * \param posnp position of the first solution value in the file.
+ * \return 1 if success, 0 if fail.
+ *
+ * Read the values at vertices of the \a nsols solutions of a binary file: the
+ * file is mapped in memory and each solution is copied in one pass into the
+ * \a m array of its sol structure.
+ *
+ */
+int MMG5_readBinSols(MMG5_pSol sol,int nsols,FILE *inm,long posnp) {
+  _MMG5_BinFile bf;
+  MMG5_pSol     psl;
+  double        *m,tmpd;
+  float         fbuf[6];
+  size_t        wsiz,rsiz,off;
+  int           j,i;
+  MMG5_int      k;
+
+  if ( !_MMG5_openBinFile(inm,&bf) ) return(0);
+
+  wsiz = ( bf.ver < 2 ) ? sw : sd;
+
+  rsiz = 0;
+  for ( j=0; j<nsols; ++j )  rsiz += sol[j].size*wsiz;
+
+  off = (size_t)posnp;
+  for ( j=0; j<nsols; ++j ) {
+    psl = &sol[j];
+    if ( !_MMG5_binCopy(&bf,off,psl->np,rsiz,psl->size*wsiz,(int)wsiz,
+                        &psl->m[psl->size],psl->size*sd) ) {
+      _MMG5_closeBinFile(&bf);
+      return(0);
+    }
+    off += psl->size*wsiz;
+
+    for ( k=1; k<=psl->np; ++k ) {
+      m = &psl->m[psl->size*k];
+      if ( bf.ver < 2 ) {
+        /* simple precision values are stored at the beginning of m */
+        memcpy(fbuf,m,psl->size*sw);
+        for ( i=0; i<psl->size; ++i )  m[i] = (double)fbuf[i];
+      }
+      if ( psl->size == 6 ) {
+        /* tensor solution */
+        tmpd = m[2];
+        m[2] = m[3];
+        m[3] = tmpd;
+      }
+    }
+  }
+  _MMG5_closeBinFile(&bf);
+
+  return(1);
+}
+
 /**
  * \param mesh pointer toward the mesh structure
  * \param sol pointer toward an allocatable sol structure.
@@ -2172,7 +2175,7 @@ void MMG5_readDoubleSol3D(MMG5_pSol sol,FILE *inm,int bin,int iswp,int pos) {
  *
  */
 void MMG5_writeDoubleSol3D(MMG5_pMesh mesh,MMG5_pSol sol,FILE *inm,int bin,
-                           int pos,int metricData) {
+                           MMG5_int pos,int metricData) {
   double      dbuf[6],tmp;
   int         i;
 
@@ -2210,6 +2213,229 @@ void MMG5_writeDoubleSol3D(MMG5_pMesh mesh,MMG5_pSol sol,FILE *inm,int bin,
   }
 }
 
+/**
+ * \param buf buffer in which we write.
+ * \param val integer to write.
+ * \return the number of written characters.
+ *
+ * Write the integer \a val in \a buf (without terminating null character):
+ * same output as the "%d" format of printf but faster.
+ *
+ */
+int _MMG5_fmtInt(char *buf,MMG5_int val) {
+  char         tmp[12];
+  unsigned int uval;
+  int          n,len;
+
+  len = 0;
+  if ( val < 0 ) {
+    buf[len++] = '-';
+    uval = 0u - (unsigned int)val;
+  }
+  else
+    uval = (unsigned int)val;
+
+  n = 0;
+  do {
+    tmp[n++] = (char)('0' + uval%10);
+    uval /= 10;
+  } while ( uval );
+
+  while ( n )  buf[len++] = tmp[--n];
+
+  return(len);
+}
+
+/**
+ * \param buf buffer in which we write (of size at least \ref _MMG5_ASCIIDBL).
+ * \param val double to write.
+ * \return the number of written characters.
+ *
+ * Write the double \a val in \a buf with the "%.15lg" format (without
+ * terminating null character).
+ *
+ */
+int _MMG5_fmtDouble(char *buf,double val) {
+  return(snprintf(buf,_MMG5_ASCIIDBL,"%.15lg",val));
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param data unused.
+ * \param k index of the point to write.
+ * \param buf buffer in which we write.
+ * \return the number of written characters (0 if the point is unused).
+ *
+ * Format the point \a k of a 3D mesh for the \a Vertices field of a
+ * \a .mesh file.
+ *
+ */
+int _MMG5_asciiVertex3D(MMG5_pMesh mesh,void *data,MMG5_int k,char *buf) {
+  MMG5_pPoint ppt;
+  int         i,len;
+
+  ppt = &mesh->point[k];
+  if ( !MG_VOK(ppt) )  return(0);
+
+  len = 0;
+  for ( i=0; i<3; ++i ) {
+    len += _MMG5_fmtDouble(buf+len,ppt->c[i]);
+    buf[len++] = ' ';
+  }
+  len += _MMG5_fmtInt(buf+len,abs(ppt->ref));
+  buf[len++] = '\n';
+
+  return(len);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param inm pointer toward the file in which we write.
+ * \param nrec number of entities (numbered from 1 to \a nrec).
+ * \param maxlen maximal number of characters needed by one entity.
+ * \param fmt function that formats one entity.
+ * \param data data passed to \a fmt.
+ * \return 1 if success, 0 if fail.
+ *
+ * Write the \a nrec entities of a field of an ASCII file. The entities are
+ * formatted by chunks of \ref _MMG5_ASCIICHUNK in a buffer (one chunk per
+ * thread, in parallel if OpenMP is available) and each buffer is written
+ * with only one call to fwrite, in the order of the chunks.
+ *
+ */
+int _MMG5_saveAsciiRecords(MMG5_pMesh mesh,FILE *inm,MMG5_int nrec,int maxlen,
+                           _MMG5_asciiRecord fmt,void *data) {
+  char      *buf;
+  size_t    *len,bufsiz;
+  int       c,ier,nth;
+  MMG5_int  nc,k1,c0,k0,k;
+
+  if ( nrec <= 0 )  return(1);
+
+  nc  = (nrec-1)/_MMG5_ASCIICHUNK + 1;
+#ifdef _OPENMP
+  nth = (int)MG_MIN(mesh->info.nthreads,nc);
+#else
+  nth = 1;
+#endif
+
+  /* small work buffers: not counted in the mesh memory */
+  bufsiz = (size_t)_MMG5_ASCIICHUNK*maxlen;
+  _MMG5_SAFE_MALLOC(buf,nth*bufsiz,char,0);
+  _MMG5_SAFE_CALLOC(len,nth,size_t,0);
+
+  ier = 1;
+  for ( c0=0; c0<nc; c0+=nth ) {
+#pragma omp parallel for num_threads(nth) private(k,k0,k1)
+    for ( c=0; c<nth; ++c ) {
+      len[c] = 0;
+      k0 = 1 + (c0+c)*_MMG5_ASCIICHUNK;
+      k1 = MG_MIN(nrec+1,k0+_MMG5_ASCIICHUNK);
+      for ( k=k0; k<k1; ++k )
+        len[c] += fmt(mesh,data,k,buf+c*bufsiz+len[c]);
+    }
+
+    for ( c=0; c<nth && c0+c<nc; ++c ) {
+      if ( fwrite(buf+c*bufsiz,1,len[c],inm) != len[c] )
+        ier = 0;
+    }
+  }
+
+  _MMG5_SAFE_FREE(len);
+  _MMG5_SAFE_FREE(buf);
+
+  return(ier);
+}
+
+/** Data needed to format the values of solutions at vertices. */
+typedef struct {
+  MMG5_pSol sol;
+  int       nsols;
+  int       metricData;
+} _MMG5_asciiSols;
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param data pointer toward the _MMG5_asciiSols structure.
+ * \param k index of the point.
+ * \param buf buffer in which we write.
+ * \return the number of written characters (0 if the point is unused).
+ *
+ * Format the line of the point \a k of a solution file: values of each
+ * solution (with the same layout than \ref MMG5_writeDoubleSol3D).
+ *
+ */
+static int _MMG5_asciiSolsRecord(MMG5_pMesh mesh,void *data,MMG5_int k,char *buf) {
+  _MMG5_asciiSols *as;
+  MMG5_pSol       psl;
+  double          dbuf[6],tmp;
+  int             i,j,len;
+
+  as = (_MMG5_asciiSols*)data;
+  if ( !MG_VOK(&mesh->point[k]) )  return(0);
+
+  len = 0;
+  for ( j=0; j<as->nsols; ++j ) {
+    psl = &as->sol[j];
+
+    if ( psl->size == 6 ) {
+      /* tensor solution */
+      if ( as->metricData )
+        MMG5_build3DMetric(mesh,psl,k,dbuf);
+      else
+        for ( i=0; i<6; ++i )  dbuf[i] = psl->m[6*k+i];
+
+      tmp     = dbuf[2];
+      dbuf[2] = dbuf[3];
+      dbuf[3] = tmp;
+      for ( i=0; i<6; ++i ) {
+        len += _MMG5_fmtDouble(buf+len,dbuf[i]);
+        buf[len++] = ' ';
+        buf[len++] = ' ';
+      }
+    }
+    else {
+      /* scalar or vector solution */
+      for ( i=0; i<psl->size; ++i ) {
+        buf[len++] = ' ';
+        len += _MMG5_fmtDouble(buf+len,psl->m[psl->size*k+i]);
+      }
+    }
+  }
+  buf[len++] = '\n';
+
+  return(len);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param sol array of \a nsols solutions.
+ * \param nsols number of solutions.
+ * \param inm pointer toward the ASCII solution file.
+ * \param metricData 1 if we save a metric (\a sol is then used to build the
+ * metric at ridge points).
+ * \return 1 if success, 0 if fail.
+ *
+ * Write the values of the solutions at the used vertices in an ASCII file.
+ *
+ */
+int MMG5_saveAsciiSols(MMG5_pMesh mesh,MMG5_pSol sol,int nsols,FILE *inm,
+                       int metricData) {
+  _MMG5_asciiSols as;
+  int             j,maxlen;
+
+  as.sol        = sol;
+  as.nsols      = nsols;
+  as.metricData = metricData;
+
+  maxlen = 1;
+  for ( j=0; j<nsols; ++j )
+    maxlen += sol[j].size*(_MMG5_ASCIIDBL+2);
+
+  return(_MMG5_saveAsciiRecords(mesh,inm,mesh->np,maxlen,
+                                _MMG5_asciiSolsRecord,&as));
+}
+
 /**
  * \param mesh pointer toward the mesh structure.
  * \param filename name of file.
@@ -2228,11 +2454,12 @@ void MMG5_writeDoubleSol3D(MMG5_pMesh mesh,MMG5_pSol sol,FILE *inm,int bin,
  *
  */
 int MMG5_saveSolHeader( MMG5_pMesh mesh,const char *filename,
-                        FILE **inm,int ver,int *bin,int np,int dim,
+                        FILE **inm,int ver,int *bin,MMG5_int np,int dim,
                         int nsols,int *type,int *size) {
   MMG5_pPoint ppt;
-  int         binch,bpos;
-  int         k;
+  int         binch;
+  int64_t     bpos;
+  MMG5_int    k;
   char        *ptr,*data,chaine[128];
 
   *bin = 0;
@@ -2291,7 +2518,7 @@ int MMG5_saveSolHeader( MMG5_pMesh mesh,const char *filename,
     binch = 3; //Dimension
     fwrite(&binch,sw,1,*inm);
     bpos = 20; //Pos
-    fwrite(&bpos,sw,1,*inm);
+    _MMG5_FWRITE_POS(bpos,*inm,return(0));
     binch = dim;
     fwrite(&binch,sw,1,*inm);
   }
@@ -2305,7 +2532,7 @@ int MMG5_saveSolHeader( MMG5_pMesh mesh,const char *filename,
   if(!*bin) {
     strcpy(&chaine[0],"\n\nSolAtVertices\n");
     fprintf(*inm,"%s",chaine);
-    fprintf(*inm,"%d\n",np);
+    fprintf(*inm,"%" MMG5_PRId "\n",np);
     fprintf(*inm,"%d",nsols);
     for (k=0; k<nsols; ++k )
       fprintf(*inm," %d",type[k]);
@@ -2316,10 +2543,10 @@ int MMG5_saveSolHeader( MMG5_pMesh mesh,const char *filename,
     bpos += 16;
 
     for (k=0; k<nsols; ++k )
-      bpos += 4 + (size[k]*ver)*4*np; //Pos
-    fwrite(&bpos,sw,1,*inm);
+      bpos += 4 + (size[k]*ver)*4*(int64_t)np; //Pos
+    _MMG5_FWRITE_POS(bpos,*inm,return(0));
 
-    fwrite(&np,sw,1,*inm);
+    _MMG5_FWRITE_IDX(np,*inm);
     fwrite(&nsols,sw,1,*inm);
     for (k=0; k<nsols; ++k )
       fwrite(&type[k],sw,1,*inm);
@@ -2332,11 +2559,12 @@ int MMG5_saveSolHeader( MMG5_pMesh mesh,const char *filename,
 /**
  * \param mesh pointer toward the mesh structure.
  * \param type type of the metric
- * \param inm metric file
+ * \param inm metric file (NULL if already closed)
  * \return 1 if success, -1 if fail
  *
  * Check if the type of the metric is compatible with the remeshing mode.
- * If not, deallocate the type array and close the metric file.
+ * If not, deallocate the type array and close the metric file (if \a inm is
+ * NULL, \a type is not an allocated array).
  *
  */
 int MMG5_chkMetricType(MMG5_pMesh mesh,int *type, FILE *inm) {
@@ -2347,8 +2575,10 @@ int MMG5_chkMetricType(MMG5_pMesh mesh,int *type, FILE *inm) {
   if ( mesh->info.lag == -1 ) {
     if ( type[0]!=1 && type[0]!=3) {
       fprintf(stderr,"  ** DATA TYPE IGNORED %d \n",type[0]);
-      _MMG5_SAFE_FREE(type);
-      fclose(inm);
+      if ( inm ) {
+        _MMG5_SAFE_FREE(type);
+        fclose(inm);
+      }
       return(-1);
     }
   }
@@ -2356,8 +2586,10 @@ int MMG5_chkMetricType(MMG5_pMesh mesh,int *type, FILE *inm) {
     if ( type[0] != 2 ) {
       fprintf(stderr,"  ** MISMATCH DATA TYPE FOR LAGRANGIAN MODE %d \n",
               type[0]);
-      _MMG5_SAFE_FREE(type);
-      fclose(inm);
+      if ( inm ) {
+        _MMG5_SAFE_FREE(type);
+        fclose(inm);
+      }
       return(-1);
     }
   }
@@ -2374,11 +2606,11 @@ int MMG5_chkMetricType(MMG5_pMesh mesh,int *type, FILE *inm) {
 void MMG5_printMetStats(MMG5_pMesh mesh,MMG5_pSol met) {
   if ( abs(mesh->info.imprim) > 3 ) {
     if ( met->size == 1 )
-      fprintf(stdout,"     NUMBER OF SCALAR VALUES %8d\n",met->np);
+      fprintf(stdout,"     NUMBER OF SCALAR VALUES %8" MMG5_PRId "\n",met->np);
     else if ( met->size == 3 )
-      fprintf(stdout,"     NUMBER OF VECTOR VALUES %8d\n",met->np);
+      fprintf(stdout,"     NUMBER OF VECTOR VALUES %8" MMG5_PRId "\n",met->np);
     else
-      fprintf(stdout,"     NUMBER OF TENSOR VALUES %8d\n",met->np);
+      fprintf(stdout,"     NUMBER OF TENSOR VALUES %8" MMG5_PRId "\n",met->np);
   }
 }
 
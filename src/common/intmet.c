@@ -179,7 +179,7 @@ int _MMG5_mmgIntmet33_ani(double *m,double *n,double *mr,double s) {
   int     order;
   double  lambda[3],vp[3][3],mu[3],is[6],isnis[6],mt[9],P[9],dd;
   char    i;
-  static char mmgWarn;
+  static _MMG5_TLS char mmgWarn;
 
   /* Compute inverse of square root of matrix M : is =
    * P*diag(1/sqrt(lambda))*{^t}P */
@@ -288,7 +288,7 @@ int _MMG5_mmgIntmet33_ani(double *m,double *n,double *mr,double s) {
  * at pointing towards direction of n1 at interpolated point.
  *
  */
-int _MMG5_intridmet(MMG5_pMesh mesh,MMG5_pSol met,int ip1, int ip2,double s,
+int _MMG5_intridmet(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int ip1, MMG5_int ip2,double s,
                     double v[3],double mr[6]) {
   MMG5_pxPoint   go1,go2;
   MMG5_pPoint    p1,p2;
@@ -631,9 +631,10 @@ int _MMG5_interpreg_ani(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTria pt,char i,
   double         b1[3],b2[3],bn[3],c[3],nt[3],cold[3],nold[3],n[3];
   double         m1old[6],m2old[6],m1[6],m2[6];
   double         *n1,*n2,step,u,r[3][3],dd;
-  int            ip1,ip2,nstep,l;
+  int            nstep,l;
+  MMG5_int       ip1,ip2;
   char           i1,i2;
-  static int     warn=0;
+  static _MMG5_TLS int     warn=0;
 
   /* Number of steps for parallel transport */
   nstep = 4;
@@ -644,7 +645,7 @@ int _MMG5_interpreg_ani(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTria pt,char i,
   p1  = &mesh->point[ip1];
   p2  = &mesh->point[ip2];
 
-  if ( !_MMG5_bezierCP(mesh,pt,&b,1) )  return(0);
+  if ( !mesh->func.bezierCP(mesh,pt,&b,1) )  return(0);
 
   n1 = &b.n[i1][0];
   n2 = &b.n[i2][0];
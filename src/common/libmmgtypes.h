@@ -27,10 +27,27 @@
 #include <stdint.h>
 #include <stdarg.h>
 
+#include "mmgcmakedefines.h"
+
 
 #ifndef _LIBMMGTYPES_H
 #define _LIBMMGTYPES_H
 
+/**
+ * \typedef MMG5_int
+ *
+ * Integer type of the entity indices and counters (points, edges, triangles,
+ * quadrilaterals, tetrahedra, prisms and adjacencies). It is a 64 bits integer
+ * if Mmg has been built with the \a MMG5_INT64 option (recorded in the
+ * installed \a mmgcmakedefines.h header) and a 32 bits one otherwise.
+ *
+ */
+#ifdef MMG5_INT64
+typedef int64_t MMG5_int;
+#else
+typedef int32_t MMG5_int;
+#endif
+
 /**
  * \def MMG5_SUCCESS
  *
@@ -206,11 +223,11 @@ typedef struct {
   double   c[3]; /*!< Coordinates of point */
   double   n[3]; /*!< Normal or Tangent for mmgs and Tangent (if needed) for mmg3d */
   int      ref; /*!< Reference of point */
-  int      xp; /*!< Surface point number */
-  int      tmp; /*!< Index of point in the saved mesh (we don't count
+  MMG5_int xp; /*!< Surface point number */
+  MMG5_int tmp; /*!< Index of point in the saved mesh (we don't count
                   the unused points)*/
   int      flag; /*!< Flag to know if we have already treated the point */
-  int      s;
+  MMG5_int s;
   int16_t  tag; /*!< Contains binary flags : if \f$tag=23=16+4+2+1\f$, then
                   the point is \a MG_REF, \a MG_GEO, \a MG_REQ and \a MG_BDY */
   char     tagdel; /*!< Tag for delaunay */
@@ -232,9 +249,9 @@ typedef MMG5_xPoint * MMG5_pxPoint;
  * \brief Structure to store edges of a MMG mesh.
  */
 typedef struct {
-  int      a,b; /*!< Extremities of the edge */
+  MMG5_int a,b; /*!< Extremities of the edge */
   int      ref; /*!< Reference of the edge */
-  int      base; /*!< 2Donly: used to store the tria+ tria edge indices
+  MMG5_int base; /*!< 2Donly: used to store the tria+ tria edge indices
                    that allow to access to the edge */
   int16_t  tag; /*!< Binary flags */
 } MMG5_Edge;
@@ -260,10 +277,10 @@ typedef MMG5_Edge * MMG5_pEdge;
  */
 typedef struct {
   double   qual;   /*Quality of the triangle*/
-  int      v[3]; /*!< Vertices of the triangle */
+  MMG5_int v[3]; /*!< Vertices of the triangle */
   int      ref; /*!< Reference of the triangle */
-  int      base;
-  int      cc; /*!< used to store the tetra + tetra face indices
+  MMG5_int base;
+  MMG5_int cc; /*!< used to store the tetra + tetra face indices
                  that allow to access to the tria */
   int      edg[3]; /*!< edg[i] contains the ref of the \f$i^{th}\f$ edge
                      of triangle */
@@ -293,9 +310,9 @@ typedef MMG5_Tria * MMG5_pTria;
  *
  */
 typedef struct {
-  int      v[4]; /*!< Vertices of the quadrangle */
+  MMG5_int v[4]; /*!< Vertices of the quadrangle */
   int      ref; /*!< Reference of the quadrangle */
-  int      base;
+  MMG5_int base;
   int      edg[4]; /*!< edg[i] contains the ref of the \f$i^{th}\f$ edge
                      of quadrangle */
   int16_t  tag[4]; /*!< tag[i] contains the tag associated to the
@@ -329,11 +346,11 @@ typedef MMG5_Quad * MMG5_pQuad;
  */
 typedef struct {
   double   qual; /*!< Quality of the element */
-  int      v[4]; /*!< Vertices of the tetrahedron */
+  MMG5_int v[4]; /*!< Vertices of the tetrahedron */
   int      ref; /*!< Reference of the tetrahedron */
-  int      base;
+  MMG5_int base;
   int      mark; /*!< Used for delaunay */
-  int      xt; /*!< Index of the surface \ref MMG5_xTetra associated to
+  MMG5_int xt; /*!< Index of the surface \ref MMG5_xTetra associated to
                  the tetrahedron*/
   int      flag;
   int16_t  tag;
@@ -389,11 +406,11 @@ typedef MMG5_xTetra * MMG5_pxTetra;
  *
  */
 typedef struct {
-  int      v[6]; /*!< Vertices of the prism */
+  MMG5_int v[6]; /*!< Vertices of the prism */
   int      ref; /*!< Reference of the prism */
-  int      base;
+  MMG5_int base;
   int      flag;
-  int      xpr; /*!< Index of the surface \ref MMG5_xPrism associated to
+  MMG5_int xpr; /*!< Index of the surface \ref MMG5_xPrism associated to
                   the prism*/
   char     tag;
 } MMG5_Prism;
@@ -438,6 +455,7 @@ typedef struct {
   int           opnbdy;
   int           renum;
   int           octree;
+  int           nthreads;
   int           nmat;
   char          nreg;
   char          imprim,ddebug,badkal,iso,fem,lag;
@@ -453,52 +471,118 @@ typedef struct {
  * \brief To store geometric edges.
  */
 typedef struct {
-  int     a; /*!< First extremity of edge */
-  int     b;  /*!< Second extremity of edge */
-  int     ref; /*!< Reference of edge */
-  int     nxt; /*!< Next element of hash table */
-  int16_t tag; /*!< tag of edge */
+  MMG5_int a; /*!< First extremity of edge */
+  MMG5_int b;  /*!< Second extremity of edge */
+  int      ref; /*!< Reference of edge */
+  MMG5_int nxt; /*!< Next element of hash table */
+  int16_t  tag; /*!< tag of edge */
 } MMG5_hgeom;
 
 typedef struct {
   MMG5_hgeom  *geom;
-  int         siz,max,nxt;
+  MMG5_int    siz,max,nxt;
 } MMG5_HGeom;
 
+/**
+ * \struct MMG5_sol
+ * \brief MMG Solution structure (for solution or metric).
+ */
+typedef struct {
+  int       ver; /* Version of the solution file */
+  int       dim; /* Dimension of the solution file*/
+  MMG5_int  np; /* Number of points of the solution */
+  MMG5_int  npmax; /* Maximum number of points */
+  MMG5_int  npi; /* Temporary number of points (internal use only) */
+  int       size; /* Number of solutions per entity */
+  int       type; /* Type of the solution (scalar, vectorial of tensorial) */
+  double   *m; /*!< Solution values */
+  double    umin,umax; /*!<Min/max values for the solution */
+  char     *namein; /*!< Input solution file name */
+  char     *nameout; /*!< Output solution file name */
+} MMG5_Sol;
+typedef MMG5_Sol * MMG5_pSol;
+
+struct MMG5_Mesh;
+struct _MMG5_Bezier;
+struct _MMG3D_octree;
+struct _MMG3D_cavMark;
+
+/**
+ * \struct MMG5_Func
+ * \brief Table of the functions that depend on the type of the metric (or on
+ * the library): they are set by the MMG*_setfunc functions for each mesh, so
+ * different meshes can be remeshed concurrently (internal use only).
+ */
+typedef struct {
+  /* common functions */
+  int    (*chkmsh)(struct MMG5_Mesh*,int,int);
+  int    (*bezierCP)(struct MMG5_Mesh*,MMG5_Tria*,struct _MMG5_Bezier*,char);
+  double (*lenSurfEdg)(struct MMG5_Mesh*,MMG5_pSol,MMG5_int,MMG5_int,char);
+  MMG5_int (*indElt)(struct MMG5_Mesh*,MMG5_int);
+  MMG5_int (*indPt)(struct MMG5_Mesh*,MMG5_int);
+  int    (*renumbering)(int,struct MMG5_Mesh*,MMG5_pSol);
+  int    (*sfcRenumbering)(struct MMG5_Mesh*,MMG5_pSol);
+  double (*caltri)(struct MMG5_Mesh*,MMG5_pSol,MMG5_pTria);
+  int    (*defsiz)(struct MMG5_Mesh*,MMG5_pSol);
+  int    (*gradsiz)(struct MMG5_Mesh*,MMG5_pSol);
+  int    (*intmet)(struct MMG5_Mesh*,MMG5_pSol,MMG5_int,char,MMG5_int,double);
+  /* mmg3d */
+  double (*lenedg)(struct MMG5_Mesh*,MMG5_pSol,int,MMG5_pTetra);
+  double (*lenedgspl)(struct MMG5_Mesh*,MMG5_pSol,int,MMG5_pTetra);
+  double (*caltet)(struct MMG5_Mesh*,MMG5_pSol,MMG5_pTetra);
+  int    (*interp4bar)(struct MMG5_Mesh*,MMG5_pSol,MMG5_int,MMG5_int,double*);
+  int    (*movintpt)(struct MMG5_Mesh*,MMG5_pSol,struct _MMG3D_octree*,MMG5_int*,int,int);
+  int    (*movbdyregpt)(struct MMG5_Mesh*,MMG5_pSol,struct _MMG3D_octree*,MMG5_int*,int,MMG5_int*,int,int,int);
+  int    (*movbdyrefpt)(struct MMG5_Mesh*,MMG5_pSol,struct _MMG3D_octree*,MMG5_int*,int,MMG5_int*,int,int);
+  int    (*movbdynompt)(struct MMG5_Mesh*,MMG5_pSol,struct _MMG3D_octree*,MMG5_int*,int,MMG5_int*,int,int);
+  int    (*movbdyridpt)(struct MMG5_Mesh*,MMG5_pSol,struct _MMG3D_octree*,MMG5_int*,int,MMG5_int*,int,int);
+  int    (*cavity)(struct MMG5_Mesh*,MMG5_pSol,MMG5_int,MMG5_int,MMG5_int*,int,double);
+  int    (*cavityPar)(struct MMG5_Mesh*,MMG5_pSol,struct _MMG3D_cavMark*,MMG5_int,MMG5_int*,int,double);
+  int    (*octreein)(struct MMG5_Mesh*,MMG5_pSol,struct _MMG3D_octree*,MMG5_int,double);
+  /* mmgs */
+  int    (*movsurfintpt)(struct MMG5_Mesh*,MMG5_pSol,MMG5_int*,int);
+  int    (*movridpt)(struct MMG5_Mesh*,MMG5_pSol,MMG5_int*,int);
+  /* mmg2d */
+  double (*lencurv)(struct MMG5_Mesh*,MMG5_pSol,MMG5_int,MMG5_int);
+  int    (*optlen)(struct MMG5_Mesh*,MMG5_pSol,double,int);
+} MMG5_Func;
+
 /**
  * \struct MMG5_Mesh
  * \brief MMG mesh structure.
  * \todo try to remove nc1;
  */
-typedef struct {
+typedef struct MMG5_Mesh {
   long long memMax; /*!< Maximum memory available */
   long long memCur; /*!< Current memory used */
   double    gap; /*!< Gap for table reallocation */
   int       ver; /*!< Version of the mesh file */
   int       dim; /*!< Dimension of the mesh */
   int       type; /*!< Type of the mesh */
-  int       npi,nti,nai,nei,np,na,nt,ne,npmax,namax,ntmax,nemax,xpmax,xtmax;
-  int       nquad,nprism; /* number of quadrangles and prisms */
+  MMG5_int  npi,nti,nai,nei,np,na,nt,ne,npmax,namax,ntmax,nemax,xpmax,xtmax;
+  MMG5_int  nquad,nprism; /* number of quadrangles and prisms */
+  MMG5_int  nqi,npri; /*!< Counters of the MMG3D_Get_quadrilateral and
+                        MMG3D_Get_prism functions */
   int       nsols; /* number of solutions in the solution file (mshmet/int) */
-  int       nc1;
+  MMG5_int  nc1;
 
   int       base; /*!< Used with \a flag to know if an entity has been
                     treated */
   int       mark; /*!< Flag for delaunay (to know if an entity has
                     been treated) */
-  int       xp,xt,xpr; /*!< Number of surfaces points, triangles/tetrahedra and prisms */
-  int       npnil; /*!< Index of first unused point */
-  int       nenil; /*!< Index of first unused element */
-  int       nanil; /*!< Index of first unused edge (2d only)*/
-  int      *adja; /*!< Table of tetrahedron adjacency: if
+  MMG5_int  xp,xt,xpr; /*!< Number of surfaces points, triangles/tetrahedra and prisms */
+  MMG5_int  npnil; /*!< Index of first unused point */
+  MMG5_int  nenil; /*!< Index of first unused element */
+  MMG5_int  nanil; /*!< Index of first unused edge (2d only)*/
+  MMG5_int *adja; /*!< Table of tetrahedron adjacency: if
                     \f$adja[4*(i-1)+1+j]=4*k+l\f$ then the \f$i^{th}\f$ and
                     \f$k^th\f$ tetrahedra are adjacent and share their
                     faces \a j and \a l (resp.) */
-  int      *adjt; /*!< Table of triangles adjacency: if
+  MMG5_int *adjt; /*!< Table of triangles adjacency: if
                     \f$adjt[3*(i-1)+1+j]=3*k+l\f$ then the \f$i^{th}\f$ and
                     \f$k^th\f$ triangles are adjacent and share their
                     edges \a j and \a l (resp.) */
-  int      *adjapr; /*!< Table of prisms adjacency: if
+  MMG5_int *adjapr; /*!< Table of prisms adjacency: if
                     \f$adjapr[5*(i-1)+1+j]=5*k+l\f$ then the \f$i^{th}\f$ and
                     \f$k^th\f$ prism are adjacent and share their
                     faces \a j and \a l (resp.) */
@@ -513,29 +597,19 @@ typedef struct {
   MMG5_pEdge     edge; /*!< Pointer toward the \ref MMG5_Edge structure */
   MMG5_HGeom     htab; /*!< \ref MMG5_HGeom structure */
   MMG5_Info      info; /*!< \ref MMG5_Info structure */
+  MMG5_Func      func; /*!< \ref MMG5_Func structure */
   char     *namein; /*!< Input mesh name */
   char     *nameout; /*!< Output mesh name */
+  struct _MMG3D_Sphere *sph; /*!< Cache of the tetra circumspheres, allocated
+                               only during the Delaunay insertions of mmg3d */
+  MMG5_int  sphmax; /*!< Number of tetra covered by \a sph */
+  struct _MMG3D_Length *ledg; /*!< Cache of the extreme edge lengths of the
+                               tetra, allocated only during the split/collapse
+                               loops of mmg3d */
+  MMG5_int  ledgmax; /*!< Number of tetra covered by \a ledg */
 
 } MMG5_Mesh;
 typedef MMG5_Mesh  * MMG5_pMesh;
 
-/**
- * \struct MMG5_sol
- * \brief MMG Solution structure (for solution or metric).
- */
-typedef struct {
-  int       ver; /* Version of the solution file */
-  int       dim; /* Dimension of the solution file*/
-  int       np; /* Number of points of the solution */
-  int       npmax; /* Maximum number of points */
-  int       npi; /* Temporary number of points (internal use only) */
-  int       size; /* Number of solutions per entity */
-  int       type; /* Type of the solution (scalar, vectorial of tensorial) */
-  double   *m; /*!< Solution values */
-  double    umin,umax; /*!<Min/max values for the solution */
-  char     *namein; /*!< Input solution file name */
-  char     *nameout; /*!< Output solution file name */
-} MMG5_Sol;
-typedef MMG5_Sol * MMG5_pSol;
 
 #endif
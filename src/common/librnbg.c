@@ -23,7 +23,7 @@
 
 /**
  * \file common/librnbg.c
- * \brief Functions for scotch renumerotation.
+ * \brief Functions for scotch and space filling curve renumerotation.
  * \author Cedric Lachat  (Inria/UBordeaux)
  * \author Algiane Froehly  (Inria/UBordeaux)
  * \version 5
@@ -139,6 +139,7 @@ int _MMG5_kPartBoxCompute(SCOTCH_Graph graf, int vertNbr, int boxVertNbr,
 
   return 0;
 }
+#endif
 
 /**
  * \param points pointer toward a table containing the point structures.
@@ -153,10 +154,11 @@ int _MMG5_kPartBoxCompute(SCOTCH_Graph graf, int vertNbr, int boxVertNbr,
  *
  */
 void _MMG5_swapNod(MMG5_pPoint points, double* sols, int* perm,
-                   int ind1, int ind2, int solsiz) {
+                   MMG5_int ind1, int ind2, int solsiz) {
   MMG5_Point ptttmp;
   MMG5_Sol   soltmp;
-  int        tmp,addr2,addr1;
+  int        tmp,addr2;
+  MMG5_int   addr1;
 
   /* swap the points */
   memcpy(&ptttmp      ,&points[ind2],sizeof(MMG5_Point));
@@ -177,28 +179,181 @@ void _MMG5_swapNod(MMG5_pPoint points, double* sols, int* perm,
   perm[ind2] = perm[ind1];
   perm[ind1] = tmp;
 }
-#endif
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param min minimal coordinates of the bounding box of the used points.
+ * \param scale factor to apply to the coordinates relative to \a min to
+ * obtain integer coordinates in \f$[0,2^{\_MMG5\_SFC\_NBIT}[\f$.
+ *
+ * Compute the bounding box used to map the mesh on the Hilbert curve.
+ *
+ */
+void _MMG5_sfcBoundingBox(MMG5_pMesh mesh,double min[3],double *scale) {
+  MMG5_pPoint ppt;
+  double      max[3],dd;
+  int         i;
+  MMG5_int    k;
+
+  for (i=0; i<mesh->dim; i++) {
+    min[i] =  DBL_MAX;
+    max[i] = -DBL_MAX;
+  }
+  for (k=1; k<=mesh->np; k++) {
+    ppt = &mesh->point[k];
+    if ( !MG_VOK(ppt) ) continue;
+    for (i=0; i<mesh->dim; i++) {
+      if ( ppt->c[i] < min[i] ) min[i] = ppt->c[i];
+      if ( ppt->c[i] > max[i] ) max[i] = ppt->c[i];
+    }
+  }
+
+  dd = 0.;
+  for (i=0; i<mesh->dim; i++)
+    dd = MG_MAX(dd,max[i]-min[i]);
+
+  *scale = ( dd > _MMG5_EPSD ) ? (double)((1u<<_MMG5_SFC_NBIT)-1)/dd : 0.;
+}
+
+/**
+ * \param c coordinates of the point.
+ * \param min minimal coordinates of the bounding box.
+ * \param scale scaling factor (see \ref _MMG5_sfcBoundingBox).
+ * \param dim space dimension (2 or 3).
+ * \return the index of the point along the Hilbert curve.
+ *
+ * Compute the Hilbert index of a point (J. Skilling, "Programming the Hilbert
+ * curve", 2004): the integer coordinates are transformed in place then their
+ * bits are interleaved.
+ *
+ */
+uint64_t _MMG5_hilbertKey(double *c,double *min,double scale,int dim) {
+  uint64_t key;
+  uint32_t x[3],m,p,q,t;
+  double   dd;
+  int      i,b;
+
+  m = (1u<<_MMG5_SFC_NBIT)-1;
+  for (i=0; i<dim; i++) {
+    dd   = scale*(c[i]-min[i]);
+    x[i] = ( dd <= 0. ) ? 0 : ( ( dd >= (double)m ) ? m : (uint32_t)dd );
+  }
+
+  /* Inverse undo */
+  m = 1u<<(_MMG5_SFC_NBIT-1);
+  for (q=m; q>1; q>>=1) {
+    p = q-1;
+    for (i=0; i<dim; i++) {
+      if ( x[i] & q ) {
+        x[0] ^= p;
+      }
+      else {
+        t     = (x[0] ^ x[i]) & p;
+        x[0] ^= t;
+        x[i] ^= t;
+      }
+    }
+  }
+
+  /* Gray encode */
+  for (i=1; i<dim; i++)
+    x[i] ^= x[i-1];
+  t = 0;
+  for (q=m; q>1; q>>=1) {
+    if ( x[dim-1] & q ) t ^= q-1;
+  }
+  for (i=0; i<dim; i++)
+    x[i] ^= t;
+
+  /* Interleave the bits of the transposed coordinates */
+  key = 0;
+  for (b=_MMG5_SFC_NBIT-1; b>=0; b--) {
+    for (i=0; i<dim; i++)
+      key = (key << 1) | ((x[i] >> b) & 1);
+  }
+  return(key);
+}
+
+/**
+ * \param a pointer toward a \ref _MMG5_sfcKey structure.
+ * \param b pointer toward a \ref _MMG5_sfcKey structure.
+ * \return -1, 0 or 1 depending on the position of \a a and \a b along the curve.
+ *
+ * Comparison function to sort entities along the Hilbert curve with qsort (the
+ * entity index breaks the ties).
+ *
+ */
+int _MMG5_sfcCompKey(const void *a,const void *b) {
+  const _MMG5_sfcKey *ka,*kb;
+
+  ka = (const _MMG5_sfcKey*)a;
+  kb = (const _MMG5_sfcKey*)b;
+
+  if ( ka->key != kb->key ) return( (ka->key > kb->key) ? 1 : -1 );
+  return( (ka->idx > kb->idx) - (ka->idx < kb->idx) );
+}
+
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \return 1 if success, 0 if fail (lack of memory, the xpoint table is
+ * unchanged).
+ *
+ * Store the xpoints in the order of the points and remove the unused ones.
+ *
+ */
+int _MMG5_sfcPackXPoint(MMG5_pMesh mesh) {
+  MMG5_pPoint  ppt;
+  MMG5_pxPoint xpoint;
+  int          nxp;
+  MMG5_int     k;
+
+  if ( !mesh->xp ) return(1);
+
+  _MMG5_ADD_MEM(mesh,(mesh->xp+1)*sizeof(MMG5_xPoint),"xpoint copy",return(0));
+  _MMG5_SAFE_MALLOC(xpoint,mesh->xp+1,MMG5_xPoint,0);
+
+  nxp = 0;
+  for (k=1; k<=mesh->np; k++) {
+    ppt = &mesh->point[k];
+    if ( !MG_VOK(ppt) || !ppt->xp ) continue;
+    memcpy(&xpoint[++nxp],&mesh->xpoint[ppt->xp],sizeof(MMG5_xPoint));
+    ppt->xp = nxp;
+  }
+  memcpy(&mesh->xpoint[1],&xpoint[1],nxp*sizeof(MMG5_xPoint));
+  memset(&mesh->xpoint[nxp+1],0,(mesh->xp-nxp)*sizeof(MMG5_xPoint));
+
+  _MMG5_DEL_MEM(mesh,xpoint,(mesh->xp+1)*sizeof(MMG5_xPoint));
+  mesh->xp = nxp;
+
+  return(1);
+}
 
 /**
  * \param mesh pointer toward the mesh structure.
  * \param met pointer toward the solution structure.
- * \return 0 if \a _MMG5_renumbering fail (non conformal mesh), 1 otherwise
- * (renumerotation success of renumerotation fail but the mesh is still
- *  conformal).
+ * \return 0 if \a _MMG5_renumbering fail (non conformal mesh), 2 if the
+ * renumbering has been performed, 1 otherwise (no renumbering or renumbering
+ * fail but the mesh is still conformal).
  *
- * Call scotch renumbering.
+ * Renumber the mesh entities: with scotch if \a mesh->info.renum is 1 (and
+ * scotch is available), along the Hilbert curve if it is 2.
  *
  **/
 int _MMG5_scotchCall(MMG5_pMesh mesh, MMG5_pSol met)
 {
-
+  static _MMG5_TLS char mmgError = 0;
+  int                   ier;
 #ifdef USE_SCOTCH
-  static char mmgWarn  = 0;
-  static char mmgError = 0;
+  static _MMG5_TLS char mmgWarn  = 0;
+#endif
 
   /*check enough vertex to renum*/
-  if ( mesh->info.renum && (mesh->np/2. > _MMG5_BOXSIZE) && mesh->np>100000 ) {
+  if ( !mesh->info.renum || (mesh->np/2. <= _MMG5_BOXSIZE) || mesh->np<=100000 )
+    return(1);
 
+#ifdef USE_SCOTCH
+  if ( mesh->info.renum == 1 ) {
     if ( (SCOTCH_5 && SCOTCH_6 ) || ( (!SCOTCH_5) && (!SCOTCH_6) ) ) {
       if ( !mmgWarn ) {
         fprintf(stderr,"\n  ## Warning: %s: fail to determine scotch version."
@@ -212,28 +367,38 @@ int _MMG5_scotchCall(MMG5_pMesh mesh, MMG5_pSol met)
     if ( mesh->info.imprim > 5 )
       fprintf(stdout,"  -- RENUMBERING. \n");
 
-    if ( !_MMG5_renumbering(_MMG5_BOXSIZE,mesh, met) ) {
-      if ( !mmgError ) {
-        fprintf(stderr,"\n  ## Error: %s: Unable to renumbering mesh. "
-                "Try to run without renumbering option (-rn 0).\n",
-                __func__);
-        mmgError = 1;
-      }
-      return(0);
-    }
+    ier = mesh->func.renumbering(_MMG5_BOXSIZE,mesh, met);
+  }
+  else
+#endif
+  {
+    if ( mesh->info.renum != 2 || !mesh->func.sfcRenumbering ) return(1);
 
-    if ( mesh->info.imprim > 5) {
-      fprintf(stdout,"  -- PHASE RENUMBERING COMPLETED. \n");
-    }
+    if ( mesh->info.imprim > 5 )
+      fprintf(stdout,"  -- RENUMBERING (HILBERT CURVE). \n");
+
+    ier = mesh->func.sfcRenumbering(mesh,met);
+  }
 
-    if ( mesh->info.ddebug ) {
-      if ( !_MMG5_chkmsh(mesh,1,0) )
-        return 0;
+  if ( !ier ) {
+    if ( !mmgError ) {
+      fprintf(stderr,"\n  ## Error: %s: Unable to renumbering mesh. "
+              "Try to run without renumbering option (-rn 0).\n",
+              __func__);
+      mmgError = 1;
     }
-    /* renumbering end */
+    return(0);
   }
-  return(1);
-#else
-  return(1);
-#endif
+
+  if ( mesh->info.imprim > 5) {
+    fprintf(stdout,"  -- PHASE RENUMBERING COMPLETED. \n");
+  }
+
+  if ( mesh->info.ddebug ) {
+    if ( !mesh->func.chkmsh(mesh,1,0) )
+      return 0;
+  }
+  /* renumbering end */
+
+  return(2);
 }
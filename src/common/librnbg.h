@@ -55,7 +55,6 @@ typedef struct MeshGraphHash_ {
 
 int    _SCOTCHintSort2asc1(SCOTCH_Num * sortPartTb, int vertNbr);
 int    _MMG5_kPartBoxCompute(SCOTCH_Graph, int, int, SCOTCH_Num*,MMG5_pMesh);
-void   _MMG5_swapNod(MMG5_pPoint, double*, int*, int, int, int);
 
 #endif /* __RENUM__ */
 #endif
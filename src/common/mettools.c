@@ -118,7 +118,7 @@ int _MMG5_intmetsavedir(MMG5_pMesh mesh, double *m,double *n,double *mr) {
  * are to be held.
  *
  */
-int _MMG5_buildridmet(MMG5_pMesh mesh,MMG5_pSol met,int np0,
+int _MMG5_buildridmet(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int np0,
                       double ux,double uy,double uz,double mr[6]) {
   MMG5_pPoint  p0;
   MMG5_pxPoint go;
@@ -176,7 +176,7 @@ int _MMG5_buildridmet(MMG5_pMesh mesh,MMG5_pSol met,int np0,
  * given by \a nt.
  *
  */
-int _MMG5_buildridmetnor(MMG5_pMesh mesh,MMG5_pSol met,int np0,double nt[3],double mr[6]) {
+int _MMG5_buildridmetnor(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int np0,double nt[3],double mr[6]) {
   MMG5_pPoint  p0;
   MMG5_pxPoint go;
   double       ps1,ps2,*n1,*n2,*t,*m,dv,dn,u[3],r[3][3];
@@ -237,7 +237,7 @@ int _MMG5_buildridmetnor(MMG5_pMesh mesh,MMG5_pSol met,int np0,double nt[3],doub
 int _MMG5_intersecmet22(MMG5_pMesh mesh, double *m,double *n,double *mr) {
   double  det,imn[4],dd,sqDelta,trimn,lambda[2],vp0[2],vp1[2],dm[2],dn[2],vnorm,d0,d1,ip[4];
   double  isqhmin,isqhmax;
-  static char mmgWarn = 0, mmgWarn1 = 0;
+  static _MMG5_TLS char mmgWarn = 0, mmgWarn1 = 0;
 
   isqhmin  = 1.0 / (mesh->info.hmin*mesh->info.hmin);
   isqhmax  = 1.0 / (mesh->info.hmax*mesh->info.hmax);
@@ -423,7 +423,7 @@ int _MMG5_intersecmet22(MMG5_pMesh mesh, double *m,double *n,double *mr) {
  * specific sizes in the \f$n_1\f$ and \f$n_2\f$ directions.
  *
  */
-int _MMG5_mmgIntextmet(MMG5_pMesh mesh,MMG5_pSol met,int np,double me[6],
+int _MMG5_mmgIntextmet(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int np,double me[6],
                        double n[3]) {
   MMG5_pPoint         p0;
   MMG5_pxPoint        go;
@@ -432,7 +432,7 @@ int _MMG5_mmgIntextmet(MMG5_pMesh mesh,MMG5_pSol met,int np,double me[6],
   double              *m,*n1,*n2,*t,r[3][3],mrot[6],mr[3],mtan[3],metan[3];
   int                 order;
   char                i;
-  static char         mmgWarn=0, mmgWarn1=0, mmgWarn2=0;
+  static _MMG5_TLS char         mmgWarn=0, mmgWarn1=0, mmgWarn2=0;
 
   isqhmin = 1.0 / (mesh->info.hmin*mesh->info.hmin);
   isqhmax = 1.0 / (mesh->info.hmax*mesh->info.hmax);
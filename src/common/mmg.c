@@ -123,7 +123,8 @@ void _MMG5_mmgDefaultValues(MMG5_pMesh mesh) {
  */
 inline
 int _MMG5_countLocalParamAtTri( MMG5_pMesh mesh,_MMG5_iNode **bdryRefs) {
-  int         npar,k,ier;
+  int         npar,ier;
+  MMG5_int    k;
 
   /** Count the number of different boundary references and list it */
   (*bdryRefs) = NULL;
@@ -131,7 +132,7 @@ int _MMG5_countLocalParamAtTri( MMG5_pMesh mesh,_MMG5_iNode **bdryRefs) {
   k = mesh->nt? mesh->tria[1].ref : 0;
 
   /* Try to alloc the first node */
-  ier = _MMG5_Add_inode( mesh, bdryRefs, k );
+  ier = _MMG5_Add_inode( mesh, bdryRefs, (int)k );
   if ( ier < 0 ) {
     fprintf(stderr,"\n  ## Error: %s: unable to allocate the first boundary"
            " reference node.\n",__func__);
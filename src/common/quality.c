@@ -47,7 +47,7 @@
 double _MMG5_caltri33_ani(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTria pt) {
   double   anisurf,dd,abx,aby,abz,acx,acy,acz,bcx,bcy,bcz;
   double  *a,*b,*c,*ma,*mb,*mc,m[6],l0,l1,l2,rap;
-  int      ia,ib,ic;
+  MMG5_int ia,ib,ic;
   char     i;
 
   ia = pt->v[0];
@@ -116,7 +116,8 @@ inline double _MMG5_caltri_ani(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTria ptt) {
   MMG5_pPoint   p[3];
   double        rap,anisurf,l0,l1,l2,m[6],mm[6];
   double        abx,aby,abz,acx,acy,acz,bcy,bcx,bcz;
-  int           np[3],i,j;
+  int           i,j;
+  MMG5_int      np[3];
   char          i1,i2;
 
   for (i=0; i<3; i++) {
@@ -245,10 +246,10 @@ inline double _MMG5_caltri_iso(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTria ptt) {
  * Display histogram of edge length.
  *
  */
-void _MMG5_displayHisto(MMG5_pMesh mesh, int ned, double *avlen,
-                        int amin, int bmin, double lmin,
-                        int amax, int bmax, double lmax,
-                        int nullEdge,double *bd, int *hl,char shift)
+void _MMG5_displayHisto(MMG5_pMesh mesh, MMG5_int ned, double *avlen,
+                        MMG5_int amin, MMG5_int bmin, double lmin,
+                        MMG5_int amax, MMG5_int bmax, double lmax,
+                        MMG5_int nullEdge,double *bd, MMG5_int *hl,char shift)
 {
   double dned;
   int    k;
@@ -256,16 +257,16 @@ void _MMG5_displayHisto(MMG5_pMesh mesh, int ned, double *avlen,
   dned     = (double)ned;
   (*avlen) = (*avlen) / dned;
 
-  fprintf(stdout,"\n  -- RESULTING EDGE LENGTHS  %d\n",ned);
+  fprintf(stdout,"\n  -- RESULTING EDGE LENGTHS  %" MMG5_PRId "\n",ned);
   fprintf(stdout,"     AVERAGE LENGTH         %12.4f\n",(*avlen));
-  fprintf(stdout,"     SMALLEST EDGE LENGTH   %12.4f   %6d %6d\n",
+  fprintf(stdout,"     SMALLEST EDGE LENGTH   %12.4f   %6" MMG5_PRId " %6" MMG5_PRId "\n",
           lmin,amin,bmin);
-  fprintf(stdout,"     LARGEST  EDGE LENGTH   %12.4f   %6d %6d \n",
+  fprintf(stdout,"     LARGEST  EDGE LENGTH   %12.4f   %6" MMG5_PRId " %6" MMG5_PRId " \n",
           lmax,amax,bmax);
   if ( abs(mesh->info.imprim) < 3 ) return;
 
   if ( hl[2+shift]+hl[3+shift]+hl[4+shift] )
-    fprintf(stdout,"   %6.2f < L <%5.2f  %8d   %5.2f %%  \n",
+    fprintf(stdout,"   %6.2f < L <%5.2f  %8" MMG5_PRId "   %5.2f %%  \n",
             bd[2+shift],bd[5+shift],hl[2+shift]+hl[3+shift]+hl[4+shift],
             100.*(hl[2+shift]+hl[3+shift]+hl[4+shift])/(double)ned);
 
@@ -274,20 +275,20 @@ void _MMG5_displayHisto(MMG5_pMesh mesh, int ned, double *avlen,
   if ( abs(mesh->info.imprim) > 3 ) {
     fprintf(stdout,"\n     HISTOGRAMM:\n");
     if ( hl[0] )
-      fprintf(stdout,"     0.00 < L < 0.30  %8d   %5.2f %%  \n",
+      fprintf(stdout,"     0.00 < L < 0.30  %8" MMG5_PRId "   %5.2f %%  \n",
               hl[0],100.*(hl[0]/(float)ned));
     if ( lmax > 0.2 ) {
       for (k=2; k<9; k++) {
         if ( hl[k-1] > 0 )
-          fprintf(stdout,"   %6.2f < L <%5.2f  %8d   %5.2f %%  \n",
+          fprintf(stdout,"   %6.2f < L <%5.2f  %8" MMG5_PRId "   %5.2f %%  \n",
                   bd[k-1],bd[k],hl[k-1],100.*(hl[k-1]/(float)ned));
       }
       if ( hl[8] )
-        fprintf(stdout,"     5.   < L         %8d   %5.2f %%  \n",
+        fprintf(stdout,"     5.   < L         %8" MMG5_PRId "   %5.2f %%  \n",
                 hl[8],100.*(hl[8]/(float)ned));
     }
     if ( nullEdge )
-      fprintf(stdout,"\n     WARNING: unable to compute the length of %d"
+      fprintf(stdout,"\n     WARNING: unable to compute the length of %" MMG5_PRId
               " edges\n",nullEdge);
   }
 }
@@ -303,7 +304,7 @@ void _MMG5_displayHisto(MMG5_pMesh mesh, int ned, double *avlen,
  * of the mesh.
  *
  */
-int _MMG5_minQualCheck ( int iel, double minqual, double alpha )
+int _MMG5_minQualCheck ( MMG5_int iel, double minqual, double alpha )
 {
   double minqualOnAlpha;
 
@@ -311,13 +312,114 @@ int _MMG5_minQualCheck ( int iel, double minqual, double alpha )
 
   if ( minqualOnAlpha < _MMG5_NULKAL ) {
     fprintf(stderr,"\n  ## Error: %s: too bad quality for the worst element: "
-            "(elt %d -> %15e)\n",__func__,iel,minqual);
+            "(elt %" MMG5_PRId " -> %15e)\n",__func__,iel,minqual);
     return(0);
   }
   else if ( minqualOnAlpha < _MMG5_EPSOK ) {
     fprintf(stderr,"\n  ## Warning: %s: very bad quality for the worst element: "
-            "(elt %d -> %15e)\n",__func__,iel,minqual);
+            "(elt %" MMG5_PRId " -> %15e)\n",__func__,iel,minqual);
   }
 
   return(1);
 }
+
+/**
+ * \param st pointer toward the statistics of the \a nth ranges of elements.
+ * \param nth number of ranges.
+ * \param rapmin initial value of the worst quality.
+ * \param rapmax initial value of the best quality.
+ *
+ * Initialize the quality statistics of \a nth ranges of elements.
+ *
+ */
+void _MMG5_initQuaStat(_MMG5_quaStat *st,int nth,double rapmin,double rapmax) {
+  int t;
+
+  memset(st,0,nth*sizeof(_MMG5_quaStat));
+  for (t=0; t<nth; t++) {
+    st[t].rapmin = rapmin;
+    st[t].rapmax = rapmax;
+  }
+}
+
+/**
+ * \param st pointer toward the statistics of the \a nth ranges of elements,
+ * stored in the order of the ranges.
+ * \param nth number of ranges.
+ * \param les 1 if the worst quality is the highest one (LES qualities), 0 if
+ * it is the lowest one.
+ *
+ * Merge the quality statistics of consecutive ranges of elements in \a
+ * st[0]. The worst element is the first one of the worst quality, as for a
+ * sequential sweep: its index among the counted elements of its range is
+ * shifted by the number of counted elements of the previous ranges.
+ *
+ */
+void _MMG5_mergeQuaStat(_MMG5_quaStat *st,int nth,char les) {
+  int t,i;
+
+  for (t=1; t<nth; t++) {
+    if ( les ? st[t].rapmin > st[0].rapmin : st[t].rapmin < st[0].rapmin ) {
+      st[0].rapmin = st[t].rapmin;
+      st[0].iel    = st[0].ok + st[t].iel;
+    }
+    st[0].rapmax = les ? MG_MIN(st[0].rapmax,st[t].rapmax) :
+      MG_MAX(st[0].rapmax,st[t].rapmax);
+    st[0].rapavg += st[t].rapavg;
+    st[0].med    += st[t].med;
+    st[0].good   += st[t].good;
+    st[0].ok     += st[t].ok;
+    st[0].nex    += st[t].nex;
+    st[0].nrid   += st[t].nrid;
+    for (i=0; i<5; i++)  st[0].his[i] += st[t].his[i];
+    st[0].badkal |= st[t].badkal;
+    st[0].neg    |= st[t].neg;
+  }
+}
+
+/**
+ * \param st pointer toward the statistics of the \a nth ranges of edges.
+ * \param nth number of ranges.
+ * \param lmin initial value of the smallest length.
+ *
+ * Initialize the length statistics of \a nth ranges of edges.
+ *
+ */
+void _MMG5_initLenStat(_MMG5_lenStat *st,int nth,double lmin) {
+  int t;
+
+  memset(st,0,nth*sizeof(_MMG5_lenStat));
+  for (t=0; t<nth; t++)
+    st[t].lmin = lmin;
+}
+
+/**
+ * \param st pointer toward the statistics of the \a nth ranges of edges,
+ * stored in the order of the ranges.
+ * \param nth number of ranges.
+ *
+ * Merge the length statistics of consecutive ranges of edges in \a st[0]
+ * (the smallest and largest edges are the first ones found by a sequential
+ * sweep).
+ *
+ */
+void _MMG5_mergeLenStat(_MMG5_lenStat *st,int nth) {
+  int t,i;
+
+  for (t=1; t<nth; t++) {
+    if ( st[t].lmin < st[0].lmin ) {
+      st[0].lmin = st[t].lmin;
+      st[0].amin = st[t].amin;
+      st[0].bmin = st[t].bmin;
+    }
+    if ( st[t].lmax > st[0].lmax ) {
+      st[0].lmax = st[t].lmax;
+      st[0].amax = st[t].amax;
+      st[0].bmax = st[t].bmax;
+    }
+    st[0].avlen    += st[t].avlen;
+    st[0].ned      += st[t].ned;
+    st[0].nullEdge += st[t].nullEdge;
+    for (i=0; i<9; i++)  st[0].hl[i] += st[t].hl[i];
+  }
+}
@@ -44,7 +44,8 @@
  */
 int _MMG5_boundingBox(MMG5_pMesh mesh) {
   MMG5_pPoint    ppt;
-  int            k,i;
+  int            i;
+  MMG5_int       k;
   double         dd;
 
   /* compute bounding box */
@@ -89,7 +90,8 @@ int _MMG5_boundingBox(MMG5_pMesh mesh) {
 int _MMG5_scaleMesh(MMG5_pMesh mesh,MMG5_pSol met) {
   MMG5_pPoint    ppt;
   double         dd,d1;
-  int            k,i,sethmin,sethmax;
+  int            i,sethmin,sethmax;
+  MMG5_int       k;
   MMG5_pPar      par;
   double         *m;
   double         lambda[3],v[3][3];
@@ -160,7 +162,7 @@ int _MMG5_scaleMesh(MMG5_pMesh mesh,MMG5_pSol met) {
         /* Check the metric */
         if ( (!mesh->info.iso) && met->m[k] <= 0) {
           fprintf(stderr,"\n  ## Error: %s: at least 1 wrong metric"
-                  " (point %d).\n",__func__,k);
+                  " (point %" MMG5_PRId ").\n",__func__,k);
           return(0);
         }
       }
@@ -210,13 +212,13 @@ int _MMG5_scaleMesh(MMG5_pMesh mesh,MMG5_pSol met) {
         /* Check the input metric */
         if ( !_MMG5_eigenv(1,m,lambda,v) ) {
           fprintf(stderr,"\n  ## Error: %s: unable to diagonalize at least"
-                  " 1 metric (point %d).\n",__func__,k);
+                  " 1 metric (point %" MMG5_PRId ").\n",__func__,k);
           return(0);
         }
         for (i=0; i<3; i++) {
           if(lambda[i]<=0) {
             fprintf(stderr,"\n  ## Error: %s: at least 1 wrong metric "
-                    "(point %d -> eigenvalues : %e %e %e).\n"
+                    "(point %" MMG5_PRId " -> eigenvalues : %e %e %e).\n"
                     "            metric tensor: %e %e %e %e %e %e.\n",
                     __func__,k,lambda[0],lambda[1],lambda[2],
                               m[0],m[1],m[2],m[3],m[4],m[5]);
@@ -261,7 +263,8 @@ int _MMG5_scaleMesh(MMG5_pMesh mesh,MMG5_pSol met) {
 int _MMG5_unscaleMesh(MMG5_pMesh mesh,MMG5_pSol met) {
   MMG5_pPoint     ppt;
   double          dd;
-  int             k,i;
+  int             i;
+  MMG5_int        k;
   MMG5_pPar       par;
 
   /* de-normalize coordinates */
@@ -71,7 +71,7 @@ int _MMG5_devangle(double* n1, double *n2, double crit)
  *
  */
 inline int _MMG5_nonUnitNorPts(MMG5_pMesh mesh,
-                                int ip1,int ip2, int ip3,double *n) {
+                                MMG5_int ip1,MMG5_int ip2, MMG5_int ip3,double *n) {
   MMG5_pPoint   p1,p2,p3;
   double        abx,aby,abz,acx,acy,acz;
 
@@ -105,7 +105,7 @@ inline int _MMG5_nonUnitNorPts(MMG5_pMesh mesh,
  */
 inline double _MMG5_nonorsurf(MMG5_pMesh mesh,MMG5_pTria pt) {
   double   n[3];
-  int      ip1, ip2, ip3;
+  MMG5_int ip1,ip2,ip3;
 
   ip1 = pt->v[0];
   ip2 = pt->v[1];
@@ -126,7 +126,7 @@ inline double _MMG5_nonorsurf(MMG5_pMesh mesh,MMG5_pTria pt) {
  * Compute normalized face normal given three points on the surface.
  *
  */
-inline int _MMG5_norpts(MMG5_pMesh mesh,int ip1,int ip2, int ip3,double *n) {
+inline int _MMG5_norpts(MMG5_pMesh mesh,MMG5_int ip1,MMG5_int ip2, MMG5_int ip3,double *n) {
   double   dd,det;
 
   _MMG5_nonUnitNorPts(mesh,ip1,ip2,ip3,n);
@@ -390,15 +390,15 @@ inline int _MMG5_sys33sym(double a[6], double b[3], double r[3]){
  */
 void _MMG5_printTria(MMG5_pMesh mesh,char* fileName) {
   MMG5_pTria ptt;
-  int   k;
+  MMG5_int k;
   FILE  *inm;
 
   inm = fopen(fileName,"w");
 
-  fprintf(inm,"----------> %d TRIANGLES <----------\n",mesh->nt);
+  fprintf(inm,"----------> %" MMG5_PRId " TRIANGLES <----------\n",mesh->nt);
   for(k=1; k<=mesh->nt; k++) {
     ptt = &mesh->tria[k];
-    fprintf(inm,"num %d -> %d %d %d\n",k,ptt->v[0],ptt->v[1],
+    fprintf(inm,"num %" MMG5_PRId " -> %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId "\n",k,ptt->v[0],ptt->v[1],
             ptt->v[2]);
     fprintf(inm,"ref   -> %d\n",ptt->ref);
     fprintf(inm,"tag   -> %d %d %d\n",ptt->tag[0],ptt->tag[1],ptt->tag[2]);
@@ -674,7 +674,7 @@ inline double _MMG5_det4pt(double c0[3],double c1[3],double c2[3],double c3[3])
  * Compute oriented volume of a tetrahedron
  *
  */
-inline double _MMG5_orvol(MMG5_pPoint point,int *v) {
+inline double _MMG5_orvol(MMG5_pPoint point,MMG5_int *v) {
     MMG5_pPoint  p0,p1,p2,p3;
 
     p0 = &point[v[0]];
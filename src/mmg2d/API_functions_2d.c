@@ -168,6 +168,23 @@ int MMG2D_Set_iparameter(MMG5_pMesh mesh, MMG5_pSol sol, int iparam, int val){
   case MMG2D_IPARAM_nosurf :
     mesh->info.nosurf   = val;
     break;
+  case MMG2D_IPARAM_nthreads :
+    if ( val <= 0 ) {
+      fprintf(stderr,"\n  ## Warning: %s: number of threads must be"
+              " strictly positive.\n",__func__);
+      fprintf(stderr,"  Reset to default value.\n");
+      mesh->info.nthreads = 1;
+    }
+#ifndef _OPENMP
+    else if ( val > 1 ) {
+      fprintf(stderr,"\n  ## Warning: %s: mmg compiled without OpenMP:"
+              " number of threads ignored.\n",__func__);
+      mesh->info.nthreads = 1;
+    }
+#endif
+    else
+      mesh->info.nthreads = val;
+    break;
   default :
     fprintf(stderr,"\n  ## Error: %s: unknown type of parameter\n",__func__);
     return(0);
@@ -220,8 +237,8 @@ int MMG2D_Set_dparameter(MMG5_pMesh mesh, MMG5_pSol sol, int dparam, double val)
   return(1);
 }
 
-int MMG2D_Set_meshSize(MMG5_pMesh mesh, int np, int nt, int na) {
-  int k;
+int MMG2D_Set_meshSize(MMG5_pMesh mesh, MMG5_int np, MMG5_int nt, MMG5_int na) {
+  MMG5_int k;
 
   if ( ( (mesh->info.imprim > 5) || mesh->info.ddebug ) &&
        ( mesh->point || mesh->tria || mesh->edge) )
@@ -288,17 +305,17 @@ int MMG2D_Set_meshSize(MMG5_pMesh mesh, int np, int nt, int na) {
 
   /* stats */
   if ( abs(mesh->info.imprim) > 6 ) {
-    fprintf(stdout,"     NUMBER OF VERTICES     %8d\n",mesh->np);
+    fprintf(stdout,"     NUMBER OF VERTICES     %8" MMG5_PRId "\n",mesh->np);
     if ( mesh->na ) {
-      fprintf(stdout,"     NUMBER OF EDGES        %8d\n",mesh->na);
+      fprintf(stdout,"     NUMBER OF EDGES        %8" MMG5_PRId "\n",mesh->na);
     }
     if ( mesh->nt )
-      fprintf(stdout,"     NUMBER OF TRIANGLES    %8d\n",mesh->nt);
+      fprintf(stdout,"     NUMBER OF TRIANGLES    %8" MMG5_PRId "\n",mesh->nt);
   }
   return(1);
 }
 
-int MMG2D_Set_solSize(MMG5_pMesh mesh, MMG5_pSol sol, int typEntity, int np, int typSol) {
+int MMG2D_Set_solSize(MMG5_pMesh mesh, MMG5_pSol sol, int typEntity, MMG5_int np, int typSol) {
 
   if ( ( (mesh->info.imprim > 5) || mesh->info.ddebug ) && sol->m )
     fprintf(stderr,"\n  ## Warning: %s: old solution deletion.\n",__func__);
@@ -342,7 +359,7 @@ int MMG2D_Set_solSize(MMG5_pMesh mesh, MMG5_pSol sol, int typEntity, int np, int
   return(1);
 }
 
-int MMG2D_Get_solSize(MMG5_pMesh mesh, MMG5_pSol sol, int* typEntity, int* np,
+int MMG2D_Get_solSize(MMG5_pMesh mesh, MMG5_pSol sol, int* typEntity, MMG5_int* np,
                       int* typSol) {
 
   if ( typEntity != NULL )
@@ -367,8 +384,8 @@ int MMG2D_Get_solSize(MMG5_pMesh mesh, MMG5_pSol sol, int* typEntity, int* np,
   return(1);
 }
 
-int MMG2D_Get_meshSize(MMG5_pMesh mesh, int* np, int* nt, int* na) {
-  int k;
+int MMG2D_Get_meshSize(MMG5_pMesh mesh, MMG5_int* np, MMG5_int* nt, MMG5_int* na) {
+  MMG5_int k;
 
   if ( np != NULL )
     *np = mesh->np;
@@ -388,7 +405,7 @@ int MMG2D_Get_meshSize(MMG5_pMesh mesh, int* np, int* nt, int* na) {
   return(1);
 }
 
-int MMG2D_Set_vertex(MMG5_pMesh mesh, double c0, double c1, int ref, int pos) {
+int MMG2D_Set_vertex(MMG5_pMesh mesh, double c0, double c1, int ref, MMG5_int pos) {
 
   if ( !mesh->np ) {
     fprintf(stderr,"\n  ## Error: %s: you must set the number of points with the",
@@ -400,15 +417,15 @@ int MMG2D_Set_vertex(MMG5_pMesh mesh, double c0, double c1, int ref, int pos) {
   if ( pos > mesh->npmax ) {
     fprintf(stderr,"\n  ## Error: %s: unable to allocate a new point.\n",
             __func__);
-    fprintf(stderr,"    max number of points: %d\n",mesh->npmax);
+    fprintf(stderr,"    max number of points: %" MMG5_PRId "\n",mesh->npmax);
     _MMG5_INCREASE_MEM_MESSAGE();
     return(0);
   }
 
   if ( pos > mesh->np ) {
-    fprintf(stderr,"\n  ## Error: %s: attempt to set new vertex at position %d.",
+    fprintf(stderr,"\n  ## Error: %s: attempt to set new vertex at position %" MMG5_PRId ".",
             __func__,pos);
-    fprintf(stderr," Overflow of the given number of vertices: %d\n",mesh->np);
+    fprintf(stderr," Overflow of the given number of vertices: %" MMG5_PRId "\n",mesh->np);
     fprintf(stderr,"  ## Check the mesh size, its compactness or the position");
     fprintf(stderr," of the vertex.\n");
     return(0);
@@ -428,13 +445,13 @@ int MMG2D_Set_vertex(MMG5_pMesh mesh, double c0, double c1, int ref, int pos) {
   return(1);
 }
 
-int MMG2D_Set_corner(MMG5_pMesh mesh, int k) {
+int MMG2D_Set_corner(MMG5_pMesh mesh, MMG5_int k) {
   assert ( k <= mesh->np );
   mesh->point[k].tag |= MG_CRN;
   return(1);
 }
 
-int MMG2D_Set_requiredVertex(MMG5_pMesh mesh, int k) {
+int MMG2D_Set_requiredVertex(MMG5_pMesh mesh, MMG5_int k) {
   assert ( k <= mesh->np );
   mesh->point[k].tag |= MG_REQ;
   return(1);
@@ -451,7 +468,7 @@ int MMG2D_Get_vertex(MMG5_pMesh mesh, double* c0, double* c1, int* ref,
     fprintf(stderr,"     You must pass here exactly one time (the first time ");
     fprintf(stderr,"you call the MMG2D_Get_vertex function).\n");
     fprintf(stderr,"     If not, the number of call of this function");
-    fprintf(stderr," exceed the number of points: %d\n ",mesh->np);
+    fprintf(stderr," exceed the number of points: %" MMG5_PRId "\n ",mesh->np);
    }
  }
 
@@ -460,7 +477,7 @@ int MMG2D_Get_vertex(MMG5_pMesh mesh, double* c0, double* c1, int* ref,
   if ( mesh->npi > mesh->np ) {
     fprintf(stderr,"  ## Error: %s: unable to get point.\n",__func__);
     fprintf(stderr,"     The number of call of MMG2D_Get_vertex function");
-    fprintf(stderr," exceed the number of points: %d\n ",mesh->np);
+    fprintf(stderr," exceed the number of points: %" MMG5_PRId "\n ",mesh->np);
     return(0);
   }
 
@@ -488,7 +505,7 @@ int MMG2D_Get_vertex(MMG5_pMesh mesh, double* c0, double* c1, int* ref,
 
 int  MMG2D_Set_vertices(MMG5_pMesh mesh, double *vertices,int *refs) {
   MMG5_pPoint ppt;
-  int i,j;
+  MMG5_int i,j;
 
   /*coordinates vertices*/
   for (i=1;i<=mesh->np;i++)
@@ -517,7 +534,7 @@ int  MMG2D_Set_vertices(MMG5_pMesh mesh, double *vertices,int *refs) {
 int  MMG2D_Get_vertices(MMG5_pMesh mesh, double* vertices, int* refs,
                         int* areCorners, int* areRequired) {
   MMG5_pPoint ppt;
-  int i,j;
+  MMG5_int i,j;
 
   for (i=1;i<=mesh->np;i++)
   {
@@ -549,11 +566,12 @@ int  MMG2D_Get_vertices(MMG5_pMesh mesh, double* vertices, int* refs,
   return 1;
 }
 
-int MMG2D_Set_triangle(MMG5_pMesh mesh, int v0, int v1, int v2, int ref, int pos) {
+int MMG2D_Set_triangle(MMG5_pMesh mesh, MMG5_int v0, MMG5_int v1, MMG5_int v2, int ref, MMG5_int pos) {
   MMG5_pPoint ppt;
   MMG5_pTria  pt;
   double      vol;
-  int         i,j,ip,tmp;
+  int         i,j,ip;
+  MMG5_int    tmp;
 
   if ( !mesh->nt ) {
     fprintf(stderr,"  ## Error: %s: You must set the number of elements with the",
@@ -565,15 +583,15 @@ int MMG2D_Set_triangle(MMG5_pMesh mesh, int v0, int v1, int v2, int ref, int pos
   if ( pos > mesh->ntmax ) {
     fprintf(stderr,"  ## Error: %s: unable to allocate a new element.\n",
             __func__);
-    fprintf(stderr,"    max number of element: %d\n",mesh->ntmax);
+    fprintf(stderr,"    max number of element: %" MMG5_PRId "\n",mesh->ntmax);
     _MMG5_INCREASE_MEM_MESSAGE();
     return(0);
   }
 
   if ( pos > mesh->nt ) {
-    fprintf(stderr,"\n  ## Error: %s: attempt to set new triangle at position %d.",
+    fprintf(stderr,"\n  ## Error: %s: attempt to set new triangle at position %" MMG5_PRId ".",
             __func__,pos);
-    fprintf(stderr," Overflow of the given number of triangle: %d\n",mesh->nt);
+    fprintf(stderr," Overflow of the given number of triangle: %" MMG5_PRId "\n",mesh->nt);
     fprintf(stderr,"  ## Check the mesh size, its compactness or the position");
     fprintf(stderr," of the triangle.\n");
     return(0);
@@ -596,7 +614,7 @@ int MMG2D_Set_triangle(MMG5_pMesh mesh, int v0, int v1, int v2, int ref, int pos
                            mesh->point[pt->v[2]].c);
 
   if ( vol == 0.0 ) {
-    fprintf(stderr,"\n  ## Error: %s: triangle %d has null area.\n",
+    fprintf(stderr,"\n  ## Error: %s: triangle %" MMG5_PRId " has null area.\n",
             __func__,pos);
     for ( ip=0; ip<3; ip++ ) {
       ppt = &mesh->point[pt->v[ip]];
@@ -616,7 +634,7 @@ int MMG2D_Set_triangle(MMG5_pMesh mesh, int v0, int v1, int v2, int ref, int pos
     mesh->xt++;
   }
   if ( mesh->info.ddebug && (mesh->nt == pos) && mesh->xt > 0 ) {
-    fprintf(stderr,"\n  ## Warning: %s: %d triangles reoriented\n",
+    fprintf(stderr,"\n  ## Warning: %s: %" MMG5_PRId " triangles reoriented\n",
             __func__,mesh->xt);
     mesh->xt = 0;
   }
@@ -624,7 +642,7 @@ int MMG2D_Set_triangle(MMG5_pMesh mesh, int v0, int v1, int v2, int ref, int pos
   return(1);
 }
 
-int MMG2D_Set_requiredTriangle(MMG5_pMesh mesh, int k) {
+int MMG2D_Set_requiredTriangle(MMG5_pMesh mesh, MMG5_int k) {
   MMG5_pTria pt;
   int        i;
 
@@ -641,7 +659,7 @@ int MMG2D_Set_requiredTriangle(MMG5_pMesh mesh, int k) {
   return(1);
 }
 
-int MMG2D_Get_triangle(MMG5_pMesh mesh, int* v0, int* v1, int* v2, int* ref
+int MMG2D_Get_triangle(MMG5_pMesh mesh, MMG5_int* v0, MMG5_int* v1, MMG5_int* v2, int* ref
                        ,int* isRequired) {
   MMG5_pTria  ptt;
 
@@ -653,7 +671,7 @@ int MMG2D_Get_triangle(MMG5_pMesh mesh, int* v0, int* v1, int* v2, int* ref
       fprintf(stderr,"     You must pass here exactly one time (the first time ");
       fprintf(stderr,"you call the MMG2D_Get_triangle function).\n");
       fprintf(stderr,"     If not, the number of call of this function");
-      fprintf(stderr," exceed the number of triangles: %d\n ",mesh->nt);
+      fprintf(stderr," exceed the number of triangles: %" MMG5_PRId "\n ",mesh->nt);
     }
   }
 
@@ -663,7 +681,7 @@ int MMG2D_Get_triangle(MMG5_pMesh mesh, int* v0, int* v1, int* v2, int* ref
     fprintf(stderr,"\n  ## Error: %s: unable to get triangle.\n",
             __func__);
     fprintf(stderr,"    The number of call of MMG2D_Get_triangle function");
-    fprintf(stderr," can not exceed the number of triangles: %d\n ",mesh->nt);
+    fprintf(stderr," can not exceed the number of triangles: %" MMG5_PRId "\n ",mesh->nt);
     return(0);
   }
 
@@ -686,11 +704,12 @@ int MMG2D_Get_triangle(MMG5_pMesh mesh, int* v0, int* v1, int* v2, int* ref
   return(1);
 }
 
-int  MMG2D_Set_triangles(MMG5_pMesh mesh, int *tria, int *refs) {
+int  MMG2D_Set_triangles(MMG5_pMesh mesh, MMG5_int *tria, int *refs) {
   MMG5_pPoint ppt;
   MMG5_pTria ptt;
   double vol;
-  int i, j,ip,tmp;
+  int ip;
+  MMG5_int i,j,tmp;
 
   mesh->xt = 0;
   for (i=1;i<=mesh->nt;i++)
@@ -714,7 +733,7 @@ int  MMG2D_Set_triangles(MMG5_pMesh mesh, int *tria, int *refs) {
                            mesh->point[ptt->v[2]].c);
 
       if ( vol == 0.0 ) {
-        fprintf(stderr,"\n  ## Error: %s: triangle %d has null area.\n",
+        fprintf(stderr,"\n  ## Error: %s: triangle %" MMG5_PRId " has null area.\n",
                 __func__,i);
         for ( ip=0; ip<3; ip++ ) {
           ppt = &mesh->point[ptt->v[ip]];
@@ -734,17 +753,17 @@ int  MMG2D_Set_triangles(MMG5_pMesh mesh, int *tria, int *refs) {
         mesh->xt++;
       }
       if ( mesh->info.ddebug && mesh->xt > 0 ) {
-        fprintf(stderr,"\n  ## Warning: %s: %d triangles reoriented\n",
+        fprintf(stderr,"\n  ## Warning: %s: %" MMG5_PRId " triangles reoriented\n",
                 __func__,mesh->xt);
       }
   }
   return 1;
 }
 
-int  MMG2D_Get_triangles(MMG5_pMesh mesh, int* tria, int* refs,
+int  MMG2D_Get_triangles(MMG5_pMesh mesh, MMG5_int* tria, int* refs,
                          int* areRequired) {
   MMG5_pTria ptt;
-  int        i, j;
+  MMG5_int   i,j;
 
    for (i=1;i<=mesh->nt;i++)
    {
@@ -767,7 +786,7 @@ int  MMG2D_Get_triangles(MMG5_pMesh mesh, int* tria, int* refs,
    return 1;
 }
 
-int MMG2D_Set_edge(MMG5_pMesh mesh, int v0, int v1, int ref, int pos) {
+int MMG2D_Set_edge(MMG5_pMesh mesh, MMG5_int v0, MMG5_int v1, int ref, MMG5_int pos) {
   MMG5_pEdge pt;
 
   if ( !mesh->na ) {
@@ -780,15 +799,15 @@ int MMG2D_Set_edge(MMG5_pMesh mesh, int v0, int v1, int ref, int pos) {
   if ( pos > mesh->namax ) {
     fprintf(stderr,"\n  ## Error: %s: unable to allocate a new element.\n",
             __func__);
-    fprintf(stderr,"    max number of element: %d\n",mesh->namax);
+    fprintf(stderr,"    max number of element: %" MMG5_PRId "\n",mesh->namax);
     _MMG5_INCREASE_MEM_MESSAGE();
     return(0);
   }
 
   if ( pos > mesh->na ) {
-    fprintf(stderr,"\n  ## Error: %s: attempt to set new edge at position %d.",
+    fprintf(stderr,"\n  ## Error: %s: attempt to set new edge at position %" MMG5_PRId ".",
             __func__,pos);
-    fprintf(stderr," Overflow of the given number of edge: %d\n",mesh->na);
+    fprintf(stderr," Overflow of the given number of edge: %" MMG5_PRId "\n",mesh->na);
     fprintf(stderr,"  ## Check the mesh size, its compactness or the position");
     fprintf(stderr," of the edge.\n");
     return(0);
@@ -805,7 +824,7 @@ int MMG2D_Set_edge(MMG5_pMesh mesh, int v0, int v1, int ref, int pos) {
   return(1);
 }
 
-int MMG2D_Set_requiredEdge(MMG5_pMesh mesh, int k) {
+int MMG2D_Set_requiredEdge(MMG5_pMesh mesh, MMG5_int k) {
   MMG5_pPoint ppt;
   MMG5_pEdge  ped;
 
@@ -823,7 +842,7 @@ int MMG2D_Set_requiredEdge(MMG5_pMesh mesh, int k) {
   return(1);
 }
 
-int MMG2D_Set_parallelEdge(MMG5_pMesh mesh, int k) {
+int MMG2D_Set_parallelEdge(MMG5_pMesh mesh, MMG5_int k) {
   MMG5_pPoint ppt;
   MMG5_pEdge  ped;
 
@@ -841,7 +860,7 @@ int MMG2D_Set_parallelEdge(MMG5_pMesh mesh, int k) {
   return(1);
 }
 
-int MMG2D_Get_edge(MMG5_pMesh mesh, int* e0, int* e1, int* ref
+int MMG2D_Get_edge(MMG5_pMesh mesh, MMG5_int* e0, MMG5_int* e1, int* ref
                    ,int* isRidge, int* isRequired) {
   MMG5_pEdge        ped;
 
@@ -864,7 +883,7 @@ int MMG2D_Get_edge(MMG5_pMesh mesh, int* e0, int* e1, int* ref
   if ( mesh->nai > mesh->na ) {
     fprintf(stderr,"\n  ## Error: %s: unable to get edge.\n",__func__);
     fprintf(stderr,"    The number of call of MMG2D_Get_edge function");
-    fprintf(stderr," can not exceed the number of edges: %d\n ",mesh->na);
+    fprintf(stderr," can not exceed the number of edges: %" MMG5_PRId "\n ",mesh->na);
     return(0);
   }
 
@@ -898,7 +917,7 @@ int MMG2D_Get_edge(MMG5_pMesh mesh, int* e0, int* e1, int* ref
   return(1);
 }
 
-int MMG2D_Set_scalarSol(MMG5_pSol met, double s, int pos) {
+int MMG2D_Set_scalarSol(MMG5_pSol met, double s, MMG5_int pos) {
 
   if ( !met->np ) {
     fprintf(stderr,"\n  ## Error: %s: You must set the number of"
@@ -911,14 +930,14 @@ int MMG2D_Set_scalarSol(MMG5_pSol met, double s, int pos) {
   if ( pos >= met->npmax ) {
     fprintf(stderr,"\n  ## Error: %s: unable to set a new solution.\n",
             __func__);
-    fprintf(stderr,"    max number of solutions: %d\n",met->npmax);
+    fprintf(stderr,"    max number of solutions: %" MMG5_PRId "\n",met->npmax);
     return(0);
   }
 
   if ( pos > met->np ) {
     fprintf(stderr,"\n  ## Error: %s: attempt to set new solution"
-            " at position %d.",__func__,pos);
-    fprintf(stderr," Overflow of the given number of solutions: %d\n",met->np);
+            " at position %" MMG5_PRId ".",__func__,pos);
+    fprintf(stderr," Overflow of the given number of solutions: %" MMG5_PRId "\n",met->np);
     fprintf(stderr,"  ## Check the solution size, its compactness or the position");
     fprintf(stderr," of the solution.\n");
     return(0);
@@ -940,7 +959,7 @@ int  MMG2D_Get_scalarSol(MMG5_pSol met, double* s)
       fprintf(stderr,"     You must pass here exactly one time (the first time ");
       fprintf(stderr,"you call the MMG2D_Get_scalarSol function).\n");
       fprintf(stderr,"     If not, the number of call of this function");
-      fprintf(stderr," exceed the number of points: %d\n ",met->np);
+      fprintf(stderr," exceed the number of points: %" MMG5_PRId "\n ",met->np);
     }
   }
 
@@ -950,7 +969,7 @@ int  MMG2D_Get_scalarSol(MMG5_pSol met, double* s)
     fprintf(stderr,"\n  ## Error: %s: unable to get solution.\n",
             __func__);
     fprintf(stderr,"     The number of call of MMG2D_Get_scalarSol function");
-    fprintf(stderr," can not exceed the number of points: %d\n ",met->np);
+    fprintf(stderr," can not exceed the number of points: %" MMG5_PRId "\n ",met->np);
     return(0);
   }
 
@@ -960,7 +979,7 @@ int  MMG2D_Get_scalarSol(MMG5_pSol met, double* s)
 }
 
 int  MMG2D_Set_scalarSols(MMG5_pSol met, double *s) {
-  int k;
+  MMG5_int k;
 
   if ( !met->np ) {
     fprintf(stderr,"\n  ## Error: %s: you must set the number of"
@@ -977,7 +996,7 @@ int  MMG2D_Set_scalarSols(MMG5_pSol met, double *s) {
 }
 
 int  MMG2D_Get_scalarSols(MMG5_pSol met, double* s) {
-  int k;
+  MMG5_int k;
 
   for ( k=0; k<met->np; ++k )
     s[k]  = met->m[k+1];
@@ -985,8 +1004,8 @@ int  MMG2D_Get_scalarSols(MMG5_pSol met, double* s) {
   return(1);
 }
 
-int MMG2D_Set_vectorSol(MMG5_pSol met, double vx,double vy, int pos) {
-  int isol;
+int MMG2D_Set_vectorSol(MMG5_pSol met, double vx,double vy, MMG5_int pos) {
+  MMG5_int isol;
 
   if ( !met->np ) {
     fprintf(stderr,"\n  ## Error: %s: you must set the number of"
@@ -1004,14 +1023,14 @@ int MMG2D_Set_vectorSol(MMG5_pSol met, double vx,double vy, int pos) {
   if ( pos >= met->npmax ) {
     fprintf(stderr,"\n  ## Error: %s: unable to set a new solution.\n",
             __func__);
-    fprintf(stderr,"    max number of solutions: %d\n",met->npmax);
+    fprintf(stderr,"    max number of solutions: %" MMG5_PRId "\n",met->npmax);
     return(0);
   }
 
   if ( pos > met->np ) {
     fprintf(stderr,"\n  ## Error: %s: attempt to set new solution"
-            " at position %d.",__func__,pos);
-    fprintf(stderr," Overflow of the given number of solutions: %d\n",met->np);
+            " at position %" MMG5_PRId ".",__func__,pos);
+    fprintf(stderr," Overflow of the given number of solutions: %" MMG5_PRId "\n",met->np);
     fprintf(stderr,"\n  ## Check the solution size, its compactness or the position");
     fprintf(stderr," of the solution.\n");
     return(0);
@@ -1038,7 +1057,7 @@ int MMG2D_Get_vectorSol(MMG5_pSol met, double* vx, double* vy) {
       fprintf(stderr,"     You must pass here exactly one time (the first time ");
       fprintf(stderr,"you call the MMG2D_Get_vectorSol function).\n");
       fprintf(stderr,"     If not, the number of call of this function");
-      fprintf(stderr," exceed the number of points: %d\n ",met->np);
+      fprintf(stderr," exceed the number of points: %" MMG5_PRId "\n ",met->np);
     }
   }
 
@@ -1047,7 +1066,7 @@ int MMG2D_Get_vectorSol(MMG5_pSol met, double* vx, double* vy) {
   if ( met->npi > met->np ) {
     fprintf(stderr,"\n  ## Error: %s: unable to get solution.\n",__func__);
     fprintf(stderr,"     The number of call of MMG2D_Get_vectorSol function");
-    fprintf(stderr," can not exceed the number of points: %d\n ",met->np);
+    fprintf(stderr," can not exceed the number of points: %" MMG5_PRId "\n ",met->np);
     return(0);
   }
 
@@ -1059,7 +1078,7 @@ int MMG2D_Get_vectorSol(MMG5_pSol met, double* vx, double* vy) {
 
 int MMG2D_Set_vectorSols(MMG5_pSol met, double *sols) {
   double *m;
-  int k,j;
+  MMG5_int k,j;
 
   if ( !met->np ) {
     fprintf(stderr,"\n  ## Error: %s: you must set the number of"
@@ -1081,7 +1100,7 @@ int MMG2D_Set_vectorSols(MMG5_pSol met, double *sols) {
 
 int MMG2D_Get_vectorSols(MMG5_pSol met, double* sols) {
   double *m;
-  int k, j;
+  MMG5_int k,j;
 
   for ( k=0; k<met->np; ++k ) {
     j = 2*k;
@@ -1096,8 +1115,8 @@ int MMG2D_Get_vectorSols(MMG5_pSol met, double* sols) {
 
 
 int MMG2D_Set_tensorSol(MMG5_pSol met, double m11, double m12, double m22,
-                        int pos) {
-  int isol;
+                        MMG5_int pos) {
+  MMG5_int isol;
 
   if ( !met->np ) {
     fprintf(stderr,"\n  ## Error: %s: you must set the number of"
@@ -1110,14 +1129,14 @@ int MMG2D_Set_tensorSol(MMG5_pSol met, double m11, double m12, double m22,
   if ( pos >= met->npmax ) {
     fprintf(stderr,"\n  ## Error: %s: unable to set a new solution.\n",
             __func__);
-    fprintf(stderr,"    max number of solutions: %d\n",met->npmax);
+    fprintf(stderr,"    max number of solutions: %" MMG5_PRId "\n",met->npmax);
     return(0);
   }
 
   if ( pos > met->np ) {
     fprintf(stderr,"\n  ## Error: %s: attempt to set new solution "
-            "at position %d.",__func__,pos);
-    fprintf(stderr," Overflow of the given number of solutions: %d\n",met->np);
+            "at position %" MMG5_PRId ".",__func__,pos);
+    fprintf(stderr," Overflow of the given number of solutions: %" MMG5_PRId "\n",met->np);
     fprintf(stderr,"  ## Check the solution size, its compactness or the position");
     fprintf(stderr," of the solution.\n");
     return(0);
@@ -1132,7 +1151,7 @@ int MMG2D_Set_tensorSol(MMG5_pSol met, double m11, double m12, double m22,
 int MMG2D_Get_tensorSol(MMG5_pSol met, double *m11,double *m12,double *m22)
 {
   int ddebug = 0;
-  int isol;
+  MMG5_int isol;
 
   if ( met->npi == met->np ) {
     met->npi = 0;
@@ -1142,7 +1161,7 @@ int MMG2D_Get_tensorSol(MMG5_pSol met, double *m11,double *m12,double *m22)
       fprintf(stderr,"     You must pass here exactly one time (the first time ");
       fprintf(stderr,"you call the MMG2D_Get_tensorSol function).\n");
       fprintf(stderr,"     If not, the number of call of this function");
-      fprintf(stderr," exceed the number of points: %d\n ",met->np);
+      fprintf(stderr," exceed the number of points: %" MMG5_PRId "\n ",met->np);
     }
   }
 
@@ -1151,7 +1170,7 @@ int MMG2D_Get_tensorSol(MMG5_pSol met, double *m11,double *m12,double *m22)
   if ( met->npi > met->np ) {
     fprintf(stderr,"\n  ## Error: %s: unable to get solution.\n",__func__);
     fprintf(stderr,"     The number of call of MMG2D_Get_tensorSol function");
-    fprintf(stderr," can not exceed the number of points: %d\n ",met->np);
+    fprintf(stderr," can not exceed the number of points: %" MMG5_PRId "\n ",met->np);
     return(0);
   }
 
@@ -1165,7 +1184,7 @@ int MMG2D_Get_tensorSol(MMG5_pSol met, double *m11,double *m12,double *m22)
 
 int MMG2D_Set_tensorSols(MMG5_pSol met, double *sols) {
   double *m;
-  int k,j;
+  MMG5_int k,j;
 
   if ( !met->np ) {
     fprintf(stderr,"\n  ## Error: %s: You must set the number"
@@ -1188,7 +1207,7 @@ int MMG2D_Set_tensorSols(MMG5_pSol met, double *sols) {
 
 int MMG2D_Get_tensorSols(MMG5_pSol met, double *sols) {
   double *m;
-  int k,j;
+  MMG5_int k,j;
 
   for ( k=0; k<met->np; ++k ) {
     j = 3*k;
@@ -165,7 +165,7 @@ FORTRAN_NAME(MMG2D_SET_DPARAMETER,mmg2d_set_dparameter,
  * See \ref MMG2D_Set_meshSize function in \ref mmg2d/libmmg2d.h file.
  */
 FORTRAN_NAME(MMG2D_SET_MESH_MMG2D_SIZE,mmg2d_set_meshsize,
-             (MMG5_pMesh *mesh, int *np, int *nt, int *na, int *retval),
+             (MMG5_pMesh *mesh, MMG5_int *np, MMG5_int *nt, MMG5_int *na, int *retval),
              (mesh,np,nt,na,retval)) {
   *retval = MMG2D_Set_meshSize(*mesh,*np,*nt,*na);
   return;
@@ -175,7 +175,7 @@ FORTRAN_NAME(MMG2D_SET_MESH_MMG2D_SIZE,mmg2d_set_meshsize,
  */
 FORTRAN_NAME(MMG2D_SET_SOL_MMG2D_SIZE,mmg2d_set_solsize,
              (MMG5_pMesh *mesh, MMG5_pSol *sol, int* typEntity,
-              int* np, int* typSol, int* retval),
+              MMG5_int* np, int* typSol, int* retval),
              (mesh, sol, typEntity, np, typSol, retval)) {
   *retval = MMG2D_Set_solSize(*mesh,*sol,*typEntity,*np,*typSol);
   return;
@@ -184,7 +184,7 @@ FORTRAN_NAME(MMG2D_SET_SOL_MMG2D_SIZE,mmg2d_set_solsize,
  * See \ref MMG2D_Get_solSize function in \ref mmg2d/libmmg2d.h file.
  */
 FORTRAN_NAME(MMG2D_GET_SOL_MMG2D_SIZE,mmg2d_get_solsize,
-             (MMG5_pMesh *mesh, MMG5_pSol *sol, int* typEntity, int* np, int* typSol, int* retval),
+             (MMG5_pMesh *mesh, MMG5_pSol *sol, int* typEntity, MMG5_int* np, int* typSol, int* retval),
              (mesh,sol,typEntity,np,typSol,retval)) {
 
   *retval = MMG2D_Get_solSize(*mesh,*sol,typEntity,np,typSol);
@@ -196,7 +196,7 @@ FORTRAN_NAME(MMG2D_GET_SOL_MMG2D_SIZE,mmg2d_get_solsize,
  */
 FORTRAN_NAME(MMG2D_SET_VERTEX,mmg2d_set_vertex,
              (MMG5_pMesh *mesh, double* c0, double* c1, int* ref,
-              int* pos, int* retval),
+              MMG5_int* pos, int* retval),
              (mesh,c0,c1,ref,pos,retval)) {
 
   *retval = MMG2D_Set_vertex(*mesh,*c0,*c1,*ref,*pos);
@@ -205,7 +205,7 @@ FORTRAN_NAME(MMG2D_SET_VERTEX,mmg2d_set_vertex,
 /**
  * See \ref MMG2D_Set_corner function in \ref mmg2d/libmmg2d.h file.
  */
-FORTRAN_NAME(MMG2D_SET_CORNER,mmg2d_set_corner,(MMG5_pMesh *mesh, int *k, int* retval),
+FORTRAN_NAME(MMG2D_SET_CORNER,mmg2d_set_corner,(MMG5_pMesh *mesh, MMG5_int *k, int* retval),
              (mesh,k,retval)) {
   *retval =  MMG2D_Set_corner(*mesh,*k);
   return;
@@ -215,7 +215,7 @@ FORTRAN_NAME(MMG2D_SET_CORNER,mmg2d_set_corner,(MMG5_pMesh *mesh, int *k, int* r
  * See \ref MMG2D_Set_requiredVertex function in \ref mmg2d/libmmg2d.h file.
  */
 FORTRAN_NAME(MMG2D_SET_REQUIREDVERTEX,mmg2d_set_requiredvertex,
-             (MMG5_pMesh *mesh, int *k, int* retval),
+             (MMG5_pMesh *mesh, MMG5_int *k, int* retval),
              (mesh,k,retval)) {
   *retval =  MMG2D_Set_requiredVertex(*mesh,*k);
   return;
@@ -259,7 +259,7 @@ FORTRAN_NAME(MMG2D_GET_VERTICES,mmg2d_get_vertices,
  * See \ref MMG2D_Set_triangle function in \ref mmg2d/libmmg2d.h file.
  */
 FORTRAN_NAME(MMG2D_SET_TRIANGLE,mmg2d_set_triangle,
-             (MMG5_pMesh *mesh, int* v0, int* v1, int* v2, int* ref,int* pos,
+             (MMG5_pMesh *mesh, MMG5_int* v0, MMG5_int* v1, MMG5_int* v2, int* ref,MMG5_int* pos,
               int* retval),
              (mesh,v0,v1,v2,ref,pos,retval)) {
   *retval = MMG2D_Set_triangle(*mesh, *v0, *v1, *v2, *ref, *pos);
@@ -269,7 +269,7 @@ FORTRAN_NAME(MMG2D_SET_TRIANGLE,mmg2d_set_triangle,
  * See \ref MMG2D_Set_requiredTriangle function in \ref mmg2d/libmmg2d.h file.
  */
 FORTRAN_NAME(MMG2D_SET_REQUIREDTRIANGLE,mmg2d_set_requiredtriangle,
-             (MMG5_pMesh *mesh, int *k, int* retval),
+             (MMG5_pMesh *mesh, MMG5_int *k, int* retval),
              (mesh,k,retval)) {
   *retval = MMG2D_Set_requiredTriangle(*mesh, *k);
   return;
@@ -279,7 +279,7 @@ FORTRAN_NAME(MMG2D_SET_REQUIREDTRIANGLE,mmg2d_set_requiredtriangle,
  * See \ref MMG2D_Get_triangle function in \ref mmg2d/libmmg2d.h file.
  */
 FORTRAN_NAME(MMG2D_GET_TRIANGLE,mmg2d_get_triangle,
-             (MMG5_pMesh *mesh, int* v0, int* v1, int* v2, int* ref
+             (MMG5_pMesh *mesh, MMG5_int* v0, MMG5_int* v1, MMG5_int* v2, int* ref
               ,int* isRequired, int* retval),
              (mesh,v0,v1,v2,ref,isRequired,retval)) {
   *retval = MMG2D_Get_triangle(*mesh,v0,v1,v2,ref,isRequired);
@@ -289,7 +289,7 @@ FORTRAN_NAME(MMG2D_GET_TRIANGLE,mmg2d_get_triangle,
  * See \ref MMG2D_Set_triangles function in \ref mmg2d/libmmg2d.h file.
  */
 FORTRAN_NAME(MMG2D_SET_TRIANGLES,mmg2d_set_triangles,
-             (MMG5_pMesh *mesh, int* tria, int* refs,
+             (MMG5_pMesh *mesh, MMG5_int* tria, int* refs,
               int* retval),
              (mesh,tria,refs,retval)) {
   *retval = MMG2D_Set_triangles(*mesh, tria, refs);
@@ -300,7 +300,7 @@ FORTRAN_NAME(MMG2D_SET_TRIANGLES,mmg2d_set_triangles,
  * See \ref MMG2D_Get_triangles function in \ref mmg2d/libmmg2d.h file.
  */
 FORTRAN_NAME(MMG2D_GET_TRIANGLES,mmg2d_get_triangles,
-             (MMG5_pMesh *mesh, int* tria, int* refs,int* areRequired,
+             (MMG5_pMesh *mesh, MMG5_int* tria, int* refs,int* areRequired,
               int* retval),
              (mesh,tria,refs,areRequired,retval)) {
   *retval = MMG2D_Get_triangles(*mesh,tria,refs,areRequired);
@@ -311,7 +311,7 @@ FORTRAN_NAME(MMG2D_GET_TRIANGLES,mmg2d_get_triangles,
  * See \ref MMG2D_Set_edge function in \ref mmg2d/libmmg2d.h file.
  */
 FORTRAN_NAME(MMG2D_SET_EDGE,mmg2d_set_edge,
-             (MMG5_pMesh *mesh, int *v0, int *v1, int *ref, int *pos, int* retval),
+             (MMG5_pMesh *mesh, MMG5_int *v0, MMG5_int *v1, int *ref, MMG5_int *pos, int* retval),
              (mesh,v0,v1,ref,pos,retval)){
   *retval = MMG2D_Set_edge(*mesh,*v0,*v1,*ref,*pos);
   return;
@@ -320,7 +320,7 @@ FORTRAN_NAME(MMG2D_SET_EDGE,mmg2d_set_edge,
  * See \ref MMG2D_Set_requiredEdge function in \ref mmg2d/libmmg2d.h file.
  */
 FORTRAN_NAME(MMG2D_SET_REQUIREDEDGE,mmg2d_set_requirededge,
-             (MMG5_pMesh *mesh, int *k, int* retval),
+             (MMG5_pMesh *mesh, MMG5_int *k, int* retval),
              (mesh,k,retval)) {
   *retval = MMG2D_Set_requiredEdge(*mesh,*k);
   return;
@@ -329,7 +329,7 @@ FORTRAN_NAME(MMG2D_SET_REQUIREDEDGE,mmg2d_set_requirededge,
  * See \ref MMG2D_Set_parallelEdge function in \ref mmg2d/libmmg2d.h file.
  */
 FORTRAN_NAME(MMG2D_SET_PARALLELEDGE,mmg2d_set_paralleledge,
-             (MMG5_pMesh *mesh, int *k, int* retval),
+             (MMG5_pMesh *mesh, MMG5_int *k, int* retval),
              (mesh,k,retval)) {
   *retval = MMG2D_Set_parallelEdge(*mesh,*k);
   return;
@@ -338,7 +338,7 @@ FORTRAN_NAME(MMG2D_SET_PARALLELEDGE,mmg2d_set_paralleledge,
 /**
  * See \ref MMG2D_Get_edge function in \ref mmg2d/libmmg2d.h file.
  */
-FORTRAN_NAME(MMG2D_GET_EDGE,mmg2d_get_edge,(MMG5_pMesh *mesh, int* e0, int* e1, int* ref
+FORTRAN_NAME(MMG2D_GET_EDGE,mmg2d_get_edge,(MMG5_pMesh *mesh, MMG5_int* e0, MMG5_int* e1, int* ref
                                           ,int* isRidge, int* isRequired, int* retval),
              (mesh,e0,e1,ref,isRidge,isRequired,retval)) {
   *retval = MMG2D_Get_edge(*mesh,e0,e1,ref,isRidge,isRequired);
@@ -348,7 +348,7 @@ FORTRAN_NAME(MMG2D_GET_EDGE,mmg2d_get_edge,(MMG5_pMesh *mesh, int* e0, int* e1,
  * See \ref MMG2D_Get_meshSize function in \ref mmg2d/libmmg2d.h file.
  */
 FORTRAN_NAME(MMG2D_GET_MESH_MMG2D_SIZE,mmg2d_get_meshsize,
-             (MMG5_pMesh *mesh, int* np, int* nt, int* na, int* retval),
+             (MMG5_pMesh *mesh, MMG5_int* np, MMG5_int* nt, MMG5_int* na, int* retval),
              (mesh,np,nt, na,retval)) {
 
   *retval = MMG2D_Get_meshSize(*mesh,np,nt,na);
@@ -358,7 +358,7 @@ FORTRAN_NAME(MMG2D_GET_MESH_MMG2D_SIZE,mmg2d_get_meshsize,
  * See \ref MMG2D_Set_scalarSol function in \ref mmg2d/libmmg2d.h file.
  */
 FORTRAN_NAME(MMG2D_SET_SCALARSOL,mmg2d_set_scalarsol,
-             (MMG5_pSol *met, double *s, int *pos, int* retval),
+             (MMG5_pSol *met, double *s, MMG5_int *pos, int* retval),
              (met,s,pos,retval)) {
   *retval = MMG2D_Set_scalarSol(*met,*s,*pos);
   return;
@@ -397,7 +397,7 @@ FORTRAN_NAME(MMG2D_GET_SCALARSOLS,mmg2d_get_scalarsols,
  */
 FORTRAN_NAME(MMG2D_SET_VECTORSOL,mmg2d_set_vectorsol,
              (MMG5_pSol *met, double *vx, double *vy,
-              int *pos, int* retval),
+              MMG5_int *pos, int* retval),
              (met,vx,vy,pos,retval)) {
   *retval = MMG2D_Set_vectorSol(*met,*vx,*vy,*pos);
   return;
@@ -437,7 +437,7 @@ FORTRAN_NAME(MMG2D_GET_VECTORSOLS,mmg2d_get_vectorsols,
  */
 FORTRAN_NAME(MMG2D_SET_TENSORSOL,mmg2d_set_tensorsol,
              (MMG5_pSol *met, double *m11, double *m12, double *m22,
-              int *pos, int* retval),
+              MMG5_int *pos, int* retval),
              (met,m11,m12,m22,pos,retval)) {
   *retval = MMG2D_Set_tensorSol(*met,*m11,*m12,*m22,*pos);
   return;
@@ -34,7 +34,6 @@
 
 #include "mmg2d.h"
 
-extern char ddb;
 
 /**
  * \param mesh pointer toward the mesh
@@ -47,14 +46,15 @@ extern char ddb;
  */
 int _MMG2_setadj(MMG5_pMesh mesh) {
   MMG5_pTria       pt,pt1;
-  int              *pile,*adja,ipil,k,kk,ncc,ip1,ip2,nr,nref;
+  int              ipil,ncc,nr,nref;
+  MMG5_int         kk,*pile,*adja,ip1,ip2,k;
   int16_t          tag;
   char             i,ii,i1,i2;
 
   if ( abs(mesh->info.imprim) > 5  || mesh->info.ddebug )
     fprintf(stdout,"  ** SETTING TOPOLOGY\n");
 
-  _MMG5_SAFE_MALLOC(pile,mesh->nt+1,int,0);
+  _MMG5_SAFE_MALLOC(pile,mesh->nt+1,MMG5_int,0);
 
   /* Initialization of the pile */
   ncc = 1;
@@ -198,7 +198,8 @@ int _MMG2_singul(MMG5_pMesh mesh) {
   MMG5_pTria          pt;
   MMG5_pPoint         ppt,p1,p2;
   double              ux,uy,uz,vx,vy,vz,dd;
-  int                 list[MMG2_LONMAX+2],listref[MMG2_LONMAX+2],k,ns,ng,nr,nm,nre,nc;
+  int                 listref[MMG2_LONMAX+2],ns,ng,nr,nm,nre,nc;
+  MMG5_int            k,list[MMG2_LONMAX+2];
   char                i;
 
   nre = nc = nm = 0;
@@ -296,7 +297,8 @@ int _MMG2_singul(MMG5_pMesh mesh) {
 int _MMG2_norver(MMG5_pMesh mesh) {
   MMG5_pTria       pt,pt1;
   MMG5_pPoint      ppt;
-  int              k,kk,nn,pleft,pright;
+  int              nn;
+  MMG5_int         k,kk,pleft,pright;
   char             i,ii;
 
   nn = 0;
@@ -317,7 +319,7 @@ int _MMG2_norver(MMG5_pMesh mesh) {
         ppt->s = 1;
         if ( !_MMG2_boulen(mesh,kk,ii,&pleft,&pright,ppt->n) ) {
           fprintf(stderr,"\n  ## Error: %s: Impossible to"
-                  " calculate normal vector at vertex %d.\n",
+                  " calculate normal vector at vertex %" MMG5_PRId ".\n",
                   __func__,_MMG2D_indPt(mesh,pt->v[i]));
           return(0);
         }
@@ -339,7 +341,7 @@ int _MMG2_norver(MMG5_pMesh mesh) {
         ppt->s = 1;
         if ( !_MMG2_boulen(mesh,kk,ii,&pleft,&pright,ppt->n) ) {
           fprintf(stderr,"\n  ## Error: %s: Impossible to"
-                  " calculate normal vector at vertex %d.\n",
+                  " calculate normal vector at vertex %" MMG5_PRId ".\n",
                   __func__,_MMG2D_indPt(mesh,pt->v[i]));
           return(0);
         }
@@ -379,7 +381,8 @@ int _MMG2_regnor(MMG5_pMesh mesh) {
   MMG5_pTria            pt;
   MMG5_pPoint           ppt,p1,p2;
   double                *tmp,dd,ps,lm1,lm2,nx,ny,ux,uy,nxt,nyt,res,res0,n[2];
-  int                   k,iel,ip1,ip2,nn,it,maxit;
+  int                   nn,it,maxit;
+  MMG5_int              k,iel,ip1,ip2;
   char                  i,ier;
 
   it = 0;
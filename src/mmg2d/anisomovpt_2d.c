@@ -34,13 +34,14 @@
 #include "mmg2d.h"
 
 /* Relocate internal vertex whose ball is passed */
-int _MMG2_movintpt_ani(MMG5_pMesh mesh,MMG5_pSol met,int ilist,int *list,char improve) {
+int _MMG2_movintpt_ani(MMG5_pMesh mesh,MMG5_pSol met,int ilist,MMG5_int *list,char improve) {
   MMG5_pTria         pt,pt0;
   MMG5_pPoint        ppt0,p0,p1,p2;
   double             calold,calnew,area,det,alpha,ps,ps1,ps2,step,sqdetm1,sqdetm2,gr[2],grp[2],*m0,*m1,*m2;
-  int                k,iel,ip0,ip1,ip2;
+  int                k;
+  MMG5_int           ip0,ip1,ip2,iel;
   char               i,i1,i2;
-  static char        mmgWarn0=0;
+  static _MMG5_TLS char        mmgWarn0=0;
   
   pt0 = &mesh->tria[0];
   ppt0 = &mesh->point[0];
@@ -55,7 +56,7 @@ int _MMG2_movintpt_ani(MMG5_pMesh mesh,MMG5_pSol met,int ilist,int *list,char im
     pt = &mesh->tria[iel];
     
     /* Quality of pt */
-    calold = MG_MIN(MMG2D_caltri(mesh,met,pt),calold);
+    calold = MG_MIN(mesh->func.caltri(mesh,met,pt),calold);
     
     i = list[k] % 3;
     i1 = _MMG5_inxt2[i];
@@ -141,7 +142,7 @@ int _MMG2_movintpt_ani(MMG5_pMesh mesh,MMG5_pSol met,int ilist,int *list,char im
     memcpy(pt0,pt,sizeof(MMG5_Tria));
     pt0->v[i] = 0;
     
-    calnew = MG_MIN(MMG2D_caltri(mesh,met,pt0),calnew);
+    calnew = MG_MIN(mesh->func.caltri(mesh,met,pt0),calnew);
   }
   
   if (calold < _MMG2_NULKAL && calnew <= calold) return(0);
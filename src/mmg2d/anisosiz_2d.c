@@ -44,10 +44,10 @@
  * Impose default metric (isotropic, with size hmax) at vertex i in triangle k.
  *
  */
-int _MMG2_defaultmet_2d(MMG5_pMesh mesh,MMG5_pSol met,int k,char i) {
+int _MMG2_defaultmet_2d(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,char i) {
   MMG5_pTria       pt;
   double           *m,isqhmax;
-  int              ip;
+  MMG5_int         ip;
 
   isqhmax = mesh->info.hmax;
   isqhmax = 1.0 / (isqhmax*isqhmax);
@@ -74,14 +74,15 @@ int _MMG2_defaultmet_2d(MMG5_pMesh mesh,MMG5_pSol met,int k,char i) {
  * account of geometric approximation of the corresponding curve
  *
  */
-int _MMG2_defmetbdy_2d(MMG5_pMesh mesh,MMG5_pSol met,int k,char i) {
+int _MMG2_defmetbdy_2d(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,char i) {
   MMG5_pTria      pt;
   MMG5_pPoint     p0,p1,p2;
   double          hausd,sqhmin,sqhmax,ux,uy,ll,li,ps1,ps2,lm,ltmp,pv,M1,M2,t1[2],t2[2],b1[2],b2[2],*n,*m;
   double          gpp1[2],gpp2[2];
-  int             ilist,iel,ip,ip1,ip2,it[2],l,list[MMG2_LONMAX+2];
+  int             ilist,l;
+  MMG5_int        ip,ip1,ip2,list[MMG2_LONMAX+2],iel,it[2];
   char            i0,i1,i2,j;
-  static char     mmgWarn0=0,mmgWarn1=0;
+  static _MMG5_TLS char     mmgWarn0=0,mmgWarn1=0;
 
   sqhmin   = mesh->info.hmin*mesh->info.hmin;
   sqhmax   = mesh->info.hmax*mesh->info.hmax;
@@ -261,7 +262,7 @@ int _MMG2_defsiz_ani(MMG5_pMesh mesh,MMG5_pSol met) {
   MMG5_pTria     pt;
   MMG5_pPoint    ppt;
   double         mm[3],mr[3];
-  int            k,ip;
+  MMG5_int       k,ip;
   char           ismet,isdef,i;
 
 
@@ -341,7 +342,7 @@ int _MMG2_grad2met_ani(MMG5_pMesh mesh,MMG5_pSol met,double *m,double *n,double
   double       det,dd,sqDelta,trimn,vnorm,hm,hn,lambda[2],dm[2],dn[2],imn[4];
   double       vp[2][2],ip[4];
   char         ier;
-  static char  mmgWarn0=0;
+  static _MMG5_TLS char  mmgWarn0=0;
 
   ier = 0;
 
@@ -508,7 +509,8 @@ int _MMG2_gradsiz_ani(MMG5_pMesh mesh,MMG5_pSol met) {
   MMG5_pTria        pt;
   MMG5_pPoint       p1,p2;
   double            hgrad,ll,*m1,*m2,difsiz;
-  int               k,it,ip1,ip2,maxit,nup,nu;
+  int               it,maxit,nup,nu;
+  MMG5_int          k,ip1,ip2;
   char              i,i1,i2,ier;
 
 
@@ -25,7 +25,7 @@
 // extern char ddb;
 
 /* Check if triangle k should be split based on geometric and rough edge length considerations */
-int _MMG2_chkedg(MMG5_pMesh mesh, int k) {
+int _MMG2_chkedg(MMG5_pMesh mesh, MMG5_int k) {
   MMG5_pTria        pt;
   MMG5_pPoint       p1,p2;
   double            hausd,hmax,ps,cosn,ux,uy,ll,li,t1[2],t2[2];
@@ -114,7 +114,7 @@ int _MMG2_chkedg(MMG5_pMesh mesh, int k) {
 
 /* Calculate coordinates o[2] and interpolated normal vector no[2] of a new point
  situated at parametric distance s from i1 = inxt2[i] */
-int _MMG2_bezierCurv(MMG5_pMesh mesh,int k,char i,double s,double *o,double *no) {
+int _MMG2_bezierCurv(MMG5_pMesh mesh,MMG5_int k,char i,double s,double *o,double *no) {
   MMG5_pTria         pt;
   MMG5_pPoint        p1,p2;
   double             b1[2],b2[2],t1[2],t2[2],n1[2],n2[2],bn[2],ux,uy,ll,li,ps;
@@ -31,10 +31,11 @@ static unsigned char iprev[3] = {2,0,1};
    in:  ifirst    : triangle containing p
    iploc     : index of p in start
    out: list  : list of triangles */
-int MMG2_boulep(MMG5_pMesh mesh, int ifirst, int iploc, int * list) {
+int MMG2_boulep(MMG5_pMesh mesh, MMG5_int ifirst, int iploc, MMG5_int * list) {
   MMG5_pTria  pt;
   MMG5_pPoint ppt;
-  int    ip,voy,ilist,iel,*adja,i,iadr;
+  int    ilist,i;
+  MMG5_int ip,*adja,voy,iel,iadr;
 
   if ( ifirst < 1 ) return(0);
   pt = &mesh->tria[ifirst];
@@ -93,11 +94,12 @@ int MMG2_boulep(MMG5_pMesh mesh, int ifirst, int iploc, int * list) {
  convention: the normal vector is oriented from the half ball it starts with towards its exterior
  return pright = 3*kk+ii, where kk = last triangle in the first travel, and ii = local index of ip in kk 
         pleft = 3*kk+ii, where kk = last triangle in the second travel, and ii = local index of ip in kk*/
-int _MMG2_boulen(MMG5_pMesh mesh, int start,char ip, int *pleft, int *pright, double *nn) {
+int _MMG2_boulen(MMG5_pMesh mesh, MMG5_int start,char ip, MMG5_int *pleft, MMG5_int *pright, double *nn) {
   MMG5_pTria        pt;
   MMG5_pPoint       p1,p2;
   double            ux,uy,dd,n1[2],n2[2];
-  int               *adja,k,kk,refs;
+  int               refs;
+  MMG5_int          *adja,kk,k;
   char              i,ii,i1,i2;
     
   /* First travel of the ball of ip; initialization */
@@ -199,8 +201,9 @@ int _MMG2_boulen(MMG5_pMesh mesh, int start,char ip, int *pleft, int *pright, do
  * crossing ridge.
  *
  */
-int _MMG2_boulet(MMG5_pMesh mesh,int start,char ip,int *list) {
-  int           *adja,k,ilist;
+int _MMG2_boulet(MMG5_pMesh mesh,MMG5_int start,char ip,MMG5_int *list) {
+  int           ilist;
+  MMG5_int      *adja,k;
   char          i,i1,i2;
   
   ilist = 0;
@@ -252,11 +255,11 @@ int _MMG2_boulet(MMG5_pMesh mesh,int start,char ip,int *list) {
  * \a ip2 with their indices.
  *
  */
-int _MMG2_bouleendp(MMG5_pMesh mesh,int start,char ip,int *ip1,int *ip2) {
+int _MMG2_bouleendp(MMG5_pMesh mesh,MMG5_int start,char ip,MMG5_int *ip1,MMG5_int *ip2) {
   MMG5_pTria    pt;
-  int           *adja,k;
+  MMG5_int      *adja,k;
   char          i,i1,i2;
-  static char   mmgWarn0=0;
+  static _MMG5_TLS char   mmgWarn0=0;
   
   *ip1 = 0;
   *ip2 = 0;
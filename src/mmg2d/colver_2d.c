@@ -22,14 +22,14 @@
 */
 #include "mmg2d.h"
 
-extern unsigned char ddb;
 
 /* Check whether the validity and the geometry of the mesh are preserved when collapsing edge i (p1->p2)*/
-int _MMG2_chkcol(MMG5_pMesh mesh, MMG5_pSol met,int k,char i,int *list,char typchk) {
+int _MMG2_chkcol(MMG5_pMesh mesh, MMG5_pSol met,MMG5_int k,char i,MMG5_int *list,char typchk) {
   MMG5_pTria           pt0,pt,pt1,pt2;
   MMG5_pPoint          ppt,p2;
   double               lon,len,calold,calnew,caltmp;
-  int                  ip1,ip2,ipb,l,ll,lj,jel,kel,ilist,*adja;
+  int                  l,lj,ilist;
+  MMG5_int             ip1,ip2,ipb,*adja,jel,kel,ll;
   unsigned char        i1,i2,j,jj,j2,voy,open;
   
   pt0 = &mesh->tria[0];
@@ -48,7 +48,7 @@ int _MMG2_chkcol(MMG5_pMesh mesh, MMG5_pSol met,int k,char i,int *list,char typc
   
   /* If typchk == 2, avoid recreating long edges */
   if ( typchk == 2 && met->m ) {
-    lon = MMG2D_lencurv(mesh,met,ip1,ip2);
+    lon = mesh->func.lencurv(mesh,met,ip1,ip2);
     lon = MG_MAX(2.-lon,1.6);
   }
   
@@ -144,7 +144,7 @@ int _MMG2_chkcol(MMG5_pMesh mesh, MMG5_pSol met,int k,char i,int *list,char typc
       /* Check length to avoid recreating long elements */
       if ( typchk == 2 && met->m && !MG_EDG(mesh->point[ip2].tag) ) {
         ip1 = pt1->v[j2];
-        len = MMG2D_lencurv(mesh,met,ip1,ip2);
+        len = mesh->func.lencurv(mesh,met,ip1,ip2);
         if ( len > lon )  return(0);
       }
     
@@ -156,7 +156,7 @@ int _MMG2_chkcol(MMG5_pMesh mesh, MMG5_pSol met,int k,char i,int *list,char typc
         ll = list[ilist-1+open] / 3;
 
         if ( ll > mesh->nt )  return(0);
-        lj = list[ilist-1+open] % 3;
+        lj = (int)(list[ilist-1+open] % 3);
         pt0->tag[jj] |= mesh->tria[ll].tag[lj];
       }
       
@@ -253,9 +253,9 @@ int _MMG2_chkcol(MMG5_pMesh mesh, MMG5_pSol met,int k,char i,int *list,char typc
 }
 
 /* Perform effective collapse of edge i in tria k, i1->i2 */
-int _MMG2_colver(MMG5_pMesh mesh,int ilist,int *list) {
+int _MMG2_colver(MMG5_pMesh mesh,int ilist,MMG5_int *list) {
   MMG5_pTria         pt,pt1,pt2;
-  int                iel,jel,ip1,ip2,k,kel,*adja;
+  MMG5_int           ip1,ip2,*adja,k,kel,iel,jel;
   unsigned char      i,j,jj,i1,i2,open;
   
   iel = list[0] / 3;
@@ -339,9 +339,9 @@ int _MMG2_colver(MMG5_pMesh mesh,int ilist,int *list) {
 
 /* Perform effective collapse of edge i in tria k, i1->i2 
    in the particular case where only three elements are in the ball of i */
-int _MMG2_colver3(MMG5_pMesh mesh,int *list) {
+int _MMG2_colver3(MMG5_pMesh mesh,MMG5_int *list) {
   MMG5_pTria           pt,pt1,pt2;
-  int                  iel,jel,kel,mel,ip,*adja;
+  MMG5_int             ip,*adja,mel,iel,jel,kel;
   unsigned char        i,i1,j,j1,j2,k,m;
   
   /* Update of the new point for triangle list[0] */
@@ -401,9 +401,9 @@ int _MMG2_colver3(MMG5_pMesh mesh,int *list) {
 
 /* Perform effective collapse of edge i in tria k, i1->i2
  in the particular case where only two elements are in the ball of i */
-int _MMG2_colver2(MMG5_pMesh mesh,int *list) {
+int _MMG2_colver2(MMG5_pMesh mesh,MMG5_int *list) {
   MMG5_pTria   pt,pt1;
-  int          *adja,iel,jel,kel,ip1,ip2;
+  MMG5_int     *adja,ip1,ip2,kel,iel,jel;
   char         i1,i2,jj,j2,k;
   
   /* update of new point for triangle list[0] */
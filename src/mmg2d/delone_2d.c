@@ -29,11 +29,12 @@
 #define KTB    11
 
 /* Cavity correction for quality */
-static int _MMG2_correction_iso(MMG5_pMesh mesh,int ip,int *list,int ilist,int nedep) {
+static int _MMG2_correction_iso(MMG5_pMesh mesh,MMG5_int ip,MMG5_int *list,int ilist,int nedep) {
   MMG5_pTria      pt;
   MMG5_pPoint     ppt,p1,p2;
   double           dd,ux,uy,vx,vy;
-  int             *adja,i,ipil,iel,lon,iadr,adj,ib,ic,base,ncor,nei[3];
+  int             i,ipil,lon,base,ncor;
+  MMG5_int        *adja,ib,ic,nei[3],adj,iel,iadr;
 
   ppt  = &mesh->point[ip];
   if ( !MG_VOK(ppt) )  return(ilist);
@@ -92,10 +93,10 @@ static int _MMG2_correction_iso(MMG5_pMesh mesh,int ip,int *list,int ilist,int n
 }
 
 /* Hashing routine for maintaining adjacencies during Delaunization; hash mesh edge v[0],v[1] (face i of iel) */
-int _MMG2_hashEdgeDelone(MMG5_pMesh mesh,HashTable *hash,int iel,int i,int *v) {
-  int             *adja,iadr,jel,j,key,mins,maxs;
+int _MMG2_hashEdgeDelone(MMG5_pMesh mesh,HashTable *hash,MMG5_int iel,MMG5_int i,MMG5_int *v) {
+  MMG5_int        *adja,mins,maxs,iadr,key,jel,j;
   Hedge           *ha;
-  static char     mmgWarn0=0;
+  static _MMG5_TLS char     mmgWarn0=0;
 
   /* Compute key */
   if ( v[0] < v[1] ) {
@@ -173,12 +174,13 @@ int _MMG2_hashEdgeDelone(MMG5_pMesh mesh,HashTable *hash,int iel,int i,int *v) {
 
 /**  Create the cavity point ip, starting from triangle list[0];
      Return a negative value for ilist if one of the triangles of the cavity is required */
-int _MMG2_cavity(MMG5_pMesh mesh,MMG5_pSol sol,int ip,int *list) {
+int _MMG2_cavity(MMG5_pMesh mesh,MMG5_pSol sol,MMG5_int ip,MMG5_int *list) {
   MMG5_pTria      pt,pt1,ptc;
   MMG5_pPoint     ppt;
   double          c[2],crit,dd,eps,rad,ct[6];
-  int             *adja,*adjb,adj,adi,voy,i,j,ilist,ipil,jel,iadr,base,nei[3],l,tref; //isreq;
-  static char     mmgWarn0=0;
+  int             i,j,ilist,ipil,base,l,tref; //isreq;
+  MMG5_int        *adja,*adjb,adi,nei[3],adj,voy,iadr,jel;
+  static _MMG5_TLS char     mmgWarn0=0;
 
   ppt = &mesh->point[ip];
   base  = ++mesh->base;
@@ -261,21 +263,27 @@ int _MMG2_cavity(MMG5_pMesh mesh,MMG5_pSol sol,int ip,int *list) {
   return(ilist);
 }
 
-/* Insertion in point ip in the cavity described by list */
-int _MMG2_delone(MMG5_pMesh mesh,MMG5_pSol sol,int ip,int *list,int ilist) {
+/* Insertion in point ip in the cavity described by list; on success, list[0] is
+   replaced by one of the created triangles (thus containing ip) */
+int _MMG2_delone(MMG5_pMesh mesh,MMG5_pSol sol,MMG5_int ip,MMG5_int *list,int ilist) {
   MMG5_pTria      pt,pt1;
   MMG5_pPoint     ppt;
-  int             *adja,*adjb,i,j,k,iel,jel,old,v[2],iadr,base,size,nei[3],iadrold;
-  int             tref,ielnum[3*MMG2_LONMAX+1];
+  int             i,k,base,size;
+  MMG5_int        *adja,*adjb,v[2],nei[3],j,iel,jel,iadr,old,iadrold;
+  int             tref;
+  MMG5_int        ielnum[3*MMG2_LONMAX+1];
   short           i1;
   char            alert;
   HashTable       hedg;
-  static char     mmgWarn0=0,mmgWarn1=0;
+  static _MMG5_TLS char     mmgWarn0=0,mmgWarn1=0;
+
+  /* Reset tagdel field of the cavity vertices (the only ones used below) */
+  for (k=0; k<ilist; k++) {
+    pt1 = &mesh->tria[list[k]];
+    for (i=0; i<3; i++)
+      mesh->point[ pt1->v[i] ].tagdel = 0;
+  }
 
-  /* Reset tagdel field */
-  for (k=1; k<=mesh->np; k++)
-    mesh->point[k].tagdel = 0;
-  
   /* Triangles in the cavity are those s.t. pt->base == base */
   base = mesh->base;
   /* Count the number of external faces in the cavity, and tag the corresponding vertices */
@@ -412,5 +420,9 @@ int _MMG2_delone(MMG5_pMesh mesh,MMG5_pSol sol,int ip,int *list,int ilist) {
   //ppt = &mesh->point[ip];
   //  ppt->flag = mesh->flag;
   _MMG5_SAFE_FREE(hedg.item);
+
+  /* Starting triangle for the location of the next point */
+  list[0] = ielnum[1];
+
   return(1);
 }
@@ -35,13 +35,15 @@ int MMG2_bdryenforcement(MMG5_pMesh mesh,MMG5_pSol sol) {
   MMG5_pTria      pt,pt1;
   MMG5_pEdge      ped;
   MMG5_pPoint     ppt;
-  int             k,l,kk,nex,list[MMG2_LONMAX],kdep,lon,iel,iare,ied;
-  int             ia,ib,ilon,rnd,idep,*adja,ir,adj,list2[3];
+  int             l,nex,lon,iare,ied;
+  MMG5_int        k,kk,kdep,list[MMG2_LONMAX],iel;
+  int             ilon,rnd;
+  MMG5_int        ia,ib,*adja,adj,list2[3],idep,ir;
   char            i,i1,i2,j;
 //  int       iadr2,*adja2,ndel,iadr,ped0,ped1;
-  static char     mmgWarn0=0,mmgWarn1=0,mmgWarn2=0,mmgWarn3=0;
-  static char     mmgWarn4=0,mmgWarn5=0,mmgWarn6=0,mmgWarn7=0;
-  static char     mmgWarn8=0;
+  static _MMG5_TLS char     mmgWarn0=0,mmgWarn1=0,mmgWarn2=0,mmgWarn3=0;
+  static _MMG5_TLS char     mmgWarn4=0,mmgWarn5=0,mmgWarn6=0,mmgWarn7=0;
+  static _MMG5_TLS char     mmgWarn8=0;
 
   nex = 0;
   
@@ -85,7 +87,7 @@ int MMG2_bdryenforcement(MMG5_pMesh mesh,MMG5_pSol sol) {
       if ( !mmgWarn0 ) {
         mmgWarn0=1;
         fprintf(stderr,"\n  ## Error: %s: at least 1 wrong ball "
-                "(point %d of triangle %d).\n",__func__,
+                "(point %" MMG5_PRId " of triangle %" MMG5_PRId ").\n",__func__,
                 _MMG2D_indPt(mesh, mesh->tria[kdep].v[j]),_MMG2D_indElt(mesh,kdep));
       }
       return(0);
@@ -113,7 +115,7 @@ int MMG2_bdryenforcement(MMG5_pMesh mesh,MMG5_pSol sol) {
     if ( l >= lon ) {
       if ( (mesh->info.imprim > 5) && (!mmgWarn1) ) {
         mmgWarn1 = 1;
-        fprintf(stderr,"\n  ## Error: %s: at least 1 missing edge (%d %d).\n",
+        fprintf(stderr,"\n  ## Error: %s: at least 1 missing edge (%" MMG5_PRId " %" MMG5_PRId ").\n",
                 __func__,_MMG2D_indPt(mesh,ped->a),_MMG2D_indPt(mesh,ped->b));
       }
       ped->base = kdep;
@@ -123,7 +125,7 @@ int MMG2_bdryenforcement(MMG5_pMesh mesh,MMG5_pSol sol) {
   /* Now treat the missing edges */
   if ( nex != mesh->na ) {
     if(mesh->info.imprim > 5)
-      printf(" ** number of missing edges : %d\n",mesh->na-nex);
+      printf(" ** number of missing edges : %" MMG5_PRId "\n",mesh->na-nex);
     
     for (kk=1; kk<=mesh->na; kk++) {
       ped = &mesh->edge[kk];
@@ -133,7 +135,7 @@ int MMG2_bdryenforcement(MMG5_pMesh mesh,MMG5_pSol sol) {
       kdep = ped->base;
       
       if(mesh->info.ddebug)
-        printf("\n  -- edge enforcement %d %d\n",ia,ib);
+        printf("\n  -- edge enforcement %" MMG5_PRId " %" MMG5_PRId "\n",ia,ib);
 
       if ( !(lon=MMG2_locateEdge(mesh,ia,ib,&kdep,list)) ) {
         if ( mesh->info.ddebug && (!mmgWarn2) ) {
@@ -148,7 +150,7 @@ int MMG2_bdryenforcement(MMG5_pMesh mesh,MMG5_pSol sol) {
         if ( mesh->info.ddebug && (!mmgWarn3) ) {
           mmgWarn3=1;
           fprintf(stderr,"\n ## Error: %s: Unable to force at least"
-                  " 1 edge (%d %d -- %d).\n",__func__,_MMG2D_indPt(mesh,ia),
+                  " 1 edge (%" MMG5_PRId " %" MMG5_PRId " -- %d).\n",__func__,_MMG2D_indPt(mesh,ia),
                   _MMG2D_indPt(mesh,ib),lon);
         }
         return 0;
@@ -221,7 +223,7 @@ int MMG2_bdryenforcement(MMG5_pMesh mesh,MMG5_pSol sol) {
               ilon--;
               if ( mesh->info.ddebug && (!mmgWarn8) ) {
                 mmgWarn8 = 1;
-                fprintf(stderr,"\n  ## Warning: %s: at least 1 triangle (%d)"
+                fprintf(stderr,"\n  ## Warning: %s: at least 1 triangle (%" MMG5_PRId ")"
                         " not intersected ==> %d\n",__func__,
                         _MMG2D_indElt(mesh,list2[ied]),ilon);
               }
@@ -233,7 +235,7 @@ int MMG2_bdryenforcement(MMG5_pMesh mesh,MMG5_pSol sol) {
             }
             else {
               if ( mesh->info.ddebug )
-                printf("  ** tr intersected %d \n",list2[ied]);
+                printf("  ** tr intersected %" MMG5_PRId " \n",list2[ied]);
               mesh->tria[list2[ied]].base = mesh->base+1;
             }
           }
@@ -26,7 +26,7 @@
 #define KTB    11
 
 int MMG2_hashNew(HashTable *hash,int hsize,int hmax) {
-  int   k;
+  MMG5_int k;
 
   hash->size  = hsize;
   hash->nxtmax =hmax+1;
@@ -39,6 +39,31 @@ int MMG2_hashNew(HashTable *hash,int hsize,int hmax) {
   return(1);
 }
 
+#ifdef _OPENMP
+/**
+ * \param mesh pointer toward the mesh
+ * \param k index of the triangle
+ * \param i index of the edge in the triangle
+ * \param f sorted vertices of the edge (f[2] is 0)
+ * \return 0 if the triangle is unused, 1 otherwise
+ *
+ * Edge vertices for the parallel hashing of the triangles
+ *
+ */
+static int MMG2_hashTriaEdge(MMG5_pMesh mesh,MMG5_int k,int i,MMG5_int *f) {
+  MMG5_pTria     pt;
+
+  pt = &mesh->tria[k];
+  if ( !pt->v[0] )  return(0);
+
+  f[0] = M_MIN(pt->v[MMG2_idir[i+1]],pt->v[MMG2_idir[i+2]]);
+  f[1] = M_MAX(pt->v[MMG2_idir[i+1]],pt->v[MMG2_idir[i+2]]);
+  f[2] = 0;
+
+  return(1);
+}
+#endif
+
 /**
  * \param mesh pointer toward the mesh
  * \return 1 if success, 0 if fail
@@ -48,8 +73,8 @@ int MMG2_hashNew(HashTable *hash,int hsize,int hmax) {
  */
 int MMG2_hashTria(MMG5_pMesh mesh) {
   MMG5_pTria     pt,pt1;
-  int       k,kk,pp,l,ll,mins,mins1,maxs,maxs1;
-  int      *hcode,*link,inival,hsize,iadr;
+  MMG5_int  k,l,mins,mins1,maxs,maxs1,ll,kk,pp,inival;
+  MMG5_int *link,hsize,iadr,*hcode;
   unsigned char   i,ii,i1,i2;
   unsigned int    key;
 
@@ -57,19 +82,24 @@ int MMG2_hashTria(MMG5_pMesh mesh) {
   if ( !mesh->nt )  return(0);
 
   /* memory alloc */
-  _MMG5_SAFE_CALLOC(hcode,mesh->nt+1,int,0);
-
-  /* memory alloc */
-  _MMG5_ADD_MEM(mesh,(3*mesh->ntmax+5)*sizeof(int),"adjacency table",
+  _MMG5_ADD_MEM(mesh,(3*mesh->ntmax+5)*sizeof(MMG5_int),"adjacency table",
                 printf("  Exit program.\n");
                 return 0;);
-  _MMG5_SAFE_CALLOC(mesh->adja,3*mesh->ntmax+5,int,0);
+  _MMG5_SAFE_CALLOC(mesh->adja,3*mesh->ntmax+5,MMG5_int,0);
+
+#ifdef _OPENMP
+  if ( mesh->info.nthreads > 1 ) {
+    return(_MMG5_hashAdjaPar(mesh,mesh->nt,3,mesh->adja,MMG2_hashTriaEdge));
+  }
+#endif
+
+  _MMG5_SAFE_CALLOC(hcode,mesh->nt+1,MMG5_int,0);
 
   link  = mesh->adja;
   hsize = mesh->nt;
 
   /* init */
-  inival = INT_MAX;
+  inival = MMG5_INTMAX;
   for (k=0; k<=mesh->nt; k++)
     hcode[k] = -inival;
 
@@ -91,7 +121,7 @@ int MMG2_hashTria(MMG5_pMesh mesh) {
       }
 
       /* compute key */
-      key = KTA*mins + KTB*maxs;
+      key = (unsigned int)(KTA*mins + KTB*maxs);
       key = key % hsize + 1;
 
       /* insert */
@@ -151,10 +181,10 @@ int MMG2_hashTria(MMG5_pMesh mesh) {
 
 /*hash edge :
   return 1 if edge exist in the table*/
-int MMG2_hashEdge(pHashTable edgeTable,int iel,int ia, int ib) {
-  int         key,mins,maxs;
+MMG5_int MMG2_hashEdge(pHashTable edgeTable,MMG5_int iel,MMG5_int ia, MMG5_int ib) {
+  MMG5_int    mins,maxs,key;
   Hedge      *ha;
-  static char mmgErr = 0;
+  static _MMG5_TLS char mmgErr = 0;
 
   /* compute key */
   if ( ia < ib ) {
@@ -186,7 +216,7 @@ int MMG2_hashEdge(pHashTable edgeTable,int iel,int ia, int ib) {
       if ( edgeTable->hnxt == edgeTable->nxtmax ) {
         if ( !mmgErr ) {
           mmgErr = 1;
-          fprintf(stderr,"\n  ## Error: %s: memory alloc problem (edge): %d.\n",
+          fprintf(stderr,"\n  ## Error: %s: memory alloc problem (edge): %" MMG5_PRId ".\n",
                   __func__,edgeTable->nxtmax);
         }
         return(0);
@@ -215,26 +245,19 @@ int MMG2_assignEdge(MMG5_pMesh mesh) {
   _MMG5_Hash      hash;
   MMG5_pTria      pt;
   MMG5_pEdge      pa;
-  int             k,ia;
+  MMG5_int        k,ia;
   char            i,i1,i2;
 
   if ( !mesh->na ) return(1);
 
   /* Temporarily allocate a hash structure for storing edges */
-  hash.siz = mesh->na;
-  hash.max = 3*mesh->na+1;
-
-  _MMG5_ADD_MEM(mesh,(hash.max+1)*sizeof(_MMG5_Hash),"hash table",return(0));
-  _MMG5_SAFE_CALLOC(hash.item,hash.max+1,_MMG5_hedge,0);
-
-  hash.nxt = mesh->na;
-
-  for (k=mesh->na; k<hash.max; k++)
-    hash.item[k].nxt = k+1;
+  if ( !_MMG5_hashNew(mesh,&hash,mesh->na,3*mesh->na) )  return(0);
 
   /* hash mesh edges */
-  for (k=1; k<=mesh->na; k++)
-    _MMG5_hashEdge(mesh,&hash,mesh->edge[k].a,mesh->edge[k].b,k);
+  for (k=1; k<=mesh->na; k++) {
+    if ( !_MMG5_hashEdge(mesh,&hash,mesh->edge[k].a,mesh->edge[k].b,k) )
+      return(0);
+  }
 
   /* set references to triangles */
   for (k=1; k<=mesh->nt; k++) {
@@ -254,7 +277,7 @@ int MMG2_assignEdge(MMG5_pMesh mesh) {
   }
 
   /* Delete the hash for edges */
-  _MMG5_DEL_MEM(mesh,hash.item,(hash.max+1)*sizeof(_MMG5_hedge));
+  _MMG5_DEL_MEM(mesh,hash.item,hash.siz*sizeof(_MMG5_hedge));
   _MMG5_DEL_MEM(mesh,mesh->edge,(mesh->na+1)*sizeof(MMG5_Edge));
   mesh->na = 0;
 
@@ -276,7 +299,8 @@ int MMG2_bdryEdge(MMG5_pMesh mesh) {
   MMG5_pTria      pt,pt1;
   MMG5_pEdge      pa;
   MMG5_pPoint     p0;
-  int             k,*adja,natmp,iel;
+  int             natmp;
+  MMG5_int        k,*adja,iel;
   char            i,i1,i2;
 
   natmp = 0;
@@ -355,8 +379,10 @@ int MMG2_pack(MMG5_pMesh mesh,MMG5_pSol sol) {
   MMG5_pTria         pt,ptnew,pt1;
   MMG5_pEdge         ped;
   MMG5_pPoint        ppt,pptnew;
-  int                np,ned,nt,k,iel,nbl,isol,isolnew,memWarn,nc;
-  int                iadr,iadrnew,iadrv,*adjav,*adja,*adjanew,voy;
+  int                np,ned,nt,nbl,isolnew,memWarn,nc;
+  MMG5_int           k,isol,iel;
+  int                iadrnew,voy;
+  MMG5_int           iadr,*adjav,*adja,*adjanew,iadrv;
   char               i,i1,i2;
 
   /* Recreate adjacencies if need be */
@@ -583,11 +609,11 @@ int MMG2_pack(MMG5_pMesh mesh,MMG5_pSol sol) {
   }
 
   if ( mesh->info.imprim > 0 ) {
-    fprintf(stdout,"     NUMBER OF VERTICES   %8d   CORNERS %8d\n",mesh->np,nc);
-    fprintf(stdout,"     NUMBER OF TRIANGLES  %8d\n",mesh->nt);
+    fprintf(stdout,"     NUMBER OF VERTICES   %8" MMG5_PRId "   CORNERS %8d\n",mesh->np,nc);
+    fprintf(stdout,"     NUMBER OF TRIANGLES  %8" MMG5_PRId "\n",mesh->nt);
 
     if ( mesh->na )
-      fprintf(stdout,"     NUMBER OF EDGES      %8d\n",mesh->na);
+      fprintf(stdout,"     NUMBER OF EDGES      %8" MMG5_PRId "\n",mesh->na);
   }
 
   if ( memWarn ) return 0;
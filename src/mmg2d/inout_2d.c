@@ -77,22 +77,23 @@ double MMG_swapd(double sbin)
 /* read mesh data */
 int MMG2D_loadMesh(MMG5_pMesh mesh,const char *filename) {
   FILE        *inm;
+  _MMG5_BinFile     bf;
   MMG5_pPoint       ppt;
   MMG5_pEdge        ped;
   MMG5_pTria        pt;
   MMG5_pQuad        pq1;
   float             fc;
   long         posnp,posnt,posncor,posned,posnq,posreq,posreqed,posntreq;
-  int          k,ref,tmp,ncor,norient,nreq,ntreq,nreqed,bin,iswp,nq;
+  int          ref,norient,bin;
+  MMG5_int     k,tmp,nq,ncor,nreq,ntreq,nreqed;
   char        *ptr,*data,chaine[128];
   double       air,dtmp;
-  int          i,bdim,binch,bpos;
+  int          i;
 
 
   posnp = posnt = posncor = posned = posnq = posreq = posreqed = posntreq = 0;
   ncor = nreq = nreqed = ntreq = 0;
   bin = 0;
-  iswp = 0;
   mesh->np = mesh->nt = mesh->na = mesh->xp = 0;
   nq = 0;
 
@@ -151,155 +152,68 @@ int MMG2D_loadMesh(MMG5_pMesh mesh,const char *filename) {
         continue;
       }
       else if(!strncmp(chaine,"Vertices",strlen("Vertices"))) {
-        fscanf(inm,"%d",&mesh->np);
+        fscanf(inm,"%" MMG5_SCNd,&mesh->np);
         posnp = ftell(inm);
         continue;
       }
       else if(!strncmp(chaine,"Triangles",strlen("Triangles"))) {
-        fscanf(inm,"%d",&mesh->nt);
+        fscanf(inm,"%" MMG5_SCNd,&mesh->nt);
         posnt = ftell(inm);
         continue;
       }
       else if(!strncmp(chaine,"Corners",strlen("Corners"))) {
-        fscanf(inm,"%d",&ncor);
+        fscanf(inm,"%" MMG5_SCNd,&ncor);
         posncor = ftell(inm);
         continue;
       }
       else if(!strncmp(chaine,"RequiredVertices",strlen("RequiredVertices"))) {
-        fscanf(inm,"%d",&nreq);
+        fscanf(inm,"%" MMG5_SCNd,&nreq);
         posreq = ftell(inm);
         continue;
       }
       else if(!strncmp(chaine,"Edges",strlen("Edges"))) {
-        fscanf(inm,"%d",&mesh->na);
+        fscanf(inm,"%" MMG5_SCNd,&mesh->na);
         posned = ftell(inm);
         continue;
       }
       else if(!strncmp(chaine,"RequiredEdges",strlen("RequiredEdges"))) {
-        fscanf(inm,"%d",&nreqed);
+        fscanf(inm,"%" MMG5_SCNd,&nreqed);
         posreqed = ftell(inm);
         continue;
       }
       else if(!strncmp(chaine,"RequiredTriangles",strlen("RequiredTriangles"))) {
-        fscanf(inm,"%d",&ntreq);
+        fscanf(inm,"%" MMG5_SCNd,&ntreq);
         posntreq = ftell(inm);
         continue;
       }
       else if(!strncmp(chaine,"Quadrilaterals",strlen("Quadrilaterals"))) {
-        fscanf(inm,"%d",&nq);
+        fscanf(inm,"%" MMG5_SCNd,&nq);
         posnq = ftell(inm);
         continue;
       }
     }
   }
   else {
-    bdim = 0;
-    fread(&mesh->ver,sw,1,inm);
-    iswp=0;
-    if(mesh->ver==16777216)
-      iswp=1;
-    else if(mesh->ver!=1) {
-      fprintf(stdout,"BAD FILE ENCODING\n");
-    }
-    fread(&mesh->ver,sw,1,inm);
-    if(iswp) mesh->ver = MMG_swapbin(mesh->ver);
-    while(fread(&binch,sw,1,inm)!=0 && binch!=54 ) {
-      if(iswp) binch=MMG_swapbin(binch);
-      if(binch==54) break;
-      if(!bdim && binch==3) {  //Dimension
-        fread(&bdim,sw,1,inm);  //NulPos=>20
-        if(iswp) bdim=MMG_swapbin(bdim);
-        fread(&bdim,sw,1,inm);
-        if(iswp) bdim=MMG_swapbin(bdim);
-        mesh->dim = bdim;
-        if(bdim!=2) {
-          fprintf(stdout,"BAD MESH DIMENSION : %d\n",mesh->dim);
-          return 0;
-        }
-        continue;
-      } else if(!mesh->np && binch==4) {  //Vertices
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=MMG_swapbin(bpos);
-        fread(&mesh->np,sw,1,inm);
-        if(iswp) mesh->np=MMG_swapbin(mesh->np);
-        posnp = ftell(inm);
-        rewind(inm);
-        fseek(inm,bpos,SEEK_SET);
-        continue;
-      }  else if(!mesh->nt && binch==6) {//MMG5_Triangles
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=MMG_swapbin(bpos);
-        fread(&mesh->nt,sw,1,inm);
-        if(iswp) mesh->nt=MMG_swapbin(mesh->nt);
-        posnt = ftell(inm);
-        rewind(inm);
-        fseek(inm,bpos,SEEK_SET);
-        continue;
-      }
-        else if(binch==17) {  //RequiredTriangles
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=MMG_swapbin(bpos);
-        fread(&ntreq,sw,1,inm);
-        if(iswp) ntreq=MMG_swapbin(ntreq);
-        posntreq = ftell(inm);
-        rewind(inm);
-        fseek(inm,bpos,SEEK_SET);
-        continue;
-      } else if(!mesh->nquad && binch==7) {//Quadrilaterals
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=MMG_swapbin(bpos);
-        fread(&mesh->nquad,sw,1,inm);
-        if(iswp) mesh->nquad=MMG_swapbin(mesh->nquad);
-        posnq = ftell(inm);
-        rewind(inm);
-        fseek(inm,bpos,SEEK_SET);
-        continue;
-      } else if(!ncor && binch==13) {
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=MMG_swapbin(bpos);
-        fread(&ncor,sw,1,inm);
-        if(iswp) ncor=MMG_swapbin(ncor);
-        posncor = ftell(inm);
-        rewind(inm);
-        fseek(inm,bpos,SEEK_SET);
-        continue;
-      } else if(!mesh->na && binch==5) { //Edges
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=MMG_swapbin(bpos);
-        fread(&mesh->na,sw,1,inm);
-        if(iswp) mesh->na=MMG_swapbin(mesh->na);
-        posned = ftell(inm);
-        rewind(inm);
-        fseek(inm,bpos,SEEK_SET);
-        continue;
-      } else if(!nreqed && binch==16) { //RequiredEdges
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=MMG_swapbin(bpos);
-        fread(&nreqed,sw,1,inm);
-        if(iswp) nreqed=MMG_swapbin(nreqed);
-        posreqed = ftell(inm);
-        rewind(inm);
-        fseek(inm,bpos,SEEK_SET);
-        continue;
-      } else if(!nreq && binch==15) { //RequiredVertices
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=MMG_swapbin(bpos);
-        fread(&nreq,sw,1,inm);
-        if(iswp) nreq=MMG_swapbin(nreq);
-        posreq = ftell(inm);
-        rewind(inm);
-        fseek(inm,bpos,SEEK_SET);
-        continue;
-      } else {
-        //printf("on traite ? %d\n",binch);
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=MMG_swapbin(bpos);
-        //printf("on avance... Nulpos %d\n",bpos);
-        rewind(inm);
-        fseek(inm,bpos,SEEK_SET);
-      }
+    if ( !_MMG5_openBinFile(inm,&bf) ) {
+      fclose(inm);
+      return(0);
     }
-
+    mesh->ver = bf.ver;
+    mesh->dim = (int)bf.nel[3]; //Dimension
+    if ( mesh->dim!=2 ) {
+      fprintf(stdout,"BAD MESH DIMENSION : %d\n",mesh->dim);
+      _MMG5_closeBinFile(&bf);
+      fclose(inm);
+      return 0;
+    }
+    mesh->np    = bf.nel[4];  posnp    = bf.pos[4];  //Vertices
+    mesh->nt    = bf.nel[6];  posnt    = bf.pos[6];  //Triangles
+    ntreq       = bf.nel[17]; posntreq = bf.pos[17]; //RequiredTriangles
+    mesh->nquad = bf.nel[7];  posnq    = bf.pos[7];  //Quadrilaterals
+    ncor        = bf.nel[13]; posncor  = bf.pos[13]; //Corners
+    mesh->na    = bf.nel[5];  posned   = bf.pos[5];  //Edges
+    nreqed      = bf.nel[16]; posreqed = bf.pos[16]; //RequiredEdges
+    nreq        = bf.nel[15]; posreq   = bf.pos[15]; //RequiredVertices
   }
 
   if ( abs(mesh->info.imprim) > 5 )
@@ -307,6 +221,8 @@ int MMG2D_loadMesh(MMG5_pMesh mesh,const char *filename) {
 
   if ( !mesh->np  ) {
     fprintf(stdout,"  ** MISSING DATA : no point\n");
+    if ( bin ) _MMG5_closeBinFile(&bf);
+    fclose(inm);
     return(0);
   }
 
@@ -322,12 +238,35 @@ int MMG2D_loadMesh(MMG5_pMesh mesh,const char *filename) {
   if ( !MMG2D_zaldy(mesh) )  return(0);
 
   /* Read vertices */
-  rewind(inm);
-  fseek(inm,posnp,SEEK_SET);
+  if ( bin ) {
+    if ( mesh->info.nreg==2 ) {
+      fprintf(stderr,"  ## Warning: %s: binary not available with"
+              " -msh option.\n",__func__);
+      _MMG5_closeBinFile(&bf);
+      fclose(inm);
+      return(0);
+    }
+    /* copy the vertex and element blocks straight from the mapped file */
+    if ( !_MMG5_binReadPoints(mesh,&bf,2) ||
+         ( mesh->na && !_MMG5_binCopyElt(&bf,posned,mesh->na,2,
+                                      &mesh->edge[1].a,sizeof(MMG5_Edge)) ) ||
+         ( mesh->nt && !_MMG5_binCopyElt(&bf,posnt,mesh->nt,3,
+                                      mesh->tria[1].v,sizeof(MMG5_Tria)) ) ||
+         ( mesh->nquad && !_MMG5_binCopyElt(&bf,posnq,mesh->nquad,4,
+                                         mesh->quadra[1].v,sizeof(MMG5_Quad)) ) ) {
+      _MMG5_closeBinFile(&bf);
+      fclose(inm);
+      return(0);
+    }
+  }
+  else {
+    rewind(inm);
+    fseek(inm,posnp,SEEK_SET);
+  }
   for (k=1; k<=mesh->np; k++) {
     ppt = &mesh->point[k];
-    if (mesh->ver < 2) { /*float*/
-      if (!bin) {
+    if ( !bin ) {
+      if (mesh->ver < 2) { /*float*/
         if(mesh->info.nreg==2) {
           for (i=0 ; i<3 ; i++) {
             fscanf(inm,"%f",&fc);
@@ -342,53 +281,23 @@ int MMG2D_loadMesh(MMG5_pMesh mesh,const char *filename) {
         }
         fscanf(inm,"%d",&ppt->ref);
       } else {
-        if(mesh->info.nreg==2) {
-          fprintf(stderr,"  ## Warning: %s: binary not available with"
-                  " -msh option.\n",__func__);
-          return(0);
-        }
-        for (i=0 ; i<2 ; i++) {
-          fread(&fc,sw,1,inm);
-          if(iswp) fc=MMG_swapf(fc);
-          ppt->c[i] = (double) fc;
-        }
-        fread(&ppt->ref,sw,1,inm);
-        if(iswp) ppt->ref=MMG_swapbin(ppt->ref);
-      }
-    } else {
-      if (!bin) {
         if(mesh->info.nreg==2) {
           fscanf(inm,"%lf %lf %lf %d",&ppt->c[0],&ppt->c[1],&dtmp,&ppt->ref);
         } else {
           fscanf(inm,"%lf %lf %d",&ppt->c[0],&ppt->c[1],&ppt->ref);
         }
       }
-      else {
-        for (i=0 ; i<2 ; i++) {
-          fread(&ppt->c[i],sd,1,inm);
-          if(iswp) ppt->c[i]=MMG_swapd(ppt->c[i]);
-        }
-        fread(&ppt->ref,sw,1,inm);
-        if(iswp) ppt->ref=MMG_swapbin(ppt->ref);
-      }
     }
     ppt->tag = MG_NUL;
   }
 
   /* Read edges */
-  rewind(inm);
-  fseek(inm,posned,SEEK_SET);
-  for (k=1; k<=mesh->na; k++) {
-    ped = &mesh->edge[k];
-    if (!bin)
-      fscanf(inm,"%d %d %d",&ped->a,&ped->b,&ped->ref);
-    else {
-      fread(&ped->a,sw,1,inm);
-      if(iswp) ped->a=MMG_swapbin(ped->a);
-      fread(&ped->b,sw,1,inm);
-      if(iswp) ped->b=MMG_swapbin(ped->b);
-      fread(&ped->ref,sw,1,inm);
-      if(iswp) ped->ref=MMG_swapbin(ped->ref);
+  if ( !bin ) {
+    rewind(inm);
+    fseek(inm,posned,SEEK_SET);
+    for (k=1; k<=mesh->na; k++) {
+      ped = &mesh->edge[k];
+      fscanf(inm,"%" MMG5_SCNd " %" MMG5_SCNd " %d",&ped->a,&ped->b,&ped->ref);
     }
   }
 
@@ -400,15 +309,7 @@ int MMG2D_loadMesh(MMG5_pMesh mesh,const char *filename) {
     for (k=1; k<=mesh->nt; k++) {
       pt = &mesh->tria[k];
       if (!bin)
-        fscanf(inm,"%d %d %d %d",&pt->v[0],&pt->v[1],&pt->v[2],&pt->ref);
-      else {
-        for (i=0 ; i<3 ; i++) {
-          fread(&pt->v[i],sw,1,inm);
-          if(iswp) pt->v[i]=MMG_swapbin(pt->v[i]);
-        }
-        fread(&pt->ref,sw,1,inm);
-        if(iswp) pt->ref=MMG_swapbin(pt->ref);
-      }
+        fscanf(inm,"%" MMG5_SCNd " %" MMG5_SCNd " %" MMG5_SCNd " %d",&pt->v[0],&pt->v[1],&pt->v[2],&pt->ref);
       for (i=0; i<3; i++) {
         ppt = &mesh->point[ pt->v[i] ];
         ppt->tag &= ~MG_NUL;
@@ -437,10 +338,8 @@ int MMG2D_loadMesh(MMG5_pMesh mesh,const char *filename) {
       for (k=1; k<=ntreq; k++) {
         if(!bin)
           fscanf(inm,"%d",&i);
-        else {
-          fread(&i,sw,1,inm);
-          if(iswp) i=MMG_swapbin(i);
-        }
+        else
+          i = _MMG5_binInt(&bf,posntreq+(k-1)*sw);
         if ( i>mesh->nt ) {
           fprintf(stderr,"\n  ## Warning: %s: required triangle number %8d"
                   " ignored.\n",__func__,i);
@@ -468,16 +367,8 @@ int MMG2D_loadMesh(MMG5_pMesh mesh,const char *filename) {
     for (k=1; k<=mesh->nquad; k++) {
       pq1 = &mesh->quadra[k];
       if (!bin)
-        fscanf(inm,"%d %d %d %d %d",&pq1->v[0],&pq1->v[1],&pq1->v[2],
+        fscanf(inm,"%" MMG5_SCNd " %" MMG5_SCNd " %" MMG5_SCNd " %" MMG5_SCNd " %d",&pq1->v[0],&pq1->v[1],&pq1->v[2],
                &pq1->v[3],&pq1->ref);
-      else {
-        for (i=0 ; i<4 ; i++) {
-          fread(&pq1->v[i],sw,1,inm);
-          if(iswp) pq1->v[i]=MMG_swapbin(pq1->v[i]);
-        }
-        fread(&pq1->ref,sw,1,inm);
-        if(iswp) pq1->ref=MMG_swapbin(pq1->ref);
-      }
     }
   }
 
@@ -488,10 +379,8 @@ int MMG2D_loadMesh(MMG5_pMesh mesh,const char *filename) {
     for (k=1; k<=ncor; k++) {
       if (!bin)
         fscanf(inm,"%d",&ref);
-      else {
-        fread(&ref,sw,1,inm);
-        if(iswp) ref=MMG_swapbin(ref);
-      }
+      else
+        ref = _MMG5_binInt(&bf,posncor+(k-1)*sw);
       ppt = &mesh->point[ref];
       ppt->tag |= MG_CRN;
     }
@@ -504,10 +393,8 @@ int MMG2D_loadMesh(MMG5_pMesh mesh,const char *filename) {
     for (k=1; k<=nreq; k++) {
       if (!bin)
         fscanf(inm,"%d",&ref);
-      else {
-        fread(&ref,sw,1,inm);
-        if(iswp) ref=MMG_swapbin(ref);
-      }
+      else
+        ref = _MMG5_binInt(&bf,posreq+(k-1)*sw);
       ppt = &mesh->point[ref];
       ppt->tag |= MG_REQ;
     }
@@ -520,10 +407,8 @@ int MMG2D_loadMesh(MMG5_pMesh mesh,const char *filename) {
     for (k=1; k<=nreqed; k++) {
       if (!bin)
         fscanf(inm,"%d",&ref);
-      else {
-        fread(&ref,sw,1,inm);
-        if(iswp) ref=MMG_swapbin(ref);
-      }
+      else
+        ref = _MMG5_binInt(&bf,posreqed+(k-1)*sw);
       ped = &mesh->edge[ref];
       ped->tag |= MG_REQ;
       ppt = &mesh->point[ped->a];
@@ -533,12 +418,13 @@ int MMG2D_loadMesh(MMG5_pMesh mesh,const char *filename) {
     }
   }
 
+  if ( bin ) _MMG5_closeBinFile(&bf);
   fclose(inm);
 
   /*maill periodique : remettre toutes les coord entre 0 et 1*/
   if(mesh->info.renum==-10) {
     if ( mesh->info.imprim > 4 || mesh->info.ddebug )
-      printf("  ## Periodic mesh: %d points %d triangles\n",mesh->np,mesh->nt);
+      printf("  ## Periodic mesh: %" MMG5_PRId " points %" MMG5_PRId " triangles\n",mesh->np,mesh->nt);
     for (k=1; k<=mesh->np; k++) {
       ppt = &mesh->point[k];
       while (ppt->c[0] > 1 + 5e-3) {
@@ -557,11 +443,11 @@ int MMG2D_loadMesh(MMG5_pMesh mesh,const char *filename) {
   }
 
   if ( abs(mesh->info.imprim) > 4 ) {
-    fprintf(stdout,"     NUMBER OF VERTICES   %8d  CORNERS    %6d\n",mesh->np,ncor);
-    fprintf(stdout,"     NUMBER OF TRIANGLES  %8d\n",mesh->nt);
+    fprintf(stdout,"     NUMBER OF VERTICES   %8" MMG5_PRId "  CORNERS    %6" MMG5_PRId "\n",mesh->np,ncor);
+    fprintf(stdout,"     NUMBER OF TRIANGLES  %8" MMG5_PRId "\n",mesh->nt);
 
     if ( mesh->na )
-      fprintf(stdout,"     NUMBER OF EDGES      %8d\n",mesh->na);
+      fprintf(stdout,"     NUMBER OF EDGES      %8" MMG5_PRId "\n",mesh->na);
   }
 
   return(1);
@@ -579,7 +465,7 @@ static inline
 int MMG2D_2dMshCheck(MMG5_pMesh mesh) {
   MMG5_pPoint ppt;
   double      z;
-  int         k;
+  MMG5_int    k;
 
   if (!mesh->nt) {
     for (k=1; k<=mesh->np; k++) {
@@ -604,56 +490,44 @@ int MMG2D_2dMshCheck(MMG5_pMesh mesh) {
 }
 
 int MMG2D_loadMshMesh(MMG5_pMesh mesh,MMG5_pSol sol,const char *filename) {
-  FILE*       inm;
-  long        posNodes,posElts,*posNodeData;
+  _MMG5_MshFile msh;
   int         ier;
-  int         bin,iswp,nelts,nsols;
 
   mesh->dim = 2;
 
-  ier = MMG5_loadMshMesh_part1(mesh,filename,&inm,
-                               &posNodes,&posElts,&posNodeData,
-                               &bin,&iswp,&nelts,&nsols);
+  ier = MMG5_loadMshMesh_part1(mesh,filename,&msh);
   if ( ier < 1 )  return (ier);
 
-  if ( nsols>1 ) {
-    fprintf(stderr,"SEVERAL SOLUTION => IGNORED: %d\n",nsols);
-    fclose(inm);
-    _MMG5_SAFE_FREE(posNodeData);
+  if ( msh.nsols>1 ) {
+    fprintf(stderr,"SEVERAL SOLUTION => IGNORED: %d\n",msh.nsols);
+    _MMG5_freeMshFile(&msh);
     return(-1);
   }
 
   if ( !MMG2D_zaldy(mesh) ) {
-    fclose(inm);
-    _MMG5_SAFE_FREE(posNodeData);
+    _MMG5_freeMshFile(&msh);
     return(0);
   }
 
   if ( mesh->ne || mesh->nprism ) {
     fprintf(stderr,"\n  ## Error: %s: Input mesh must be a two-dimensional mesh.\n",
             __func__);
-    fclose(inm);
-    _MMG5_SAFE_FREE(posNodeData);
+    _MMG5_freeMshFile(&msh);
     return(-1);
   }
   if ( !mesh->nt )
       fprintf(stdout,"  ** WARNING NO GIVEN TRIANGLE\n");
 
   if (mesh->npmax < mesh->np || mesh->ntmax < mesh->nt ) {
-    fclose(inm);
-    _MMG5_SAFE_FREE(posNodeData);
+    _MMG5_freeMshFile(&msh);
     return(-1);
   }
 
-  ier = MMG5_loadMshMesh_part2( mesh,&sol,&inm,
-                                posNodes,posElts,posNodeData,
-                                bin,iswp,nelts);
-
-  _MMG5_SAFE_FREE(posNodeData);
+  ier = MMG5_loadMshMesh_part2(mesh,&sol,&msh);
   if ( ier < 1 ) return ( ier );
 
   /* Check the metric type */
-  ier = MMG5_chkMetricType(mesh,&sol->type,inm);
+  ier = MMG5_chkMetricType(mesh,&sol->type,NULL);
   if ( ier <1 ) return ier;
 
   /* Mark all points as used in case of mesh generation and check the
@@ -667,53 +541,41 @@ int MMG2D_loadMshMesh(MMG5_pMesh mesh,MMG5_pSol sol,const char *filename) {
 }
 
 int MMG2D_loadMshMesh_and_allData(MMG5_pMesh mesh,MMG5_pSol *sol,const char *filename) {
-  FILE*       inm;
-  long        posNodes,posElts,*posNodeData;
+  _MMG5_MshFile msh;
   int         ier;
-  int         bin,iswp,nelts,nsols;
 
   mesh->dim = 2;
 
-  ier = MMG5_loadMshMesh_part1(mesh,filename,&inm,
-                               &posNodes,&posElts,&posNodeData,
-                               &bin,&iswp,&nelts,&nsols);
+  ier = MMG5_loadMshMesh_part1(mesh,filename,&msh);
   if ( ier < 1 )  return (ier);
 
   if ( *sol )  _MMG5_DEL_MEM(mesh,*sol,(mesh->nsols)*sizeof(MMG5_Sol));
 
-  _MMG5_ADD_MEM(mesh,nsols*sizeof(MMG5_Sol),"solutions array",
-                printf("  Exit program.\n"); fclose(inm);
-                _MMG5_SAFE_FREE(posNodeData);
+  _MMG5_ADD_MEM(mesh,msh.nsols*sizeof(MMG5_Sol),"solutions array",
+                printf("  Exit program.\n"); _MMG5_freeMshFile(&msh);
                 return -1);
-  _MMG5_SAFE_CALLOC(*sol,nsols,MMG5_Sol,-1);
+  _MMG5_SAFE_CALLOC(*sol,msh.nsols,MMG5_Sol,-1);
 
   if ( !MMG2D_zaldy(mesh) ) {
-    fclose(inm);
-    _MMG5_SAFE_FREE(posNodeData);
+    _MMG5_freeMshFile(&msh);
     return(0);
   }
 
   if ( mesh->ne || mesh->nprism ) {
     fprintf(stderr,"\n  ## Error: %s: Input mesh must be a two-dimensional mesh.\n",
             __func__);
-    fclose(inm);
-    _MMG5_SAFE_FREE(posNodeData);
+    _MMG5_freeMshFile(&msh);
     return(-1);
   }
   if ( !mesh->nt )
       fprintf(stdout,"  ** WARNING NO GIVEN TRIANGLE\n");
 
   if (mesh->npmax < mesh->np || mesh->ntmax < mesh->nt ) {
-    fclose(inm);
-    _MMG5_SAFE_FREE(posNodeData);
+    _MMG5_freeMshFile(&msh);
     return(-1);
   }
 
-  ier = MMG5_loadMshMesh_part2( mesh,sol,&inm,
-                                posNodes,posElts,posNodeData,
-                                bin,iswp,nelts);
-
-  _MMG5_SAFE_FREE(posNodeData);
+  ier = MMG5_loadMshMesh_part2(mesh,sol,&msh);
   if ( ier < 1 ) return ( ier );
 
   /* Mark all points as used in case of mesh generation and check the
@@ -734,7 +596,7 @@ int MMG2D_loadMshMesh_and_allData(MMG5_pMesh mesh,MMG5_pSol *sol,const char *fil
  *
  */
 static inline
-void MMG2D_readFloatSol(MMG5_pSol sol,FILE *inm,int bin,int iswp,int pos) {
+void MMG2D_readFloatSol(MMG5_pSol sol,FILE *inm,int bin,int iswp,MMG5_int pos) {
   float       fbuf;
   int         i;
 
@@ -762,7 +624,7 @@ void MMG2D_readFloatSol(MMG5_pSol sol,FILE *inm,int bin,int iswp,int pos) {
  *
  */
 static inline
-void MMG2D_readDoubleSol(MMG5_pSol sol,FILE *inm,int bin,int iswp,int pos) {
+void MMG2D_readDoubleSol(MMG5_pSol sol,FILE *inm,int bin,int iswp,MMG5_int pos) {
   double       dbuf;
   int          i;
 
@@ -791,8 +653,10 @@ void MMG2D_readDoubleSol(MMG5_pSol sol,FILE *inm,int bin,int iswp,int pos) {
 int MMG2D_loadSol(MMG5_pMesh mesh,MMG5_pSol sol,const char *filename) {
   FILE       *inm;
   long        posnp;
-  int         iswp,ier,dim;
-  int         k,ver,bin,np,nsols,*type;
+  int         iswp,ier;
+  MMG5_int    dim;
+  int         ver,bin,nsols,*type;
+  MMG5_int    k,np;
 
   /** Read the file header */
   ier =  MMG5_loadSolHeader(filename,2,&inm,&ver,&bin,&iswp,&np,&dim,&nsols,
@@ -809,8 +673,8 @@ int MMG2D_loadSol(MMG5_pMesh mesh,MMG5_pSol sol,const char *filename) {
 
   if ( mesh->np != np ) {
     fprintf(stderr,"  ** MISMATCHES DATA: THE NUMBER OF VERTICES IN "
-            "THE MESH (%d) DIFFERS FROM THE NUMBER OF VERTICES IN "
-            "THE SOLUTION (%d) \n",mesh->np,np);
+            "THE MESH (%" MMG5_PRId ") DIFFERS FROM THE NUMBER OF VERTICES IN "
+            "THE SOLUTION (%" MMG5_PRId ") \n",mesh->np,np);
     fclose(inm);
     _MMG5_SAFE_FREE(type);
     return(-1);
@@ -831,19 +695,27 @@ int MMG2D_loadSol(MMG5_pMesh mesh,MMG5_pSol sol,const char *filename) {
   _MMG5_SAFE_FREE(type);
 
   /* Read mesh solutions */
-  rewind(inm);
-  fseek(inm,posnp,SEEK_SET);
-
-  if ( sol->ver == 1 ) {
-    /* Simple precision */
-    for (k=1; k<=sol->np; k++) {
-      MMG2D_readFloatSol(sol,inm,bin,iswp,k);
+  if ( bin ) {
+    if ( !MMG5_readBinSols(sol,1,inm,posnp) ) {
+      fclose(inm);
+      return(-1);
     }
   }
   else {
-    for (k=1; k<=sol->np; k++) {
-      /* Double precision */
-      MMG2D_readDoubleSol(sol,inm,bin,iswp,k);
+    rewind(inm);
+    fseek(inm,posnp,SEEK_SET);
+
+    if ( sol->ver == 1 ) {
+      /* Simple precision */
+      for (k=1; k<=sol->np; k++) {
+        MMG2D_readFloatSol(sol,inm,bin,iswp,k);
+      }
+    }
+    else {
+      for (k=1; k<=sol->np; k++) {
+        /* Double precision */
+        MMG2D_readDoubleSol(sol,inm,bin,iswp,k);
+      }
     }
   }
 
@@ -868,10 +740,12 @@ int MMG2D_loadAllSols(MMG5_pMesh mesh,MMG5_pSol *sol, const char *filename) {
   MMG5_pSol   psl;
   FILE       *inm;
   long        posnp;
-  int         iswp,ier,dim;
-  int         j,k,ver,bin,np,nsols,*type;
+  int         iswp,ier;
+  MMG5_int    dim;
+  int         j,ver,bin,nsols,*type;
+  MMG5_int    k,np;
   char        data[10];
-  static char mmgWarn = 0;
+  static _MMG5_TLS char mmgWarn = 0;
 
   /** Read the file header */
   ier =  MMG5_loadSolHeader(filename,2,&inm,&ver,&bin,&iswp,&np,&dim,&nsols,
@@ -880,8 +754,8 @@ int MMG2D_loadAllSols(MMG5_pMesh mesh,MMG5_pSol *sol, const char *filename) {
 
   if ( mesh->np != np ) {
     fprintf(stderr,"  ** MISMATCHES DATA: THE NUMBER OF VERTICES IN "
-            "THE MESH (%d) DIFFERS FROM THE NUMBER OF VERTICES IN "
-            "THE SOLUTION (%d) \n",mesh->np,np);
+            "THE MESH (%" MMG5_PRId ") DIFFERS FROM THE NUMBER OF VERTICES IN "
+            "THE SOLUTION (%" MMG5_PRId ") \n",mesh->np,np);
     fclose(inm);
     _MMG5_SAFE_FREE(type);
     return(-1);
@@ -932,27 +806,36 @@ int MMG2D_loadAllSols(MMG5_pMesh mesh,MMG5_pSol *sol, const char *filename) {
   _MMG5_SAFE_FREE(type);
 
   /* read mesh solutions */
-  rewind(inm);
-  fseek(inm,posnp,SEEK_SET);
-
-  if ( (*sol)[0].ver == 1 ) {
-    /* Simple precision */
-    for (k=1; k<=mesh->np; k++) {
-      for ( j=0; j<nsols; ++j ) {
-        psl = *sol+j;
-        MMG2D_readFloatSol(psl,inm,bin,iswp,k);
-      }
+  if ( bin ) {
+    if ( !MMG5_readBinSols(*sol,nsols,inm,posnp) ) {
+      fclose(inm);
+      return(-1);
     }
   }
   else {
-    /* Double precision */
-    for (k=1; k<=mesh->np; k++) {
-      for ( j=0; j<nsols; ++j ) {
-        psl = *sol+j;
-        MMG2D_readDoubleSol(psl,inm,bin,iswp,k);
+    rewind(inm);
+    fseek(inm,posnp,SEEK_SET);
+
+    if ( (*sol)[0].ver == 1 ) {
+      /* Simple precision */
+      for (k=1; k<=mesh->np; k++) {
+        for ( j=0; j<nsols; ++j ) {
+          psl = *sol+j;
+          MMG2D_readFloatSol(psl,inm,bin,iswp,k);
+        }
+      }
+    }
+    else {
+      /* Double precision */
+      for (k=1; k<=mesh->np; k++) {
+        for ( j=0; j<nsols; ++j ) {
+          psl = *sol+j;
+          MMG2D_readDoubleSol(psl,inm,bin,iswp,k);
+        }
       }
     }
   }
+
   fclose(inm);
 
   /* stats */
@@ -961,14 +844,77 @@ int MMG2D_loadAllSols(MMG5_pMesh mesh,MMG5_pSol *sol, const char *filename) {
   return(1);
 }
 
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param data unused.
+ * \param k index of the point.
+ * \param buf buffer in which we write.
+ * \return the number of written characters (0 if the point is unused).
+ *
+ * Format the point \a k for the \a Vertices field of a \a .mesh file (with a
+ * null third coordinate if the mesh is saved in 3D).
+ *
+ */
+static int _MMG2_asciiVertex(MMG5_pMesh mesh,void *data,MMG5_int k,char *buf) {
+  MMG5_pPoint ppt;
+  int         len;
+
+  ppt = &mesh->point[k];
+  if ( !MG_VOK(ppt) )  return(0);
+
+  len  = _MMG5_fmtDouble(buf,ppt->c[0]);
+  buf[len++] = ' ';
+  len += _MMG5_fmtDouble(buf+len,ppt->c[1]);
+  buf[len++] = ' ';
+  if ( mesh->info.nreg ) {
+    buf[len++] = '0';
+    buf[len++] = '.';
+    buf[len++] = ' ';
+  }
+  len += _MMG5_fmtInt(buf+len,ppt->ref);
+  buf[len++] = '\n';
+
+  return(len);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param data unused.
+ * \param k index of the triangle.
+ * \param buf buffer in which we write.
+ * \return the number of written characters (0 if the triangle is unused).
+ *
+ * Format the triangle \a k for the \a Triangles field of a \a .mesh file.
+ *
+ */
+static int _MMG2_asciiTria(MMG5_pMesh mesh,void *data,MMG5_int k,char *buf) {
+  MMG5_pTria pt;
+  int        i,len;
+
+  pt = &mesh->tria[k];
+  if ( !MG_EOK(pt) )  return(0);
+
+  len = 0;
+  for ( i=0; i<3; ++i ) {
+    len += _MMG5_fmtInt(buf+len,mesh->point[pt->v[i]].tmp);
+    buf[len++] = ' ';
+  }
+  len += _MMG5_fmtInt(buf+len,pt->ref);
+  buf[len++] = '\n';
+
+  return(len);
+}
+
 int MMG2D_saveMesh(MMG5_pMesh mesh,const char *filename) {
   FILE*             inm;
   MMG5_pPoint       ppt;
   MMG5_pEdge        ped;
   MMG5_pTria        pt;
   double            dblb;
-  int               k,ne,np,nc,nreq,nereq,nedreq,ref,ntang;
-  int               bin, binch, bpos;
+  int               ref,ntang;
+  MMG5_int          ne,np,nc,nreq,nereq,nedreq,k;
+  int               bin, binch;
+  int64_t           bpos;
   char              *ptr,*data,chaine[128];
 
   mesh->ver = 2;
@@ -1030,7 +976,7 @@ int MMG2D_saveMesh(MMG5_pMesh mesh,const char *filename) {
     binch = 3; //Dimension
     fwrite(&binch,sw,1,inm);
     bpos = 20; //Pos
-    fwrite(&bpos,sw,1,inm);
+    _MMG5_FWRITE_POS(bpos,inm,return(0));
     if(mesh->info.nreg) binch = 3; //Dimension
     else binch = 2;
     fwrite(&binch,sw,1,inm);
@@ -1047,41 +993,40 @@ int MMG2D_saveMesh(MMG5_pMesh mesh,const char *filename) {
   if ( !bin ) {
     strcpy(&chaine[0],"\n\nVertices\n");
     fprintf(inm,"%s",chaine);
-    fprintf(inm,"%d\n",np);
+    fprintf(inm,"%" MMG5_PRId "\n",np);
   }
   else {
     binch = 4; //Vertices
     fwrite(&binch,sw,1,inm);
     if ( mesh->info.nreg )
-      bpos += 12+(1+3*mesh->ver)*4*np; //NullPos
+      bpos += 12+(1+3*mesh->ver)*4*(int64_t)np; //NullPos
     else
-      bpos += 12+(1+2*mesh->ver)*4*np; //NullPos
+      bpos += 12+(1+2*mesh->ver)*4*(int64_t)np; //NullPos
 
-    fwrite(&bpos,sw,1,inm);
-    fwrite(&np,sw,1,inm);
+    _MMG5_FWRITE_POS(bpos,inm,return(0));
+    _MMG5_FWRITE_IDX(np,inm);
   }
   fflush(inm);
 
-  for (k=1; k<=mesh->np; k++) {
-    ppt = &mesh->point[k];
-    if ( MG_VOK(ppt) ) {
-      ref = ppt->ref;
-      if ( mesh->info.nreg ) {
-        if ( !bin )
-          fprintf(inm,"%.15lg %.15lg 0. %d\n",ppt->c[0],ppt->c[1],ref);
-        else {
+  if ( !bin ) {
+    if ( !_MMG5_saveAsciiRecords(mesh,inm,mesh->np,3*_MMG5_ASCIIDBL+_MMG5_ASCIIINT,
+                                 _MMG2_asciiVertex,NULL) ) {
+      fclose(inm);
+      return(0);
+    }
+  }
+  else {
+    for (k=1; k<=mesh->np; k++) {
+      ppt = &mesh->point[k];
+      if ( MG_VOK(ppt) ) {
+        ref = ppt->ref;
+        if ( mesh->info.nreg ) {
           dblb = 0.;
           fwrite((unsigned char*)&ppt->c[0],sd,1,inm);
           fwrite((unsigned char*)&ppt->c[1],sd,1,inm);
           fwrite((unsigned char*)&dblb,sd,1,inm);
           fwrite((unsigned char*)&ref,sw,1,inm);
         }
-      }
-      else {
-        if ( !bin ) {
-          fprintf(inm,"%.15lg %.15lg %d\n",ppt->c[0],ppt->c[1],ref);
-          fflush(inm);
-        }
         else {
           fwrite(&ppt->c[0],sd,1,inm);
           fwrite(&ppt->c[1],sd,1,inm);
@@ -1102,25 +1047,25 @@ int MMG2D_saveMesh(MMG5_pMesh mesh,const char *filename) {
     if ( !bin ) {
       strcpy(&chaine[0],"\n\nCorners\n");
       fprintf(inm,"%s",chaine);
-      fprintf(inm,"%d\n",nc);
+      fprintf(inm,"%" MMG5_PRId "\n",nc);
     }
     else
     {
       binch = 13; //
       fwrite(&binch,sw,1,inm);
-      bpos += 12+4*nc; //NullPos
-      fwrite(&bpos,sw,1,inm);
-      fwrite(&nc,sw,1,inm);
+      bpos += 12+4*(int64_t)nc; //NullPos
+      _MMG5_FWRITE_POS(bpos,inm,return(0));
+      _MMG5_FWRITE_IDX(nc,inm);
     }
 
     for (k=1; k<=mesh->np; k++) {
       ppt = &mesh->point[k];
       if ( MG_VOK(ppt) && (ppt->tag & MG_CRN) ) {
         if(!bin) {
-          fprintf(inm,"%d\n",ppt->tmp);
+          fprintf(inm,"%" MMG5_PRId "\n",ppt->tmp);
         }
         else {
-          fwrite(&ppt->tmp,sw,1,inm);
+          _MMG5_FWRITE_IDX(ppt->tmp,inm);
         }
       }
     }
@@ -1139,14 +1084,14 @@ int MMG2D_saveMesh(MMG5_pMesh mesh,const char *filename) {
     if ( !bin ) {
       strcpy(&chaine[0],"\n\nRequiredVertices\n");
       fprintf(inm,"%s",chaine);
-      fprintf(inm,"%d\n",nreq);
+      fprintf(inm,"%" MMG5_PRId "\n",nreq);
     }
     else {
       binch = 15; //
       fwrite(&binch,sw,1,inm);
-      bpos += 12+4*nreq; //NullPos
-      fwrite(&bpos,sw,1,inm);
-      fwrite(&nreq,sw,1,inm);
+      bpos += 12+4*(int64_t)nreq; //NullPos
+      _MMG5_FWRITE_POS(bpos,inm,return(0));
+      _MMG5_FWRITE_IDX(nreq,inm);
     }
     for (k=1; k<=mesh->np; k++) {
       ppt = &mesh->point[k];
@@ -1155,9 +1100,9 @@ int MMG2D_saveMesh(MMG5_pMesh mesh,const char *filename) {
         if ((ppt->tag & MG_REQ)
             /*&& ( (ppt->tag & MG_BDY) || (ppt->tag & MG_SD) ) */ ) {
           if(!bin)
-            fprintf(inm,"%d\n",ppt->tmp);
+            fprintf(inm,"%" MMG5_PRId "\n",ppt->tmp);
           else
-            fwrite(&ppt->tmp,sw,1,inm);
+            _MMG5_FWRITE_IDX(ppt->tmp,inm);
         }
       }
     }
@@ -1169,23 +1114,23 @@ int MMG2D_saveMesh(MMG5_pMesh mesh,const char *filename) {
     if(!bin) {
       strcpy(&chaine[0],"\n\nEdges\n");
       fprintf(inm,"%s",chaine);
-      fprintf(inm,"%d\n",mesh->na);
+      fprintf(inm,"%" MMG5_PRId "\n",mesh->na);
     }
     else {
       binch = 5; //Edges
       fwrite(&binch,sw,1,inm);
-      bpos += 12 + 3*4*mesh->na;//Pos
-      fwrite(&bpos,sw,1,inm);
-      fwrite(&mesh->na,sw,1,inm);
+      bpos += 12 + 3*4*(int64_t)mesh->na;//Pos
+      _MMG5_FWRITE_POS(bpos,inm,return(0));
+      _MMG5_FWRITE_IDX(mesh->na,inm);
     }
     for (k=1; k<=mesh->na; k++) {
       ped = &mesh->edge[k];
       if(!bin)
-        fprintf(inm,"%d %d %d\n",mesh->point[ped->a].tmp,mesh->point[ped->b].tmp,ped->ref);
+        fprintf(inm,"%" MMG5_PRId " %" MMG5_PRId " %d\n",mesh->point[ped->a].tmp,mesh->point[ped->b].tmp,ped->ref);
       else
       {
-        fwrite(&mesh->point[ped->a].tmp,sw,1,inm);
-        fwrite(&mesh->point[ped->b].tmp,sw,1,inm);
+        _MMG5_FWRITE_IDX(mesh->point[ped->a].tmp,inm);
+        _MMG5_FWRITE_IDX(mesh->point[ped->b].tmp,inm);
         fwrite(&ped->ref,sw,1,inm);
       }
       if ( ped->tag & MG_REQ ) nedreq++;
@@ -1195,22 +1140,22 @@ int MMG2D_saveMesh(MMG5_pMesh mesh,const char *filename) {
       if(!bin) {
         strcpy(&chaine[0],"\n\nRequiredEdges\n");
         fprintf(inm,"%s",chaine);
-        fprintf(inm,"%d\n",nedreq);
+        fprintf(inm,"%" MMG5_PRId "\n",nedreq);
       } else {
         binch = 16; //RequiredEdges
         fwrite(&binch,sw,1,inm);
-        bpos += 12 + 4*nedreq;//Pos
-        fwrite(&bpos,sw,1,inm);
-        fwrite(&nedreq,sw,1,inm);
+        bpos += 12 + 4*(int64_t)nedreq;//Pos
+        _MMG5_FWRITE_POS(bpos,inm,return(0));
+        _MMG5_FWRITE_IDX(nedreq,inm);
       }
       ne = 0;
       for (k=1; k<=mesh->na; k++) {
         ne++;
         if (  mesh->edge[k].tag & MG_REQ ) {
           if(!bin) {
-            fprintf(inm,"%d \n",ne);
+            fprintf(inm,"%" MMG5_PRId " \n",ne);
           } else {
-            fwrite(&ne,sw,1,inm);
+            _MMG5_FWRITE_IDX(ne,inm);
           }
         }
       }
@@ -1232,28 +1177,30 @@ int MMG2D_saveMesh(MMG5_pMesh mesh,const char *filename) {
     if ( !bin ) {
       strcpy(&chaine[0],"\n\nTriangles\n");
       fprintf(inm,"%s",chaine);
-      fprintf(inm,"%d\n",ne);
+      fprintf(inm,"%" MMG5_PRId "\n",ne);
     }
     else {
       binch = 6; //Triangles
       fwrite(&binch,sw,1,inm);
-      bpos += 12+16*ne; //Pos
-      fwrite(&bpos,sw,1,inm);
-      fwrite(&ne,sw,1,inm);
+      bpos += 12+16*(int64_t)ne; //Pos
+      _MMG5_FWRITE_POS(bpos,inm,return(0));
+      _MMG5_FWRITE_IDX(ne,inm);
     }
-    for (k=1; k<=mesh->nt; k++) {
-      pt = &mesh->tria[k];
-      if ( MG_EOK(pt) ) {
-        ref = pt->ref;
-        if ( !bin ) {
-          fprintf(inm,"%d %d %d %d\n",mesh->point[pt->v[0]].tmp,
-                  mesh->point[pt->v[1]].tmp,
-                  mesh->point[pt->v[2]].tmp,ref);
-        }
-        else {
-          fwrite(&mesh->point[pt->v[0]].tmp,sw,1,inm);
-          fwrite(&mesh->point[pt->v[1]].tmp,sw,1,inm);
-          fwrite(&mesh->point[pt->v[2]].tmp,sw,1,inm);
+    if ( !bin ) {
+      if ( !_MMG5_saveAsciiRecords(mesh,inm,mesh->nt,4*_MMG5_ASCIIINT,
+                                   _MMG2_asciiTria,NULL) ) {
+        fclose(inm);
+        return(0);
+      }
+    }
+    else {
+      for (k=1; k<=mesh->nt; k++) {
+        pt = &mesh->tria[k];
+        if ( MG_EOK(pt) ) {
+          ref = pt->ref;
+          _MMG5_FWRITE_IDX(mesh->point[pt->v[0]].tmp,inm);
+          _MMG5_FWRITE_IDX(mesh->point[pt->v[1]].tmp,inm);
+          _MMG5_FWRITE_IDX(mesh->point[pt->v[2]].tmp,inm);
           fwrite(&ref,sw,1,inm);
         }
       }
@@ -1262,13 +1209,13 @@ int MMG2D_saveMesh(MMG5_pMesh mesh,const char *filename) {
       if(!bin) {
         strcpy(&chaine[0],"\n\nRequiredTriangles\n");
         fprintf(inm,"%s",chaine);
-        fprintf(inm,"%d \n",nereq);
+        fprintf(inm,"%" MMG5_PRId " \n",nereq);
       } else {
         binch = 17; //ReqTriangles
         fwrite(&binch,sw,1,inm);
-        bpos += 12+4*nereq; //Pos
-        fwrite(&bpos,sw,1,inm);
-        fwrite(&nereq,sw,1,inm);
+        bpos += 12+4*(int64_t)nereq; //Pos
+        _MMG5_FWRITE_POS(bpos,inm,return(0));
+        _MMG5_FWRITE_IDX(nereq,inm);
       }
       ne = 0;
       for (k=1; k<=mesh->nt; k++) {
@@ -1278,9 +1225,9 @@ int MMG2D_saveMesh(MMG5_pMesh mesh,const char *filename) {
         if ( (pt->tag[0] & MG_REQ) && (pt->tag[1] & MG_REQ)
              && pt->tag[2] & MG_REQ ) {
           if(!bin) {
-            fprintf(inm,"%d \n",ne);
+            fprintf(inm,"%" MMG5_PRId " \n",ne);
           } else {
-            fwrite(&ne,sw,1,inm);
+            _MMG5_FWRITE_IDX(ne,inm);
           }
         }
       }
@@ -1393,7 +1340,7 @@ int MMG2D_saveMesh(MMG5_pMesh mesh,const char *filename) {
     fprintf(stdout,"     NUMBER OF TRIANGLES  %8d\n",ne);
 
     if ( mesh->na )
-      fprintf(stdout,"     NUMBER OF EDGES      %8d\n",mesh->na);
+      fprintf(stdout,"     NUMBER OF EDGES      %8" MMG5_PRId "\n",mesh->na);
   }
 
   fclose(inm);
@@ -1419,8 +1366,9 @@ int MMG2D_saveMshMesh_and_allData(MMG5_pMesh mesh,MMG5_pSol *sol,const char *fil
  *
  */
 static inline
-void MMG2D_writeDoubleSol(MMG5_pSol sol,FILE *inm,int bin,int pos) {
-  int          i,isol;
+void MMG2D_writeDoubleSol(MMG5_pSol sol,FILE *inm,int bin,MMG5_int pos) {
+  int          i;
+  MMG5_int     isol;
 
   isol = pos * sol->size;
 
@@ -1447,7 +1395,8 @@ void MMG2D_writeDoubleSol(MMG5_pSol sol,FILE *inm,int bin,int pos) {
 int MMG2D_saveSol(MMG5_pMesh mesh,MMG5_pSol sol,const char *filename) {
   FILE*        inm;
   MMG5_pPoint  ppt;
-  int          k,ier;
+  int          ier;
+  MMG5_int     k;
   int          binch,bin;
 
   if ( !sol->np )  return(1);
@@ -1459,12 +1408,20 @@ int MMG2D_saveSol(MMG5_pMesh mesh,MMG5_pSol sol,const char *filename) {
 
   if ( ier < 1 ) return ier;
 
-  for (k=1; k<=mesh->np; k++) {
-    ppt = &mesh->point[k];
-    if ( !MG_VOK(ppt) )  continue;
+  if ( !bin ) {
+    if ( !MMG5_saveAsciiSols(mesh,sol,1,inm,0) ) {
+      fclose(inm);
+      return(0);
+    }
+  }
+  else {
+    for (k=1; k<=mesh->np; k++) {
+      ppt = &mesh->point[k];
+      if ( !MG_VOK(ppt) )  continue;
 
-    MMG2D_writeDoubleSol(sol,inm,bin,k);
-    fprintf(inm,"\n");
+      MMG2D_writeDoubleSol(sol,inm,bin,k);
+      fprintf(inm,"\n");
+    }
   }
 
   /* End file */
@@ -1493,7 +1450,8 @@ int MMG2D_saveAllSols(MMG5_pMesh mesh,MMG5_pSol *sol,const char *filename) {
   FILE*        inm;
   MMG5_pPoint  ppt;
   MMG5_pSol    psl;
-  int          j,k,ier;
+  int          j,ier;
+  MMG5_int     k;
   int          binch,bin;
   int          *type,*size;
 
@@ -1517,15 +1475,23 @@ int MMG2D_saveAllSols(MMG5_pMesh mesh,MMG5_pSol *sol,const char *filename) {
 
   if ( ier < 1 ) return ier;
 
-  for (k=1; k<=mesh->np; k++) {
-    ppt = &mesh->point[k];
-    if ( !MG_VOK(ppt) )  continue;
+  if ( !bin ) {
+    if ( !MMG5_saveAsciiSols(mesh,*sol,mesh->nsols,inm,0) ) {
+      fclose(inm);
+      return(0);
+    }
+  }
+  else {
+    for (k=1; k<=mesh->np; k++) {
+      ppt = &mesh->point[k];
+      if ( !MG_VOK(ppt) )  continue;
 
-    for ( j=0; j<mesh->nsols; ++j ) {
-      psl = *sol + j;
-      MMG2D_writeDoubleSol(psl,inm,bin,k);
+      for ( j=0; j<mesh->nsols; ++j ) {
+        psl = *sol + j;
+        MMG2D_writeDoubleSol(psl,inm,bin,k);
+      }
+      fprintf(inm,"\n");
     }
-    fprintf(inm,"\n");
   }
 
   /* End file */
@@ -1546,7 +1512,8 @@ int _MMG2_savemesh_db(MMG5_pMesh mesh,char *filename,char pack) {
   MMG5_pTria         pt;
   MMG5_pEdge         pa;
   MMG5_pPoint        ppt,p0,p1,p2;
-  int                k,np,nt,nc;
+  int                np,nt,nc;
+  MMG5_int           k;
   FILE               *out;
   
   out = fopen(filename,"w");
@@ -1588,19 +1555,19 @@ int _MMG2_savemesh_db(MMG5_pMesh mesh,char *filename,char pack) {
       p0 = &mesh->point[pt->v[0]];
       p1 = &mesh->point[pt->v[1]];
       p2 = &mesh->point[pt->v[2]];
-      fprintf(out,"%d %d %d %d\n",p0->tmp,p1->tmp,p2->tmp,pt->ref);
+      fprintf(out,"%" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %d\n",p0->tmp,p1->tmp,p2->tmp,pt->ref);
     }
   }
   
   /* Print Edges */
   if ( mesh->na ) {
-    fprintf(out,"Edges\n %d\n\n",mesh->na);
+    fprintf(out,"Edges\n %" MMG5_PRId "\n\n",mesh->na);
     for (k=1; k<=mesh->na; k++) {
       pa = &mesh->edge[k];
       p1 = &mesh->point[pa->a];
       p2 = &mesh->point[pa->b];
-      if ( pack ) fprintf(out,"%d %d %d\n",p1->tmp,p2->tmp,pa->ref);
-      else        fprintf(out,"%d %d %d\n",pa->a,pa->b,pa->ref);
+      if ( pack ) fprintf(out,"%" MMG5_PRId " %" MMG5_PRId " %d\n",p1->tmp,p2->tmp,pa->ref);
+      else        fprintf(out,"%" MMG5_PRId " %" MMG5_PRId " %d\n",pa->a,pa->b,pa->ref);
     }
   }
   
@@ -1616,8 +1583,8 @@ int _MMG2_savemesh_db(MMG5_pMesh mesh,char *filename,char pack) {
     for (k=1; k<=mesh->np; k++) {
       ppt = &mesh->point[k];
       if ( MG_VOK(ppt) && ppt->tag & MG_CRN ) {
-        if ( pack )   fprintf(out,"%d\n",ppt->tmp);
-        else          fprintf(out,"%d\n",k);
+        if ( pack )   fprintf(out,"%" MMG5_PRId "\n",ppt->tmp);
+        else          fprintf(out,"%" MMG5_PRId "\n",k);
       }
     }
   }
@@ -1633,7 +1600,8 @@ int _MMG2_savemesh_db(MMG5_pMesh mesh,char *filename,char pack) {
 /* Custom version of Savemet for debugging purpose */
 int _MMG2_savemet_db(MMG5_pMesh mesh,MMG5_pSol met,char *filename,char pack) {
   MMG5_pPoint        ppt;
-  int                k,np;
+  int                np;
+  MMG5_int           k;
   char               *ptr,typ=0,*data;
   FILE               *out;
   
@@ -1693,7 +1661,8 @@ int _MMG2_savemet_db(MMG5_pMesh mesh,MMG5_pSol met,char *filename,char pack) {
 /* Save normal vector field for debugging purpose */
 int _MMG2_savenor_db(MMG5_pMesh mesh,char *filename,char pack) {
   MMG5_pPoint        ppt;
-  int                k,np;
+  int                np;
+  MMG5_int           k;
   char               *ptr,*data;
   FILE               *out;
 
@@ -1748,7 +1717,8 @@ int _MMG2_savenor_db(MMG5_pMesh mesh,char *filename,char pack) {
 /* Save displacement field for debugging purpose */
 int _MMG2_savedisp_db(MMG5_pMesh mesh,MMG5_pSol disp,char *filename,char pack) {
   MMG5_pPoint        ppt;
-  int                k,np;
+  int                np;
+  MMG5_int           k;
   char               *ptr,*data;
   FILE               *out;
 
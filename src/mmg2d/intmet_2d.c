@@ -35,9 +35,9 @@
 
 /* Interpolation of isotropic metric met along edge i of triangle k, according to parameter s;
    ip = index of the new point */
-int _MMG2_intmet_iso(MMG5_pMesh mesh,MMG5_pSol met,int k,char i,int ip,double s) {
+int _MMG2_intmet_iso(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,char i,MMG5_int ip,double s) {
   MMG5_pTria  pt;
-  int    ip1,ip2;
+  MMG5_int ip1,ip2;
   char   i1,i2;
   
   pt  = &mesh->tria[k];
@@ -54,7 +54,7 @@ int _MMG2_intmet_iso(MMG5_pMesh mesh,MMG5_pSol met,int k,char i,int ip,double s)
 int _MMG5_interpmet22(MMG5_pMesh mesh,double *m,double *n,double s,double *mr) {
   double      det,imn[4],dd,den,sqDelta,trimn,lambda[2],vp0[2],vp1[2],dm[2];
   double      dn[2],vnorm,d0,d1,ip[4];
-  static char mmgWarn0=0,mmgWarn1=0;
+  static _MMG5_TLS char mmgWarn0=0,mmgWarn1=0;
 
   /* Compute imn = M^{-1}N */
   det = m[0]*m[2] - m[1]*m[1];
@@ -234,12 +234,12 @@ int _MMG5_interpmet22(MMG5_pMesh mesh,double *m,double *n,double s,double *mr) {
 
 /* Interpolation of anisotropic metric met along edge i of triangle k, according to parameter s;
  ip = index of the new point */
-int _MMG2_intmet_ani(MMG5_pMesh mesh,MMG5_pSol met,int k,char i,int ip,double s) {
+int _MMG2_intmet_ani(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,char i,MMG5_int ip,double s) {
   MMG5_pTria     pt;
   double         *m1,*m2,*mr;
-  int            ip1,ip2;
+  MMG5_int       ip1,ip2;
   char           i1,i2;
-  static char    mmgWarn=0;
+  static _MMG5_TLS char    mmgWarn=0;
   
   pt = &mesh->tria[k];
   i1 = _MMG5_inxt2[i];
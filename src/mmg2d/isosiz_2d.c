@@ -48,7 +48,7 @@ int _MMG2_defsiz_iso(MMG5_pMesh mesh,MMG5_pSol met) {
   MMG5_pPoint      p1,p2;
   double           t1[2],t2[2],b1[2],b2[2],gpp1[2],gpp2[2],pv,M1,M2;
   double           ps1,ps2,ux,uy,ll,li,lm,hmax,hausd,hmin;
-  int              k,ip1,ip2;
+  MMG5_int         k,ip1,ip2;
   unsigned char    i,i1,i2;
 
 
@@ -173,7 +173,8 @@ int _MMG2_gradsiz_iso(MMG5_pMesh mesh,MMG5_pSol met) {
   MMG5_pTria        pt;
   MMG5_pPoint       p1,p2;
   double            hgrad,ll,h1,h2,hn;
-  int               k,it,ip1,ip2,maxit,nup,nu;
+  int               it,maxit,nup,nu;
+  MMG5_int          k,ip1,ip2;
   unsigned char     i,i1,i2;
 
 
@@ -22,6 +22,10 @@
 */
 #include "mmg2d.h"
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 /* Compute isotropic edge length */
 double long_iso(double *ca,double *cb,double *ma,double *mb) {
   double   ha,hb,ux,uy,dd,rap,len;
@@ -59,7 +63,7 @@ double long_ani(double *ca,double *cb,double *ma,double *mb) {
 }
 
 /** Calculate length of a curve in the considered isotropic metric */
-double _MMG2_lencurv_iso(MMG5_pMesh mesh,MMG5_pSol met,int ip1,int ip2) {
+double _MMG2_lencurv_iso(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int ip1,MMG5_int ip2) {
   MMG5_pPoint     p1,p2;
   double          h1,h2,len,l,r;
   
@@ -78,10 +82,10 @@ double _MMG2_lencurv_iso(MMG5_pMesh mesh,MMG5_pSol met,int ip1,int ip2) {
 }
 
 /* Calculate length of a curve in the considered anisotropic metric by using a two-point quadrature formula */
-double _MMG2_lencurv_ani(MMG5_pMesh mesh,MMG5_pSol met,int ip1,int ip2) {
+double _MMG2_lencurv_ani(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int ip1,MMG5_int ip2) {
   MMG5_pPoint      p1,p2;
   double           len,*m1,*m2,ux,uy,l1,l2;
-  static char      mmgWarn0=0,mmgWarn1=0;
+  static _MMG5_TLS char      mmgWarn0=0,mmgWarn1=0;
   
   p1 = &mesh->point[ip1];
   p2 = &mesh->point[ip2];
@@ -123,79 +127,83 @@ double _MMG2_lencurv_ani(MMG5_pMesh mesh,MMG5_pSol met,int ip1,int ip2) {
 /* print histo of edge lengths */
 int MMG2_prilen(MMG5_pMesh mesh,MMG5_pSol sol) {
   MMG5_pTria       pt;
-  double      lavg,len,ecart,som,lmin,lmax;
-  int         k,l,navg,ia,ipa,ipb,iamin,ibmin,iamax,ibmax,nullEdge,hl[9];
+  _MMG5_lenStat    *st,*ps;
+  double      len;
+  int         ia,ipa,ipb,nth;
+  MMG5_int    k,l;
   static double bd[9] = {0.0, 0.3, 0.6, 0.7071, 0.9, 1.3, 1.4142, 2.0, 5.0};
 
-  navg  = 0;
-  lavg  = 0.0;
-  lmin  = 1.e20;
-  lmax  = 0.0;
-  som   = 0.0;
-  iamin = 0;
-  ibmin = 0;
-  iamax = 0;
-  ibmax = 0;
-  nullEdge = 0;
-
-  for (k=0; k<9; k++)  hl[k] = 0;
-
-  for (k=1; k<=mesh->nt; k++) {
-    pt = &mesh->tria[k];
-    if ( !MG_EOK(pt) )  continue;
-
-    for (ia=0; ia<3; ia++) {
-      l = (&mesh->adja[3*(k-1)+1])[ia];
-      if ( l < 3*k )  continue;
-
-      ipa = MMG2_iare[ia][0];
-      ipb = MMG2_iare[ia][1];
-
-      if ( sol->m )
-        len = MMG2D_lencurv(mesh,sol,pt->v[ipa],pt->v[ipb]);
-      else
-        len = _MMG2_lencurv_iso(mesh,sol,pt->v[ipa],pt->v[ipb]);
-
-      navg++;
-      ecart = len;
-      lavg += len;
-
-      /* update efficiency index */
-      if ( ecart > 1.0 )  ecart = 1.0 / ecart;
-
-      som  += (ecart - 1.0);
-
-      /* find largest, smallest edge */
-      if (len < lmin) {
-        lmin  = len;
-        iamin = pt->v[ipa];
-        ibmin = pt->v[ipb];
-      }
-      if (len > lmax) {
-        lmax  = len;
-        iamax = pt->v[ipa];
-        ibmax = pt->v[ipb];
-      }
-
-      /* update histogram */
-      if (len < bd[3]) {
-        if (len > bd[2])       hl[2]++;
-        else if (len > bd[1])  hl[1]++;
-        else                   hl[0]++;
-      }
-      else if (len < bd[5]) {
-        if (len > bd[4])       hl[4]++;
-        else if (len > bd[3])  hl[3]++;
+#ifdef _OPENMP
+  nth = MG_MAX(1,mesh->info.nthreads);
+#else
+  nth = 1;
+#endif
+
+  _MMG5_SAFE_CALLOC(st,nth,_MMG5_lenStat,0);
+  _MMG5_initLenStat(st,nth,1.e20);
+
+#pragma omp parallel num_threads(nth) private(pt,ps,len,l,ia,ipa,ipb)
+  {
+#ifdef _OPENMP
+    ps = &st[omp_get_thread_num()];
+#else
+    ps = st;
+#endif
+#pragma omp for schedule(static)
+    for (k=1; k<=mesh->nt; k++) {
+      pt = &mesh->tria[k];
+      if ( !MG_EOK(pt) )  continue;
+
+      for (ia=0; ia<3; ia++) {
+        l = (&mesh->adja[3*(k-1)+1])[ia];
+        if ( l < 3*k )  continue;
+
+        ipa = MMG2_iare[ia][0];
+        ipb = MMG2_iare[ia][1];
+
+        if ( sol->m )
+          len = mesh->func.lencurv(mesh,sol,pt->v[ipa],pt->v[ipb]);
+        else
+          len = _MMG2_lencurv_iso(mesh,sol,pt->v[ipa],pt->v[ipb]);
+
+        ps->ned++;
+        ps->avlen += len;
+
+        /* find largest, smallest edge */
+        if (len < ps->lmin) {
+          ps->lmin = len;
+          ps->amin = pt->v[ipa];
+          ps->bmin = pt->v[ipb];
+        }
+        if (len > ps->lmax) {
+          ps->lmax = len;
+          ps->amax = pt->v[ipa];
+          ps->bmax = pt->v[ipb];
+        }
+
+        /* update histogram */
+        if (len < bd[3]) {
+          if (len > bd[2])       ps->hl[2]++;
+          else if (len > bd[1])  ps->hl[1]++;
+          else                   ps->hl[0]++;
+        }
+        else if (len < bd[5]) {
+          if (len > bd[4])       ps->hl[4]++;
+          else if (len > bd[3])  ps->hl[3]++;
+        }
+        else if (len < bd[6])    ps->hl[5]++;
+        else if (len < bd[7])    ps->hl[6]++;
+        else if (len < bd[8])    ps->hl[7]++;
+        else                     ps->hl[8]++;
       }
-      else if (len < bd[6])    hl[5]++;
-      else if (len < bd[7])    hl[6]++;
-      else if (len < bd[8])    hl[7]++;
-      else                     hl[8]++;
     }
   }
-  _MMG5_displayHisto(mesh, navg, &lavg, iamin, ibmin, lmin,
-                     iamax, ibmax, lmax,nullEdge, &bd[0], &hl[0],0);
+  _MMG5_mergeLenStat(st,nth);
 
+  _MMG5_displayHisto(mesh, st[0].ned, &st[0].avlen, st[0].amin, st[0].bmin,
+                     st[0].lmin, st[0].amax, st[0].bmax, st[0].lmax,
+                     st[0].nullEdge, &bd[0], &st[0].hl[0],0);
 
+  _MMG5_SAFE_FREE(st);
   return(1);
 }
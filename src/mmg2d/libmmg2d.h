@@ -75,6 +75,7 @@ enum MMG2D_Param {
   MMG2D_DPARAM_hausd,             /*!< [val], Control global Hausdorff distance (on all the boundary surfaces of the mesh) */
   MMG2D_DPARAM_hgrad,             /*!< [val], Control gradation */
   MMG2D_DPARAM_ls,                /*!< [val], Value of level-set (not use for now) */
+  MMG2D_IPARAM_nthreads,          /*!< [n], Number of threads used for the parallel loops (adjacency, output) */
 };
 
 /*----------------------------- functions header -----------------------------*/
@@ -258,12 +259,12 @@ int MMG2D_Set_dparameter(MMG5_pMesh mesh, MMG5_pSol sol, int dparam, double val)
  * \remark Fortran interface:
  * >   SUBROUTINE MMG2D_SET_MESHSIZE(mesh,np,nt,na,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
- * >     INTEGER                       :: np,nt,na\n
+ * >     MMG5F_INT                     :: np,nt,na\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
-int  MMG2D_Set_meshSize(MMG5_pMesh mesh, int np, int nt, int na);
+int  MMG2D_Set_meshSize(MMG5_pMesh mesh, MMG5_int np, MMG5_int nt, MMG5_int na);
 /**
  * \param mesh pointer toward the mesh structure.
  * \param sol pointer toward the sol structure.
@@ -277,13 +278,14 @@ int  MMG2D_Set_meshSize(MMG5_pMesh mesh, int np, int nt, int na);
  * \remark Fortran interface:
  * >   SUBROUTINE MMG2D_SET_SOLSIZE(mesh,sol,typEntity,np,typSol,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh,sol\n
- * >     INTEGER, INTENT(IN)           :: typEntity,np,typSol\n
+ * >     INTEGER, INTENT(IN)           :: typEntity,typSol\n
+ * >     MMG5F_INT, INTENT(IN)         :: np\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
 int MMG2D_Set_solSize(MMG5_pMesh mesh, MMG5_pSol sol, int typEntity,
-                      int np, int typSol);
+                      MMG5_int np, int typSol);
 
 /**
  * \param mesh pointer toward the mesh structure.
@@ -300,13 +302,14 @@ int MMG2D_Set_solSize(MMG5_pMesh mesh, MMG5_pSol sol, int typEntity,
  * >   SUBROUTINE MMG2D_SET_VERTEX(mesh,c0,c1,ref,pos,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
  * >     REAL(KIND=8), INTENT(IN)      :: c0,c1\n
- * >     INTEGER, INTENT(IN)           :: ref,pos\n
+ * >     INTEGER, INTENT(IN)           :: ref\n
+ * >     MMG5F_INT, INTENT(IN)         :: pos\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
 int  MMG2D_Set_vertex(MMG5_pMesh mesh, double c0, double c1,
-                      int ref,int pos);
+                      int ref,MMG5_int pos);
 /**
  * \param mesh pointer toward the mesh structure.
  * \param vertices table of the points coor.
@@ -341,12 +344,12 @@ int  MMG2D_Set_vertex(MMG5_pMesh mesh, double c0, double c1,
  *
  * >   SUBROUTINE MMG2D_SET_CORNER(mesh,k,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
- * >     INTEGER, INTENT(IN)           :: k\n
+ * >     MMG5F_INT, INTENT(IN)         :: k\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
-int  MMG2D_Set_corner(MMG5_pMesh mesh, int k);
+int  MMG2D_Set_corner(MMG5_pMesh mesh, MMG5_int k);
 /**
  * \param mesh pointer toward the mesh structure.
  * \param k vertex index.
@@ -357,12 +360,12 @@ int  MMG2D_Set_corner(MMG5_pMesh mesh, int k);
  * \remark Fortran interface:
  * >   SUBROUTINE MMG2D_SET_REQUIREDVERTEX(mesh,k,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
- * >     INTEGER, INTENT(IN)           :: k\n
+ * >     MMG5F_INT, INTENT(IN)         :: k\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
-int  MMG2D_Set_requiredVertex(MMG5_pMesh mesh, int k);
+int  MMG2D_Set_requiredVertex(MMG5_pMesh mesh, MMG5_int k);
 
 /**
  * \param mesh pointer toward the mesh structure.
@@ -379,13 +382,14 @@ int  MMG2D_Set_requiredVertex(MMG5_pMesh mesh, int k);
  * \remark Fortran interface:
  * >   SUBROUTINE MMG2D_SET_TRIANGLE(mesh,v0,v1,v2,ref,pos,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
- * >     INTEGER, INTENT(IN)           :: v0,v1,v2,ref,pos\n
+ * >     INTEGER, INTENT(IN)           :: ref\n
+ * >     MMG5F_INT, INTENT(IN)         :: v0,v1,v2,pos\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
-int MMG2D_Set_triangle(MMG5_pMesh mesh, int v0, int v1,
-                       int v2, int ref, int pos);
+int MMG2D_Set_triangle(MMG5_pMesh mesh, MMG5_int v0, MMG5_int v1,
+                       MMG5_int v2, int ref, MMG5_int pos);
 /**
  * \param mesh pointer toward the mesh structure.
  * \param tria pointer toward the table of the tria vertices
@@ -400,12 +404,13 @@ int MMG2D_Set_triangle(MMG5_pMesh mesh, int v0, int v1,
  * instead of the refs array)
  * > !  SUBROUTINE MMG2D_SET_TRIANGLES(mesh,tria,refs,retval)\n
  * > !    MMG5_DATA_PTR_T,INTENT(INOUT)    :: mesh\n
- * > !    INTEGER,DIMENSION(*), INTENT(IN) :: tria,refs\n
+ * > !    INTEGER,DIMENSION(*), INTENT(IN) :: refs\n
+ * > !    MMG5F_INT,DIMENSION(*), INTENT(IN) :: tria\n
  * > !    INTEGER, INTENT(OUT)             :: retval\n
  * > !  END SUBROUTINE\n
  *
  */
-  int  MMG2D_Set_triangles(MMG5_pMesh mesh, int *tria, int *refs);
+  int  MMG2D_Set_triangles(MMG5_pMesh mesh, MMG5_int *tria, int *refs);
 /**
  * \param mesh pointer toward the mesh structure.
  * \param k triangle index.
@@ -414,7 +419,7 @@ int MMG2D_Set_triangle(MMG5_pMesh mesh, int v0, int v1,
  * Set triangle \a k as required.
  *
  */
-int  MMG2D_Set_requiredTriangle(MMG5_pMesh mesh, int k);
+int  MMG2D_Set_requiredTriangle(MMG5_pMesh mesh, MMG5_int k);
 
 /**
  * \param mesh pointer toward the mesh structure.
@@ -430,12 +435,13 @@ int  MMG2D_Set_requiredTriangle(MMG5_pMesh mesh, int k);
  * \remark Fortran interface:
  * >   SUBROUTINE MMG2D_SET_EDGE(mesh,v0,v1,ref,pos,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
- * >     INTEGER, INTENT(IN)           :: v0,v1,ref,pos\n
+ * >     INTEGER, INTENT(IN)           :: ref\n
+ * >     MMG5F_INT, INTENT(IN)         :: v0,v1,pos\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
-int MMG2D_Set_edge(MMG5_pMesh mesh, int v0, int v1, int ref, int pos);
+int MMG2D_Set_edge(MMG5_pMesh mesh, MMG5_int v0, MMG5_int v1, int ref, MMG5_int pos);
 /**
  * \param mesh pointer toward the mesh structure.
  * \param k edge index.
@@ -446,12 +452,12 @@ int MMG2D_Set_edge(MMG5_pMesh mesh, int v0, int v1, int ref, int pos);
  * \remark Fortran interface:
  * >   SUBROUTINE MMG2D_SET_REQUIREDEDGE(mesh,k,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
- * >     INTEGER, INTENT(IN)           :: k\n
+ * >     MMG5F_INT, INTENT(IN)         :: k\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
-int  MMG2D_Set_requiredEdge(MMG5_pMesh mesh, int k);
+int  MMG2D_Set_requiredEdge(MMG5_pMesh mesh, MMG5_int k);
 /**
  * \param mesh pointer toward the mesh structure.
  * \param k edge index.
@@ -462,12 +468,12 @@ int  MMG2D_Set_requiredEdge(MMG5_pMesh mesh, int k);
  * \remark Fortran interface:
  * >   SUBROUTINE MMG2D_SET_PARALLELEDGE(mesh,k,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
- * >     INTEGER, INTENT(IN)           :: k\n
+ * >     MMG5F_INT, INTENT(IN)         :: k\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
-int  MMG2D_Set_parallelEdge(MMG5_pMesh mesh, int k);
+int  MMG2D_Set_parallelEdge(MMG5_pMesh mesh, MMG5_int k);
 /**
  * \param met pointer toward the sol structure.
  * \param s solution scalar value.
@@ -480,12 +486,12 @@ int  MMG2D_Set_parallelEdge(MMG5_pMesh mesh, int k);
  * >   SUBROUTINE MMG2D_SET_SCALARSOL(met,s,pos,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: met\n
  * >     REAL(KIND=8), INTENT(IN)      :: s\n
- * >     INTEGER, INTENT(IN)           :: pos\n
+ * >     MMG5F_INT, INTENT(IN)         :: pos\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
-int MMG2D_Set_scalarSol(MMG5_pSol met, double s, int pos);
+int MMG2D_Set_scalarSol(MMG5_pSol met, double s, MMG5_int pos);
 /**
  * \param met pointer toward the sol structure.
  * \param s table of the scalar solutions values.
@@ -517,13 +523,13 @@ int  MMG2D_Set_scalarSols(MMG5_pSol met, double *s);
  * >   SUBROUTINE MMG2D_SET_VECTORSOL(met,vx,vy,pos,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: met\n
  * >     REAL(KIND=8), INTENT(IN)      :: vx,vy\n
- * >     INTEGER, INTENT(IN)           :: pos\n
+ * >     MMG5F_INT, INTENT(IN)         :: pos\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
 int MMG2D_Set_vectorSol(MMG5_pSol met, double vx,double vy,
-                        int pos);
+                        MMG5_int pos);
 /**
  * \param met pointer toward the sol structure.
  * \param sols table of the vectorial solutions
@@ -555,13 +561,13 @@ int MMG2D_Set_vectorSols(MMG5_pSol met, double *sols);
  * >   SUBROUTINE MMG2D_SET_TENSORSOL(met,m11,m12,m22,pos,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: met\n
  * >     REAL(KIND=8), INTENT(IN)      :: m11,m12,m22\n
- * >     INTEGER, INTENT(IN)           :: pos\n
+ * >     MMG5F_INT, INTENT(IN)         :: pos\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
 int MMG2D_Set_tensorSol(MMG5_pSol met, double m11, double m12, double m22,
-                        int pos);
+                        MMG5_int pos);
 /**
  * \param met pointer toward the sol structure.
  * \param sols table of the tensorial solutions.
@@ -593,12 +599,12 @@ int MMG2D_Set_tensorSols(MMG5_pSol met, double *sols);
  * \remark Fortran interface:
  * >   SUBROUTINE MMG2D_GET_MESHSIZE(mesh,np,nt,na,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
- * >     INTEGER                       :: np,nt,na\n
+ * >     MMG5F_INT                     :: np,nt,na\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
-int  MMG2D_Get_meshSize(MMG5_pMesh mesh, int* np, int* nt, int* na);
+int  MMG2D_Get_meshSize(MMG5_pMesh mesh, MMG5_int* np, MMG5_int* nt, MMG5_int* na);
 /**
  * \param mesh pointer toward the mesh structure.
  * \param sol pointer toward the sol structure.
@@ -612,12 +618,13 @@ int  MMG2D_Get_meshSize(MMG5_pMesh mesh, int* np, int* nt, int* na);
  * \remark Fortran interface:
  * >   SUBROUTINE MMG2D_GET_SOLSIZE(mesh,sol,typEntity,np,typSol,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh,sol\n
- * >     INTEGER                       :: typEntity,np,typSol\n
+ * >     INTEGER                       :: typEntity,typSol\n
+ * >     MMG5F_INT                     :: np\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
-int  MMG2D_Get_solSize(MMG5_pMesh mesh, MMG5_pSol sol, int* typEntity, int* np,
+int  MMG2D_Get_solSize(MMG5_pMesh mesh, MMG5_pSol sol, int* typEntity, MMG5_int* np,
                       int* typSol);
 /**
  * \param mesh pointer toward the mesh structure.
@@ -686,13 +693,13 @@ int  MMG2D_Get_vertices(MMG5_pMesh mesh, double* vertices, int* refs,
  * \remark Fortran interface:
  * >   SUBROUTINE MMG2D_GET_TRIANGLE(mesh,v0,v1,v2,ref,isRequired,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
- * >     INTEGER, INTENT(OUT)          :: v0,v1,v2\n
+ * >     MMG5F_INT, INTENT(OUT)        :: v0,v1,v2\n
  * >     INTEGER                       :: ref,isRequired\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
-int MMG2D_Get_triangle(MMG5_pMesh mesh, int* v0, int* v1, int* v2, int* ref
+int MMG2D_Get_triangle(MMG5_pMesh mesh, MMG5_int* v0, MMG5_int* v1, MMG5_int* v2, int* ref
                        ,int* isRequired);
 /**
  * \param mesh pointer toward the mesh structure.
@@ -711,13 +718,13 @@ int MMG2D_Get_triangle(MMG5_pMesh mesh, int* v0, int* v1, int* v2, int* ref
  * instead of the refs and areRequired arrays)
  * > !  SUBROUTINE MMG2D_GET_TRIANGLES(mesh,tria,refs,areRequired,retval)\n
  * > !    MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
- * > !    INTEGER, DIMENSION(*),INTENT(OUT) :: tria\n
+ * > !    MMG5F_INT, DIMENSION(*),INTENT(OUT) :: tria\n
  * > !    INTEGER, DIMENSION(*)         :: refs,areRequired\n
  * > !    INTEGER, INTENT(OUT)          :: retval\n
  * > !  END SUBROUTINE\n
  *
  */
-int  MMG2D_Get_triangles(MMG5_pMesh mesh, int* tria, int* refs,
+int  MMG2D_Get_triangles(MMG5_pMesh mesh, MMG5_int* tria, int* refs,
                          int* areRequired);
 /**
  * \param mesh pointer toward the mesh structure.
@@ -735,13 +742,13 @@ int  MMG2D_Get_triangles(MMG5_pMesh mesh, int* tria, int* refs,
  * \remark Fortran interface:
  * >   SUBROUTINE MMG2D_GET_EDGE(mesh,e0,e1,ref,isRidge,isRequired,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
- * >     INTEGER, INTENT(OUT)          :: e0,e1\n
+ * >     MMG5F_INT, INTENT(OUT)        :: e0,e1\n
  * >     INTEGER                       :: ref,isRidge,isRequired\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
-int MMG2D_Get_edge(MMG5_pMesh mesh, int* e0, int* e1, int* ref
+int MMG2D_Get_edge(MMG5_pMesh mesh, MMG5_int* e0, MMG5_int* e1, int* ref
                    ,int* isRidge, int* isRequired);
 /**
  * \param met pointer toward the sol structure.
@@ -1295,13 +1302,13 @@ void MMG2D_setfunc(MMG5_pMesh mesh,MMG5_pSol met);
  * \remark Fortran interface:
  * >   SUBROUTINE MMG2D_GET_ADJATRI(mesh,kel,listri,retval)\n
  * >     MMG5_DATA_PTR_T, INTENT(INOUT)     :: mesh\n
- * >     INTEGER, INTENT(IN)                :: kel\n
- * >     INTEGER, DIMENSION(3), INTENT(OUT) :: listri\n
+ * >     MMG5F_INT, INTENT(IN)              :: kel\n
+ * >     MMG5F_INT, DIMENSION(3), INTENT(OUT) :: listri\n
  * >     INTEGER, INTENT(OUT)               :: retval\n
  * >   END SUBROUTINE\n
  *
  */
-int MMG2D_Get_adjaTri(MMG5_pMesh mesh, int kel, int listri[3]);
+int MMG2D_Get_adjaTri(MMG5_pMesh mesh, MMG5_int kel, MMG5_int listri[3]);
 
 /**
  * \brief Return adjacent elements of a triangle.
@@ -1317,14 +1324,14 @@ int MMG2D_Get_adjaTri(MMG5_pMesh mesh, int kel, int listri[3]);
  * \remark Fortran interface:
  * >   SUBROUTINE MMG2D_GET_ADJAVERTICES(mesh,ip,lispoi,retval)\n
  * >     MMG5_DATA_PTR_T, INTENT(INOUT)              :: mesh\n
- * >     INTEGER, INTENT(IN)                         :: ip\n
- * >     INTEGER, DIMENSION(MMG2D_LMAX), INTENT(OUT) :: lispoi\n
+ * >     MMG5F_INT, INTENT(IN)                       :: ip\n
+ * >     MMG5F_INT, DIMENSION(MMG2D_LMAX), INTENT(OUT) :: lispoi\n
  * >     INTEGER, INTENT(OUT)                        :: retval\n
  * >   END SUBROUTINE\n
  *
  */
 extern
-int MMG2D_Get_adjaVertices(MMG5_pMesh mesh, int ip, int lispoi[MMG2D_LMAX]);
+int MMG2D_Get_adjaVertices(MMG5_pMesh mesh, MMG5_int ip, MMG5_int lispoi[MMG2D_LMAX]);
 
 /**
  * \brief Return adjacent elements of a triangle.
@@ -1341,14 +1348,14 @@ int MMG2D_Get_adjaVertices(MMG5_pMesh mesh, int ip, int lispoi[MMG2D_LMAX]);
  * \remark Fortran interface:
  * >   SUBROUTINE MMG2D_GET_ADJAVERTICESFAST(mesh,ip,start,lispoi,retval)\n
  * >     MMG5_DATA_PTR_T, INTENT(INOUT)              :: mesh\n
- * >     INTEGER, INTENT(IN)                         :: ip,start\n
- * >     INTEGER, DIMENSION(MMG2D_LMAX), INTENT(OUT) :: lispoi\n
+ * >     MMG5F_INT, INTENT(IN)                       :: ip,start\n
+ * >     MMG5F_INT, DIMENSION(MMG2D_LMAX), INTENT(OUT) :: lispoi\n
  * >     INTEGER, INTENT(OUT)                        :: retval\n
  * >   END SUBROUTINE\n
  *
  */
-int MMG2D_Get_adjaVerticesFast(MMG5_pMesh mesh, int ip,int start,
-                               int lispoi[MMG2D_LMAX]);
+int MMG2D_Get_adjaVerticesFast(MMG5_pMesh mesh, MMG5_int ip,MMG5_int start,
+                               MMG5_int lispoi[MMG2D_LMAX]);
 /**
  * \param mesh pointer toward the mesh structure.
  * \param ked index of the boundary edge.
@@ -1364,12 +1371,13 @@ int MMG2D_Get_adjaVerticesFast(MMG5_pMesh mesh, int ip,int start,
  * \remark Fortran interface:
  * >   SUBROUTINE MMG2D_GET_TRIFROMEDGE(mesh,ked,ktri,ied,retval)\n
  * >     MMG5_DATA_PTR_T, INTENT(IN)              :: mesh\n
- * >     INTEGER, INTENT(IN)                      :: ked\n
- * >     INTEGER, INTENT(OUT)                     :: ktri,ied,retval\n
+ * >     MMG5F_INT, INTENT(IN)                    :: ked\n
+ * >     INTEGER, INTENT(OUT)                     :: ied,retval\n
+ * >     MMG5F_INT, INTENT(OUT)                   :: ktri\n
  * >   END SUBROUTINE\n
  *
  */
-int MMG2D_Get_triFromEdge(MMG5_pMesh mesh, int ked, int *ktri, int *ied);
+int MMG2D_Get_triFromEdge(MMG5_pMesh mesh, MMG5_int ked, MMG5_int *ktri, int *ied);
 /**
  * \param mesh pointer toward the mesh structure
  *
@@ -34,19 +34,19 @@
 
 void MMG2D_setfunc(MMG5_pMesh mesh,MMG5_pSol met) {
   if ( met->size == 3 ) {
-    MMG2D_lencurv  = _MMG2_lencurv_ani;
-    MMG2D_defsiz   = _MMG2_defsiz_ani;
-    MMG2D_gradsiz  = lissmet_ani;
-    MMG2D_caltri   = _MMG2_caltri_ani;
-    MMG2D_intmet   = _MMG2_intmet_ani;
-    //    MMG2_optlen    = optlen_ani;
+    mesh->func.lencurv = _MMG2_lencurv_ani;
+    mesh->func.defsiz  = _MMG2_defsiz_ani;
+    mesh->func.gradsiz = lissmet_ani;
+    mesh->func.caltri  = _MMG2_caltri_ani;
+    mesh->func.intmet  = _MMG2_intmet_ani;
+    //    mesh->func.optlen  = optlen_ani;
   }
   else {
-    MMG2D_lencurv   = _MMG2_lencurv_iso;
-    MMG2D_defsiz    = _MMG2_defsiz_iso;
-    MMG2D_gradsiz   = _MMG2_gradsiz_iso;
-    MMG2D_caltri    = _MMG2_caltri_iso;
-    MMG2D_intmet    = _MMG2_intmet_iso;
+    mesh->func.lencurv = _MMG2_lencurv_iso;
+    mesh->func.defsiz  = _MMG2_defsiz_iso;
+    mesh->func.gradsiz = _MMG2_gradsiz_iso;
+    mesh->func.caltri  = _MMG2_caltri_iso;
+    mesh->func.intmet  = _MMG2_intmet_iso;
   }
   return;
 }
@@ -129,7 +129,7 @@ int MMG2_parsop(MMG5_pMesh mesh,MMG5_pSol met) {
   return(1);
 }
 
-int MMG2D_Get_adjaTri(MMG5_pMesh mesh, int kel, int listri[3]) {
+int MMG2D_Get_adjaTri(MMG5_pMesh mesh, MMG5_int kel, MMG5_int listri[3]) {
 
   if ( ! mesh->adja ) {
     if (! MMG2_hashTria(mesh))
@@ -144,23 +144,24 @@ int MMG2D_Get_adjaTri(MMG5_pMesh mesh, int kel, int listri[3]) {
 }
 
 inline
-int MMG2D_Get_adjaVertices(MMG5_pMesh mesh, int ip, int lispoi[MMG2D_LMAX])
+int MMG2D_Get_adjaVertices(MMG5_pMesh mesh, MMG5_int ip, MMG5_int lispoi[MMG2D_LMAX])
 {
-  int start;
+  MMG5_int start;
 
   if ( !mesh->tria ) return 0;
 
-  start=MMG2_findTria(mesh,ip);
+  start=MMG2_findTria(mesh,ip,1);
   if ( !start ) return 0;
 
   return MMG2D_Get_adjaVerticesFast(mesh,ip,start,lispoi);
 }
 
 inline
-int MMG2D_Get_adjaVerticesFast(MMG5_pMesh mesh, int ip,int start, int lispoi[MMG2D_LMAX])
+int MMG2D_Get_adjaVerticesFast(MMG5_pMesh mesh, MMG5_int ip,MMG5_int start, MMG5_int lispoi[MMG2D_LMAX])
 {
   MMG5_pTria pt;
-  int k,prevk,nbpoi,iploc,i,i1,i2,*adja;
+  int nbpoi,iploc,i1,i2;
+  MMG5_int k,*adja,prevk,i;
 
   pt   = &mesh->tria[start];
 
@@ -176,7 +177,7 @@ int MMG2D_Get_adjaVerticesFast(MMG5_pMesh mesh, int ip,int start, int lispoi[MMG
   do {
     if ( nbpoi == MMG2D_LMAX ) {
       fprintf(stderr,"\n  ## Warning: %s: unable to compute adjacent"
-              " vertices of the vertex %d:\nthe ball of point contain too many"
+              " vertices of the vertex %" MMG5_PRId ":\nthe ball of point contain too many"
               " elements.\n",__func__,ip);
       return(0);
     }
@@ -197,7 +198,7 @@ int MMG2D_Get_adjaVerticesFast(MMG5_pMesh mesh, int ip,int start, int lispoi[MMG
   /* store the last point of the boundary triangle */
   if ( nbpoi == MMG2D_LMAX ) {
     fprintf(stderr,"\n  ## Warning: %s: unable to compute adjacent vertices of the"
-            " vertex %d:\nthe ball of point contain too many elements.\n",
+            " vertex %" MMG5_PRId ":\nthe ball of point contain too many elements.\n",
             __func__,ip);
     return(0);
   }
@@ -216,7 +217,7 @@ int MMG2D_Get_adjaVerticesFast(MMG5_pMesh mesh, int ip,int start, int lispoi[MMG
 
     if ( nbpoi == MMG2D_LMAX ) {
       fprintf(stderr,"\n  ## Warning: %s: unable to compute adjacent vertices of the"
-              " vertex %d:\nthe ball of point contain too many elements.\n",
+              " vertex %" MMG5_PRId ":\nthe ball of point contain too many elements.\n",
               __func__,ip);
       return(0);
     }
@@ -231,9 +232,9 @@ int MMG2D_Get_adjaVerticesFast(MMG5_pMesh mesh, int ip,int start, int lispoi[MMG
   return nbpoi;
 }
 
-int MMG2D_Get_triFromEdge(MMG5_pMesh mesh, int ked, int *ktri, int *ied)
+int MMG2D_Get_triFromEdge(MMG5_pMesh mesh, MMG5_int ked, MMG5_int *ktri, int *ied)
 {
-  int val;
+  MMG5_int val;
 
   val = mesh->edge[ked].base;
 
@@ -241,7 +242,7 @@ int MMG2D_Get_triFromEdge(MMG5_pMesh mesh, int ked, int *ktri, int *ied)
 
   *ktri = val/3;
 
-  *ied = val%3;
+  *ied = (int)(val%3);
 
   return 1;
 
@@ -251,7 +252,7 @@ int MMG2D_Get_triFromEdge(MMG5_pMesh mesh, int ked, int *ktri, int *ied)
 int MMG2D_Set_constantSize(MMG5_pMesh mesh,MMG5_pSol met) {
   MMG5_pPoint ppt;
   double      hsiz;
-  int         k,iadr;
+  MMG5_int    k,iadr;
 
   /* Memory alloc */
   if ( met->size!=1 && met->size!=3 ) {
@@ -291,7 +292,7 @@ int MMG2D_Set_constantSize(MMG5_pMesh mesh,MMG5_pSol met) {
 
 
 void MMG2D_Reset_verticestags(MMG5_pMesh mesh) {
-  int k;
+  MMG5_int k;
 
   for ( k=1; k<=mesh->np;  ++k ) {
     mesh->point[k].tag = 0;
@@ -302,7 +303,7 @@ void MMG2D_Reset_verticestags(MMG5_pMesh mesh) {
 void MMG2D_Free_triangles(MMG5_pMesh mesh) {
 
   if ( mesh->adja )
-    _MMG5_DEL_MEM(mesh,mesh->adja,(3*mesh->ntmax+5)*sizeof(int));
+    _MMG5_DEL_MEM(mesh,mesh->adja,(3*mesh->ntmax+5)*sizeof(MMG5_int));
 
   if ( mesh->tria )
     _MMG5_DEL_MEM(mesh,mesh->tria,(mesh->ntmax+1)*sizeof(MMG5_Tria));
@@ -50,7 +50,8 @@ int lissmet_ani(MMG5_pMesh mesh,MMG5_pSol sol) {
   MMG5_pPoint    p1,p2;
   double         hsiz,logh,logs,*ma,*mb,ux,uy,d1,d2,dd,rap,dh;
   double         tail,coef,ma1[3],mb1[3],m[3],dd1,dd2;
-  int            i,nc,k,itour,maxtou,ncor,a,b,iadr;
+  int            i,nc,itour,maxtou,ncor;
+  MMG5_int       k,a,b,iadr;
   double         SQRT3DIV2=0.8660254037844386;
 
   hsiz   = mesh->info.hgrad;
@@ -40,7 +40,7 @@
 int MMG2_coorbary(MMG5_pMesh mesh,MMG5_pTria pt,double c[2],double* det,double* l1,double* l2) {
   MMG5_pPoint      p1,p2,p3;
   double           b2,b3;
-  static char      mmgWarn0=0;
+  static _MMG5_TLS char      mmgWarn0=0;
 
   p1 = &mesh->point[pt->v[0]];
   p2 = &mesh->point[pt->v[1]];
@@ -69,7 +69,7 @@ int MMG2_coorbary(MMG5_pMesh mesh,MMG5_pTria pt,double c[2],double* det,double*
 }
 
 /** Check whether c lies in triangle k; return k if so, 0 otherwise */
-int MMG2_isInTriangle(MMG5_pMesh mesh,int k,double c[2]) {
+MMG5_int MMG2_isInTriangle(MMG5_pMesh mesh,MMG5_int k,double c[2]) {
   MMG5_pTria      pt;
   double          det,l1,l2,l3;
   char            ier;
@@ -128,7 +128,7 @@ int MMG2_cutEdge(MMG5_pMesh mesh,MMG5_pTria pt,MMG5_pPoint ppa,MMG5_pPoint ppb)
 
 /* Return i+1>0 if Edge ia-ib intersects triangle k at edge i, 0 if 
    it does not intersect k, and return -3 if edge ia-ib is one edge of k*/
-int MMG2_cutEdgeTriangle(MMG5_pMesh mesh,int k,int ia,int ib) {
+int MMG2_cutEdgeTriangle(MMG5_pMesh mesh,MMG5_int k,MMG5_int ia,MMG5_int ib) {
   MMG5_pTria   pt;
   MMG5_pPoint  p1,p2,p3,ppa,ppb;
   double       a11,a21,a12,a22,area1,area2,area3,prod1,prod2,prod3;
@@ -213,18 +213,30 @@ int MMG2_cutEdgeTriangle(MMG5_pMesh mesh,int k,int ia,int ib) {
   return(0);
 }
 
-/** Return the index of one triangle containing ip */
-int MMG2_findTria(MMG5_pMesh mesh,int ip) {
+/**
+ * \param mesh pointer toward the mesh
+ * \param ip index of the point to locate
+ * \param kdep index of the triangle from which the walk starts
+ * \return the index of one triangle containing ip, 0 if fail.
+ *
+ * Walk through the mesh by adjacency, from triangle kdep toward the point
+ * ip. If kdep is not a valid triangle, the walk starts from the first valid
+ * triangle following it (or from triangle 1 if kdep is out of range).
+ *
+ */
+MMG5_int MMG2_findTria(MMG5_pMesh mesh,MMG5_int ip,MMG5_int kdep) {
   MMG5_pTria  pt,pt1;
-  int         find,iel,base,iadr,*adja,iter,ier;
-  int         mvDir[3],jel,i;
+  int         base,ier;
+  MMG5_int    *adja,iter,find,iel,iadr;
+  int         mvDir[3],i;
+  MMG5_int    jel;
   double      l1,l2,l3,det,eps;
-  static char mmgWarn0 = 0;
+  static _MMG5_TLS char mmgWarn0 = 0;
 
   ++mesh->base;
   base = ++mesh->base;
   find = iter = 0;
-  iel  = 1;
+  iel  = ( kdep > 0 && kdep <= mesh->nt ) ? kdep : 1;
   do {
     mvDir[0] = mvDir[1] = mvDir[2] = 0;
     iter++;
@@ -323,13 +335,14 @@ int MMG2_findTria(MMG5_pMesh mesh,int ip) {
  * return 4 if edge exists in the mesh
  *
  */
-int MMG2_locateEdge(MMG5_pMesh mesh,int ia,int ib,int* kdep,int* list) {
+int MMG2_locateEdge(MMG5_pMesh mesh,MMG5_int ia,MMG5_int ib,MMG5_int* kdep,MMG5_int* list) {
   MMG5_pTria         pt;
   MMG5_pPoint        ppt1,ppt2,ppt3,ppt4,ppa,ppb;
   double             a[3],a11,a21,a12,a22,area1,area2,area3,prod1,prod2,prod3;
   double             niaib,npti;
-  int                iadr,*adja,k,ibreak,i,ncompt,lon,iare,ivert;
-  static char        mmgWarn=0;
+  int                ibreak,i,ncompt,lon,iare,ivert;
+  MMG5_int           *adja,k,iadr;
+  static _MMG5_TLS char        mmgWarn=0;
   //int       ktemp;
 
   k = *kdep;
@@ -345,14 +358,14 @@ int MMG2_locateEdge(MMG5_pMesh mesh,int ia,int ib,int* kdep,int* list) {
 
   if ( !ivert ) {
 
-    if ( !(k = MMG2_findTria(mesh,ia) ) ) {
+    if ( !(k = MMG2_findTria(mesh,ia,k) ) ) {
        return 0;
     }
     *kdep = k;
   }
 
   if ( mesh->info.ddebug || mesh->info.imprim > 6 )
-    printf(" Try to enforce edge %d %d\n",ia,ib);
+    printf(" Try to enforce edge %" MMG5_PRId " %" MMG5_PRId "\n",ia,ib);
 
   mesh->base += 2;
   do {
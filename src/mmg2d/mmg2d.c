@@ -56,6 +56,7 @@ static int MMG2D_usage(char *name) {
   fprintf(stdout,"-noinsert     no insertion/suppression point\n");
   fprintf(stdout,"-noswap       no edge flipping\n");
   fprintf(stdout,"-nomove       no point relocation\n");
+  fprintf(stdout,"-nthreads n   number of threads for the adjacency and the output\n");
   fprintf(stdout,"\n\n");
 
   return 1;
@@ -98,7 +99,8 @@ static inline int _MMG5_defaultValues(MMG5_pMesh mesh, double qdegrad[2]) {
  */
 static inline
 int MMG2D_countLocalParamAtEdg( MMG5_pMesh mesh,_MMG5_iNode **bdyRefs) {
-  int         npar,k,ier;
+  int         npar,ier;
+  MMG5_int    k;
 
   /** Count the number of different boundary references and list it */
   (*bdyRefs) = NULL;
@@ -106,7 +108,7 @@ int MMG2D_countLocalParamAtEdg( MMG5_pMesh mesh,_MMG5_iNode **bdyRefs) {
   k = mesh->na? mesh->edge[1].ref : 0;
 
   /* Try to alloc the first node */
-  ier = _MMG5_Add_inode( mesh, bdyRefs, k );
+  ier = _MMG5_Add_inode( mesh, bdyRefs, (int)k );
   if ( ier < 0 ) {
     fprintf(stderr,"\n  ## Error: %s: unable to allocate the first boundary"
            " reference node.\n",__func__);
@@ -273,7 +275,7 @@ int _MMG2D_defaultOption(MMG5_pMesh mesh,MMG5_pSol met, double qdegrad[2]) {
   /* analysis */
   chrono(ON,&(ctim[2]));
   MMG2D_setfunc(mesh,met);
-  _MMG2D_Set_commonFunc();
+  _MMG2D_Set_commonFunc(mesh);
 
   if ( mesh->info.imprim > 0 ) {
     fprintf(stdout,"\n  %s\n   MODULE MMG2D: IMB-LJLL : %s (%s)\n  %s\n",MG_STR,MG_VER,MG_REL,MG_STR);
@@ -493,6 +495,18 @@ int parsar(int argc,char *argv[],MMG5_pMesh mesh,MMG5_pSol met,double *qdegrad)
           if ( !MMG2D_Set_iparameter(mesh,met,MMG2D_IPARAM_nosurf,1) )
             return 0;
         }
+        else if ( !strcmp(argv[i],"-nthreads") ) {
+          if ( ++i < argc && isdigit(argv[i][0]) ) {
+            if ( !MMG2D_Set_iparameter(mesh,met,MMG2D_IPARAM_nthreads,
+                                       atoi(argv[i])) )
+              return 0;
+          }
+          else {
+            fprintf(stderr,"Missing argument option %s\n",argv[i-1]);
+            MMG2D_usage(argv[0]);
+            return 0;
+          }
+        }
         break;
       case 'o':
         if ( !strcmp(argv[i],"-out") ) {
@@ -623,7 +637,6 @@ int main(int argc,char *argv[]) {
 
   msh = 0;
 
-  _MMG2D_Set_commonFunc();
   tminit(MMG5_ctim,TIMEMAX);
   chrono(ON,&MMG5_ctim[0]);
 
@@ -119,11 +119,11 @@ typedef struct {
 typedef Bucket * pBucket;
 
 typedef struct {
-  int      min,max,iel,nxt;
+  MMG5_int min,max,iel,nxt;
 } Hedge;
 
 typedef struct {
-  int      size,nxtmax,hnxt;
+  MMG5_int size,nxtmax,hnxt;
   Hedge    *item;
 } HashTable;
 typedef HashTable * pHashTable;
@@ -138,7 +138,7 @@ static const unsigned int MMG2_inxt[5] = {1,2,0,1,2};
     of point ip with coordinates o and tag tag*/
 #define _MMG2D_POINT_REALLOC(mesh,sol,ip,wantedGap,law,o,tag,retval ) do \
   {                                                                     \
-    int klink;                                                          \
+    MMG5_int klink;                                                     \
                                                                         \
     _MMG5_TAB_RECALLOC(mesh,mesh->point,mesh->npmax,wantedGap,MMG5_Point, \
                        "larger point table",law,retval);                \
@@ -165,7 +165,7 @@ static const unsigned int MMG2_inxt[5] = {1,2,0,1,2};
     of tria jel */
 #define _MMG2D_TRIA_REALLOC(mesh,jel,wantedGap,law,retval ) do          \
   {                                                                     \
-   int klink,oldSiz;                                                    \
+   MMG5_int klink,oldSiz;                                               \
                                                                         \
    oldSiz = mesh->ntmax;                                                \
    _MMG5_TAB_RECALLOC(mesh,mesh->tria,mesh->ntmax,wantedGap,MMG5_Tria,  \
@@ -177,10 +177,10 @@ static const unsigned int MMG2_inxt[5] = {1,2,0,1,2};
                                                                         \
    if ( mesh->adja ) {                                                  \
      /* adja table */                                                   \
-     _MMG5_ADD_MEM(mesh,3*(mesh->ntmax-oldSiz)*sizeof(int),             \
+     _MMG5_ADD_MEM(mesh,3*(mesh->ntmax-oldSiz)*sizeof(MMG5_int),        \
                    "larger adja table",law);                            \
-     _MMG5_SAFE_RECALLOC(mesh->adja,3*oldSiz+5,3*mesh->ntmax+5,int      \
-                         ,"larger adja table",retval);                  \
+     _MMG5_SAFE_RECALLOC(mesh->adja,3*oldSiz+5,3*mesh->ntmax+5,         \
+                         MMG5_int,"larger adja table",retval);          \
    }                                                                    \
                                                                         \
    /* We try again to add the point */                                  \
@@ -192,7 +192,7 @@ static const unsigned int MMG2_inxt[5] = {1,2,0,1,2};
     of edge jel */
 #define _MMG2D_EDGE_REALLOC(mesh,jel,wantedGap,law,retval ) do          \
   {                                                                     \
-    int klink;                                                          \
+    MMG5_int klink;                                                     \
                                                                         \
     _MMG5_TAB_RECALLOC(mesh,mesh->edge,mesh->namax,wantedGap,MMG5_Edge, \
                        "larger edge table",law,retval);                 \
@@ -210,13 +210,13 @@ static const unsigned int MMG2_inxt[5] = {1,2,0,1,2};
 
 /* Prototypes */
 /*zaldy*/
-int _MMG2D_newPt(MMG5_pMesh mesh,double c[2],int16_t tag);
-void _MMG2D_delPt(MMG5_pMesh mesh,int ip) ;
-int _MMG5_newEdge(MMG5_pMesh mesh);
-void _MMG5_delEdge(MMG5_pMesh mesh,int iel);
-int _MMG2D_newElt(MMG5_pMesh mesh);
-int  _MMG2D_delElt(MMG5_pMesh mesh,int iel);
-int _MMG5_getnElt(MMG5_pMesh mesh,int n);
+MMG5_int _MMG2D_newPt(MMG5_pMesh mesh,double c[2],int16_t tag);
+void _MMG2D_delPt(MMG5_pMesh mesh,MMG5_int ip) ;
+MMG5_int _MMG5_newEdge(MMG5_pMesh mesh);
+void _MMG5_delEdge(MMG5_pMesh mesh,MMG5_int iel);
+MMG5_int _MMG2D_newElt(MMG5_pMesh mesh);
+int  _MMG2D_delElt(MMG5_pMesh mesh,MMG5_int iel);
+MMG5_int _MMG5_getnElt(MMG5_pMesh mesh,int n);
 int MMG2D_zaldy(MMG5_pMesh mesh);
 long long _MMG5_memSize(void);
 int _MMG2D_memOption(MMG5_pMesh mesh);
@@ -243,22 +243,22 @@ int MMG2_mmg2d2(MMG5_pMesh , MMG5_pSol);
 int MMG2_mmg2d6(MMG5_pMesh ,MMG5_pSol );
 int MMG2_mmg2d9(MMG5_pMesh ,MMG5_pSol ,MMG5_pSol );
 //int MMG2_cendel(MMG5_pMesh ,MMG5_pSol ,double ,int );
-int _MMG2_swapdelone(MMG5_pMesh ,MMG5_pSol ,int ,char ,double ,int *);
+int _MMG2_swapdelone(MMG5_pMesh ,MMG5_pSol ,MMG5_int ,char ,double ,MMG5_int *);
 int _MMG5_mmg2dChkmsh(MMG5_pMesh , int, int );
-int MMG2_boulep(MMG5_pMesh , int , int , int * );
+int MMG2_boulep(MMG5_pMesh , MMG5_int , int , MMG5_int * );
 //int MMG2_markBdry(MMG5_pMesh );
 int MMG2_prilen(MMG5_pMesh ,MMG5_pSol );
 
 int MMG2_coorbary(MMG5_pMesh ,MMG5_pTria ,double c[2],double* ,double* ,double* );
-int MMG2_isInTriangle(MMG5_pMesh ,int,double c[2]);
+MMG5_int MMG2_isInTriangle(MMG5_pMesh ,MMG5_int,double c[2]);
 int MMG2_cutEdge(MMG5_pMesh ,MMG5_pTria ,MMG5_pPoint ,MMG5_pPoint );
-int MMG2_cutEdgeTriangle(MMG5_pMesh ,int ,int ,int );
-int MMG2_findTria(MMG5_pMesh ,int );
+int MMG2_cutEdgeTriangle(MMG5_pMesh ,MMG5_int ,MMG5_int ,MMG5_int );
+MMG5_int MMG2_findTria(MMG5_pMesh ,MMG5_int ,MMG5_int );
 //int MMG2_findpos(MMG5_pMesh ,MMG5_pTria ,int ,int ,int ,int ,int );
-int MMG2_locateEdge(MMG5_pMesh ,int ,int ,int* ,int* ) ;
+int MMG2_locateEdge(MMG5_pMesh ,MMG5_int ,MMG5_int ,MMG5_int* ,MMG5_int* ) ;
 int MMG2_bdryenforcement(MMG5_pMesh ,MMG5_pSol);
 int MMG2_settagtriangles(MMG5_pMesh ,MMG5_pSol );
-int MMG2_findtrianglestate(MMG5_pMesh ,int ,int ,int ,int ,int ,int );
+int MMG2_findtrianglestate(MMG5_pMesh ,MMG5_int ,MMG5_int ,MMG5_int ,MMG5_int ,MMG5_int ,int );
 
 pQueue MMG2_kiuini(MMG5_pMesh mesh,int nbel,double declic,int base);
 void MMG2_kiufree(pQueue q);
@@ -266,7 +266,7 @@ int MMG2_kiudel(pQueue q,int iel);
 int MMG2_kiuput(pQueue q,int iel);
 int MMG2_kiupop(pQueue q);
 
-int MMG2_hashEdge(pHashTable edgeTable,int iel,int ia, int ib);
+MMG5_int MMG2_hashEdge(pHashTable edgeTable,MMG5_int iel,MMG5_int ia, MMG5_int ib);
 //int MMG2_hashel(MMG5_pMesh mesh);
 int MMG2_hashNew(HashTable *hash,int hsize,int hmax);
 int MMG2_baseBdry(MMG5_pMesh mesh);
@@ -276,28 +276,28 @@ int simred(double *m1,double *m2,double *m);
 
 //int MMG2_evalgeom(MMG5_pMesh mesh);
 
-int _MMG2_cavity(MMG5_pMesh ,MMG5_pSol ,int ,int *);
-int _MMG2_delone(MMG5_pMesh ,MMG5_pSol ,int ,int *,int );
+int _MMG2_cavity(MMG5_pMesh ,MMG5_pSol ,MMG5_int ,MMG5_int *);
+int _MMG2_delone(MMG5_pMesh ,MMG5_pSol ,MMG5_int ,MMG5_int *,int );
 int _MMG2_cenrad_iso(MMG5_pMesh ,double *,double *,double *);
 
 /* Adds Charles */
 int _MMG2_getIniRef(MMG5_pMesh ,int );
 int _MMG2_isSplit(MMG5_pMesh ,int ,int *,int *);
 int MMG2_parsop(MMG5_pMesh ,MMG5_pSol );
-int _MMG2_ismaniball(MMG5_pMesh , MMG5_pSol , int , char );
+int _MMG2_ismaniball(MMG5_pMesh , MMG5_pSol , MMG5_int , char );
 int _MMG2_snapval(MMG5_pMesh ,MMG5_pSol ,double *);
 int _MMG2_chkmanimesh(MMG5_pMesh );
 int MMG2_hashTria(MMG5_pMesh );
 int _MMG2_resetRef(MMG5_pMesh );
 int _MMG2_cuttri_ls(MMG5_pMesh ,MMG5_pSol );
 int _MMG2_setref_ls(MMG5_pMesh ,MMG5_pSol );
-int _MMG2_split1_sim(MMG5_pMesh ,MMG5_pSol ,int ,int vx[3]);
-int _MMG2_split2_sim(MMG5_pMesh ,MMG5_pSol ,int ,int vx[3]);
-int _MMG2_split3_sim(MMG5_pMesh ,MMG5_pSol ,int ,int vx[3]);
-int _MMG2_split1(MMG5_pMesh ,MMG5_pSol ,int ,int vx[3]);
-int _MMG2_split2(MMG5_pMesh ,MMG5_pSol ,int ,int vx[3]);
-int _MMG2_split3(MMG5_pMesh ,MMG5_pSol ,int ,int vx[3]);
-int _MMG2_splitbar(MMG5_pMesh ,int ,int );
+int _MMG2_split1_sim(MMG5_pMesh ,MMG5_pSol ,MMG5_int ,MMG5_int vx[3]);
+int _MMG2_split2_sim(MMG5_pMesh ,MMG5_pSol ,MMG5_int ,MMG5_int vx[3]);
+int _MMG2_split3_sim(MMG5_pMesh ,MMG5_pSol ,MMG5_int ,MMG5_int vx[3]);
+int _MMG2_split1(MMG5_pMesh ,MMG5_pSol ,MMG5_int ,MMG5_int vx[3]);
+int _MMG2_split2(MMG5_pMesh ,MMG5_pSol ,MMG5_int ,MMG5_int vx[3]);
+int _MMG2_split3(MMG5_pMesh ,MMG5_pSol ,MMG5_int ,MMG5_int vx[3]);
+int _MMG2_splitbar(MMG5_pMesh ,MMG5_int ,MMG5_int );
 int  MMG2_assignEdge(MMG5_pMesh );
 int  MMG2_bdryEdge(MMG5_pMesh );
 int _MMG2_setadj(MMG5_pMesh );
@@ -305,47 +305,47 @@ int _MMG2_singul(MMG5_pMesh );
 int _MMG2_analys(MMG5_pMesh );
 int _MMG2_norver(MMG5_pMesh );
 int _MMG2_regnor(MMG5_pMesh );
-int _MMG2_boulen(MMG5_pMesh , int ,char ,int *,int *,double *);
+int _MMG2_boulen(MMG5_pMesh , MMG5_int ,char ,MMG5_int *,MMG5_int *,double *);
 int MMG2_mmg2d1n(MMG5_pMesh ,MMG5_pSol );
 int _MMG2_anatri(MMG5_pMesh ,MMG5_pSol ,char );
 int _MMG2_adptri(MMG5_pMesh ,MMG5_pSol );
 int _MMG2_defsiz_iso(MMG5_pMesh ,MMG5_pSol );
 int _MMG2_defsiz_ani(MMG5_pMesh ,MMG5_pSol );
-int _MMG2_defmetbdy_2d(MMG5_pMesh ,MMG5_pSol ,int ,char );
-int _MMG2_defaultmet_2d(MMG5_pMesh ,MMG5_pSol ,int ,char );
+int _MMG2_defmetbdy_2d(MMG5_pMesh ,MMG5_pSol ,MMG5_int ,char );
+int _MMG2_defaultmet_2d(MMG5_pMesh ,MMG5_pSol ,MMG5_int ,char );
 int _MMG2_grad2met_ani(MMG5_pMesh ,MMG5_pSol ,double *,double *,double );
 int _MMG2_gradsiz_iso(MMG5_pMesh ,MMG5_pSol );
 int _MMG2_gradsiz_ani(MMG5_pMesh ,MMG5_pSol );
 int _MMG2_anaelt(MMG5_pMesh ,MMG5_pSol ,int );
 int _MMG2_colelt(MMG5_pMesh ,MMG5_pSol ,int );
 int _MMG2_swpmsh(MMG5_pMesh ,MMG5_pSol ,int );
-double _MMG2_lencurv_iso(MMG5_pMesh ,MMG5_pSol ,int ,int );
-double _MMG2_lencurv_ani(MMG5_pMesh ,MMG5_pSol ,int ,int );
-int _MMG2_chkedg(MMG5_pMesh ,int );
-int _MMG2_bezierCurv(MMG5_pMesh ,int ,char ,double ,double *,double *);
-int _MMG2_dichoto(MMG5_pMesh ,MMG5_pSol ,int ,int *);
+double _MMG2_lencurv_iso(MMG5_pMesh ,MMG5_pSol ,MMG5_int ,MMG5_int );
+double _MMG2_lencurv_ani(MMG5_pMesh ,MMG5_pSol ,MMG5_int ,MMG5_int );
+int _MMG2_chkedg(MMG5_pMesh ,MMG5_int );
+int _MMG2_bezierCurv(MMG5_pMesh ,MMG5_int ,char ,double ,double *,double *);
+int _MMG2_dichoto(MMG5_pMesh ,MMG5_pSol ,MMG5_int ,MMG5_int *);
 double _MMG2_quickcal(MMG5_pMesh , MMG5_pTria );
-int _MMG2_chkcol(MMG5_pMesh,MMG5_pSol,int,char,int *,char);
-int _MMG2_colver(MMG5_pMesh,int,int*);
-int _MMG2_colver3(MMG5_pMesh,int*);
-int _MMG2_colver2(MMG5_pMesh,int*);
-int _MMG2_boulet(MMG5_pMesh,int,char,int*);
-int _MMG2_bouleendp(MMG5_pMesh,int,char,int*,int*);
+int _MMG2_chkcol(MMG5_pMesh,MMG5_pSol,MMG5_int,char,MMG5_int *,char);
+int _MMG2_colver(MMG5_pMesh,int,MMG5_int*);
+int _MMG2_colver3(MMG5_pMesh,MMG5_int*);
+int _MMG2_colver2(MMG5_pMesh,MMG5_int*);
+int _MMG2_boulet(MMG5_pMesh,MMG5_int,char,MMG5_int*);
+int _MMG2_bouleendp(MMG5_pMesh,MMG5_int,char,MMG5_int*,MMG5_int*);
 int _MMG2_savemesh_db(MMG5_pMesh ,char* ,char );
 int _MMG2_savemet_db(MMG5_pMesh ,MMG5_pSol ,char* ,char );
-int _MMG2_chkswp(MMG5_pMesh , MMG5_pSol ,int ,char ,char );
-int _MMG2_swapar(MMG5_pMesh ,int ,char );
+int _MMG2_chkswp(MMG5_pMesh , MMG5_pSol ,MMG5_int ,char ,char );
+int _MMG2_swapar(MMG5_pMesh ,MMG5_int ,char );
 int _MMG5_interpmet22(MMG5_pMesh ,double *,double *,double ,double *);
-int _MMG2_intmet_iso(MMG5_pMesh ,MMG5_pSol ,int ,char ,int ,double );
-int _MMG2_intmet_ani(MMG5_pMesh ,MMG5_pSol ,int ,char ,int ,double );
+int _MMG2_intmet_iso(MMG5_pMesh ,MMG5_pSol ,MMG5_int ,char ,MMG5_int ,double );
+int _MMG2_intmet_ani(MMG5_pMesh ,MMG5_pSol ,MMG5_int ,char ,MMG5_int ,double );
 int _MMG2_adpspl(MMG5_pMesh ,MMG5_pSol );
 int _MMG2_adpcol(MMG5_pMesh ,MMG5_pSol );
 int _MMG2_movtri(MMG5_pMesh ,MMG5_pSol ,int ,char );
-int _MMG2_chkspl(MMG5_pMesh ,MMG5_pSol ,int ,char );
-int _MMG2_split1b(MMG5_pMesh ,int ,char ,int );
-int _MMG2_movedgpt(MMG5_pMesh ,MMG5_pSol ,int ,int *,char );
-int _MMG2_movintpt(MMG5_pMesh ,MMG5_pSol ,int ,int *,char );
-int _MMG2_movintpt_ani(MMG5_pMesh ,MMG5_pSol ,int ,int *,char );
+MMG5_int _MMG2_chkspl(MMG5_pMesh ,MMG5_pSol ,MMG5_int ,char );
+int _MMG2_split1b(MMG5_pMesh ,MMG5_int ,char ,MMG5_int );
+int _MMG2_movedgpt(MMG5_pMesh ,MMG5_pSol ,int ,MMG5_int *,char );
+int _MMG2_movintpt(MMG5_pMesh ,MMG5_pSol ,int ,MMG5_int *,char );
+int _MMG2_movintpt_ani(MMG5_pMesh ,MMG5_pSol ,int ,MMG5_int *,char );
 int _MMG2_chkmsh(MMG5_pMesh );
 int _MMG2_chkor(MMG5_pMesh );
 int _MMG2_savenor_db(MMG5_pMesh ,char *,char );
@@ -353,8 +353,8 @@ int _MMG2_savedisp_db(MMG5_pMesh mesh,MMG5_pSol ,char *,char );
 int _MMG2_velextLS(MMG5_pMesh ,MMG5_pSol );
 
 /* useful functions to debug */
-int  _MMG2D_indElt(MMG5_pMesh mesh,int kel);
-int  _MMG2D_indPt(MMG5_pMesh mesh,int kp);
+MMG5_int _MMG2D_indElt(MMG5_pMesh mesh,MMG5_int kel);
+MMG5_int _MMG2D_indPt(MMG5_pMesh mesh,MMG5_int kp);
 
 
 /* functions pointers */
@@ -370,23 +370,18 @@ int    interp_iso(double *,double *,double * ,double );
 int    lissmet_iso(MMG5_pMesh mesh,MMG5_pSol sol);
 int    lissmet_ani(MMG5_pMesh mesh,MMG5_pSol sol);
 
-double (*MMG2D_lencurv)(MMG5_pMesh ,MMG5_pSol ,int ,int );
-double (*MMG2D_caltri)(MMG5_pMesh ,MMG5_pSol ,MMG5_pTria );
-int    (*MMG2_optlen)(MMG5_pMesh ,MMG5_pSol ,double ,int );
-int    (*MMG2D_intmet)(MMG5_pMesh ,MMG5_pSol ,int ,char ,int ,double );
-int    (*MMG2D_gradsiz)(MMG5_pMesh ,MMG5_pSol );
-int    (*MMG2D_defsiz)(MMG5_pMesh ,MMG5_pSol );
-
 /* init structures */
 void  _MMG2_Init_parameters(MMG5_pMesh mesh);
 
 /**
+ * \param mesh pointer toward the mesh structure.
+ *
  * Set common pointer functions between mmgs and mmg2d to the matching mmg2d
  * functions.
  */
 static inline
-void _MMG2D_Set_commonFunc() {
-  _MMG5_chkmsh            = _MMG5_mmg2dChkmsh;
+void _MMG2D_Set_commonFunc(MMG5_pMesh mesh) {
+  mesh->func.chkmsh       = _MMG5_mmg2dChkmsh;
   return;
 }
 
@@ -49,7 +49,7 @@ int _MMG2_anatri(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
     
     if ( !mesh->info.noinsert ) {
       /* Memory free */
-      _MMG5_DEL_MEM(mesh,mesh->adja,(3*mesh->ntmax+5)*sizeof(int));
+      _MMG5_DEL_MEM(mesh,mesh->adja,(3*mesh->ntmax+5)*sizeof(MMG5_int));
       mesh->adja = 0;
       
       /* Split long edges according to patterns */
@@ -111,9 +111,10 @@ int _MMG2_anaelt(MMG5_pMesh mesh,MMG5_pSol met,int typchk) {
   MMG5_pPoint     ppt,p1,p2;
   _MMG5_Hash      hash;
   double          len,s,o[2],no[2];
-  int             ns,nc,npinit,ni,k,nt,ip1,ip2,ip,it,vx[3];
+  int             ns,nc,ni,it;
+  MMG5_int        k,npinit,nt,ip1,ip2,ip,vx[3];
   char            i,ic,i1,i2,ier;
-  static char     mmgWarn0=0;
+  static _MMG5_TLS char     mmgWarn0=0;
 
   s = 0.5;
   ns = 0;
@@ -139,7 +140,7 @@ int _MMG2_anaelt(MMG5_pMesh mesh,MMG5_pSol met,int typchk) {
       for (i=0; i<3; i++) {
         i1 = _MMG5_inxt2[i];
         i2 = _MMG5_iprv2[i];
-        len = MMG2D_lencurv(mesh,met,pt->v[i1],pt->v[i2]);
+        len = mesh->func.lencurv(mesh,met,pt->v[i1],pt->v[i2]);
         if ( len > MMG2_LLONG ) MG_SET(pt->flag,i);
       }
     }
@@ -194,14 +195,14 @@ int _MMG2_anaelt(MMG5_pMesh mesh,MMG5_pSol met,int typchk) {
 
       /* If there is a metric in the mesh, interpolate it at the new point */
       if ( met->m )
-        MMG2D_intmet(mesh,met,k,i,ip,s);
+        mesh->func.intmet(mesh,met,k,i,ip,s);
 
       /* Add point to the hashing structure */
       _MMG5_hashEdge(mesh,&hash,ip1,ip2,ip);
     }
   }
   if ( !ns ) {
-    _MMG5_DEL_MEM(mesh,hash.item,(hash.max+1)*sizeof(_MMG5_hedge));
+    _MMG5_DEL_MEM(mesh,hash.item,hash.siz*sizeof(_MMG5_hedge));
     return(ns);
   }
 
@@ -226,7 +227,7 @@ int _MMG2_anaelt(MMG5_pMesh mesh,MMG5_pSol met,int typchk) {
     if ( nc > 0 ) ns++;
   }
   if ( mesh->info.ddebug && ns ) {
-    fprintf(stdout,"     %d analyzed  %d proposed\n",mesh->nt,ns);
+    fprintf(stdout,"     %" MMG5_PRId " analyzed  %d proposed\n",mesh->nt,ns);
     fflush(stdout);
   }
 
@@ -339,7 +340,7 @@ int _MMG2_anaelt(MMG5_pMesh mesh,MMG5_pSol met,int typchk) {
   }
   if ( (mesh->info.ddebug || abs(mesh->info.imprim) > 5) && ns > 0 )
     fprintf(stdout,"     %7d splitted\n",ns);
-  _MMG5_DEL_MEM(mesh,hash.item,(hash.max+1)*sizeof(_MMG5_hedge));
+  _MMG5_DEL_MEM(mesh,hash.item,hash.siz*sizeof(_MMG5_hedge));
 
   return(ns);
 }
@@ -354,12 +355,13 @@ int _MMG2_anaelt(MMG5_pMesh mesh,MMG5_pSol met,int typchk) {
  * Find acceptable position for splitting.
  *
  */
-int _MMG2_dichoto(MMG5_pMesh mesh,MMG5_pSol met,int k,int *vx) {
+int _MMG2_dichoto(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int *vx) {
   MMG5_pTria   pt;
   MMG5_pPoint  pa,pb,ps;
   double       o[3][2],p[3][2];
   float        to,tp,t;
-  int          ia,ib,ier,it,maxit;
+  int          ier,it,maxit;
+  MMG5_int     ia,ib;
   char         i,i1,i2;
 
   pt = &mesh->tria[k];
@@ -434,7 +436,8 @@ int _MMG2_colelt(MMG5_pMesh mesh,MMG5_pSol met,int typchk) {
   MMG5_pTria         pt;
   MMG5_pPoint        p1,p2;
   double             ux,uy,ll,hmin2;
-  int                list[MMG2_LONMAX+2],ilist,nc,k;
+  int                ilist,nc;
+  MMG5_int           k,list[MMG2_LONMAX+2];
   unsigned char      i,i1,i2,open;
 
   nc = 0;
@@ -475,7 +478,7 @@ int _MMG2_colelt(MMG5_pMesh mesh,MMG5_pSol met,int typchk) {
         if ( ll > hmin2 ) continue;
       }
       else {
-        ll = MMG2D_lencurv(mesh,met,pt->v[i1],pt->v[i2]);
+        ll = mesh->func.lencurv(mesh,met,pt->v[i1],pt->v[i2]);
         if ( ll > MMG2_LSHRT ) continue;
       }
       
@@ -506,7 +509,8 @@ int _MMG2_colelt(MMG5_pMesh mesh,MMG5_pSol met,int typchk) {
 /* Travel triangles and swap edges to improve quality */
 int _MMG2_swpmsh(MMG5_pMesh mesh,MMG5_pSol met,int typchk) {
   MMG5_pTria          pt;
-  int                 it,maxit,ns,nns,k;
+  int                 it,maxit,ns,nns;
+  MMG5_int            k;
   unsigned char       i;
 
   it = nns = 0;
@@ -632,7 +636,8 @@ int _MMG2_adptri(MMG5_pMesh mesh,MMG5_pSol met) {
 int _MMG2_adpspl(MMG5_pMesh mesh,MMG5_pSol met) {
   MMG5_pTria         pt;
   double             lmax,len;
-  int                k,ns,ip,ier;
+  int                ns,ier;
+  MMG5_int           k,ip;
   char               i,i1,i2,imax;
 
   ns = 0;
@@ -648,7 +653,7 @@ int _MMG2_adpspl(MMG5_pMesh mesh,MMG5_pSol met) {
       i1 = _MMG5_inxt2[i];
       i2 = _MMG5_iprv2[i];
       
-      len = MMG2D_lencurv(mesh,met,pt->v[i1],pt->v[i2]);
+      len = mesh->func.lencurv(mesh,met,pt->v[i1],pt->v[i2]);
 
       if ( len > lmax ) {
         lmax = len;
@@ -687,7 +692,8 @@ int _MMG2_adpcol(MMG5_pMesh mesh,MMG5_pSol met) {
   MMG5_pTria        pt;
   MMG5_pPoint       p1,p2;
   double            len;
-  int               k,nc,ilist,list[MMG2_LONMAX+2];
+  int               nc,ilist;
+  MMG5_int          k,list[MMG2_LONMAX+2];
   char              i,i1,i2,open;
 
   nc = 0;
@@ -715,7 +721,7 @@ int _MMG2_adpcol(MMG5_pMesh mesh,MMG5_pSol met) {
         if ( ! (p2->tag & MG_GEO || p2->tag & MG_REF) || !(pt->tag[i] & MG_REF) ) continue;
       }
 
-      len = MMG2D_lencurv(mesh,met,pt->v[i1],pt->v[i2]);
+      len = mesh->func.lencurv(mesh,met,pt->v[i1],pt->v[i2]);
 
       if ( len > MMG2_LOPTS ) continue;
 
@@ -743,7 +749,8 @@ int _MMG2_adpcol(MMG5_pMesh mesh,MMG5_pSol met) {
 int _MMG2_movtri(MMG5_pMesh mesh,MMG5_pSol met,int maxit,char improve) {
   MMG5_pTria           pt;
   MMG5_pPoint          p0;
-  int                  base,k,nnm,nm,ns,it,ilist,list[MMG2_LONMAX+2];
+  int                  base,nnm,nm,ns,it,ilist;
+  MMG5_int             k,list[MMG2_LONMAX+2];
   char                 i,ier;
 
   it = nnm = 0;
@@ -816,14 +823,14 @@ int MMG2_mmg2d1n(MMG5_pMesh mesh,MMG5_pSol met) {
   if ( abs(mesh->info.imprim) > 4 || mesh->info.ddebug )
     fprintf(stdout,"  ** COMPUTATIONAL MESH\n");
 
-  if ( !MMG2D_defsiz(mesh,met) ) {
+  if ( !mesh->func.defsiz(mesh,met) ) {
     fprintf(stderr,"  ## Metric undefined. Exit program.\n");
     return(0);
   }
 
   if ( mesh->info.hgrad > 0. ) {
     if ( mesh->info.imprim > 0 )   fprintf(stdout,"\n  -- GRADATION : %8f\n",mesh->info.hgrad);
-    if (!MMG2D_gradsiz(mesh,met) ) {
+    if (!mesh->func.gradsiz(mesh,met) ) {
       fprintf(stderr,"  ## Gradation problem. Exit program.\n");
       return(0);
     }
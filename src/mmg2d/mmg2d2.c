@@ -41,9 +41,10 @@
  */
 int MMG2_removeBBtriangles(MMG5_pMesh mesh) {
   MMG5_pTria      pt;
-  int             ip1,ip2,ip3,ip4,k,iadr,*adja,iadr2,*adja2,iel,nd;
+  int             nd;
+  MMG5_int        k,ip1,ip2,ip3,ip4,iadr,*adja,*adja2,iel,iadr2;
   char            i,ii;
-  static char     mmgWarn0=0;
+  static _MMG5_TLS char     mmgWarn0=0;
 
   /* Bounding Box vertices */
   ip1 = mesh->np-3;
@@ -98,8 +99,8 @@ int MMG2_removeBBtriangles(MMG5_pMesh mesh) {
    in the supplied mesh: in = base ; out = -base ; undetermined = 0*/
 int MMG2_settagtriangles(MMG5_pMesh mesh,MMG5_pSol sol) {
   MMG5_pTria        pt;
-  int               base,nd,iter,maxiter,k;
-  int               ip1,ip2,ip3,ip4;
+  int               base,nd,iter,maxiter;
+  MMG5_int          k,ip1,ip2,ip3,ip4;
 
   /*BB vertex*/
   ip1=(mesh->np-3);
@@ -129,7 +130,7 @@ int MMG2_settagtriangles(MMG5_pMesh mesh,MMG5_pSol sol) {
 
 /* Find out whether triangle pt is inside or outside (i.e. contains bb points or not) */
 /* Return <0 value if triangle outside ; > 0 if triangle inside */
-int MMG2_findtrianglestate(MMG5_pMesh mesh,int k,int ip1,int ip2,int ip3,int ip4,int base) {
+int MMG2_findtrianglestate(MMG5_pMesh mesh,MMG5_int k,MMG5_int ip1,MMG5_int ip2,MMG5_int ip3,MMG5_int ip4,int base) {
   MMG5_pTria       pt;
   int              nb;
   char             i;
@@ -153,59 +154,175 @@ int MMG2_findtrianglestate(MMG5_pMesh mesh,int k,int ip1,int ip2,int ip3,int ip4
   }
 }
 
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param perm array of size mesh->np-4 filled with the point indices.
+ * \return 1 if success, 0 if fail.
+ *
+ * Sort the points to insert (all but the 4 bounding box vertices) along a
+ * Hilbert curve so that two consecutive points are close to each other.
+ *
+ */
+static int _MMG2_hilbertSort(MMG5_pMesh mesh,MMG5_int *perm) {
+  MMG5_pPoint  ppt;
+  _MMG5_sfcKey *keys;
+  double       min[2],max[2],dd;
+  int          k,i;
+  MMG5_int     n;
+
+  n = mesh->np-4;
+
+  min[0] = min[1] =  DBL_MAX;
+  max[0] = max[1] = -DBL_MAX;
+  for (k=1; k<=n; k++) {
+    ppt = &mesh->point[k];
+    for (i=0; i<2; i++) {
+      if ( ppt->c[i] < min[i] ) min[i] = ppt->c[i];
+      if ( ppt->c[i] > max[i] ) max[i] = ppt->c[i];
+    }
+  }
+  dd = MG_MAX(max[0]-min[0],max[1]-min[1]);
+  dd = ( dd > _MMG5_EPSD ) ? (double)((1u<<_MMG5_SFC_NBIT)-1)/dd : 0.;
+
+  _MMG5_ADD_MEM(mesh,n*sizeof(_MMG5_sfcKey),"hilbert keys",return(0));
+  _MMG5_SAFE_MALLOC(keys,n,_MMG5_sfcKey,0);
+
+  for (k=1; k<=n; k++) {
+    keys[k-1].key = _MMG5_hilbertKey(mesh->point[k].c,min,dd,2);
+    keys[k-1].idx = k;
+  }
+  qsort(keys,n,sizeof(_MMG5_sfcKey),_MMG5_sfcCompKey);
+
+  for (k=0; k<n; k++)
+    perm[k] = keys[k].idx;
+
+  _MMG5_DEL_MEM(mesh,keys,n*sizeof(_MMG5_sfcKey));
+  return(1);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param ip index of the point to locate.
+ * \param kdep index of the triangle from which we start the search.
+ * \return the index of a triangle containing ip, 0 if fail.
+ *
+ * Find a triangle containing the point ip: walk from kdep (the last created
+ * triangle if the points are inserted along a space filling curve), then, if
+ * the walk fails, from the closest of a small sample of triangles (jump and
+ * walk). The exhaustive search is only a last resort.
+ *
+ */
+static MMG5_int _MMG2_locatePoint(MMG5_pMesh mesh,MMG5_int ip,MMG5_int kdep) {
+  MMG5_pTria  pt;
+  MMG5_pPoint ppt,p0,p1,p2;
+  double      dd,dmin,c[2];
+  unsigned    seed;
+  int         ns,nsmax;
+  MMG5_int    k,kk;
+
+  k = MMG2_findTria(mesh,ip,kdep);
+  if ( k ) return(k);
+
+  /* Jump and walk: start from the nearest of O(nt^(1/3)) sampled triangles */
+  ppt   = &mesh->point[ip];
+  nsmax = (int)pow((double)mesh->nt,1./3.) + 1;
+  seed  = (unsigned)ip;
+  dmin  = DBL_MAX;
+  kk    = 0;
+  for (ns=0; ns<nsmax; ns++) {
+    seed = 1103515245u*seed + 12345u;
+    k    = 1 + (int)(seed % (unsigned)mesh->nt);
+    pt   = &mesh->tria[k];
+    if ( !MG_EOK(pt) ) continue;
+
+    p0 = &mesh->point[pt->v[0]];
+    p1 = &mesh->point[pt->v[1]];
+    p2 = &mesh->point[pt->v[2]];
+    c[0] = (p0->c[0]+p1->c[0]+p2->c[0])/3. - ppt->c[0];
+    c[1] = (p0->c[1]+p1->c[1]+p2->c[1])/3. - ppt->c[1];
+    dd   = c[0]*c[0] + c[1]*c[1];
+    if ( dd < dmin ) {
+      dmin = dd;
+      kk   = k;
+    }
+  }
+  if ( kk && kk != kdep ) {
+    k = MMG2_findTria(mesh,ip,kk);
+    if ( k ) return(k);
+  }
+
+  /* Exhaustive search */
+  if ( mesh->info.ddebug )
+    printf(" ** exhaustive search of point location.\n");
+
+  for(k=1; k<=mesh->nt; k++) {
+    if ( MMG2_isInTriangle(mesh,k,ppt->c) ) return(k);
+  }
+  return(0);
+}
+
 /**
  * \param mesh pointer toward the mesh structure
  * \param sol pointer toward the solution structure
  * \return  0 if fail.
  *
  * Insertion of the list of points inside the mesh
- * (Vertices mesh->np - 3, 2, 1, 0 are the vertices of the BB and have already been inserted)
+ * (Vertices mesh->np - 3, 2, 1, 0 are the vertices of the BB and have already been inserted).
+ * The points are inserted along a Hilbert curve and each point location starts
+ * from a triangle created by the previous insertion.
  *
  */
 int MMG2_insertpointdelone(MMG5_pMesh mesh,MMG5_pSol sol) {
   MMG5_pPoint ppt;
-  int         list[MMG2_LONMAX],lon;
-  int         k,kk;
+  int         lon;
+  MMG5_int    list[MMG2_LONMAX];
+  int         l;
+  MMG5_int    k,nperm,*perm,kdep;
   int         iter,maxiter,ns,nus,nu,nud;
-  static char mmgWarn0=0,mmgWarn1=0,mmgWarn2=0;
+  static _MMG5_TLS char mmgWarn0=0,mmgWarn1=0,mmgWarn2=0;
 
   for(k=1; k<=mesh->np-4; k++) {
     ppt = &mesh->point[k];
     ppt->flag	= -10;
   }
+
+  /* Insertion order */
+  nperm = mesh->np-4;
+  if ( nperm <= 0 ) return(1);
+
+  _MMG5_ADD_MEM(mesh,nperm*sizeof(MMG5_int),"insertion order",return(0));
+  _MMG5_SAFE_MALLOC(perm,nperm,MMG5_int,0);
+  if ( !_MMG2_hilbertSort(mesh,perm) ) {
+    _MMG5_DEL_MEM(mesh,perm,nperm*sizeof(MMG5_int));
+    return(0);
+  }
+
   iter = 0;
   maxiter = 10;
-  
-	do {
+  kdep = 1;
+
+  do {
     ns = nus = 0;
     nu = nud = 0;
     mmgWarn1 = mmgWarn2 = 0;
-    for(k=1; k<=mesh->np-4; k++) {
+    for(l=0; l<nperm; l++) {
+      k   = perm[l];
       ppt = &mesh->point[k];
-		  if(ppt->flag != -10) continue;
-			nus++;
+      if(ppt->flag != -10) continue;
+      nus++;
       /* Find the triangle lel of the mesh containing ppt */
-      list[0] = MMG2_findTria(mesh,k);
+      list[0] = _MMG2_locatePoint(mesh,k,kdep);
 
-      /* Exhaustive search if not found */
       if ( !list[0] ) {
-        if ( mesh->info.ddebug )
-          printf(" ** exhaustive search of point location.\n");
-
-        for(kk=1; kk<=mesh->nt; kk++) {
-          list[0] = MMG2_isInTriangle(mesh,kk,&ppt->c[0]);
-          if ( list[0] ) break;
-        }
-
-        if ( kk>mesh->nt ) {
-          if ( !mmgWarn0 ) {
-            mmgWarn0 = 1;
-            fprintf(stderr,"\n  ## Error: %s: unable to find triangle"
-                    " for at least vertex %8d.\n",__func__,k);
-          }
-          return(0);
+        if ( !mmgWarn0 ) {
+          mmgWarn0 = 1;
+          fprintf(stderr,"\n  ## Error: %s: unable to find triangle"
+                  " for at least vertex %8" MMG5_PRId ".\n",__func__,k);
         }
+        _MMG5_DEL_MEM(mesh,perm,nperm*sizeof(MMG5_int));
+        return(0);
       }
+      kdep = list[0];
 
       /* Create the cavity of point k starting from list[0] */
       lon = _MMG2_cavity(mesh,sol,k,list);
@@ -215,20 +332,21 @@ int MMG2_insertpointdelone(MMG5_pMesh mesh,MMG5_pSol sol) {
         if ( !mmgWarn1 ) {
           mmgWarn1 = 1;
           if(mesh->info.imprim < -1) fprintf(stderr,"\n  ## Warning: %s: unable to insert "
-                                            "at least 1 vertex. (%8d)\n",__func__,k);
+                                            "at least 1 vertex. (%8" MMG5_PRId ")\n",__func__,k);
         }
         continue;
       } else {
-				if(!_MMG2_delone(mesh,sol,k,list,lon)) {
-			    if ( abs(mesh->info.imprim) > 4) {
+        if(!_MMG2_delone(mesh,sol,k,list,lon)) {
+          if ( abs(mesh->info.imprim) > 4) {
             nud++;
             if ( !mmgWarn2 ) {
               mmgWarn2 = 1;
               if(mesh->info.imprim < -1) fprintf(stderr,"\n  ## Warning: %s: unable to"
-                                                 " insert at least 1 point with Delaunay (%8d)\n",__func__,k);
+                                                 " insert at least 1 point with Delaunay (%8" MMG5_PRId ")\n",__func__,k);
             }
           }
         } else {
+          kdep = list[0];
           ppt->flag = 0;
           ns++;
         }
@@ -241,7 +359,7 @@ int MMG2_insertpointdelone(MMG5_pMesh mesh,MMG5_pSol sol) {
       fprintf(stdout,"     unable to insert %8d vertex : cavity %8d -- delaunay %8d \n",nu+nud,nu,nud);
   } while (ns && ++iter<maxiter);
 
-	if(abs(nus-ns)) {
+  if(abs(nus-ns)) {
     if ( mesh->info.imprim < -1 ) {
       fprintf(stderr,"\n  ## Warning: %s: unable to"
               " insert %8d point with Delaunay \n",__func__,abs(nus-ns));
@@ -250,37 +368,30 @@ int MMG2_insertpointdelone(MMG5_pMesh mesh,MMG5_pSol sol) {
     mmgWarn2 = 0;
     nus = ns = 0;
     /*try to insert using splitbar*/
-    for(k=1; k<=mesh->np-4; k++) {
+    for(l=0; l<nperm; l++) {
+      k   = perm[l];
       ppt = &mesh->point[k];
-		  if(ppt->flag != -10) continue;
-			nus++;
+      if(ppt->flag != -10) continue;
+      nus++;
       /* Find the triangle lel of the mesh containing ppt */
-      list[0] = MMG2_findTria(mesh,k);
+      list[0] = _MMG2_locatePoint(mesh,k,kdep);
 
-      /* Exhaustive search if not found */
       if ( !list[0] ) {
-        if ( mesh->info.ddebug )
-          printf(" ** exhaustive search of point location.\n");
-
-        for(kk=1; kk<=mesh->nt; kk++) {
-          list[0] = MMG2_isInTriangle(mesh,kk,&ppt->c[0]);
-          if ( list[0] ) break;
-        }
-
-        if ( kk>mesh->nt ) {
-          if ( !mmgWarn0 ) {
-            mmgWarn0 = 1;
-            fprintf(stderr,"\n  ## Error: %s: unable to find triangle"
-                    " for at least vertex %8d.\n",__func__,k);
-          }
-          return 0;
+        if ( !mmgWarn0 ) {
+          mmgWarn0 = 1;
+          fprintf(stderr,"\n  ## Error: %s: unable to find triangle"
+                  " for at least vertex %8" MMG5_PRId ".\n",__func__,k);
         }
+        _MMG5_DEL_MEM(mesh,perm,nperm*sizeof(MMG5_int));
+        return 0;
       }
+      kdep = list[0];
+
       if(!_MMG2_splitbar(mesh,list[0],k)) {
         if ( !mmgWarn2 ) {
           mmgWarn2 = 1;
           if(mesh->info.imprim < -1) fprintf(stderr,"\n  ## Warning: %s: unable to"
-                                            " insert at least 1 point with splitbar (%8d)\n",__func__,k);
+                                            " insert at least 1 point with splitbar (%8" MMG5_PRId ")\n",__func__,k);
         }
       } else {
         ns++;
@@ -289,10 +400,12 @@ int MMG2_insertpointdelone(MMG5_pMesh mesh,MMG5_pSol sol) {
     if ( abs(nus-ns) ) {
       fprintf(stderr,"  ## Error: %s: some vertex are not "
             "inserted %d.\n",__func__,abs(nus-ns));
+      _MMG5_DEL_MEM(mesh,perm,nperm*sizeof(MMG5_int));
       return 0;
     }
   }
-	return(1);
+  _MMG5_DEL_MEM(mesh,perm,nperm*sizeof(MMG5_int));
+  return(1);
 }
 
 /**
@@ -307,15 +420,17 @@ int MMG2_markSD(MMG5_pMesh mesh) {
   MMG5_pTria   pt,pt1;
   MMG5_pEdge   ped;
   MMG5_pPoint  ppt;
-  int          k,l,iadr,*adja,ped0,ped1,*list,ipil,ncurc,nref;
-  int          kinit,nt,nsd,ip1,ip2,ip3,ip4,ned,iel,voy;
+  int          ipil,ncurc,nref;
+  MMG5_int     k,l,iadr,*adja,ped0,ped1,*list;
+  int          nsd;
+  MMG5_int     kinit,nt,ip1,ip2,ip3,ip4,ned,iel,voy;
   char         i,i1,i2;
 
   /* Reset flag field for triangles */
   for(k=1 ; k<=mesh->nt ; k++)
     mesh->tria[k].flag = mesh->mark;
 
-  _MMG5_SAFE_CALLOC(list,mesh->nt,int,0);
+  _MMG5_SAFE_CALLOC(list,mesh->nt,MMG5_int,0);
   kinit = 0;
   nref  = 0;
   ip1   =  mesh->np;
@@ -493,8 +608,7 @@ int MMG2_mmg2d2(MMG5_pMesh mesh,MMG5_pSol sol) {
   MMG5_pTria     pt;
   MMG5_pPoint    ppt,ppt2;
   double    c[2],dd;
-  int       j,k,kk,ip1,ip2,ip3,ip4,jel,kel,nt,iadr,*adja;
-  int       *numper;
+  MMG5_int  k,kk,*numper,nt,iadr,*adja,j,ip1,ip2,ip3,ip4,jel,kel;
 
   mesh->base = 0;
   /* If triangles already exist, delete them */
@@ -513,7 +627,7 @@ int MMG2_mmg2d2(MMG5_pMesh mesh,MMG5_pSol sol) {
   /* This part seems useless */
   /* Deal with periodic vertices */
   if ( mesh->info.renum == -10 ) {
-    _MMG5_SAFE_CALLOC(numper,mesh->np+1,int,0);
+    _MMG5_SAFE_CALLOC(numper,mesh->np+1,MMG5_int,0);
     for (k=1; k<=mesh->np; k++) {
       ppt = &mesh->point[k];
       for (kk=k; kk<=mesh->np; kk++) {
@@ -649,7 +763,7 @@ int MMG2_mmg2d2(MMG5_pMesh mesh,MMG5_pSol sol) {
   }
 
   if(mesh->info.ddebug)
-    if ( !_MMG5_chkmsh(mesh,1,0) ) return 0;
+    if ( !mesh->func.chkmsh(mesh,1,0) ) return 0;
 
   /* Mark SubDomains and remove the bounding box triangles */
   if ( mesh->na ) {
@@ -83,7 +83,8 @@ int _MMG2_getIniRef(MMG5_pMesh mesh,int ref) {
 int _MMG2_resetRef(MMG5_pMesh mesh) {
   MMG5_pTria      pt;
   MMG5_pPoint     p0;
-  int             k,ref;
+  int             ref;
+  MMG5_int        k;
   char            i;
   
   for (k=1; k<=mesh->nt; k++) {
@@ -110,12 +111,12 @@ int _MMG2_resetRef(MMG5_pMesh mesh) {
 
 /* Check whether snapping the value of vertex i of k to 0 exactly leads to a non manifold situation
  assumption: the triangle k has vertex i with value 0 and the other two with changing values */
-int _MMG2_ismaniball(MMG5_pMesh mesh, MMG5_pSol sol, int start, char istart) {
+int _MMG2_ismaniball(MMG5_pMesh mesh, MMG5_pSol sol, MMG5_int start, char istart) {
   MMG5_pTria       pt;
   double           v1, v2;
-  int              *adja,k,ip1,ip2,end1;
+  MMG5_int         *adja,ip1,ip2,k,end1;
   char             i,i1,smsgn;
-  static char      mmgWarn=0;
+  static _MMG5_TLS char      mmgWarn=0;
 
   k = start;
   i = _MMG5_inxt2[istart];
@@ -171,7 +172,7 @@ int _MMG2_ismaniball(MMG5_pMesh mesh, MMG5_pSol sol, int start, char istart) {
     if ( !mmgWarn ) {
       mmgWarn = 1;
       fprintf(stderr,"\n  ## Warning: %s: unsnap at least 1 point "
-              "(point %d in tri %d).\n",__func__,_MMG2D_indElt(mesh,start),
+              "(point %" MMG5_PRId " in tri %" MMG5_PRId ").\n",__func__,_MMG2D_indElt(mesh,start),
               _MMG2D_indPt(mesh,mesh->tria[start].v[istart]));
     }
     return(0);
@@ -184,7 +185,8 @@ int _MMG2_snapval(MMG5_pMesh mesh, MMG5_pSol sol, double *tmp) {
   MMG5_pTria       pt,pt1;
   MMG5_pPoint      p0;
   double           v1,v2;
-  int              k,kk,iel,ns,nc,ip,ip1,ip2,npl,nmn,ilist,list[MMG2_LONMAX+2];
+  int              kk,ns,nc,npl,nmn,ilist;
+  MMG5_int         k,ip,ip1,ip2,list[MMG2_LONMAX+2],iel;
   char             i,j,j1,j2;
 
   /* Reset point flags */
@@ -270,9 +272,10 @@ int _MMG2_snapval(MMG5_pMesh mesh, MMG5_pSol sol, double *tmp) {
 
 /* Check whether the ball of vertex i in tria start is manifold;
  by assumption, i inxt[i] is one edge of the implicit boundary */
-int _MMG2_chkmaniball(MMG5_pMesh mesh, int start, char istart) {
+int _MMG2_chkmaniball(MMG5_pMesh mesh, MMG5_int start, char istart) {
   MMG5_pTria         pt;
-  int                *adja,k,refstart;
+  int                refstart;
+  MMG5_int           *adja,k;
   char               i,i1;
 
   pt = &mesh->tria[start];
@@ -342,9 +345,10 @@ int _MMG2_chkmaniball(MMG5_pMesh mesh, int start, char istart) {
 /* Check whether the resulting two subdomains occupying mesh are manifold */
 int _MMG2_chkmanimesh(MMG5_pMesh mesh) {
   MMG5_pTria      pt,pt1;
-  int             *adja,k,cnt,iel;
+  int             cnt;
+  MMG5_int        k,*adja,iel;
   char            i,i1;
-  static char     mmgWarn=0;
+  static _MMG5_TLS char     mmgWarn=0;
 
   /* First check: check whether one triangle in the mesh has 3 boundary faces */
   for (k=1; k<=mesh->nt; k++) {
@@ -415,7 +419,8 @@ int _MMG2_cuttri_ls(MMG5_pMesh mesh, MMG5_pSol sol){
   MMG5_pPoint  p0,p1;
   _MMG5_Hash   hash;
   double       v0,v1,s,c[2];
-  int          k,ip0,ip1,nb,np,nt,ns,refint,refext,vx[3];
+  int          nb,ns,refint,refext;
+  MMG5_int     k,ip0,ip1,np,nt,vx[3];
   char         i,i0,i1,ier;
 
   /* Reset flag field for points */
@@ -544,7 +549,7 @@ int _MMG2_cuttri_ls(MMG5_pMesh mesh, MMG5_pSol sol){
   if ( (mesh->info.ddebug || abs(mesh->info.imprim) > 5) && ns > 0 )
     fprintf(stdout,"     %7d splitted\n",ns);
 
-  _MMG5_DEL_MEM(mesh,hash.item,(hash.max+1)*sizeof(_MMG5_hedge));
+  _MMG5_DEL_MEM(mesh,hash.item,hash.siz*sizeof(_MMG5_hedge));
   return(ns);
 
 }
@@ -553,7 +558,8 @@ int _MMG2_cuttri_ls(MMG5_pMesh mesh, MMG5_pSol sol){
 int _MMG2_setref_ls(MMG5_pMesh mesh, MMG5_pSol sol){
   MMG5_pTria    pt;
   double        v,v1;
-  int           k,ip,ip1,ier,ref,refint,refext;
+  int           ier,ref,refint,refext;
+  MMG5_int      k,ip,ip1;
   char          i,nmn,npl,nz;
 
   for (k=1; k<=mesh->nt; k++) {
@@ -612,7 +618,7 @@ int _MMG2_setref_ls(MMG5_pMesh mesh, MMG5_pSol sol){
 /* Main function of the -ls mode */
 int MMG2_mmg2d6(MMG5_pMesh mesh, MMG5_pSol sol) {
   double *tmp;
-  int k;
+  MMG5_int k;
   
   if ( abs(mesh->info.imprim) > 3 )
     fprintf(stdout,"  ** ISOSURFACE EXTRACTION\n");
@@ -642,7 +648,7 @@ int MMG2_mmg2d6(MMG5_pMesh mesh, MMG5_pSol sol) {
   }
 
   /* No need to keep adjacencies from now on */
-  _MMG5_DEL_MEM(mesh,mesh->adja,(3*mesh->ntmax+5)*sizeof(int));
+  _MMG5_DEL_MEM(mesh,mesh->adja,(3*mesh->ntmax+5)*sizeof(MMG5_int));
 
   /* Transfer the boundary edge references to the triangles */
   if ( !MMG2_assignEdge(mesh) ) {
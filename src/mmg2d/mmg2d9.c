@@ -41,7 +41,8 @@
 double _MMG2_estavglen(MMG5_pMesh mesh) {
   MMG5_pTria     pt;
   MMG5_pPoint    p1,p2;
-  int            k,na;
+  int            na;
+  MMG5_int       k;
   double         len,lent,dna;
   char           i,i1,i2;
 
@@ -107,7 +108,7 @@ int _MMG2_chkmovmesh(MMG5_pMesh mesh,MMG5_pSol disp,short t) {
   MMG5_pTria   pt;
   MMG5_pPoint  ppt;
   double       *v,c[3][2],tau;
-  int          k,np;
+  MMG5_int     k,np;
   char         i,j;
 
   /* Pseudo time-step = fraction of disp to perform */
@@ -178,7 +179,7 @@ int _MMG2_dispmesh(MMG5_pMesh mesh,MMG5_pSol disp,short t,int itdeg) {
   MMG5_pTria    pt;
   MMG5_pPoint   ppt;
   double        *v,tau,ctau,c[3][2],ocal,ncal;
-  int           k,np;
+  MMG5_int      k,np;
   char          i,j;
 
   tau = (double)t /_MMG2_SHORTMAX;
@@ -245,9 +246,10 @@ int _MMG2_spllag(MMG5_pMesh mesh,MMG5_pSol disp,MMG5_pSol met,int itdeg,int *war
   MMG5_pTria      pt;
   MMG5_pPoint     p1,p2;
   double          hma2,lmax,len;
-  int             k,ns,ip,ip1,ip2;
+  int             ns;
+  MMG5_int        k,ip1,ip2,ip;
   char            i,i1,i2,imax,ier;
-  static char     mmgWarn0=0;
+  static _MMG5_TLS char     mmgWarn0=0;
 
   *warn = 0;
   ns    = 0;
@@ -340,7 +342,8 @@ static int _MMG2_coleltlag(MMG5_pMesh mesh,MMG5_pSol met,int itdeg) {
   MMG5_pTria     pt;
   MMG5_pPoint    p1,p2;
   double         hmi2,len;
-  int            nc,k,ilist,list[MMG2_LONMAX+2];
+  int            nc,ilist;
+  MMG5_int       k,list[MMG2_LONMAX+2];
   char           i,i1,i2,open;
 
   nc    = 0;
@@ -400,7 +403,8 @@ static int _MMG2_coleltlag(MMG5_pMesh mesh,MMG5_pSol met,int itdeg) {
  */
 int _MMG2_swpmshlag(MMG5_pMesh mesh,MMG5_pSol met,double crit,int itdeg) {
   MMG5_pTria   pt;
-  int          k,it,maxit,ns,nns;
+  int          it,maxit,ns,nns;
+  MMG5_int     k;
   char         i;
 
   maxit = 2;
@@ -434,7 +438,7 @@ int _MMG2_swpmshlag(MMG5_pMesh mesh,MMG5_pSol met,double crit,int itdeg) {
 /** For debugging purposes: save disp */
 int _MMG2D_saveDisp(MMG5_pMesh mesh,MMG5_pSol disp) {
   FILE        *out;
-  int         k;
+  MMG5_int    k;
   char        data[256],*ptr;
   
   strcpy(data,"disp.sol");
@@ -445,7 +449,7 @@ int _MMG2D_saveDisp(MMG5_pMesh mesh,MMG5_pSol disp) {
   out = fopen(data,"w");
   printf("save disp\n");
   fprintf(out,"MeshVersionFormatted 1\n\nDimension\n%d\n\n",disp->dim);
-  fprintf(out,"SolAtVertices\n%d\n 1 2\n",disp->np);
+  fprintf(out,"SolAtVertices\n%" MMG5_PRId "\n 1 2\n",disp->np);
   
   /* Print solutions */
   for(k=1; k<= disp->np; k++) {
@@ -469,7 +473,8 @@ int _MMG2D_saveDisp(MMG5_pMesh mesh,MMG5_pSol disp) {
 int _MMG2_movtrilag(MMG5_pMesh mesh,MMG5_pSol met,int itdeg) {
   MMG5_pTria        pt;
   MMG5_pPoint       p0;
-  int               k,it,base,maxit,nm,nnm,ilist,list[MMG2_LONMAX+2];
+  int               it,base,maxit,nm,nnm,ilist;
+  MMG5_int          k,list[MMG2_LONMAX+2];
   char              i,ier;
 
   nnm   = 0;
@@ -520,7 +525,8 @@ int _MMG2_movtrilag(MMG5_pMesh mesh,MMG5_pSol met,int itdeg) {
                      info.lag > 1  -> displacement + remeshing with split + collapse + swap + move */
 int MMG2_mmg2d9(MMG5_pMesh mesh,MMG5_pSol disp,MMG5_pSol met) {
   double             avlen,tau,hmintmp,hmaxtmp;
-  int                k,itmn,itdc,maxitmn,maxitdc,iit,warn;
+  int                itmn,itdc,maxitmn,maxitdc,iit,warn;
+  MMG5_int           k;
   int                nspl,nnspl,nnnspl,nc,nnc,nnnc,ns,nns,nnns,nm,nnm,nnnm;
   short              t;
   char               ier;
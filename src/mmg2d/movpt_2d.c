@@ -49,13 +49,14 @@
  * isotropic and anisotropic case
  *
  */
-int _MMG2_movedgpt(MMG5_pMesh mesh,MMG5_pSol met,int ilist,int *list, char improve) {
+int _MMG2_movedgpt(MMG5_pMesh mesh,MMG5_pSol met,int ilist,MMG5_int *list, char improve) {
   MMG5_pTria         pt,pt0;
   MMG5_pPoint        p0,p1,p2,ppt;
   double             step,ll1,ll2,o[2],no[2],calold,calnew;
-  int                k,iel,ip0,ip1,ip2,it1,it2;
+  int                k;
+  MMG5_int           ip0,ip1,ip2,iel,it1,it2;
   char               i,i1,i2;
-  static char        mmgWarn0=0,mmgWarn1=0;
+  static _MMG5_TLS char        mmgWarn0=0,mmgWarn1=0;
     
   pt0 = &mesh->tria[0];
   step = 0.1;
@@ -70,7 +71,7 @@ int _MMG2_movedgpt(MMG5_pMesh mesh,MMG5_pSol met,int ilist,int *list, char impro
     i2 = _MMG5_iprv2[i];
     
     pt = &mesh->tria[iel];
-    calold = MG_MIN(MMG2D_caltri(mesh,met,pt),calold);
+    calold = MG_MIN(mesh->func.caltri(mesh,met,pt),calold);
  
     if ( MG_EDG(pt->tag[i1]) ) {
       if ( ip1 == 0 ) {
@@ -177,7 +178,7 @@ int _MMG2_movedgpt(MMG5_pMesh mesh,MMG5_pSol met,int ilist,int *list, char impro
     memcpy(pt0,pt,sizeof(MMG5_Tria));
     pt0->v[i] = 0;
     
-    calnew = MG_MIN(MMG2D_caltri(mesh,met,pt0),calnew);
+    calnew = MG_MIN(mesh->func.caltri(mesh,met,pt0),calnew);
   }
   
   if ( calold < _MMG2_NULKAL && calnew <= calold ) return(0);
@@ -209,11 +210,12 @@ int _MMG2_movedgpt(MMG5_pMesh mesh,MMG5_pSol met,int ilist,int *list, char impro
  * Relocate internal vertex whose ball is passed.
  *
  */
-int _MMG2_movintpt(MMG5_pMesh mesh,MMG5_pSol met,int ilist,int *list,char improve) {
+int _MMG2_movintpt(MMG5_pMesh mesh,MMG5_pSol met,int ilist,MMG5_int *list,char improve) {
   MMG5_pTria        pt,pt0;
   MMG5_pPoint       p0,p1,p2,ppt0;
   double            calold,calnew,vol,volbal,b[2];
-  int               k,iel;
+  int               k;
+  MMG5_int          iel;
   char              i,i1,i2;
   
   ppt0 = &mesh->point[0];
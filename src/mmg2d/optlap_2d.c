@@ -40,7 +40,8 @@
 int MMG2_optlap(MMG5_pMesh mesh,MMG5_pSol sol) {
   MMG5_pTria   pt;
   MMG5_pPoint  ppt,ppta,pptb;
-  int     k,it,maxtou,i,ipa,ipb,iadr;
+  int     it,maxtou,i;
+  MMG5_int k,ipa,ipb,iadr;
   double  omega,mu,*cnew,*cold,*cini,res,res0,*ncount,len;
   int iare[3][2] = {{0,1},{0,2},{1,2}};
 
@@ -33,6 +33,10 @@
 
 #include "mmg2d.h"
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 /**
  * \param mesh pointer toward the mesh
  * \param pt pointer toward the tria
@@ -96,7 +100,8 @@ double _MMG2_caltri_ani(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTria pt) {
   double     abx,aby,acx,acy,bcx,bcy;
   double     *a,*b,*c,*ma,*mb,*mc;
   double     area,aream,hm,m[6],h1,h2,h3;
-  int        ipa,ipb,ipc,i;
+  int        i;
+  MMG5_int   ipa,ipb,ipc;
 
   ipa = pt->v[0];
   ipb = pt->v[1];
@@ -154,72 +159,95 @@ double _MMG2_caltri_ani(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTria pt) {
  *
  */
 int MMG2_outqua(MMG5_pMesh mesh,MMG5_pSol met) {
-  MMG5_pTria    pt;
-  double        rap,rapmin,rapmax,rapavg,med,good;
-  int           i,k,iel,ok,ir,imax,nex,his[5];
-  static char   mmgWarn0;
-
-  /* Compute triangle quality*/
-  for (k=1; k<=mesh->nt; k++) {
-    pt = &mesh->tria[k];
-    if( !MG_EOK(pt) )   continue;
-
-    if ( !met->m ) {
-      pt->qual = _MMG2_caltri_iso(mesh,met,pt);
-    }
-    else
-      pt->qual = MMG2D_caltri(mesh,met,pt);
-  }
-  if ( mesh->info.imprim <= 0 ) return 1;
+  MMG5_pTria     pt;
+  _MMG5_quaStat  *st,*ps;
+  double         rap,rapmin,rapmax,rapavg,med,good;
+  int            i,ir,imax,nth,ier;
+  MMG5_int       k,iel,nex,*his;
+  char           warn;
+  static _MMG5_TLS char   mmgWarn0;
 
-  rapmin  = 2.0;
-  rapmax  = 0.0;
-  rapavg  = med = good = 0.0;
-  iel     = 0;
+#ifdef _OPENMP
+  nth = MG_MAX(1,mesh->info.nthreads);
+#else
+  nth = 1;
+#endif
 
-  for (k=0; k<5; k++)  his[k] = 0;
+  _MMG5_SAFE_CALLOC(st,nth,_MMG5_quaStat,0);
+  _MMG5_initQuaStat(st,nth,2.0,0.0);
+  warn = mmgWarn0;
 
-  nex = ok = 0;
-  for (k=1; k<=mesh->nt; k++) {
-    pt = &mesh->tria[k];
-    if( !MG_EOK(pt) ) {
-      nex++;
-      continue;
-    }
-    ok++;
-    if ( (!mmgWarn0) && (_MMG2_quickcal(mesh,pt) < 0.0) ) {
-      mmgWarn0 = 1;
-      fprintf(stderr,"  ## Warning: %s: at least 1 negative area\n",__func__);
-    }
+  /* Compute triangle quality and its statistics */
+#pragma omp parallel num_threads(nth) private(pt,ps,rap,ir)
+  {
+#ifdef _OPENMP
+    ps = &st[omp_get_thread_num()];
+#else
+    ps = st;
+#endif
+#pragma omp for schedule(static)
+    for (k=1; k<=mesh->nt; k++) {
+      pt = &mesh->tria[k];
+      if( !MG_EOK(pt) ) {
+        ps->nex++;
+        continue;
+      }
 
-    if ( !met->m ) {
-      rap = _MMG2D_ALPHAD * _MMG2_caltri_iso(mesh,met,pt);
-    }
-    else
-      rap = _MMG2D_ALPHAD * MMG2D_caltri(mesh,met,pt);
+      if ( !met->m ) {
+        pt->qual = _MMG2_caltri_iso(mesh,met,pt);
+      }
+      else
+        pt->qual = mesh->func.caltri(mesh,met,pt);
+
+      if ( mesh->info.imprim <= 0 )  continue;
 
-    if ( rap < rapmin ) {
-      rapmin = rap;
-      iel    = ok;
+      ps->ok++;
+      if ( (!warn) && (!ps->neg) && (_MMG2_quickcal(mesh,pt) < 0.0) )
+        ps->neg = 1;
+
+      rap = _MMG2D_ALPHAD * pt->qual;
+      if ( rap < ps->rapmin ) {
+        ps->rapmin = rap;
+        ps->iel    = ps->ok;
+      }
+      if ( rap > 0.5 )  ps->med++;
+      if ( rap > 0.12 ) ps->good++;
+      if ( rap < _MMG2D_BADKAL )  ps->badkal = 1;
+      ps->rapavg += rap;
+      ps->rapmax  = MG_MAX(ps->rapmax,rap);
+      ir = MG_MIN(4,(int)(5.0*rap));
+      ps->his[ir] += 1;
     }
-    if ( rap > 0.5 )  med++;
-    if ( rap > 0.12 ) good++;
-    if ( rap < _MMG2D_BADKAL )  mesh->info.badkal = 1;
-    rapavg += rap;
-    rapmax  = MG_MAX(rapmax,rap);
-    ir = MG_MIN(4,(int)(5.0*rap));
-    his[ir] += 1;
   }
+  if ( mesh->info.imprim <= 0 ) {
+    _MMG5_SAFE_FREE(st);
+    return 1;
+  }
+
+  _MMG5_mergeQuaStat(st,nth,0);
+  if ( st[0].neg ) {
+    mmgWarn0 = 1;
+    fprintf(stderr,"  ## Warning: %s: at least 1 negative area\n",__func__);
+  }
+  if ( st[0].badkal )  mesh->info.badkal = 1;
+  rapmin = st[0].rapmin;
+  rapmax = st[0].rapmax;
+  rapavg = st[0].rapavg;
+  med    = st[0].med;
+  good   = st[0].good;
+  iel    = st[0].iel;
+  nex    = st[0].nex;
+  his    = st[0].his;
 
 #ifndef DEBUG
-  fprintf(stdout,"\n  -- MESH QUALITY   %d\n",mesh->nt - nex);
-  fprintf(stdout,"     BEST   %8.6f  AVRG.   %8.6f  WRST.   %8.6f (%d)\n",
+  fprintf(stdout,"\n  -- MESH QUALITY   %" MMG5_PRId "\n",mesh->nt - nex);
+  fprintf(stdout,"     BEST   %8.6f  AVRG.   %8.6f  WRST.   %8.6f (%" MMG5_PRId ")\n",
           rapmax,rapavg / (mesh->nt-nex),rapmin,iel);
 #else
   fprintf(stdout,"     BEST   %e  AVRG.   %e  WRST.   %e (%d)\n => %d %d %d\n",
           rapmax,rapavg / (mesh->nt-nex),rapmin,iel,
-          _MMG5_indPt(mesh,mesh->tria[iel].v[0]),_MMG5_indPt(mesh,mesh->tria[iel].v[1]),
-          _MMG5_indPt(mesh,mesh->tria[iel].v[2]));
+          mesh->func.indPt(mesh,mesh->tria[iel].v[0]),mesh->func.indPt(mesh,mesh->tria[iel].v[1]),
+          mesh->func.indPt(mesh,mesh->tria[iel].v[2]));
 #endif
 
   /* print histo */
@@ -229,10 +257,12 @@ int MMG2_outqua(MMG5_pMesh mesh,MMG5_pSol met) {
     fprintf(stdout,"                  %6.2f %% >  0.5\n",100.0*( med/(float)(mesh->nt-nex)));
     imax = MG_MIN(4,(int)(5.*rapmax));
     for (i=imax; i>=(int)(5*rapmin); i--) {
-      fprintf(stdout,"     %5.1f < Q < %5.1f   %7d   %6.2f %%\n",
+      fprintf(stdout,"     %5.1f < Q < %5.1f   %7" MMG5_PRId "   %6.2f %%\n",
               i/5.,i/5.+0.2,his[i],100.*(his[i]/(float)(mesh->nt-nex)));
     }
   }
 
-  return ( _MMG5_minQualCheck(iel,rapmin,_MMG2D_ALPHAD) );
+  ier = _MMG5_minQualCheck(iel,rapmin,_MMG2D_ALPHAD);
+  _MMG5_SAFE_FREE(st);
+  return(ier);
 }
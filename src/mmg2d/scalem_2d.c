@@ -51,9 +51,10 @@ int MMG2_scaleMesh(MMG5_pMesh mesh,MMG5_pSol sol) {
   double         dd,isqhmin,isqhmax;
   double         *m;
   double         lambda[2],v[2][2];
-  int            i,k,iadr;
+  int            i;
+  MMG5_int       k,iadr;
   char           sethmin,sethmax;
-  static char    mmgWarn0=0, mmgWarn1=0;
+  static _MMG5_TLS char    mmgWarn0=0, mmgWarn1=0;
 
   // pd  = mesh->disp;
   /* compute bounding box */
@@ -302,7 +303,8 @@ int MMG2_unscaleMesh(MMG5_pMesh mesh,MMG5_pSol sol) {
   MMG5_pPoint     ppt;
   MMG5_Info      *info;
   double          dd;
-  int             i,k,iadr;
+  int             i;
+  MMG5_int        k,iadr;
 
   info = &mesh->info;
 
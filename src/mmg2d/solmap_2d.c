@@ -47,7 +47,8 @@ int MMG2D_doSol(MMG5_pMesh mesh,MMG5_pSol sol) {
   MMG5_pTria      ptt,pt;
   MMG5_pPoint     p1,p2;
   double          ux,uy,dd;
-  int             i,k,ib,iadr,ipa,ipb;
+  int             i,ib;
+  MMG5_int        k,iadr,ipa,ipb;
   int             MMG_inxtt[5] = {0,1,2,0,1};
 
   /* Memory alloc */
@@ -171,10 +172,10 @@ int MMG2D_doSol(MMG5_pMesh mesh,MMG5_pSol sol) {
   }
 
   /* compute quality */
-  if ( MMG2D_caltri ) {
+  if ( mesh->func.caltri ) {
     for (k=1; k<=mesh->nt; k++) {
       pt = &mesh->tria[k];
-      pt->qual = MMG2D_caltri(mesh,sol,pt);
+      pt->qual = mesh->func.caltri(mesh,sol,pt);
     }
   }
 
@@ -33,7 +33,6 @@
 
 #include "mmg2d.h"
 
-extern unsigned char ddb;
 
 /**
  * \param mesh pointer toward the mesh
@@ -47,11 +46,12 @@ extern unsigned char ddb;
  * possibly perform a dichotomy to find the latest valid position for the point.
  *
  */
-int _MMG2_chkspl(MMG5_pMesh mesh,MMG5_pSol met,int k,char i) {
+MMG5_int _MMG2_chkspl(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,char i) {
   MMG5_pTria           pt,pt1,pt0;
   MMG5_pPoint          p1,p2,ppt;
   double               mid[2],o[2],no[2],calnew,caltmp,tp,to,t;
-  int                  ip,jel,*adja,it,maxit,npinit;
+  int                  it,maxit;
+  MMG5_int             *adja,npinit,ip,jel;
   char                 i1,i2,j,j1,j2,ier,isv;
 
   npinit = mesh->np;
@@ -99,22 +99,22 @@ int _MMG2_chkspl(MMG5_pMesh mesh,MMG5_pSol met,int k,char i) {
     memcpy(pt0,pt,sizeof(MMG5_Tria));
     pt0->v[i2] = ip;
     
-    caltmp = _MMG2D_ALPHAD*MMG2D_caltri(mesh,met,pt0);
+    caltmp = _MMG2D_ALPHAD*mesh->func.caltri(mesh,met,pt0);
     calnew = MG_MIN(calnew,caltmp);
 
     pt0->v[i1] = ip; pt0->v[i2] = pt->v[i2];
-    caltmp = _MMG2D_ALPHAD*MMG2D_caltri(mesh,met,pt0);
+    caltmp = _MMG2D_ALPHAD*mesh->func.caltri(mesh,met,pt0);
     calnew = MG_MIN(calnew,caltmp);
 
     if ( jel ) {
       pt1 = &mesh->tria[jel];
       memcpy(pt0,pt1,sizeof(MMG5_Tria));
       pt0->v[j1] = ip;
-      caltmp = _MMG2D_ALPHAD*MMG2D_caltri(mesh,met,pt0);
+      caltmp = _MMG2D_ALPHAD*mesh->func.caltri(mesh,met,pt0);
       calnew = MG_MIN(calnew,caltmp);
 
       pt0->v[j1] = pt1->v[j1] ; pt0->v[j2] = ip;
-      caltmp = _MMG2D_ALPHAD*MMG2D_caltri(mesh,met,pt0);
+      caltmp = _MMG2D_ALPHAD*mesh->func.caltri(mesh,met,pt0);
       calnew = MG_MIN(calnew,caltmp);
     }
 
@@ -164,22 +164,22 @@ int _MMG2_chkspl(MMG5_pMesh mesh,MMG5_pSol met,int k,char i) {
       calnew = DBL_MAX;
       memcpy(pt0,pt,sizeof(MMG5_Tria));
       pt0->v[i2] = ip;
-      caltmp = _MMG2D_ALPHAD*MMG2D_caltri(mesh,met,pt0);
+      caltmp = _MMG2D_ALPHAD*mesh->func.caltri(mesh,met,pt0);
       calnew = MG_MIN(calnew,caltmp);
 
       pt0->v[i1] = ip; pt0->v[i2] = pt->v[i2];
-      caltmp = _MMG2D_ALPHAD*MMG2D_caltri(mesh,met,pt0);
+      caltmp = _MMG2D_ALPHAD*mesh->func.caltri(mesh,met,pt0);
       calnew = MG_MIN(calnew,caltmp);
 
       if ( jel ) {
         pt1 = &mesh->tria[jel];
         memcpy(pt0,pt1,sizeof(MMG5_Tria));
         pt0->v[j1] = ip;
-        caltmp = _MMG2D_ALPHAD*MMG2D_caltri(mesh,met,pt0);
+        caltmp = _MMG2D_ALPHAD*mesh->func.caltri(mesh,met,pt0);
         calnew = MG_MIN(calnew,caltmp);
 
         pt0->v[j1] = pt1->v[j1] ; pt0->v[j2] = ip;
-        caltmp = _MMG2D_ALPHAD*MMG2D_caltri(mesh,met,pt0);
+        caltmp = _MMG2D_ALPHAD*mesh->func.caltri(mesh,met,pt0);
         calnew = MG_MIN(calnew,caltmp);
       }
       
@@ -213,7 +213,7 @@ int _MMG2_chkspl(MMG5_pMesh mesh,MMG5_pSol met,int k,char i) {
   }
 
   /* Interpolate metric at ip, if any */
-  MMG2D_intmet(mesh,met,k,i,ip,0.5);
+  mesh->func.intmet(mesh,met,k,i,ip,0.5);
 
   return(ip);
 }
@@ -230,9 +230,9 @@ int _MMG2_chkspl(MMG5_pMesh mesh,MMG5_pSol met,int k,char i) {
  * adjacency structure in the mesh is preserved
  *
  */
-int _MMG2_split1b(MMG5_pMesh mesh,int k,char i,int ip) {
+int _MMG2_split1b(MMG5_pMesh mesh,MMG5_int k,char i,MMG5_int ip) {
   MMG5_pTria         pt,pt1;
-  int                *adja,iel,jel,kel,mel;
+  MMG5_int           *adja,iel,jel,kel,mel;
   char               i1,i2,m,j,j1,j2;
 
   iel = _MMG2D_newElt(mesh);
@@ -256,7 +256,7 @@ int _MMG2_split1b(MMG5_pMesh mesh,int k,char i,int ip) {
 
   pt1 = &mesh->tria[iel];
   memcpy(pt1,pt,sizeof(MMG5_Tria));
-  memcpy(&mesh->adja[3*(iel-1)+1],&mesh->adja[3*(k-1)+1],3*sizeof(int));
+  memcpy(&mesh->adja[3*(iel-1)+1],&mesh->adja[3*(k-1)+1],3*sizeof(MMG5_int));
 
   /* Update both triangles */
   pt->v[i2]  = ip;
@@ -294,7 +294,7 @@ int _MMG2_split1b(MMG5_pMesh mesh,int k,char i,int ip) {
     pt->base = mesh->base;
 
     memcpy(pt1,pt,sizeof(MMG5_Tria));
-    memcpy(&mesh->adja[3*(kel-1)+1],&mesh->adja[3*(jel-1)+1],3*sizeof(int));
+    memcpy(&mesh->adja[3*(kel-1)+1],&mesh->adja[3*(jel-1)+1],3*sizeof(MMG5_int));
 
     /* Update triangles */
     pt->v[j1]    = ip;
@@ -331,7 +331,7 @@ int _MMG2_split1b(MMG5_pMesh mesh,int k,char i,int ip) {
  * Simulate the split of one edge in triangle k
  *
  */
-int _MMG2_split1_sim(MMG5_pMesh mesh, MMG5_pSol sol, int k, int vx[3]) {
+int _MMG2_split1_sim(MMG5_pMesh mesh, MMG5_pSol sol, MMG5_int k, MMG5_int vx[3]) {
   MMG5_pTria         pt,pt0;
   double             cal;
   unsigned char      tau[3];
@@ -376,10 +376,10 @@ int _MMG2_split1_sim(MMG5_pMesh mesh, MMG5_pSol sol, int k, int vx[3]) {
  * Split 1 edge of triangle k
  *
  */
-int _MMG2_split1(MMG5_pMesh mesh, MMG5_pSol sol, int k, int vx[3]) {
+int _MMG2_split1(MMG5_pMesh mesh, MMG5_pSol sol, MMG5_int k, MMG5_int vx[3]) {
   MMG5_pTria       pt,pt1;
   MMG5_pPoint      p0;
-  int              iel;
+  MMG5_int         iel;
   unsigned char    tau[3];
 
   pt = &mesh->tria[k];
@@ -442,7 +442,7 @@ int _MMG2_split1(MMG5_pMesh mesh, MMG5_pSol sol, int k, int vx[3]) {
  * Simulate the split of two edges in triangle k
  *
  */
-int _MMG2_split2_sim(MMG5_pMesh mesh, MMG5_pSol sol, int k, int vx[3]) {
+int _MMG2_split2_sim(MMG5_pMesh mesh, MMG5_pSol sol, MMG5_int k, MMG5_int vx[3]) {
   MMG5_pTria        pt,pt0;
   double            cal;
   unsigned char     tau[3];
@@ -491,10 +491,10 @@ int _MMG2_split2_sim(MMG5_pMesh mesh, MMG5_pSol sol, int k, int vx[3]) {
  * Split 2 edges of triangle k
  *
  */
-int _MMG2_split2(MMG5_pMesh mesh, MMG5_pSol sol, int k, int vx[3]) {
+int _MMG2_split2(MMG5_pMesh mesh, MMG5_pSol sol, MMG5_int k, MMG5_int vx[3]) {
   MMG5_pTria       pt,pt1,pt2;
   MMG5_pPoint      p1,p2;
-  int              iel,jel;
+  MMG5_int         iel,jel;
   unsigned char    tau[3];
 
   pt = &mesh->tria[k];
@@ -578,7 +578,7 @@ int _MMG2_split2(MMG5_pMesh mesh, MMG5_pSol sol, int k, int vx[3]) {
  * Simulate the split of three edges in triangle k
  *
  */
-int _MMG2_split3_sim(MMG5_pMesh mesh, MMG5_pSol sol, int k, int vx[3]) {
+int _MMG2_split3_sim(MMG5_pMesh mesh, MMG5_pSol sol, MMG5_int k, MMG5_int vx[3]) {
   MMG5_pTria         pt,pt0;
   double             cal;
 
@@ -616,10 +616,10 @@ int _MMG2_split3_sim(MMG5_pMesh mesh, MMG5_pSol sol, int k, int vx[3]) {
  * Split the three edges of triangle k
  *
  */
-int _MMG2_split3(MMG5_pMesh mesh, MMG5_pSol sol, int k, int vx[3]) {
+int _MMG2_split3(MMG5_pMesh mesh, MMG5_pSol sol, MMG5_int k, MMG5_int vx[3]) {
   MMG5_pTria          pt,pt1,pt2,pt3;
   MMG5_pPoint         p0,p1,p2;
-  int                 iel,jel,kel;
+  MMG5_int            iel,jel,kel;
 
   pt = &mesh->tria[k];
   pt->flag = 0;
@@ -707,11 +707,10 @@ int _MMG2_split3(MMG5_pMesh mesh, MMG5_pSol sol, int k, int vx[3]) {
  * Insert the point ip inside the tria k
  *
  */
-int _MMG2_splitbar(MMG5_pMesh mesh,int k,int ip) {
+int _MMG2_splitbar(MMG5_pMesh mesh,MMG5_int k,MMG5_int ip) {
   MMG5_pTria         pt,pt0,pt1,pt2;
   MMG5_pPoint        p0,p1,p2,ppt;
-  int                *adja,iel1,iel2,jel0,jel1,jel2;
-  int                ip0,ip1,ip2;
+  MMG5_int           ip0,ip1,ip2,*adja,iel1,iel2,jel0,jel1,jel2;
   char               i1,i2,m,j,j1,j2,j0;
   double             cal,calseuil;
 
@@ -771,10 +770,10 @@ int _MMG2_splitbar(MMG5_pMesh mesh,int k,int ip) {
 
   pt1 = &mesh->tria[iel1];
   memcpy(pt1,pt,sizeof(MMG5_Tria));
-  memcpy(&mesh->adja[3*(iel1-1)+1],&mesh->adja[3*(k-1)+1],3*sizeof(int));
+  memcpy(&mesh->adja[3*(iel1-1)+1],&mesh->adja[3*(k-1)+1],3*sizeof(MMG5_int));
   pt2 = &mesh->tria[iel2];
   memcpy(pt2,pt,sizeof(MMG5_Tria));
-  memcpy(&mesh->adja[3*(iel2-1)+1],&mesh->adja[3*(k-1)+1],3*sizeof(int));
+  memcpy(&mesh->adja[3*(iel2-1)+1],&mesh->adja[3*(k-1)+1],3*sizeof(MMG5_int));
 
   /* Update the three triangles */
   pt->v[1]  = ip;
@@ -36,10 +36,11 @@
 /* Version of edge swapping specific to the boundary enforcement stage in Delaunay meshing; 
    the quality of the resulting criterion should be > crit.
    list returns both modified triangles */
-int _MMG2_swapdelone(MMG5_pMesh mesh,MMG5_pSol sol,int k,char i,double crit,int *list) {
+int _MMG2_swapdelone(MMG5_pMesh mesh,MMG5_pSol sol,MMG5_int k,char i,double crit,MMG5_int *list) {
   MMG5_pTria         pt,pt1,pt0;
   double             cal1,cal2,area1,area2,arean1,arean2;
-  int                *adja,*adja1,k1,k2,k3,vo2,vo3,num,num1,numa1;
+  int                num,num1,numa1;
+  MMG5_int           *adja,*adja1,k1,k2,k3,vo2,vo3;
   char               i1,i2,j,j1,j2;
 
   adja = &mesh->adja[3*(k-1)+1];
@@ -123,10 +124,10 @@ int _MMG2_swapdelone(MMG5_pMesh mesh,MMG5_pSol sol,int k,char i,double crit,int
 }
 
 /* Check whether swap of edge i in triangle k is valid, and suitable for the mesh */
-int _MMG2_chkswp(MMG5_pMesh mesh, MMG5_pSol met,int k,char i,char typchk) {
+int _MMG2_chkswp(MMG5_pMesh mesh, MMG5_pSol met,MMG5_int k,char i,char typchk) {
   MMG5_pTria          pt,pt0,pt1;
   double              /*loni,lona,*/cal1,cal2,calnat,calchg;
-  int                 *adja,ip,ip1,ip2,iq,kk;
+  MMG5_int            *adja,ip,ip1,ip2,iq,kk;
   unsigned char       i1,i2,ii,ii1,ii2;
   
   pt0 = &mesh->tria[0];
@@ -159,8 +160,8 @@ int _MMG2_chkswp(MMG5_pMesh mesh, MMG5_pSol met,int k,char i,char typchk) {
    longer than the swapped one, and than the maximum authorized edge length */
   /* I believe this test is hindering the reach of good quality */
   /* if ( typchk == 2 && met->m ) { */
-  /*   loni = MMG2D_lencurv(mesh,met,ip1,ip2); */
-  /*   lona = MMG2D_lencurv(mesh,met,ip,iq); */
+  /*   loni = mesh->func.lencurv(mesh,met,ip1,ip2); */
+  /*   lona = mesh->func.lencurv(mesh,met,ip,iq); */
   /*   if ( loni > 1.0 )  loni = MG_MIN(1.0 / loni,MMG2_LSHRT); */
   /*   if ( lona > 1.0 )  lona = 1.0 / lona; */
   /*   if ( lona < loni )  return(0); */
@@ -216,9 +217,9 @@ int _MMG2_chkswp(MMG5_pMesh mesh, MMG5_pSol met,int k,char i,char typchk) {
 }
 
 /* Effective swap of edge i in triangle k */
-int _MMG2_swapar(MMG5_pMesh mesh,int k,char i) {
+int _MMG2_swapar(MMG5_pMesh mesh,MMG5_int k,char i) {
   MMG5_pTria    pt,pt1;
-  int     *adja,adj,k11,k21;
+  MMG5_int *adja,adj,k11,k21;
   char     i1,i2,j,jj,j2,v11,v21;
   
   pt   = &mesh->tria[k];
@@ -42,9 +42,10 @@
  * find the element index in packed numerotation
  *
  */
-int _MMG2D_indElt(MMG5_pMesh mesh, int kel) {
+MMG5_int _MMG2D_indElt(MMG5_pMesh mesh, MMG5_int kel) {
     MMG5_pTria pt;
-    int        ne, k;
+    int        ne;
+    MMG5_int   k;
 
     ne = 0;
     for (k=1; k<=mesh->nt; k++) {
@@ -66,9 +67,10 @@ int _MMG2D_indElt(MMG5_pMesh mesh, int kel) {
  * find the point index in packed numerotation
  *
  */
-int _MMG2D_indPt(MMG5_pMesh mesh, int kp) {
+MMG5_int _MMG2D_indPt(MMG5_pMesh mesh, MMG5_int kp) {
     MMG5_pPoint ppt;
-    int         np, k;
+    int         np;
+    MMG5_int    k;
 
     np = 0;
     for (k=1; k<=mesh->np; k++) {
@@ -50,7 +50,8 @@ int* _MMG2_packLS(MMG5_pMesh mesh,MMG5_pSol disp,LSst *lsst,int *npfin) {
   MMG5_pTria      pt,pt1;
   MMG5_pPoint     p0;
   double          u[2];
-  int             k,iel,jel,n,npf,nef,ip,nlay,refdirh,refdirnh,ilist,ilisto,ilistck;
+  int             iel,jel,n,npf,nef,ip,nlay,refdirh,refdirnh,ilist,ilisto,ilistck;
+  MMG5_int        k;
   int             vper[3],*perm,*list,*adja,*invperm;
   char            i,j,jedg;
   
@@ -300,7 +301,8 @@ int* _MMG2_packLS(MMG5_pMesh mesh,MMG5_pSol disp,LSst *lsst,int *npfin) {
 /** Transfer solution from the submesh to the global mesh */
 int _MMG2_unpackLS(MMG5_pMesh mesh,MMG5_pSol disp,LSst *lsst,int npf,int *invperm) {
   double      *u;
-  int         k,ip;
+  int         ip;
+  MMG5_int    k;
   char        i;
   
   u = LS_getSol(lsst);
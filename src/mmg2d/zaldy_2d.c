@@ -35,9 +35,9 @@
 
 
 /* Create a new vertex in the mesh, and return its number */
-int _MMG2D_newPt(MMG5_pMesh mesh,double c[2],int16_t tag) {
+MMG5_int _MMG2D_newPt(MMG5_pMesh mesh,double c[2],int16_t tag) {
   MMG5_pPoint  ppt;
-  int     curpt;
+  MMG5_int curpt;
 
   if ( !mesh->npnil )  return(0);
 
@@ -55,7 +55,7 @@ int _MMG2D_newPt(MMG5_pMesh mesh,double c[2],int16_t tag) {
 }
 
 /* Delete a point in the mesh and update the garbage collector accordingly */
-void _MMG2D_delPt(MMG5_pMesh mesh,int ip) {
+void _MMG2D_delPt(MMG5_pMesh mesh,MMG5_int ip) {
   MMG5_pPoint   ppt;
   MMG5_pxPoint  pxp;
 
@@ -74,8 +74,8 @@ void _MMG2D_delPt(MMG5_pMesh mesh,int ip) {
 }
 
 /* Create a new edge in the mesh and return its address */
-int _MMG5_newEdge(MMG5_pMesh mesh) {
-  int     curiel;
+MMG5_int _MMG5_newEdge(MMG5_pMesh mesh) {
+  MMG5_int curiel;
 
   if ( !mesh->nanil ) {
     return(0);
@@ -89,7 +89,7 @@ int _MMG5_newEdge(MMG5_pMesh mesh) {
 }
 
 
-void _MMG5_delEdge(MMG5_pMesh mesh,int iel) {
+void _MMG5_delEdge(MMG5_pMesh mesh,MMG5_int iel) {
   MMG5_pEdge    pt;
 
   pt = &mesh->edge[iel];
@@ -104,8 +104,8 @@ void _MMG5_delEdge(MMG5_pMesh mesh,int iel) {
 }
 
 /* Create a new triangle in the mesh and return its address */
-int _MMG2D_newElt(MMG5_pMesh mesh) {
-  int     curiel;
+MMG5_int _MMG2D_newElt(MMG5_pMesh mesh) {
+  MMG5_int curiel;
 
   if ( !mesh->nenil ) {
     return(0);
@@ -124,9 +124,9 @@ int _MMG2D_newElt(MMG5_pMesh mesh) {
 }
 
 /* Delete a triangle in the mesh and update the garbage collector accordingly */
-int _MMG2D_delElt(MMG5_pMesh mesh,int iel) {
+int _MMG2D_delElt(MMG5_pMesh mesh,MMG5_int iel) {
   MMG5_pTria    pt;
-  int      iadr;
+  MMG5_int iadr;
 
   pt = &mesh->tria[iel];
   if ( !MG_EOK(pt) ) {
@@ -138,7 +138,7 @@ int _MMG2D_delElt(MMG5_pMesh mesh,int iel) {
   pt->qual = 0.0;
   iadr = (iel-1)*3 + 1;
   if ( mesh->adja )
-    memset(&mesh->adja[iadr],0,3*sizeof(int));
+    memset(&mesh->adja[iadr],0,3*sizeof(MMG5_int));
 
   mesh->nenil = iel;
   if ( iel == mesh->nt )  mesh->nt--;
@@ -147,8 +147,8 @@ int _MMG2D_delElt(MMG5_pMesh mesh,int iel) {
 
 
 /* check if n elets available */
-int _MMG5_getnElt(MMG5_pMesh mesh,int n) {
-  int     curiel;
+MMG5_int _MMG5_getnElt(MMG5_pMesh mesh,int n) {
+  MMG5_int curiel;
 
   if ( !mesh->nenil )  return(0);
   curiel = mesh->nenil;
@@ -199,7 +199,7 @@ int _MMG2D_memOption(MMG5_pMesh mesh) {
     /* Euler-poincare: ne = 6*np; nt = 2*np; na = np/5 *
      * point+tria+edges+adjt+sol */
     bytes = sizeof(MMG5_Point) +  0.1*sizeof(MMG5_xPoint) +
-      2*sizeof(MMG5_Tria) + 3*2*sizeof(int)
+      2*sizeof(MMG5_Tria) + 3*2*sizeof(MMG5_int)
       + sizeof(MMG5_Sol) /*+ sizeof(Displ)*/
       + 0.2*sizeof(MMG5_Edge);
 
@@ -241,8 +241,8 @@ int _MMG2D_memOption(MMG5_pMesh mesh) {
   }
 
   if ( abs(mesh->info.imprim) > 5 || mesh->info.ddebug ) {
-    fprintf(stdout,"  _MMG2D_NPMAX    %d\n",mesh->npmax);
-    fprintf(stdout,"  _MMG2D_NTMAX    %d\n",mesh->ntmax);
+    fprintf(stdout,"  _MMG2D_NPMAX    %" MMG5_PRId "\n",mesh->npmax);
+    fprintf(stdout,"  _MMG2D_NTMAX    %" MMG5_PRId "\n",mesh->ntmax);
   }
 
   return 1;
@@ -250,7 +250,7 @@ int _MMG2D_memOption(MMG5_pMesh mesh) {
 
 /* allocate main structure */
 int MMG2D_zaldy(MMG5_pMesh mesh) {
-  int     k;
+  MMG5_int k;
 
   if ( !_MMG2D_memOption(mesh) )  return 0;
 
@@ -94,9 +94,9 @@ void MMG3D_Init_parameters(MMG5_pMesh mesh) {
   /* MMG3D_IPARAM_nosurf = 0 */
   mesh->info.nosurf   =  0;  /* [0/1]    ,avoid/allow surface modifications */
 #ifdef USE_SCOTCH
-  mesh->info.renum    = 1;   /* [1/0]    , Turn on/off the renumbering using SCOTCH; */
+  mesh->info.renum    = 1;   /* [2/1/0]  , Turn on/off the renumbering (1: SCOTCH, 2: Hilbert curve); */
 #else
-  mesh->info.renum    = 0;   /* [0]    , Turn on/off the renumbering using SCOTCH; */
+  mesh->info.renum    = 0;   /* [2/0]    , Turn on/off the renumbering (2: Hilbert curve); */
 #endif
 
   /* default values for doubles */
@@ -109,7 +109,7 @@ void MMG3D_Init_parameters(MMG5_pMesh mesh) {
 #endif
 }
 
-int MMG3D_Set_solSize(MMG5_pMesh mesh, MMG5_pSol sol, int typEntity, int np, int typSol) {
+int MMG3D_Set_solSize(MMG5_pMesh mesh, MMG5_pSol sol, int typEntity, MMG5_int np, int typSol) {
 
   if ( ( (mesh->info.imprim > 5) || mesh->info.ddebug ) && sol->m )
     fprintf(stderr,"\n  ## Warning: %s: old solution deletion.\n",__func__);
@@ -152,9 +152,9 @@ int MMG3D_Set_solSize(MMG5_pMesh mesh, MMG5_pSol sol, int typEntity, int np, int
   return(1);
 }
 
-int MMG3D_Set_meshSize(MMG5_pMesh mesh, int np, int ne, int nprism,
-                       int nt, int nquad, int na ) {
-  int k;
+int MMG3D_Set_meshSize(MMG5_pMesh mesh, MMG5_int np, MMG5_int ne, MMG5_int nprism,
+                       MMG5_int nt, MMG5_int nquad, MMG5_int na ) {
+  MMG5_int k;
 
   if ( ( (mesh->info.imprim > 5) || mesh->info.ddebug ) &&
        ( mesh->point || mesh->tria || mesh->tetra || mesh->edge) )
@@ -253,25 +253,25 @@ int MMG3D_Set_meshSize(MMG5_pMesh mesh, int np, int ne, int nprism,
 
   /* stats */
   if ( abs(mesh->info.imprim) > 6 ) {
-    fprintf(stdout,"     NUMBER OF VERTICES       %8d\n",mesh->np);
+    fprintf(stdout,"     NUMBER OF VERTICES       %8" MMG5_PRId "\n",mesh->np);
     if ( mesh->na ) {
-      fprintf(stdout,"     NUMBER OF EDGES          %8d\n",mesh->na);
+      fprintf(stdout,"     NUMBER OF EDGES          %8" MMG5_PRId "\n",mesh->na);
     }
     if ( mesh->nt )
-      fprintf(stdout,"     NUMBER OF TRIANGLES      %8d\n",mesh->nt);
+      fprintf(stdout,"     NUMBER OF TRIANGLES      %8" MMG5_PRId "\n",mesh->nt);
     if ( mesh->nquad )
-      fprintf(stdout,"     NUMBER OF QUADRILATERALS %8d\n",mesh->nquad);
+      fprintf(stdout,"     NUMBER OF QUADRILATERALS %8" MMG5_PRId "\n",mesh->nquad);
 
-    fprintf(stdout,"     NUMBER OF TETRAHEDRA     %8d\n",mesh->ne);
+    fprintf(stdout,"     NUMBER OF TETRAHEDRA     %8" MMG5_PRId "\n",mesh->ne);
 
     if ( mesh->nprism )
-      fprintf(stdout,"     NUMBER OF PRISMS         %8d\n",mesh->nprism);
+      fprintf(stdout,"     NUMBER OF PRISMS         %8" MMG5_PRId "\n",mesh->nprism);
   }
 
   return(1);
 }
 
-int MMG3D_Get_solSize(MMG5_pMesh mesh, MMG5_pSol sol, int* typEntity, int* np, int* typSol) {
+int MMG3D_Get_solSize(MMG5_pMesh mesh, MMG5_pSol sol, int* typEntity, MMG5_int* np, int* typSol) {
 
   if ( typEntity != NULL )
     *typEntity = MMG5_Vertex;
@@ -295,8 +295,8 @@ int MMG3D_Get_solSize(MMG5_pMesh mesh, MMG5_pSol sol, int* typEntity, int* np, i
   return(1);
 }
 
-int MMG3D_Get_meshSize(MMG5_pMesh mesh, int* np, int* ne, int* nprism,
-                       int* nt, int * nquad, int* na) {
+int MMG3D_Get_meshSize(MMG5_pMesh mesh, MMG5_int* np, MMG5_int* ne, MMG5_int* nprism,
+                       MMG5_int* nt, MMG5_int * nquad, MMG5_int* na) {
 
   if ( np != NULL )
     *np = mesh->np;
@@ -314,7 +314,7 @@ int MMG3D_Get_meshSize(MMG5_pMesh mesh, int* np, int* ne, int* nprism,
   return(1);
 }
 
-int MMG3D_Set_vertex(MMG5_pMesh mesh, double c0, double c1, double c2, int ref, int pos) {
+int MMG3D_Set_vertex(MMG5_pMesh mesh, double c0, double c1, double c2, int ref, MMG5_int pos) {
 
   if ( !mesh->np ) {
     fprintf(stderr,"\n  ## Error: %s: you must set the number of points with the",
@@ -325,15 +325,15 @@ int MMG3D_Set_vertex(MMG5_pMesh mesh, double c0, double c1, double c2, int ref,
 
   if ( pos > mesh->npmax ) {
     fprintf(stderr,"\n  ## Error: %s: unable to allocate a new point.\n",__func__);
-    fprintf(stderr,"    max number of points: %d\n",mesh->npmax);
+    fprintf(stderr,"    max number of points: %" MMG5_PRId "\n",mesh->npmax);
     _MMG5_INCREASE_MEM_MESSAGE();
     return(0);
   }
 
   if ( pos > mesh->np ) {
-    fprintf(stderr,"\n  ## Error: %s: attempt to set new vertex at position %d.",
+    fprintf(stderr,"\n  ## Error: %s: attempt to set new vertex at position %" MMG5_PRId ".",
             __func__,pos);
-    fprintf(stderr," Overflow of the given number of vertices: %d\n",mesh->np);
+    fprintf(stderr," Overflow of the given number of vertices: %" MMG5_PRId "\n",mesh->np);
     fprintf(stderr,"\n  ## Check the mesh size, its compactness or the position");
     fprintf(stderr," of the vertex.\n");
     return(0);
@@ -361,7 +361,7 @@ int MMG3D_Get_vertex(MMG5_pMesh mesh, double* c0, double* c1, double* c2, int* r
       fprintf(stderr,"     You must pass here exactly one time (the first time ");
       fprintf(stderr,"you call the MMG3D_Get_vertex function).\n");
       fprintf(stderr,"     If not, the number of call of this function");
-      fprintf(stderr," exceed the number of points: %d\n ",mesh->np);
+      fprintf(stderr," exceed the number of points: %" MMG5_PRId "\n ",mesh->np);
     }
   }
 
@@ -370,7 +370,7 @@ int MMG3D_Get_vertex(MMG5_pMesh mesh, double* c0, double* c1, double* c2, int* r
   if ( mesh->npi > mesh->np ) {
     fprintf(stderr,"\n  ## Error: %s: unable to get point.\n",__func__);
     fprintf(stderr,"     The number of call of MMG3D_Get_vertex function");
-    fprintf(stderr," can not exceed the number of points: %d\n ",mesh->np);
+    fprintf(stderr," can not exceed the number of points: %" MMG5_PRId "\n ",mesh->np);
     return(0);
   }
 
@@ -400,7 +400,7 @@ int MMG3D_Get_vertex(MMG5_pMesh mesh, double* c0, double* c1, double* c2, int* r
 int  MMG3D_Set_vertices(MMG5_pMesh mesh, double *vertices,int *refs) {
 
   MMG5_pPoint ppt;
-  int i,j;
+  MMG5_int i,j;
 
   /*coordinates vertices*/
   for (i=1;i<=mesh->np;i++)
@@ -424,10 +424,61 @@ int  MMG3D_Set_vertices(MMG5_pMesh mesh, double *vertices,int *refs) {
 }
 
 
+int  MMG3D_Adopt_vertices(MMG5_pMesh mesh, double *vertices,int *refs) {
+  MMG5_pPoint ppt;
+  double      c[3];
+  MMG5_int    k;
+
+  if ( !mesh->point ) {
+    fprintf(stderr,"\n  ## Error: %s: you must set the number of points with the",
+            __func__);
+    fprintf(stderr," MMG3D_Set_meshSize function before setting vertices in mesh.\n");
+    free(vertices);
+    return(0);
+  }
+
+  /* The vertices array becomes the array of the points */
+  _MMG5_DEL_MEM(mesh,mesh->point,(mesh->npmax+1)*sizeof(MMG5_Point));
+  _MMG5_ADD_MEM(mesh,(mesh->npmax+1)*sizeof(MMG5_Point),"initial vertices",
+                free(vertices);return 0);
+  mesh->point = (MMG5_pPoint)realloc(vertices,(mesh->npmax+1)*sizeof(MMG5_Point));
+  if ( !mesh->point ) {
+    perror("  ## Memory problem: realloc");
+    free(vertices);
+    mesh->memCur -= (long long)((mesh->npmax+1)*sizeof(MMG5_Point));
+    return(0);
+  }
+
+  /* Unpack the points from the last one: the packed coordinates of a point are
+   * stored before the place of its structure so they are read before being
+   * overwritten */
+  for ( k=mesh->np; k>=1; --k ) {
+    memcpy(c,(double*)mesh->point+3*(k-1),3*sizeof(double));
+    ppt = &mesh->point[k];
+    memset(ppt,0,sizeof(MMG5_Point));
+    ppt->c[0] = c[0];
+    ppt->c[1] = c[1];
+    ppt->c[2] = c[2];
+    ppt->tag  = MG_NUL;
+    if ( refs != NULL )
+      ppt->ref = refs[k-1];
+  }
+  memset(&mesh->point[0],0,sizeof(MMG5_Point));
+  memset(&mesh->point[mesh->np+1],0,(mesh->npmax-mesh->np)*sizeof(MMG5_Point));
+
+  /* keep track of empty links */
+  mesh->npnil = mesh->np + 1;
+  for (k=mesh->npnil; k<mesh->npmax-1; k++) {
+    mesh->point[k].tmp  = k+1;
+  }
+
+  return 1;
+}
+
 int  MMG3D_Get_vertices(MMG5_pMesh mesh, double* vertices, int* refs,
                         int* areCorners, int* areRequired) {
   MMG5_pPoint ppt;
-  int i,j;
+  MMG5_int i,j;
 
   for (i=1;i<=mesh->np;i++)
   {
@@ -460,11 +511,49 @@ int  MMG3D_Get_vertices(MMG5_pMesh mesh, double* vertices, int* refs,
   return 1;
 }
 
-int MMG3D_Set_tetrahedron(MMG5_pMesh mesh, int v0, int v1, int v2, int v3, int ref, int pos) {
+int  MMG3D_Release_vertices(MMG5_pMesh mesh, double **vertices, int *refs,
+                            int *areCorners, int *areRequired) {
+  MMG5_pPoint ppt;
+  double      c[3],*ptr;
+  MMG5_int    k;
+
+  if ( !mesh->point || !mesh->np ) {
+    fprintf(stderr,"\n  ## Error: %s: no vertices to release.\n",__func__);
+    return(0);
+  }
+
+  /* Pack the coordinates at the beginning of the array: the packed coordinates
+   * of a point are stored before the place of its structure, that is already
+   * read */
+  ptr = (double*)mesh->point;
+  for ( k=1; k<=mesh->np; k++ ) {
+    ppt = &mesh->point[k];
+    memcpy(c,ppt->c,3*sizeof(double));
+    if ( refs != NULL )
+      refs[k-1] = ppt->ref;
+    if ( areCorners != NULL )
+      areCorners[k-1] = ( ppt->tag & MG_CRN ) ? 1 : 0;
+    if ( areRequired != NULL )
+      areRequired[k-1] = ( ppt->tag & MG_REQ ) ? 1 : 0;
+    memcpy(ptr+3*(k-1),c,3*sizeof(double));
+  }
+
+  mesh->memCur -= (long long)((mesh->npmax+1)*sizeof(MMG5_Point));
+  *vertices = (double*)realloc(ptr,3*mesh->np*sizeof(double));
+  /* the shrinking failed: return the whole block */
+  if ( !*vertices ) *vertices = ptr;
+  mesh->point = NULL;
+  mesh->npmax = 0;
+
+  return 1;
+}
+
+int MMG3D_Set_tetrahedron(MMG5_pMesh mesh, MMG5_int v0, MMG5_int v1, MMG5_int v2, MMG5_int v3, int ref, MMG5_int pos) {
   MMG5_pTetra pt;
   MMG5_pPoint ppt;
   double vol;
-  int    aux,j, ip;
+  int    j, ip;
+  MMG5_int aux;
 
   if ( !mesh->ne ) {
     fprintf(stderr,"\n  ## Error: %s: You must set the number of elements with the",
@@ -476,15 +565,15 @@ int MMG3D_Set_tetrahedron(MMG5_pMesh mesh, int v0, int v1, int v2, int v3, int r
   if ( pos > mesh->nemax ) {
     fprintf(stderr,"\n  ## Error: %s: unable to allocate a new element.\n",
       __func__);
-    fprintf(stderr,"    max number of element: %d\n",mesh->nemax);
+    fprintf(stderr,"    max number of element: %" MMG5_PRId "\n",mesh->nemax);
     _MMG5_INCREASE_MEM_MESSAGE();
     return(0);
   }
 
   if ( pos > mesh->ne ) {
-    fprintf(stderr,"\n  ## Error: %s: attempt to set new tetrahedron at position %d.",
+    fprintf(stderr,"\n  ## Error: %s: attempt to set new tetrahedron at position %" MMG5_PRId ".",
             __func__,pos);
-    fprintf(stderr," Overflow of the given number of tetrahedron: %d\n",mesh->ne);
+    fprintf(stderr," Overflow of the given number of tetrahedron: %" MMG5_PRId "\n",mesh->ne);
     fprintf(stderr,"\n  ## Check the mesh size, its compactness or the position");
     fprintf(stderr," of the tetrahedron.\n");
     return(0);
@@ -504,7 +593,7 @@ int MMG3D_Set_tetrahedron(MMG5_pMesh mesh, int v0, int v1, int v2, int v3, int r
 
   vol = _MMG5_orvol(mesh->point,pt->v);
   if ( fabs(vol) <= _MMG5_EPSD2 ) {
-    fprintf(stderr,"\n  ## Error: %s: tetrahedron %d has volume null.\n",
+    fprintf(stderr,"\n  ## Error: %s: tetrahedron %" MMG5_PRId " has volume null.\n",
             __func__,pos);
     for ( ip=0; ip<4; ip++ ) {
       ppt = &mesh->point[pt->v[ip]];
@@ -531,7 +620,7 @@ int MMG3D_Set_tetrahedron(MMG5_pMesh mesh, int v0, int v1, int v2, int v3, int r
   return(1);
 }
 
-int MMG3D_Get_tetrahedron(MMG5_pMesh mesh, int* v0, int* v1, int* v2, int* v3,
+int MMG3D_Get_tetrahedron(MMG5_pMesh mesh, MMG5_int* v0, MMG5_int* v1, MMG5_int* v2, MMG5_int* v3,
                           int* ref, int* isRequired) {
 
   if ( mesh->nei == mesh->ne ) {
@@ -542,7 +631,7 @@ int MMG3D_Get_tetrahedron(MMG5_pMesh mesh, int* v0, int* v1, int* v2, int* v3,
       fprintf(stderr,"     You must pass here exactly one time (the first time ");
       fprintf(stderr,"you call the MMG3D_Get_tetrahedron function).\n");
       fprintf(stderr,"     If not, the number of call of this function");
-      fprintf(stderr," exceed the number of tetrahedron: %d\n ",mesh->ne);
+      fprintf(stderr," exceed the number of tetrahedron: %" MMG5_PRId "\n ",mesh->ne);
     }
   }
 
@@ -551,7 +640,7 @@ int MMG3D_Get_tetrahedron(MMG5_pMesh mesh, int* v0, int* v1, int* v2, int* v3,
   if ( mesh->nei > mesh->ne ) {
     fprintf(stderr,"\n  ## Error: %s: unable to get tetra.\n",__func__);
     fprintf(stderr,"    The number of call of MMG3D_Get_tetrahedron function");
-    fprintf(stderr," can not exceed the number of tetra: %d\n ",mesh->ne);
+    fprintf(stderr," can not exceed the number of tetra: %" MMG5_PRId "\n ",mesh->ne);
     return(0);
   }
 
@@ -573,11 +662,64 @@ int MMG3D_Get_tetrahedron(MMG5_pMesh mesh, int* v0, int* v1, int* v2, int* v3,
   return(1);
 }
 
-int  MMG3D_Set_tetrahedra(MMG5_pMesh mesh, int *tetra, int *refs) {
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param k index of the tetrahedron.
+ * \return 0 if the tetrahedron has a null volume, 1 otherwise.
+ *
+ * Mark the vertices of the tetrahedron \a k as used and reorient it if it has
+ * a negative volume (the reoriented tetra are counted in \a mesh->xp).
+ *
+ */
+static inline
+int _MMG3D_orientTetra(MMG5_pMesh mesh,MMG5_int k) {
   MMG5_pPoint ppt;
   MMG5_pTetra pt;
-  double     vol;
-  int        i,ip,aux, j;
+  double      vol;
+  int         ip,j;
+  MMG5_int    aux;
+
+  pt = &mesh->tetra[k];
+
+  mesh->point[pt->v[0]].tag &= ~MG_NUL;
+  mesh->point[pt->v[1]].tag &= ~MG_NUL;
+  mesh->point[pt->v[2]].tag &= ~MG_NUL;
+  mesh->point[pt->v[3]].tag &= ~MG_NUL;
+
+  vol = _MMG5_orvol(mesh->point,pt->v);
+
+  if ( vol <= _MMG5_EPSD2 ) {
+    fprintf(stderr,"\n  ## Error: %s: tetrahedron %" MMG5_PRId " has volume null.\n",
+            __func__,k);
+
+    for ( ip=0; ip<4; ip++ ) {
+      ppt = &mesh->point[pt->v[ip]];
+      for ( j=0; j<3; j++ ) {
+        if ( fabs(ppt->c[j])>0. ) {
+          fprintf(stderr," Check that you don't have a sliver tetrahedron.\n");
+          return(0);
+        }
+      }
+    }
+
+    fprintf(stderr,"  All vertices have zero coordinates.");
+    fprintf(stderr," Check that you have set the vertices before the tetrahedra.\n");
+    return(0);
+  }
+  else if ( vol < 0.0 ) {
+    /* Possibly switch 2 vertices number so that each tet is positively oriented */
+    aux = pt->v[2];
+    pt->v[2] = pt->v[3];
+    pt->v[3] = aux;
+
+    ++mesh->xp;
+  }
+  return(1);
+}
+
+int  MMG3D_Set_tetrahedra(MMG5_pMesh mesh, MMG5_int *tetra, int *refs) {
+  MMG5_pTetra pt;
+  MMG5_int    i,j;
 
   mesh->xp = 0;
   for (i=1;i<=mesh->ne;i++)
@@ -592,47 +734,67 @@ int  MMG3D_Set_tetrahedra(MMG5_pMesh mesh, int *tetra, int *refs) {
     if ( refs != NULL )
       pt->ref   = abs(refs[i-1]);
 
-    mesh->point[pt->v[0]].tag &= ~MG_NUL;
-    mesh->point[pt->v[1]].tag &= ~MG_NUL;
-    mesh->point[pt->v[2]].tag &= ~MG_NUL;
-    mesh->point[pt->v[3]].tag &= ~MG_NUL;
+    if ( !_MMG3D_orientTetra(mesh,i) ) return(0);
+  }
 
-    vol = _MMG5_orvol(mesh->point,pt->v);
+  return 1;
+}
 
-    if ( vol <= _MMG5_EPSD2 ) {
-      fprintf(stderr,"\n  ## Error: %s: tetrahedron %d has volume null.\n",
-              __func__,i);
+int  MMG3D_Adopt_tetrahedra(MMG5_pMesh mesh, MMG5_int *tetra, int *refs) {
+  MMG5_pTetra pt;
+  MMG5_int    v[4],k;
 
-      for ( ip=0; ip<4; ip++ ) {
-        ppt = &mesh->point[pt->v[ip]];
-        for ( j=0; j<3; j++ ) {
-          if ( fabs(ppt->c[j])>0. ) {
-            fprintf(stderr," Check that you don't have a sliver tetrahedron.\n");
-            return(0);
-          }
-        }
-      }
+  if ( !mesh->tetra ) {
+    fprintf(stderr,"\n  ## Error: %s: You must set the number of elements with the",
+      __func__);
+    fprintf(stderr," MMG3D_Set_meshSize function before setting elements in mesh\n");
+    free(tetra);
+    return(0);
+  }
 
-      fprintf(stderr,"  All vertices have zero coordinates.");
-      fprintf(stderr," Check that you have set the vertices before the tetrahedra.\n");
-      return(0);
-    }
-    else if ( vol < 0.0 ) {
-      /* Possibly switch 2 vertices number so that each tet is positively oriented */
-      aux = pt->v[2];
-      pt->v[2] = pt->v[3];
-      pt->v[3] = aux;
+  /* The tetra array becomes the array of the tetrahedra */
+  _MMG5_DEL_MEM(mesh,mesh->tetra,(mesh->nemax+1)*sizeof(MMG5_Tetra));
+  _MMG5_ADD_MEM(mesh,(mesh->nemax+1)*sizeof(MMG5_Tetra),"initial tetrahedra",
+                free(tetra);return 0);
+  mesh->tetra = (MMG5_pTetra)realloc(tetra,(mesh->nemax+1)*sizeof(MMG5_Tetra));
+  if ( !mesh->tetra ) {
+    perror("  ## Memory problem: realloc");
+    free(tetra);
+    mesh->memCur -= (long long)((mesh->nemax+1)*sizeof(MMG5_Tetra));
+    return(0);
+  }
 
-      ++mesh->xp;
-    }
+  /* Unpack the tetra from the last one: the packed vertices of a tetra are
+   * stored before the place of its structure so they are read before being
+   * overwritten */
+  for ( k=mesh->ne; k>=1; --k ) {
+    memcpy(v,(MMG5_int*)mesh->tetra+4*(k-1),4*sizeof(MMG5_int));
+    pt = &mesh->tetra[k];
+    memset(pt,0,sizeof(MMG5_Tetra));
+    memcpy(pt->v,v,4*sizeof(MMG5_int));
+    if ( refs != NULL )
+      pt->ref = abs(refs[k-1]);
+  }
+  memset(&mesh->tetra[0],0,sizeof(MMG5_Tetra));
+  memset(&mesh->tetra[mesh->ne+1],0,(mesh->nemax-mesh->ne)*sizeof(MMG5_Tetra));
+
+  /* keep track of empty links */
+  mesh->nenil = mesh->ne + 1;
+  for (k=mesh->nenil; k<mesh->nemax-1; k++) {
+    mesh->tetra[k].v[3] = k+1;
+  }
+
+  mesh->xp = 0;
+  for ( k=1; k<=mesh->ne; k++ ) {
+    if ( !_MMG3D_orientTetra(mesh,k) ) return(0);
   }
 
   return 1;
 }
 
-int  MMG3D_Get_tetrahedra(MMG5_pMesh mesh, int *tetra, int *refs, int * areRequired) {
+int  MMG3D_Get_tetrahedra(MMG5_pMesh mesh, MMG5_int *tetra, int *refs, int * areRequired) {
   MMG5_pTetra pt;
-  int         i, j;
+  MMG5_int    i,j;
 
   for (i=1;i<=mesh->ne;i++)
   {
@@ -654,8 +816,41 @@ int  MMG3D_Get_tetrahedra(MMG5_pMesh mesh, int *tetra, int *refs, int * areRequi
   return 1;
 }
 
-int MMG3D_Set_prism(MMG5_pMesh mesh, int v0, int v1, int v2,
-                    int v3, int v4, int v5, int ref, int pos) {
+int  MMG3D_Release_tetrahedra(MMG5_pMesh mesh, MMG5_int **tetra, int *refs,
+                              int *areRequired) {
+  MMG5_pTetra pt;
+  MMG5_int    v[4],*ptr,k;
+
+  if ( !mesh->tetra || !mesh->ne ) {
+    fprintf(stderr,"\n  ## Error: %s: no tetrahedra to release.\n",__func__);
+    return(0);
+  }
+
+  /* Pack the vertices at the beginning of the array: the packed vertices of a
+   * tetra are stored before the place of its structure, that is already read */
+  ptr = (MMG5_int*)mesh->tetra;
+  for ( k=1; k<=mesh->ne; k++ ) {
+    pt = &mesh->tetra[k];
+    memcpy(v,pt->v,4*sizeof(MMG5_int));
+    if ( refs != NULL )
+      refs[k-1] = pt->ref;
+    if ( areRequired != NULL )
+      areRequired[k-1] = ( pt->tag & MG_REQ ) ? 1 : 0;
+    memcpy(ptr+4*(k-1),v,4*sizeof(MMG5_int));
+  }
+
+  mesh->memCur -= (long long)((mesh->nemax+1)*sizeof(MMG5_Tetra));
+  *tetra = (MMG5_int*)realloc(ptr,4*mesh->ne*sizeof(MMG5_int));
+  /* the shrinking failed: return the whole block */
+  if ( !*tetra ) *tetra = ptr;
+  mesh->tetra = NULL;
+  mesh->nemax = 0;
+
+  return 1;
+}
+
+int MMG3D_Set_prism(MMG5_pMesh mesh, MMG5_int v0, MMG5_int v1, MMG5_int v2,
+                    MMG5_int v3, MMG5_int v4, MMG5_int v5, int ref, MMG5_int pos) {
   MMG5_pPrism pp;
 
   if ( !mesh->nprism ) {
@@ -666,9 +861,9 @@ int MMG3D_Set_prism(MMG5_pMesh mesh, int v0, int v1, int v2,
   }
 
   if ( pos > mesh->nprism ) {
-    fprintf(stderr,"\n  ## Error: %s: attempt to set new prism at position %d.",
+    fprintf(stderr,"\n  ## Error: %s: attempt to set new prism at position %" MMG5_PRId ".",
             __func__,pos);
-    fprintf(stderr," Overflow of the given number of prism: %d\n",mesh->nprism);
+    fprintf(stderr," Overflow of the given number of prism: %" MMG5_PRId "\n",mesh->nprism);
     fprintf(stderr,"\n  ## Check the mesh size, its compactness or the position");
     fprintf(stderr," of the prism.\n");
     return(0);
@@ -694,44 +889,43 @@ int MMG3D_Set_prism(MMG5_pMesh mesh, int v0, int v1, int v2,
   return(1);
 }
 
-int MMG3D_Get_prism(MMG5_pMesh mesh, int* v0, int* v1, int* v2, int* v3,
-                    int* v4, int* v5, int* ref, int* isRequired) {
-  static int npri = 0;
+int MMG3D_Get_prism(MMG5_pMesh mesh, MMG5_int* v0, MMG5_int* v1, MMG5_int* v2, MMG5_int* v3,
+                    MMG5_int* v4, MMG5_int* v5, int* ref, int* isRequired) {
 
-  if ( npri == mesh->nprism ) {
-    npri = 0;
+  if ( mesh->npri == mesh->nprism ) {
+    mesh->npri = 0;
     if ( mesh->info.ddebug ) {
       fprintf(stderr,"\n  ## Warning: %s: reset the internal counter of prisms.\n",
               __func__);
       fprintf(stderr,"     You must pass here exactly one time (the first time ");
       fprintf(stderr,"you call the MMG3D_Get_prism function).\n");
       fprintf(stderr,"     If not, the number of call of this function");
-      fprintf(stderr," exceed the number of prisms: %d\n ",mesh->nprism);
+      fprintf(stderr," exceed the number of prisms: %" MMG5_PRId "\n ",mesh->nprism);
     }
   }
 
-  ++npri;
+  ++mesh->npri;
 
-  if ( npri > mesh->nprism ) {
+  if ( mesh->npri > mesh->nprism ) {
     fprintf(stderr,"\n  ## Error: %s: unable to get prism.\n",__func__);
     fprintf(stderr,"    The number of call of MMG3D_Get_prism function");
-    fprintf(stderr," can not exceed the number of prism: %d\n ",mesh->nprism);
+    fprintf(stderr," can not exceed the number of prism: %" MMG5_PRId "\n ",mesh->nprism);
     return(0);
   }
 
-  *v0  = mesh->prism[npri].v[0];
-  *v1  = mesh->prism[npri].v[1];
-  *v2  = mesh->prism[npri].v[2];
-  *v3  = mesh->prism[npri].v[3];
-  *v4  = mesh->prism[npri].v[4];
-  *v5  = mesh->prism[npri].v[5];
+  *v0  = mesh->prism[mesh->npri].v[0];
+  *v1  = mesh->prism[mesh->npri].v[1];
+  *v2  = mesh->prism[mesh->npri].v[2];
+  *v3  = mesh->prism[mesh->npri].v[3];
+  *v4  = mesh->prism[mesh->npri].v[4];
+  *v5  = mesh->prism[mesh->npri].v[5];
 
   if ( ref != NULL ) {
-    *ref = mesh->prism[npri].ref;
+    *ref = mesh->prism[mesh->npri].ref;
   }
 
   if ( isRequired != NULL ) {
-    if ( mesh->prism[npri].tag & MG_REQ )
+    if ( mesh->prism[mesh->npri].tag & MG_REQ )
       *isRequired = 1;
     else
       *isRequired = 0;
@@ -740,9 +934,9 @@ int MMG3D_Get_prism(MMG5_pMesh mesh, int* v0, int* v1, int* v2, int* v3,
   return(1);
 }
 
-int  MMG3D_Set_prisms(MMG5_pMesh mesh, int *prisms, int *refs) {
+int  MMG3D_Set_prisms(MMG5_pMesh mesh, MMG5_int *prisms, int *refs) {
   MMG5_pPrism pp;
-  int         i,j;
+  MMG5_int    i,j;
 
   for (i=1;i<=mesh->nprism;i++)
   {
@@ -770,9 +964,9 @@ int  MMG3D_Set_prisms(MMG5_pMesh mesh, int *prisms, int *refs) {
   return 1;
 }
 
-int  MMG3D_Get_prisms(MMG5_pMesh mesh, int *prisms, int *refs, int * areRequired) {
+int  MMG3D_Get_prisms(MMG5_pMesh mesh, MMG5_int *prisms, int *refs, int * areRequired) {
   MMG5_pPrism pp;
-  int         i, j;
+  MMG5_int    i,j;
 
   for (i=1;i<=mesh->nprism;i++)
   {
@@ -799,7 +993,7 @@ int  MMG3D_Get_prisms(MMG5_pMesh mesh, int *prisms, int *refs, int * areRequired
 
 
 
-int MMG3D_Set_triangle(MMG5_pMesh mesh, int v0, int v1, int v2, int ref,int pos) {
+int MMG3D_Set_triangle(MMG5_pMesh mesh, MMG5_int v0, MMG5_int v1, MMG5_int v2, int ref,MMG5_int pos) {
 
   if ( !mesh->nt ) {
     fprintf(stderr,"\n  ## Error: %s: You must set the number of triangles"
@@ -811,15 +1005,15 @@ int MMG3D_Set_triangle(MMG5_pMesh mesh, int v0, int v1, int v2, int ref,int pos)
   if ( pos > mesh->ntmax ) {
     fprintf(stderr,"\n  ## Error: %s: unable to allocate a new triangle.\n",
             __func__);
-    fprintf(stderr,"    max number of triangle: %d\n",mesh->ntmax);
+    fprintf(stderr,"    max number of triangle: %" MMG5_PRId "\n",mesh->ntmax);
     _MMG5_INCREASE_MEM_MESSAGE();
     return(0);
   }
 
   if ( pos > mesh->nt ) {
     fprintf(stderr,"\n  ## Error: %s: attempt to set new triangle at"
-            " position %d.",__func__,pos);
-    fprintf(stderr," Overflow of the given number of triangles: %d\n",mesh->nt);
+            " position %" MMG5_PRId ".",__func__,pos);
+    fprintf(stderr," Overflow of the given number of triangles: %" MMG5_PRId "\n",mesh->nt);
     fprintf(stderr,"\n  ## Check the mesh size, its compactness or the position");
     fprintf(stderr," of the triangle.\n");
     return(0);
@@ -833,7 +1027,7 @@ int MMG3D_Set_triangle(MMG5_pMesh mesh, int v0, int v1, int v2, int ref,int pos)
   return(1);
 }
 
-int MMG3D_Get_triangle(MMG5_pMesh mesh, int* v0, int* v1, int* v2, int* ref
+int MMG3D_Get_triangle(MMG5_pMesh mesh, MMG5_int* v0, MMG5_int* v1, MMG5_int* v2, int* ref
                        ,int* isRequired) {
   MMG5_pTria  ptt;
 
@@ -845,7 +1039,7 @@ int MMG3D_Get_triangle(MMG5_pMesh mesh, int* v0, int* v1, int* v2, int* ref
       fprintf(stderr,"     You must pass here exactly one time (the first time ");
       fprintf(stderr,"you call the MMG3D_Get_triangle function).\n");
       fprintf(stderr,"     If not, the number of call of this function");
-      fprintf(stderr," exceed the number of triangles: %d\n ",mesh->nt);
+      fprintf(stderr," exceed the number of triangles: %" MMG5_PRId "\n ",mesh->nt);
     }
   }
 
@@ -854,7 +1048,7 @@ int MMG3D_Get_triangle(MMG5_pMesh mesh, int* v0, int* v1, int* v2, int* ref
   if ( mesh->nti > mesh->nt ) {
     fprintf(stderr,"\n  ## Error: %s: unable to get triangle.\n",__func__);
     fprintf(stderr,"    The number of call of MMG3D_Get_triangle function");
-    fprintf(stderr," can not exceed the number of triangles: %d\n ",mesh->nt);
+    fprintf(stderr," can not exceed the number of triangles: %" MMG5_PRId "\n ",mesh->nt);
     return(0);
   }
 
@@ -876,9 +1070,9 @@ int MMG3D_Get_triangle(MMG5_pMesh mesh, int* v0, int* v1, int* v2, int* ref
   return(1);
 }
 
-int  MMG3D_Set_triangles(MMG5_pMesh mesh, int *tria, int *refs) {
+int  MMG3D_Set_triangles(MMG5_pMesh mesh, MMG5_int *tria, int *refs) {
   MMG5_pTria ptt;
-  int         i, j;
+  MMG5_int    i,j;
 
   for (i=1;i<=mesh->nt;i++)
   {
@@ -893,9 +1087,9 @@ int  MMG3D_Set_triangles(MMG5_pMesh mesh, int *tria, int *refs) {
   return 1;
 }
 
-int  MMG3D_Get_triangles(MMG5_pMesh mesh, int *tria, int *refs, int *areRequired) {
+int  MMG3D_Get_triangles(MMG5_pMesh mesh, MMG5_int *tria, int *refs, int *areRequired) {
   MMG5_pTria ptt;
-  int         i, j;
+  MMG5_int    i,j;
 
   for (i=1;i<=mesh->nt;i++)
   {
@@ -918,8 +1112,8 @@ int  MMG3D_Get_triangles(MMG5_pMesh mesh, int *tria, int *refs, int *areRequired
   return 1;
 }
 
-int MMG3D_Set_quadrilateral(MMG5_pMesh mesh, int v0, int v1, int v2, int v3,
-                         int ref,int pos) {
+int MMG3D_Set_quadrilateral(MMG5_pMesh mesh, MMG5_int v0, MMG5_int v1, MMG5_int v2, MMG5_int v3,
+                         int ref,MMG5_int pos) {
 
   if ( !mesh->nquad ) {
     fprintf(stderr,"\n  ## Error: %s: You must set the number of quadrilaterals"
@@ -930,8 +1124,8 @@ int MMG3D_Set_quadrilateral(MMG5_pMesh mesh, int v0, int v1, int v2, int v3,
 
   if ( pos > mesh->nquad ) {
     fprintf(stderr,"\n  ## Error: %s: attempt to set new quadrilateral"
-            " at position %d.",__func__,pos);
-    fprintf(stderr," Overflow of the given number of quadrilaterals: %d\n",mesh->nquad);
+            " at position %" MMG5_PRId ".",__func__,pos);
+    fprintf(stderr," Overflow of the given number of quadrilaterals: %" MMG5_PRId "\n",mesh->nquad);
     fprintf(stderr,"\n  ## Check the mesh size, its compactness or the position");
     fprintf(stderr," of the quadrilateral.\n");
     return(0);
@@ -946,33 +1140,32 @@ int MMG3D_Set_quadrilateral(MMG5_pMesh mesh, int v0, int v1, int v2, int v3,
   return(1);
 }
 
-int MMG3D_Get_quadrilateral(MMG5_pMesh mesh, int* v0, int* v1, int* v2, int* v3,
+int MMG3D_Get_quadrilateral(MMG5_pMesh mesh, MMG5_int* v0, MMG5_int* v1, MMG5_int* v2, MMG5_int* v3,
                        int* ref,int* isRequired) {
   MMG5_pQuad  pq;
-  static int nqi = 0;
 
-  if ( nqi == mesh->nquad ) {
-    nqi = 0;
+  if ( mesh->nqi == mesh->nquad ) {
+    mesh->nqi = 0;
     if ( mesh->info.ddebug ) {
       fprintf(stderr,"\n  ## Warning: %s: reset the internal counter"
               " of quadrilaterals.\n",__func__);
       fprintf(stderr,"     You must pass here exactly one time (the first time ");
       fprintf(stderr,"you call the MMG3D_Get_quadrilateral function).\n");
       fprintf(stderr,"     If not, the number of call of this function");
-      fprintf(stderr," exceed the number of quadrilaterals: %d\n ",mesh->nquad);
+      fprintf(stderr," exceed the number of quadrilaterals: %" MMG5_PRId "\n ",mesh->nquad);
     }
   }
 
-  nqi++;
+  mesh->nqi++;
 
-  if ( nqi > mesh->nquad ) {
+  if ( mesh->nqi > mesh->nquad ) {
     fprintf(stderr,"\n  ## Error: %s: unable to get quadrilateral.\n",__func__);
     fprintf(stderr,"    The number of call of MMG3D_Get_quadrilateral function");
-    fprintf(stderr," can not exceed the number of quadrilaterals: %d\n ",mesh->nquad);
+    fprintf(stderr," can not exceed the number of quadrilaterals: %" MMG5_PRId "\n ",mesh->nquad);
     return(0);
   }
 
-  pq = &mesh->quadra[nqi];
+  pq = &mesh->quadra[mesh->nqi];
   *v0  = pq->v[0];
   *v1  = pq->v[1];
   *v2  = pq->v[2];
@@ -991,9 +1184,9 @@ int MMG3D_Get_quadrilateral(MMG5_pMesh mesh, int* v0, int* v1, int* v2, int* v3,
   return(1);
 }
 
-int  MMG3D_Set_quadrilaterals(MMG5_pMesh mesh, int *quads, int *refs) {
+int  MMG3D_Set_quadrilaterals(MMG5_pMesh mesh, MMG5_int *quads, int *refs) {
   MMG5_pQuad  pq;
-  int         i, j;
+  MMG5_int    i,j;
 
   for (i=1;i<=mesh->nquad;i++)
   {
@@ -1009,9 +1202,9 @@ int  MMG3D_Set_quadrilaterals(MMG5_pMesh mesh, int *quads, int *refs) {
   return 1;
 }
 
-int  MMG3D_Get_quadrilaterals(MMG5_pMesh mesh, int *quads, int *refs, int *areRequired) {
+int  MMG3D_Get_quadrilaterals(MMG5_pMesh mesh, MMG5_int *quads, int *refs, int *areRequired) {
   MMG5_pQuad  pq;
-  int         i, j;
+  MMG5_int    i,j;
 
   for (i=1;i<=mesh->nquad;i++)
   {
@@ -1035,7 +1228,7 @@ int  MMG3D_Get_quadrilaterals(MMG5_pMesh mesh, int *quads, int *refs, int *areRe
   return 1;
 }
 
-int MMG3D_Set_edge(MMG5_pMesh mesh, int v0, int v1, int ref, int pos) {
+int MMG3D_Set_edge(MMG5_pMesh mesh, MMG5_int v0, MMG5_int v1, int ref, MMG5_int pos) {
 
   if ( !mesh->na ) {
     fprintf(stderr,"\n  ## Error: %s: You must set the number of edges with"
@@ -1046,14 +1239,14 @@ int MMG3D_Set_edge(MMG5_pMesh mesh, int v0, int v1, int ref, int pos) {
   if ( pos > mesh->namax ) {
     fprintf(stderr,"\n  ## Error: %s: unable to allocate a new edge.\n",
       __func__);
-    fprintf(stderr,"    max number of edge: %d\n",mesh->namax);
+    fprintf(stderr,"    max number of edge: %" MMG5_PRId "\n",mesh->namax);
     _MMG5_INCREASE_MEM_MESSAGE();
     return(0);
   }
   if ( pos > mesh->na ) {
-    fprintf(stderr,"\n  ## Error: %s: attempt to set new edge at position %d.",
+    fprintf(stderr,"\n  ## Error: %s: attempt to set new edge at position %" MMG5_PRId ".",
             __func__,pos);
-    fprintf(stderr," Overflow of the given number of edges: %d\n",mesh->na);
+    fprintf(stderr," Overflow of the given number of edges: %" MMG5_PRId "\n",mesh->na);
     fprintf(stderr,"\n  ## Check the mesh size, its compactness or the position");
     fprintf(stderr," of the edge.\n");
     return(0);
@@ -1067,7 +1260,7 @@ int MMG3D_Set_edge(MMG5_pMesh mesh, int v0, int v1, int ref, int pos) {
   return(1);
 }
 
-int MMG3D_Get_edge(MMG5_pMesh mesh, int* e0, int* e1, int* ref
+int MMG3D_Get_edge(MMG5_pMesh mesh, MMG5_int* e0, MMG5_int* e1, int* ref
                    ,int* isRidge, int* isRequired) {
 
   if ( mesh->nai == mesh->na ) {
@@ -1078,7 +1271,7 @@ int MMG3D_Get_edge(MMG5_pMesh mesh, int* e0, int* e1, int* ref
       fprintf(stderr,"     You must pass here exactly one time (the first time ");
       fprintf(stderr,"you call the MMG3D_Get_edge function).\n");
       fprintf(stderr,"     If not, the number of call of this function");
-      fprintf(stderr," exceed the number of edges: %d\n ",mesh->na);
+      fprintf(stderr," exceed the number of edges: %" MMG5_PRId "\n ",mesh->na);
     }
   }
 
@@ -1087,7 +1280,7 @@ int MMG3D_Get_edge(MMG5_pMesh mesh, int* e0, int* e1, int* ref
   if ( mesh->nai > mesh->na ) {
     fprintf(stderr,"\n  ## Error: %s: unable to get edge.\n",__func__);
     fprintf(stderr,"    The number of call of MMG3D_Get_edge function");
-    fprintf(stderr," can not exceed the number of edges: %d\n ",mesh->na);
+    fprintf(stderr," can not exceed the number of edges: %" MMG5_PRId "\n ",mesh->na);
     return(0);
   }
 
@@ -1113,25 +1306,25 @@ int MMG3D_Get_edge(MMG5_pMesh mesh, int* e0, int* e1, int* ref
   return(1);
 }
 
-int MMG3D_Set_corner(MMG5_pMesh mesh, int k) {
+int MMG3D_Set_corner(MMG5_pMesh mesh, MMG5_int k) {
   assert ( k <= mesh->np );
   mesh->point[k].tag |= MG_CRN;
   return(1);
 }
 
-int MMG3D_Set_requiredVertex(MMG5_pMesh mesh, int k) {
+int MMG3D_Set_requiredVertex(MMG5_pMesh mesh, MMG5_int k) {
   assert ( k <= mesh->np );
   mesh->point[k].tag |= MG_REQ;
   return(1);
 }
 
-int MMG3D_Set_requiredTetrahedron(MMG5_pMesh mesh, int k) {
+int MMG3D_Set_requiredTetrahedron(MMG5_pMesh mesh, MMG5_int k) {
   assert ( k <= mesh->ne );
   mesh->tetra[k].tag |= MG_REQ;
   return(1);
 }
 
-int MMG3D_Set_requiredTetrahedra(MMG5_pMesh mesh, int *reqIdx, int nreq) {
+int MMG3D_Set_requiredTetrahedra(MMG5_pMesh mesh, MMG5_int *reqIdx, MMG5_int nreq) {
   int k;
 
   for ( k=0; k<nreq; ++k ){
@@ -1141,7 +1334,7 @@ int MMG3D_Set_requiredTetrahedra(MMG5_pMesh mesh, int *reqIdx, int nreq) {
   return(1);
 }
 
-int MMG3D_Set_requiredTriangle(MMG5_pMesh mesh, int k) {
+int MMG3D_Set_requiredTriangle(MMG5_pMesh mesh, MMG5_int k) {
   assert ( k <= mesh->nt );
   mesh->tria[k].tag[0] |= MG_REQ;
   mesh->tria[k].tag[1] |= MG_REQ;
@@ -1149,7 +1342,7 @@ int MMG3D_Set_requiredTriangle(MMG5_pMesh mesh, int k) {
   return(1);
 }
 
-int MMG3D_Set_requiredTriangles(MMG5_pMesh mesh, int* reqIdx, int nreq) {
+int MMG3D_Set_requiredTriangles(MMG5_pMesh mesh, MMG5_int* reqIdx, MMG5_int nreq) {
   int k;
 
   for ( k=0; k<nreq; ++k ){
@@ -1160,7 +1353,7 @@ int MMG3D_Set_requiredTriangles(MMG5_pMesh mesh, int* reqIdx, int nreq) {
   return(1);
 }
 
-int MMG3D_Set_parallelTriangle(MMG5_pMesh mesh, int k) {
+int MMG3D_Set_parallelTriangle(MMG5_pMesh mesh, MMG5_int k) {
   assert ( k <= mesh->nt );
   mesh->tria[k].tag[0] |= MG_PARBDY;
   mesh->tria[k].tag[1] |= MG_PARBDY;
@@ -1168,7 +1361,7 @@ int MMG3D_Set_parallelTriangle(MMG5_pMesh mesh, int k) {
   return(1);
 }
 
-int MMG3D_Set_parallelTriangles(MMG5_pMesh mesh, int* parIdx, int npar) {
+int MMG3D_Set_parallelTriangles(MMG5_pMesh mesh, MMG5_int* parIdx, MMG5_int npar) {
   int k;
 
   for ( k=0; k<npar; ++k ){
@@ -1179,19 +1372,19 @@ int MMG3D_Set_parallelTriangles(MMG5_pMesh mesh, int* parIdx, int npar) {
   return(1);
 }
 
-int MMG3D_Set_ridge(MMG5_pMesh mesh, int k) {
+int MMG3D_Set_ridge(MMG5_pMesh mesh, MMG5_int k) {
   assert ( k <= mesh->na );
   mesh->edge[k].tag |= MG_GEO;
   return(1);
 }
 
-int MMG3D_Set_requiredEdge(MMG5_pMesh mesh, int k) {
+int MMG3D_Set_requiredEdge(MMG5_pMesh mesh, MMG5_int k) {
   assert ( k <= mesh->na );
   mesh->edge[k].tag |= MG_REQ;
   return(1);
 }
 
-int MMG3D_Set_normalAtVertex(MMG5_pMesh mesh, int k, double n0, double n1, double n2) {
+int MMG3D_Set_normalAtVertex(MMG5_pMesh mesh, MMG5_int k, double n0, double n1, double n2) {
 
   assert ( k <= mesh->np );
   mesh->point[k].n[0] = n0;
@@ -1203,7 +1396,7 @@ int MMG3D_Set_normalAtVertex(MMG5_pMesh mesh, int k, double n0, double n1, doubl
   return(1);
 }
 
-int MMG3D_Get_normalAtVertex(MMG5_pMesh mesh, int k, double *n0, double *n1, double *n2) {
+int MMG3D_Get_normalAtVertex(MMG5_pMesh mesh, MMG5_int k, double *n0, double *n1, double *n2) {
 
   assert ( k <= mesh->np );
   (*n0) = mesh->point[k].n[0];
@@ -1213,7 +1406,7 @@ int MMG3D_Get_normalAtVertex(MMG5_pMesh mesh, int k, double *n0, double *n1, dou
   return(1);
 }
 
-int MMG3D_Set_scalarSol(MMG5_pSol met, double s, int pos) {
+int MMG3D_Set_scalarSol(MMG5_pSol met, double s, MMG5_int pos) {
 
   if ( !met->np ) {
     fprintf(stderr,"\n  ## Error: %s: You must set the number of"
@@ -1229,14 +1422,14 @@ int MMG3D_Set_scalarSol(MMG5_pSol met, double s, int pos) {
   }
   if ( pos >= met->npmax ) {
     fprintf(stderr,"\n  ## Error: %s: unable to set a new solution.\n",__func__);
-    fprintf(stderr,"    max number of solutions: %d\n",met->npmax);
+    fprintf(stderr,"    max number of solutions: %" MMG5_PRId "\n",met->npmax);
     return(0);
   }
 
   if ( pos > met->np ) {
     fprintf(stderr,"\n  ## Error: %s: attempt to set new solution at"
-            " position %d.",__func__,pos);
-    fprintf(stderr," Overflow of the given number of solutions: %d\n",met->np);
+            " position %" MMG5_PRId ".",__func__,pos);
+    fprintf(stderr," Overflow of the given number of solutions: %" MMG5_PRId "\n",met->np);
     fprintf(stderr,"\n  ## Check the solution size, its compactness or the position");
     fprintf(stderr," of the solution.\n");
     return(0);
@@ -1259,7 +1452,7 @@ int MMG3D_Get_scalarSol(MMG5_pSol met, double* s) {
       fprintf(stderr,"     You must pass here exactly one time (the first time ");
       fprintf(stderr,"you call the MMG3D_Get_scalarSol function).\n");
       fprintf(stderr,"     If not, the number of call of this function");
-      fprintf(stderr," exceed the number of points: %d\n ",met->np);
+      fprintf(stderr," exceed the number of points: %" MMG5_PRId "\n ",met->np);
     }
   }
 
@@ -1268,7 +1461,7 @@ int MMG3D_Get_scalarSol(MMG5_pSol met, double* s) {
   if ( met->npi > met->np ) {
     fprintf(stderr,"\n  ## Error: %s: unable to get solution.\n",__func__);
     fprintf(stderr,"     The number of call of MMG3D_Get_scalarSol function");
-    fprintf(stderr," can not exceed the number of points: %d\n ",met->np);
+    fprintf(stderr," can not exceed the number of points: %" MMG5_PRId "\n ",met->np);
     return(0);
   }
 
@@ -1278,7 +1471,7 @@ int MMG3D_Get_scalarSol(MMG5_pSol met, double* s) {
 }
 
 int MMG3D_Set_scalarSols(MMG5_pSol met, double *s ) {
-  int k;
+  MMG5_int k;
 
   if ( !met->np ) {
     fprintf(stderr,"\n  ## Error: %s: You must set the number of solution"
@@ -1295,7 +1488,7 @@ int MMG3D_Set_scalarSols(MMG5_pSol met, double *s ) {
 }
 
 int MMG3D_Get_scalarSols(MMG5_pSol met, double* s) {
-  int k;
+  MMG5_int k;
 
   for ( k=0; k<met->np; ++k )
     s[k]  = met->m[k+1];
@@ -1303,7 +1496,7 @@ int MMG3D_Get_scalarSols(MMG5_pSol met, double* s) {
   return(1);
 }
 
-int MMG3D_Set_vectorSol(MMG5_pSol met, double vx,double vy, double vz, int pos) {
+int MMG3D_Set_vectorSol(MMG5_pSol met, double vx,double vy, double vz, MMG5_int pos) {
 
   if ( !met->np ) {
     fprintf(stderr,"\n  ## Error: %s: You must set the number of solution"
@@ -1319,14 +1512,14 @@ int MMG3D_Set_vectorSol(MMG5_pSol met, double vx,double vy, double vz, int pos)
   }
   if ( pos >= met->npmax ) {
     fprintf(stderr,"\n  ## Error: %s: unable to set a new solution.\n",__func__);
-    fprintf(stderr,"    max number of solutions: %d\n",met->npmax);
+    fprintf(stderr,"    max number of solutions: %" MMG5_PRId "\n",met->npmax);
     return(0);
   }
 
   if ( pos > met->np ) {
     fprintf(stderr,"\n  ## Error: %s: attempt to set new solution at"
-            " position %d.",__func__,pos);
-    fprintf(stderr," Overflow of the given number of solutions: %d\n",met->np);
+            " position %" MMG5_PRId ".",__func__,pos);
+    fprintf(stderr," Overflow of the given number of solutions: %" MMG5_PRId "\n",met->np);
     fprintf(stderr,"\n  ## Check the solution size, its compactness or the position");
     fprintf(stderr," of the solution.\n");
     return(0);
@@ -1352,7 +1545,7 @@ int MMG3D_Get_vectorSol(MMG5_pSol met, double* vx, double* vy, double* vz) {
       fprintf(stderr,"     You must pass here exactly one time (the first time ");
       fprintf(stderr,"you call the MMG3D_Get_vectorSol function).\n");
       fprintf(stderr,"     If not, the number of call of this function");
-      fprintf(stderr," exceed the number of points: %d\n ",met->np);
+      fprintf(stderr," exceed the number of points: %" MMG5_PRId "\n ",met->np);
     }
   }
 
@@ -1361,7 +1554,7 @@ int MMG3D_Get_vectorSol(MMG5_pSol met, double* vx, double* vy, double* vz) {
   if ( met->npi > met->np ) {
     fprintf(stderr,"\n  ## Error: %s: unable to get solution.\n",__func__);
     fprintf(stderr,"     The number of call of MMG3D_Get_vectorSol function");
-    fprintf(stderr," can not exceed the number of points: %d\n ",met->np);
+    fprintf(stderr," can not exceed the number of points: %" MMG5_PRId "\n ",met->np);
     return(0);
   }
 
@@ -1374,7 +1567,7 @@ int MMG3D_Get_vectorSol(MMG5_pSol met, double* vx, double* vy, double* vz) {
 
 int MMG3D_Set_vectorSols(MMG5_pSol met, double *sols) {
   double *m;
-  int k,j;
+  MMG5_int k,j;
 
   if ( !met->np ) {
     fprintf(stderr,"\n  ## Error: %s: You must set the number of solution"
@@ -1397,7 +1590,7 @@ int MMG3D_Set_vectorSols(MMG5_pSol met, double *sols) {
 
 int MMG3D_Get_vectorSols(MMG5_pSol met, double* sols) {
   double *m;
-  int k, j;
+  MMG5_int k,j;
 
   for ( k=0; k<met->np; ++k ) {
     j = 3*k;
@@ -1411,7 +1604,7 @@ int MMG3D_Get_vectorSols(MMG5_pSol met, double* sols) {
 }
 
 int MMG3D_Set_tensorSol(MMG5_pSol met, double m11,double m12, double m13,
-                        double m22,double m23, double m33, int pos) {
+                        double m22,double m23, double m33, MMG5_int pos) {
 
   if ( !met->np ) {
     fprintf(stderr,"\n  ## Error: %s: You must set the number of solution"
@@ -1428,14 +1621,14 @@ int MMG3D_Set_tensorSol(MMG5_pSol met, double m11,double m12, double m13,
   }
   if ( pos >= met->npmax ) {
     fprintf(stderr,"\n  ## Error: %s: unable to set a new solution.\n",__func__);
-    fprintf(stderr,"    max number of solutions: %d\n",met->npmax);
+    fprintf(stderr,"    max number of solutions: %" MMG5_PRId "\n",met->npmax);
     return(0);
   }
 
   if ( pos > met->np ) {
     fprintf(stderr,"\n  ## Error: %s: attempt to set new solution at "
-            "position %d.",__func__,pos);
-    fprintf(stderr," Overflow of the given number of solutions: %d\n",met->np);
+            "position %" MMG5_PRId ".",__func__,pos);
+    fprintf(stderr," Overflow of the given number of solutions: %" MMG5_PRId "\n",met->np);
     fprintf(stderr,"\n  ## Check the solution size, its compactness or the position");
     fprintf(stderr," of the solution.\n");
     return(0);
@@ -1465,7 +1658,7 @@ int MMG3D_Get_tensorSol(MMG5_pSol met, double *m11,double *m12, double *m13,
       fprintf(stderr,"     You must pass here exactly one time (the first time ");
       fprintf(stderr,"you call the MMG3D_Get_tensorSol function).\n");
       fprintf(stderr,"     If not, the number of call of this function");
-      fprintf(stderr," exceed the number of points: %d\n ",met->np);
+      fprintf(stderr," exceed the number of points: %" MMG5_PRId "\n ",met->np);
     }
   }
 
@@ -1474,7 +1667,7 @@ int MMG3D_Get_tensorSol(MMG5_pSol met, double *m11,double *m12, double *m13,
   if ( met->npi > met->np ) {
     fprintf(stderr,"\n  ## Error: %s: unable to get solution.\n",__func__);
     fprintf(stderr,"     The number of call of MMG3D_Get_tensorSol function");
-    fprintf(stderr," can not exceed the number of points: %d\n ",met->np);
+    fprintf(stderr," can not exceed the number of points: %" MMG5_PRId "\n ",met->np);
     return(0);
   }
 
@@ -1490,7 +1683,7 @@ int MMG3D_Get_tensorSol(MMG5_pSol met, double *m11,double *m12, double *m13,
 
 int MMG3D_Set_tensorSols(MMG5_pSol met, double *sols) {
   double *m;
-  int k,j;
+  MMG5_int k,j;
 
   if ( !met->np ) {
     fprintf(stderr,"\n  ## Error: %s: You must set the number of"
@@ -1516,7 +1709,7 @@ int MMG3D_Set_tensorSols(MMG5_pSol met, double *sols) {
 
 int MMG3D_Get_tensorSols(MMG5_pSol met, double *sols) {
   double *m;
-  int k,j;
+  MMG5_int k,j;
 
   for ( k=0; k<met->np; ++k ) {
     j = 6*k;
@@ -1533,8 +1726,62 @@ int MMG3D_Get_tensorSols(MMG5_pSol met, double *sols) {
   return(1);
 }
 
+int MMG3D_Adopt_sols(MMG5_pMesh mesh,MMG5_pSol sol,double *s) {
+  size_t siz;
+
+  if ( !sol->np || !sol->m ) {
+    fprintf(stderr,"\n  ## Error: %s: You must set the number of solution"
+            " with the",__func__);
+    fprintf(stderr," MMG3D_Set_solSize function before setting values");
+    fprintf(stderr," in solution structure \n");
+    free(s);
+    return(0);
+  }
+
+  /* The s array becomes the array of the solution: the values are shifted of
+   * one node as the solution is stored from index 1 */
+  siz = (size_t)sol->size*(sol->npmax+1);
+  _MMG5_DEL_MEM(mesh,sol->m,siz*sizeof(double));
+  _MMG5_ADD_MEM(mesh,siz*sizeof(double),"initial solution",
+                free(s);return 0);
+  sol->m = (double*)realloc(s,siz*sizeof(double));
+  if ( !sol->m ) {
+    perror("  ## Memory problem: realloc");
+    free(s);
+    mesh->memCur -= (long long)(siz*sizeof(double));
+    return(0);
+  }
+  memmove(sol->m+sol->size,sol->m,(size_t)sol->size*sol->np*sizeof(double));
+  memset(sol->m,0,sol->size*sizeof(double));
+  memset(sol->m+(size_t)sol->size*(sol->np+1),0,
+         (size_t)sol->size*(sol->npmax-sol->np)*sizeof(double));
+
+  return(1);
+}
+
+int MMG3D_Release_sols(MMG5_pMesh mesh,MMG5_pSol sol,double **s) {
+  double *ptr;
+
+  if ( !sol->m || !sol->np ) {
+    fprintf(stderr,"\n  ## Error: %s: no solution to release.\n",__func__);
+    return(0);
+  }
+
+  ptr = sol->m;
+  memmove(ptr,ptr+sol->size,(size_t)sol->size*sol->np*sizeof(double));
+
+  mesh->memCur -= (long long)((size_t)sol->size*(sol->npmax+1)*sizeof(double));
+  *s = (double*)realloc(ptr,(size_t)sol->size*sol->np*sizeof(double));
+  /* the shrinking failed: return the whole block */
+  if ( !*s ) *s = ptr;
+  sol->m = NULL;
+  sol->npmax = 0;
+
+  return(1);
+}
+
 void MMG3D_Set_handGivenMesh(MMG5_pMesh mesh) {
-  int k, aux;
+  MMG5_int aux,k;
 
   /* Possibly switch 2 vertices number so that each tet is positively oriented */
   for (k=1; k<=mesh->ne; k++) {
@@ -1598,7 +1845,7 @@ static inline
 int _MMG3D_skipIso(MMG5_pMesh mesh) {
   MMG5_pTria  ptt,ptt1;
   MMG5_pEdge  pa,pa1;
-  int    k;
+  MMG5_int k;
 
   if ( (mesh->info.imprim > 5) || mesh->info.ddebug )
     fprintf(stderr,"\n  ## Warning: %s: skip of all entites with %d reference.\n",
@@ -1693,6 +1940,23 @@ int MMG3D_Set_iparameter(MMG5_pMesh mesh, MMG5_pSol sol, int iparam,int val){
   case MMG3D_IPARAM_octree :
     mesh->info.octree   = val;
     break;
+  case MMG3D_IPARAM_nthreads :
+    if ( val <= 0 ) {
+      fprintf(stderr,"\n  ## Warning: %s: number of threads must be"
+              " strictly positive.\n",__func__);
+      fprintf(stderr,"  Reset to default value.\n");
+      mesh->info.nthreads = 1;
+    }
+#ifndef _OPENMP
+    else if ( val > 1 ) {
+      fprintf(stderr,"\n  ## Warning: %s: mmg compiled without OpenMP:"
+              " number of threads ignored.\n",__func__);
+      mesh->info.nthreads = 1;
+    }
+#endif
+    else
+      mesh->info.nthreads = val;
+    break;
 #endif
   case MMG3D_IPARAM_debug :
     mesh->info.ddebug   = val;
@@ -1781,11 +2045,9 @@ int MMG3D_Set_iparameter(MMG5_pMesh mesh, MMG5_pSol sol, int iparam,int val){
     }
 
     break;
-#ifdef USE_SCOTCH
   case MMG3D_IPARAM_renum :
     mesh->info.renum    = val;
     break;
-#endif
   case MMG3D_IPARAM_anisosize :
     if ( !MMG3D_Set_solSize(mesh,sol,MMG5_Vertex,0,MMG5_Tensor) )
       return 0;
@@ -1813,6 +2075,9 @@ int MMG3D_Get_iparameter(MMG5_pMesh mesh, int iparam) {
   case MMG3D_IPARAM_octree :
     return ( mesh->info.octree );
     break;
+  case MMG3D_IPARAM_nthreads :
+    return ( mesh->info.nthreads );
+    break;
 #endif
   case MMG3D_IPARAM_debug :
     return ( mesh->info.ddebug );
@@ -1846,11 +2111,9 @@ int MMG3D_Get_iparameter(MMG5_pMesh mesh, int iparam) {
   case MMG3D_IPARAM_numberOfLocalParam :
     return ( mesh->info.npar );
     break;
-#ifdef USE_SCOTCH
   case MMG3D_IPARAM_renum :
     return ( mesh->info.renum );
     break;
-#endif
   default :
     fprintf(stderr,"\n  ## Error: %s: unknown type of parameter\n",__func__);
     return 0;
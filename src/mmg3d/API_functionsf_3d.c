@@ -143,7 +143,7 @@ FORTRAN_NAME(MMG3D_SET_OUTPUTSOLNAME,mmg3d_set_outputsolname,
  */
 FORTRAN_NAME(MMG3D_SET_SOLSIZE,mmg3d_set_solsize,
              (MMG5_pMesh *mesh, MMG5_pSol *sol, int* typEntity,
-              int* np, int* typSol, int* retval),
+              MMG5_int* np, int* typSol, int* retval),
              (mesh, sol, typEntity, np, typSol, retval)) {
   *retval = MMG3D_Set_solSize(*mesh,*sol,*typEntity,*np,*typSol);
   return;
@@ -153,8 +153,8 @@ FORTRAN_NAME(MMG3D_SET_SOLSIZE,mmg3d_set_solsize,
  * See \ref MMG3D_Set_meshSize function in \ref mmg3d/libmmg3d.h file.
  */
 FORTRAN_NAME(MMG3D_SET_MESHSIZE,mmg3d_set_meshsize,
-             (MMG5_pMesh *mesh, int *np, int *ne, int *nprism,
-              int *nt, int *nquad, int *na, int *retval),
+             (MMG5_pMesh *mesh, MMG5_int *np, MMG5_int *ne, MMG5_int *nprism,
+              MMG5_int *nt, MMG5_int *nquad, MMG5_int *na, int *retval),
              (mesh,np,ne,nprism,nt,nquad,na,retval)) {
   *retval = MMG3D_Set_meshSize(*mesh,*np,*ne,*nprism,*nt,*nquad,*na);
   return;
@@ -164,7 +164,7 @@ FORTRAN_NAME(MMG3D_SET_MESHSIZE,mmg3d_set_meshsize,
  * See \ref MMG3D_Get_solSize function in \ref mmg3d/libmmg3d.h file.
  */
 FORTRAN_NAME(MMG3D_GET_SOLSIZE,mmg3d_get_solsize,
-             (MMG5_pMesh *mesh, MMG5_pSol *sol, int* typEntity, int* np, int* typSol, int* retval),
+             (MMG5_pMesh *mesh, MMG5_pSol *sol, int* typEntity, MMG5_int* np, int* typSol, int* retval),
              (mesh,sol,typEntity,np,typSol,retval)) {
 
   *retval = MMG3D_Get_solSize(*mesh,*sol,typEntity,np,typSol);
@@ -175,8 +175,8 @@ FORTRAN_NAME(MMG3D_GET_SOLSIZE,mmg3d_get_solsize,
  * See \ref MMG3D_Get_meshSize function in \ref mmg3d/libmmg3d.h file.
  */
 FORTRAN_NAME(MMG3D_GET_MESHSIZE,mmg3d_get_meshsize,
-             (MMG5_pMesh *mesh, int* np, int* ne,int *nprism,
-              int* nt,int *nquad, int* na, int* retval),
+             (MMG5_pMesh *mesh, MMG5_int* np, MMG5_int* ne,MMG5_int *nprism,
+              MMG5_int* nt,MMG5_int *nquad, MMG5_int* na, int* retval),
              (mesh,np,ne,nprism,nt,nquad,na,retval)) {
 
   *retval = MMG3D_Get_meshSize(*mesh,np,ne,nprism,nt,nquad,na);
@@ -188,7 +188,7 @@ FORTRAN_NAME(MMG3D_GET_MESHSIZE,mmg3d_get_meshsize,
  */
 FORTRAN_NAME(MMG3D_SET_VERTEX,mmg3d_set_vertex,
              (MMG5_pMesh *mesh, double* c0, double* c1, double* c2, int* ref,
-              int* pos, int* retval),
+              MMG5_int* pos, int* retval),
              (mesh,c0,c1,c2,ref,pos,retval)) {
 
   *retval = MMG3D_Set_vertex(*mesh,*c0,*c1,*c2,*ref,*pos);
@@ -232,8 +232,8 @@ FORTRAN_NAME(MMG3D_GET_VERTICES,mmg3d_get_vertices,
  * See \ref MMG3D_Set_tetrahedron function in \ref mmg3d/libmmg3d.h file.
  */
 FORTRAN_NAME(MMG3D_SET_TETRAHEDRON,mmg3d_set_tetrahedron,
-             (MMG5_pMesh *mesh, int *v0, int *v1, int *v2, int *v3, int *ref,
-              int *pos, int* retval),
+             (MMG5_pMesh *mesh, MMG5_int *v0, MMG5_int *v1, MMG5_int *v2, MMG5_int *v3, int *ref,
+              MMG5_int *pos, int* retval),
              (mesh,v0,v1,v2,v3,ref,pos,retval)){
   *retval = MMG3D_Set_tetrahedron(*mesh,*v0,*v1,*v2,*v3,*ref,*pos);
   return;
@@ -243,7 +243,7 @@ FORTRAN_NAME(MMG3D_SET_TETRAHEDRON,mmg3d_set_tetrahedron,
  * See \ref MMG3D_Set_tetrahedra function in \ref mmg3d/libmmg3d.h file.
  */
 FORTRAN_NAME(MMG3D_SET_TETRAHEDRA,mmg3d_set_tetrahedra,
-             (MMG5_pMesh *mesh, int *tetra, int *refs, int* retval),
+             (MMG5_pMesh *mesh, MMG5_int *tetra, int *refs, int* retval),
              (mesh,tetra,refs,retval)){
   *retval = MMG3D_Set_tetrahedra(*mesh,tetra,refs);
   return;
@@ -253,7 +253,7 @@ FORTRAN_NAME(MMG3D_SET_TETRAHEDRA,mmg3d_set_tetrahedra,
  * See \ref MMG3D_Get_tetrahedron function in \ref mmg3d/libmmg3d.h file.
  */
 FORTRAN_NAME(MMG3D_GET_TETRAHEDRON,mmg3d_get_tetrahedron,
-             (MMG5_pMesh *mesh, int* v0, int* v1, int* v2, int *v3,
+             (MMG5_pMesh *mesh, MMG5_int* v0, MMG5_int* v1, MMG5_int* v2, MMG5_int *v3,
               int* ref, int* isRequired, int* retval),
              (mesh,v0,v1,v2,v3,ref,isRequired,retval)) {
   *retval = MMG3D_Get_tetrahedron(*mesh,v0,v1,v2,v3,ref,isRequired);
@@ -263,7 +263,7 @@ FORTRAN_NAME(MMG3D_GET_TETRAHEDRON,mmg3d_get_tetrahedron,
  * See \ref MMG3D_Get_tetrahedra function in \ref mmg3d/libmmg3d.h file.
  */
 FORTRAN_NAME(MMG3D_GET_TETRAHEDRA,mmg3d_get_tetrahedra,
-             (MMG5_pMesh *mesh, int* tetra, int* refs, int* areRequired,
+             (MMG5_pMesh *mesh, MMG5_int* tetra, int* refs, int* areRequired,
               int* retval),
              (mesh,tetra,refs,areRequired,retval)) {
   *retval = MMG3D_Get_tetrahedra(*mesh,tetra,refs,areRequired);
@@ -274,8 +274,8 @@ FORTRAN_NAME(MMG3D_GET_TETRAHEDRA,mmg3d_get_tetrahedra,
  * See \ref MMG3D_Set_prism function in \ref mmg3d/libmmg3d.h file.
  */
 FORTRAN_NAME(MMG3D_SET_PRISM,mmg3d_set_prism,
-             (MMG5_pMesh *mesh, int *v0, int *v1, int *v2, int *v3,
-              int *v4, int *v5,int *ref,int *pos, int* retval),
+             (MMG5_pMesh *mesh, MMG5_int *v0, MMG5_int *v1, MMG5_int *v2, MMG5_int *v3,
+              MMG5_int *v4, MMG5_int *v5,int *ref,MMG5_int *pos, int* retval),
              (mesh,v0,v1,v2,v3,v4,v5,ref,pos,retval)){
   *retval = MMG3D_Set_prism(*mesh,*v0,*v1,*v2,*v3,*v4,*v5,*ref,*pos);
   return;
@@ -285,7 +285,7 @@ FORTRAN_NAME(MMG3D_SET_PRISM,mmg3d_set_prism,
  * See \ref MMG3D_Set_prisms function in \ref mmg3d/libmmg3d.h file.
  */
 FORTRAN_NAME(MMG3D_SET_PRISMS,mmg3d_set_prisms,
-             (MMG5_pMesh *mesh, int *prisms, int *refs, int* retval),
+             (MMG5_pMesh *mesh, MMG5_int *prisms, int *refs, int* retval),
              (mesh,prisms,refs,retval)){
   *retval = MMG3D_Set_prisms(*mesh,prisms,refs);
   return;
@@ -295,8 +295,8 @@ FORTRAN_NAME(MMG3D_SET_PRISMS,mmg3d_set_prisms,
  * See \ref MMG3D_Get_prism function in \ref mmg3d/libmmg3d.h file.
  */
 FORTRAN_NAME(MMG3D_GET_PRISM,mmg3d_get_prism,
-             (MMG5_pMesh *mesh, int* v0, int* v1, int* v2, int *v3,
-              int *v4, int* v5,int* ref, int* isRequired, int* retval),
+             (MMG5_pMesh *mesh, MMG5_int* v0, MMG5_int* v1, MMG5_int* v2, MMG5_int *v3,
+              MMG5_int *v4, MMG5_int* v5,int* ref, int* isRequired, int* retval),
              (mesh,v0,v1,v2,v3,v4,v5,ref,isRequired,retval)) {
   *retval = MMG3D_Get_prism(*mesh,v0,v1,v2,v3,v4,v5,ref,isRequired);
   return;
@@ -305,7 +305,7 @@ FORTRAN_NAME(MMG3D_GET_PRISM,mmg3d_get_prism,
  * See \ref MMG3D_Get_prisms function in \ref mmg3d/libmmg3d.h file.
  */
 FORTRAN_NAME(MMG3D_GET_PRISMS,mmg3d_get_prisms,
-             (MMG5_pMesh *mesh, int* prisms, int* refs, int* areRequired,
+             (MMG5_pMesh *mesh, MMG5_int* prisms, int* refs, int* areRequired,
               int* retval),
              (mesh,prisms,refs,areRequired,retval)) {
   *retval = MMG3D_Get_prisms(*mesh,prisms,refs,areRequired);
@@ -316,7 +316,7 @@ FORTRAN_NAME(MMG3D_GET_PRISMS,mmg3d_get_prisms,
  * See \ref MMG3D_Set_triangle function in \ref mmg3d/libmmg3d.h file.
  */
 FORTRAN_NAME(MMG3D_SET_TRIANGLE,mmg3d_set_triangle,
-             (MMG5_pMesh *mesh, int* v0, int* v1, int* v2, int* ref,int* pos,
+             (MMG5_pMesh *mesh, MMG5_int* v0, MMG5_int* v1, MMG5_int* v2, int* ref,MMG5_int* pos,
               int* retval),
              (mesh,v0,v1,v2,ref,pos,retval)) {
   *retval = MMG3D_Set_triangle(*mesh, *v0, *v1, *v2, *ref, *pos);
@@ -327,7 +327,7 @@ FORTRAN_NAME(MMG3D_SET_TRIANGLE,mmg3d_set_triangle,
  * See \ref MMG3D_Get_triangle function in \ref mmg3d/libmmg3d.h file.
  */
 FORTRAN_NAME(MMG3D_GET_TRIANGLE,mmg3d_get_triangle,
-             (MMG5_pMesh *mesh, int* v0, int* v1, int* v2, int* ref
+             (MMG5_pMesh *mesh, MMG5_int* v0, MMG5_int* v1, MMG5_int* v2, int* ref
               ,int* isRequired, int* retval),
              (mesh,v0,v1,v2,ref,isRequired,retval)) {
   *retval = MMG3D_Get_triangle(*mesh,v0,v1,v2,ref,isRequired);
@@ -337,7 +337,7 @@ FORTRAN_NAME(MMG3D_GET_TRIANGLE,mmg3d_get_triangle,
  * See \ref MMG3D_Set_triangles function in \ref mmg3d/libmmg3d.h file.
  */
 FORTRAN_NAME(MMG3D_SET_TRIANGLES,mmg3d_set_triangles,
-             (MMG5_pMesh *mesh, int* tria, int* refs,
+             (MMG5_pMesh *mesh, MMG5_int* tria, int* refs,
               int* retval),
              (mesh,tria,refs,retval)) {
   *retval = MMG3D_Set_triangles(*mesh, tria, refs);
@@ -348,7 +348,7 @@ FORTRAN_NAME(MMG3D_SET_TRIANGLES,mmg3d_set_triangles,
  * See \ref MMG3D_Get_triangles function in \ref mmg3d/libmmg3d.h file.
  */
 FORTRAN_NAME(MMG3D_GET_TRIANGLES,mmg3d_get_triangles,
-             (MMG5_pMesh *mesh, int* tria, int* refs,int* areRequired,
+             (MMG5_pMesh *mesh, MMG5_int* tria, int* refs,int* areRequired,
               int* retval),
              (mesh,tria,refs,areRequired,retval)) {
   *retval = MMG3D_Get_triangles(*mesh,tria,refs,areRequired);
@@ -358,8 +358,8 @@ FORTRAN_NAME(MMG3D_GET_TRIANGLES,mmg3d_get_triangles,
  * See \ref MMG3D_Set_quadrilateral function in \ref mmg3d/libmmg3d.h file.
  */
 FORTRAN_NAME(MMG3D_SET_QUADRILATERAL,mmg3d_set_quadrilateral,
-             (MMG5_pMesh *mesh, int* v0, int* v1, int* v2,int *v3,
-              int* ref,int* pos,int* retval),
+             (MMG5_pMesh *mesh, MMG5_int* v0, MMG5_int* v1, MMG5_int* v2,MMG5_int *v3,
+              int* ref,MMG5_int* pos,int* retval),
              (mesh,v0,v1,v2,v3,ref,pos,retval)) {
   *retval = MMG3D_Set_quadrilateral(*mesh, *v0, *v1, *v2, *v3,*ref, *pos);
   return;
@@ -369,7 +369,7 @@ FORTRAN_NAME(MMG3D_SET_QUADRILATERAL,mmg3d_set_quadrilateral,
  * See \ref MMG3D_Get_quadrilateral function in \ref mmg3d/libmmg3d.h file.
  */
 FORTRAN_NAME(MMG3D_GET_QUADRILATERAL,mmg3d_get_quadrilateral,
-             (MMG5_pMesh *mesh, int* v0, int* v1, int* v2,int *v3,
+             (MMG5_pMesh *mesh, MMG5_int* v0, MMG5_int* v1, MMG5_int* v2,MMG5_int *v3,
                int* ref,int* isRequired, int* retval),
              (mesh,v0,v1,v2,v3,ref,isRequired,retval)) {
   *retval = MMG3D_Get_quadrilateral(*mesh,v0,v1,v2,v3,ref,isRequired);
@@ -379,7 +379,7 @@ FORTRAN_NAME(MMG3D_GET_QUADRILATERAL,mmg3d_get_quadrilateral,
  * See \ref MMG3D_Set_quadrilaterals function in \ref mmg3d/libmmg3d.h file.
  */
 FORTRAN_NAME(MMG3D_SET_QUADRILATERALS,mmg3d_set_quadrilaterals,
-             (MMG5_pMesh *mesh, int* quads, int* refs,
+             (MMG5_pMesh *mesh, MMG5_int* quads, int* refs,
               int* retval),
              (mesh,quads,refs,retval)) {
   *retval = MMG3D_Set_quadrilaterals(*mesh, quads, refs);
@@ -390,7 +390,7 @@ FORTRAN_NAME(MMG3D_SET_QUADRILATERALS,mmg3d_set_quadrilaterals,
  * See \ref MMG3D_Get_quadrilaterals function in \ref mmg3d/libmmg3d.h file.
  */
 FORTRAN_NAME(MMG3D_GET_QUADRILATERALS,mmg3d_get_quadrilaterals,
-             (MMG5_pMesh *mesh, int* quads, int* refs,int* areRequired,
+             (MMG5_pMesh *mesh, MMG5_int* quads, int* refs,int* areRequired,
               int* retval),
              (mesh,quads,refs,areRequired,retval)) {
   *retval = MMG3D_Get_quadrilaterals(*mesh,quads,refs,areRequired);
@@ -401,7 +401,7 @@ FORTRAN_NAME(MMG3D_GET_QUADRILATERALS,mmg3d_get_quadrilaterals,
  * See \ref MMG3D_Set_edge function in \ref mmg3d/libmmg3d.h file.
  */
 FORTRAN_NAME(MMG3D_SET_EDGE,mmg3d_set_edge,
-             (MMG5_pMesh *mesh, int *v0, int *v1, int *ref, int *pos, int* retval),
+             (MMG5_pMesh *mesh, MMG5_int *v0, MMG5_int *v1, int *ref, MMG5_int *pos, int* retval),
              (mesh,v0,v1,ref,pos,retval)){
   *retval = MMG3D_Set_edge(*mesh,*v0,*v1,*ref,*pos);
   return;
@@ -410,7 +410,7 @@ FORTRAN_NAME(MMG3D_SET_EDGE,mmg3d_set_edge,
 /**
  * See \ref MMG3D_Get_edge function in \ref mmg3d/libmmg3d.h file.
  */
-FORTRAN_NAME(MMG3D_GET_EDGE,mmg3d_get_edge,(MMG5_pMesh *mesh, int* e0, int* e1, int* ref
+FORTRAN_NAME(MMG3D_GET_EDGE,mmg3d_get_edge,(MMG5_pMesh *mesh, MMG5_int* e0, MMG5_int* e1, int* ref
                                           ,int* isRidge, int* isRequired, int* retval),
              (mesh,e0,e1,ref,isRidge,isRequired,retval)) {
   *retval = MMG3D_Get_edge(*mesh,e0,e1,ref,isRidge,isRequired);
@@ -420,7 +420,7 @@ FORTRAN_NAME(MMG3D_GET_EDGE,mmg3d_get_edge,(MMG5_pMesh *mesh, int* e0, int* e1,
 /**
  * See \ref MMG3D_Set_corner function in \ref mmg3d/libmmg3d.h file.
  */
-FORTRAN_NAME(MMG3D_SET_CORNER,mmg3d_set_corner,(MMG5_pMesh *mesh, int *k, int* retval),
+FORTRAN_NAME(MMG3D_SET_CORNER,mmg3d_set_corner,(MMG5_pMesh *mesh, MMG5_int *k, int* retval),
              (mesh,k,retval)) {
   *retval =  MMG3D_Set_corner(*mesh,*k);
   return;
@@ -430,7 +430,7 @@ FORTRAN_NAME(MMG3D_SET_CORNER,mmg3d_set_corner,(MMG5_pMesh *mesh, int *k, int* r
  * See \ref MMG3D_Set_requiredVertex function in \ref mmg3d/libmmg3d.h file.
  */
 FORTRAN_NAME(MMG3D_SET_REQUIREDVERTEX,mmg3d_set_requiredvertex,
-             (MMG5_pMesh *mesh, int *k, int* retval),
+             (MMG5_pMesh *mesh, MMG5_int *k, int* retval),
              (mesh,k,retval)) {
   *retval =  MMG3D_Set_requiredVertex(*mesh,*k);
   return;
@@ -440,7 +440,7 @@ FORTRAN_NAME(MMG3D_SET_REQUIREDVERTEX,mmg3d_set_requiredvertex,
  * See \ref MMG3D_Set_requiredTetrahedron function in \ref mmg3d/libmmg3d.h file.
  */
 FORTRAN_NAME(MMG3D_SET_REQUIREDTETRAHEDRON,mmg3d_set_requiredtetrahedron,
-             (MMG5_pMesh *mesh, int *k, int* retval),
+             (MMG5_pMesh *mesh, MMG5_int *k, int* retval),
              (mesh,k,retval)) {
   *retval = MMG3D_Set_requiredTetrahedron(*mesh,*k);
   return;
@@ -450,7 +450,7 @@ FORTRAN_NAME(MMG3D_SET_REQUIREDTETRAHEDRON,mmg3d_set_requiredtetrahedron,
  * See \ref MMG3D_Set_requiredTetrahedra function in \ref mmg3d/libmmg3d.h file.
  */
 FORTRAN_NAME(MMG3D_SET_REQUIREDTETRAHEDRA,mmg3d_set_requiredtetrahedra,
-             (MMG5_pMesh *mesh, int *reqIdx, int *nreq, int* retval),
+             (MMG5_pMesh *mesh, MMG5_int *reqIdx, MMG5_int *nreq, int* retval),
              (mesh,reqIdx,nreq,retval)) {
   *retval = MMG3D_Set_requiredTetrahedra(*mesh,reqIdx, *nreq);
   return;
@@ -460,7 +460,7 @@ FORTRAN_NAME(MMG3D_SET_REQUIREDTETRAHEDRA,mmg3d_set_requiredtetrahedra,
  * See \ref MMG3D_Set_requiredTriangle function in \ref mmg3d/libmmg3d.h file.
  */
 FORTRAN_NAME(MMG3D_SET_REQUIREDTRIANGLE,mmg3d_set_requiredtriangle,
-             (MMG5_pMesh *mesh, int *k, int* retval),
+             (MMG5_pMesh *mesh, MMG5_int *k, int* retval),
              (mesh,k,retval)) {
   *retval = MMG3D_Set_requiredTriangle(*mesh, *k);
   return;
@@ -469,7 +469,7 @@ FORTRAN_NAME(MMG3D_SET_REQUIREDTRIANGLE,mmg3d_set_requiredtriangle,
  * See \ref MMG3D_Set_requiredTriangles function in \ref mmg3d/libmmg3d.h file.
  */
 FORTRAN_NAME(MMG3D_SET_REQUIREDTRIANGLES,mmg3d_set_requiredtriangles,
-             (MMG5_pMesh *mesh, int *reqIdx, int *nreq, int* retval),
+             (MMG5_pMesh *mesh, MMG5_int *reqIdx, MMG5_int *nreq, int* retval),
              (mesh,reqIdx,nreq,retval)) {
   *retval = MMG3D_Set_requiredTriangles(*mesh, reqIdx, *nreq);
   return;
@@ -479,7 +479,7 @@ FORTRAN_NAME(MMG3D_SET_REQUIREDTRIANGLES,mmg3d_set_requiredtriangles,
  * See \ref MMG3D_Set_parallelTriangle function in \ref mmg3d/libmmg3d.h file.
  */
 FORTRAN_NAME(MMG3D_SET_PARALLELTRIANGLE,mmg3d_set_paralleltriangle,
-             (MMG5_pMesh *mesh, int *k, int* retval),
+             (MMG5_pMesh *mesh, MMG5_int *k, int* retval),
              (mesh,k,retval)) {
   *retval = MMG3D_Set_parallelTriangle(*mesh, *k);
   return;
@@ -488,7 +488,7 @@ FORTRAN_NAME(MMG3D_SET_PARALLELTRIANGLE,mmg3d_set_paralleltriangle,
  * See \ref MMG3D_Set_parallelTriangles function in \ref mmg3d/libmmg3d.h file.
  */
 FORTRAN_NAME(MMG3D_SET_PARALLELTRIANGLES,mmg3d_set_paralleltriangles,
-             (MMG5_pMesh *mesh, int *parIdx, int *npar, int* retval),
+             (MMG5_pMesh *mesh, MMG5_int *parIdx, MMG5_int *npar, int* retval),
              (mesh,parIdx,npar,retval)) {
   *retval = MMG3D_Set_parallelTriangles(*mesh, parIdx, *npar);
   return;
@@ -498,7 +498,7 @@ FORTRAN_NAME(MMG3D_SET_PARALLELTRIANGLES,mmg3d_set_paralleltriangles,
  * See \ref MMG3D_Set_ridge function in \ref mmg3d/libmmg3d.h file.
  */
 FORTRAN_NAME(MMG3D_SET_RIDGE,mmg3d_set_ridge,
-             (MMG5_pMesh *mesh, int *k, int* retval),
+             (MMG5_pMesh *mesh, MMG5_int *k, int* retval),
              (mesh,k,retval)) {
   *retval = MMG3D_Set_ridge(*mesh,*k);
   return;
@@ -507,7 +507,7 @@ FORTRAN_NAME(MMG3D_SET_RIDGE,mmg3d_set_ridge,
  * See \ref MMG3D_Set_requiredEdge function in \ref mmg3d/libmmg3d.h file.
  */
 FORTRAN_NAME(MMG3D_SET_REQUIREDEDGE,mmg3d_set_requirededge,
-             (MMG5_pMesh *mesh, int *k, int* retval),
+             (MMG5_pMesh *mesh, MMG5_int *k, int* retval),
              (mesh,k,retval)) {
   *retval = MMG3D_Set_requiredEdge(*mesh,*k);
   return;
@@ -517,7 +517,7 @@ FORTRAN_NAME(MMG3D_SET_REQUIREDEDGE,mmg3d_set_requirededge,
  * See \ref MMG3D_Set_normalAtVertex function in \ref mmg3d/libmmg3d.h file.
  */
 FORTRAN_NAME(MMG3D_SET_NORMALATVERTEX,mmg3d_set_normalatvertex,
-             (MMG5_pMesh *mesh, int *k, double* n0, double* n1, double* n2,int* retval),
+             (MMG5_pMesh *mesh, MMG5_int *k, double* n0, double* n1, double* n2,int* retval),
              (mesh,k,n0,n1,n2,retval)) {
   *retval = MMG3D_Set_normalAtVertex(*mesh,*k, *n0, *n1, *n2);
   return;
@@ -526,7 +526,7 @@ FORTRAN_NAME(MMG3D_SET_NORMALATVERTEX,mmg3d_set_normalatvertex,
  * See \ref MMG3D_Get_normalAtVertex function in \ref mmg3d/libmmg3d.h file.
  */
 FORTRAN_NAME(MMG3D_GET_NORMALATVERTEX,mmg3d_get_normalatvertex,
-             (MMG5_pMesh *mesh, int *k, double* n0, double* n1, double* n2,int* retval),
+             (MMG5_pMesh *mesh, MMG5_int *k, double* n0, double* n1, double* n2,int* retval),
              (mesh,k,n0,n1,n2,retval)) {
   *retval = MMG3D_Get_normalAtVertex(*mesh,*k, n0, n1, n2);
   return;
@@ -536,7 +536,7 @@ FORTRAN_NAME(MMG3D_GET_NORMALATVERTEX,mmg3d_get_normalatvertex,
  * See \ref MMG3D_Set_scalarSol function in \ref mmg3d/libmmg3d.h file.
  */
 FORTRAN_NAME(MMG3D_SET_SCALARSOL,mmg3d_set_scalarsol,
-             (MMG5_pSol *met, double *s, int *pos, int* retval),
+             (MMG5_pSol *met, double *s, MMG5_int *pos, int* retval),
              (met,s,pos,retval)) {
   *retval = MMG3D_Set_scalarSol(*met,*s,*pos);
   return;
@@ -576,7 +576,7 @@ FORTRAN_NAME(MMG3D_GET_SCALARSOLS,mmg3d_get_scalarsols,
  */
 FORTRAN_NAME(MMG3D_SET_VECTORSOL,mmg3d_set_vectorsol,
              (MMG5_pSol *met, double *vx, double *vy, double *vz,
-              int *pos, int* retval),
+              MMG5_int *pos, int* retval),
              (met,vx,vy,vz,pos,retval)) {
   *retval = MMG3D_Set_vectorSol(*met,*vx,*vy,*vz,*pos);
   return;
@@ -616,7 +616,7 @@ FORTRAN_NAME(MMG3D_GET_VECTORSOLS,mmg3d_get_vectorsols,
  */
 FORTRAN_NAME(MMG3D_SET_TENSORSOL,mmg3d_set_tensorsol,
              (MMG5_pSol *met, double* m11,double *m12, double *m13,
-              double* m22,double *m23, double *m33, int *pos, int* retval),
+              double* m22,double *m23, double *m33, MMG5_int *pos, int* retval),
              (met,m11,m12,m13,m22,m23,m33,pos,retval)) {
   *retval = MMG3D_Set_tensorSol(*met,*m11,*m12,*m13,*m22,*m23,*m33,*pos);
   return;
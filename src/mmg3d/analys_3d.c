@@ -44,7 +44,7 @@
  */
 static inline void _MMG5_reqBoundaries(MMG5_pMesh mesh) {
   MMG5_pTria     ptt;
-  int            k;
+  MMG5_int       k;
 
   /* The MG_REQ+MG_NOSURF tag mark the boundary edges that we dont want to touch
    * but that are not really required (-nosurf option) */
@@ -96,14 +96,16 @@ static inline void _MMG5_reqBoundaries(MMG5_pMesh mesh) {
  */
 static int _MMG5_setadj(MMG5_pMesh mesh){
   MMG5_pTria   pt,pt1;
-  int          *adja,*adjb,adji1,adji2,*pile,iad,ipil,ip1,ip2,gen;
-  int          k,kk,iel,jel,nvf,nf,nr,nt,nre,nreq,ncc,ned,ref;
+  int          ipil,gen;
+  MMG5_int     adji1,adji2,ip1,ip2,*adjb,*adja,*pile,iad;
+  int          nvf,nf,nr,nt,nre,nreq,ncc,ned,ref;
+  MMG5_int     iel,kk,jel,k;
   int16_t      tag;
   char         i,ii,i1,i2,ii1,ii2,voy;
 
   nvf = nf = ncc = ned = 0;
 
-  _MMG5_SAFE_MALLOC(pile,mesh->nt+1,int,0);
+  _MMG5_SAFE_MALLOC(pile,mesh->nt+1,MMG5_int,0);
 
   pile[1] = 1;
   ipil    = 1;
@@ -280,12 +282,91 @@ static int _MMG5_setadj(MMG5_pMesh mesh){
   return(1);
 }
 
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param pvtri pointer toward the array (of size \a np+2) of the position of
+ * the first triangle of each point in \a ptri.
+ * \param ptri pointer toward the list of the triangles of the points.
+ * \return 1 if success, 0 if fail.
+ *
+ * Build the vertex to triangle incidence: the triangles of the point \a ip
+ * are stored (as \f$3*k+i\f$, with \a i the index of \a ip in the triangle \a
+ * k) from \a tri[vtri[ip]] to \a tri[vtri[ip+1]-1], by increasing index of
+ * triangle. The arrays must be freed with \ref _MMG5_DEL_MEM.
+ *
+ */
+static int _MMG3D_pointTria(MMG5_pMesh mesh,MMG5_int **pvtri,MMG5_int **ptri) {
+  MMG5_pTria   pt;
+  MMG5_int     ip,k,n,*vtri,*tri;
+  char         i;
+
+  n = 0;
+  for (k=1; k<=mesh->nt; k++) {
+    pt = &mesh->tria[k];
+    if ( !MG_EOK(pt) )  continue;
+    n += 3;
+  }
+
+  _MMG5_ADD_MEM(mesh,(mesh->np+2)*sizeof(MMG5_int),"point to triangle table",
+                return(0));
+  _MMG5_SAFE_CALLOC(vtri,mesh->np+2,MMG5_int,0);
+  _MMG5_ADD_MEM(mesh,MG_MAX(1,n)*sizeof(MMG5_int),"point to triangle table",
+                _MMG5_DEL_MEM(mesh,vtri,(mesh->np+2)*sizeof(MMG5_int));
+                return(0));
+  _MMG5_SAFE_MALLOC(tri,MG_MAX(1,n),MMG5_int,0);
+
+  for (k=1; k<=mesh->nt; k++) {
+    pt = &mesh->tria[k];
+    if ( !MG_EOK(pt) )  continue;
+    for (i=0; i<3; i++)
+      vtri[pt->v[i]+1]++;
+  }
+  vtri[1] = 0;
+  for (ip=1; ip<=mesh->np; ip++)
+    vtri[ip+1] += vtri[ip];
+
+  /* fill (vtri[ip] is used as insertion position then shifted back) */
+  for (k=1; k<=mesh->nt; k++) {
+    pt = &mesh->tria[k];
+    if ( !MG_EOK(pt) )  continue;
+    for (i=0; i<3; i++)
+      tri[vtri[pt->v[i]]++] = 3*k+i;
+  }
+  for (ip=mesh->np; ip>0; ip--)
+    vtri[ip+1] = vtri[ip];
+  vtri[1] = 0;
+
+  *pvtri = vtri;
+  *ptri  = tri;
+  return(1);
+}
+
 /** check for ridges: dihedral angle */
 static int _MMG5_setdhd(MMG5_pMesh mesh) {
   MMG5_pTria    pt,pt1;
-  double        n1[3],n2[3],dhd;
-  int          *adja,k,kk,ne,nr;
+  double        *n1,*n2,*nor,dhd;
+  int           ne,nr;
+  MMG5_int     *adja,kk,k;
   char          i,ii,i1,i2;
+#ifdef _OPENMP
+  int           nth;
+#endif
+
+#ifdef _OPENMP
+  nth = MG_MAX(1,mesh->info.nthreads);
+#endif
+
+  /* triangle normals, computed once for the two sides of each edge */
+  _MMG5_ADD_MEM(mesh,3*(mesh->nt+1)*sizeof(double),"triangle normals",
+                return(0));
+  _MMG5_SAFE_MALLOC(nor,3*(mesh->nt+1),double,0);
+
+#pragma omp parallel for num_threads(nth) schedule(static) private(pt)
+  for (k=1; k<=mesh->nt; k++) {
+    pt = &mesh->tria[k];
+    if ( !MG_EOK(pt) )  continue;
+    _MMG5_nortri(mesh,pt,&nor[3*k]);
+  }
 
   ne = nr = 0;
   for (k=1; k<=mesh->nt; k++) {
@@ -293,7 +374,7 @@ static int _MMG5_setdhd(MMG5_pMesh mesh) {
     if ( !MG_EOK(pt) )  continue;
 
     /* triangle normal */
-    _MMG5_nortri(mesh,pt,n1);
+    n1   = &nor[3*k];
     adja = &mesh->adjt[3*(k-1)+1];
     for (i=0; i<3; i++) {
       kk  = adja[i] / 3;
@@ -319,7 +400,7 @@ static int _MMG5_setdhd(MMG5_pMesh mesh) {
           ne++;
         }
         /* check angle w. neighbor */
-        _MMG5_nortri(mesh,pt1,n2);
+        n2  = &nor[3*kk];
         dhd = n1[0]*n2[0] + n1[1]*n2[1] + n1[2]*n2[2];
         if ( dhd <= mesh->info.dhd ) {
           pt->tag[i]   |= MG_GEO;
@@ -333,244 +414,307 @@ static int _MMG5_setdhd(MMG5_pMesh mesh) {
       }
     }
   }
+  _MMG5_DEL_MEM(mesh,nor,3*(mesh->nt+1)*sizeof(double));
+
   if ( abs(mesh->info.imprim) > 3 && nr > 0 )
     fprintf(stdout,"     %d ridges, %d edges updated\n",nr,ne);
 
   return(1);
 }
 
-/** check for singularities */
-static int _MMG5_singul(MMG5_pMesh mesh) {
-  MMG5_pTria     pt;
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param ip index of the point.
+ * \param tri list of the triangles of the point (see \ref _MMG3D_pointTria).
+ * \param l0 position of the first triangle of \a ip in \a tri.
+ * \param l1 position following the last triangle of \a ip in \a tri.
+ * \param nc pointer toward the number of corners.
+ * \param nre pointer toward the number of singular points.
+ *
+ * Check for singularity at point \a ip. The ball of the point is walked from
+ * each of its triangles until the point becomes a corner, as in a loop over
+ * the triangles of the mesh.
+ *
+ */
+static inline
+void _MMG5_singul(MMG5_pMesh mesh,MMG5_int ip,MMG5_int *tri,MMG5_int l0,
+                  MMG5_int l1,int *nc,int *nre) {
   MMG5_pPoint    ppt,p1,p2;
   double         ux,uy,uz,vx,vy,vz,dd;
-  int            list[MMG3D_LMAX+2],listref[MMG3D_LMAX+2],k,nc,xp,nr,ns,nre;
-  char           i;
-
-  nre = nc = 0;
-  for (k=1; k<=mesh->nt; k++) {
-    pt = &mesh->tria[k];
-    if ( !MG_EOK(pt) )  continue;
-
-    for (i=0; i<3; i++) {
-      ppt = &mesh->point[pt->v[i]];
-      if ( !MG_VOK(ppt) || ( ppt->tag & MG_CRN ) || ( ppt->tag & MG_NOM ) )
-        continue;
-      else if ( MG_EDG(ppt->tag) ) {
-        ns = _MMG5_bouler(mesh,mesh->adjt,k,i,list,listref,&xp,&nr,MMG3D_LMAX);
-
-        if ( !ns )  continue;
-        if ( (xp+nr) > 2 ) {
-          ppt->tag |= MG_CRN + MG_REQ;
-          ppt->tag &= ~MG_NOSURF;
-          nre++;
-          nc++;
-        }
-        else if ( (xp == 1) && (nr == 1) ) {
-          ppt->tag |= MG_REQ;
-          ppt->tag &= ~MG_NOSURF;
-          nre++;
-        }
-        else if ( xp == 1 && !nr ){
-          ppt->tag |= MG_CRN + MG_REQ;
-          ppt->tag &= ~MG_NOSURF;
-          nre++;
-          nc++;
-        }
-        else if ( nr == 1 && !xp ){
-          ppt->tag |= MG_CRN + MG_REQ;
-          ppt->tag &= ~MG_NOSURF;
-          nre++;
-          nc++;
-        }
-        /* check ridge angle */
-        else {
-          p1 = &mesh->point[list[1]];
-          p2 = &mesh->point[list[2]];
-          ux = p1->c[0] - ppt->c[0];
-          uy = p1->c[1] - ppt->c[1];
-          uz = p1->c[2] - ppt->c[2];
-          vx = p2->c[0] - ppt->c[0];
-          vy = p2->c[1] - ppt->c[1];
-          vz = p2->c[2] - ppt->c[2];
-          dd = (ux*ux + uy*uy + uz*uz) * (vx*vx + vy*vy + vz*vz);
-          if ( fabs(dd) > _MMG5_EPSD ) {
-            dd = (ux*vx + uy*vy + uz*vz) / sqrt(dd);
-            if ( dd > -mesh->info.dhd ) {
-              ppt->tag |= MG_CRN;
-              nc++;
-            }
-          }
+  int            listref[MMG3D_LMAX+2],xp,nr,ns;
+  MMG5_int       list[MMG3D_LMAX+2],l;
+
+  ppt = &mesh->point[ip];
+  for (l=l0; l<l1; l++) {
+    if ( !MG_VOK(ppt) || ( ppt->tag & MG_CRN ) || ( ppt->tag & MG_NOM ) )
+      return;
+    else if ( !MG_EDG(ppt->tag) )
+      return;
+
+    ns = _MMG5_bouler(mesh,mesh->adjt,tri[l]/3,tri[l]%3,list,listref,&xp,&nr,
+                      MMG3D_LMAX);
+
+    if ( !ns )  continue;
+    if ( (xp+nr) > 2 ) {
+      ppt->tag |= MG_CRN + MG_REQ;
+      ppt->tag &= ~MG_NOSURF;
+      (*nre)++;
+      (*nc)++;
+    }
+    else if ( (xp == 1) && (nr == 1) ) {
+      ppt->tag |= MG_REQ;
+      ppt->tag &= ~MG_NOSURF;
+      (*nre)++;
+    }
+    else if ( xp == 1 && !nr ){
+      ppt->tag |= MG_CRN + MG_REQ;
+      ppt->tag &= ~MG_NOSURF;
+      (*nre)++;
+      (*nc)++;
+    }
+    else if ( nr == 1 && !xp ){
+      ppt->tag |= MG_CRN + MG_REQ;
+      ppt->tag &= ~MG_NOSURF;
+      (*nre)++;
+      (*nc)++;
+    }
+    /* check ridge angle */
+    else {
+      p1 = &mesh->point[list[1]];
+      p2 = &mesh->point[list[2]];
+      ux = p1->c[0] - ppt->c[0];
+      uy = p1->c[1] - ppt->c[1];
+      uz = p1->c[2] - ppt->c[2];
+      vx = p2->c[0] - ppt->c[0];
+      vy = p2->c[1] - ppt->c[1];
+      vz = p2->c[2] - ppt->c[2];
+      dd = (ux*ux + uy*uy + uz*uz) * (vx*vx + vy*vy + vz*vz);
+      if ( fabs(dd) > _MMG5_EPSD ) {
+        dd = (ux*vx + uy*vy + uz*vz) / sqrt(dd);
+        if ( dd > -mesh->info.dhd ) {
+          ppt->tag |= MG_CRN;
+          (*nc)++;
         }
       }
     }
   }
-
-  if ( abs(mesh->info.imprim) > 3 && nre > 0 )
-    fprintf(stdout,"     %d corners, %d singular points detected\n",nc,nre);
-  return(1);
 }
 
-/** compute normals at C1 vertices, for C0: tangents */
-static int _MMG5_norver(MMG5_pMesh mesh) {
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param ip index of the point.
+ * \param tri list of the triangles of the point (see \ref _MMG3D_pointTria).
+ * \param l0 position of the first triangle of \a ip in \a tri.
+ * \param l1 position following the last triangle of \a ip in \a tri.
+ * \param base value of the flag of the treated points.
+ * \param nn pointer toward the number of computed normals.
+ * \param nt pointer toward the number of computed tangents.
+ * \param nf pointer toward the number of failures.
+ * \return 1 if the normals of the point have been stored in the xpoint \a
+ * ppt->xp, 0 otherwise.
+ *
+ * Compute the normal at a C1 point, for a C0 point: normals and tangent. The
+ * triangles of the point are tried in increasing order until the computation
+ * succeeds.
+ *
+ */
+static inline
+int _MMG5_norver(MMG5_pMesh mesh,MMG5_int ip,MMG5_int *tri,MMG5_int l0,
+                 MMG5_int l1,int base,MMG5_int *nn,MMG5_int *nt,MMG5_int *nf) {
   MMG5_pTria     pt;
   MMG5_pPoint    ppt;
   MMG5_xPoint    *pxp;
   double         n[3],dd;
-  int            *adja,k,kk,ng,nn,nt,nf,nnr;
+  MMG5_int       k,kk,l;
+  MMG5_int       *adja;
+  int            ier;
   char           i,ii,i1;
 
+  ppt = &mesh->point[ip];
+  pxp = &mesh->xpoint[ppt->xp];
+  ier = 0;
+  for (l=l0; l<l1; l++) {
+    if ( ppt->tag & MG_CRN || ppt->tag & MG_NOM || ppt->flag == base )  break;
+
+    k    = tri[l] / 3;
+    i    = tri[l] % 3;
+    pt   = &mesh->tria[k];
+    adja = &mesh->adjt[3*(k-1)+1];
+
+    /* C1 point */
+    if ( !MG_EDG(ppt->tag) ) {
+
+      if ( (!mesh->nc1) ||
+           ppt->n[0]*ppt->n[0]+ppt->n[1]*ppt->n[1]+ppt->n[2]*ppt->n[2]<=_MMG5_EPSD2 ) {
+        if ( !_MMG5_boulen(mesh,mesh->adjt,k,i,ppt->n) ) {
+          ++(*nf);
+          continue;
+        }
+        else ++(*nn);
+      }
+
+      ier = 1;
+      memcpy(pxp->n1,ppt->n,3*sizeof(double));
+      memset(pxp->n2,0,3*sizeof(double));
+      ppt->n[0] = ppt->n[1] = ppt->n[2] = 0.;
+      ppt->flag = base;
+
+    }
+
+    /* along ridge-curve */
+    i1  = _MMG5_inxt2[i];
+    if ( !MG_EDG(pt->tag[i1]) )  continue;
+    else if ( !_MMG5_boulen(mesh,mesh->adjt,k,i,n) ) {
+      ++(*nf);
+      continue;
+    }
+    ier = 1;
+    memcpy(pxp->n1,n,3*sizeof(double));
+    memset(pxp->n2,0,3*sizeof(double));
+
+    if ( pt->tag[i1] & MG_GEO && adja[i1] > 0 ) {
+      kk = adja[i1] / 3;
+      ii = adja[i1] % 3;
+      ii = _MMG5_inxt2[ii];
+      if ( !_MMG5_boulen(mesh,mesh->adjt,kk,ii,n) ) {
+        ++(*nf);
+        continue;
+      }
+      memcpy(pxp->n2,n,3*sizeof(double));
+
+      /* compute tangent as intersection of n1 + n2 */
+      ppt->n[0] = pxp->n1[1]*pxp->n2[2] - pxp->n1[2]*pxp->n2[1];
+      ppt->n[1] = pxp->n1[2]*pxp->n2[0] - pxp->n1[0]*pxp->n2[2];
+      ppt->n[2] = pxp->n1[0]*pxp->n2[1] - pxp->n1[1]*pxp->n2[0];
+      dd = ppt->n[0]*ppt->n[0] + ppt->n[1]*ppt->n[1] + ppt->n[2]*ppt->n[2];
+      if ( dd > _MMG5_EPSD2 ) {
+        dd = 1.0 / sqrt(dd);
+        ppt->n[0] *= dd;
+        ppt->n[1] *= dd;
+        ppt->n[2] *= dd;
+      }
+      ppt->flag = base;
+      ++(*nt);
+      continue;
+    }
+
+    /* compute tgte */
+    ppt->flag = base;
+    ++(*nt);
+    if ( !_MMG5_boulec(mesh,mesh->adjt,k,i,ppt->n) ) {
+      ++(*nf);
+      continue;
+    }
+    dd = pxp->n1[0]*ppt->n[0] + pxp->n1[1]*ppt->n[1] + pxp->n1[2]*ppt->n[2];
+    ppt->n[0] -= dd*pxp->n1[0];
+    ppt->n[1] -= dd*pxp->n1[1];
+    ppt->n[2] -= dd*pxp->n1[2];
+    dd = ppt->n[0]*ppt->n[0] + ppt->n[1]*ppt->n[1] + ppt->n[2]*ppt->n[2];
+    if ( dd > _MMG5_EPSD2 ) {
+      dd = 1.0 / sqrt(dd);
+      ppt->n[0] *= dd;
+      ppt->n[1] *= dd;
+      ppt->n[2] *= dd;
+    }
+  }
+  return(ier);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \return 0 if fail, 1 otherwise.
+ *
+ * Check for singularities then compute normals at C1 vertices, for C0:
+ * tangents. Both steps only depend on the ball of each point, so they are
+ * done in a single (parallel) loop over the points of the surface, using the
+ * vertex to triangle incidence. The xpoint of a point is its rank among the
+ * surface points.
+ *
+ */
+static int _MMG5_singnor(MMG5_pMesh mesh) {
+  MMG5_pPoint    ppt;
+  MMG5_int       ip,*vtri,*tri,nn,nt,nf,nnr;
+  int            nc,nre,base;
+  char           nor;
+#ifdef _OPENMP
+  int            nth;
+#endif
+
+#ifdef _OPENMP
+  nth = MG_MAX(1,mesh->info.nthreads);
+#endif
+
+  if ( !_MMG3D_pointTria(mesh,&vtri,&tri) )  return(0);
+
   /* recomputation of normals only if mesh->xpoint has been freed */
+  nor = 1;
   if ( mesh->xpoint ) {
     if ( abs(mesh->info.imprim) > 3 || mesh->info.ddebug ) {
       fprintf(stdout,"  ## Warning: %s: no research of boundary points"
               " and normals of mesh. mesh->xpoint must be freed to enforce"
               " analysis.\n",__func__);
     }
-    return(1);
+    nor = 0;
   }
+  else {
+    /* identify boundary points */
+    ++mesh->base;
+    mesh->xp = 0;
+    for (ip=1; ip<=mesh->np; ip++) {
+      if ( vtri[ip+1] == vtri[ip] )  continue;
+      ppt = &mesh->point[ip];
+      ppt->flag = mesh->base;
+      ppt->xp   = ++mesh->xp;
+    }
 
-  /* identify boundary points */
-  ++mesh->base;
-  mesh->xp = 0;
-  nnr      = 0;
-  for (k=1; k<=mesh->nt; k++) {
-    pt = &mesh->tria[k];
-    if ( !MG_EOK(pt) )  continue;
+    /* memory to store normals for boundary points */
+    mesh->xpmax  = MG_MAX( (long long)(1.5*mesh->xp),mesh->npmax);
 
-    for (i=0; i<3; i++) {
-      ppt = &mesh->point[pt->v[i]];
-      if ( ppt->flag == mesh->base )  continue;
-      else {
-        ++mesh->xp;
-        ppt->flag = mesh->base;
-        if ( mesh->nc1 ) {
-          if ( ppt->n[0]*ppt->n[0] + ppt->n[1]*ppt->n[1] + ppt->n[2]*ppt->n[2] > 0 ) {
-            if ( ppt->tag & MG_CRN || ppt->tag & MG_NOM || MG_EDG(ppt->tag) ) {
-              ++nnr;
-              continue;
-            }
-            ppt->xp = -1;
-          }
-        }
-      }
-    }
+    _MMG5_ADD_MEM(mesh,(mesh->xpmax+1)*sizeof(MMG5_xPoint),"boundary points",
+                  _MMG5_DEL_MEM(mesh,tri,MG_MAX(1,vtri[mesh->np+1])*sizeof(MMG5_int));
+                  _MMG5_DEL_MEM(mesh,vtri,(mesh->np+2)*sizeof(MMG5_int));
+                  return(0));
+    _MMG5_SAFE_CALLOC(mesh->xpoint,mesh->xpmax+1,MMG5_xPoint,0);
+    ++mesh->base;
   }
 
-  /* memory to store normals for boundary points */
-  mesh->xpmax  = MG_MAX( (long long)(1.5*mesh->xp),mesh->npmax);
+  /* singularities + normals and tangents */
+  base = mesh->base;
+  nc = nre = 0;
+  nn = nt = nf = nnr = 0;
 
-  _MMG5_ADD_MEM(mesh,(mesh->xpmax+1)*sizeof(MMG5_xPoint),"boundary points",return(0));
-  _MMG5_SAFE_CALLOC(mesh->xpoint,mesh->xpmax+1,MMG5_xPoint,0);
+#pragma omp parallel for num_threads(nth) schedule(dynamic,1024) private(ppt) \
+  reduction(+:nc,nre,nn,nt,nf,nnr)
+  for (ip=1; ip<=mesh->np; ip++) {
+    if ( vtri[ip+1] == vtri[ip] )  continue;
 
-  /* compute normals + tangents */
-  nn = ng = nt = nf = 0;
-  mesh->xp = 0;
-  ++mesh->base;
-  for (k=1; k<=mesh->nt; k++) {
-    pt = &mesh->tria[k];
-    if ( !MG_EOK(pt) )  continue;
+    _MMG5_singul(mesh,ip,tri,vtri[ip],vtri[ip+1],&nc,&nre);
 
-    adja = &mesh->adjt[3*(k-1)+1];
-    for (i=0; i<3; i++) {
-      ppt = &mesh->point[pt->v[i]];
-      if ( ppt->tag & MG_CRN || ppt->tag & MG_NOM || ppt->flag == mesh->base )  continue;
+    if ( !nor )  continue;
 
-      /* C1 point */
-      if ( !MG_EDG(ppt->tag) ) {
+    ppt = &mesh->point[ip];
+    if ( mesh->nc1 && ( ppt->tag & MG_CRN || ppt->tag & MG_NOM || MG_EDG(ppt->tag) )
+         && ppt->n[0]*ppt->n[0] + ppt->n[1]*ppt->n[1] + ppt->n[2]*ppt->n[2] > 0 )
+      ++nnr;
 
-        if ( (!mesh->nc1) ||
-             ppt->n[0]*ppt->n[0]+ppt->n[1]*ppt->n[1]+ppt->n[2]*ppt->n[2]<=_MMG5_EPSD2 ) {
-          if ( !_MMG5_boulen(mesh,mesh->adjt,k,i,ppt->n) ) {
-            ++nf;
-            continue;
-          }
-          else ++nn;
-        }
+    if ( !_MMG5_norver(mesh,ip,tri,vtri[ip],vtri[ip+1],base,&nn,&nt,&nf) )
+      ppt->xp = 0;
+  }
 
-        ++mesh->xp;
-        if(mesh->xp > mesh->xpmax){
-          _MMG5_TAB_RECALLOC(mesh,mesh->xpoint,mesh->xpmax,0.2,MMG5_xPoint,
-                             "larger xpoint table",
-                             mesh->xp--;return(0);,0);
-        }
-        ppt->xp = mesh->xp;
-        pxp = &mesh->xpoint[ppt->xp];
-        memcpy(pxp->n1,ppt->n,3*sizeof(double));
-        ppt->n[0] = ppt->n[1] = ppt->n[2] = 0.;
-        ppt->flag = mesh->base;
+  _MMG5_DEL_MEM(mesh,tri,MG_MAX(1,vtri[mesh->np+1])*sizeof(MMG5_int));
+  _MMG5_DEL_MEM(mesh,vtri,(mesh->np+2)*sizeof(MMG5_int));
 
-      }
+  if ( abs(mesh->info.imprim) > 3 && nre > 0 )
+    fprintf(stdout,"     %d corners, %d singular points detected\n",nc,nre);
 
-      /* along ridge-curve */
-      i1  = _MMG5_inxt2[i];
-      if ( !MG_EDG(pt->tag[i1]) )  continue;
-      else if ( !_MMG5_boulen(mesh,mesh->adjt,k,i,n) ) {
-        ++nf;
-        continue;
-      }
-      ++mesh->xp;
-      if(mesh->xp > mesh->xpmax){
-        _MMG5_TAB_RECALLOC(mesh,mesh->xpoint,mesh->xpmax,0.2,MMG5_xPoint,
-                           "larger xpoint table",
-                           mesh->xp--;return 0;,0);
-      }
-      ppt->xp = mesh->xp;
-      pxp = &mesh->xpoint[ppt->xp];
-      memcpy(pxp->n1,n,3*sizeof(double));
-
-      if ( pt->tag[i1] & MG_GEO && adja[i1] > 0 ) {
-        kk = adja[i1] / 3;
-        ii = adja[i1] % 3;
-        ii = _MMG5_inxt2[ii];
-        if ( !_MMG5_boulen(mesh,mesh->adjt,kk,ii,n) ) {
-          ++nf;
-          continue;
-        }
-        memcpy(pxp->n2,n,3*sizeof(double));
-
-        /* compute tangent as intersection of n1 + n2 */
-        ppt->n[0] = pxp->n1[1]*pxp->n2[2] - pxp->n1[2]*pxp->n2[1];
-        ppt->n[1] = pxp->n1[2]*pxp->n2[0] - pxp->n1[0]*pxp->n2[2];
-        ppt->n[2] = pxp->n1[0]*pxp->n2[1] - pxp->n1[1]*pxp->n2[0];
-        dd = ppt->n[0]*ppt->n[0] + ppt->n[1]*ppt->n[1] + ppt->n[2]*ppt->n[2];
-        if ( dd > _MMG5_EPSD2 ) {
-          dd = 1.0 / sqrt(dd);
-          ppt->n[0] *= dd;
-          ppt->n[1] *= dd;
-          ppt->n[2] *= dd;
-        }
-        ppt->flag = mesh->base;
-        ++nt;
-        continue;
-      }
+  if ( !nor )  return(1);
 
-      /* compute tgte */
-      ppt->flag = mesh->base;
-      ++nt;
-      if ( !_MMG5_boulec(mesh,mesh->adjt,k,i,ppt->n) ) {
-        ++nf;
-        continue;
-      }
-      dd = pxp->n1[0]*ppt->n[0] + pxp->n1[1]*ppt->n[1] + pxp->n1[2]*ppt->n[2];
-      ppt->n[0] -= dd*pxp->n1[0];
-      ppt->n[1] -= dd*pxp->n1[1];
-      ppt->n[2] -= dd*pxp->n1[2];
-      dd = ppt->n[0]*ppt->n[0] + ppt->n[1]*ppt->n[1] + ppt->n[2]*ppt->n[2];
-      if ( dd > _MMG5_EPSD2 ) {
-        dd = 1.0 / sqrt(dd);
-        ppt->n[0] *= dd;
-        ppt->n[1] *= dd;
-        ppt->n[2] *= dd;
-      }
-    }
-  }
   mesh->nc1 = 0;
 
   if ( abs(mesh->info.imprim) > 3 && nn+nt > 0 ) {
     if ( nnr )
-      fprintf(stdout,"     %d input normals ignored\n",nnr);
-    fprintf(stdout,"     %d normals,  %d tangents updated  (%d failed)\n",nn,nt,nf);
+      fprintf(stdout,"     %" MMG5_PRId " input normals ignored\n",nnr);
+    fprintf(stdout,"     %" MMG5_PRId " normals,  %" MMG5_PRId " tangents updated  (%" MMG5_PRId " failed)\n",nn,nt,nf);
   }
   return(1);
 }
@@ -588,12 +732,18 @@ static int _MMG3D_nmgeom(MMG5_pMesh mesh){
   MMG5_pTetra     pt;
   MMG5_pPoint     p0;
   MMG5_pxPoint    pxp;
-  int        k,base;
-  int        *adja;
+  int        base;
+  MMG5_int   *adja,k;
   double     n[3],t[3];
   char       i,j,ip,ier;
 
   base = ++mesh->base;
+
+  /* nothing to do for a manifold surface */
+  for (k=1; k<=mesh->np; k++)
+    if ( mesh->point[k].tag & MG_NOM )  break;
+  if ( k > mesh->np )  return(1);
+
   for (k=1; k<=mesh->ne; k++) {
     pt   = &mesh->tetra[k];
     adja = &mesh->adja[4*(k-1)+1];
@@ -685,7 +835,7 @@ int _MMG3D_analys(MMG5_pMesh mesh) {
 
   /* create surface adjacency */
   if ( !_MMG3D_hashTria(mesh,&hash) ) {
-    _MMG5_DEL_MEM(mesh,hash.item,(hash.max+1)*sizeof(_MMG5_hedge));
+    _MMG5_DEL_MEM(mesh,hash.item,hash.siz*sizeof(_MMG5_hedge));
     fprintf(stderr,"\n  ## Hashing problem (2). Exit program.\n");
     return(0);
   }
@@ -693,7 +843,7 @@ int _MMG3D_analys(MMG5_pMesh mesh) {
   /* build hash table for geometric edges */
   if ( !_MMG5_hGeom(mesh) ) {
     fprintf(stderr,"\n  ## Hashing problem (0). Exit program.\n");
-    _MMG5_DEL_MEM(mesh,hash.item,(hash.max+1)*sizeof(_MMG5_hedge));
+    _MMG5_DEL_MEM(mesh,hash.item,hash.siz*sizeof(_MMG5_hedge));
     _MMG5_DEL_MEM(mesh,mesh->htab.geom,(mesh->htab.max+1)*sizeof(MMG5_hgeom));
     return(0);
   }
@@ -705,38 +855,31 @@ int _MMG3D_analys(MMG5_pMesh mesh) {
   /* identify connexity */
   if ( !_MMG5_setadj(mesh) ) {
     fprintf(stderr,"\n  ## Topology problem. Exit program.\n");
-    _MMG5_DEL_MEM(mesh,hash.item,(hash.max+1)*sizeof(_MMG5_hedge));
+    _MMG5_DEL_MEM(mesh,hash.item,hash.siz*sizeof(_MMG5_hedge));
     return(0);
   }
 
   /* check for ridges */
   if ( mesh->info.dhd > _MMG5_ANGLIM && !_MMG5_setdhd(mesh) ) {
     fprintf(stderr,"\n  ## Geometry problem. Exit program.\n");
-    _MMG5_DEL_MEM(mesh,hash.item,(hash.max+1)*sizeof(_MMG5_hedge));
-    return(0);
-  }
-
-  /* identify singularities */
-  if ( !_MMG5_singul(mesh) ) {
-    fprintf(stderr,"\n  ## MMG5_Singularity problem. Exit program.\n");
-    _MMG5_DEL_MEM(mesh,hash.item,(hash.max+1)*sizeof(_MMG5_hedge));
+    _MMG5_DEL_MEM(mesh,hash.item,hash.siz*sizeof(_MMG5_hedge));
     return(0);
   }
 
   if ( abs(mesh->info.imprim) > 3 || mesh->info.ddebug )
     fprintf(stdout,"  ** DEFINING GEOMETRY\n");
 
-  /* define (and regularize) normals */
-  if ( !_MMG5_norver(mesh) ) {
-    fprintf(stderr,"\n  ## Normal problem. Exit program.\n");
-    _MMG5_DEL_MEM(mesh,hash.item,(hash.max+1)*sizeof(_MMG5_hedge));
+  /* identify singularities and define (and regularize) normals */
+  if ( !_MMG5_singnor(mesh) ) {
+    fprintf(stderr,"\n  ## Singularity or normal problem. Exit program.\n");
+    _MMG5_DEL_MEM(mesh,hash.item,hash.siz*sizeof(_MMG5_hedge));
     return(0);
   }
 
   /* set bdry entities to tetra */
   if ( !_MMG5_bdrySet(mesh) ) {
     fprintf(stderr,"\n  ## Boundary problem. Exit program.\n");
-    _MMG5_DEL_MEM(mesh,hash.item,(hash.max+1)*sizeof(_MMG5_hedge));
+    _MMG5_DEL_MEM(mesh,hash.item,hash.siz*sizeof(_MMG5_hedge));
     _MMG5_DEL_MEM(mesh,mesh->xpoint,(mesh->xpmax+1)*sizeof(MMG5_xPoint));
     return(0);
   }
@@ -747,7 +890,7 @@ int _MMG3D_analys(MMG5_pMesh mesh) {
 
   if ( !_MMG5_setNmTag(mesh,&hash) ) {
     fprintf(stderr,"\n  ## Non-manifold topology problem. Exit program.\n");
-    _MMG5_DEL_MEM(mesh,hash.item,(hash.max+1)*sizeof(_MMG5_hedge));
+    _MMG5_DEL_MEM(mesh,hash.item,hash.siz*sizeof(_MMG5_hedge));
     _MMG5_DEL_MEM(mesh,mesh->xpoint,(mesh->xpmax+1)*sizeof(MMG5_xPoint));
     return(0);
   }
@@ -772,11 +915,11 @@ int _MMG3D_analys(MMG5_pMesh mesh) {
 
   /* release memory */
   _MMG5_DEL_MEM(mesh,mesh->htab.geom,(mesh->htab.max+1)*sizeof(MMG5_hgeom));
-  _MMG5_DEL_MEM(mesh,mesh->adjt,(3*mesh->nt+4)*sizeof(int));
+  _MMG5_DEL_MEM(mesh,mesh->adjt,(3*mesh->nt+4)*sizeof(MMG5_int));
   _MMG5_DEL_MEM(mesh,mesh->tria,(mesh->nt+1)*sizeof(MMG5_Tria));
   mesh->nt = 0;
 
-  if ( mesh->nprism ) _MMG5_DEL_MEM(mesh,mesh->adjapr,(5*mesh->nprism+6)*sizeof(int));
+  if ( mesh->nprism ) _MMG5_DEL_MEM(mesh,mesh->adjapr,(5*mesh->nprism+6)*sizeof(MMG5_int));
 
   return(1);
 }
@@ -52,29 +52,21 @@
  * \remark we don't check if we break the hausdorff criterion.
  *
  */
-int _MMG5_movintpt_ani(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree, int *list,int ilist,
+int _MMG5_movintpt_ani(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree, MMG5_int *list,int ilist,
                        int improve) {
 
 
-  MMG5_pTetra          pt,pt0;
-  MMG5_pPoint          p0,p1,p2,p3,ppt0;
-  double               vol,totvol,m[6];
+  MMG5_pTetra          pt;
+  MMG5_pPoint          p0,p1,p2,p3,ppt;
+  double               vol,totvol,m[6],c[3],oldc[3];
   double               calold,calnew,*callist,det;
-  int                  k,iel,i0;
+  int                  k;
+  MMG5_int             iel,i0;
   // Dynamic alloc for windows comptibility
   _MMG5_SAFE_MALLOC(callist, ilist, double,0);
 
-  pt0    = &mesh->tetra[0];
-  ppt0   = &mesh->point[0];
-  memset(ppt0,0,sizeof(MMG5_Point));
-
-  if ( met->m ) {
-    iel = list[0] / 4;
-    i0  = list[0] % 4;
-    memcpy(&met->m[0],&met->m[met->size*mesh->tetra[iel].v[i0]],met->size*sizeof(double));
-  }
-
   /* Coordinates of optimal point */
+  c[0] = c[1] = c[2] = 0.;
   calold = DBL_MAX;
   totvol = 0.0;
   for (k=0; k<ilist; k++) {
@@ -104,9 +96,9 @@ int _MMG5_movintpt_ani(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree, int
 
     totvol += vol;
     /* barycenter */
-    ppt0->c[0] += 0.25 * vol*(p0->c[0] + p1->c[0] + p2->c[0] + p3->c[0]);
-    ppt0->c[1] += 0.25 * vol*(p0->c[1] + p1->c[1] + p2->c[1] + p3->c[1]);
-    ppt0->c[2] += 0.25 * vol*(p0->c[2] + p1->c[2] + p2->c[2] + p3->c[2]);
+    c[0] += 0.25 * vol*(p0->c[0] + p1->c[0] + p2->c[0] + p3->c[0]);
+    c[1] += 0.25 * vol*(p0->c[1] + p1->c[1] + p2->c[1] + p3->c[1]);
+    c[2] += 0.25 * vol*(p0->c[2] + p1->c[2] + p2->c[2] + p3->c[2]);
     calold = MG_MIN(calold, pt->qual);
   }
   if (totvol < _MMG5_EPSD2) {
@@ -115,25 +107,30 @@ int _MMG5_movintpt_ani(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree, int
   }
 
   totvol = 1.0 / totvol;
-  ppt0->c[0] *= totvol;
-  ppt0->c[1] *= totvol;
-  ppt0->c[2] *= totvol;
-
-  /* Check new position validity */
+  c[0] *= totvol;
+  c[1] *= totvol;
+  c[2] *= totvol;
+
+  /* Check new position validity: the point is moved in place (and restored)
+   * so only its ball is read and written */
+  ppt = &mesh->point[mesh->tetra[list[0]/4].v[list[0]%4]];
+  memcpy(oldc,ppt->c,3*sizeof(double));
+  memcpy(ppt->c,c,3*sizeof(double));
   calnew = DBL_MAX;
   for (k=0; k<ilist; k++) {
     iel = list[k] / 4;
     i0  = list[k] % 4;
     pt  = &mesh->tetra[iel];
-    memcpy(pt0,pt,sizeof(MMG5_Tetra));
-    pt0->v[i0] = 0;
-    callist[k] = _MMG5_orcal(mesh,met,0);
+    callist[k] = mesh->func.caltet(mesh,met,pt);
     if (callist[k] < _MMG5_NULKAL) {
+      memcpy(ppt->c,oldc,3*sizeof(double));
       _MMG5_SAFE_FREE(callist);
       return(0);
     }
     calnew = MG_MIN(calnew,callist[k]);
   }
+  memcpy(ppt->c,oldc,3*sizeof(double));
+
   if (calold < _MMG5_EPSOK && calnew <= calold) {
     _MMG5_SAFE_FREE(callist);
     return(0);
@@ -153,12 +150,11 @@ int _MMG5_movintpt_ani(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree, int
 
   /* update position */
   if ( octree )
-    _MMG3D_moveOctree(mesh, octree, pt->v[i0], ppt0->c, p0->c);
+    _MMG3D_moveOctree(mesh, octree, pt->v[i0], c, p0->c);
 
-  p0 = &mesh->point[pt->v[i0]];
-  p0->c[0] = ppt0->c[0];
-  p0->c[1] = ppt0->c[1];
-  p0->c[2] = ppt0->c[2];
+  ppt->c[0] = c[0];
+  ppt->c[1] = c[1];
+  ppt->c[2] = c[2];
   for (k=0; k<ilist; k++) {
     (&mesh->tetra[list[k]/4])->qual=callist[k];
     (&mesh->tetra[list[k]/4])->mark=mesh->mark;
@@ -187,8 +183,8 @@ int _MMG5_movintpt_ani(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree, int
  * Move boundary regular point, whose volumic and surfacic balls are passed.
  *
  */
-int _MMG5_movbdyregpt_ani(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree, int *listv,
-                          int ilistv,int *lists,int ilists,
+int _MMG5_movbdyregpt_ani(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree, MMG5_int *listv,
+                          int ilistv,MMG5_int *lists,int ilists,
                           int improveSurf, int improveVol) {
   MMG5_pTetra       pt,pt0;
   MMG5_pxTetra      pxt;
@@ -200,9 +196,10 @@ int _MMG5_movbdyregpt_ani(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree,
   double            detloc,gv[2],step,lambda[3];
   double            uv[2],o[3],no[3],to[3],*m0,ncur[3],nprev[3],nneighi[3];
   double            calold,calnew,caltmp,*callist;
-  int               k,kel,iel,l,n0,na,nb,ntempa,ntempb,ntempc,nxp,ier;
+  int               l,ier;
+  MMG5_int          n0,na,nb,ntempa,ntempb,ntempc,nxp,k,iel,kel;
   unsigned char     i0,iface,i;
-  static int        warn = 0;
+  static _MMG5_TLS int        warn = 0;
 
   // Dynamic alloc for windows comptibility
   _MMG5_SAFE_MALLOC(callist, ilistv, double,0);
@@ -343,7 +340,7 @@ int _MMG5_movbdyregpt_ani(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree,
 
     _MMG5_tet2tri(mesh,iel,iface,&tt);
 
-    if(!_MMG5_bezierCP(mesh,&tt,&pb,MG_GET(pxt->ori,iface))){
+    if(!mesh->func.bezierCP(mesh,&tt,&pb,MG_GET(pxt->ori,iface))){
       _MMG5_SAFE_FREE(callist);
       return(0);
     }
@@ -431,7 +428,7 @@ int _MMG5_movbdyregpt_ani(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree,
 
   _MMG5_tet2tri(mesh,iel,iface,&tt);
 
-  if(!_MMG5_bezierCP(mesh,&tt,&pb,MG_GET(pxt->ori,iface))){
+  if(!mesh->func.bezierCP(mesh,&tt,&pb,MG_GET(pxt->ori,iface))){
     _MMG5_SAFE_FREE(callist);
     return(0);
   }
@@ -552,14 +549,14 @@ int _MMG5_movbdyregpt_ani(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree,
     iface = lists[l] % 4;
 
     _MMG5_tet2tri(mesh,k,iface,&tt);
-    calold = MG_MIN(calold,_MMG5_caltri(mesh,met,&tt));
+    calold = MG_MIN(calold,mesh->func.caltri(mesh,met,&tt));
 
     for( i=0 ; i<3 ; i++ )
       if ( tt.v[i] == n0 )      break;
     assert(i<3);
     tt.v[i] = 0;
 
-    caltmp = _MMG5_caltri(mesh,met,&tt);
+    caltmp = mesh->func.caltri(mesh,met,&tt);
     if ( caltmp < _MMG5_EPSD2 ) {
       /* We don't check the input triangle qualities, thus we may have a very
        * bad triangle in our mesh */
@@ -688,8 +685,8 @@ int _MMG5_movbdyregpt_ani(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree,
  * Move boundary reference point, whose volumic and surfacic balls are passed.
  *
  */
-int _MMG5_movbdyrefpt_ani(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree, int *listv,
-                          int ilistv, int *lists, int ilists,
+int _MMG5_movbdyrefpt_ani(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree, MMG5_int *listv,
+                          int ilistv, MMG5_int *lists, int ilists,
                           int improve){
   MMG5_pTetra           pt,pt0;
   MMG5_pPoint           p0,ppt0;
@@ -698,7 +695,8 @@ int _MMG5_movbdyrefpt_ani(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree,
   double                step,ll1old,ll2old,l1new,l2new;
   double                o[3],no[3],to[3], ncur[3],nprev[3],nneighi[3];
   double                calold,calnew,caltmp,*callist;
-  int                   l,iel,ip0,ipa,ipb,iptmpa,iptmpb,ip1,ip2,ip,nxp;
+  int                   l;
+  MMG5_int              ip0,ipa,ipb,iptmpa,iptmpb,nxp,ip1,ip2,ip,iel;
   int16_t               tag,ier;
   unsigned char         i,i0,ie,iface,iea,ieb;
 
@@ -839,8 +837,8 @@ int _MMG5_movbdyrefpt_ani(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree,
      associated edges ie1,ie2.*/
 
   /* Changes needed for choice of time step : see manuscript notes */
-  ll1old = _MMG5_lenSurfEdg(mesh,met,ip0,ip1,0);
-  ll2old = _MMG5_lenSurfEdg(mesh,met,ip0,ip2,0);
+  ll1old = mesh->func.lenSurfEdg(mesh,met,ip0,ip1,0);
+  ll2old = mesh->func.lenSurfEdg(mesh,met,ip0,ip2,0);
 
   if ( (!ll1old) || (!ll2old) ) return 0;
 
@@ -885,8 +883,8 @@ int _MMG5_movbdyrefpt_ani(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree,
     return(0);
 
   /* Check whether proposed move is admissible under consideration of distances */
-  l1new = _MMG5_lenSurfEdg(mesh,met,0,ip1,0);
-  l2new = _MMG5_lenSurfEdg(mesh,met,0,ip2,0);
+  l1new = mesh->func.lenSurfEdg(mesh,met,0,ip1,0);
+  l2new = mesh->func.lenSurfEdg(mesh,met,0,ip2,0);
 
   if ( (!l1new) || (!l2new) ) return 0;
 
@@ -915,7 +913,7 @@ int _MMG5_movbdyrefpt_ani(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree,
     iface       = lists[l] % 4;
 
     _MMG5_tet2tri(mesh,iel,iface,&tt);
-    calold = MG_MIN(calold,_MMG5_caltri(mesh,met,&tt));
+    calold = MG_MIN(calold,mesh->func.caltri(mesh,met,&tt));
 
     for( i=0 ; i<3 ; i++ )
       if ( tt.v[i] == ip0 )      break;
@@ -923,7 +921,7 @@ int _MMG5_movbdyrefpt_ani(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree,
 
     tt.v[i] = 0;
 
-    caltmp = _MMG5_caltri(mesh,met,&tt);
+    caltmp = mesh->func.caltri(mesh,met,&tt);
     if ( caltmp < _MMG5_EPSD2 ) {
       /* We don't check the input triangle qualities, thus we may have a very
        * bad triangle in our mesh */
@@ -1035,8 +1033,8 @@ int _MMG5_movbdyrefpt_ani(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree,
  * \remark we don't check if we break the hausdorff criterion.
  *
  */
-int _MMG5_movbdynompt_ani(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree, int *listv,
-                          int ilistv, int *lists, int ilists,
+int _MMG5_movbdynompt_ani(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree, MMG5_int *listv,
+                          int ilistv, MMG5_int *lists, int ilists,
                           int improve){
   MMG5_pTetra       pt,pt0;
   MMG5_pPoint       p0,ppt0;
@@ -1045,7 +1043,8 @@ int _MMG5_movbdynompt_ani(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree,
   double            step,ll1old,ll2old,l1new,l2new;
   double            calold,calnew,caltmp,*callist;
   double            o[3],no[3],to[3],nprev[3],ncur[3],nneighi[3];
-  int               ip0,ip1,ip2,ip,iel,ipa,ipb,l,iptmpa,iptmpb,nxp;
+  int               l;
+  MMG5_int          ip0,ipa,ipb,iptmpa,iptmpb,nxp,ip1,ip2,ip,iel;
   int16_t           tag,ier;
   char              iface,i,i0,iea,ieb,ie;
 
@@ -1184,8 +1183,8 @@ int _MMG5_movbdynompt_ani(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree,
   /* At this point, we get the point extremities of the non manifold curve passing through ip0 :
      ip1, ip2, along with support tets it1,it2, the surface faces iface1,iface2, and the
      associated edges ie1,ie2.*/
-  ll1old = _MMG5_lenSurfEdg(mesh,met,ip0,ip1,0);
-  ll2old = _MMG5_lenSurfEdg(mesh,met,ip0,ip2,0);
+  ll1old = mesh->func.lenSurfEdg(mesh,met,ip0,ip1,0);
+  ll2old = mesh->func.lenSurfEdg(mesh,met,ip0,ip2,0);
 
   if ( (!ll1old) || (!ll2old) ) return 0;
 
@@ -1229,8 +1228,8 @@ int _MMG5_movbdynompt_ani(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree,
     return(0);
 
   /* Check whether proposed move is admissible under consideration of distances */
-  l1new = _MMG5_lenSurfEdg(mesh,met,0,ip1,0);
-  l2new = _MMG5_lenSurfEdg(mesh,met,0,ip2,0);
+  l1new = mesh->func.lenSurfEdg(mesh,met,0,ip1,0);
+  l2new = mesh->func.lenSurfEdg(mesh,met,0,ip2,0);
 
   if ( (!l1new) || (!l2new) ) return 0;
 
@@ -1260,7 +1259,7 @@ int _MMG5_movbdynompt_ani(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree,
     iface       = lists[l] % 4;
 
     _MMG5_tet2tri(mesh,iel,iface,&tt);
-    caltmp = _MMG5_caltri(mesh,met,&tt);
+    caltmp = mesh->func.caltri(mesh,met,&tt);
     calold = MG_MIN(calold,caltmp);
 
     for( i=0 ; i<3 ; i++ )
@@ -1268,7 +1267,7 @@ int _MMG5_movbdynompt_ani(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree,
     assert(i<3);
 
     tt.v[i] = 0;
-    caltmp = _MMG5_caltri(mesh,met,&tt);
+    caltmp = mesh->func.caltri(mesh,met,&tt);
     if ( caltmp < _MMG5_EPSD2 ) {
       /* We don't check the input triangle qualities, thus we may have a very
        * bad triangle in our mesh */
@@ -1379,8 +1378,8 @@ int _MMG5_movbdynompt_ani(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree,
  * Move boundary ridge point, whose volumic and surfacic balls are passed.
  *
  */
-int _MMG5_movbdyridpt_ani(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree, int *listv,
-                          int ilistv,int *lists,int ilists,
+int _MMG5_movbdyridpt_ani(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree, MMG5_int *listv,
+                          int ilistv,MMG5_int *lists,int ilists,
                           int improve) {
   MMG5_pTetra          pt,pt0;
   MMG5_pPoint          p0,ppt0;
@@ -1389,7 +1388,8 @@ int _MMG5_movbdyridpt_ani(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree,
   double               step,l1old,l2old,l1new,l2new;
   double               o[3],no1[3],no2[3],to[3],nprev[3],ncur[3],nneighi[3];
   double               calold,calnew,caltmp,*callist;
-  int                  l,iel,ip0,ipa,ipb,iptmpa,iptmpb,ip1,ip2,ip,nxp;
+  int                  l;
+  MMG5_int             ip0,ipa,ipb,iptmpa,iptmpb,nxp,ip1,ip2,ip,iel;
   int16_t              tag,ier;
   unsigned char        i,i0,ie,iface,iea,ieb;
 
@@ -1530,8 +1530,8 @@ int _MMG5_movbdyridpt_ani(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree,
      associated edges ie1,ie2.*/
 
   /* Changes needed for choice of time step : see manuscript notes */
-  l1old = _MMG5_lenSurfEdg(mesh,met,ip0,ip1,1);
-  l2old = _MMG5_lenSurfEdg(mesh,met,ip0,ip2,1);
+  l1old = mesh->func.lenSurfEdg(mesh,met,ip0,ip1,1);
+  l2old = mesh->func.lenSurfEdg(mesh,met,ip0,ip2,1);
 
   if ( (!l1old) || (!l2old) ) return 0;
 
@@ -1581,8 +1581,8 @@ int _MMG5_movbdyridpt_ani(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree,
   if ( !_MMG5_intridmet(mesh,met,ip0,ip,step,no1,&met->m[0]) ) return 0;
 
   /* Check whether proposed move is admissible under consideration of distances */
-  l1new = _MMG5_lenSurfEdg(mesh,met,0,ip1,1);
-  l2new = _MMG5_lenSurfEdg(mesh,met,0,ip2,1);
+  l1new = mesh->func.lenSurfEdg(mesh,met,0,ip1,1);
+  l2new = mesh->func.lenSurfEdg(mesh,met,0,ip2,1);
 
   if ( (!l1new) || (!l2new) ) return 0;
 
@@ -1613,7 +1613,7 @@ int _MMG5_movbdyridpt_ani(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree,
     iface       = lists[l] % 4;
 
     _MMG5_tet2tri(mesh,iel,iface,&tt);
-    calold = MG_MIN(calold,_MMG5_caltri(mesh,met,&tt));
+    calold = MG_MIN(calold,mesh->func.caltri(mesh,met,&tt));
 
     for (i=0; i<3; i++) {
       if ( tt.v[i] == ip0 )      break;
@@ -1622,7 +1622,7 @@ int _MMG5_movbdyridpt_ani(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree,
 
     tt.v[i] = 0;
 
-    caltmp = _MMG5_caltri(mesh,met,&tt);
+    caltmp = mesh->func.caltri(mesh,met,&tt);
     if ( caltmp < _MMG5_EPSD2 ) {
       /* We don't check the input triangle qualities, thus we may have a very
        * bad triangle in our mesh */
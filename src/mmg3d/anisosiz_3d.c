@@ -71,7 +71,7 @@ inline int _MMG5_moymet(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTetra pt,double *m1)
   double       mm[6],*mp;
   double       dd;
   int          i,k,n;
-  static char  mmgWarn=0;
+  static _MMG5_TLS char  mmgWarn=0;
 
   n = 0;
   for (k=0; k<6; ++k) mm[k] = 0.;
@@ -112,7 +112,7 @@ inline int _MMG5_moymet(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTetra pt,double *m1)
  * size.
  *
  */
-static int _MMG5_defmetsin(MMG5_pMesh mesh,MMG5_pSol met,int kel, int iface, int ip) {
+static int _MMG5_defmetsin(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int kel, int iface, int ip) {
   MMG5_pTetra        pt;
   MMG5_pxTetra       pxt;
   MMG5_pPoint        p0;
@@ -120,10 +120,12 @@ static int _MMG5_defmetsin(MMG5_pMesh mesh,MMG5_pSol met,int kel, int iface, int
   double             *m,n[3],isqhmin,isqhmax,b0[3],b1[3],ps1,tau[3];
   double             ntau2,gammasec[3];
   double             c[3],kappa,maxkappa,alpha, hausd,hausd_v;
-  int                lists[MMG3D_LMAX+2],listv[MMG3D_LMAX+2],ilist,ilists,ilistv;
-  int                k,iel,idp,ifac,isloc,init_s;
+  int                ilist,ilists,ilistv;
+  MMG5_int           lists[MMG3D_LMAX+2],listv[MMG3D_LMAX+2];
+  int                k,isloc,init_s;
+  MMG5_int           idp,iel,ifac;
   unsigned char      i,i0,i1,i2;
-  static char        mmgWarn = 0;
+  static _MMG5_TLS char        mmgWarn = 0;
 
   pt  = &mesh->tetra[kel];
   idp = pt->v[ip];
@@ -323,7 +325,7 @@ static int _MMG5_defmetsin(MMG5_pMesh mesh,MMG5_pSol met,int kel, int iface, int
  * and at each time, metric tensor has to be recomputed, depending on the side.
  *
  */
-static int _MMG5_defmetrid(MMG5_pMesh mesh,MMG5_pSol met,int kel,
+static int _MMG5_defmetrid(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int kel,
                            int iface, int ip)
 {
   MMG5_pTetra    pt;
@@ -332,14 +334,16 @@ static int _MMG5_defmetrid(MMG5_pMesh mesh,MMG5_pSol met,int kel,
   MMG5_pPoint    p0,p1,p2;
   MMG5_pPar      par;
   _MMG5_Bezier   b;
-  int            k,iel,idp,ilist1,ilist2,ilist,*list;
-  int            list1[MMG3D_LMAX+2],list2[MMG3D_LMAX+2],iprid[2],ier;
+  int            k,ilist1,ilist2,ilist;
+  MMG5_int       idp,iel,*list;
+  int            ier;
+  MMG5_int       iprid[2],list1[MMG3D_LMAX+2],list2[MMG3D_LMAX+2];
   double         *m,isqhmin,isqhmax,*n1,*n2,*n,*t;
   double         trot[2],u[2],ux,uy,uz,det,bcu[3];
   double         r[3][3],lispoi[3*MMG3D_LMAX+1];
   double         detg,detd;
   int            i,i0,i1,i2,ifac,isloc;
-  static char    mmgWarn = 0;
+  static _MMG5_TLS char    mmgWarn = 0;
 
   pt  = &mesh->tetra[kel];
   idp = pt->v[ip];
@@ -429,7 +433,7 @@ static int _MMG5_defmetrid(MMG5_pMesh mesh,MMG5_pSol met,int kel,
     i1 = 0;
     for (k=0; k<ilist; k++) {
       iel  = list[k] / 4;
-      ifac = list[k] % 4;
+      ifac = (int)(list[k] % 4);
       pt = &mesh->tetra[iel];
       for ( i0=0; i0!=3; ++i0 ) {
         if ( pt->v[_MMG5_idir[ifac][i0]]==idp ) break;
@@ -491,7 +495,7 @@ static int _MMG5_defmetrid(MMG5_pMesh mesh,MMG5_pSol met,int kel,
     if ( k == ilist )  continue;
 
     iel  = list[k] / 4;
-    ifac = list[k] % 4;
+    ifac = (int)(list[k] % 4);
     pt = &mesh->tetra[iel];
     for ( i0=0; i0!=3; ++i0 ) {
       if ( pt->v[_MMG5_idir[ifac][i0]]==idp ) break;
@@ -501,7 +505,7 @@ static int _MMG5_defmetrid(MMG5_pMesh mesh,MMG5_pSol met,int kel,
     _MMG5_tet2tri(mesh,iel,ifac,&ptt);
     assert(pt->xt);
     pxt = &mesh->xtetra[pt->xt];
-    if ( !_MMG5_bezierCP(mesh,&ptt,&b,MG_GET(pxt->ori,i)) )  continue;
+    if ( !mesh->func.bezierCP(mesh,&ptt,&b,MG_GET(pxt->ori,i)) )  continue;
 
     /* Barycentric coordinates of vector u in tria iel */
     detg = lispoi[3*k+1]*u[1] - lispoi[3*k+2]*u[0];
@@ -538,7 +542,7 @@ static int _MMG5_defmetrid(MMG5_pMesh mesh,MMG5_pSol met,int kel,
  * geometric approx of the surface.
  *
  */
-static int _MMG5_defmetref(MMG5_pMesh mesh,MMG5_pSol met,int kel, int iface, int ip) {
+static int _MMG5_defmetref(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int kel, int iface, int ip) {
   MMG5_pTetra   pt;
   MMG5_pxTetra  pxt;
   MMG5_Tria     ptt;
@@ -546,13 +550,15 @@ static int _MMG5_defmetref(MMG5_pMesh mesh,MMG5_pSol met,int kel, int iface, int
   MMG5_pxPoint  px0;
   _MMG5_Bezier  b;
   MMG5_pPar     par;
-  int           lists[MMG3D_LMAX+2],listv[MMG3D_LMAX+2],ilists,ilistv,ilist;
-  int           k,iel,ipref[2],idp,ifac,isloc;
+  int           ilists,ilistv,ilist;
+  MMG5_int      lists[MMG3D_LMAX+2],listv[MMG3D_LMAX+2];
+  int           k,isloc;
+  MMG5_int      ipref[2],idp,iel,ifac;
   double        *m,isqhmin,isqhmax,*n,r[3][3],lispoi[3*MMG3D_LMAX+1];
   double        ux,uy,uz,det2d,c[3];
   double        tAA[6],tAb[3], hausd;
   unsigned char i1,i2,itri1,itri2,i;
-  static char   mmgWarn0=0,mmgWarn1=0;
+  static _MMG5_TLS char   mmgWarn0=0,mmgWarn1=0;
 
   ipref[0] = ipref[1] = 0;
   pt  = &mesh->tetra[kel];
@@ -752,7 +758,7 @@ static int _MMG5_defmetref(MMG5_pMesh mesh,MMG5_pSol met,int kel, int iface, int
 
     _MMG5_tet2tri(mesh,iel,ifac,&ptt);
 
-    _MMG5_bezierCP(mesh,&ptt,&b,MG_GET(pxt->ori,ifac));
+    mesh->func.bezierCP(mesh,&ptt,&b,MG_GET(pxt->ori,ifac));
 
     /* 1. Fill matrice tAA and second member tAb with \f$A=(\sum X_{P_i}^2 \sum
      * Y_{P_i}^2 \sum X_{P_i}Y_{P_i})\f$ and \f$b=\sum Z_{P_i}\f$ with \f$P_i\f$
@@ -815,7 +821,7 @@ static int _MMG5_defmetref(MMG5_pMesh mesh,MMG5_pSol met,int kel, int iface, int
  * the geometric approx of the surface.
  *
  */
-static int _MMG5_defmetreg(MMG5_pMesh mesh,MMG5_pSol met,int kel,int iface, int ip) {
+static int _MMG5_defmetreg(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int kel,int iface, int ip) {
   MMG5_pTetra    pt;
   MMG5_pxTetra   pxt;
   MMG5_Tria      ptt;
@@ -823,13 +829,15 @@ static int _MMG5_defmetreg(MMG5_pMesh mesh,MMG5_pSol met,int kel,int iface, int
   MMG5_pxPoint   px0;
   _MMG5_Bezier   b;
   MMG5_pPar      par;
-  int            lists[MMG3D_LMAX+2],listv[MMG3D_LMAX+2],ilists,ilistv,ilist;
-  int            k,iel,idp,ifac,isloc;
+  int            ilists,ilistv,ilist;
+  MMG5_int       lists[MMG3D_LMAX+2],listv[MMG3D_LMAX+2];
+  int            k,isloc;
+  MMG5_int       idp,iel,ifac;
   double         *n,*m,r[3][3],ux,uy,uz,lispoi[3*MMG3D_LMAX+1];
   double         det2d,c[3],isqhmin,isqhmax;
   double         tAA[6],tAb[3],hausd;
   unsigned char  i1,i;
-  static char    mmgWarn = 0;
+  static _MMG5_TLS char    mmgWarn = 0;
 
   pt  = &mesh->tetra[kel];
   idp = pt->v[ip];
@@ -987,7 +995,7 @@ static int _MMG5_defmetreg(MMG5_pMesh mesh,MMG5_pSol met,int kel,int iface, int
 
     _MMG5_tet2tri(mesh,iel,ifac,&ptt);
 
-    _MMG5_bezierCP(mesh,&ptt,&b,MG_GET(pxt->ori,ifac));
+    mesh->func.bezierCP(mesh,&ptt,&b,MG_GET(pxt->ori,ifac));
 
     /* 1. Fill matrice tAA and second member tAb with \f$A=(\sum X_{P_i}^2 \sum
      * Y_{P_i}^2 \sum X_{P_i}Y_{P_i})\f$ and \f$b=\sum Z_{P_i}\f$ with P_i the
@@ -1053,8 +1061,9 @@ int _MMG5_defmetvol(MMG5_pMesh mesh,MMG5_pSol met) {
   MMG5_pPoint   ppt;
   MMG5_pPar     par;
   double        v[3][3],lambda[3],isqhmax,isqhmin,*m;
-  int           list[MMG3D_LMAX+2],ilist,k,l,i,j,isloc,ip;
-  static char   mmgWarn = 0;
+  int           ilist,l,i,j,isloc;
+  MMG5_int      ip,list[MMG3D_LMAX+2],k;
+  static _MMG5_TLS char   mmgWarn = 0;
 
   isqhmin = 1./(mesh->info.hmin*mesh->info.hmin);
   isqhmax = 1./(mesh->info.hmax*mesh->info.hmax);
@@ -1278,7 +1287,7 @@ int _MMG5_defmetvol(MMG5_pMesh mesh,MMG5_pSol met) {
  *
  */
 static inline
-int _MMG3D_intextmet(MMG5_pMesh mesh,MMG5_pSol met,int np,double me[6]) {
+int _MMG3D_intextmet(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int np,double me[6]) {
   MMG5_pPoint         p0;
   MMG5_pxPoint        go;
   double              *n;
@@ -1327,15 +1336,17 @@ int _MMG3D_intextmet(MMG5_pMesh mesh,MMG5_pSol met,int np,double me[6]) {
  *
  */
 static inline
-int _MMG3D_nosurfsiz_ani(MMG5_pMesh mesh,MMG5_pSol met,int iel, int iploc,
+int _MMG3D_nosurfsiz_ani(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int iel, int iploc,
                          int iface,int ismet) {
 
   MMG5_pTetra   pt;
   MMG5_pPoint   ppt,p0,p1;
   double        *m,isqhmin,isqhmax,ux,uy,uz,lm,lambda[3],v[3][3];
-  int           lists[MMG3D_LMAX+2],listv[MMG3D_LMAX+2],ilists,ilistv;
-  int           i,iadr,i0,ip0,ip1,i1,ia,j;
-  static char   mmgWarn=0;
+  int           ilists,ilistv;
+  MMG5_int      lists[MMG3D_LMAX+2],listv[MMG3D_LMAX+2];
+  int           i,i0,i1,ia,j;
+  MMG5_int      ip0,ip1,iadr;
+  static _MMG5_TLS char   mmgWarn=0;
 
   pt    = &mesh->tetra[iel];
   ip0   = pt->v[iploc];
@@ -1487,9 +1498,10 @@ int _MMG3D_defsiz_ani(MMG5_pMesh mesh,MMG5_pSol met) {
   MMG5_pxTetra  pxt;
   MMG5_pPoint   ppt;
   double        mm[6];
-  int           k,l,iploc;
+  int           l,iploc;
+  MMG5_int      k;
   char          i,ismet;
-  static char   mmgErr = 0;
+  static _MMG5_TLS char   mmgErr = 0;
 
   if ( abs(mesh->info.imprim) > 5 || mesh->info.ddebug )
     fprintf(stdout,"  ** Defining anisotropic map\n");
@@ -1508,11 +1520,11 @@ int _MMG3D_defsiz_ani(MMG5_pMesh mesh,MMG5_pSol met) {
   else {
     ismet = 0;
 
-    _MMG5_caltet         = _MMG5_caltet_ani;
-    _MMG5_caltri         = _MMG5_caltri_ani;
-    _MMG5_lenedg         = _MMG5_lenedg_ani;
-    MMG3D_lenedgCoor     = _MMG5_lenedgCoor_ani;
-    _MMG5_lenSurfEdg     = _MMG5_lenSurfEdg_ani;
+    mesh->func.caltet     = _MMG5_caltet_ani;
+    mesh->func.caltri     = _MMG5_caltri_ani;
+    mesh->func.lenedg     = _MMG5_lenedg_ani;
+    MMG3D_lenedgCoor      = _MMG5_lenedgCoor_ani;
+    mesh->func.lenSurfEdg = _MMG5_lenSurfEdg_ani;
   }
 
   if ( !_MMG5_defmetvol(mesh,met) )  return(0);
@@ -1564,7 +1576,7 @@ int _MMG3D_defsiz_ani(MMG5_pMesh mesh,MMG5_pSol met) {
             if ( !_MMG3D_intextmet(mesh,met,pt->v[iploc],mm) ) {
               if ( !mmgErr ) {
                  fprintf(stderr,"\n  ## Error: %s: unable to intersect metrics"
-                         " at point %d.\n",__func__,
+                         " at point %" MMG5_PRId ".\n",__func__,
                          _MMG3D_indPt(mesh,pt->v[iploc]));
                  mmgErr = 1;
               }
@@ -1600,9 +1612,10 @@ int _MMG5_grad2metVol(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTetra pt,int ia) {
   double         *mm1,*mm2,m1[6],m2[6],ps1,ps2,ux,uy,uz;
   double         c[5],l,val,t[3];
   double         lambda[3],vp[3][3],alpha,beta,mu[3];
-  int            ip1,ip2,kmin,i;
+  int            kmin,i;
+  MMG5_int       ip1,ip2;
   char           i1,i2,ichg;
-  static char    mmgWarn = 0;
+  static _MMG5_TLS char    mmgWarn = 0;
 
   i1  = _MMG5_iare[ia][0];
   i2  = _MMG5_iare[ia][1];
@@ -1815,6 +1828,24 @@ int _MMG5_grad2metVol(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTetra pt,int ia) {
   }
 }
 
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param vtet position of the first tetra of each point in \a tet.
+ * \param tet list of the tetra of the points.
+ * \param act last pass in which each tetra must be visited.
+ * \param ip index of the point whose metric has been modified.
+ *
+ * The tetra of the ball of \a ip have to be visited until the next pass.
+ *
+ */
+static inline
+void _MMG3D_gradsizActivate(MMG5_pMesh mesh,MMG5_int *vtet,MMG5_int *tet,int *act,
+                            MMG5_int ip) {
+  MMG5_int l;
+
+  for (l=vtet[ip]; l<vtet[ip+1]; l++)
+    act[tet[l]] = mesh->base+1;
+}
 
 /**
  * \param mesh pointer toward the mesh structure.
@@ -1822,7 +1853,11 @@ int _MMG5_grad2metVol(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTetra pt,int ia) {
  * \return 1
  *
  *
- * Enforces mesh gradation by truncating metric field.
+ * Enforces mesh gradation by truncating metric field. If the memory is
+ * sufficient, the tetra that have no vertex modified by the current or the
+ * previous pass are skipped without loading their vertices (the metric
+ * updates depend on the processing order, so the tetra are still visited by
+ * increasing index).
  *
  */
 int _MMG5_gradsiz_ani(MMG5_pMesh mesh,MMG5_pSol met) {
@@ -1831,15 +1866,35 @@ int _MMG5_gradsiz_ani(MMG5_pMesh mesh,MMG5_pSol met) {
   MMG5_Tria     ptt;
   MMG5_pPoint   p0,p1;
   double        *m,mv;
-  int           k,it,itv,nup,nu,nupv,maxit;
-  int           i,j,ip0,ip1;
+  int           it,itv,nup,nu,nupv,maxit;
+  MMG5_int      k;
+  int           i,j,*act;
+  MMG5_int      *vtet,*tet;
+  MMG5_int      ip0,ip1;
   char          ier,i0,i1;
 
   if ( abs(mesh->info.imprim) > 5 || mesh->info.ddebug )
     fprintf(stdout,"  ** Anisotropic mesh gradation\n");
 
+  /* act[k] >= mesh->base if the tetra k has to be visited by the pass */
+  act = NULL;
+  if ( _MMG3D_pointTetra(mesh,0,&vtet,&tet) ) {
+    if ( mesh->memCur + (long long)((mesh->ne+1)*sizeof(int)) <= mesh->memMax ) {
+      _MMG5_ADD_MEM(mesh,(mesh->ne+1)*sizeof(int),"active tetra",return(0));
+      _MMG5_SAFE_MALLOC(act,mesh->ne+1,int,0);
+    }
+    else {
+      _MMG5_DEL_MEM(mesh,tet,MG_MAX(1,vtet[mesh->np+1])*sizeof(MMG5_int));
+      _MMG5_DEL_MEM(mesh,vtet,(mesh->np+2)*sizeof(MMG5_int));
+    }
+  }
+
   for (k=1; k<=mesh->np; k++)
     mesh->point[k].flag = mesh->base;
+  if ( act ) {
+    for (k=1; k<=mesh->ne; k++)
+      act[k] = mesh->base+1;
+  }
 
   /* First step : make ridges iso in each apairing direction */
   for (k=1; k<= mesh->np; k++) {
@@ -1863,6 +1918,7 @@ int _MMG5_gradsiz_ani(MMG5_pMesh mesh,MMG5_pSol met) {
     mesh->base++;
     nu = 0;
     for (k=1; k<=mesh->ne; k++) {
+      if ( act && act[k] < mesh->base )  continue;
       pt = &mesh->tetra[k];
       if ( !MG_EOK(pt) )  continue;
       pxt = pt->xt ? &mesh->xtetra[pt->xt] : 0;
@@ -1887,10 +1943,12 @@ int _MMG5_gradsiz_ani(MMG5_pMesh mesh,MMG5_pSol met) {
               if ( ier == i0 ) {
                 p0->flag = mesh->base;
                 nu++;
+                if ( act )  _MMG3D_gradsizActivate(mesh,vtet,tet,act,ip0);
               }
               else if ( ier == i1 ) {
                 p1->flag = mesh->base;
                 nu++;
+                if ( act )  _MMG3D_gradsizActivate(mesh,vtet,tet,act,ip1);
               }
             }
           }
@@ -1905,6 +1963,10 @@ int _MMG5_gradsiz_ani(MMG5_pMesh mesh,MMG5_pSol met) {
 
   for (k=1; k<=mesh->np; k++)
     mesh->point[k].flag = mesh->base;
+  if ( act ) {
+    for (k=1; k<=mesh->ne; k++)
+      act[k] = mesh->base+1;
+  }
 
   nupv = itv = 0;
   maxit = 500;
@@ -1913,6 +1975,7 @@ int _MMG5_gradsiz_ani(MMG5_pMesh mesh,MMG5_pSol met) {
     mesh->base++;
     nu = 0;
     for (k=1; k<=mesh->ne; k++) {
+      if ( act && act[k] < mesh->base )  continue;
       pt = &mesh->tetra[k];
       if ( !MG_EOK(pt) )  continue;
       for (i=0; i<4; i++) {
@@ -1929,10 +1992,12 @@ int _MMG5_gradsiz_ani(MMG5_pMesh mesh,MMG5_pSol met) {
         if ( ier == i0 ) {
           p0->flag = mesh->base;
           nu++;
+          if ( act )  _MMG3D_gradsizActivate(mesh,vtet,tet,act,ip0);
         }
         else if ( ier == i1 ) {
           p1->flag = mesh->base;
           nu++;
+          if ( act )  _MMG3D_gradsizActivate(mesh,vtet,tet,act,ip1);
         }
       }
     }
@@ -1940,6 +2005,12 @@ int _MMG5_gradsiz_ani(MMG5_pMesh mesh,MMG5_pSol met) {
   }
   while( ++itv < maxit && nu > 0 );
 
+  if ( act ) {
+    _MMG5_DEL_MEM(mesh,act,(mesh->ne+1)*sizeof(int));
+    _MMG5_DEL_MEM(mesh,tet,MG_MAX(1,vtet[mesh->np+1])*sizeof(MMG5_int));
+    _MMG5_DEL_MEM(mesh,vtet,(mesh->np+2)*sizeof(MMG5_int));
+  }
+
   if ( abs(mesh->info.imprim) > 3 ) {
     if ( abs(mesh->info.imprim) < 5 && !mesh->info.ddebug ) {
       fprintf(stdout,"    gradation: %7d updated, %d iter\n",nup+nupv,it+itv);
@@ -34,7 +34,6 @@
 
 #include "mmg3d.h"
 
-extern char ddb;
 
 /**
  * \param c1 coordinates of the first point of the curve.
@@ -149,7 +148,7 @@ _MMG5_BezierGeod(double c1[3],double c2[3],double t1[3],double t2[3]) {
  *
  */
 inline int
-_MMG5_BezierEdge(MMG5_pMesh mesh,int ip0,int ip1,double b0[3],double b1[3],char ised, double v[3]) {
+_MMG5_BezierEdge(MMG5_pMesh mesh,MMG5_int ip0,MMG5_int ip1,double b0[3],double b1[3],char ised, double v[3]) {
   MMG5_pPoint   p0,p1;
   MMG5_pxPoint  pxp0,pxp1;
   double   ux,uy,uz,ps,ps1,ps2,*n1,*n2,np0[3],np1[3],t0[3],t1[3],il,ll,alpha;
@@ -324,7 +323,7 @@ int _MMG5_mmg3dBezierCP(MMG5_pMesh mesh,MMG5_Tria *pt,_MMG5_pBezier pb,char ori)
   MMG5_pPoint    p[3];
   MMG5_xPoint   *pxp;
   double        *n1,*n2,nt[3],t1[3],t2[3],ps,ps2,dd,ux,uy,uz,l,ll,alpha;
-  int            ia,ib,ic;
+  MMG5_int       ia,ib,ic;
   char           i,i1,i2,im,isnm;
 
   ia   = pt->v[0];
@@ -50,9 +50,10 @@ extern MMG5_Info  info;
  * of the tetra, jel = local index of p within kel.
  *
  */
-int _MMG5_boulevolp (MMG5_pMesh mesh, int start, int ip, int * list){
+int _MMG5_boulevolp (MMG5_pMesh mesh, MMG5_int start, MMG5_int ip, MMG5_int * list){
   MMG5_pTetra  pt,pt1;
-  int    *adja,nump,ilist,base,cur,k,k1;
+  int    ilist,base,cur;
+  MMG5_int nump,*adja,k1,k;
   char    j,l,i;
 
   base = ++mesh->base;
@@ -105,13 +106,13 @@ int _MMG5_boulevolp (MMG5_pMesh mesh, int start, int ip, int * list){
  * supported by face \a iface), enumerating its (outer)surfacic ball.
  *
  */
-int _MMG5_boulenm(MMG5_pMesh mesh,int start,int ip,int iface,
+int _MMG5_boulenm(MMG5_pMesh mesh,MMG5_int start,int ip,int iface,
                   double n[3],double t[3]) {
   MMG5_pTetra   pt;
   MMG5_pPoint   p0,p1,ppt;
   double   dd,nt[3],l0,l1;
-  int      base,nump,nr,nnm,k,piv,na,nb,adj,nvstart,fstart,aux,ip0,ip1;
-  int     *adja;
+  int      base,nr,nnm;
+  MMG5_int nump,piv,na,nb,aux,ip0,ip1,*adja,adj,k,nvstart,fstart;
   int16_t  tag;
   char     iopp,ipiv,indb,inda,i,ipa,ipb,isface;
   char     indedg[4][4] = { {-1,0,1,2}, {0,-1,3,4}, {1,3,-1,5}, {2,4,5,-1} };
@@ -279,28 +280,18 @@ int _MMG5_boulenm(MMG5_pMesh mesh,int start,int ip,int iface,
  * the vertex \a ip when ip is non-manifold.
  *
  */
-int _MMG5_boulernm(MMG5_pMesh mesh, int start, int ip, int *ng, int *nr){
+int _MMG5_boulernm(MMG5_pMesh mesh, MMG5_int start, int ip, int *ng, int *nr){
   MMG5_pTetra    pt,pt1;
   MMG5_pxTetra   pxt;
   _MMG5_Hash     hash;
-  _MMG5_hedge    *ph;
-  int            *adja,nump,ilist,base,cur,k,k1,ns;
-  int            hmax, list[MMG3D_LMAX+2];
-  int            key,ia,ib,jj,a,b;
+  int            ilist,base,cur,ns;
+  MMG5_int       nump,*adja,k1,k;
+  MMG5_int       a,b,list[MMG3D_LMAX+2];
   char           j,l,i;
   unsigned char  ie;
 
   /* allocate hash table to store the special edges passing through ip */
-  hmax = 3.71*mesh->np;
-  hash.siz  = mesh->np;
-  hash.max  = hmax + 1;
-  hash.nxt  = hash.siz;
-  _MMG5_ADD_MEM(mesh,(hash.max+1)*sizeof(_MMG5_hedge),"hash table",return(-1));
-  _MMG5_SAFE_CALLOC(hash.item,hash.max+1,_MMG5_hedge,-1);
-
-  for (k=hash.siz; k<hash.max; k++)
-    hash.item[k].nxt = k+1;
-
+  if ( !_MMG5_hashNew(mesh,&hash,32,3*32) )  return(-1);
 
   base = ++mesh->base;
   pt   = &mesh->tetra[start];
@@ -331,39 +322,10 @@ int _MMG5_boulernm(MMG5_pMesh mesh, int start, int ip, int *ng, int *nr){
            * increment ng or nr.*/
           a = pt->v[_MMG5_iare[ie][0]];
           b = pt->v[_MMG5_iare[ie][1]];
-          ia  = MG_MIN(a,b);
-          ib  = MG_MAX(a,b);
-          key = (_MMG5_KA*ia + _MMG5_KB*ib) % hash.siz;
-          ph  = &hash.item[key];
-
-          if ( ph->a == ia && ph->b == ib )
-            continue;
-          else if ( ph->a ) {
-            while ( ph->nxt && ph->nxt < hash.max ) {
-              ph = &hash.item[ph->nxt];
-              if ( ph->a == ia && ph->b == ib )  continue;
-            }
-            ph->nxt   = hash.nxt;
-            ph        = &hash.item[hash.nxt];
-
-            if ( hash.nxt >= hash.max-1 ) {
-              if ( mesh->info.ddebug )
-                fprintf(stderr,"\n  ## Warning: %s: memory alloc problem (edge):"
-                        " %d\n",__func__,hash.max);
-              _MMG5_TAB_RECALLOC(mesh,hash.item,hash.max,0.2,_MMG5_hedge,
-                                 "_MMG5_edge",return -1,-1);
-              /* ph pointer may be false after realloc */
-              ph        = &hash.item[hash.nxt];
-
-              for (jj=ph->nxt; jj<hash.max; jj++)  hash.item[jj].nxt = jj+1;
-            }
-            hash.nxt = ph->nxt;
-          }
+          if ( _MMG5_hashGet(&hash,a,b) )  continue;
 
           /* insert new edge */
-          ph->a = ia;
-          ph->b = ib;
-          ph->nxt = 0;
+          if ( !_MMG5_hashEdge(mesh,&hash,a,b,1) )  return(-1);
 
           if ( pxt->tag[ie] & MG_GEO )
             ++(*ng);
@@ -397,7 +359,7 @@ int _MMG5_boulernm(MMG5_pMesh mesh, int start, int ip, int *ng, int *nr){
   }
 
   /* Free the edge hash table */
-  _MMG5_DEL_MEM(mesh,hash.item,(hash.max+1)*sizeof(_MMG5_hedge));
+  _MMG5_DEL_MEM(mesh,hash.item,hash.siz*sizeof(_MMG5_hedge));
 
   return(ns);
 }
@@ -425,14 +387,15 @@ int _MMG5_boulernm(MMG5_pMesh mesh, int start, int ip, int *ng, int *nr){
  * non-manifold, must be called only if \a start has no adjacent through iface.
  *
  */
-int _MMG5_boulesurfvolp(MMG5_pMesh mesh,int start,int ip,int iface,
-                        int *listv,int *ilistv,int *lists,int*ilists, int isnm)
+int _MMG5_boulesurfvolp(MMG5_pMesh mesh,MMG5_int start,int ip,int iface,
+                        MMG5_int *listv,int *ilistv,MMG5_int *lists,int*ilists, int isnm)
 {
   MMG5_pTetra  pt,pt1;
   MMG5_pxTetra pxt;
-  int  base,nump,k,k1,*adja,piv,na,nb,adj,cur,nvstart,fstart,aux;
+  int  base,cur;
+  MMG5_int nump,piv,na,nb,aux,*adja,k1,adj,k,nvstart,fstart;
   char iopp,ipiv,i,j,l,ipa,ipb,isface;
-  static char mmgErr0=0, mmgErr1=0;
+  static _MMG5_TLS char mmgErr0=0, mmgErr1=0;
 
   if ( isnm ) assert(!mesh->adja[4*(start-1)+iface+1]);
 
@@ -458,7 +421,7 @@ int _MMG5_boulesurfvolp(MMG5_pMesh mesh,int start,int ip,int iface,
     if ( *ilists >= MMG3D_LMAX ) {
       if ( !mmgErr0 ) {
         fprintf(stderr,"\n  ## Warning: %s: problem in surface remesh process."
-                " Surface ball of at least 1 point (%d) contains too"
+                " Surface ball of at least 1 point (%" MMG5_PRId ") contains too"
                 " many elts.\n"
                 "  ##          Try to modify the hausdorff number "
                 " or/and the maximum edge size.\n",__func__,
@@ -550,7 +513,7 @@ int _MMG5_boulesurfvolp(MMG5_pMesh mesh,int start,int ip,int iface,
       if ( *ilistv > MMG3D_LMAX-3 ) {
         if ( !mmgErr1 ) {
           fprintf(stderr,"\n  ## Warning: %s: problem in remesh process."
-                  " Volumic ball of point %d contains too many elts.\n",
+                  " Volumic ball of point %" MMG5_PRId " contains too many elts.\n",
                   __func__,_MMG3D_indPt(mesh,nump));
           fprintf(stderr,"\n  ##          Try to modify the hausdorff number,"
                   " or/and the maximum mesh.\n");
@@ -588,18 +551,22 @@ int _MMG5_boulesurfvolp(MMG5_pMesh mesh,int start,int ip,int iface,
  * direct order.
  *
  */
-int _MMG5_bouletrid(MMG5_pMesh mesh,int start,int iface,int ip,int *il1,int *l1,
-                    int *il2,int *l2,int *ip0,int *ip1)
+int _MMG5_bouletrid(MMG5_pMesh mesh,MMG5_int start,int iface,int ip,int *il1,MMG5_int *l1,
+                    int *il2,MMG5_int *l2,MMG5_int *ip0,MMG5_int *ip1)
 {
   MMG5_pTetra          pt;
   MMG5_pxTetra         pxt;
   MMG5_pPoint          ppt;
-  int                  k,*adja,*ilist1,*ilist2,*list1,*list2,aux;
-  int                  lists[MMG3D_LMAX+2], ilists;
-  int                  idp,na, nb, base, iopp, ipiv, piv, fstart, nvstart, adj;
-  int                  i,ifac,idx,idx2,idx_tmp,i1,ipa,ipb, isface;
+  int                  *ilist1,*ilist2;
+  MMG5_int             aux,*adja,k,*list1,*list2;
+  int                  ilists;
+  MMG5_int             lists[MMG3D_LMAX+2];
+  int                  base, iopp, ipiv;
+  MMG5_int             idp,na,nb,piv,adj,fstart,nvstart;
+  int                  i,idx,idx2,idx_tmp,i1,ipa,ipb, isface;
+  MMG5_int             ifac;
   double               *n1,*n2,nt[3],ps1,ps2;
-  static char          mmgErr0=0;
+  static _MMG5_TLS char          mmgErr0=0;
 
   pt = &mesh->tetra[start];
   if ( !MG_EOK(pt) )  return(0);
@@ -660,7 +627,7 @@ int _MMG5_bouletrid(MMG5_pMesh mesh,int start,int iface,int ip,int *il1,int *l1,
     if ( ilists >= MMG3D_LMAX ) {
       if ( !mmgErr0 ) {
         fprintf(stderr,"\n  ## Warning: %s: problem in remesh process."
-                " Volumic ball of point %d contains too many elts.\n",
+                " Volumic ball of point %" MMG5_PRId " contains too many elts.\n",
                 __func__,_MMG3D_indPt(mesh,idp));
         fprintf(stderr,"\n  ##          Try to modify the hausdorff number,"
                 " or/and the maximum mesh.\n");
@@ -796,7 +763,7 @@ static inline int
 _MMG5_gettag(MMG5_pMesh mesh,int start,int ia,int16_t *tag,int *edg) {
   MMG5_pTetra        pt;
   MMG5_pxTetra       pxt;
-  int           na,nb,*adja,adj,piv;
+  MMG5_int      na,nb,piv,*adja,adj;
   unsigned char i,ipa,ipb;
 
   if ( start < 1 )  return(0);
@@ -854,10 +821,10 @@ _MMG5_gettag(MMG5_pMesh mesh,int start,int ia,int16_t *tag,int *edg) {
 
 /** Set tag and edg of edge ia (if need be) in tetra start by travelling its shell */
 inline int
-_MMG5_settag(MMG5_pMesh mesh,int start,int ia,int16_t tag,int edg) {
+_MMG5_settag(MMG5_pMesh mesh,MMG5_int start,int ia,int16_t tag,int edg) {
   MMG5_pTetra        pt;
   MMG5_pxTetra       pxt;
-  int           na,nb,*adja,adj,piv;
+  MMG5_int      na,nb,piv,*adja,adj;
   int16_t       taginit;
   unsigned char i,ipa,ipb;
 
@@ -981,10 +948,10 @@ _MMG5_settag(MMG5_pMesh mesh,int start,int ia,int16_t tag,int edg) {
  *
  */
 inline int
-_MMG5_deltag(MMG5_pMesh mesh,int start,int ia,int16_t tag) {
+_MMG5_deltag(MMG5_pMesh mesh,MMG5_int start,int ia,int16_t tag) {
   MMG5_pTetra        pt;
   MMG5_pxTetra       pxt;
-  int           na,nb,*adja,adj,piv;
+  MMG5_int      na,nb,piv,*adja,adj;
   unsigned char i,ipa,ipb;
 
   assert( start >= 1 );
@@ -1086,11 +1053,12 @@ _MMG5_deltag(MMG5_pMesh mesh,int start,int ia,int16_t tag) {
  * Find all tets sharing edge ia of tetra start.
  *
  */
-int _MMG5_coquil(MMG5_pMesh mesh,int start,int ia,int * list) {
+int _MMG5_coquil(MMG5_pMesh mesh,MMG5_int start,int ia,MMG5_int * list) {
   MMG5_pTetra pt;
-  int         ilist,*adja,piv,adj,na,nb,ipa,ipb;
+  int         ilist,ipa,ipb;
+  MMG5_int    piv,na,nb,*adja,adj;
   char        i;
-  static char mmgErr0=0;
+  static _MMG5_TLS char mmgErr0=0;
 
   assert ( start >= 1 );
   pt = &mesh->tetra[start];
@@ -1123,7 +1091,7 @@ int _MMG5_coquil(MMG5_pMesh mesh,int start,int ia,int * list) {
     if ( ilist > MMG3D_LMAX-3 ) {
       if ( !mmgErr0 ) {
         fprintf(stderr,"\n  ## Warning: %s: problem in remesh process."
-                " Coquil of edge %d-%d contains too many elts.\n",
+                " Coquil of edge %" MMG5_PRId "-%" MMG5_PRId " contains too many elts.\n",
                 __func__,_MMG3D_indPt(mesh,na),_MMG3D_indPt(mesh,nb));
         fprintf(stderr,"\n  ##          Try to modify the hausdorff number,"
                 " or/and the maximum mesh.\n");
@@ -1161,7 +1129,7 @@ int _MMG5_coquil(MMG5_pMesh mesh,int start,int ia,int * list) {
   if ( ilist > MMG3D_LMAX-3 ) {
     if ( !mmgErr0 ) {
       fprintf(stderr,"\n  ## Warning: %s: problem in remesh process."
-              " Coquil of edge %d-%d contains too many elts.\n",
+              " Coquil of edge %" MMG5_PRId "-%" MMG5_PRId " contains too many elts.\n",
               __func__,_MMG3D_indPt(mesh,na),_MMG3D_indPt(mesh,nb));
       fprintf(stderr,"\n  ##          Try to modify the hausdorff number,"
               " or/and the maximum mesh.\n");
@@ -1198,7 +1166,7 @@ int _MMG5_coquil(MMG5_pMesh mesh,int start,int ia,int * list) {
     if ( ilist > MMG3D_LMAX-2 ) {
       if ( !mmgErr0 ) {
         fprintf(stderr,"\n  ## Warning: %s: problem in remesh process."
-                " Coquil of edge %d-%d contains too many elts.\n",
+                " Coquil of edge %" MMG5_PRId "-%" MMG5_PRId " contains too many elts.\n",
                 __func__,_MMG3D_indPt(mesh,na),_MMG3D_indPt(mesh,nb));
         fprintf(stderr,"\n  ##          Try to modify the hausdorff number,"
                 " or/and the maximum mesh.\n");
@@ -1223,10 +1191,10 @@ int _MMG5_coquil(MMG5_pMesh mesh,int start,int ia,int * list) {
 }
 
 /** Identify whether edge ia in start is a boundary edge by unfolding its shell */
-int _MMG5_srcbdy(MMG5_pMesh mesh,int start,int ia) {
+int _MMG5_srcbdy(MMG5_pMesh mesh,MMG5_int start,int ia) {
   MMG5_pTetra      pt;
   MMG5_pxTetra     pxt;
-  int         na,nb,adj,piv,*adja;
+  MMG5_int    na,nb,piv,*adja,adj;
   char        ipa,ipb,iadj,i;
 
   pt = &mesh->tetra[start];
@@ -1290,11 +1258,12 @@ int _MMG5_srcbdy(MMG5_pMesh mesh,int start,int ia) {
  * Print an error message if _MMG5_coquilFace detect a boundary topology problem.
  *
  */
- void _MMG5_coquilFaceErrorMessage(MMG5_pMesh mesh, int k1, int k2) {
+ void _MMG5_coquilFaceErrorMessage(MMG5_pMesh mesh, MMG5_int k1, MMG5_int k2) {
   MMG5_pPoint ppt;
   MMG5_pTetra pt;
-  int         np, ne, k, kel1, kel2;
-  static char mmgErr0;
+  int         np, ne, kel1, kel2;
+  MMG5_int    k;
+  static _MMG5_TLS char mmgErr0;
 
   if ( mmgErr0 ) return;
 
@@ -1321,10 +1290,10 @@ int _MMG5_srcbdy(MMG5_pMesh mesh,int start,int ia) {
   if ( kel1 != 0 ) {
     pt = &mesh->tetra[k1];
     fprintf(stderr,"            look at elt %d:",kel1);
-    fprintf(stderr," %d %d %d %d.\n", mesh->point[pt->v[0]].tmp,
+    fprintf(stderr," %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId ".\n", mesh->point[pt->v[0]].tmp,
             mesh->point[pt->v[1]].tmp,mesh->point[pt->v[2]].tmp,
             mesh->point[pt->v[3]].tmp);
-    fprintf(stderr,"            adjacent tetras %d %d %d %d\n",(&mesh->adja[3*(kel1-1)+1])[0],
+    fprintf(stderr,"            adjacent tetras %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId "\n",(&mesh->adja[3*(kel1-1)+1])[0],
             (&mesh->adja[3*(kel1-1)+1])[1],(&mesh->adja[3*(kel1-1)+1])[2],
             (&mesh->adja[3*(kel1-1)+1])[3]);
     fprintf(stderr,"            vertex required? %d %d %d %d\n",mesh->point[pt->v[0]].tag & MG_REQ,
@@ -1333,7 +1302,7 @@ int _MMG5_srcbdy(MMG5_pMesh mesh,int start,int ia) {
   } else if ( kel2 != 0 ) {
     fprintf(stderr,"            look at elt %d:",kel2);
     mesh->tetra[kel2].ref=5;
-    fprintf(stderr," %d %d %d %d.\n\n", mesh->point[pt->v[0]].tmp,
+    fprintf(stderr," %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId ".\n\n", mesh->point[pt->v[0]].tmp,
             mesh->point[pt->v[1]].tmp,mesh->point[pt->v[2]].tmp,
             mesh->point[pt->v[3]].tmp);
   }
@@ -1368,15 +1337,16 @@ int _MMG5_srcbdy(MMG5_pMesh mesh,int start,int ia) {
  * tetra without adjacent. Fill \a it2 and \a list.
  *
  */
-int _MMG3D_coquilFaceFirstLoop(MMG5_pMesh mesh,int start,int na,int nb,char iface,
-                               char ia,int *list,int *ilist,int *it1,int *it2,
-                               int *piv,int *adj,char *hasadja,int *nbdy,int silent) {
+int _MMG3D_coquilFaceFirstLoop(MMG5_pMesh mesh,MMG5_int start,MMG5_int na,MMG5_int nb,char iface,
+                               char ia,MMG5_int *list,int *ilist,MMG5_int *it1,MMG5_int *it2,
+                               MMG5_int *piv,MMG5_int *adj,char *hasadja,int *nbdy,int silent) {
 
   MMG5_pTetra   pt;
   MMG5_pxTetra  pxt;
-  int           *adja;
-  int           pradj,pri,ier,ifar_idx,i;
-  static char   mmgErr0 = 0;
+  MMG5_int      *adja;
+  int           pri,ier,ifar_idx,i;
+  MMG5_int      pradj;
+  static _MMG5_TLS char   mmgErr0 = 0;
 
   pt = &mesh->tetra[start];
 
@@ -1418,7 +1388,7 @@ int _MMG3D_coquilFaceFirstLoop(MMG5_pMesh mesh,int start,int na,int nb,char ifac
     if ( (*ilist) > MMG3D_LMAX-2 ) {
       if ( !mmgErr0 ) {
         fprintf(stderr,"\n  ## Warning: %s: problem in remesh process."
-                " Coquil of edge %d-%d contains too many elts.\n",
+                " Coquil of edge %" MMG5_PRId "-%" MMG5_PRId " contains too many elts.\n",
                 __func__,_MMG3D_indPt(mesh,na),_MMG3D_indPt(mesh,nb));
         fprintf(stderr,"\n  ##          Try to modify the hausdorff number,"
                 " or/and the maximum mesh.\n");
@@ -1456,9 +1426,9 @@ int _MMG3D_coquilFaceFirstLoop(MMG5_pMesh mesh,int start,int na,int nb,char ifac
  * the \a coquilFaceFirstLoop function.
  *
  */
-void _MMG3D_coquilFaceSecondLoopInit(MMG5_pMesh mesh,int piv,char *iface,int *i,
-                                     int *list,int *ilist,int *it1,int *pradj,
-                                     int *adj) {
+void _MMG3D_coquilFaceSecondLoopInit(MMG5_pMesh mesh,MMG5_int piv,char *iface,int *i,
+                                     MMG5_int *list,int *ilist,MMG5_int *it1,MMG5_int *pradj,
+                                     MMG5_int *adj) {
 
   MMG5_pTetra   pt;
   MMG5_pxTetra  pxt;
@@ -1466,7 +1436,7 @@ void _MMG3D_coquilFaceSecondLoopInit(MMG5_pMesh mesh,int piv,char *iface,int *i,
   assert( !(*adj) );
 
   (*adj)      = list[(*ilist)-1] / 6;
-  (*i)        = list[(*ilist)-1] % 6;
+  (*i)        = (int)(list[(*ilist)-1] % 6);
   (*ilist)     = 0;
 
   (*pradj) = (*adj);
@@ -1508,12 +1478,13 @@ void _MMG3D_coquilFaceSecondLoopInit(MMG5_pMesh mesh,int piv,char *iface,int *i,
  *
  * \warning Don't work if \a ia has only one boundary face in its shell.
  */
-int _MMG5_coquilface(MMG5_pMesh mesh,int start,char iface,int ia,int *list,
-                     int *it1,int *it2, int silent) {
+int _MMG5_coquilface(MMG5_pMesh mesh,MMG5_int start,char iface,int ia,MMG5_int *list,
+                     MMG5_int *it1,MMG5_int *it2, int silent) {
   MMG5_pTetra   pt;
-  int           piv,adj,na,nb,ilist,pradj,i,ier,nbdy;
+  int           ilist,i,ier,nbdy;
+  MMG5_int      na,nb,piv,adj,pradj;
   char          hasadja;
-  static char   mmgErr0=0,mmgErr1=0,mmgWarn0=0;
+  static _MMG5_TLS char   mmgErr0=0,mmgErr1=0,mmgWarn0=0;
 
   pt = &mesh->tetra[start];
 
@@ -1578,7 +1549,7 @@ int _MMG5_coquilface(MMG5_pMesh mesh,int start,char iface,int ia,int *list,
     if ( ilist > MMG3D_LMAX-2 ) {
       if ( !mmgErr1 ) {
         fprintf(stderr,"\n  ## Warning: %s: problem in remesh process."
-                " Coquil of edge %d-%d contains too many elts.\n",
+                " Coquil of edge %" MMG5_PRId "-%" MMG5_PRId " contains too many elts.\n",
                 __func__,_MMG3D_indPt(mesh,na),_MMG3D_indPt(mesh,nb));
         fprintf(stderr,"\n  ##          Try to modify the hausdorff number,"
                 " or/and the maximum mesh.\n");
@@ -1615,12 +1586,13 @@ int _MMG5_coquilface(MMG5_pMesh mesh,int start,char iface,int ia,int *list,
  * \a piv.
  *
  */
-int16_t _MMG5_coquilTravel(MMG5_pMesh mesh, int na, int nb, int* adj, int *piv,
+int16_t _MMG5_coquilTravel(MMG5_pMesh mesh, MMG5_int na, MMG5_int nb, MMG5_int* adj, MMG5_int *piv,
                            char *iface, int *i )
 {
   MMG5_pTetra  pt;
   MMG5_pxTetra pxt;
-  int          ipa,ipb,*adja;
+  int          ipa,ipb;
+  MMG5_int     *adja;
   int16_t      isbdy;
 
   pt = &mesh->tetra[*adj];
@@ -1674,11 +1646,12 @@ int16_t _MMG5_coquilTravel(MMG5_pMesh mesh, int na, int nb, int* adj, int *piv,
  * through the face \a iface.
  *
  */
-void _MMG5_openCoquilTravel(MMG5_pMesh mesh, int na, int nb, int* adj, int *piv,
+void _MMG5_openCoquilTravel(MMG5_pMesh mesh, MMG5_int na, MMG5_int nb, MMG5_int* adj, MMG5_int *piv,
                             char *iface, int *i )
 {
   MMG5_pTetra  pt;
-  int          ipa,ipb,*adja;
+  int          ipa,ipb;
+  MMG5_int     *adja;
 
     pt = &mesh->tetra[*adj];
 
@@ -1705,3 +1678,67 @@ void _MMG5_openCoquilTravel(MMG5_pMesh mesh, int na, int nb, int* adj, int *piv,
       *piv = pt->v[ _MMG5_ifar[*i][0] ];
     }
 }
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param noreq 1 if we skip the required tetra.
+ * \param pvtet pointer toward the array (of size \a np+2) of the position of
+ * the first tetra of each point in \a ptet.
+ * \param ptet pointer toward the list of the tetra of the points.
+ * \return 1 if success, 0 if the memory is not sufficient.
+ *
+ * Build all the volumic balls at once: the tetra of the point \a k are the
+ * tetra \a tet[vtet[k]] to \a tet[vtet[k+1]-1]. Nothing is allocated (nor
+ * printed) if the authorized memory is too small so the caller may use
+ * another method, otherwise the arrays are counted in the mesh memory and
+ * must be freed with \ref _MMG5_DEL_MEM.
+ *
+ */
+int _MMG3D_pointTetra(MMG5_pMesh mesh,char noreq,MMG5_int **pvtet,MMG5_int **ptet) {
+  MMG5_pTetra  pt;
+  int          i;
+  MMG5_int     ip,k,n,*vtet,*tet;
+
+  n = 0;
+  for (k=1; k<=mesh->ne; k++) {
+    pt = &mesh->tetra[k];
+    if ( !MG_EOK(pt) || (noreq && (pt->tag & MG_REQ)) )  continue;
+    n += 4;
+  }
+
+  if ( mesh->memCur + (long long)((mesh->np+2+n)*sizeof(MMG5_int)) > mesh->memMax )
+    return(0);
+
+  _MMG5_ADD_MEM(mesh,(mesh->np+2)*sizeof(MMG5_int),"point to tetra table",
+                return(0));
+  _MMG5_SAFE_CALLOC(vtet,mesh->np+2,MMG5_int,0);
+  _MMG5_ADD_MEM(mesh,MG_MAX(1,n)*sizeof(MMG5_int),"point to tetra table",
+                _MMG5_DEL_MEM(mesh,vtet,(mesh->np+2)*sizeof(MMG5_int));
+                return(0));
+  _MMG5_SAFE_MALLOC(tet,MG_MAX(1,n),MMG5_int,0);
+
+  for (k=1; k<=mesh->ne; k++) {
+    pt = &mesh->tetra[k];
+    if ( !MG_EOK(pt) || (noreq && (pt->tag & MG_REQ)) )  continue;
+    for (i=0; i<4; i++)
+      vtet[pt->v[i]+1]++;
+  }
+  vtet[1] = 0;
+  for (ip=1; ip<=mesh->np; ip++)
+    vtet[ip+1] += vtet[ip];
+
+  /* fill (vtet[ip] is used as insertion position then shifted back) */
+  for (k=1; k<=mesh->ne; k++) {
+    pt = &mesh->tetra[k];
+    if ( !MG_EOK(pt) || (noreq && (pt->tag & MG_REQ)) )  continue;
+    for (i=0; i<4; i++)
+      tet[vtet[pt->v[i]]++] = k;
+  }
+  for (ip=mesh->np; ip>0; ip--)
+    vtet[ip+1] = vtet[ip];
+  vtet[1] = 0;
+
+  *pvtet = vtet;
+  *ptet  = tet;
+  return(1);
+}
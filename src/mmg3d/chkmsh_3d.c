@@ -38,7 +38,6 @@
 #define  _MMG5_EPSLOC   1.00005
 #define  IEDG(a,b) (((a) > 0) && ((b) > 0)) ? ((a)+(b)) : (((a)+(b))-(1))
 
-extern char ddb;
 
 /**
  *
@@ -46,7 +45,7 @@ extern char ddb;
  */
 void _MMG5_chkvol(MMG5_pMesh mesh) {
   MMG5_pTetra    pt;
-  int       k;
+  MMG5_int  k;
 #ifdef DEBUG
   int       ier=1;
 #endif
@@ -55,7 +54,7 @@ void _MMG5_chkvol(MMG5_pMesh mesh) {
     pt = &mesh->tetra[k];
     if ( !MG_EOK(pt) )  continue;
     if ( _MMG5_orvol(mesh->point,pt->v) < _MMG5_NULKAL ) {
-      fprintf(stderr,"\n  ## Warning: %s: tetra %d volume %e\n",__func__,
+      fprintf(stderr,"\n  ## Warning: %s: tetra %" MMG5_PRId " volume %e\n",__func__,
              k,_MMG5_orvol(mesh->point,pt->v));
 #ifdef DEBUG
       ier = 0;
@@ -74,8 +73,7 @@ void _MMG5_chkvol(MMG5_pMesh mesh) {
  */
 int _MMG5_chkmshsurf(MMG5_pMesh mesh){
   MMG5_pTria      pt;
-  int        k,k1;
-  int        *adja,*adja1;
+  MMG5_int   *adja,*adja1,k1,k;
   char       i,voy;
 
   for (k=1; k<=mesh->nt; k++) {
@@ -91,7 +89,7 @@ int _MMG5_chkmshsurf(MMG5_pMesh mesh){
 
       if(adja1[voy] / 3 != k){
         fprintf(stderr,"\n  ## Warning: %s: wrong adjacency relation"
-                " for triangles : %d %d \n",__func__,k,k1);
+                " for triangles : %" MMG5_PRId " %" MMG5_PRId " \n",__func__,k,k1);
         return 0;
       }
     }
@@ -111,10 +109,11 @@ int _MMG5_chkmshsurf(MMG5_pMesh mesh){
 int _MMG5_mmg3dChkmsh(MMG5_pMesh mesh,int severe,int base) {
   MMG5_pTetra    pt,pt1,pt2;
   MMG5_pxTetra   pxt;
-  int            *adja,*adja1,adj,adj1,k,i,iadr;
-  int            iel,a0,a1,a2,b0,b1,b2;
+  int            i;
+  MMG5_int       *adja,*adja1,adj,adj1,iadr,k;
+  MMG5_int       a0,a1,a2,b0,b1,b2,iel;
   unsigned char  voy,voy1;
-  static char    mmgErr0=0,mmgErr1=0,mmgErr2=0,mmgErr3=0,mmgErr4=0,mmgErr5=0;
+  static _MMG5_TLS char    mmgErr0=0,mmgErr1=0,mmgErr2=0,mmgErr3=0,mmgErr4=0,mmgErr5=0;
 
   for (k=1; k<=mesh->ne; k++) {
     pt1 = &mesh->tetra[k];
@@ -131,12 +130,12 @@ int _MMG5_mmg3dChkmsh(MMG5_pMesh mesh,int severe,int base) {
 
       if ( adj == k ) {
         if ( !mmgErr0 ) {
-          fprintf(stderr,"\n  ## Error: %s: 1. at least 1 wrong adjacency %d %d\n",
+          fprintf(stderr,"\n  ## Error: %s: 1. at least 1 wrong adjacency %" MMG5_PRId " %" MMG5_PRId "\n",
                   __func__,_MMG3D_indElt(mesh,k),_MMG3D_indElt(mesh,adj));
-          fprintf(stderr,"triangle %d: %d %d %d %d\n",_MMG3D_indElt(mesh,k),
+          fprintf(stderr,"triangle %" MMG5_PRId ": %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId "\n",_MMG3D_indElt(mesh,k),
                   _MMG3D_indPt(mesh,pt1->v[0]),_MMG3D_indPt(mesh,pt1->v[1]),
                   _MMG3D_indPt(mesh,pt1->v[2]),_MMG3D_indPt(mesh,pt1->v[3]));
-          fprintf(stderr,"adj (%d): %d %d %d %d\n",_MMG3D_indElt(mesh,k),
+          fprintf(stderr,"adj (%" MMG5_PRId "): %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId "\n",_MMG3D_indElt(mesh,k),
                   _MMG3D_indElt(mesh,adja[0]/4),_MMG3D_indElt(mesh,adja[1]/4),
                   _MMG3D_indElt(mesh,adja[2]/4),_MMG3D_indElt(mesh,adja[3]/4));
           mmgErr0 = 1;
@@ -146,15 +145,15 @@ int _MMG5_mmg3dChkmsh(MMG5_pMesh mesh,int severe,int base) {
       pt2 = &mesh->tetra[adj];
       if ( !MG_EOK(pt2) || pt2->ref < 0 ){
         if ( !mmgErr1 ) {
-          fprintf(stderr,"\n  ## Error: %s: 4. at least 1 invalid adjacent %d %d\n",
+          fprintf(stderr,"\n  ## Error: %s: 4. at least 1 invalid adjacent %" MMG5_PRId " %" MMG5_PRId "\n",
                   __func__,_MMG3D_indElt(mesh,adj),_MMG3D_indElt(mesh,k));
-          fprintf(stderr,"vertices of k   %d: %d %d %d %d\n",_MMG3D_indElt(mesh,k),
+          fprintf(stderr,"vertices of k   %" MMG5_PRId ": %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId "\n",_MMG3D_indElt(mesh,k),
                   _MMG3D_indPt(mesh,pt1->v[0]),_MMG3D_indPt(mesh,pt1->v[1]),
                   _MMG3D_indPt(mesh,pt1->v[2]),_MMG3D_indPt(mesh,pt1->v[3]));
-          fprintf(stderr,"vertices of adj %d: %d %d %d %d\n",_MMG3D_indElt(mesh,adj),
+          fprintf(stderr,"vertices of adj %" MMG5_PRId ": %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId "\n",_MMG3D_indElt(mesh,adj),
                   _MMG3D_indPt(mesh,pt2->v[0]),_MMG3D_indPt(mesh,pt2->v[1]),
                   _MMG3D_indPt(mesh,pt2->v[2]),_MMG3D_indPt(mesh,pt2->v[3]));
-          fprintf(stderr,"adj(%d): %d %d %d %d\n",_MMG3D_indElt(mesh,k),
+          fprintf(stderr,"adj(%" MMG5_PRId "): %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId "\n",_MMG3D_indElt(mesh,k),
                   _MMG3D_indElt(mesh,adja[0]/4),_MMG3D_indElt(mesh,adja[1]/4),
                   _MMG3D_indElt(mesh,adja[2]/4),_MMG3D_indElt(mesh,adja[3]/4));
           mmgErr1 = 1;
@@ -167,18 +166,18 @@ int _MMG5_mmg3dChkmsh(MMG5_pMesh mesh,int severe,int base) {
       voy1  = adja1[voy] % 4;
       if ( adj1 != k || voy1 != i ) {
         if ( !mmgErr2 ) {
-          fprintf(stderr,"\n  ## Error: %s: 2. at least 1 wrong adjacency %d %d\n",
+          fprintf(stderr,"\n  ## Error: %s: 2. at least 1 wrong adjacency %" MMG5_PRId " %" MMG5_PRId "\n",
                   __func__,_MMG3D_indElt(mesh,k),_MMG3D_indElt(mesh,adj1));
-          fprintf(stderr,"vertices of %d: %d %d %d %d\n",_MMG3D_indElt(mesh,k),
+          fprintf(stderr,"vertices of %" MMG5_PRId ": %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId "\n",_MMG3D_indElt(mesh,k),
                   _MMG3D_indPt(mesh,pt1->v[0]),_MMG3D_indPt(mesh,pt1->v[1]),
                   _MMG3D_indPt(mesh,pt1->v[2]),_MMG3D_indPt(mesh,pt1->v[3]));
-          fprintf(stderr,"vertices of adj %d: %d %d %d %d\n",_MMG3D_indElt(mesh,adj),
+          fprintf(stderr,"vertices of adj %" MMG5_PRId ": %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId "\n",_MMG3D_indElt(mesh,adj),
                   _MMG3D_indPt(mesh,pt2->v[0]),_MMG3D_indPt(mesh,pt2->v[1]),
                   _MMG3D_indPt(mesh,pt2->v[2]),_MMG3D_indPt(mesh,pt2->v[3]));
-          fprintf(stderr,"adj(%d): %d %d %d %d\n",_MMG3D_indElt(mesh,k),
+          fprintf(stderr,"adj(%" MMG5_PRId "): %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId "\n",_MMG3D_indElt(mesh,k),
                   _MMG3D_indElt(mesh,adja[0]/4),_MMG3D_indElt(mesh,adja[1]/4),
                   _MMG3D_indElt(mesh,adja[2]/4),_MMG3D_indElt(mesh,adja[3]/4));
-          fprintf(stderr,"adj(%d): %d %d %d %d\n",_MMG3D_indElt(mesh,adj),
+          fprintf(stderr,"adj(%" MMG5_PRId "): %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId "\n",_MMG3D_indElt(mesh,adj),
                   _MMG3D_indElt(mesh,adja1[0]/4),_MMG3D_indElt(mesh,adja1[1]/4),
                   _MMG3D_indElt(mesh,adja1[2]/4),_MMG3D_indElt(mesh,adja1[3]/4));
           mmgErr2 = 1;
@@ -198,12 +197,12 @@ int _MMG5_mmg3dChkmsh(MMG5_pMesh mesh,int severe,int base) {
            || ((a0 == b1)&&(a1 == b0)&&(a2 ==b2)) || ((a0 == b1)&&(a1 == b2)&&(a2 ==b0)) \
            || ((a0 == b2)&&(a1 == b0)&&(a2 ==b1)) || ((a0 == b2)&&(a1 == b1)&&(a2 ==b0)) )){
         if ( !mmgErr3 ) {
-          fprintf(stderr,"\n  ## Warning: %s: Inconsistent faces : tetra %d face %d;"
-                  " tetra %d face %i \n",__func__,_MMG3D_indElt(mesh,k),i,
+          fprintf(stderr,"\n  ## Warning: %s: Inconsistent faces : tetra %" MMG5_PRId " face %d;"
+                  " tetra %" MMG5_PRId " face %i \n",__func__,_MMG3D_indElt(mesh,k),i,
                   _MMG3D_indElt(mesh,adj),voy);
-          fprintf(stderr,"Tet 1 : %d %d %d \n",_MMG3D_indPt(mesh,a0),
+          fprintf(stderr,"Tet 1 : %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " \n",_MMG3D_indPt(mesh,a0),
                   _MMG3D_indPt(mesh,a1),_MMG3D_indPt(mesh,a2));
-          fprintf(stderr,"Tet 2 : %d %d %d \n",_MMG3D_indPt(mesh,b0),
+          fprintf(stderr,"Tet 2 : %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " \n",_MMG3D_indPt(mesh,b0),
                   _MMG3D_indPt(mesh,b1),_MMG3D_indPt(mesh,b2));
           mmgErr3 = 1;
         }
@@ -223,7 +222,7 @@ int _MMG5_mmg3dChkmsh(MMG5_pMesh mesh,int severe,int base) {
         if(!pt->xt){
           if ( !mmgErr4 ) {
             mmgErr4 = 1;
-            fprintf(stderr,"\n  ## Error: %s: Tetra %d: boundary face"
+            fprintf(stderr,"\n  ## Error: %s: Tetra %" MMG5_PRId ": boundary face"
                     " not tagged: %d \n",__func__,_MMG3D_indElt(mesh,k),i);
           }
           return(0);
@@ -233,7 +232,7 @@ int _MMG5_mmg3dChkmsh(MMG5_pMesh mesh,int severe,int base) {
           if(!(pxt->ftag[i] & MG_BDY)){
             if ( !mmgErr4 ) {
               mmgErr4 = 1;
-              fprintf(stderr,"\n  ## Error: %s: Tetra %d: boundary face"
+              fprintf(stderr,"\n  ## Error: %s: Tetra %" MMG5_PRId ": boundary face"
                       " not tagged : %d \n",__func__,_MMG3D_indElt(mesh,k),i);
             }
             return(0);
@@ -259,9 +258,9 @@ int _MMG5_mmg3dChkmsh(MMG5_pMesh mesh,int severe,int base) {
         if(!pt->xt){
           if ( !mmgErr5 ) {
             mmgErr5 = 1;
-            fprintf(stderr,"\n  ## Error: %s: Tetra %d face %d: common"
+            fprintf(stderr,"\n  ## Error: %s: Tetra %" MMG5_PRId " face %d: common"
                     " face is a limit of two subdomains"
-                    " and has not xt : %d %d %d  \n",__func__,
+                    " and has not xt : %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId "  \n",__func__,
                     _MMG3D_indElt(mesh,k),i,
                     _MMG3D_indPt(mesh,pt->v[_MMG5_idir[i][0]]),
                     _MMG3D_indPt(mesh,pt->v[_MMG5_idir[i][1]]),
@@ -274,9 +273,9 @@ int _MMG5_mmg3dChkmsh(MMG5_pMesh mesh,int severe,int base) {
           if(!(pxt->ftag[i] & MG_BDY)){
             if ( !mmgErr5 ) {
               mmgErr5 = 1;
-              fprintf(stderr,"\n  ## Error: %s: Tetra %d %d : common"
+              fprintf(stderr,"\n  ## Error: %s: Tetra %" MMG5_PRId " %d : common"
                       " face is a limit of two subdomains"
-                      " and is not tagged %d %d %d -->%d\n",__func__,
+                      " and is not tagged %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " -->%d\n",__func__,
                       _MMG3D_indElt(mesh,k),i,
                        _MMG3D_indElt(mesh,pt->v[_MMG5_idir[i][0]]),
                       _MMG3D_indPt(mesh,pt->v[_MMG5_idir[i][1]]),
@@ -302,9 +301,9 @@ int _MMG5_chkptonbdy(MMG5_pMesh mesh,int np){
   MMG5_pTetra      pt;
   MMG5_pxTetra     pxt;
   MMG5_pPoint      p0;
-  int              k;
+  MMG5_int         k;
   char             i,j,ip;
-  static char      mmgWarn0=0,mmgWarn1=0;
+  static _MMG5_TLS char      mmgWarn0=0,mmgWarn1=0;
 
   for(k=1;k<=mesh->np;k++)
     mesh->point[k].flag = 0;
@@ -322,8 +321,8 @@ int _MMG5_chkptonbdy(MMG5_pMesh mesh,int np){
         if(pt->v[ip] == np) {
           if ( !mmgWarn0 ) {
             mmgWarn0 = 1;
-            fprintf(stderr,"\n  ## Error: %s: point %d on face %d of tetra %d :"
-                   " %d %d %d %d \n",__func__, _MMG3D_indPt(mesh,pt->v[ip]),i,
+            fprintf(stderr,"\n  ## Error: %s: point %" MMG5_PRId " on face %d of tetra %" MMG5_PRId " :"
+                   " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " \n",__func__, _MMG3D_indPt(mesh,pt->v[ip]),i,
                    _MMG3D_indElt(mesh,k), _MMG3D_indPt(mesh,pt->v[0]),
                    _MMG3D_indPt(mesh,pt->v[1]),
                    _MMG3D_indPt(mesh,pt->v[2]), _MMG3D_indPt(mesh,pt->v[3]));
@@ -344,7 +343,7 @@ int _MMG5_chkptonbdy(MMG5_pMesh mesh,int np){
     if(p0->tag & MG_BDY){
       if ( !mmgWarn1 ) {
         mmgWarn1 = 1;
-        fprintf(stderr,"\n  ## Error: %s: point %d tagged bdy while belonging to no BDY face\n",
+        fprintf(stderr,"\n  ## Error: %s: point %" MMG5_PRId " tagged bdy while belonging to no BDY face\n",
                 __func__,_MMG3D_indPt(mesh,k));
       }
       return 0;
@@ -363,9 +362,10 @@ int _MMG5_chkptonbdy(MMG5_pMesh mesh,int np){
 int _MMG5_cntbdypt(MMG5_pMesh mesh, int nump){
   MMG5_pTetra  pt;
   MMG5_pxTetra pxt;
-  int          k,nf,v0,v1,v2;
+  int          nf;
+  MMG5_int     v0,v1,v2,k;
   char         i,j,ip;
-  static char  mmgWarn0 = 0;
+  static _MMG5_TLS char  mmgWarn0 = 0;
 
   nf = 0;
 
@@ -385,7 +385,7 @@ int _MMG5_cntbdypt(MMG5_pMesh mesh, int nump){
             v1 = pt->v[_MMG5_idir[i][0]];
             v2 = pt->v[_MMG5_idir[i][0]];
 
-            fprintf(stderr,"\n  ## Error: %s: face %d %d %d in tetra : %d %d %d %d \n",
+            fprintf(stderr,"\n  ## Error: %s: face %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " in tetra : %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " \n",
                    __func__,_MMG3D_indPt(mesh,v0),_MMG3D_indPt(mesh,v1),
                    _MMG3D_indPt(mesh,v2),
                    _MMG3D_indPt(mesh,pt->v[0]),_MMG3D_indPt(mesh,pt->v[1]),
@@ -405,7 +405,8 @@ int _MMG5_chkfemtopo(MMG5_pMesh mesh) {
   MMG5_pTetra      pt,pt1;
   MMG5_pxTetra     pxt;
   MMG5_pPoint      p0,p1;
-  int         k,nf,ntet,ned,np,ischk,ilist,list[MMG3D_LMAX+2],l,np1,npchk,iel;
+  int         nf,ntet,ned,ischk,ilist,l,npchk;
+  MMG5_int    np,np1,list[MMG3D_LMAX+2],k,iel;
   char        i0,j,i,i1,ia;
 
   ntet = ned = 0;
@@ -461,7 +462,7 @@ int _MMG5_chkfemtopo(MMG5_pMesh mesh) {
           if ( npchk == np )  continue;
 
           ia = IEDG(i0,i1);
-          p1->flag = 2*np + ischk;
+          p1->flag = (int)(2*np + ischk);
           if ( !_MMG5_srcbdy(mesh,iel,ia) )  ned++;
         }
       }
@@ -482,10 +483,11 @@ int _MMG5_chkfemtopo(MMG5_pMesh mesh) {
 int srcface(MMG5_pMesh mesh,int n0,int n1,int n2) {
   MMG5_pTetra  pt;
   MMG5_pxTetra pxt;
-  int          k,ip0,ip1,ip2,minn,maxn,sn,mins,maxs,sum,ref;
+  int          minn,maxn,sn,ref;
+  MMG5_int     ip0,ip1,ip2,sum,k,mins,maxs;
   int16_t      tag;
   char         i;
-  static char  mmgWarn0 = 0;
+  static _MMG5_TLS char  mmgWarn0 = 0;
 
   minn = MG_MIN(n0,MG_MIN(n1,n2));
   maxn = MG_MAX(n0,MG_MAX(n1,n2));
@@ -511,7 +513,7 @@ int srcface(MMG5_pMesh mesh,int n0,int n1,int n2) {
       if( mins == minn && maxs == maxn && sum == sn ) {
         if ( !mmgWarn0 ) {
           mmgWarn0 = 1;
-          fprintf(stderr,"\n  ## Error: %s: Face %d in tetra %d with ref %d:"
+          fprintf(stderr,"\n  ## Error: %s: Face %d in tetra %" MMG5_PRId " with ref %d:"
                   " corresponding ref %d , tag: %d\n",__func__,i,
                   _MMG3D_indElt(mesh,k),pt->ref,ref,tag);
         }
@@ -35,16 +35,16 @@
 
 #include "inlined_functions_3d.h"
 
-extern char  ddb;
 
 /** Check whether collapse ip -> iq could be performed, ip internal ;
  *  'mechanical' tests (positive jacobian) are not performed here */
-int _MMG5_chkcol_int(MMG5_pMesh mesh,MMG5_pSol met,int k,char iface,
-                     char iedg,int *list,int ilist,char typchk) {
+int _MMG5_chkcol_int(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,char iface,
+                     char iedg,MMG5_int *list,int ilist,char typchk) {
   MMG5_pTetra   pt,pt0;
   MMG5_pPoint   p0;
   double   calold,calnew,caltmp,ll,lon;
-  int      j,iel,nq,nr;
+  int      j,nr;
+  MMG5_int nq,iel;
   char     i,jj,ip,iq;
 
   iq  = _MMG5_idir[iface][_MMG5_iprv2[iedg]];
@@ -54,7 +54,7 @@ int _MMG5_chkcol_int(MMG5_pMesh mesh,MMG5_pSol met,int k,char iface,
 
   lon = 1.6;
   if ( typchk == 2 && met->m ) {
-    lon = _MMG5_lenedg(mesh,met,_MMG5_iarf[iface][iedg],pt);
+    lon = mesh->func.lenedg(mesh,met,_MMG5_iarf[iface][iedg],pt);
 
     if ( !lon ) return(0);
     /*on cherche a se rapprocher de 1*/
@@ -146,7 +146,7 @@ int _MMG5_chkcol_int(MMG5_pMesh mesh,MMG5_pSol met,int k,char iface,
         /* Rough evaluation of edge length (doesn't take into account if some of
          * the modified edges of pt0 are boundaries): for a more precise
          * computation, we need to update the edge tags of pt0.  */
-        ll = _MMG5_lenedgspl(mesh,met,jj,pt0);
+        ll = mesh->func.lenedgspl(mesh,met,jj,pt0);
         if ( (!ll) || (ll > lon) )//LOPTL too small, we need to put greater than 1.41
           return(0);
       }
@@ -164,11 +164,11 @@ int _MMG5_chkcol_int(MMG5_pMesh mesh,MMG5_pSol met,int k,char iface,
  *  Drive/Documentation/mmg3d/topchkcol_bdy3D.pdf for a picture of the
  *  configuration */
 static int
-_MMG5_topchkcol_bdy(MMG5_pMesh mesh,int k,int iface,char iedg,int *lists,int ilists) {
+_MMG5_topchkcol_bdy(MMG5_pMesh mesh,MMG5_int k,int iface,char iedg,MMG5_int *lists,int ilists) {
   MMG5_pTetra   pt;
   MMG5_pxTetra  pxt;
   double        n0[3],n1[3],devnew;
-  int           nump,numq,piv,iel,jel,jel1,nap,nbp,naq,nbq,nro,adj,*adja;
+  MMG5_int      nump,numq,piv,nap,nbp,nro,naq,nbq,*adja,adj,iel,jel,jel1;
   char          ip,iq,ipiv,iopp,i,j,j1,jface,jface1,ipa,ipb,isface;
 
   pt = &mesh->tetra[k];
@@ -354,8 +354,8 @@ _MMG5_topchkcol_bdy(MMG5_pMesh mesh,int k,int iface,char iedg,int *lists,int ili
  *  (pq, or ia in local tet notation).
  *
  */
-int _MMG5_chkcol_bdy(MMG5_pMesh mesh,MMG5_pSol met,int k,char iface,
-                     char iedg,int *listv,int ilistv,int *lists,int ilists,
+int _MMG5_chkcol_bdy(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,char iface,
+                     char iedg,MMG5_int *listv,int ilistv,MMG5_int *lists,int ilists,
                      char typchk) {
   MMG5_pTetra  pt,pt0,pt1;
   MMG5_pxTetra pxt;
@@ -364,8 +364,10 @@ int _MMG5_chkcol_bdy(MMG5_pMesh mesh,MMG5_pSol met,int k,char iface,
   MMG5_pPar    par;
   double       calold,calnew,caltmp,nadja[3],nprvold[3],nprvnew[3],ncurold[3],ncurnew[3];
   double       ps,devold,devnew,hmax,hausd;
-  int          ipp,nump,numq,l,iel,kk;
-  int          nr,nbbdy,ndepmin,ndepplus,isloc,iedgeOpp;
+  int          l;
+  MMG5_int     nump,numq,ipp,iel,kk;
+  int          nr,nbbdy,isloc,iedgeOpp;
+  MMG5_int     ndepmin,ndepplus;
   int16_t      tag;
   char         iopp,iopp2,ia,ip,i,iq,i0,i1,ier,isminp,isplp;
   pt   = &mesh->tetra[k];
@@ -699,14 +701,15 @@ int _MMG5_chkcol_bdy(MMG5_pMesh mesh,MMG5_pSol met,int k,char iface,
  * (i.e. approximation of the surface, etc... must be performed outside).
  *
  */
-int _MMG5_colver(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist,char indq,char typchk) {
+MMG5_int _MMG5_colver(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int *list,int ilist,char indq,char typchk) {
   MMG5_pTetra          pt,pt1;
   MMG5_pxTetra         pxt,pxt1;
   MMG5_xTetra          xt,xts;
-  int             i,iel,jel,pel,qel,k,np,nq,*adja,p0,p1;
+  int             k;
+  MMG5_int        np,nq,p0,p1,*adja,jel,pel,qel,i,iel;
   unsigned char   ip,iq,j,voy,voyp,voyq,ia,iav;
   unsigned char   (*ind)[2];
-  int             *p0_c,*p1_c;
+  MMG5_int        *p0_c,*p1_c;
   char            indar[4][4][2] = {
     /* indar[ip][iq][0/1]: indices of edges which have iq for extremity but not ip*/
     { {-1,-1}, { 3, 4}, { 3, 5}, { 4, 5} },
@@ -719,8 +722,8 @@ int _MMG5_colver(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist,char indq,cha
     perror("  ## Memory problem: malloc");
     return 0;
   }
-  _MMG5_SAFE_CALLOC(p0_c, ilist, int,-1);
-  _MMG5_SAFE_CALLOC(p1_c, ilist, int,-1);
+  _MMG5_SAFE_CALLOC(p0_c, ilist, MMG5_int,-1);
+  _MMG5_SAFE_CALLOC(p1_c, ilist, MMG5_int,-1);
 
   iel = list[0] / 4;
   ip  = list[0] % 4;
@@ -1161,6 +1164,7 @@ int _MMG5_colver(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist,char indq,cha
     ip  = list[k] % 4;
     pt  = &mesh->tetra[iel];
     pt->v[ip] = nq;
+    _MMG3D_unsetCache(mesh,iel);
     if ( typchk==1 && met->m && met->size > 1 )
       pt->qual=_MMG5_caltet33_ani(mesh,met,pt);
     else
@@ -51,9 +51,62 @@
 #define _MMG3D_KTB    11
 #define _MMG3D_KTC    13
 
+#define _MMG3D_CAVKEY(k) ((unsigned int)(k)*2654435761u & (_MMG3D_CAVSIZ-1))
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param cm pointer toward the cavity marker.
+ * \param k tetra index.
+ * \return 1 if \a k belongs to the cavity, 0 otherwise.
+ *
+ * Check if the tetra \a k is marked as belonging to the cavity.
+ *
+ */
+static inline
+int _MMG3D_cavIn(MMG5_pMesh mesh,_MMG3D_cavMark *cm,MMG5_int k) {
+  unsigned int h;
+
+  if ( !cm->key )  return ( mesh->tetra[k].flag == cm->base );
+
+  h = _MMG3D_CAVKEY(k);
+  while ( cm->gen[h] == cm->cur ) {
+    if ( cm->key[h] == k )   return(1);
+    if ( cm->key[h] == -k )  return(0);
+    h = (h+1) & (_MMG3D_CAVSIZ-1);
+  }
+  return(0);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param cm pointer toward the cavity marker.
+ * \param k tetra index.
+ * \param in 1 to add \a k to the cavity, 0 to remove it.
+ *
+ * Mark (or unmark) the tetra \a k as belonging to the cavity.
+ *
+ */
+static inline
+void _MMG3D_cavSet(MMG5_pMesh mesh,_MMG3D_cavMark *cm,MMG5_int k,int in) {
+  unsigned int h;
+
+  if ( !cm->key ) {
+    mesh->tetra[k].flag = in ? cm->base : cm->base-1;
+    return;
+  }
+
+  h = _MMG3D_CAVKEY(k);
+  while ( cm->gen[h] == cm->cur ) {
+    if ( cm->key[h] == k || cm->key[h] == -k )  break;
+    h = (h+1) & (_MMG3D_CAVSIZ-1);
+  }
+  cm->gen[h] = cm->cur;
+  cm->key[h] = in ? k : -k;
+}
+
 /* hash mesh edge v[0],v[1] (face i of iel) */
-int _MMG5_hashEdgeDelone(MMG5_pMesh mesh,_MMG5_Hash *hash,int iel,int i,int *v) {
-  int             *adja,iadr,jel,j,key,mins,maxs;
+int _MMG5_hashEdgeDelone(MMG5_pMesh mesh,_MMG5_Hash *hash,MMG5_int iel,MMG5_int i,MMG5_int *v) {
+  MMG5_int        mins,maxs,*adja,iadr,jel,j,key;
   _MMG5_hedge     *ha;
 
   /* compute key */
@@ -65,11 +118,10 @@ int _MMG5_hashEdgeDelone(MMG5_pMesh mesh,_MMG5_Hash *hash,int iel,int i,int *v)
     mins = v[1];
     maxs = v[0];
   }
-  key = _MMG3D_KTA*mins + _MMG3D_KTB*maxs;
-  key = key % hash->siz;
+  key = _MMG5_hashKey(hash,mins,maxs);
   ha  = &hash->item[key];
 
-  if ( ha->a ) {
+  while ( ha->a ) {
     /* identical face */
     if ( ha->a == mins && ha->b == maxs ) {
       iadr = (iel-1)*4 + 1;
@@ -83,44 +135,17 @@ int _MMG5_hashEdgeDelone(MMG5_pMesh mesh,_MMG5_Hash *hash,int iel,int i,int *v)
       adja[j] = iel*4 + i;
       return(1);
     }
-    else {
-      while ( ha->nxt && ha->nxt < hash->max ) {
-        ha = &hash->item[ha->nxt];
-        if ( ha->a == mins && ha->b == maxs ) {
-          iadr = (iel-1)*4 + 1;
-          adja = &mesh->adja[iadr];
-          adja[i] = ha->k;
-
-          jel  = ha->k >> 2;
-          j    = ha->k % 4;
-          iadr = (jel-1)*4 + 1;
-          adja = &mesh->adja[iadr];
-          adja[j] = iel*4 + i;
-          return(1);
-        }
-      }
-    }
-    ha->nxt   = hash->nxt;
-    ha        = &hash->item[hash->nxt];
-    ha->a     = mins;
-    ha->b     = maxs;
-    ha->k     = iel*4 + i;
-    hash->nxt = ha->nxt;
-    ha->nxt   = 0;
-
-    if ( hash->nxt >= hash->max ) {
-      _MMG5_TAB_RECALLOC(mesh,hash->item,hash->max,0.2,_MMG5_hedge,"face",
-                         return 0;,0);
-      for (j=hash->nxt; j<hash->max; j++)  hash->item[j].nxt = j+1;
-    }
-    return(1);
+    key = (key+1) & (hash->siz-1);
+    ha  = &hash->item[key];
   }
 
   /* insert */
   ha->a = mins;
   ha->b = maxs;
   ha->k = iel*4 + i;
-  ha->nxt = 0;
+
+  if ( ++hash->nitem >= hash->max )
+    return(_MMG5_hashGrow(mesh,hash));
 
   return(1);
 }
@@ -137,16 +162,18 @@ int _MMG5_hashEdgeDelone(MMG5_pMesh mesh,_MMG5_Hash *hash,int iel,int i,int *v)
  * Insertion of the vertex \a ip. The cavity of \a ip become its ball.
  *
  */
-int _MMG5_delone(MMG5_pMesh mesh,MMG5_pSol sol,int ip,int *list,int ilist) {
+int _MMG5_delone(MMG5_pMesh mesh,MMG5_pSol sol,MMG5_int ip,MMG5_int *list,int ilist) {
   MMG5_pPoint   ppt;
   MMG5_pTetra   pt,pt1;
   MMG5_xTetra   xt;
   MMG5_pxTetra  pxt0;
-  int          *adja,*adjb,i,j,k,l,m,iel,jel,old,v[3],iadr,base,size;
-  int           vois[4],iadrold;
+  int          i,k,l,m,base,size;
+  MMG5_int     v[3],*adja,*adjb,iel,iadr,j,jel,old;
+  MMG5_int      vois[4],iadrold;
   short         i1;
   char          alert;
-  int           tref,isused = 0,ixt,ielnum[3*_MMG3D_LONMAX+1],ll;
+  int           tref,isused = 0,ixt,ll;
+  MMG5_int      ielnum[3*_MMG3D_LONMAX+1];
   _MMG5_Hash    hedg;
 
   base = mesh->base;
@@ -329,13 +356,14 @@ int _MMG5_delone(MMG5_pMesh mesh,MMG5_pSol sol,int ip,int *list,int ilist) {
 
   // ppt = &mesh->point[ip];
   // ppt->flag = mesh->flag;
-  _MMG5_DEL_MEM(mesh,hedg.item,(hedg.max+1)*sizeof(_MMG5_hedge));
+  _MMG5_DEL_MEM(mesh,hedg.item,hedg.siz*sizeof(_MMG5_hedge));
   return(1);
 }
 
 /**
  * \param mesh pointer toward the mesh structure
  * \param met pointer toward the met structure
+ * \param cm pointer toward the marker of the cavity tetra
  * \param ip index of the point to insert
  * \param list poiner toward the cavity of the point
  * \param ilist number of elts in the cavity
@@ -347,18 +375,17 @@ int _MMG5_delone(MMG5_pMesh mesh,MMG5_pSol sol,int ip,int *list,int ilist) {
  * Cavity correction for quality (aniso).
  *
  */
-static int _MMG5_correction_ani(MMG5_pMesh mesh,MMG5_pSol met,int ip,int* list,
-                                int ilist,int nedep,double volmin) {
+static int _MMG5_correction_ani(MMG5_pMesh mesh,MMG5_pSol met,_MMG3D_cavMark *cm,
+                                MMG5_int ip,MMG5_int* list,int ilist,int nedep,double volmin) {
   MMG5_pPoint        ppt,p1,p2,p3;
   MMG5_pTetra        pt;
   double        dd,det,nn,eps,eps2,ux,uy,uz,vx,vy,vz,v1,v2,v3;
   double        *ma,*mb,*mc,*md,mm[6],h1,h2,h3;
-  int           *adja,i,j,ipil,iel,lon,iadr,adj,ib,ic,id,base,ncor;
-  int           vois[4];
+  int           i,j,ipil,lon,ncor;
+  MMG5_int      ib,ic,id,*adja,vois[4],adj,iel,iadr;
 
   ppt  = &mesh->point[ip];
   if ( ppt->tag & MG_NUL )  return(ilist);
-  base = mesh->base;
   lon  = ilist;
   eps  = _MMG3D_EPSCON;
   eps2 = eps*eps;
@@ -385,7 +412,7 @@ static int _MMG5_correction_ani(MMG5_pMesh mesh,MMG5_pSol met,int ip,int* list,
       for (i=0; i<4; i++) {
         adj = vois[i];
         // MMG_cas = 0;// uncomment to debug
-        if ( adj && mesh->tetra[adj].flag == base)  continue;
+        if ( adj && _MMG3D_cavIn(mesh,cm,adj) )  continue;
 
         ib = pt->v[ _MMG5_idir[i][0] ];
         ic = pt->v[ _MMG5_idir[i][1] ];
@@ -443,7 +470,7 @@ static int _MMG5_correction_ani(MMG5_pMesh mesh,MMG5_pSol met,int ip,int* list,
           return(0);
         }
         /* remove iel from list */
-        pt->flag = base-1;
+        _MMG3D_cavSet(mesh,cm,iel,0);
         list[ipil] = list[--lon];
         ncor = 1;
         break;
@@ -461,6 +488,7 @@ static int _MMG5_correction_ani(MMG5_pMesh mesh,MMG5_pSol met,int ip,int* list,
 /**
  * \param mesh pointer toward the mesh structure
  * \param met pointer toward the met structure
+ * \param cm pointer toward the marker of the cavity tetra
  * \param ip index of the point to insert
  * \param list poiner toward the cavity of the point
  * \param ilist number of elts in the cavity
@@ -473,16 +501,16 @@ static int _MMG5_correction_ani(MMG5_pMesh mesh,MMG5_pSol met,int ip,int* list,
  *
  */
 static int
-_MMG5_correction_iso(MMG5_pMesh mesh,int ip,int *list,int ilist,int nedep,double volmin) {
+_MMG5_correction_iso(MMG5_pMesh mesh,_MMG3D_cavMark *cm,MMG5_int ip,MMG5_int *list,int ilist,
+                     int nedep,double volmin) {
   MMG5_pPoint ppt,p1,p2,p3;
   MMG5_pTetra      pt;
   double           dd,nn,eps,eps2,ux,uy,uz,vx,vy,vz,v1,v2,v3;
-  int             *adja,i,ipil,iel,lon,iadr,adj,ib,ic,id,base,ncor;
-  int              vois[4];
+  int             i,ipil,lon,ncor;
+  MMG5_int        ib,ic,id,*adja,vois[4],adj,iel,iadr;
 
   ppt  = &mesh->point[ip];
   if ( ppt->tag & MG_NUL )  return(ilist);
-  base = mesh->base;
   lon  = ilist;
   eps  = _MMG3D_EPSCON;
   eps2 = eps*eps;
@@ -503,7 +531,7 @@ _MMG5_correction_iso(MMG5_pMesh mesh,int ip,int *list,int ilist,int nedep,double
       for (i=0; i<4; i++) {
         adj = vois[i];
         // MMG_cas = 0; // uncomment to debug
-        if ( adj && mesh->tetra[adj].flag == base )  continue;
+        if ( adj && _MMG3D_cavIn(mesh,cm,adj) )  continue;
 
         ib = pt->v[ _MMG5_idir[i][0] ];
         ic = pt->v[ _MMG5_idir[i][1] ];
@@ -544,7 +572,7 @@ _MMG5_correction_iso(MMG5_pMesh mesh,int ip,int *list,int ilist,int nedep,double
         }
 
         /* remove iel from list */
-        pt->flag = base-1;
+        _MMG3D_cavSet(mesh,cm,iel,0);
         list[ipil] = list[--lon];
 
         ncor = 1;
@@ -563,35 +591,39 @@ _MMG5_correction_iso(MMG5_pMesh mesh,int ip,int *list,int ilist,int nedep,double
 /**
  * \param mesh pointer toward the mesh structure.
  * \param met pointer toward the sol structure.
- * \param iel tetra index.
- * \param ip point local index in \a iel.
+ * \param cm pointer toward the marker of the cavity tetra.
+ * \param ip index of the point to insert.
  * \param list pointer toward the list of tetra in the shell of edge where
  * ip will be inserted.
  * \param lon number of tetra in the list.
+ * \param volmin minimal authorized volume.
  * \return ilist number of tetra inside the cavity or -ilist if one of the tet
  * of the cavity is required.
  *
  * Mark elements in cavity and update the list of tetra in the cavity.
  *
  */
-int _MMG5_cavity_ani(MMG5_pMesh mesh,MMG5_pSol met,int iel,int ip,int* list,int lon,double volmin) {
+static int
+_MMG3D_cavityCore_ani(MMG5_pMesh mesh,MMG5_pSol met,_MMG3D_cavMark *cm,MMG5_int ip,
+                      MMG5_int *list,int lon,double volmin) {
   MMG5_pPoint    ppt;
   MMG5_pTetra    pt,pt1;
   double    c[3],eps,dd,ray,ux,uy,uz,crit;
   double    *mj,*mp,ct[12];
-  int       *adja,*adjb,k,adj,adi,voy,i,j,ia,ilist,ipil,jel,iadr,base;
-  int       vois[4],l,isreq,tref;
+  int       k,i,j,ilist,ipil;
+  MMG5_int  ia,iadr,*adja,*adjb,adi,adj,voy,jel;
+  int       isreq,tref;
+  MMG5_int  vois[4],l;
 
   if ( lon < 1 )  return(0);
   ppt = &mesh->point[ip];
   if ( ppt->tag & MG_NUL )  return(0);
-  base  = ++mesh->base;
 
   isreq = 0;
 
   tref = mesh->tetra[list[0]/6].ref;
   for (k=0; k<lon; k++) {
-    mesh->tetra[list[k]/6].flag = base;
+    _MMG3D_cavSet(mesh,cm,list[k]/6,1);
 
     if ( !mesh->info.opnbdy ) {
       if ( tref != mesh->tetra[list[k]/6].ref ) {
@@ -637,7 +669,7 @@ int _MMG5_cavity_ani(MMG5_pMesh mesh,MMG5_pSol met,int iel,int ip,int* list,int
       pt  = &mesh->tetra[adj];
 
       /* boundary face */
-      if ( pt->flag == base )  continue;
+      if ( _MMG3D_cavIn(mesh,cm,adj) )  continue;
       if ( pt->xt && (mesh->xtetra[pt->xt].ftag[voy] & MG_BDY) ) continue;
 
       for (j=0,l=0; j<4; j++,l+=3) {
@@ -687,14 +719,14 @@ int _MMG5_cavity_ani(MMG5_pMesh mesh,MMG5_pSol met,int iel,int ip,int* list,int
         assert(adi !=jel);
 
         pt1 = &mesh->tetra[adi];
-        if ( pt1->flag == base ) {
+        if ( _MMG3D_cavIn(mesh,cm,adi) ) {
           if ( pt1->xt && (mesh->xtetra[pt1->xt].ftag[adjb[j]%4] & MG_BDY) ) break;
         }
       }
       /* store tetra */
       if ( j == 4 ) {
         if ( pt->tag & MG_REQ ) isreq = 1;
-        pt->flag = base;
+        _MMG3D_cavSet(mesh,cm,adj,1);
         list[ilist++] = adj;
       }
     }
@@ -704,7 +736,7 @@ int _MMG5_cavity_ani(MMG5_pMesh mesh,MMG5_pSol met,int iel,int ip,int* list,int
   while ( ipil < ilist );
 
   /* global overflow */
-  ilist = _MMG5_correction_ani(mesh,met,ip,list,ilist,lon,volmin);
+  ilist = _MMG5_correction_ani(mesh,met,cm,ip,list,ilist,lon,volmin);
 
   if ( isreq ) ilist = -abs(ilist);
 
@@ -721,36 +753,191 @@ int _MMG5_cavity_ani(MMG5_pMesh mesh,MMG5_pSol met,int iel,int ip,int* list,int
 
 /**
  * \param mesh pointer toward the mesh structure.
- * \param sol pointer toward the sol structure.
+ * \param met pointer toward the sol structure.
  * \param iel tetra index.
  * \param ip point local index in \a iel.
  * \param list pointer toward the list of tetra in the shell of edge where
  * ip will be inserted.
  * \param lon number of tetra in the list.
+ * \param volmin minimal authorized volume.
+ * \return ilist number of tetra inside the cavity or -ilist if one of the tet
+ * of the cavity is required.
+ *
+ * Mark elements in cavity (with the \a flag field of the tetra) and update
+ * the list of tetra in the cavity.
+ *
+ */
+int _MMG5_cavity_ani(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int iel,MMG5_int ip,MMG5_int *list,int lon,double volmin) {
+  _MMG3D_cavMark cm;
+
+  if ( lon < 1 )  return(0);
+  if ( mesh->point[ip].tag & MG_NUL )  return(0);
+
+  cm.key  = NULL;
+  cm.gen  = NULL;
+  cm.base = ++mesh->base;
+
+  return(_MMG3D_cavityCore_ani(mesh,met,&cm,ip,list,lon,volmin));
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param met pointer toward the sol structure.
+ * \param cm pointer toward the thread-private marker of the cavity tetra.
+ * \param ip index of the point to insert.
+ * \param list pointer toward the list of tetra in the shell of edge where
+ * ip will be inserted.
+ * \param lon number of tetra in the list.
+ * \param volmin minimal authorized volume.
+ * \return ilist number of tetra inside the cavity or -ilist if one of the tet
+ * of the cavity is required.
+ *
+ * Update the list of tetra in the cavity without modifying the mesh: the
+ * cavity tetra are marked in \a cm, so different threads can build cavities
+ * concurrently. The cavity must be marked (\a flag field) before calling
+ * \ref _MMG5_delone.
+ *
+ */
+int _MMG5_cavityPar_ani(MMG5_pMesh mesh,MMG5_pSol met,_MMG3D_cavMark *cm,MMG5_int ip,
+                        MMG5_int *list,int lon,double volmin) {
+
+  /* new generation of the marker table */
+  if ( ++cm->cur == INT_MAX ) {
+    memset(cm->gen,0,_MMG3D_CAVSIZ*sizeof(int));
+    cm->cur = 1;
+  }
+
+  return(_MMG3D_cavityCore_ani(mesh,met,cm,ip,list,lon,volmin));
+}
+
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \return 1 if success, 0 if the cache cannot be allocated.
+ *
+ * Allocate the cache of the tetra circumspheres used by \ref
+ * _MMG5_cavity_iso. The cache covers the \a nemax first tetra, and the
+ * entries are unset when the tetra are created, deleted or modified by \ref
+ * _MMG3D_newElt, \ref _MMG3D_delElt, \ref _MMG5_split1b and \ref
+ * _MMG5_colver. The points must not be moved while the cache is allocated.
+ *
+ */
+int _MMG3D_newSphere(MMG5_pMesh mesh) {
+
+  if ( mesh->sph )  return(1);
+
+  if ( mesh->memCur + (long long)((mesh->nemax+1)*sizeof(_MMG3D_Sphere))
+       > mesh->memMax )
+    return(0);
+
+  _MMG5_ADD_MEM(mesh,(mesh->nemax+1)*sizeof(_MMG3D_Sphere),"sphere cache",
+                return(0));
+  _MMG5_SAFE_CALLOC(mesh->sph,mesh->nemax+1,_MMG3D_Sphere,0);
+  mesh->sphmax = mesh->nemax;
+
+  return(1);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ *
+ * Free the cache of the tetra circumspheres.
+ *
+ */
+void _MMG3D_freeSphere(MMG5_pMesh mesh) {
+
+  if ( !mesh->sph )  return;
+
+  _MMG5_DEL_MEM(mesh,mesh->sph,(mesh->sphmax+1)*sizeof(_MMG3D_Sphere));
+  mesh->sphmax = 0;
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param sph pointer toward the sphere cache (NULL to bypass it).
+ * \param k tetra index.
+ * \param c pointer toward the circumcentre of \a k (stored in the cache or
+ * in \a cbuf).
+ * \param rad pointer toward the squared circumradius of \a k.
+ * \param cbuf buffer for the circumcentre if the cache is not used.
+ * \return 0 if the tetra is degenerate, 1 otherwise.
+ *
+ * Get the circumsphere of the tetra \a k, from the cache if the entry is up
+ * to date, and store it in the cache otherwise.
+ *
+ */
+static inline
+int _MMG3D_sphere_iso(MMG5_pMesh mesh,_MMG3D_pSphere sph,MMG5_int k,double **c,
+                      double *rad,double *cbuf) {
+  MMG5_pTetra    pt;
+  _MMG3D_pSphere ps;
+  double         ct[12];
+  int            j,l;
+
+  pt = &mesh->tetra[k];
+  ps = ( sph && k <= mesh->sphmax ) ? &sph[k] : NULL;
+
+  if ( ps && ps->v[0] == pt->v[0] && ps->v[1] == pt->v[1]
+       && ps->v[2] == pt->v[2] && ps->v[3] == pt->v[3] ) {
+    *c   = ps->c;
+    *rad = ps->rad;
+    return( ps->rad >= 0. );
+  }
+
+  for (j=0,l=0; j<4; j++,l+=3) {
+    memcpy(&ct[l],mesh->point[pt->v[j]].c,3*sizeof(double));
+  }
+  *c = ps ? ps->c : cbuf;
+
+  if ( !_MMG5_cenrad_iso(mesh,ct,*c,rad) )  *rad = -1.;
+
+  if ( ps ) {
+    ps->rad = *rad;
+    memcpy(ps->v,pt->v,4*sizeof(MMG5_int));
+  }
+
+  return( *rad >= 0. );
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param sol pointer toward the sol structure.
+ * \param cm pointer toward the marker of the cavity tetra.
+ * \param ip index of the point to insert.
+ * \param list pointer toward the list of tetra in the shell of edge where
+ * ip will be inserted.
+ * \param lon number of tetra in the list.
+ * \param volmin minimal authorized volume.
  * \return ilist number of tetra inside the cavity or -ilist if one of the tet
  * of the cavity is required.
  *
  * Mark elements in cavity and update the list of tetra in the cavity.
  *
  */
-int _MMG5_cavity_iso(MMG5_pMesh mesh,MMG5_pSol sol,int iel,int ip,int *list,int lon,double volmin) {
+static int
+_MMG3D_cavityCore_iso(MMG5_pMesh mesh,MMG5_pSol sol,_MMG3D_cavMark *cm,MMG5_int ip,
+                      MMG5_int *list,int lon,double volmin) {
   MMG5_pPoint      ppt;
   MMG5_pTetra      pt,pt1;
-  double           c[3],crit,dd,eps,ray,ct[12];
-  int             *adja,*adjb,k,adj,adi,voy,i,j,ilist,ipil,jel,iadr,base;
-  int              vois[4],l;
+  _MMG3D_pSphere   sph;
+  double           cbuf[3],*c,crit,dd,eps,ray;
+  int             k,i,j,ilist,ipil;
+  MMG5_int        *adja,*adjb,adi,adj,voy,jel,iadr;
+  MMG5_int         vois[4],l;
   int              tref,isreq;
 
   if ( lon < 1 )  return(0);
   ppt = &mesh->point[ip];
   if ( ppt->tag & MG_NUL )  return(0);
-  base  = ++mesh->base;
+
+  /* the cache is filled on the fly, so it is not shared between threads */
+  sph = cm->key ? NULL : mesh->sph;
 
   isreq = 0;
 
   tref = mesh->tetra[list[0]/6].ref;
   for (k=0; k<lon; k++) {
-    mesh->tetra[list[k]/6].flag = base;
+    _MMG3D_cavSet(mesh,cm,list[k]/6,1);
 
     if ( !mesh->info.opnbdy ) {
       if ( tref != mesh->tetra[list[k]/6].ref ) {
@@ -793,14 +980,10 @@ int _MMG5_cavity_iso(MMG5_pMesh mesh,MMG5_pSol sol,int iel,int ip,int *list,int
       voy = vois[i] % 4;
       pt  = &mesh->tetra[adj];
       /* boundary face */
-      if ( pt->flag == base )  continue;
+      if ( _MMG3D_cavIn(mesh,cm,adj) )  continue;
       if ( pt->xt && (mesh->xtetra[pt->xt].ftag[voy] & MG_BDY) ) continue;
 
-      for (j=0,l=0; j<4; j++,l+=3) {
-        memcpy(&ct[l],mesh->point[pt->v[j]].c,3*sizeof(double));
-      }
-
-      if ( !_MMG5_cenrad_iso(mesh,ct,c,&ray) )  continue;
+      if ( !_MMG3D_sphere_iso(mesh,sph,adj,&c,&ray,cbuf) )  continue;
       crit = eps * ray;
 
       /* Delaunay criterion */
@@ -822,13 +1005,13 @@ int _MMG5_cavity_iso(MMG5_pMesh mesh,MMG5_pSol sol,int iel,int ip,int *list,int
         assert(adi !=jel);
 
         pt1 = &mesh->tetra[adi];
-        if ( pt1->flag == base )
+        if ( _MMG3D_cavIn(mesh,cm,adi) )
           if ( pt1->xt && (mesh->xtetra[pt1->xt].ftag[adjb[j]%4] & MG_BDY) ) break;
       }
       /* store tetra */
       if ( j == 4 ) {
         if ( pt->tag & MG_REQ ) isreq = 1;
-        pt->flag = base;
+        _MMG3D_cavSet(mesh,cm,adj,1);
         list[ilist++] = adj;
       }
     }
@@ -839,7 +1022,7 @@ int _MMG5_cavity_iso(MMG5_pMesh mesh,MMG5_pSol sol,int iel,int ip,int *list,int
   while ( ipil < ilist );
 
   /* global overflow: obsolete avec la reallocation */
-  ilist = _MMG5_correction_iso(mesh,ip,list,ilist,lon,volmin);
+  ilist = _MMG5_correction_iso(mesh,cm,ip,list,ilist,lon,volmin);
 
   if ( isreq ) ilist = -abs(ilist);
 
@@ -852,4 +1035,63 @@ int _MMG5_cavity_iso(MMG5_pMesh mesh,MMG5_pSol sol,int iel,int ip,int *list,int
   return(ilist);
 }
 
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param sol pointer toward the sol structure.
+ * \param iel tetra index.
+ * \param ip point local index in \a iel.
+ * \param list pointer toward the list of tetra in the shell of edge where
+ * ip will be inserted.
+ * \param lon number of tetra in the list.
+ * \param volmin minimal authorized volume.
+ * \return ilist number of tetra inside the cavity or -ilist if one of the tet
+ * of the cavity is required.
+ *
+ * Mark elements in cavity (with the \a flag field of the tetra) and update
+ * the list of tetra in the cavity.
+ *
+ */
+int _MMG5_cavity_iso(MMG5_pMesh mesh,MMG5_pSol sol,MMG5_int iel,MMG5_int ip,MMG5_int *list,int lon,double volmin) {
+  _MMG3D_cavMark cm;
+
+  if ( lon < 1 )  return(0);
+  if ( mesh->point[ip].tag & MG_NUL )  return(0);
+
+  cm.key  = NULL;
+  cm.gen  = NULL;
+  cm.base = ++mesh->base;
+
+  return(_MMG3D_cavityCore_iso(mesh,sol,&cm,ip,list,lon,volmin));
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param sol pointer toward the sol structure.
+ * \param cm pointer toward the thread-private marker of the cavity tetra.
+ * \param ip index of the point to insert.
+ * \param list pointer toward the list of tetra in the shell of edge where
+ * ip will be inserted.
+ * \param lon number of tetra in the list.
+ * \param volmin minimal authorized volume.
+ * \return ilist number of tetra inside the cavity or -ilist if one of the tet
+ * of the cavity is required.
+ *
+ * Update the list of tetra in the cavity without modifying the mesh: the
+ * cavity tetra are marked in \a cm, so different threads can build cavities
+ * concurrently. The cavity must be marked (\a flag field) before calling
+ * \ref _MMG5_delone.
+ *
+ */
+int _MMG5_cavityPar_iso(MMG5_pMesh mesh,MMG5_pSol sol,_MMG3D_cavMark *cm,MMG5_int ip,
+                        MMG5_int *list,int lon,double volmin) {
+
+  /* new generation of the marker table */
+  if ( ++cm->cur == INT_MAX ) {
+    memset(cm->gen,0,_MMG3D_CAVSIZ*sizeof(int));
+    cm->cur = 1;
+  }
+
+  return(_MMG3D_cavityCore_iso(mesh,sol,cm,ip,list,lon,volmin));
+}
+
 #endif
@@ -36,7 +36,6 @@
 
 #define _MMG5_KC    13
 
-extern char  ddb;
 
 /**
  * \param mesh pointer toward the mesh structure.
@@ -49,7 +48,7 @@ extern char  ddb;
 static int
 _MMG5_paktet(MMG5_pMesh mesh) {
   MMG5_pTetra   pt,pt1;
-  int      k;
+  MMG5_int k;
 
   k = 1;
   do {
@@ -91,41 +90,23 @@ _MMG5_paktet(MMG5_pMesh mesh) {
  *
  *
  **/
-static int _MMG5_hashFace(MMG5_pMesh mesh,_MMG5_Hash *hash,int ia,int ib,int ic,int k) {
+static MMG5_int _MMG5_hashFace(MMG5_pMesh mesh,_MMG5_Hash *hash,MMG5_int ia,MMG5_int ib,MMG5_int ic,MMG5_int k) {
   _MMG5_hedge     *ph;
-  int        key,mins,maxs,sum,j;
+  MMG5_int   sum,key,mins,maxs;
 
   mins = MG_MIN(ia,MG_MIN(ib,ic));
   maxs = MG_MAX(ia,MG_MAX(ib,ic));
 
   /* compute key */
   sum = ia + ib + ic;
-  key = (_MMG5_KA*mins + _MMG5_KB*maxs) % hash->siz;
+  key = _MMG5_hashKey(hash,mins,maxs);
   ph  = &hash->item[key];
 
-  if ( ph->a ) {
+  while ( ph->a ) {
     if ( ph->a == mins && ph->b == maxs && ph->s == sum )
       return(ph->k);
-    else {
-      while ( ph->nxt && ph->nxt < hash->max ) {
-        ph = &hash->item[ph->nxt];
-        if ( ph->a == mins && ph->b == maxs && ph->s == sum )  return(ph->k);
-      }
-    }
-    ph->nxt = hash->nxt;
-    ph      = &hash->item[hash->nxt];
-    ph->a   = mins;
-    ph->b   = maxs;
-    ph->s   = sum;
-    ph->k   = k;
-    hash->nxt = ph->nxt;
-    ph->nxt = 0;
-
-    if ( hash->nxt >= hash->max ) {
-      _MMG5_TAB_RECALLOC(mesh,hash->item,hash->max,0.2,_MMG5_hedge,"face",return(0);,0);
-      for (j=hash->nxt; j<hash->max; j++)  hash->item[j].nxt = j+1;
-    }
-    return(-1);
+    key = (key+1) & (hash->siz-1);
+    ph  = &hash->item[key];
   }
 
   /* insert new face */
@@ -133,15 +114,17 @@ static int _MMG5_hashFace(MMG5_pMesh mesh,_MMG5_Hash *hash,int ia,int ib,int ic,
   ph->b = maxs;
   ph->s = sum;
   ph->k = k;
-  ph->nxt = 0;
+
+  if ( ++hash->nitem >= hash->max && !_MMG5_hashGrow(mesh,hash) )
+    return(0);
 
   return(-1);
 }
 
 /** return index of triangle ia ib ic */
-static int _MMG5_hashGetFace(_MMG5_Hash *hash,int ia,int ib,int ic) {
+static MMG5_int _MMG5_hashGetFace(_MMG5_Hash *hash,MMG5_int ia,MMG5_int ib,MMG5_int ic) {
   _MMG5_hedge  *ph;
-  int     key,mins,maxs,sum;
+  MMG5_int sum,key,mins,maxs;
 
   if ( !hash->item )  return(0);
 
@@ -150,23 +133,48 @@ static int _MMG5_hashGetFace(_MMG5_Hash *hash,int ia,int ib,int ic) {
 
   /* compute key */
   sum = ia + ib + ic;
-  key = (_MMG5_KA*mins + _MMG5_KB*maxs) % hash->siz;
+  key = _MMG5_hashKey(hash,mins,maxs);
   ph  = &hash->item[key];
 
-  if ( ph->a ) {
+  while ( ph->a ) {
     if ( ph->a == mins && ph->b == maxs && ph->s == sum )
       return(ph->k);
-    else {
-      while ( ph->nxt ) {
-        ph = &hash->item[ph->nxt];
-        if ( ph->a == mins && ph->b == maxs && ph->s == sum )  return(ph->k);
-      }
-    }
+    key = (key+1) & (hash->siz-1);
+    ph  = &hash->item[key];
   }
 
   return(0);
 }
 
+#ifdef _OPENMP
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param k index of the tetrahedron.
+ * \param i index of the face in the tetrahedron.
+ * \param f sorted vertices of the face.
+ * \return 0 if the tetra is unused, 1 otherwise.
+ *
+ * Face vertices for the parallel hashing of the tetrahedra.
+ *
+ */
+static int _MMG3D_hashTetraFace(MMG5_pMesh mesh,MMG5_int k,int i,MMG5_int *f) {
+  MMG5_pTetra pt;
+  MMG5_int    a,b,c;
+
+  pt = &mesh->tetra[k];
+  if ( !MG_EOK(pt) )  return(0);
+
+  a = pt->v[_MMG5_idir[i][0]];
+  b = pt->v[_MMG5_idir[i][1]];
+  c = pt->v[_MMG5_idir[i][2]];
+  f[0] = MG_MIN(a,MG_MIN(b,c));
+  f[2] = MG_MAX(a,MG_MAX(b,c));
+  f[1] = ( a < b ) ? ( b < c ? b : MG_MAX(a,c) ) : ( a < c ? a : MG_MAX(b,c) );
+
+  return(1);
+}
+#endif
+
 /**
  * \param mesh pointer toward the mesh structure.
  * \param pack we pack the mesh at function begining if \f$pack=1\f$.
@@ -178,8 +186,10 @@ static int _MMG5_hashGetFace(_MMG5_Hash *hash,int ia,int ib,int ic) {
  */
 int MMG3D_hashTetra(MMG5_pMesh mesh, int pack) {
   MMG5_pTetra    pt,pt1;
-  int            k,kk,pp,l,ll,mins,mins1,maxs,maxs1,sum,sum1,iadr;
-  int           *hcode,*link,hsize,inival;
+  int            l,iadr;
+  MMG5_int       sum,sum1,ll,kk,pp,k,mins,mins1,maxs,maxs1;
+  int           *hcode,inival;
+  MMG5_int      hsize,*link;
   unsigned char  i,ii,i1,i2,i3;
   unsigned int   key;
 
@@ -197,10 +207,21 @@ int MMG3D_hashTetra(MMG5_pMesh mesh, int pack) {
   }
 
   /* memory alloc */
-  _MMG5_ADD_MEM(mesh,(4*mesh->nemax+5)*sizeof(int),"adjacency table",
+  _MMG5_ADD_MEM(mesh,(4*mesh->nemax+5)*sizeof(MMG5_int),"adjacency table",
                 fprintf(stderr,"  Exit program.\n");
                 return 0);
-  _MMG5_SAFE_CALLOC(mesh->adja,4*mesh->nemax+5,int,0);
+  _MMG5_SAFE_CALLOC(mesh->adja,4*mesh->nemax+5,MMG5_int,0);
+
+#ifdef _OPENMP
+  /* the faces are numbered from the tetra index: the mesh must be packed */
+  if ( mesh->info.nthreads > 1 ) {
+    for (k=1; k<=mesh->ne; k++)
+      if ( !MG_EOK(&mesh->tetra[k]) )  break;
+    if ( k > mesh->ne )
+      return(_MMG5_hashAdjaPar(mesh,mesh->ne,4,mesh->adja,_MMG3D_hashTetraFace));
+  }
+#endif
+
   _MMG5_SAFE_CALLOC(hcode,mesh->ne+5,int,0);
 
   link  = mesh->adja;
@@ -293,10 +314,12 @@ int MMG3D_hashTetra(MMG5_pMesh mesh, int pack) {
  */
 int MMG3D_hashPrism(MMG5_pMesh mesh) {
   MMG5_pPrism    pp,pp1;
-  int            k,kk,l,ll,jj;
-  int            max12,min12,max34,min34,mins,mins1,mins_b, mins_b1,maxs,maxs1;
+  int            l;
+  MMG5_int       ll,kk,jj,k;
+  MMG5_int       mins_b,mins_b1,max12,min12,max34,min34,mins,mins1,maxs,maxs1;
   int            iadr;
-  int           *hcode,*link,hsize,inival;
+  int           *hcode,inival;
+  MMG5_int      hsize,*link;
   unsigned char  i,ii,i1,i2,i3,i4;
   unsigned int   key;
 
@@ -315,10 +338,10 @@ int MMG3D_hashPrism(MMG5_pMesh mesh) {
     fprintf(stdout,"  ** SETTING PRISMS ADJACENCY\n");
 
   /* memory alloc */
-  _MMG5_ADD_MEM(mesh,(5*mesh->nprism+6)*sizeof(int),"prism adjacency table",
+  _MMG5_ADD_MEM(mesh,(5*mesh->nprism+6)*sizeof(MMG5_int),"prism adjacency table",
                 printf("  Exit program.\n");
                 return 0);
-  _MMG5_SAFE_CALLOC(mesh->adjapr,5*mesh->nprism+6,int,0);
+  _MMG5_SAFE_CALLOC(mesh->adjapr,5*mesh->nprism+6,MMG5_int,0);
   _MMG5_SAFE_CALLOC(hcode,mesh->nprism+6,int,0);
 
   link  = mesh->adjapr;
@@ -516,12 +539,15 @@ int _MMG5_setEdgeNmTag(MMG5_pMesh mesh, _MMG5_Hash *hash) {
   MMG5_pxTetra        pxt;
   MMG5_pTria          ptt;
   _MMG5_hedge         *ph;
-  int                 adj,pradj,piv,ilist,list[MMG3D_LMAX+2];
-  int                 k,i,l,i1,i2,na,nb,ia,it1,it2, nr;
-  int                 ipa,ipb,nbdy,start;
+  int                 ilist;
+  MMG5_int            adj,piv,list[MMG3D_LMAX+2],pradj;
+  int                 i,l,i1,i2,ia, nr;
+  MMG5_int            it1,it2,k,na,nb;
+  int                 ipa,ipb,nbdy;
+  MMG5_int            start;
   unsigned int        key;
   char                iface,hasadja;
-  static char         mmgWarn0=0,mmgWarn1=0;
+  static _MMG5_TLS char         mmgWarn0=0,mmgWarn1=0;
 
   nr = 0;
 
@@ -540,15 +566,16 @@ int _MMG5_setEdgeNmTag(MMG5_pMesh mesh, _MMG5_Hash *hash) {
         /* compute key */
         na  = MG_MIN(ptt->v[i1],ptt->v[i2]);
         nb  = MG_MAX(ptt->v[i1],ptt->v[i2]);
-        key = (_MMG5_KA*na + _MMG5_KB*nb) % hash->siz;
+        key = _MMG5_hashKey(hash,na,nb);
         ph  = &hash->item[key];
 
         assert(ph->a);
         while ( ph->a ) {
           if ( ph->a == na && ph->b == nb ) break;
-          assert(ph->nxt);
-          ph = &hash->item[ph->nxt];
+          key = (key+1) & (hash->siz-1);
+          ph  = &hash->item[key];
         }
+        assert(ph->a);
         /* Set edge tag and point tags to MG_REQ if the non-manifold edge shared
          * separated domains */
         if ( ph->s > 3 ) {
@@ -607,7 +634,7 @@ int _MMG5_setEdgeNmTag(MMG5_pMesh mesh, _MMG5_Hash *hash) {
                   if ( !mmgWarn1 ) {
                     mmgWarn1 = 1;
                     fprintf(stderr,"\n  ## Warning: %s: problem in surface remesh"
-                            " process. At least 1 shell of edge (%d-%d) contains"
+                            " process. At least 1 shell of edge (%" MMG5_PRId "-%" MMG5_PRId ") contains"
                             " too many elts.\n",__func__,_MMG3D_indPt(mesh,na),
                             _MMG3D_indPt(mesh,nb));
                     fprintf(stderr,"\n  ##          Try to modify the hausdorff"
@@ -657,7 +684,7 @@ int _MMG5_setEdgeNmTag(MMG5_pMesh mesh, _MMG5_Hash *hash) {
     fprintf(stdout,"     %d required edges added\n",nr);
 
   /* Free the edge hash table */
-  _MMG5_DEL_MEM(mesh,hash->item,(hash->max+1)*sizeof(_MMG5_hedge));
+  _MMG5_DEL_MEM(mesh,hash->item,hash->siz*sizeof(_MMG5_hedge));
   return(1);
 }
 
@@ -676,7 +703,8 @@ static inline
 int _MMG5_setVertexNmTag(MMG5_pMesh mesh) {
   MMG5_pTetra         ptet;
   MMG5_pPoint         ppt;
-  int                 k,i;
+  int                 i;
+  MMG5_int            k;
   int                 nc, nre, ng, nrp,ier;
 
   /* Second: seek the non-required non-manifold points and try to analyse
@@ -765,69 +793,54 @@ int _MMG5_setNmTag(MMG5_pMesh mesh, _MMG5_Hash *hash) {
  */
 int _MMG3D_hashTria(MMG5_pMesh mesh, _MMG5_Hash *hash) {
 
-  _MMG5_ADD_MEM(mesh,(3*mesh->nt+4)*sizeof(int),"surfacic adjacency table",return(0));
-  _MMG5_SAFE_CALLOC(mesh->adjt,3*mesh->nt+4,int,0);
+  _MMG5_ADD_MEM(mesh,(3*mesh->nt+4)*sizeof(MMG5_int),"surfacic adjacency table",return(0));
+  _MMG5_SAFE_CALLOC(mesh->adjt,3*mesh->nt+4,MMG5_int,0);
 
   return( _MMG5_mmgHashTria(mesh, mesh->adjt, hash, mesh->info.iso) );
 }
 
 
 /** remove edge from hash table */
-int _MMG5_hashPop(_MMG5_Hash *hash,int a,int b) {
-  _MMG5_hedge  *ph,*php;
-  int          key,ia,ib,iph,iphp;
+int _MMG5_hashPop(_MMG5_Hash *hash,MMG5_int a,MMG5_int b) {
+  _MMG5_hedge  *ph;
+  int          h;
+  MMG5_int     key,j,i,ia,ib;
 
   ia  = MG_MIN(a,b);
   ib  = MG_MAX(a,b);
-  key = (_MMG5_KA*ia + _MMG5_KB*ib) % hash->siz;
+  key = _MMG5_hashKey(hash,ia,ib);
   ph  = &hash->item[key];
 
-  if ( !ph->a ) return(0);
-  else if ( ph->a == ia && ph->b == ib ) {
-    if ( !ph->nxt ) {
-      memset(ph,0,sizeof(_MMG5_hedge));
-      return(1);
-    }
-    else {
-      iph = ph->nxt;
-      php = ph;
-      ph  = &hash->item[ph->nxt];
-      memcpy(php,ph,sizeof(_MMG5_hedge));
-      memset(ph,0,sizeof(_MMG5_hedge));
-      ph->nxt   = hash->nxt;
-      hash->nxt = iph;
-      return(1);
-    }
+  while ( ph->a ) {
+    if ( ph->a == ia && ph->b == ib )  break;
+    key = (key+1) & (hash->siz-1);
+    ph  = &hash->item[key];
   }
-  while ( ph->nxt ) {
-    php = ph;
-    ph  = &hash->item[ph->nxt];
-    if ( ph->a == ia && ph->b == ib ) {
-      if ( !ph->nxt ) {
-        memset(ph,0,sizeof(_MMG5_hedge));
-        ph->nxt   = hash->nxt;
-        hash->nxt = php->nxt;
-        php->nxt  = 0;
-      }
-      else {
-        iph  = ph->nxt;
-        iphp = php->nxt;
-        php->nxt = iph;
-        memset(ph,0,sizeof(_MMG5_hedge));
-        ph->nxt   = hash->nxt;
-        hash->nxt = iphp;
-      }
-      return(1);
+  if ( !ph->a )  return(0);
+
+  /* shift back the following items of the cluster that can't be reached
+   * anymore from their first slot */
+  i = j = key;
+  while ( 1 ) {
+    j = (j+1) & (hash->siz-1);
+    if ( !hash->item[j].a )  break;
+    h = _MMG5_hashKey(hash,hash->item[j].a,hash->item[j].b);
+    if ( ((j-h) & (hash->siz-1)) >= ((j-i) & (hash->siz-1)) ) {
+      hash->item[i] = hash->item[j];
+      i = j;
     }
   }
-  return(0);
+  memset(&hash->item[i],0,sizeof(_MMG5_hedge));
+  --hash->nitem;
+
+  return(1);
 }
 
 
 /** set tag to edge on geometry */
-int _MMG5_hTag(MMG5_HGeom *hash,int a,int b,int ref,int16_t tag) {
+int _MMG5_hTag(MMG5_HGeom *hash,MMG5_int a,MMG5_int b,int ref,int16_t tag) {
   MMG5_hgeom  *ph;
-  int     key,ia,ib;
+  MMG5_int key,ia,ib;
 
   ia  = MG_MIN(a,b);
   ib  = MG_MAX(a,b);
@@ -855,7 +868,8 @@ int _MMG5_hTag(MMG5_HGeom *hash,int a,int b,int ref,int16_t tag) {
 /** remove edge from hash table */
 int _MMG5_hPop(MMG5_HGeom *hash,int a,int b,int *ref,int16_t *tag) {
   MMG5_hgeom  *ph,*php;
-  int     key,ia,ib,iph,iphp;
+  int     ia,ib;
+  MMG5_int key,iph,iphp;
 
   *ref = 0;
   *tag = 0;
@@ -912,9 +926,9 @@ int _MMG5_hPop(MMG5_HGeom *hash,int a,int b,int *ref,int16_t *tag) {
 }
 
 /** get ref and tag to edge on geometry */
-int _MMG5_hGet(MMG5_HGeom *hash,int a,int b,int *ref,int16_t *tag) {
+int _MMG5_hGet(MMG5_HGeom *hash,MMG5_int a,MMG5_int b,int *ref,int16_t *tag) {
   MMG5_hgeom  *ph;
-  int     key,ia,ib;
+  MMG5_int key,ia,ib;
 
   *tag = 0;
   *ref = 0;
@@ -944,9 +958,9 @@ int _MMG5_hGet(MMG5_HGeom *hash,int a,int b,int *ref,int16_t *tag) {
 }
 
 /** store edge on geometry */
-int _MMG5_hEdge(MMG5_pMesh mesh,MMG5_HGeom *hash,int a,int b,int ref,int16_t tag) {
+int _MMG5_hEdge(MMG5_pMesh mesh,MMG5_HGeom *hash,MMG5_int a,MMG5_int b,int ref,int16_t tag) {
   MMG5_hgeom  *ph;
-  int     key,ia,ib,j;
+  MMG5_int key,j,ia,ib;
 
   assert ( hash->siz );
 
@@ -970,7 +984,7 @@ int _MMG5_hEdge(MMG5_pMesh mesh,MMG5_HGeom *hash,int a,int b,int ref,int16_t tag
     ph->nxt = 0;
     if ( hash->nxt >= hash->max ) {
       if ( mesh->info.ddebug )
-        fprintf(stderr,"\n  ## Memory alloc problem (edge): %d\n",hash->max);
+        fprintf(stderr,"\n  ## Memory alloc problem (edge): %" MMG5_PRId "\n",hash->max);
       _MMG5_TAB_RECALLOC(mesh,hash->geom,hash->max,0.2,MMG5_hgeom,
                          "larger htab table",
                          fprintf(stderr,"  Exit program.\n");return 0;,0);
@@ -986,8 +1000,8 @@ int _MMG5_hEdge(MMG5_pMesh mesh,MMG5_HGeom *hash,int a,int b,int ref,int16_t tag
 }
 
 /** to store edge on geometry */
-int _MMG5_hNew(MMG5_pMesh mesh,MMG5_HGeom *hash,int hsiz,int hmax) {
-  int   k;
+int _MMG5_hNew(MMG5_pMesh mesh,MMG5_HGeom *hash,MMG5_int hsiz,MMG5_int hmax) {
+  MMG5_int k;
 
   /* adjust hash table params */
   hash->siz  = hsiz + 1;
@@ -1018,7 +1032,8 @@ int _MMG5_hGeom(MMG5_pMesh mesh) {
   MMG5_pTria   pt;
   MMG5_pEdge   pa;
   _MMG5_Hash   hash;
-  int         *adja,k,kk,edg,ier;
+  int         edg,ier;
+  MMG5_int    *adja,kk,k;
   int16_t      tag;
   char         i,i1,i2;
 
@@ -1077,7 +1092,7 @@ int _MMG5_hGeom(MMG5_pMesh mesh) {
   else {
     if ( !mesh->adjt ) {
       ier = _MMG3D_hashTria(mesh,&hash);
-      _MMG5_DEL_MEM(mesh,hash.item,(hash.max+1)*sizeof(_MMG5_hedge));
+      _MMG5_DEL_MEM(mesh,hash.item,hash.siz*sizeof(_MMG5_hedge));
       if ( !ier ) return(0);
     }
 
@@ -1158,7 +1173,8 @@ int _MMG5_bdryTria(MMG5_pMesh mesh, int ntmesh) {
   MMG5_pxTetra   pxt;
   MMG5_pxPrism   pxpr;
   _MMG5_Hash     hash;
-  int       ref,*adja,adj,k,ia,ib,ic,kt, tofree=0,ntinit;
+  int       ref, tofree=0;
+  MMG5_int  ia,ib,ic,ntinit,*adja,adj,kt,k;
   char      i;
 
   hash.item = NULL;
@@ -1181,7 +1197,7 @@ int _MMG5_bdryTria(MMG5_pMesh mesh, int ntmesh) {
   for (k=1; k<=mesh->nt; k++) {
     ptt = &mesh->tria[k];
     if ( !_MMG5_hashFace(mesh,&hash,ptt->v[0],ptt->v[1],ptt->v[2],k) ) {
-      _MMG5_DEL_MEM(mesh,hash.item,(hash.max+1)*sizeof(_MMG5_hedge));
+      _MMG5_DEL_MEM(mesh,hash.item,hash.siz*sizeof(_MMG5_hedge));
       return(0);
     }
     for (i=0; i<3; i++) {
@@ -1222,7 +1238,7 @@ int _MMG5_bdryTria(MMG5_pMesh mesh, int ntmesh) {
           /* Update the list of boundary trias to be able to recover tria at the
            * interface between tet and prisms */
           if ( !_MMG5_hashFace(mesh,&hash,ia,ib,ic,mesh->nt+1) ) {
-            _MMG5_DEL_MEM(mesh,hash.item,(hash.max+1)*sizeof(_MMG5_hedge));
+            _MMG5_DEL_MEM(mesh,hash.item,hash.siz*sizeof(_MMG5_hedge));
             return(0);
           }
         }
@@ -1361,7 +1377,7 @@ int _MMG5_bdryTria(MMG5_pMesh mesh, int ntmesh) {
     }
   }
 
-  if ( tofree ) _MMG5_DEL_MEM(mesh,hash.item,(hash.max+1)*sizeof(_MMG5_hedge));
+  if ( tofree ) _MMG5_DEL_MEM(mesh,hash.item,hash.siz*sizeof(_MMG5_hedge));
 
   return(1);
 }
@@ -1380,9 +1396,10 @@ int _MMG5_chkBdryTria(MMG5_pMesh mesh) {
   MMG5_pTetra    pt,pt1;
   MMG5_pPrism    pp,pp1;
   MMG5_pTria     ptt,pttnew;
-  int            *adja,adj,k,kk,i,j,ntmesh;
-  int            ia,ib,ic, nbl,nt,ntpres;
-  int            iface;
+  int            ntmesh;
+  MMG5_int       adj,*adja,i,j,kk,k;
+  int            nt,ntpres;
+  MMG5_int       ia,ib,ic,nbl,iface;
   _MMG5_Hash     hashElt, hashTri;
 
   /** Step 1: scan the mesh and count the boundaries */
@@ -1444,7 +1461,7 @@ int _MMG5_chkBdryTria(MMG5_pMesh mesh) {
         else if ( adj<0 ) continue;
 
         adj /= 5;
-        pp1 = &mesh->prism[abs(adj)];
+        pp1 = &mesh->prism[MMG5_abs(adj)];
         if ( pp->ref > pp1->ref) {
           ++ntmesh;
         }
@@ -1468,7 +1485,7 @@ int _MMG5_chkBdryTria(MMG5_pMesh mesh) {
       ib = pt->v[_MMG5_idir[i][1]];
       ic = pt->v[_MMG5_idir[i][2]];
       if ( !_MMG5_hashFace(mesh,&hashTri,ia,ib,ic,5*k+i) ) {
-        _MMG5_DEL_MEM(mesh,hashTri.item,(hashTri.max+1)*sizeof(_MMG5_hedge));
+        _MMG5_DEL_MEM(mesh,hashTri.item,hashTri.siz*sizeof(_MMG5_hedge));
         return(0);
       }
     }
@@ -1493,7 +1510,7 @@ int _MMG5_chkBdryTria(MMG5_pMesh mesh) {
       adja[i] = -j;
     }
   }
-  _MMG5_DEL_MEM(mesh,hashTri.item,(hashTri.max+1)*sizeof(_MMG5_hedge));
+  _MMG5_DEL_MEM(mesh,hashTri.item,hashTri.siz*sizeof(_MMG5_hedge));
 
   /** Step 2: detect the extra boundaries (that will be ignored) provided by the
    * user */
@@ -1554,7 +1571,7 @@ int _MMG5_chkBdryTria(MMG5_pMesh mesh) {
 
         adj /= 5;
 
-        pp1 = &mesh->prism[abs(adj)];
+        pp1 = &mesh->prism[MMG5_abs(adj)];
         if ( pp->ref > pp1->ref ) {
           ia = pp->v[_MMG5_idir_pr[i][0]];
           ib = pp->v[_MMG5_idir_pr[i][1]];
@@ -1584,8 +1601,8 @@ int _MMG5_chkBdryTria(MMG5_pMesh mesh) {
       ptt->cc = i;
 
       if ( !j ) {
-        _MMG5_DEL_MEM(mesh,hashElt.item,(hashElt.max+1)*sizeof(_MMG5_hedge));
-        _MMG5_DEL_MEM(mesh,hashTri.item,(hashTri.max+1)*sizeof(_MMG5_hedge));
+        _MMG5_DEL_MEM(mesh,hashElt.item,hashElt.siz*sizeof(_MMG5_hedge));
+        _MMG5_DEL_MEM(mesh,hashTri.item,hashTri.siz*sizeof(_MMG5_hedge));
         return(0);
       }
       else if ( j > 0 ) {
@@ -1620,15 +1637,15 @@ int _MMG5_chkBdryTria(MMG5_pMesh mesh) {
     }
     nbl = mesh->nt-nt;
     if ( nbl ) {
-      fprintf(stderr,"\n  ## Warning: %s: %d extra boundaries provided."
+      fprintf(stderr,"\n  ## Warning: %s: %" MMG5_PRId " extra boundaries provided."
               " Ignored\n",__func__,nbl);
       _MMG5_ADD_MEM(mesh,(-nbl)*sizeof(MMG5_Tria),"triangles",return(0));
       mesh->nt = nt;
       _MMG5_SAFE_REALLOC(mesh->tria,mesh->nt+1,MMG5_Tria,"triangles",0);
 
     }
-    _MMG5_DEL_MEM(mesh,hashElt.item,(hashElt.max+1)*sizeof(_MMG5_hedge));
-    _MMG5_DEL_MEM(mesh,hashTri.item,(hashTri.max+1)*sizeof(_MMG5_hedge));
+    _MMG5_DEL_MEM(mesh,hashElt.item,hashElt.siz*sizeof(_MMG5_hedge));
+    _MMG5_DEL_MEM(mesh,hashTri.item,hashTri.siz*sizeof(_MMG5_hedge));
   }
   ntmesh +=ntpres;
 
@@ -1662,7 +1679,7 @@ int _MMG5_chkBdryTria(MMG5_pMesh mesh) {
     }
   }
   if ( nbl && (mesh->info.imprim > 5 || mesh->info.ddebug) )
-    fprintf(stderr,"\n  ## Warning: %s: %d extra boundaries founded\n",
+    fprintf(stderr,"\n  ## Warning: %s: %" MMG5_PRId " extra boundaries founded\n",
             __func__,nbl);
 
   return(_MMG5_bdryTria(mesh,ntmesh));
@@ -1683,7 +1700,8 @@ int _MMG5_bdrySet(MMG5_pMesh mesh) {
   MMG5_pxTetra  pxt;
   MMG5_pxPrism  pxp;
   _MMG5_Hash     hash;
-  int      ref,*adja,adj,k,kt,ia,ib,ic,j,na,initedg[3];
+  int      ref,j,na,initedg[3];
+  MMG5_int ia,ib,ic,*adja,adj,kt,k;
   int16_t  tag,inittag[3];
   char     i,i1,i2;
 
@@ -1901,7 +1919,7 @@ int _MMG5_bdrySet(MMG5_pMesh mesh) {
   }
 
   if ( !mesh->nprism ) {
-    _MMG5_DEL_MEM(mesh,hash.item,(hash.max+1)*sizeof(_MMG5_hedge));
+    _MMG5_DEL_MEM(mesh,hash.item,hash.siz*sizeof(_MMG5_hedge));
     return(1);
   }
 
@@ -1919,7 +1937,7 @@ int _MMG5_bdrySet(MMG5_pMesh mesh) {
     for (i=0; i<2; i++) {
       adj = adja[i] / 5;
       if ( adj<0 ) {
-        ref = mesh->tetra[abs(adj)].ref;
+        ref = mesh->tetra[MMG5_abs(adj)].ref;
       } else {
         ref = mesh->prism[adj].ref;
       }
@@ -1952,7 +1970,7 @@ int _MMG5_bdrySet(MMG5_pMesh mesh) {
   _MMG5_SAFE_RECALLOC(mesh->xprism,mesh->nprism+1,mesh->xpr+1,MMG5_xPrism,
                       "boundary prisms",0);
 
-  _MMG5_DEL_MEM(mesh,hash.item,(hash.max+1)*sizeof(_MMG5_hedge));
+  _MMG5_DEL_MEM(mesh,hash.item,hash.siz*sizeof(_MMG5_hedge));
   return(1);
 }
 
@@ -1963,7 +1981,8 @@ int _MMG5_bdryUpdate(MMG5_pMesh mesh) {
   MMG5_pTria    ptt;
   MMG5_pxTetra  pxt;
   _MMG5_Hash     hash;
-  int      k,kt,ia,ib,ic,j;
+  int      j;
+  MMG5_int ia,ib,ic,kt,k;
   int16_t  tag;
   char     i;
 
@@ -1972,7 +1991,7 @@ int _MMG5_bdryUpdate(MMG5_pMesh mesh) {
   for (k=1; k<=mesh->nt; k++) {
     ptt = &mesh->tria[k];
     if ( !_MMG5_hashFace(mesh,&hash,ptt->v[0],ptt->v[1],ptt->v[2],k) ) {
-      _MMG5_DEL_MEM(mesh,hash.item,(hash.max+1)*sizeof(_MMG5_hedge));
+      _MMG5_DEL_MEM(mesh,hash.item,hash.siz*sizeof(_MMG5_hedge));
       return(0);
     }
   }
@@ -2034,7 +2053,7 @@ int _MMG5_bdryUpdate(MMG5_pMesh mesh) {
       }
     }
   }
-  _MMG5_DEL_MEM(mesh,hash.item,(hash.max+1)*sizeof(_MMG5_hedge));
+  _MMG5_DEL_MEM(mesh,hash.item,hash.siz*sizeof(_MMG5_hedge));
   return(1);
 }
 
@@ -2049,7 +2068,8 @@ int _MMG5_bdryPerm(MMG5_pMesh mesh) {
   MMG5_pTetra   pt,pt1;
   MMG5_pTria    ptt;
   _MMG5_Hash    hash;
-  int     *adja,adj,k,kt,ia,ib,ic,nf,npb;
+  int     nf,npb;
+  MMG5_int ia,ib,ic,*adja,adj,kt,k;
   char     i;
 
   if ( !mesh->nt ) return 1;
@@ -2061,7 +2081,7 @@ int _MMG5_bdryPerm(MMG5_pMesh mesh) {
   for (k=1; k<=mesh->nt; k++) {
     ptt = &mesh->tria[k];
     if ( !_MMG5_hashFace(mesh,&hash,ptt->v[0],ptt->v[1],ptt->v[2],k) ) {
-      _MMG5_DEL_MEM(mesh,hash.item,(hash.max+1)*sizeof(_MMG5_hedge));
+      _MMG5_DEL_MEM(mesh,hash.item,hash.siz*sizeof(_MMG5_hedge));
       return(0);
     }
   }
@@ -2099,7 +2119,7 @@ int _MMG5_bdryPerm(MMG5_pMesh mesh) {
   if ( mesh->info.ddebug && nf > 0 )
     fprintf(stdout,"  ## %d faces reoriented\n",nf);
 
-  _MMG5_DEL_MEM(mesh,hash.item,(hash.max+1)*sizeof(_MMG5_hedge));
+  _MMG5_DEL_MEM(mesh,hash.item,hash.siz*sizeof(_MMG5_hedge));
 
   return(1);
 }
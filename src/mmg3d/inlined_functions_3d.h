@@ -94,7 +94,7 @@ static
 inline double _MMG5_lenedg33_ani(MMG5_pMesh mesh ,MMG5_pSol met, int ia,
                                  MMG5_pTetra pt)
 {
-  int ip1,ip2;
+  MMG5_int ip1,ip2;
   char isedg;
 
   ip1 = pt->v[_MMG5_iare[ia][0]];
@@ -127,7 +127,7 @@ inline double _MMG5_lenedgspl33_ani(MMG5_pMesh mesh ,MMG5_pSol met, int ia,
 {
   MMG5_pPoint pp1,pp2;
   double      *m1,*m2;
-  int         ip1,ip2;
+  MMG5_int    ip1,ip2;
 
   ip1 = pt->v[_MMG5_iare[ia][0]];
   ip2 = pt->v[_MMG5_iare[ia][1]];
@@ -160,7 +160,8 @@ inline double _MMG5_lenedgspl_ani(MMG5_pMesh mesh ,MMG5_pSol met, int ia,
 {
   MMG5_pPoint pp1,pp2;
   double      m1[6],m2[6];
-  int         ip1,ip2,i;
+  int         i;
+  MMG5_int    ip1,ip2;
 
   ip1 = pt->v[_MMG5_iare[ia][0]];
   ip2 = pt->v[_MMG5_iare[ia][1]];
@@ -200,7 +201,7 @@ static
 inline double _MMG5_lenedg_ani(MMG5_pMesh mesh ,MMG5_pSol met, int ia,
                                MMG5_pTetra pt)
 {
-  int ip1,ip2;
+  MMG5_int ip1,ip2;
   char isedg;
 
   ip1 = pt->v[_MMG5_iare[ia][0]];
@@ -229,7 +230,7 @@ inline double _MMG5_lenedg_ani(MMG5_pMesh mesh ,MMG5_pSol met, int ia,
 static
 inline double _MMG5_lenedg_iso(MMG5_pMesh mesh,MMG5_pSol met,int ia,
                                MMG5_pTetra pt) {
-  int ip1,ip2;
+  MMG5_int ip1,ip2;
 
   ip1 = pt->v[_MMG5_iare[ia][0]];
   ip2 = pt->v[_MMG5_iare[ia][1]];
@@ -239,7 +240,7 @@ inline double _MMG5_lenedg_iso(MMG5_pMesh mesh,MMG5_pSol met,int ia,
 static
 inline double _MMG5_lenedgspl_iso(MMG5_pMesh mesh ,MMG5_pSol met, int ia,
                                   MMG5_pTetra pt) {
-  int ip1,ip2;
+  MMG5_int ip1,ip2;
 
   ip1 = pt->v[_MMG5_iare[ia][0]];
   ip2 = pt->v[_MMG5_iare[ia][1]];
@@ -259,12 +260,12 @@ inline double _MMG5_lenedgspl_iso(MMG5_pMesh mesh ,MMG5_pSol met, int ia,
  *
  */
 static
-inline double _MMG5_orcal(MMG5_pMesh mesh,MMG5_pSol met,int iel) {
+inline double _MMG5_orcal(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int iel) {
   MMG5_pTetra     pt;
 
   pt = &mesh->tetra[iel];
 
-  return(_MMG5_caltet(mesh,met,pt));
+  return(mesh->func.caltet(mesh,met,pt));
 }
 
 
@@ -386,7 +387,7 @@ inline double _MMG5_caltet_iso_4pt(double *a, double *b, double *c, double *d) {
 static
 inline double _MMG5_caltet_iso(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTetra  pt) {
   double       *a,*b,*c,*d;
-  int          ia, ib, ic, id;
+  MMG5_int     ia,ib,ic,id;
 
   ia = pt->v[0];
   ib = pt->v[1];
@@ -420,7 +421,7 @@ inline double _MMG5_caltet_ani(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTetra pt) {
   double       bcx,bcy,bcz,bdx,bdy,bdz,cdx,cdy,cdz;
   double       *a,*b,*c,*d;
   double       mm[6];
-  int          ip[4];
+  MMG5_int     ip[4];
 
   ip[0] = pt->v[0];
   ip[1] = pt->v[1];
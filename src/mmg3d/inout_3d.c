@@ -39,56 +39,6 @@
 #define sw 4
 #define sd 8
 
-static int _MMG5_swapbin(int sbin)
-{
-  int inv;
-  char *p_in = (char *) &sbin;
-  char *p = (char *)&inv;
-
-
-  p[0] = p_in[3];
-  p[1] = p_in[2];
-  p[2] = p_in[1];
-  p[3] = p_in[0];
-
-  return(inv);
-  /*unsigned char c1, c2, c3, c4;
-
-    c1 = sbin & 255;
-    c2 = (sbin >> 8) & 255;
-    c3 = (sbin >> 16) & 255;
-    c4 = (sbin >> 24) & 255;
-
-    return ((int)c1 << 24) + ((int)c2 << 16) + ((int)c3 << 8) + c4;   */
-
-}
-static float _MMG5_swapf(float sbin)
-{
-  float out;
-  char *p_in = (char *) &sbin;
-  char *p_out = (char *) &out;
-  p_out[0] = p_in[3];
-  p_out[1] = p_in[2];
-  p_out[2] = p_in[1];
-  p_out[3] = p_in[0];
-
-  return(out);
-}
-static double _MMG5_swapd(double sbin)
-{
-  float out;
-  char *p_in = (char *) &sbin;
-  char *p_out = (char *) &out;
-  int i;
-
-  for(i=0;i<8;i++)
-  {
-    p_out[i] = p_in[7-i];
-  }
-
-  return(out);
-}
-
 /**
  * \param mesh pointer toward the mesh structure.
  * \param filename name of file.
@@ -101,6 +51,7 @@ static double _MMG5_swapd(double sbin)
  */
 int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
   FILE*       inm;
+  _MMG5_BinFile bf;
   MMG5_pTetra pt;
   MMG5_pPrism pp;
   MMG5_pTria  pt1;
@@ -111,9 +62,11 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
   float       fc;
   long        posnp,posnt,posne,posned,posncor,posnpreq,posntreq,posnereq,posnedreq;
   long        posnr,posnprism,posnormal,posnc1,posnq,posnqreq;
-  int         npreq,ntreq,nereq,nedreq,nqreq,ncor,ned,ng,bin,iswp;
-  int         binch,bdim,bpos,i,k,ip,idn;
-  int         *ina,v[3],ref,nt,na,nr,ia,aux,nref;
+  int         bin;
+  MMG5_int    npreq,ntreq,nereq,nedreq,nqreq,ncor,ng,ned;
+  int         i,k,ip,idn;
+  int         ref,ia,nref;
+  MMG5_int    *ina,v[3],nt,na,aux,nr;
   char        *ptr,*data,chaine[128];
 
   posnp = posnt = posne = posncor = 0;
@@ -121,7 +74,6 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
   posnprism = posnormal= posnc1 = posnq = 0;
   ncor = ned = npreq = ntreq = nqreq = nereq = nedreq = nr = ng = 0;
   bin = 0;
-  iswp = 0;
   ina = NULL;
   mesh->np = mesh->nt = mesh->ne = 0;
 
@@ -175,248 +127,109 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
         }
         continue;
       } else if(!strncmp(chaine,"Vertices",strlen("Vertices"))) {
-        fscanf(inm,"%d",&mesh->npi);
+        fscanf(inm,"%" MMG5_SCNd,&mesh->npi);
         posnp = ftell(inm);
         continue;
       } else if(!strncmp(chaine,"RequiredVertices",strlen("RequiredVertices"))) {
-        fscanf(inm,"%d",&npreq);
+        fscanf(inm,"%" MMG5_SCNd,&npreq);
         posnpreq = ftell(inm);
         continue;
       } else if(!strncmp(chaine,"Triangles",strlen("Triangles"))) {
         if ( !strncmp(chaine,"TrianglesP",strlen("TrianglesP")) ) continue;
-        fscanf(inm,"%d",&mesh->nti);
+        fscanf(inm,"%" MMG5_SCNd,&mesh->nti);
         posnt = ftell(inm);
         continue;
       } else if(!strncmp(chaine,"RequiredTriangles",strlen("RequiredTriangles"))) {
-        fscanf(inm,"%d",&ntreq);
+        fscanf(inm,"%" MMG5_SCNd,&ntreq);
         posntreq = ftell(inm);
         continue;
       }
       else if(!strncmp(chaine,"Quadrilaterals",strlen("Quadrilaterals"))) {
-        fscanf(inm,"%d",&mesh->nquad);
+        fscanf(inm,"%" MMG5_SCNd,&mesh->nquad);
         posnq = ftell(inm);
         continue;
       } else if(!strncmp(chaine,"RequiredQuadrilaterals",strlen("RequiredQuadrilaterals"))) {
-        fscanf(inm,"%d",&nqreq);
+        fscanf(inm,"%" MMG5_SCNd,&nqreq);
         posnqreq = ftell(inm);
         continue;
 
       } else if(!strncmp(chaine,"Tetrahedra",strlen("Tetrahedra"))) {
         if ( !strncmp(chaine,"TetrahedraP",strlen("TetrahedraP")) ) continue;
-        fscanf(inm,"%d",&mesh->nei);
+        fscanf(inm,"%" MMG5_SCNd,&mesh->nei);
         posne = ftell(inm);
         continue;
       } else if((!strncmp(chaine,"Prisms",strlen("Prisms")))||
                 (!strncmp(chaine,"Pentahedra",strlen("Pentahedra")))) {
-        fscanf(inm,"%d",&mesh->nprism);
+        fscanf(inm,"%" MMG5_SCNd,&mesh->nprism);
         posnprism = ftell(inm);
         continue;
       } else if(!strncmp(chaine,"RequiredTetrahedra",strlen("RequiredTetrahedra"))) {
-        fscanf(inm,"%d",&nereq);
+        fscanf(inm,"%" MMG5_SCNd,&nereq);
         posnereq = ftell(inm);
         continue;
       } else if(!strncmp(chaine,"Corners",strlen("Corners"))) {
-        fscanf(inm,"%d",&ncor);
+        fscanf(inm,"%" MMG5_SCNd,&ncor);
         posncor = ftell(inm);
         continue;
       } else if(!strncmp(chaine,"Edges",strlen("Edges"))) {
-        fscanf(inm,"%d",&mesh->nai);
+        fscanf(inm,"%" MMG5_SCNd,&mesh->nai);
         posned = ftell(inm);
         continue;
       } else if(!strncmp(chaine,"RequiredEdges",strlen("RequiredEdges"))) {
-        fscanf(inm,"%d",&nedreq);
+        fscanf(inm,"%" MMG5_SCNd,&nedreq);
         posnedreq = ftell(inm);
         continue;
       } else if(!strncmp(chaine,"Ridges",strlen("Ridges"))) {
-        fscanf(inm,"%d",&nr);
+        fscanf(inm,"%" MMG5_SCNd,&nr);
         posnr = ftell(inm);
         continue;
       } else if(!ng && !strncmp(chaine,"Normals",strlen("Normals"))) {
-        fscanf(inm,"%d",&ng);
+        fscanf(inm,"%" MMG5_SCNd,&ng);
         posnormal = ftell(inm);
         continue;
       } else if(!strncmp(chaine,"NormalAtVertices",strlen("NormalAtVertices"))) {
-        fscanf(inm,"%d",&mesh->nc1);
+        fscanf(inm,"%" MMG5_SCNd,&mesh->nc1);
         posnc1 = ftell(inm);
         continue;
       }
     }
   } else { //binary file
-    bdim = 0;
-    fread(&mesh->ver,sw,1,inm);
-    iswp=0;
-    if(mesh->ver==16777216)
-      iswp=1;
-    else if(mesh->ver!=1) {
-      fprintf(stderr,"BAD FILE ENCODING\n");
-    }
-    fread(&mesh->ver,sw,1,inm);
-    if(iswp) mesh->ver = _MMG5_swapbin(mesh->ver);
-    while(fread(&binch,sw,1,inm)!=0 && binch!=54 ) {
-      if(iswp) binch=_MMG5_swapbin(binch);
-      if(binch==54) break;
-      if(!bdim && binch==3) {  //Dimension
-        fread(&bdim,sw,1,inm);  //NulPos=>20
-        if(iswp) bdim=_MMG5_swapbin(bdim);
-        fread(&bdim,sw,1,inm);
-        if(iswp) bdim=_MMG5_swapbin(bdim);
-        mesh->dim = bdim;
-        if(bdim!=3) {
-          fprintf(stderr,"BAD MESH DIMENSION : %d\n",mesh->dim);
-          fprintf(stderr," Exit program.\n");
-          return(-1);
-        }
-        continue;
-      } else if(!mesh->npi && binch==4) {  //Vertices
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=_MMG5_swapbin(bpos);
-        fread(&mesh->npi,sw,1,inm);
-        if(iswp) mesh->npi=_MMG5_swapbin(mesh->npi);
-        posnp = ftell(inm);
-        rewind(inm);
-        fseek(inm,bpos,SEEK_SET);
-        continue;
-      } else if(binch==15) {  //RequiredVertices
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=_MMG5_swapbin(bpos);
-        fread(&npreq,sw,1,inm);
-        if(iswp) npreq=_MMG5_swapbin(npreq);
-        posnpreq = ftell(inm);
-        rewind(inm);
-        fseek(inm,bpos,SEEK_SET);
-        continue;
-      } else if(!mesh->nti && binch==6) {//Triangles
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=_MMG5_swapbin(bpos);
-        fread(&mesh->nti,sw,1,inm);
-        if(iswp) mesh->nti=_MMG5_swapbin(mesh->nti);
-        posnt = ftell(inm);
-        rewind(inm);
-        fseek(inm,bpos,SEEK_SET);
-        continue;
-      } else if(binch==17) {  //RequiredTriangles
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=_MMG5_swapbin(bpos);
-        fread(&ntreq,sw,1,inm);
-        if(iswp) ntreq=_MMG5_swapbin(ntreq);
-        posntreq = ftell(inm);
-        rewind(inm);
-        fseek(inm,bpos,SEEK_SET);
-        continue;
-      }
-      else if(!mesh->nquad && binch==7) {//Quadrilaterals
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=_MMG5_swapbin(bpos);
-        fread(&mesh->nquad,sw,1,inm);
-        if(iswp) mesh->nquad=_MMG5_swapbin(mesh->nquad);
-        posnq = ftell(inm);
-        rewind(inm);
-        fseek(inm,bpos,SEEK_SET);
-        continue;
-      } else if(binch==18) {  //RequiredQuadrilaterals
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=_MMG5_swapbin(bpos);
-        fread(&nqreq,sw,1,inm);
-        if(iswp) nqreq=_MMG5_swapbin(nqreq);
-        posnqreq = ftell(inm);
-        rewind(inm);
-        fseek(inm,bpos,SEEK_SET);
-        continue;
-      } else if(!mesh->nei && binch==8) {//Tetra
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=_MMG5_swapbin(bpos);
-        fread(&mesh->nei,sw,1,inm);
-        if(iswp) mesh->nei=_MMG5_swapbin(mesh->nei);
-        posne = ftell(inm);
-        rewind(inm);
-        fseek(inm,bpos,SEEK_SET);
-        continue;
-      } else if(!mesh->nprism && binch==9) {//Prism
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=_MMG5_swapbin(bpos);
-        fread(&mesh->nprism,sw,1,inm);
-        if(iswp) mesh->nprism=_MMG5_swapbin(mesh->nprism);
-        posnprism = ftell(inm);
-        rewind(inm);
-        fseek(inm,bpos,SEEK_SET);
-        continue;
-      } else if(binch==12) {  //RequiredTetra
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=_MMG5_swapbin(bpos);
-        fread(&nereq,sw,1,inm);
-        if(iswp) nereq=_MMG5_swapbin(nereq);
-        posnereq = ftell(inm);
-        rewind(inm);
-        fseek(inm,bpos,SEEK_SET);
-        continue;
-      } else if(!ncor && binch==13) { //Corners
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=_MMG5_swapbin(bpos);
-        fread(&ncor,sw,1,inm);
-        if(iswp) ncor=_MMG5_swapbin(ncor);
-        posncor = ftell(inm);
-        rewind(inm);
-        fseek(inm,bpos,SEEK_SET);
-        continue;
-      } else if(!mesh->nai && binch==5) { //Edges
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=_MMG5_swapbin(bpos);
-        fread(&mesh->nai,sw,1,inm);
-        if(iswp) mesh->nai=_MMG5_swapbin(mesh->nai);
-        posned = ftell(inm);
-        rewind(inm);
-        fseek(inm,bpos,SEEK_SET);
-        continue;
-      } else if(binch==16) {  //RequiredEdges
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=_MMG5_swapbin(bpos);
-        fread(&nedreq,sw,1,inm);
-        if(iswp) nedreq=_MMG5_swapbin(nedreq);
-        posnedreq = ftell(inm);
-        rewind(inm);
-        fseek(inm,bpos,SEEK_SET);
-        continue;
-      }  else if(binch==14) {  //Ridges
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=_MMG5_swapbin(bpos);
-        fread(&nr,sw,1,inm);
-        if(iswp) nr=_MMG5_swapbin(nr);
-        posnr = ftell(inm);
-        rewind(inm);
-        fseek(inm,bpos,SEEK_SET);
-        continue;
-      } else if(!ng && binch==60) {  //Normals
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=_MMG5_swapbin(bpos);
-        fread(&ng,sw,1,inm);
-        if(iswp) ng=_MMG5_swapbin(ng);
-        posnormal = ftell(inm);
-        rewind(inm);
-        fseek(inm,bpos,SEEK_SET);
-        continue;
-      } else if(binch==20) {  //NormalAtVertices
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=_MMG5_swapbin(bpos);
-        fread(&mesh->nc1,sw,1,inm);
-        if(iswp) mesh->nc1=_MMG5_swapbin(mesh->nc1);
-        posnc1 = ftell(inm);
-        rewind(inm);
-        fseek(inm,bpos,SEEK_SET);
-        continue;
-      } else {
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=_MMG5_swapbin(bpos);
-
-        rewind(inm);
-        fseek(inm,bpos,SEEK_SET);
-      }
-    }
+    if ( !_MMG5_openBinFile(inm,&bf) ) {
+      fclose(inm);
+      return(-1);
+    }
+    mesh->ver = bf.ver;
+    mesh->dim = (int)bf.nel[3]; //Dimension
+    if ( mesh->dim!=3 ) {
+      fprintf(stderr,"BAD MESH DIMENSION : %d\n",mesh->dim);
+      fprintf(stderr," Exit program.\n");
+      _MMG5_closeBinFile(&bf);
+      fclose(inm);
+      return(-1);
+    }
+    mesh->npi    = bf.nel[4];  posnp     = bf.pos[4];  //Vertices
+    npreq        = bf.nel[15]; posnpreq  = bf.pos[15]; //RequiredVertices
+    mesh->nti    = bf.nel[6];  posnt     = bf.pos[6];  //Triangles
+    ntreq        = bf.nel[17]; posntreq  = bf.pos[17]; //RequiredTriangles
+    mesh->nquad  = bf.nel[7];  posnq     = bf.pos[7];  //Quadrilaterals
+    nqreq        = bf.nel[18]; posnqreq  = bf.pos[18]; //RequiredQuadrilaterals
+    mesh->nei    = bf.nel[8];  posne     = bf.pos[8];  //Tetra
+    mesh->nprism = bf.nel[9];  posnprism = bf.pos[9];  //Prism
+    nereq        = bf.nel[12]; posnereq  = bf.pos[12]; //RequiredTetra
+    ncor         = bf.nel[13]; posncor   = bf.pos[13]; //Corners
+    mesh->nai    = bf.nel[5];  posned    = bf.pos[5];  //Edges
+    nedreq       = bf.nel[16]; posnedreq = bf.pos[16]; //RequiredEdges
+    nr           = bf.nel[14]; posnr     = bf.pos[14]; //Ridges
+    ng           = bf.nel[60]; posnormal = bf.pos[60]; //Normals
+    mesh->nc1    = bf.nel[20]; posnc1    = bf.pos[20]; //NormalAtVertices
   }
 
   if ( !mesh->npi || !mesh->nei ) {
     fprintf(stderr,"  ** MISSING DATA.\n");
     fprintf(stderr," Check that your mesh contains points and tetrahedra.\n");
     fprintf(stderr," Exit program.\n");
+    if ( bin ) _MMG5_closeBinFile(&bf);
+    fclose(inm);
     return(-1);
   }
   /* memory allocation */
@@ -429,37 +242,40 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
     return(-1);
   }
 
-  rewind(inm);
-  fseek(inm,posnp,SEEK_SET);
+  if ( bin ) {
+    /* copy the vertex and element blocks straight from the mapped file */
+    if ( !_MMG5_binReadPoints(mesh,&bf,3) ||
+         ( mesh->nt && !_MMG5_binCopyElt(&bf,posnt,mesh->nt,3,
+                                      mesh->tria[1].v,sizeof(MMG5_Tria)) ) ||
+         ( mesh->nquad && !_MMG5_binCopyElt(&bf,posnq,mesh->nquad,4,
+                                         mesh->quadra[1].v,sizeof(MMG5_Quad)) ) ||
+         ( mesh->na && !_MMG5_binCopyElt(&bf,posned,mesh->na,2,
+                                      &mesh->edge[1].a,sizeof(MMG5_Edge)) ) ||
+         !_MMG5_binCopyElt(&bf,posne,mesh->ne,4,
+                        mesh->tetra[1].v,sizeof(MMG5_Tetra)) ||
+         ( mesh->nprism && !_MMG5_binCopyElt(&bf,posnprism,mesh->nprism,6,
+                                          mesh->prism[1].v,sizeof(MMG5_Prism)) ) ) {
+      _MMG5_closeBinFile(&bf);
+      fclose(inm);
+      return(-1);
+    }
+  }
+  else {
+    rewind(inm);
+    fseek(inm,posnp,SEEK_SET);
+  }
   for (k=1; k<=mesh->np; k++) {
     ppt = &mesh->point[k];
-    if (mesh->ver < 2) { /*float*/
-      if (!bin) {
+    if ( !bin ) {
+      if (mesh->ver < 2) { /*float*/
         for (i=0 ; i<3 ; i++) {
           fscanf(inm,"%f",&fc);
           ppt->c[i] = (double) fc;
         }
         fscanf(inm,"%d",&ppt->ref);
-      } else {
-        for (i=0 ; i<3 ; i++) {
-          fread(&fc,sw,1,inm);
-          if(iswp) fc=_MMG5_swapf(fc);
-          ppt->c[i] = (double) fc;
-        }
-        fread(&ppt->ref,sw,1,inm);
-        if(iswp) ppt->ref=_MMG5_swapbin(ppt->ref);
       }
-    } else {
-      if (!bin)
+      else
         fscanf(inm,"%lf %lf %lf %d",&ppt->c[0],&ppt->c[1],&ppt->c[2],&ppt->ref);
-      else {
-        for (i=0 ; i<3 ; i++) {
-          fread(&ppt->c[i],sd,1,inm);
-          if(iswp) ppt->c[i]=_MMG5_swapd(ppt->c[i]);
-        }
-        fread(&ppt->ref,sw,1,inm);
-        if(iswp) ppt->ref=_MMG5_swapbin(ppt->ref);
-      }
     }
     ppt->tag  = MG_NUL;
     ppt->tmp  = 0;
@@ -471,10 +287,8 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
     for (k=1; k<=npreq; k++) {
       if(!bin)
         fscanf(inm,"%d",&i);
-      else {
-        fread(&i,sw,1,inm);
-        if(iswp) i=_MMG5_swapbin(i);
-      }
+      else
+        i = _MMG5_binInt(&bf,posnpreq+(k-1)*sw);
       if(i>mesh->np) {
         fprintf(stderr,"\n  ## Warning: %s: required Vertices number %8d"
                 " ignored.\n",__func__,i);
@@ -492,10 +306,8 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
     for (k=1; k<=ncor; k++) {
       if(!bin)
         fscanf(inm,"%d",&i);
-      else {
-        fread(&i,sw,1,inm);
-        if(iswp) i=_MMG5_swapbin(i);
-      }
+      else
+        i = _MMG5_binInt(&bf,posncor+(k-1)*sw);
       if(i>mesh->np) {
         fprintf(stderr,"\n  ## Warning: %s: corner number %8d ignored.\n",
                 __func__,i);
@@ -514,18 +326,16 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
     /* Skip triangles with MG_ISO refs */
     if( mesh->info.iso ) {
       mesh->nt = 0;
-      _MMG5_SAFE_CALLOC(ina,nt+1,int,-1);
+      _MMG5_SAFE_CALLOC(ina,nt+1,MMG5_int,-1);
 
       for (k=1; k<=nt; k++) {
         if (!bin)
-          fscanf(inm,"%d %d %d %d",&v[0],&v[1],&v[2],&ref);
+          fscanf(inm,"%" MMG5_SCNd " %" MMG5_SCNd " %" MMG5_SCNd " %d",&v[0],&v[1],&v[2],&ref);
         else {
-          for (i=0 ; i<3 ; i++) {
-            fread(&v[i],sw,1,inm);
-            if(iswp) v[i]=_MMG5_swapbin(v[i]);
-          }
-          fread(&ref,sw,1,inm);
-          if(iswp) ref=_MMG5_swapbin(ref);
+          pt1 = &mesh->tria[k];
+          for (i=0 ; i<3 ; i++)
+            v[i] = pt1->v[i];
+          ref = pt1->ref;
         }
         if( abs(ref) != MG_ISO ) {
           pt1 = &mesh->tria[++mesh->nt];
@@ -547,19 +357,10 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
                             "triangles",-1);
       }
     }
-    else {
+    else if ( !bin ) {
       for (k=1; k<=mesh->nt; k++) {
         pt1 = &mesh->tria[k];
-        if (!bin)
-          fscanf(inm,"%d %d %d %d",&pt1->v[0],&pt1->v[1],&pt1->v[2],&pt1->ref);
-        else {
-          for (i=0 ; i<3 ; i++) {
-            fread(&pt1->v[i],sw,1,inm);
-            if(iswp) pt1->v[i]=_MMG5_swapbin(pt1->v[i]);
-          }
-          fread(&pt1->ref,sw,1,inm);
-          if(iswp) pt1->ref=_MMG5_swapbin(pt1->ref);
-        }
+        fscanf(inm,"%" MMG5_SCNd " %" MMG5_SCNd " %" MMG5_SCNd " %d",&pt1->v[0],&pt1->v[1],&pt1->v[2],&pt1->ref);
       }
     }
     /* get required triangles */
@@ -569,10 +370,8 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
       for (k=1; k<=ntreq; k++) {
         if(!bin)
           fscanf(inm,"%d",&i);
-        else {
-          fread(&i,sw,1,inm);
-          if(iswp) i=_MMG5_swapbin(i);
-        }
+        else
+          i = _MMG5_binInt(&bf,posntreq+(k-1)*sw);
         if ( i>mesh->nt ) {
           fprintf(stderr,"\n  ## Warning: %s: required triangle number %8d"
                   " ignored.\n",__func__,i);
@@ -604,18 +403,11 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
     rewind(inm);
     fseek(inm,posnq,SEEK_SET);
 
-    for (k=1; k<=mesh->nquad; k++) {
-      pq1 = &mesh->quadra[k];
-      if (!bin)
-        fscanf(inm,"%d %d %d %d %d",&pq1->v[0],&pq1->v[1],&pq1->v[2],
+    if ( !bin ) {
+      for (k=1; k<=mesh->nquad; k++) {
+        pq1 = &mesh->quadra[k];
+        fscanf(inm,"%" MMG5_SCNd " %" MMG5_SCNd " %" MMG5_SCNd " %" MMG5_SCNd " %d",&pq1->v[0],&pq1->v[1],&pq1->v[2],
                &pq1->v[3],&pq1->ref);
-      else {
-        for (i=0 ; i<4 ; i++) {
-          fread(&pq1->v[i],sw,1,inm);
-          if(iswp) pq1->v[i]=_MMG5_swapbin(pq1->v[i]);
-        }
-        fread(&pq1->ref,sw,1,inm);
-        if(iswp) pq1->ref=_MMG5_swapbin(pq1->ref);
       }
     }
 
@@ -626,10 +418,8 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
       for (k=1; k<=nqreq; k++) {
         if(!bin)
           fscanf(inm,"%d",&i);
-        else {
-          fread(&i,sw,1,inm);
-          if(iswp) i=_MMG5_swapbin(i);
-        }
+        else
+          i = _MMG5_binInt(&bf,posnqreq+(k-1)*sw);
         if ( i>mesh->nquad ) {
           fprintf(stderr,"\n  ## Warning: %s: required quadrilaterals number"
                   " %8d ignored.\n",__func__,i);
@@ -649,7 +439,7 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
     na = mesh->na;
     if (mesh->info.iso ) {
       mesh->na = 0;
-      _MMG5_SAFE_CALLOC(ina,na+1,int,-1);
+      _MMG5_SAFE_CALLOC(ina,na+1,MMG5_int,-1);
     }
 
     rewind(inm);
@@ -658,15 +448,7 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
     for (k=1; k<=na; k++) {
       pa = &mesh->edge[k];
       if (!bin)
-        fscanf(inm,"%d %d %d",&pa->a,&pa->b,&pa->ref);
-      else {
-        fread(&pa->a,sw,1,inm);
-        if(iswp) pa->a=_MMG5_swapbin(pa->a);
-        fread(&pa->b,sw,1,inm);
-        if(iswp) pa->b=_MMG5_swapbin(pa->b);
-        fread(&pa->ref,sw,1,inm);
-        if(iswp) pa->ref=_MMG5_swapbin(pa->ref);
-      }
+        fscanf(inm,"%" MMG5_SCNd " %" MMG5_SCNd " %d",&pa->a,&pa->b,&pa->ref);
       pa->tag |= MG_REF;
       if ( mesh->info.iso ) {
         if( abs(pa->ref) != MG_ISO ) {
@@ -697,10 +479,8 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
       for (k=1; k<=nr; k++) {
         if(!bin)
           fscanf(inm,"%d",&ia);
-        else {
-          fread(&ia,sw,1,inm);
-          if(iswp) ia=_MMG5_swapbin(ia);
-        }
+        else
+          ia = _MMG5_binInt(&bf,posnr+(k-1)*sw);
         if(ia>na) {
           fprintf(stderr,"\n  ## Warning: %s: ridge number %8d ignored.\n",
                   __func__,ia);
@@ -727,12 +507,10 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
       for (k=1; k<=nedreq; k++) {
         if(!bin)
           fscanf(inm,"%d",&ia);
-        else {
-          fread(&ia,sw,1,inm);
-          if(iswp) ia=_MMG5_swapbin(ia);
-        }
+        else
+          ia = _MMG5_binInt(&bf,posnedreq+(k-1)*sw);
         if(ia>na) {
-          fprintf(stderr,"\n  ## Warning: %s: required Edges number %8d/%8d"
+          fprintf(stderr,"\n  ## Warning: %s: required Edges number %8d/%8" MMG5_PRId
                   " ignored.\n",__func__,ia,na);
           continue;
         }
@@ -762,15 +540,9 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
   for (k=1; k<=mesh->ne; k++) {
     pt = &mesh->tetra[k];
     if (!bin)
-      fscanf(inm,"%d %d %d %d %d",&pt->v[0],&pt->v[1],&pt->v[2],&pt->v[3],&ref);
-    else {
-      for (i=0 ; i<4 ; i++) {
-        fread(&pt->v[i],sw,1,inm);
-        if(iswp) pt->v[i]=_MMG5_swapbin(pt->v[i]);
-      }
-      fread(&ref,sw,1,inm);
-      if(iswp) ref=_MMG5_swapbin(ref);
-    }
+      fscanf(inm,"%" MMG5_SCNd " %" MMG5_SCNd " %" MMG5_SCNd " %" MMG5_SCNd " %d",&pt->v[0],&pt->v[1],&pt->v[2],&pt->v[3],&ref);
+    else
+      ref = pt->ref;
     if(ref < 0) {
       nref++;
     }
@@ -798,7 +570,7 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
   }
   if(mesh->xt) {
     fprintf(stderr,"\n     $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$ \n");
-    fprintf(stderr,"         BAD ORIENTATION : vol < 0 -- %8d tetra reoriented\n",mesh->xt);
+    fprintf(stderr,"         BAD ORIENTATION : vol < 0 -- %8" MMG5_PRId " tetra reoriented\n",mesh->xt);
     fprintf(stderr,"     $$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$ \n\n");
   }
   mesh->xt = 0;
@@ -809,10 +581,8 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
     for (k=1; k<=nereq; k++) {
       if(!bin)
         fscanf(inm,"%d",&i);
-      else {
-        fread(&i,sw,1,inm);
-        if(iswp) i=_MMG5_swapbin(i);
-      }
+      else
+        i = _MMG5_binInt(&bf,posnereq+(k-1)*sw);
       if(i>mesh->ne) {
         fprintf(stderr,"\n  ## Warning: %s: required Tetra number %8d"
                 " ignored.\n",__func__,i);
@@ -827,18 +597,11 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
   fseek(inm,posnprism,SEEK_SET);
   for (k=1; k<=mesh->nprism; k++) {
     pp = &mesh->prism[k];
-    if (!bin)
-      fscanf(inm,"%d %d %d %d %d %d %d",&pp->v[0],&pp->v[1],&pp->v[2],
+    if (!bin) {
+      fscanf(inm,"%" MMG5_SCNd " %" MMG5_SCNd " %" MMG5_SCNd " %" MMG5_SCNd " %" MMG5_SCNd " %" MMG5_SCNd " %d",&pp->v[0],&pp->v[1],&pp->v[2],
              &pp->v[3],&pp->v[4],&pp->v[5],&ref);
-    else {
-      for (i=0 ; i<6 ; i++) {
-        fread(&pp->v[i],sw,1,inm);
-        if(iswp) pp->v[i]=_MMG5_swapbin(pp->v[i]);
-      }
-      fread(&ref,sw,1,inm);
-      if(iswp) ref=_MMG5_swapbin(ref);
+      pp->ref  = ref;
     }
-    pp->ref  = ref;
     for (i=0; i<6; i++) {
       ppt = &mesh->point[pp->v[i]];
       ppt->tag &= ~MG_NUL;
@@ -855,33 +618,25 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
   if ( ng > 0 ) {
     _MMG5_SAFE_CALLOC(norm,3*ng+1,double,-1);
 
+    if ( bin && !_MMG5_binReadNormals(&bf,ng,norm) ) {
+      _MMG5_SAFE_FREE(norm);
+      _MMG5_closeBinFile(&bf);
+      fclose(inm);
+      return(-1);
+    }
     rewind(inm);
     fseek(inm,posnormal,SEEK_SET);
     for (k=1; k<=ng; k++) {
       n = &norm[3*(k-1)+1];
-      if ( mesh->ver == 1 ) {
-        if (!bin) {
+      if ( !bin ) {
+        if ( mesh->ver == 1 ) {
           for (i=0 ; i<3 ; i++) {
             fscanf(inm,"%f",&fc);
             n[i] = (double) fc;
           }
-        } else {
-          for (i=0 ; i<3 ; i++) {
-            fread(&fc,sw,1,inm);
-            if(iswp) fc=_MMG5_swapf(fc);
-            n[i] = (double) fc;
-          }
         }
-      }
-      else {
-        if (!bin)
+        else
           fscanf(inm,"%lf %lf %lf",&n[0],&n[1],&n[2]);
-        else {
-          for (i=0 ; i<3 ; i++) {
-            fread(&n[i],sd,1,inm);
-            if(iswp) n[i]=_MMG5_swapd(n[i]);
-          }
-        }
       }
       dd = n[0]*n[0] + n[1]*n[1] + n[2]*n[2];
       if ( dd > _MMG5_EPSD2 ) {
@@ -899,10 +654,8 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
       if (!bin)
         fscanf(inm,"%d %d",&ip,&idn);
       else {
-        fread(&ip,sw,1,inm);
-        if(iswp) ip=_MMG5_swapbin(ip);
-        fread(&idn,sw,1,inm);
-        if(iswp) idn=_MMG5_swapbin(idn);
+        ip  = _MMG5_binInt(&bf,posnc1+2*(k-1)*sw);
+        idn = _MMG5_binInt(&bf,posnc1+(2*k-1)*sw);
       }
       if ( idn > 0 && ip < mesh->np+1 )
         memcpy(&mesh->point[ip].n,&norm[3*(idn-1)+1],3*sizeof(double));
@@ -913,71 +666,65 @@ int MMG3D_loadMesh(MMG5_pMesh mesh,const char *filename) {
 
   /* stats */
   if ( abs(mesh->info.imprim) > 3 ) {
-    fprintf(stdout,"     NUMBER OF VERTICES       %8d\n",mesh->np);
-    fprintf(stdout,"     NUMBER OF TETRAHEDRA     %8d\n",mesh->ne);
+    fprintf(stdout,"     NUMBER OF VERTICES       %8" MMG5_PRId "\n",mesh->np);
+    fprintf(stdout,"     NUMBER OF TETRAHEDRA     %8" MMG5_PRId "\n",mesh->ne);
     if ( mesh->nprism )
-      fprintf(stdout,"     NUMBER OF PRISMS         %8d\n",mesh->nprism);
+      fprintf(stdout,"     NUMBER OF PRISMS         %8" MMG5_PRId "\n",mesh->nprism);
 
     if ( mesh->na ) {
-      fprintf(stdout,"     NUMBER OF EDGES          %8d\n",mesh->na);
+      fprintf(stdout,"     NUMBER OF EDGES          %8" MMG5_PRId "\n",mesh->na);
       if ( nr )
-        fprintf(stdout,"     NUMBER OF RIDGES         %8d\n",nr);
+        fprintf(stdout,"     NUMBER OF RIDGES         %8" MMG5_PRId "\n",nr);
     }
     if ( mesh->nt )
-      fprintf(stdout,"     NUMBER OF TRIANGLES      %8d\n",mesh->nt);
+      fprintf(stdout,"     NUMBER OF TRIANGLES      %8" MMG5_PRId "\n",mesh->nt);
     if ( mesh->nquad )
-      fprintf(stdout,"     NUMBER OF QUADRILATERALS %8d\n",mesh->nquad);
+      fprintf(stdout,"     NUMBER OF QUADRILATERALS %8" MMG5_PRId "\n",mesh->nquad);
 
 
     if ( npreq || nedreq || ntreq || nereq || nqreq ) {
       fprintf(stdout,"     NUMBER OF REQUIRED ENTITIES: \n");
       if ( npreq )
-        fprintf(stdout,"                  VERTICES       %8d \n",npreq);
+        fprintf(stdout,"                  VERTICES       %8" MMG5_PRId " \n",npreq);
       if ( nedreq )
-        fprintf(stdout,"                  EDGES          %8d \n",nedreq);
+        fprintf(stdout,"                  EDGES          %8" MMG5_PRId " \n",nedreq);
       if ( ntreq )
-        fprintf(stdout,"                  TRIANGLES      %8d \n",ntreq);
+        fprintf(stdout,"                  TRIANGLES      %8" MMG5_PRId " \n",ntreq);
       if ( nqreq )
-        fprintf(stdout,"                  QUADRILATERALS %8d \n",nqreq);
+        fprintf(stdout,"                  QUADRILATERALS %8" MMG5_PRId " \n",nqreq);
       if ( nereq )
-        fprintf(stdout,"                  TETRAHEDRA    %8d \n",nereq);
+        fprintf(stdout,"                  TETRAHEDRA    %8" MMG5_PRId " \n",nereq);
     }
-    if(ncor) fprintf(stdout,"     NUMBER OF CORNERS        %8d \n",ncor);
+    if(ncor) fprintf(stdout,"     NUMBER OF CORNERS        %8" MMG5_PRId " \n",ncor);
   }
+  if ( bin ) _MMG5_closeBinFile(&bf);
   fclose(inm);
   return(1);
 }
 
 
 int MMG3D_loadMshMesh(MMG5_pMesh mesh,MMG5_pSol sol,const char *filename) {
-  FILE*       inm;
+  _MMG5_MshFile msh;
   int         ier;
-  long        posNodes,posElts,*posNodeData;
-  int         bin,iswp,nelts,nsols;
 
   mesh->dim = 3;
 
-  ier = MMG5_loadMshMesh_part1(mesh,filename,&inm,
-                               &posNodes,&posElts,&posNodeData,
-                               &bin,&iswp,&nelts,&nsols);
+  ier = MMG5_loadMshMesh_part1(mesh,filename,&msh);
   if ( ier < 1 ) return (ier);
 
-  if ( nsols>1 ) {
-    fprintf(stderr,"SEVERAL SOLUTION => IGNORED: %d\n",nsols);
-    fclose(inm);
-    _MMG5_SAFE_FREE(posNodeData);
+  if ( msh.nsols>1 ) {
+    fprintf(stderr,"SEVERAL SOLUTION => IGNORED: %d\n",msh.nsols);
+    _MMG5_freeMshFile(&msh);
     return(-1);
   }
 
   if ( !_MMG3D_zaldy(mesh) ) {
-    fclose(inm);
-    _MMG5_SAFE_FREE(posNodeData);
+    _MMG5_freeMshFile(&msh);
     return(0);
   }
 
   if (mesh->npmax < mesh->np || mesh->ntmax < mesh->nt || mesh->nemax < mesh->ne) {
-    fclose(inm);
-    _MMG5_SAFE_FREE(posNodeData);
+    _MMG5_freeMshFile(&msh);
     return(-1);
   }
 
@@ -985,19 +732,15 @@ int MMG3D_loadMshMesh(MMG5_pMesh mesh,MMG5_pSol sol,const char *filename) {
     fprintf(stderr,"  ** MISSING DATA.\n");
     fprintf(stderr," Check that your mesh contains tetrahedra.\n");
     fprintf(stderr," Exit program.\n");
-    fclose(inm);
-    _MMG5_SAFE_FREE(posNodeData);
+    _MMG5_freeMshFile(&msh);
     return(-1);
   }
 
-  ier =  MMG5_loadMshMesh_part2( mesh, &sol,&inm,
-                                 posNodes,posElts,posNodeData,
-                                 bin,iswp,nelts);
-  _MMG5_SAFE_FREE(posNodeData);
+  ier =  MMG5_loadMshMesh_part2(mesh,&sol,&msh);
   if ( ier < 1 ) return ( ier );
 
   /* Check the metric type */
-  ier = MMG5_chkMetricType(mesh,&sol->type,inm);
+  ier = MMG5_chkMetricType(mesh,&sol->type,NULL);
 
   /* No metric in the input file but we will automatically compute it */
   if ( !mesh->nsols ) mesh->nsols=1;
@@ -1007,35 +750,28 @@ int MMG3D_loadMshMesh(MMG5_pMesh mesh,MMG5_pSol sol,const char *filename) {
 
 
 int MMG3D_loadMshMesh_and_allData(MMG5_pMesh mesh,MMG5_pSol *sol,const char *filename) {
-  FILE*       inm;
+  _MMG5_MshFile msh;
   int         ier;
-  long        posNodes,posElts,*posNodeData;
-  int         bin,iswp,nelts,nsols;
 
   mesh->dim = 3;
 
-  ier = MMG5_loadMshMesh_part1(mesh,filename,&inm,
-                               &posNodes,&posElts,&posNodeData,
-                               &bin,&iswp,&nelts,&nsols);
+  ier = MMG5_loadMshMesh_part1(mesh,filename,&msh);
   if ( ier < 1 ) return (ier);
 
   if ( *sol )  _MMG5_DEL_MEM(mesh,*sol,(mesh->nsols)*sizeof(MMG5_Sol));
 
-  _MMG5_ADD_MEM(mesh,nsols*sizeof(MMG5_Sol),"solutions array",
-                printf("  Exit program.\n"); fclose(inm);
-                _MMG5_SAFE_FREE(posNodeData);
+  _MMG5_ADD_MEM(mesh,msh.nsols*sizeof(MMG5_Sol),"solutions array",
+                printf("  Exit program.\n"); _MMG5_freeMshFile(&msh);
                 return -1);
-  _MMG5_SAFE_CALLOC(*sol,nsols,MMG5_Sol,-1);
+  _MMG5_SAFE_CALLOC(*sol,msh.nsols,MMG5_Sol,-1);
 
   if ( !_MMG3D_zaldy(mesh) ) {
-    fclose(inm);
-    _MMG5_SAFE_FREE(posNodeData);
+    _MMG5_freeMshFile(&msh);
     return(0);
   }
 
   if (mesh->npmax < mesh->np || mesh->ntmax < mesh->nt || mesh->nemax < mesh->ne) {
-    fclose(inm);
-    _MMG5_SAFE_FREE(posNodeData);
+    _MMG5_freeMshFile(&msh);
     return(-1);
   }
 
@@ -1043,21 +779,73 @@ int MMG3D_loadMshMesh_and_allData(MMG5_pMesh mesh,MMG5_pSol *sol,const char *fil
     fprintf(stderr,"  ** MISSING DATA.\n");
     fprintf(stderr," Check that your mesh contains tetrahedra.\n");
     fprintf(stderr," Exit program.\n");
-    fclose(inm);
-    _MMG5_SAFE_FREE(posNodeData);
+    _MMG5_freeMshFile(&msh);
     return(-1);
   }
 
-  ier =  MMG5_loadMshMesh_part2( mesh, sol,&inm,
-                                 posNodes,posElts,posNodeData,
-                                 bin,iswp,nelts);
-  _MMG5_SAFE_FREE(posNodeData);
+  ier =  MMG5_loadMshMesh_part2(mesh,sol,&msh);
   if ( ier < 1 ) return ( ier );
 
   return ier;
 }
 
 
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param data unused.
+ * \param k index of the tetra.
+ * \param buf buffer in which we write.
+ * \return the number of written characters (0 if the tetra is unused).
+ *
+ * Format the tetra \a k for the \a Tetrahedra field of a \a .mesh file (the
+ * \a tmp field of the points stores their new indices).
+ *
+ */
+static int _MMG3D_asciiTetra(MMG5_pMesh mesh,void *data,MMG5_int k,char *buf) {
+  MMG5_pTetra pt;
+  int         i,len;
+
+  pt = &mesh->tetra[k];
+  if ( !MG_EOK(pt) )  return(0);
+
+  len = 0;
+  for ( i=0; i<4; ++i ) {
+    len += _MMG5_fmtInt(buf+len,mesh->point[pt->v[i]].tmp);
+    buf[len++] = ' ';
+  }
+  len += _MMG5_fmtInt(buf+len,pt->ref);
+  buf[len++] = '\n';
+
+  return(len);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param data unused.
+ * \param k index of the triangle.
+ * \param buf buffer in which we write.
+ * \return the number of written characters.
+ *
+ * Format the triangle \a k for the \a Triangles field of a \a .mesh file.
+ *
+ */
+static int _MMG3D_asciiTria(MMG5_pMesh mesh,void *data,MMG5_int k,char *buf) {
+  MMG5_pTria ptt;
+  int        i,len;
+
+  ptt = &mesh->tria[k];
+
+  len = 0;
+  for ( i=0; i<3; ++i ) {
+    len += _MMG5_fmtInt(buf+len,mesh->point[ptt->v[i]].tmp);
+    buf[len++] = ' ';
+  }
+  len += _MMG5_fmtInt(buf+len,ptt->ref);
+  buf[len++] = '\n';
+
+  return(len);
+}
+
 /**
  * \param mesh pointer toward the mesh structure.
  * \param filename pointer toward the name of file.
@@ -1076,9 +864,10 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
   MMG5_pTria   ptt;
   MMG5_pQuad   pq;
   MMG5_xPoint *pxp;
-  int          k,na,nc,np,ne,nn,nr,nre,nedreq,ntreq,nt,nereq;
-  int          npr,nprreq,nq,nqreq;
-  int          bin,binch,bpos;
+  MMG5_int     na,nc,np,ne,nn,nr,nre,nedreq,ntreq,nt,nereq,k;
+  MMG5_int     npr,nprreq,nq,nqreq;
+  int          bin,binch;
+  int64_t      bpos;
   char         *data,chaine[128],*ptr;
 
   mesh->ver = 2;
@@ -1139,7 +928,7 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
     binch = 3; //Dimension
     fwrite(&binch,sw,1,inm);
     bpos = 20; //Pos
-    fwrite(&bpos,sw,1,inm);
+    _MMG5_FWRITE_POS(bpos,inm,return(0));
     binch = 3;
     fwrite(&binch,sw,1,inm);
 
@@ -1168,20 +957,24 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
   if(!bin) {
     strcpy(&chaine[0],"\n\nVertices\n");
     fprintf(inm,"%s",chaine);
-    fprintf(inm,"%d\n",np);
+    fprintf(inm,"%" MMG5_PRId "\n",np);
   } else {
     binch = 4; //Vertices
     fwrite(&binch,sw,1,inm);
-    bpos += 12+(1+3*mesh->ver)*4*np; //NullPos
-    fwrite(&bpos,sw,1,inm);
-    fwrite(&np,sw,1,inm);
+    bpos += 12+(1+3*mesh->ver)*4*(int64_t)np; //NullPos
+    _MMG5_FWRITE_POS(bpos,inm,return(0));
+    _MMG5_FWRITE_IDX(np,inm);
   }
-  for (k=1; k<=mesh->np; k++) {
-    ppt = &mesh->point[k];
-    if ( MG_VOK(ppt) ) {
-      if(!bin) {
-        fprintf(inm,"%.15lg %.15lg %.15lg %d\n",ppt->c[0],ppt->c[1],ppt->c[2],abs(ppt->ref));
-      } else {
+  if(!bin) {
+    if ( !_MMG5_saveAsciiRecords(mesh,inm,mesh->np,3*_MMG5_ASCIIDBL+_MMG5_ASCIIINT,
+                                 _MMG5_asciiVertex3D,NULL) ) {
+      fclose(inm);
+      return(0);
+    }
+  } else {
+    for (k=1; k<=mesh->np; k++) {
+      ppt = &mesh->point[k];
+      if ( MG_VOK(ppt) ) {
         fwrite((unsigned char*)&ppt->c[0],sd,1,inm);
         fwrite((unsigned char*)&ppt->c[1],sd,1,inm);
         fwrite((unsigned char*)&ppt->c[2],sd,1,inm);
@@ -1196,22 +989,22 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
     if(!bin) {
       strcpy(&chaine[0],"\n\nCorners\n");
       fprintf(inm,"%s",chaine);
-      fprintf(inm,"%d\n",nc);
+      fprintf(inm,"%" MMG5_PRId "\n",nc);
     } else {
       binch = 13; //
       fwrite(&binch,sw,1,inm);
-      bpos += 12+4*nc; //NullPos
-      fwrite(&bpos,sw,1,inm);
-      fwrite(&nc,sw,1,inm);
+      bpos += 12+4*(int64_t)nc; //NullPos
+      _MMG5_FWRITE_POS(bpos,inm,return(0));
+      _MMG5_FWRITE_IDX(nc,inm);
     }
 
     for (k=1; k<=mesh->np; k++) {
       ppt = &mesh->point[k];
       if ( MG_VOK(ppt) && ppt->tag & MG_CRN ) {
         if(!bin) {
-          fprintf(inm,"%d \n",ppt->tmp);
+          fprintf(inm,"%" MMG5_PRId " \n",ppt->tmp);
         } else {
-          fwrite(&ppt->tmp,sw,1,inm);
+          _MMG5_FWRITE_IDX(ppt->tmp,inm);
         }
       }
     }
@@ -1220,21 +1013,21 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
     if(!bin) {
       strcpy(&chaine[0],"\n\nRequiredVertices\n");
       fprintf(inm,"%s",chaine);
-      fprintf(inm,"%d\n",nre);
+      fprintf(inm,"%" MMG5_PRId "\n",nre);
     } else {
       binch = 15; //
       fwrite(&binch,sw,1,inm);
-      bpos += 12+4*nre; //NullPos
-      fwrite(&bpos,sw,1,inm);
-      fwrite(&nre,sw,1,inm);
+      bpos += 12+4*(int64_t)nre; //NullPos
+      _MMG5_FWRITE_POS(bpos,inm,return(0));
+      _MMG5_FWRITE_IDX(nre,inm);
     }
     for (k=1; k<=mesh->np; k++) {
       ppt = &mesh->point[k];
       if ( MG_VOK(ppt) && ppt->tag & MG_REQ ) {
         if(!bin) {
-          fprintf(inm,"%d \n",ppt->tmp);
+          fprintf(inm,"%" MMG5_PRId " \n",ppt->tmp);
         } else {
-          fwrite(&ppt->tmp,sw,1,inm);
+          _MMG5_FWRITE_IDX(ppt->tmp,inm);
         }
       }
     }
@@ -1262,13 +1055,13 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
   if(!bin) {
     strcpy(&chaine[0],"\n\nTetrahedra\n");
     fprintf(inm,"%s",chaine);
-    fprintf(inm,"%d\n",ne);
+    fprintf(inm,"%" MMG5_PRId "\n",ne);
   } else {
     binch = 8; //Tetra
     fwrite(&binch,sw,1,inm);
-    bpos += 12 + 20*ne;//Pos
-    fwrite(&bpos,sw,1,inm);
-    fwrite((unsigned char*)&ne,sw,1,inm);
+    bpos += 12 + 20*(int64_t)ne;//Pos
+    _MMG5_FWRITE_POS(bpos,inm,return(0));
+    _MMG5_FWRITE_IDX(ne,inm);
   }
   for (k=1; k<=mesh->ne; k++) {
     pt = &mesh->tetra[k];
@@ -1281,31 +1074,31 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
     mesh->point[pt->v[2]].flag = 1;
     mesh->point[pt->v[3]].flag = 1;
 
-    if ( MG_EOK(pt) ) {
-      if(!bin) {
-        fprintf(inm,"%d %d %d %d %d\n",mesh->point[pt->v[0]].tmp,mesh->point[pt->v[1]].tmp
-                ,mesh->point[pt->v[2]].tmp,mesh->point[pt->v[3]].tmp,pt->ref);
-      } else {
-        fwrite(&mesh->point[pt->v[0]].tmp,sw,1,inm);
-        fwrite(&mesh->point[pt->v[1]].tmp,sw,1,inm);
-        fwrite(&mesh->point[pt->v[2]].tmp,sw,1,inm);
-        fwrite(&mesh->point[pt->v[3]].tmp,sw,1,inm);
-        fwrite(&pt->ref,sw,1,inm);
-      }
+    if ( bin && MG_EOK(pt) ) {
+      _MMG5_FWRITE_IDX(mesh->point[pt->v[0]].tmp,inm);
+      _MMG5_FWRITE_IDX(mesh->point[pt->v[1]].tmp,inm);
+      _MMG5_FWRITE_IDX(mesh->point[pt->v[2]].tmp,inm);
+      _MMG5_FWRITE_IDX(mesh->point[pt->v[3]].tmp,inm);
+      fwrite(&pt->ref,sw,1,inm);
     }
   }
+  if ( !bin && !_MMG5_saveAsciiRecords(mesh,inm,mesh->ne,5*_MMG5_ASCIIINT,
+                                       _MMG3D_asciiTetra,NULL) ) {
+    fclose(inm);
+    return(0);
+  }
 
   if ( nereq ) {
     if(!bin) {
       strcpy(&chaine[0],"\n\nRequiredTetrahedra\n");
       fprintf(inm,"%s",chaine);
-      fprintf(inm,"%d\n",nereq);
+      fprintf(inm,"%" MMG5_PRId "\n",nereq);
     } else {
       binch = 12; //RequiredTetra
       fwrite(&binch,sw,1,inm);
-      bpos += 12 + 4*nereq;//Pos
-      fwrite(&bpos,sw,1,inm);
-      fwrite(&nereq,sw,1,inm);
+      bpos += 12 + 4*(int64_t)nereq;//Pos
+      _MMG5_FWRITE_POS(bpos,inm,return(0));
+      _MMG5_FWRITE_IDX(nereq,inm);
     }
     ne = 0;
     for (k=1; k<=mesh->ne; k++) {
@@ -1314,9 +1107,9 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
       ne++;
       if ( pt->tag & MG_REQ ) {
         if(!bin) {
-          fprintf(inm,"%d \n",ne);
+          fprintf(inm,"%" MMG5_PRId " \n",ne);
         } else {
-          fwrite(&ne,sw,1,inm);
+          _MMG5_FWRITE_IDX(ne,inm);
         }
       }
     }
@@ -1337,30 +1130,30 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
     if(!bin) {
       strcpy(&chaine[0],"\n\nPrisms\n");
       fprintf(inm,"%s",chaine);
-      fprintf(inm,"%d\n",npr);
+      fprintf(inm,"%" MMG5_PRId "\n",npr);
     } else {
       binch = 9; //Prism
       fwrite(&binch,sw,1,inm);
-      bpos += 12 + 20*npr;//Pos
-      fwrite(&bpos,sw,1,inm);
-      fwrite((unsigned char*)&npr,sw,1,inm);
+      bpos += 12 + 20*(int64_t)npr;//Pos
+      _MMG5_FWRITE_POS(bpos,inm,return(0));
+      _MMG5_FWRITE_IDX(npr,inm);
     }
     for (k=1; k<=mesh->nprism; k++) {
       pp = &mesh->prism[k];
       if ( !MG_EOK(pp) ) continue;
 
       if(!bin) {
-        fprintf(inm,"%d %d %d %d %d %d %d\n"
+        fprintf(inm,"%" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %d\n"
                 ,mesh->point[pp->v[0]].tmp,mesh->point[pp->v[1]].tmp
                 ,mesh->point[pp->v[2]].tmp,mesh->point[pp->v[3]].tmp
                 ,mesh->point[pp->v[4]].tmp,mesh->point[pp->v[5]].tmp,pp->ref);
       } else {
-        fwrite(&mesh->point[pp->v[0]].tmp,sw,1,inm);
-        fwrite(&mesh->point[pp->v[1]].tmp,sw,1,inm);
-        fwrite(&mesh->point[pp->v[2]].tmp,sw,1,inm);
-        fwrite(&mesh->point[pp->v[3]].tmp,sw,1,inm);
-        fwrite(&mesh->point[pp->v[4]].tmp,sw,1,inm);
-        fwrite(&mesh->point[pp->v[5]].tmp,sw,1,inm);
+        _MMG5_FWRITE_IDX(mesh->point[pp->v[0]].tmp,inm);
+        _MMG5_FWRITE_IDX(mesh->point[pp->v[1]].tmp,inm);
+        _MMG5_FWRITE_IDX(mesh->point[pp->v[2]].tmp,inm);
+        _MMG5_FWRITE_IDX(mesh->point[pp->v[3]].tmp,inm);
+        _MMG5_FWRITE_IDX(mesh->point[pp->v[4]].tmp,inm);
+        _MMG5_FWRITE_IDX(mesh->point[pp->v[5]].tmp,inm);
         fwrite(&pp->ref,sw,1,inm);
       }
     }
@@ -1383,12 +1176,12 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
     if(!bin) {
       strcpy(&chaine[0],"\n\nNormals\n");
       fprintf(inm,"%s",chaine);
-      fprintf(inm,"%d\n",nn);
+      fprintf(inm,"%" MMG5_PRId "\n",nn);
     } else {      binch = 60; //normals
       fwrite(&binch,sw,1,inm);
-      bpos += 12+(3*mesh->ver)*4*nn; //Pos
-      fwrite(&bpos,sw,1,inm);
-      fwrite(&nn,sw,1,inm);
+      bpos += 12+(3*mesh->ver)*4*(int64_t)nn; //Pos
+      _MMG5_FWRITE_POS(bpos,inm,return(0));
+      _MMG5_FWRITE_IDX(nn,inm);
     }
 
     for (k=1; k<=mesh->np; k++) {
@@ -1410,13 +1203,13 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
     if(!bin) {
       strcpy(&chaine[0],"\n\nNormalAtVertices\n");
       fprintf(inm,"%s",chaine);
-      fprintf(inm,"%d\n",nn);
+      fprintf(inm,"%" MMG5_PRId "\n",nn);
     } else {
       binch = 20; //normalatvertices
       fwrite(&binch,sw,1,inm);
-      bpos += 12 + 2*4*nn;//Pos
-      fwrite(&bpos,sw,1,inm);
-      fwrite(&nn,sw,1,inm);
+      bpos += 12 + 2*4*(int64_t)nn;//Pos
+      _MMG5_FWRITE_POS(bpos,inm,return(0));
+      _MMG5_FWRITE_IDX(nn,inm);
     }
     nn = 0;
     for (k=1; k<=mesh->np; k++) {
@@ -1425,11 +1218,11 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
       else if ( (ppt->tag & MG_BDY)
                 && (!(ppt->tag & MG_GEO) || (ppt->tag & MG_NOM)) ) {
         if(!bin) {
-          fprintf(inm,"%d %d\n",ppt->tmp,++nn);
+          fprintf(inm,"%" MMG5_PRId " %" MMG5_PRId "\n",ppt->tmp,++nn);
         } else {
-          fwrite(&ppt->tmp,sw,1,inm);
+          _MMG5_FWRITE_IDX(ppt->tmp,inm);
           ++nn;
-          fwrite(&nn,sw,1,inm);
+          _MMG5_FWRITE_IDX(nn,inm);
         }
       }
     }
@@ -1439,13 +1232,13 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
       if(!bin) {
         strcpy(&chaine[0],"\n\nTangents\n");
         fprintf(inm,"%s",chaine);
-        fprintf(inm,"%d\n",nt);
+        fprintf(inm,"%" MMG5_PRId "\n",nt);
       } else {
         binch = 59; //tangent
         fwrite(&binch,sw,1,inm);
-        bpos += 12+(3*mesh->ver)*4*nt; //Pos
-        fwrite(&bpos,sw,1,inm);
-        fwrite(&nt,sw,1,inm);
+        bpos += 12+(3*mesh->ver)*4*(int64_t)nt; //Pos
+        _MMG5_FWRITE_POS(bpos,inm,return(0));
+        _MMG5_FWRITE_IDX(nt,inm);
       }
 
       for (k=1; k<=mesh->np; k++) {
@@ -1466,13 +1259,13 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
       if(!bin) {
         strcpy(&chaine[0],"\n\nTangentAtVertices\n");
         fprintf(inm,"%s",chaine);
-        fprintf(inm,"%d\n",nt);
+        fprintf(inm,"%" MMG5_PRId "\n",nt);
       } else {
         binch = 61; //tangentatvertices
         fwrite(&binch,sw,1,inm);
-        bpos += 12 + 2*4*nt;//Pos
-        fwrite(&bpos,sw,1,inm);
-        fwrite(&nt,sw,1,inm);
+        bpos += 12 + 2*4*(int64_t)nt;//Pos
+        _MMG5_FWRITE_POS(bpos,inm,return(0));
+        _MMG5_FWRITE_IDX(nt,inm);
       }
       nt = 0;
       for (k=1; k<=mesh->np; k++) {
@@ -1480,11 +1273,11 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
         if ( !MG_VOK(ppt) || (!ppt->flag) || MG_SIN(ppt->tag) )  continue;
         else if ( MG_EDG(ppt->tag) || (ppt->tag & MG_NOM) ) {
           if(!bin) {
-            fprintf(inm,"%d %d\n",ppt->tmp,++nt);
+            fprintf(inm,"%" MMG5_PRId " %" MMG5_PRId "\n",ppt->tmp,++nt);
           } else {
-            fwrite(&ppt->tmp,sw,1,inm);
+            _MMG5_FWRITE_IDX(ppt->tmp,inm);
             ++nt;
-            fwrite(&(nn),sw,1,inm);
+            _MMG5_FWRITE_IDX((nn),inm);
           }
         }
       }
@@ -1499,49 +1292,51 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
     if(!bin) {
       strcpy(&chaine[0],"\n\nTriangles\n");
       fprintf(inm,"%s",chaine);
-      fprintf(inm,"%d \n",mesh->nt);
+      fprintf(inm,"%" MMG5_PRId " \n",mesh->nt);
     } else {
       binch = 6; //Triangles
       fwrite(&binch,sw,1,inm);
-      bpos += 12+16*mesh->nt; //Pos
-      fwrite(&bpos,sw,1,inm);
-      fwrite(&mesh->nt,sw,1,inm);
+      bpos += 12+16*(int64_t)mesh->nt; //Pos
+      _MMG5_FWRITE_POS(bpos,inm,return(0));
+      _MMG5_FWRITE_IDX(mesh->nt,inm);
     }
     for (k=1; k<=mesh->nt; k++) {
       ptt = &mesh->tria[k];
       if ( ptt->tag[0] & MG_REQ && ptt->tag[1] & MG_REQ && ptt->tag[2] & MG_REQ ) {
         ntreq++;
       }
-      if(!bin) {
-        fprintf(inm,"%d %d %d %d\n",mesh->point[ptt->v[0]].tmp,mesh->point[ptt->v[1]].tmp
-                ,mesh->point[ptt->v[2]].tmp,ptt->ref);
-      } else {
-        fwrite(&mesh->point[ptt->v[0]].tmp,sw,1,inm);
-        fwrite(&mesh->point[ptt->v[1]].tmp,sw,1,inm);
-        fwrite(&mesh->point[ptt->v[2]].tmp,sw,1,inm);
+      if(bin) {
+        _MMG5_FWRITE_IDX(mesh->point[ptt->v[0]].tmp,inm);
+        _MMG5_FWRITE_IDX(mesh->point[ptt->v[1]].tmp,inm);
+        _MMG5_FWRITE_IDX(mesh->point[ptt->v[2]].tmp,inm);
         fwrite(&ptt->ref,sw,1,inm);
       }
     }
+    if ( !bin && !_MMG5_saveAsciiRecords(mesh,inm,mesh->nt,4*_MMG5_ASCIIINT,
+                                         _MMG3D_asciiTria,NULL) ) {
+      fclose(inm);
+      return(0);
+    }
     if ( ntreq ) {
       if(!bin) {
         strcpy(&chaine[0],"\n\nRequiredTriangles\n");
         fprintf(inm,"%s",chaine);
-        fprintf(inm,"%d \n",ntreq);
+        fprintf(inm,"%" MMG5_PRId " \n",ntreq);
       } else {
         binch = 17; //ReqTriangles
         fwrite(&binch,sw,1,inm);
-        bpos += 12+4*ntreq; //Pos
-        fwrite(&bpos,sw,1,inm);
-        fwrite(&ntreq,sw,1,inm);
+        bpos += 12+4*(int64_t)ntreq; //Pos
+        _MMG5_FWRITE_POS(bpos,inm,return(0));
+        _MMG5_FWRITE_IDX(ntreq,inm);
       }
       for (k=0; k<=mesh->nt; k++) {
         ptt = &mesh->tria[k];
         if ( (ptt->tag[0] & MG_REQ) && (ptt->tag[1] & MG_REQ)
              && ptt->tag[2] & MG_REQ ) {
           if(!bin) {
-            fprintf(inm,"%d \n",k);
+            fprintf(inm,"%" MMG5_PRId " \n",k);
           } else {
-            fwrite(&k,sw,1,inm);
+            _MMG5_FWRITE_IDX(k,inm);
           }
         }
       }
@@ -1570,27 +1365,27 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
     if(!bin) {
       strcpy(&chaine[0],"\n\nQuadrilaterals\n");
       fprintf(inm,"%s",chaine);
-      fprintf(inm,"%d \n",nq);
+      fprintf(inm,"%" MMG5_PRId " \n",nq);
     } else {
       binch = 7; //Quadrilaterals
       fwrite(&binch,sw,1,inm);
-      bpos += 12+20*nq; //Pos
-      fwrite(&bpos,sw,1,inm);
-      fwrite(&nq,sw,1,inm);
+      bpos += 12+20*(int64_t)nq; //Pos
+      _MMG5_FWRITE_POS(bpos,inm,return(0));
+      _MMG5_FWRITE_IDX(nq,inm);
     }
     for (k=1; k<=mesh->nquad; k++) {
       pq = &mesh->quadra[k];
       if ( !MG_EOK(pq) ) continue;
 
       if(!bin) {
-        fprintf(inm,"%d %d %d %d %d\n",mesh->point[pq->v[0]].tmp,
+        fprintf(inm,"%" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %d\n",mesh->point[pq->v[0]].tmp,
                 mesh->point[pq->v[1]].tmp,mesh->point[pq->v[2]].tmp,
                 mesh->point[pq->v[3]].tmp, pq->ref);
       } else {
-        fwrite(&mesh->point[pq->v[0]].tmp,sw,1,inm);
-        fwrite(&mesh->point[pq->v[1]].tmp,sw,1,inm);
-        fwrite(&mesh->point[pq->v[2]].tmp,sw,1,inm);
-        fwrite(&mesh->point[pq->v[3]].tmp,sw,1,inm);
+        _MMG5_FWRITE_IDX(mesh->point[pq->v[0]].tmp,inm);
+        _MMG5_FWRITE_IDX(mesh->point[pq->v[1]].tmp,inm);
+        _MMG5_FWRITE_IDX(mesh->point[pq->v[2]].tmp,inm);
+        _MMG5_FWRITE_IDX(mesh->point[pq->v[3]].tmp,inm);
         fwrite(&pq->ref,sw,1,inm);
       }
     }
@@ -1598,22 +1393,22 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
       if(!bin) {
         strcpy(&chaine[0],"\n\nRequiredQuadrilaterals\n");
         fprintf(inm,"%s",chaine);
-        fprintf(inm,"%d \n",nqreq);
+        fprintf(inm,"%" MMG5_PRId " \n",nqreq);
       } else {
         binch = 18; //ReqQuad
         fwrite(&binch,sw,1,inm);
-        bpos += 12+4*nqreq; //Pos
-        fwrite(&bpos,sw,1,inm);
-        fwrite(&nqreq,sw,1,inm);
+        bpos += 12+4*(int64_t)nqreq; //Pos
+        _MMG5_FWRITE_POS(bpos,inm,return(0));
+        _MMG5_FWRITE_IDX(nqreq,inm);
       }
       for (k=0; k<=mesh->nquad; k++) {
         pq = &mesh->quadra[k];
         if ( (pq->tag[0] & MG_REQ) && (pq->tag[1] & MG_REQ)
              && pq->tag[2] & MG_REQ && pq->tag[3] & MG_REQ ) {
           if(!bin) {
-            fprintf(inm,"%d \n",k);
+            fprintf(inm,"%" MMG5_PRId " \n",k);
           } else {
-            fwrite(&k,sw,1,inm);
+            _MMG5_FWRITE_IDX(k,inm);
           }
         }
       }
@@ -1625,21 +1420,21 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
     if(!bin) {
       strcpy(&chaine[0],"\n\nEdges\n");
       fprintf(inm,"%s",chaine);
-      fprintf(inm,"%d\n",mesh->na);
+      fprintf(inm,"%" MMG5_PRId "\n",mesh->na);
     } else {
       binch = 5; //Edges
       fwrite(&binch,sw,1,inm);
-      bpos += 12 + 3*4*mesh->na;//Pos
-      fwrite(&bpos,sw,1,inm);
-      fwrite(&mesh->na,sw,1,inm);
+      bpos += 12 + 3*4*(int64_t)mesh->na;//Pos
+      _MMG5_FWRITE_POS(bpos,inm,return(0));
+      _MMG5_FWRITE_IDX(mesh->na,inm);
     }
     for (k=1; k<=mesh->na; k++) {
       if(!bin) {
-        fprintf(inm,"%d %d %d \n",mesh->point[mesh->edge[k].a].tmp,
+        fprintf(inm,"%" MMG5_PRId " %" MMG5_PRId " %d \n",mesh->point[mesh->edge[k].a].tmp,
                 mesh->point[mesh->edge[k].b].tmp,mesh->edge[k].ref);
       } else {
-        fwrite(&mesh->point[mesh->edge[k].a].tmp,sw,1,inm);
-        fwrite(&mesh->point[mesh->edge[k].b].tmp,sw,1,inm);
+        _MMG5_FWRITE_IDX(mesh->point[mesh->edge[k].a].tmp,inm);
+        _MMG5_FWRITE_IDX(mesh->point[mesh->edge[k].b].tmp,inm);
         fwrite(&mesh->edge[k].ref,sw,1,inm);
       }
       if ( mesh->edge[k].tag & MG_GEO ) nr++;
@@ -1650,22 +1445,22 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
       if(!bin) {
         strcpy(&chaine[0],"\n\nRidges\n");
         fprintf(inm,"%s",chaine);
-        fprintf(inm,"%d\n",nr);
+        fprintf(inm,"%" MMG5_PRId "\n",nr);
       } else {
         binch = 14; //Ridges
         fwrite(&binch,sw,1,inm);
-        bpos += 12 + 4*nr;//Pos
-        fwrite(&bpos,sw,1,inm);
-        fwrite(&nr,sw,1,inm);
+        bpos += 12 + 4*(int64_t)nr;//Pos
+        _MMG5_FWRITE_POS(bpos,inm,return(0));
+        _MMG5_FWRITE_IDX(nr,inm);
       }
       na = 0;
       for (k=1; k<=mesh->na; k++) {
         na++;
         if ( mesh->edge[k].tag & MG_GEO ) {
           if(!bin) {
-            fprintf(inm,"%d \n",na);
+            fprintf(inm,"%" MMG5_PRId " \n",na);
           } else {
-            fwrite(&na,sw,1,inm);
+            _MMG5_FWRITE_IDX(na,inm);
           }
         }
       }
@@ -1675,22 +1470,22 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
       if(!bin) {
         strcpy(&chaine[0],"\n\nRequiredEdges\n");
         fprintf(inm,"%s",chaine);
-        fprintf(inm,"%d\n",nedreq);
+        fprintf(inm,"%" MMG5_PRId "\n",nedreq);
       } else {
         binch = 16; //RequiredEdges
         fwrite(&binch,sw,1,inm);
-        bpos += 12 + 4*nedreq;//Pos
-        fwrite(&bpos,sw,1,inm);
-        fwrite(&nedreq,sw,1,inm);
+        bpos += 12 + 4*(int64_t)nedreq;//Pos
+        _MMG5_FWRITE_POS(bpos,inm,return(0));
+        _MMG5_FWRITE_IDX(nedreq,inm);
       }
       na = 0;
       for (k=1; k<=mesh->na; k++) {
         na++;
         if (  mesh->edge[k].tag & MG_REQ ) {
           if(!bin) {
-            fprintf(inm,"%d \n",na);
+            fprintf(inm,"%" MMG5_PRId " \n",na);
           } else {
-            fwrite(&na,sw,1,inm);
+            _MMG5_FWRITE_IDX(na,inm);
           }
         }
       }
@@ -1699,20 +1494,20 @@ int MMG3D_saveMesh(MMG5_pMesh mesh, const char *filename) {
 
 
   if ( mesh->info.imprim > 4 ) {
-    fprintf(stdout,"     NUMBER OF VERTICES       %8d   CORNERS %8d"
-            "   REQUIRED %8d\n",np,nc,nre);
-    fprintf(stdout,"     NUMBER OF TETRAHEDRA     %8d   REQUIRED  %8d\n",
+    fprintf(stdout,"     NUMBER OF VERTICES       %8" MMG5_PRId "   CORNERS %8" MMG5_PRId
+            "   REQUIRED %8" MMG5_PRId "\n",np,nc,nre);
+    fprintf(stdout,"     NUMBER OF TETRAHEDRA     %8" MMG5_PRId "   REQUIRED  %8" MMG5_PRId "\n",
             ne,nereq);
     if ( npr )
-      fprintf(stdout,"     NUMBER OF PRISMS         %8d\n",npr);
+      fprintf(stdout,"     NUMBER OF PRISMS         %8" MMG5_PRId "\n",npr);
 
     if ( na )
-      fprintf(stdout,"     NUMBER OF EDGES          %8d   RIDGES  %8d\n",na,nr);
+      fprintf(stdout,"     NUMBER OF EDGES          %8" MMG5_PRId "   RIDGES  %8" MMG5_PRId "\n",na,nr);
     if ( mesh->nt )
-      fprintf(stdout,"     NUMBER OF TRIANGLES      %8d   REQUIRED  %8d\n",
+      fprintf(stdout,"     NUMBER OF TRIANGLES      %8" MMG5_PRId "   REQUIRED  %8" MMG5_PRId "\n",
               mesh->nt, ntreq);
     if ( nq )
-      fprintf(stdout,"     NUMBER OF QUADRILATERALS %8d\n",nq);
+      fprintf(stdout,"     NUMBER OF QUADRILATERALS %8" MMG5_PRId "\n",nq);
   }
 
   /*fin fichier*/
@@ -1749,8 +1544,10 @@ int MMG3D_saveMshMesh_and_allData(MMG5_pMesh mesh,MMG5_pSol *sol,const char *fil
 int MMG3D_loadSol(MMG5_pMesh mesh,MMG5_pSol met, const char *filename) {
   FILE       *inm;
   long        posnp;
-  int         iswp,ier,dim;
-  int         k,ver,bin,np,nsols,*type;
+  int         iswp,ier;
+  MMG5_int    dim;
+  int         ver,bin,nsols,*type;
+  MMG5_int    np,k;
 
   /** Read the file header */
   ier =  MMG5_loadSolHeader(filename,3,&inm,&ver,&bin,&iswp,&np,&dim,&nsols,
@@ -1766,8 +1563,8 @@ int MMG3D_loadSol(MMG5_pMesh mesh,MMG5_pSol met, const char *filename) {
 
   if ( mesh->np != np ) {
     fprintf(stderr,"  ** MISMATCHES DATA: THE NUMBER OF VERTICES IN "
-            "THE MESH (%d) DIFFERS FROM THE NUMBER OF VERTICES IN "
-            "THE SOLUTION (%d) \n",mesh->np,np);
+            "THE MESH (%" MMG5_PRId ") DIFFERS FROM THE NUMBER OF VERTICES IN "
+            "THE SOLUTION (%" MMG5_PRId ") \n",mesh->np,np);
     fclose(inm);
     _MMG5_SAFE_FREE(type);
     return(-1);
@@ -1788,19 +1585,27 @@ int MMG3D_loadSol(MMG5_pMesh mesh,MMG5_pSol met, const char *filename) {
   _MMG5_SAFE_FREE(type);
 
   /* Read mesh solutions */
-  rewind(inm);
-  fseek(inm,posnp,SEEK_SET);
-
-  if ( met->ver == 1 ) {
-    /* Simple precision */
-    for (k=1; k<=mesh->np; k++) {
-      MMG5_readFloatSol3D(met,inm,bin,iswp,k);
+  if ( bin ) {
+    if ( !MMG5_readBinSols(met,1,inm,posnp) ) {
+      fclose(inm);
+      return(-1);
     }
   }
   else {
-    /* Double precision */
-    for (k=1; k<=mesh->np; k++) {
-      MMG5_readDoubleSol3D(met,inm,bin,iswp,k);
+    rewind(inm);
+    fseek(inm,posnp,SEEK_SET);
+
+    if ( met->ver == 1 ) {
+      /* Simple precision */
+      for (k=1; k<=mesh->np; k++) {
+        MMG5_readFloatSol3D(met,inm,bin,iswp,k);
+      }
+    }
+    else {
+      /* Double precision */
+      for (k=1; k<=mesh->np; k++) {
+        MMG5_readDoubleSol3D(met,inm,bin,iswp,k);
+      }
     }
   }
 
@@ -1825,10 +1630,12 @@ int MMG3D_loadAllSols(MMG5_pMesh mesh,MMG5_pSol *sol, const char *filename) {
   MMG5_pSol   psl;
   FILE       *inm;
   long        posnp;
-  int         iswp,ier,dim;
-  int         j,k,ver,bin,np,nsols,*type;
+  int         iswp,ier;
+  MMG5_int    dim;
+  int         j,ver,bin,nsols,*type;
+  MMG5_int    np,k;
   char        data[10];
-  static char mmgWarn = 0;
+  static _MMG5_TLS char mmgWarn = 0;
 
   /** Read the file header */
   ier =  MMG5_loadSolHeader(filename,3,&inm,&ver,&bin,&iswp,&np,&dim,&nsols,
@@ -1837,8 +1644,8 @@ int MMG3D_loadAllSols(MMG5_pMesh mesh,MMG5_pSol *sol, const char *filename) {
 
   if ( mesh->np != np ) {
     fprintf(stderr,"  ** MISMATCHES DATA: THE NUMBER OF VERTICES IN "
-            "THE MESH (%d) DIFFERS FROM THE NUMBER OF VERTICES IN "
-            "THE SOLUTION (%d) \n",mesh->np,np);
+            "THE MESH (%" MMG5_PRId ") DIFFERS FROM THE NUMBER OF VERTICES IN "
+            "THE SOLUTION (%" MMG5_PRId ") \n",mesh->np,np);
     fclose(inm);
     _MMG5_SAFE_FREE(type);
     return(-1);
@@ -1889,24 +1696,32 @@ int MMG3D_loadAllSols(MMG5_pMesh mesh,MMG5_pSol *sol, const char *filename) {
   _MMG5_SAFE_FREE(type);
 
   /* read mesh solutions */
-  rewind(inm);
-  fseek(inm,posnp,SEEK_SET);
-
-  if ( (*sol)[0].ver == 1 ) {
-    /* Simple precision */
-    for (k=1; k<=mesh->np; k++) {
-      for ( j=0; j<nsols; ++j ) {
-        psl = *sol + j;
-        MMG5_readFloatSol3D(psl,inm,bin,iswp,k);
-      }
+  if ( bin ) {
+    if ( !MMG5_readBinSols(*sol,nsols,inm,posnp) ) {
+      fclose(inm);
+      return(-1);
     }
   }
   else {
-    /* Double precision */
-    for (k=1; k<=mesh->np; k++) {
-      for ( j=0; j<nsols; ++j ) {
-        psl = *sol + j;
-        MMG5_readDoubleSol3D(psl,inm,bin,iswp,k);
+    rewind(inm);
+    fseek(inm,posnp,SEEK_SET);
+
+    if ( (*sol)[0].ver == 1 ) {
+      /* Simple precision */
+      for (k=1; k<=mesh->np; k++) {
+        for ( j=0; j<nsols; ++j ) {
+          psl = *sol + j;
+          MMG5_readFloatSol3D(psl,inm,bin,iswp,k);
+        }
+      }
+    }
+    else {
+      /* Double precision */
+      for (k=1; k<=mesh->np; k++) {
+        for ( j=0; j<nsols; ++j ) {
+          psl = *sol + j;
+          MMG5_readDoubleSol3D(psl,inm,bin,iswp,k);
+        }
       }
     }
   }
@@ -1930,7 +1745,8 @@ int MMG3D_loadAllSols(MMG5_pMesh mesh,MMG5_pSol *sol, const char *filename) {
 int MMG3D_saveSol(MMG5_pMesh mesh,MMG5_pSol met, const char *filename) {
   FILE*        inm;
   MMG5_pPoint  ppt;
-  int          binch,bin,ier,k;
+  int          binch,bin,ier;
+  MMG5_int     k;
 
   if ( !met->m )  return(-1);
 
@@ -1941,12 +1757,20 @@ int MMG3D_saveSol(MMG5_pMesh mesh,MMG5_pSol met, const char *filename) {
 
   if ( ier < 1 )  return ier;
 
-  for (k=1; k<=mesh->np; k++) {
-    ppt = &mesh->point[k];
-    if ( !MG_VOK(ppt) ) continue;
+  if(!bin) {
+    if ( !MMG5_saveAsciiSols(mesh,met,1,inm,1) ) {
+      fclose(inm);
+      return(0);
+    }
+  }
+  else {
+    for (k=1; k<=mesh->np; k++) {
+      ppt = &mesh->point[k];
+      if ( !MG_VOK(ppt) ) continue;
 
-    MMG5_writeDoubleSol3D(mesh,met,inm,bin,k,1);
-    fprintf(inm,"\n");
+      MMG5_writeDoubleSol3D(mesh,met,inm,bin,k,1);
+      fprintf(inm,"\n");
+    }
   }
 
   /* End file */
@@ -1973,7 +1797,8 @@ int MMG3D_saveAllSols(MMG5_pMesh mesh,MMG5_pSol *sol, const char *filename) {
   MMG5_pSol    psl;
   FILE*        inm;
   MMG5_pPoint  ppt;
-  int          binch,bin,ier,k,j;
+  int          binch,bin,ier,j;
+  MMG5_int     k;
   int          *type,*size;
 
   if ( !(*sol)[0].m )  return(-1);
@@ -1995,15 +1820,23 @@ int MMG3D_saveAllSols(MMG5_pMesh mesh,MMG5_pSol *sol, const char *filename) {
 
   if ( ier < 1 )  return ier;
 
-  for (k=1; k<=mesh->np; k++) {
-    ppt = &mesh->point[k];
-    if ( !MG_VOK(ppt) ) continue;
+  if(!bin) {
+    if ( !MMG5_saveAsciiSols(mesh,*sol,mesh->nsols,inm,0) ) {
+      fclose(inm);
+      return(0);
+    }
+  }
+  else {
+    for (k=1; k<=mesh->np; k++) {
+      ppt = &mesh->point[k];
+      if ( !MG_VOK(ppt) ) continue;
 
-    for ( j=0; j<mesh->nsols; ++j ) {
-      psl = *sol+j;
-      MMG5_writeDoubleSol3D(mesh,psl,inm,bin,k,0);
+      for ( j=0; j<mesh->nsols; ++j ) {
+        psl = *sol+j;
+        MMG5_writeDoubleSol3D(mesh,psl,inm,bin,k,0);
+      }
+      fprintf(inm,"\n");
     }
-    fprintf(inm,"\n");
   }
 
   /* End file */
@@ -48,14 +48,14 @@
  * \a k for a special storage of ridges metric (after defsiz call).
  *
  */
-int _MMG5_intmet_ani(MMG5_pMesh mesh,MMG5_pSol met,int k,char i,int ip,
+int _MMG5_intmet_ani(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,char i,MMG5_int ip,
                       double s) {
   MMG5_pTetra   pt;
   MMG5_pxTetra  pxt;
   MMG5_pPoint   ppt;
   MMG5_pxPoint  pxp;
   double        *m;
-  int           ip1,ip2;
+  MMG5_int      ip1,ip2;
 
   pt = &mesh->tetra[k];
   m  = &met->m[6*ip];
@@ -98,11 +98,11 @@ int _MMG5_intmet_ani(MMG5_pMesh mesh,MMG5_pSol met,int k,char i,int ip,
  * \a k for a classic storage of ridges metrics (before defsiz call).
  *
  */
-int _MMG3D_intmet33_ani(MMG5_pMesh mesh,MMG5_pSol met,int k,char i,int ip,
+int _MMG3D_intmet33_ani(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,char i,MMG5_int ip,
                       double s) {
   MMG5_pTetra   pt;
   double        *m,*n,*mr;
-  int           ip1,ip2;
+  MMG5_int      ip1,ip2;
 
   pt = &mesh->tetra[k];
   ip1 = pt->v[_MMG5_iare[i][0]];
@@ -128,10 +128,10 @@ int _MMG3D_intmet33_ani(MMG5_pMesh mesh,MMG5_pSol met,int k,char i,int ip,
  * \a k.
  *
  */
-int _MMG5_intmet_iso(MMG5_pMesh mesh,MMG5_pSol met,int k,char i,int ip,
+int _MMG5_intmet_iso(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,char i,MMG5_int ip,
                       double s) {
   MMG5_pTetra   pt;
-  int           ip1, ip2;
+  MMG5_int      ip1,ip2;
   double        *m1,*m2,*mm;
 
   pt = &mesh->tetra[k];
@@ -159,7 +159,7 @@ int _MMG5_intmet_iso(MMG5_pMesh mesh,MMG5_pSol met,int k,char i,int ip,
  * \f$ p_1-p_2 \f$ must not be a ridge.
  *
  * */
-int _MMG5_intregmet(MMG5_pMesh mesh,MMG5_pSol met,int k,char i,double s,
+int _MMG5_intregmet(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,char i,double s,
                     double mr[6]) {
   MMG5_pTetra     pt;
   MMG5_pxTetra    pxt;
@@ -204,7 +204,7 @@ static inline int
 _MMG5_intregvolmet(double *ma,double *mb,double *mp,double t) {
   double        dma[6],dmb[6],mai[6],mbi[6],mi[6];
   int           i;
-  static char   mmgWarn=0;
+  static _MMG5_TLS char   mmgWarn=0;
 
   for (i=0; i<6; i++) {
     dma[i] = ma[i];
@@ -246,12 +246,13 @@ _MMG5_intregvolmet(double *ma,double *mb,double *mp,double t) {
  * \f$ p_1-p_2 \f$ is an internal edge.
  *
  */
-int _MMG5_intvolmet(MMG5_pMesh mesh,MMG5_pSol met,int k,char i,double s,
+int _MMG5_intvolmet(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,char i,double s,
                     double mr[6]) {
   MMG5_pTetra     pt;
   MMG5_pPoint     pp1,pp2;
   double          m1[6],m2[6];
-  int             ip1,ip2,l,ier;
+  int             l,ier;
+  MMG5_int        ip1,ip2;
 
   pt  = &mesh->tetra[k];
 
@@ -305,7 +306,7 @@ int _MMG5_intvolmet(MMG5_pMesh mesh,MMG5_pSol met,int k,char i,double s,
  * coordinates of the new point in \a k.
  *
  */
-int _MMG5_interp4bar_iso(MMG5_pMesh mesh, MMG5_pSol met, int k, int ip,
+int _MMG5_interp4bar_iso(MMG5_pMesh mesh, MMG5_pSol met, MMG5_int k, MMG5_int ip,
                          double cb[4]) {
   MMG5_pTetra pt;
 
@@ -333,11 +334,11 @@ int _MMG5_interp4bar_iso(MMG5_pMesh mesh, MMG5_pSol met, int k, int ip,
  *
  */
 static inline
-int _MMG5_interp4barintern(MMG5_pSol met,int ip,double cb[4],double dm0[6],
+int _MMG5_interp4barintern(MMG5_pSol met,MMG5_int ip,double cb[4],double dm0[6],
                            double dm1[6],double dm2[6],double dm3[6]) {
   double        m0i[6],m1i[6],m2i[6],m3i[6],mi[6];
   int           i;
-  static char   mmgWarn=0;
+  static _MMG5_TLS char   mmgWarn=0;
 
  if ( !_MMG5_invmat(dm0,m0i) || !_MMG5_invmat(dm1,m1i) ||
        !_MMG5_invmat(dm2,m2i) || !_MMG5_invmat(dm3,m3i) ) {
@@ -375,7 +376,7 @@ int _MMG5_interp4barintern(MMG5_pSol met,int ip,double cb[4],double dm0[6],
  * coordinates of the new point in \a k.
  *
  */
-int _MMG5_interp4bar_ani(MMG5_pMesh mesh, MMG5_pSol met, int k, int ip,
+int _MMG5_interp4bar_ani(MMG5_pMesh mesh, MMG5_pSol met, MMG5_int k, MMG5_int ip,
                          double cb[4]) {
   MMG5_pTetra   pt;
   MMG5_pPoint   pp1,pp2,pp3,pp4;
@@ -447,7 +448,7 @@ int _MMG5_interp4bar_ani(MMG5_pMesh mesh, MMG5_pSol met, int k, int ip,
  * coordinates of the new point in \a k.
  *
  */
-int _MMG5_interp4bar33_ani(MMG5_pMesh mesh, MMG5_pSol met, int k, int ip,
+int _MMG5_interp4bar33_ani(MMG5_pMesh mesh, MMG5_pSol met, MMG5_int k, MMG5_int ip,
                            double cb[4]) {
   MMG5_pTetra   pt;
   double        dm0[6],dm1[6],dm2[6],dm3[6];
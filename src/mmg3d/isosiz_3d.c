@@ -35,7 +35,10 @@
 #include "mmg3d.h"
 #include "inlined_functions.h"
 
-extern char   ddb;
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 
 #define MAXLEN    1.0e9
 #define A64TH     0.015625
@@ -85,7 +88,7 @@ inline double _MMG5_lenedgCoor_iso(double *ca,double *cb,double *ma,double *mb)
  *
  */
 static double
-_MMG5_defsizreg(MMG5_pMesh mesh,MMG5_pSol met,int nump,int *lists,
+_MMG5_defsizreg(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int nump,MMG5_int *lists,
                 int ilists, double hmin,double hmax,double hausd) {
   MMG5_pTetra       pt;
   MMG5_pxTetra      pxt;
@@ -95,9 +98,10 @@ _MMG5_defsizreg(MMG5_pMesh mesh,MMG5_pSol met,int nump,int *lists,
   double       ux,uy,uz,det2d,h,isqhmin,isqhmax,ll,lmin,lmax,hnm,s;
   double       *n,*t,r[3][3],lispoi[3*MMG3D_LMAX+1],intm[3],b0[3],b1[3],c[3],tAA[6],tAb[3],d[3];
   double       kappa[2],vp[2][2];
-  int          k,na,nb,ntempa,ntempb,iel,ip0;
+  int          k;
+  MMG5_int     na,nb,ntempa,ntempb,ip0,iel;
   char         iface,i,j,i0;
-  static char  mmgWarn0=0,mmgWarn1=0,mmgWarn2=0,mmgWarn3=0;
+  static _MMG5_TLS char  mmgWarn0=0,mmgWarn1=0,mmgWarn2=0,mmgWarn3=0;
 
   p0 = &mesh->point[nump];
 
@@ -105,7 +109,7 @@ _MMG5_defsizreg(MMG5_pMesh mesh,MMG5_pSol met,int nump,int *lists,
     if ( !mmgWarn0 ) {
       mmgWarn0 = 1;
       fprintf(stderr,"\n  ## Error: %s: at least 1 wrong point"
-              " qualification : xp ? %d.\n",__func__,p0->xp);
+              " qualification : xp ? %" MMG5_PRId ".\n",__func__,p0->xp);
     }
     return(FLT_MAX);
   }
@@ -248,7 +252,7 @@ _MMG5_defsizreg(MMG5_pMesh mesh,MMG5_pSol met,int nump,int *lists,
     _MMG5_tet2tri(mesh,iel,iface,&tt);
 
     pxt   = &mesh->xtetra[mesh->tetra[iel].xt];
-    if ( !_MMG5_bezierCP(mesh,&tt,&b,MG_GET(pxt->ori,iface)) ) {
+    if ( !mesh->func.bezierCP(mesh,&tt,&b,MG_GET(pxt->ori,iface)) ) {
       if ( !mmgWarn2 ) {
         mmgWarn2 = 1;
         fprintf(stderr,"\n  ## Warning: %s: function _MMG5_bezierCP return 0.\n",
@@ -458,12 +462,13 @@ _MMG5_defsizreg(MMG5_pMesh mesh,MMG5_pSol met,int nump,int *lists,
  * the surface edges passing through \a nump.
  *
  */
-double _MMG5_meansizreg_iso(MMG5_pMesh mesh,MMG5_pSol met,int nump,int *lists,
+double _MMG5_meansizreg_iso(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int nump,MMG5_int *lists,
                 int ilists, double hmin,double hmax) {
   MMG5_pTetra       pt;
   MMG5_pPoint       p0,p1;
   double            len,ux,uy,uz;
-  int               k,iel,ip1;
+  int               k;
+  MMG5_int          ip1,iel;
   char              i,iface;
 
   p0 = &mesh->point[nump];
@@ -511,7 +516,8 @@ int _MMG3D_defsiz_iso(MMG5_pMesh mesh,MMG5_pSol met) {
   MMG5_pPoint    p0,p1;
   double         hp,v[3],b0[3],b1[3],b0p0[3],b1b0[3],p1b1[3],hausd,hmin,hmax;
   double         secder0[3],secder1[3],kappa,tau[3],gammasec[3],ntau2,intau,ps,lm;
-  int            lists[MMG3D_LMAX+2],listv[MMG3D_LMAX+2],ilists,ilistv,k,ip0,ip1,l;
+  int            ilists,ilistv,l;
+  MMG5_int       ip0,ip1,lists[MMG3D_LMAX+2],listv[MMG3D_LMAX+2],k;
   int            kk,isloc,ismet;
   char           i,j,ia,ised,i0,i1;
   MMG5_pPar      par;
@@ -898,21 +904,21 @@ int _MMG3D_defsiz_iso(MMG5_pMesh mesh,MMG5_pSol met) {
 /**
  * \param mesh pointer toward the mesh structure.
  * \param met pointer toward the metric structure.
- * \return 0 if fail, 1 otherwise.
+ * \return 1.
  *
- * Enforce mesh gradation by truncating size map.
+ * Enforce mesh gradation by truncating size map: sweeps over the edges of
+ * the tetra until no size is modified (used if the memory is not sufficient
+ * to store the edge graph).
  *
  */
-int _MMG5_gradsiz_iso(MMG5_pMesh mesh,MMG5_pSol met) {
+static int _MMG3D_gradsizSweep_iso(MMG5_pMesh mesh,MMG5_pSol met) {
   MMG5_pTetra    pt;
   MMG5_pPoint    p0,p1;
   double    l,hn;
-  int       ip0,ip1,it,maxit,nu,nup,k;
+  int       it,maxit,nu,nup;
+  MMG5_int  ip0,ip1,k;
   char      i,j,ia,i0,i1;
 
-  if ( abs(mesh->info.imprim) > 5 || mesh->info.ddebug )
-    fprintf(stdout,"  ** Grading mesh\n");
-
   for (k=1; k<=mesh->np; k++)
     mesh->point[k].flag = mesh->base;
 
@@ -969,3 +975,212 @@ int _MMG5_gradsiz_iso(MMG5_pMesh mesh,MMG5_pSol met) {
     fprintf(stdout,"     gradation: %7d updated, %d iter.\n",nup,it);
   return(1);
 }
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param pvadj pointer toward the array (of size \a np+2) of the position of
+ * the first neighbour of each point in \a padj.
+ * \param padj pointer toward the list of the neighbours of the points.
+ * \return 1 if success, 0 if the memory is not sufficient.
+ *
+ * Build the graph of the edges of the non-required tetra: each edge is stored
+ * once per extremity, the neighbours of the point \a k are \a
+ * adj[vadj[k]] to \a adj[vadj[k+1]-1]. The arrays are counted in the mesh
+ * memory.
+ *
+ */
+static int _MMG3D_edgeGraph(MMG5_pMesh mesh,MMG5_int **pvadj,MMG5_int **padj) {
+  MMG5_pTetra  pt;
+  long long    msiz;
+  int          nth,i;
+  MMG5_int     np,iq,ip,l,n,*vtet,*tet,*vadj,*mark,*mk,*adj;
+
+  if ( !_MMG3D_pointTetra(mesh,1,&vtet,&tet) )  return(0);
+
+  np = mesh->np;
+#ifdef _OPENMP
+  nth = MG_MAX(1,mesh->info.nthreads);
+#else
+  nth = 1;
+#endif
+
+  /* the marks are only needed while building the graph */
+  msiz = (long long)(np+2)*sizeof(MMG5_int) + (long long)nth*(np+1)*sizeof(MMG5_int);
+  if ( mesh->memCur + msiz > mesh->memMax ) {
+    _MMG5_DEL_MEM(mesh,tet,MG_MAX(1,vtet[np+1])*sizeof(MMG5_int));
+    _MMG5_DEL_MEM(mesh,vtet,(np+2)*sizeof(MMG5_int));
+    return(0);
+  }
+  _MMG5_ADD_MEM(mesh,msiz,"edge graph",return(0));
+  _MMG5_SAFE_CALLOC(vadj,np+2,MMG5_int,0);
+  _MMG5_SAFE_CALLOC(mark,nth*(np+1),MMG5_int,0);
+
+  /* number of neighbours of each point (mark[iq] = ip if iq is counted) */
+#pragma omp parallel num_threads(nth) private(mk,pt,l,i,iq,n)
+  {
+#ifdef _OPENMP
+    mk = mark + omp_get_thread_num()*(np+1);
+#else
+    mk = mark;
+#endif
+#pragma omp for schedule(dynamic,1024)
+    for (ip=1; ip<=np; ip++) {
+      n = 0;
+      for (l=vtet[ip]; l<vtet[ip+1]; l++) {
+        pt = &mesh->tetra[tet[l]];
+        for (i=0; i<4; i++) {
+          iq = pt->v[i];
+          if ( iq == ip || mk[iq] == ip )  continue;
+          mk[iq] = ip;
+          n++;
+        }
+      }
+      vadj[ip+1] = n;
+    }
+  }
+  vadj[1] = 0;
+  for (ip=1; ip<=np; ip++)
+    vadj[ip+1] += vadj[ip];
+
+  n = MG_MAX(1,vadj[np+1]);
+  if ( mesh->memCur + (long long)(n*sizeof(MMG5_int)) > mesh->memMax ) {
+    _MMG5_DEL_MEM(mesh,mark,nth*(np+1)*sizeof(MMG5_int));
+    _MMG5_DEL_MEM(mesh,vadj,(np+2)*sizeof(MMG5_int));
+    _MMG5_DEL_MEM(mesh,tet,MG_MAX(1,vtet[np+1])*sizeof(MMG5_int));
+    _MMG5_DEL_MEM(mesh,vtet,(np+2)*sizeof(MMG5_int));
+    return(0);
+  }
+  _MMG5_ADD_MEM(mesh,n*sizeof(MMG5_int),"edge graph",return(0));
+  _MMG5_SAFE_MALLOC(adj,n,MMG5_int,0);
+
+  /* fill the neighbours (mark[iq] = -ip if iq is stored) */
+#pragma omp parallel num_threads(nth) private(mk,pt,l,i,iq,n)
+  {
+#ifdef _OPENMP
+    mk = mark + omp_get_thread_num()*(np+1);
+#else
+    mk = mark;
+#endif
+#pragma omp for schedule(dynamic,1024)
+    for (ip=1; ip<=np; ip++) {
+      n = vadj[ip];
+      for (l=vtet[ip]; l<vtet[ip+1]; l++) {
+        pt = &mesh->tetra[tet[l]];
+        for (i=0; i<4; i++) {
+          iq = pt->v[i];
+          if ( iq == ip || mk[iq] == -ip )  continue;
+          mk[iq] = -ip;
+          adj[n++] = iq;
+        }
+      }
+    }
+  }
+
+  _MMG5_DEL_MEM(mesh,mark,nth*(np+1)*sizeof(MMG5_int));
+  _MMG5_DEL_MEM(mesh,tet,MG_MAX(1,vtet[np+1])*sizeof(MMG5_int));
+  _MMG5_DEL_MEM(mesh,vtet,(np+2)*sizeof(MMG5_int));
+
+  *pvadj = vadj;
+  *padj  = adj;
+  return(1);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param met pointer toward the metric structure.
+ * \return 0 if fail, 1 otherwise.
+ *
+ * Enforce mesh gradation by truncating size map. Each point marked as dirty
+ * takes the minimum of its size and of the sizes of its neighbours increased
+ * by the gradation, and marks its neighbours as dirty if its size is
+ * modified. The points are processed by rounds (in parallel, each point being
+ * written by only one thread) until no point is dirty: the sizes only
+ * decrease so the result is the fixed point of the sweeps over the edges of
+ * the tetra, whatever the processing order.
+ *
+ */
+int _MMG5_gradsiz_iso(MMG5_pMesh mesh,MMG5_pSol met) {
+  MMG5_pPoint    p0,p1;
+  double         l,hn,hw,hv;
+  int            *dirty,d;
+  MMG5_int       np,*vadj,*adj,ip,nup,nu,k,j,it;
+#ifdef _OPENMP
+  int            nth;
+#endif
+
+  if ( abs(mesh->info.imprim) > 5 || mesh->info.ddebug )
+    fprintf(stdout,"  ** Grading mesh\n");
+
+  np = mesh->np;
+  if ( !_MMG3D_edgeGraph(mesh,&vadj,&adj) )
+    return(_MMG3D_gradsizSweep_iso(mesh,met));
+
+  if ( mesh->memCur + (long long)((np+1)*sizeof(int)) > mesh->memMax ) {
+    _MMG5_DEL_MEM(mesh,adj,MG_MAX(1,vadj[np+1])*sizeof(MMG5_int));
+    _MMG5_DEL_MEM(mesh,vadj,(np+2)*sizeof(MMG5_int));
+    return(_MMG3D_gradsizSweep_iso(mesh,met));
+  }
+  _MMG5_ADD_MEM(mesh,(np+1)*sizeof(int),"gradation front",return(0));
+  _MMG5_SAFE_MALLOC(dirty,np+1,int,0);
+
+#ifdef _OPENMP
+  nth = MG_MAX(1,mesh->info.nthreads);
+#endif
+
+  for (k=1; k<=np; k++) {
+    mesh->point[k].flag = mesh->base;
+    dirty[k] = 1;
+  }
+
+  it = nup = 0;
+  do {
+    it++;
+    mesh->base++;
+    nu = 0;
+#pragma omp parallel for num_threads(nth) private(ip,j,d,p0,p1,l,hn,hw,hv) \
+  reduction(+:nu)
+    for (k=1; k<=np; k++) {
+#pragma omp atomic capture
+      { d = dirty[k]; dirty[k] = 0; }
+      if ( !d )  continue;
+
+      hw = met->m[k];
+      if ( hw < _MMG5_EPSD )  continue;
+
+      p1 = &mesh->point[k];
+      for (j=vadj[k]; j<vadj[k+1]; j++) {
+        ip = adj[j];
+#pragma omp atomic read
+        hv = met->m[ip];
+        if ( hv < _MMG5_EPSD || hv >= hw )  continue;
+
+        p0 = &mesh->point[ip];
+        l = (p1->c[0]-p0->c[0])*(p1->c[0]-p0->c[0]) + (p1->c[1]-p0->c[1])*(p1->c[1]-p0->c[1])\
+          + (p1->c[2]-p0->c[2])*(p1->c[2]-p0->c[2]);
+        l = sqrt(l);
+        hn = hv + mesh->info.hgrad*l;
+        if ( hn < hw )  hw = hn;
+      }
+      if ( hw < met->m[k] ) {
+#pragma omp atomic write
+        met->m[k] = hw;
+        p1->flag = mesh->base;
+        nu++;
+        for (j=vadj[k]; j<vadj[k+1]; j++) {
+#pragma omp atomic write
+          dirty[adj[j]] = 1;
+        }
+      }
+    }
+    nup += nu;
+  }
+  while ( nu > 0 );
+
+  _MMG5_DEL_MEM(mesh,dirty,(np+1)*sizeof(int));
+  _MMG5_DEL_MEM(mesh,adj,MG_MAX(1,vadj[np+1])*sizeof(MMG5_int));
+  _MMG5_DEL_MEM(mesh,vadj,(np+2)*sizeof(MMG5_int));
+
+  if ( abs(mesh->info.imprim) > 4 )
+    fprintf(stdout,"     gradation: %7" MMG5_PRId " updated, %" MMG5_PRId " iter.\n",nup,it);
+  return(1);
+}
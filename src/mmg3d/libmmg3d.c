@@ -63,16 +63,16 @@ double (*MMG3D_lenedgCoor)(double *ca,double *cb,double *sa,double *sb);
 /** Free adja, xtetra and xpoint tables */
 inline
 void _MMG3D_Free_topoTables(MMG5_pMesh mesh) {
-  int k;
+  MMG5_int k;
 
   mesh->xp = 0;
   if ( mesh->adja )
-    _MMG5_DEL_MEM(mesh,mesh->adja,(4*mesh->nemax+5)*sizeof(int));
+    _MMG5_DEL_MEM(mesh,mesh->adja,(4*mesh->nemax+5)*sizeof(MMG5_int));
 
   _MMG5_freeXTets(mesh);
 
   if ( mesh->adjapr )
-    _MMG5_DEL_MEM(mesh,mesh->adjapr,(5*mesh->nprism+6)*sizeof(int));
+    _MMG5_DEL_MEM(mesh,mesh->adjapr,(5*mesh->nprism+6)*sizeof(MMG5_int));
 
   _MMG5_freeXPrisms(mesh);
 
@@ -98,7 +98,8 @@ void _MMG3D_solTruncatureForOptim(MMG5_pMesh mesh, MMG5_pSol met) {
   MMG5_pTetra pt;
   MMG5_pPoint ppt;
   double      isqhmin, isqhmax;
-  int         i,k,iadr,sethmin,sethmax;
+  int         i,sethmin,sethmax;
+  MMG5_int    k,iadr;
 
   assert ( mesh->info.optim || mesh->info.hsiz > 0. );
 
@@ -223,7 +224,8 @@ void _MMG3D_solTruncatureForOptim(MMG5_pMesh mesh, MMG5_pSol met) {
 int _MMG3D_bdryBuild(MMG5_pMesh mesh) {
   MMG5_pTetra pt;
   MMG5_hgeom  *ph;
-  int         k,i,nr;
+  int         i,nr;
+  MMG5_int    k;
 
 
   /* rebuild triangles*/
@@ -290,9 +292,9 @@ int _MMG3D_bdryBuild(MMG5_pMesh mesh) {
 
   if ( mesh->info.imprim > 0 ) {
     if ( mesh->na )
-      fprintf(stdout,"     NUMBER OF EDGES      %8d   RIDGES  %8d\n",mesh->na,nr);
+      fprintf(stdout,"     NUMBER OF EDGES      %8" MMG5_PRId "   RIDGES  %8d\n",mesh->na,nr);
     if ( mesh->nt )
-      fprintf(stdout,"     NUMBER OF TRIANGLES  %8d\n",mesh->nt);
+      fprintf(stdout,"     NUMBER OF TRIANGLES  %8" MMG5_PRId "\n",mesh->nt);
   }
 
   return nr;
@@ -314,8 +316,10 @@ int _MMG3D_packMesh(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pSol disp) {
   MMG5_pPrism   pp;
   MMG5_pQuad    pq;
   MMG5_pPoint   ppt,pptnew;
-  int     np,nc,nr, k,ne,nbl,imet,imetnew,i;
-  int     iadr,iadrnew,iadrv,*adjav,*adja,*adjanew,voy;
+  int     np,nc,nr,ne,nbl,imetnew,i;
+  MMG5_int k,imet;
+  int     iadrnew,voy;
+  MMG5_int iadr,*adjav,*adja,*adjanew,iadrv;
 
   /* compact vertices */
   if ( !mesh->point ) {
@@ -489,8 +493,8 @@ int _MMG3D_packMesh(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pSol disp) {
   }
 
   if ( mesh->info.imprim > 0 ) {
-    fprintf(stdout,"     NUMBER OF VERTICES   %8d   CORNERS %8d\n",mesh->np,nc);
-    fprintf(stdout,"     NUMBER OF TETRAHEDRA %8d\n",mesh->ne);
+    fprintf(stdout,"     NUMBER OF VERTICES   %8" MMG5_PRId "   CORNERS %8d\n",mesh->np,nc);
+    fprintf(stdout,"     NUMBER OF TETRAHEDRA %8" MMG5_PRId "\n",mesh->ne);
   }
 
   nr = _MMG3D_bdryBuild(mesh);
@@ -508,7 +512,7 @@ int _MMG3D_packMesh(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pSol disp) {
     mesh->tetra[k].v[3] = k+1;
 
   /* to could save the mesh, the adjacency have to be correct */
-  if ( mesh->info.ddebug && (!_MMG5_chkmsh(mesh,1,1) ) ) {
+  if ( mesh->info.ddebug && (!mesh->func.chkmsh(mesh,1,1) ) ) {
     fprintf(stderr,"\n  ##  Warning: %s: invalid mesh.\n",__func__);
     return(0);
   }
@@ -524,7 +528,7 @@ int MMG3D_mmg3dlib(MMG5_pMesh mesh,MMG5_pSol met) {
     fprintf(stdout,"\n  %s\n   MODULE MMG3D: %s (%s)\n  %s\n",MG_STR,MG_VER,MG_REL,MG_STR);
   }
 
-  _MMG3D_Set_commonFunc();
+  _MMG3D_Set_commonFunc(mesh);
 
 
   _MMG5_warnOrientation(mesh);
@@ -727,7 +731,7 @@ int MMG3D_mmg3dls(MMG5_pMesh mesh,MMG5_pSol met) {
     fprintf(stdout,"\n  %s\n   MODULE MMG3D: %s (%s)\n  %s\n",MG_STR,MG_VER,MG_REL,MG_STR);
   }
 
-  _MMG3D_Set_commonFunc();
+  _MMG3D_Set_commonFunc(mesh);
 
   signal(SIGABRT,_MMG5_excfun);
   signal(SIGFPE,_MMG5_excfun);
@@ -903,7 +907,7 @@ int MMG3D_mmg3dmov(MMG5_pMesh mesh,MMG5_pSol met, MMG5_pSol disp) {
     fprintf(stdout,"\n  %s\n   MODULE MMG3D: %s (%s)\n  %s\n",MG_STR,MG_VER,MG_REL,MG_STR);
   }
 
-  _MMG3D_Set_commonFunc();
+  _MMG3D_Set_commonFunc(mesh);
 
   signal(SIGABRT,_MMG5_excfun);
   signal(SIGFPE,_MMG5_excfun);
@@ -81,7 +81,7 @@ enum MMG3D_Param {
   MMG3D_IPARAM_nomove,            /*!< [1/0], Avoid/allow point relocation */
   MMG3D_IPARAM_nosurf,            /*!< [1/0], Avoid/allow surface modifications */
   MMG3D_IPARAM_numberOfLocalParam,/*!< [n], Number of local parameters */
-  MMG3D_IPARAM_renum,             /*!< [1/0], Turn on/off point relocation with Scotch */
+  MMG3D_IPARAM_renum,             /*!< [2/1/0], Turn on/off renumbering (1: with Scotch, 2: along a Hilbert curve) */
   MMG3D_IPARAM_anisosize,         /*!< [1/0], Turn on/off anisotropic metric creation when no metric is provided */
   MMG3D_IPARAM_octree,            /*!< [n], Specify the max number of points per octree cell (DELAUNAY) */
   MMG3D_DPARAM_angleDetection,    /*!< [val], Value for angle detection */
@@ -91,6 +91,7 @@ enum MMG3D_Param {
   MMG3D_DPARAM_hausd,             /*!< [val], Control global Hausdorff distance (on all the boundary surfaces of the mesh) */
   MMG3D_DPARAM_hgrad,             /*!< [val], Control gradation */
   MMG3D_DPARAM_ls,                /*!< [val], Value of level-set */
+  MMG3D_IPARAM_nthreads,          /*!< [n], Number of threads used for the parallel point insertion (DELAUNAY) and adjacency */
   MMG3D_PARAM_size,               /*!< [n], Number of parameters */
 };
 
@@ -243,13 +244,14 @@ int  MMG3D_Set_outputSolName(MMG5_pMesh mesh,MMG5_pSol sol,
  * \remark Fortran interface:
  * >   SUBROUTINE MMG3D_SET_SOLSIZE(mesh,sol,typEntity,np,typSol,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh,sol\n
- * >     INTEGER, INTENT(IN)           :: typEntity,np,typSol\n
+ * >     INTEGER, INTENT(IN)           :: typEntity,typSol\n
+ * >     MMG5F_INT, INTENT(IN)         :: np\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
 int  MMG3D_Set_solSize(MMG5_pMesh mesh, MMG5_pSol sol, int typEntity,
-                       int np, int typSol);
+                       MMG5_int np, int typSol);
 /**
  * \param mesh pointer toward the mesh structure.
  * \param np number of vertices.
@@ -267,13 +269,13 @@ int  MMG3D_Set_solSize(MMG5_pMesh mesh, MMG5_pSol sol, int typEntity,
  * \remark Fortran interface:
  * >   SUBROUTINE MMG3D_SET_MESHSIZE(mesh,np,ne,nprism,nt,nquad,na,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
- * >     INTEGER                       :: np,ne,nprism,nt,nquad,na\n
+ * >     MMG5F_INT                     :: np,ne,nprism,nt,nquad,na\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
-int  MMG3D_Set_meshSize(MMG5_pMesh mesh,int np,int ne,int nprism,
-                        int nt,int nquad,int na);
+int  MMG3D_Set_meshSize(MMG5_pMesh mesh,MMG5_int np,MMG5_int ne,MMG5_int nprism,
+                        MMG5_int nt,MMG5_int nquad,MMG5_int na);
 
 /* init structure datas */
 /**
@@ -292,13 +294,14 @@ int  MMG3D_Set_meshSize(MMG5_pMesh mesh,int np,int ne,int nprism,
  * >   SUBROUTINE MMG3D_SET_VERTEX(mesh,c0,c1,c2,ref,pos,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
  * >     REAL(KIND=8), INTENT(IN)      :: c0,c1,c2\n
- * >     INTEGER, INTENT(IN)           :: ref,pos\n
+ * >     INTEGER, INTENT(IN)           :: ref\n
+ * >     MMG5F_INT, INTENT(IN)         :: pos\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
 int  MMG3D_Set_vertex(MMG5_pMesh mesh, double c0, double c1,
-                     double c2, int ref,int pos);
+                     double c2, int ref,MMG5_int pos);
 /**
  * \param mesh pointer toward the mesh structure.
  * \param vertices table of the points coor.
@@ -322,6 +325,25 @@ int  MMG3D_Set_vertex(MMG5_pMesh mesh, double c0, double c1,
  *
  */
  int  MMG3D_Set_vertices(MMG5_pMesh mesh, double *vertices,int *refs);
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param vertices table of the points coor, allocated with malloc.
+ * The coordinates of the \f$i^{th}\f$ point are stored in
+ * vertices[(i-1)*3]\@3.
+ * \param refs table of points references (may be NULL).
+ * The ref of the \f$i^th\f$ point is stored in refs[i-1].
+ * \return 0 if failed, 1 otherwise.
+ *
+ * Set vertices coordinates and references in mesh structure without copying
+ * the coordinates in a second array: the mesh takes the ownership of the
+ * \a vertices array (even if the function fails), that is resized and reused
+ * as the array of the mesh points. The caller keeps the \a refs array. Must be
+ * called after the \a MMG3D_Set_meshSize function.
+ *
+ * \remark No fortran interface: the array must be allocated by the C library.
+ *
+ */
+int  MMG3D_Adopt_vertices(MMG5_pMesh mesh, double *vertices,int *refs);
 /**
  * \param mesh pointer toward the mesh structure.
  * \param v0 first vertex of tetrahedron.
@@ -338,13 +360,14 @@ int  MMG3D_Set_vertex(MMG5_pMesh mesh, double c0, double c1,
  * \remark Fortran interface:
  * >   SUBROUTINE MMG3D_SET_TETRAHEDRON(mesh,v0,v1,v2,v3,ref,pos,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
- * >     INTEGER, INTENT(IN)           :: v0,v1,v2,v3,ref,pos\n
+ * >     INTEGER, INTENT(IN)           :: ref\n
+ * >     MMG5F_INT, INTENT(IN)         :: v0,v1,v2,v3,pos\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
-int  MMG3D_Set_tetrahedron(MMG5_pMesh mesh, int v0, int v1,
-                          int v2, int v3, int ref, int pos);
+int  MMG3D_Set_tetrahedron(MMG5_pMesh mesh, MMG5_int v0, MMG5_int v1,
+                          MMG5_int v2, MMG5_int v3, int ref, MMG5_int pos);
 /**
  * \param mesh pointer toward the mesh structure.
  * \param tetra vertices of the tetras of the mesh
@@ -360,13 +383,32 @@ int  MMG3D_Set_tetrahedron(MMG5_pMesh mesh, int v0, int v1,
  *
  * > !  SUBROUTINE MMG3D_SET_TETRAHEDRA(mesh,tetra,refs,retval)\n
  * > !    MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
- * > !    INTEGER, DIMENSION(*), INTENT(IN) :: tetra,refs\n
+ * > !    INTEGER, DIMENSION(*), INTENT(IN) :: refs\n
+ * > !    MMG5F_INT, DIMENSION(*), INTENT(IN) :: tetra\n
  * > !    INTEGER, INTENT(OUT)          :: retval\n
  * > !  END SUBROUTINE\n
  *
  */
-  int  MMG3D_Set_tetrahedra(MMG5_pMesh mesh, int *tetra,
+  int  MMG3D_Set_tetrahedra(MMG5_pMesh mesh, MMG5_int *tetra,
                             int *refs);
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param tetra vertices of the tetras of the mesh, allocated with malloc.
+ * Vertices of the \f$i^{th}\f$ tetra are stored in tetra[(i-1)*4]\@4.
+ * \param refs table of the tetrahedra references (may be NULL).
+ * References of the \f$i^{th}\f$ tetra is stored in refs[i-1].
+ * \return 0 if failed, 1 otherwise.
+ *
+ * Set vertices and references of the mesh tetrahedra without copying the
+ * vertices in a second array: the mesh takes the ownership of the \a tetra
+ * array (even if the function fails), that is resized and reused as the array
+ * of the mesh tetrahedra. The caller keeps the \a refs array. Must be called
+ * after the setting of the vertices.
+ *
+ * \remark No fortran interface: the array must be allocated by the C library.
+ *
+ */
+int  MMG3D_Adopt_tetrahedra(MMG5_pMesh mesh, MMG5_int *tetra, int *refs);
 /**
  * \param mesh pointer toward the mesh structure.
  * \param v0 first vertex of prism.
@@ -385,13 +427,14 @@ int  MMG3D_Set_tetrahedron(MMG5_pMesh mesh, int v0, int v1,
  * \remark Fortran interface:
  * >   SUBROUTINE MMG3D_SET_PRISM(mesh,v0,v1,v2,v3,v4,v5,ref,pos,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
- * >     INTEGER, INTENT(IN)           :: v0,v1,v2,v3,v4,v5,ref,pos\n
+ * >     INTEGER, INTENT(IN)           :: ref\n
+ * >     MMG5F_INT, INTENT(IN)         :: v0,v1,v2,v3,v4,v5,pos\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
-int  MMG3D_Set_prism(MMG5_pMesh mesh, int v0, int v1,
-                     int v2, int v3, int v4, int v5, int ref, int pos);
+int  MMG3D_Set_prism(MMG5_pMesh mesh, MMG5_int v0, MMG5_int v1,
+                     MMG5_int v2, MMG5_int v3, MMG5_int v4, MMG5_int v5, int ref, MMG5_int pos);
 /**
  * \param mesh pointer toward the mesh structure.
  * \param prisms vertices of the prisms of the mesh
@@ -407,12 +450,13 @@ int  MMG3D_Set_prism(MMG5_pMesh mesh, int v0, int v1,
  *
  * > !  SUBROUTINE MMG3D_SET_PRISMS(mesh,prisms,refs,retval)\n
  * > !    MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
- * > !    INTEGER, DIMENSION(*), INTENT(IN) :: prisms,refs\n
+ * > !    INTEGER, DIMENSION(*), INTENT(IN) :: refs\n
+ * > !    MMG5F_INT, DIMENSION(*), INTENT(IN) :: prisms\n
  * > !    INTEGER, INTENT(OUT)          :: retval\n
  * > !  END SUBROUTINE\n
  *
  */
-  int  MMG3D_Set_prisms(MMG5_pMesh mesh, int *prisms,
+  int  MMG3D_Set_prisms(MMG5_pMesh mesh, MMG5_int *prisms,
                         int *refs);
 
 /**
@@ -430,13 +474,14 @@ int  MMG3D_Set_prism(MMG5_pMesh mesh, int v0, int v1,
  * \remark Fortran interface:
  * >   SUBROUTINE MMG3D_SET_TRIANGLE(mesh,v0,v1,v2,ref,pos,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
- * >     INTEGER, INTENT(IN)           :: v0,v1,v2,ref,pos\n
+ * >     INTEGER, INTENT(IN)           :: ref\n
+ * >     MMG5F_INT, INTENT(IN)         :: v0,v1,v2,pos\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
-int  MMG3D_Set_triangle(MMG5_pMesh mesh, int v0, int v1,
-                       int v2, int ref,int pos);
+int  MMG3D_Set_triangle(MMG5_pMesh mesh, MMG5_int v0, MMG5_int v1,
+                       MMG5_int v2, int ref,MMG5_int pos);
 /**
  * \param mesh pointer toward the mesh structure.
  * \param tria pointer toward the table of the tria vertices
@@ -452,12 +497,13 @@ int  MMG3D_Set_triangle(MMG5_pMesh mesh, int v0, int v1,
  *
  * > !  SUBROUTINE MMG3D_SET_TRIANGLES(mesh,tria,refs,retval)\n
  * > !    MMG5_DATA_PTR_T,INTENT(INOUT)    :: mesh\n
- * > !    INTEGER,DIMENSION(*), INTENT(IN) :: tria,refs\n
+ * > !    INTEGER,DIMENSION(*), INTENT(IN) :: refs\n
+ * > !    MMG5F_INT,DIMENSION(*), INTENT(IN) :: tria\n
  * > !    INTEGER, INTENT(OUT)             :: retval\n
  * > !  END SUBROUTINE\n
  *
  */
-  int  MMG3D_Set_triangles(MMG5_pMesh mesh, int *tria, int *refs);
+  int  MMG3D_Set_triangles(MMG5_pMesh mesh, MMG5_int *tria, int *refs);
 /**
  * \param mesh pointer toward the mesh structure.
  * \param v0 first vertex of quadrilateral.
@@ -474,13 +520,14 @@ int  MMG3D_Set_triangle(MMG5_pMesh mesh, int v0, int v1,
  * \remark Fortran interface:
  * >   SUBROUTINE MMG3D_SET_QUADRILATERAL(mesh,v0,v1,v2,v3,ref,pos,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
- * >     INTEGER, INTENT(IN)           :: v0,v1,v2,v3,ref,pos\n
+ * >     INTEGER, INTENT(IN)           :: ref\n
+ * >     MMG5F_INT, INTENT(IN)         :: v0,v1,v2,v3,pos\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
-int  MMG3D_Set_quadrilateral(MMG5_pMesh mesh, int v0, int v1,
-                          int v2, int v3, int ref,int pos);
+int  MMG3D_Set_quadrilateral(MMG5_pMesh mesh, MMG5_int v0, MMG5_int v1,
+                          MMG5_int v2, MMG5_int v3, int ref,MMG5_int pos);
 /**
  * \param mesh pointer toward the mesh structure.
  * \param quads pointer toward the table of the quads vertices
@@ -496,12 +543,13 @@ int  MMG3D_Set_quadrilateral(MMG5_pMesh mesh, int v0, int v1,
  *
  * > !  SUBROUTINE MMG3D_SET_QUADRILATERALS(mesh,quads,refs,retval)\n
  * > !    MMG5_DATA_PTR_T,INTENT(INOUT)    :: mesh\n
- * > !    INTEGER,DIMENSION(*), INTENT(IN) :: quads,refs\n
+ * > !    INTEGER,DIMENSION(*), INTENT(IN) :: refs\n
+ * > !    MMG5F_INT,DIMENSION(*), INTENT(IN) :: quads\n
  * > !    INTEGER, INTENT(OUT)             :: retval\n
  * > !  END SUBROUTINE\n
  *
  */
-  int  MMG3D_Set_quadrilaterals(MMG5_pMesh mesh, int *quads, int *refs);
+  int  MMG3D_Set_quadrilaterals(MMG5_pMesh mesh, MMG5_int *quads, int *refs);
 /**
  * \param mesh pointer toward the mesh structure.
  * \param v0 first extremity of the edge.
@@ -516,12 +564,13 @@ int  MMG3D_Set_quadrilateral(MMG5_pMesh mesh, int v0, int v1,
  * \remark Fortran interface:
  * >   SUBROUTINE MMG3D_SET_EDGE(mesh,v0,v1,ref,pos,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
- * >     INTEGER, INTENT(IN)           :: v0,v1,ref,pos\n
+ * >     INTEGER, INTENT(IN)           :: ref\n
+ * >     MMG5F_INT, INTENT(IN)         :: v0,v1,pos\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
-int  MMG3D_Set_edge(MMG5_pMesh mesh, int v0, int v1, int ref,int pos);
+int  MMG3D_Set_edge(MMG5_pMesh mesh, MMG5_int v0, MMG5_int v1, int ref,MMG5_int pos);
 /**
  * \param mesh pointer toward the mesh structure.
  * \param k vertex index.
@@ -532,12 +581,12 @@ int  MMG3D_Set_edge(MMG5_pMesh mesh, int v0, int v1, int ref,int pos);
  * \remark Fortran interface:
  * >   SUBROUTINE MMG3D_SET_CORNER(mesh,k,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
- * >     INTEGER, INTENT(IN)           :: k\n
+ * >     MMG5F_INT, INTENT(IN)         :: k\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
-int  MMG3D_Set_corner(MMG5_pMesh mesh, int k);
+int  MMG3D_Set_corner(MMG5_pMesh mesh, MMG5_int k);
 /**
  * \param mesh pointer toward the mesh structure.
  * \param k vertex index.
@@ -548,12 +597,12 @@ int  MMG3D_Set_corner(MMG5_pMesh mesh, int k);
  * \remark Fortran interface:
  * >   SUBROUTINE MMG3D_SET_REQUIREDVERTEX(mesh,k,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
- * >     INTEGER, INTENT(IN)           :: k\n
+ * >     MMG5F_INT, INTENT(IN)         :: k\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
-int  MMG3D_Set_requiredVertex(MMG5_pMesh mesh, int k);
+int  MMG3D_Set_requiredVertex(MMG5_pMesh mesh, MMG5_int k);
 /**
  * \param mesh pointer toward the mesh structure.
  * \param k element index.
@@ -564,12 +613,12 @@ int  MMG3D_Set_requiredVertex(MMG5_pMesh mesh, int k);
  * \remark Fortran interface:
  * >   SUBROUTINE MMG3D_SET_REQUIREDTETRAHEDRON(mesh,k,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
- * >     INTEGER, INTENT(IN)           :: k\n
+ * >     MMG5F_INT, INTENT(IN)         :: k\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
-int  MMG3D_Set_requiredTetrahedron(MMG5_pMesh mesh, int k);
+int  MMG3D_Set_requiredTetrahedron(MMG5_pMesh mesh, MMG5_int k);
 /**
  * \param mesh pointer toward the mesh structure.
  * \param reqIdx table of the indices of the required elements.
@@ -581,13 +630,13 @@ int  MMG3D_Set_requiredTetrahedron(MMG5_pMesh mesh, int k);
  * \remark Fortran interface:
  * >   SUBROUTINE MMG3D_SET_REQUIREDTETRAHEDRA(mesh,reqIdx,nreq,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
- * >     INTEGER, DIMENSION(*),INTENT(IN) :: reqIdx\n
- * >     INTEGER, INTENT(IN)           :: nreq\n
+ * >     MMG5F_INT, DIMENSION(*),INTENT(IN) :: reqIdx\n
+ * >     MMG5F_INT, INTENT(IN)         :: nreq\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
-  int  MMG3D_Set_requiredTetrahedra(MMG5_pMesh mesh, int *reqIdx, int nreq);
+  int  MMG3D_Set_requiredTetrahedra(MMG5_pMesh mesh, MMG5_int *reqIdx, MMG5_int nreq);
 /**
  * \param mesh pointer toward the mesh structure.
  * \param k triangle index.
@@ -598,12 +647,12 @@ int  MMG3D_Set_requiredTetrahedron(MMG5_pMesh mesh, int k);
  * \remark Fortran interface:
  * >   SUBROUTINE MMG3D_SET_REQUIREDTRIANGLE(mesh,k,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
- * >     INTEGER, INTENT(IN)           :: k\n
+ * >     MMG5F_INT, INTENT(IN)         :: k\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
-int  MMG3D_Set_requiredTriangle(MMG5_pMesh mesh, int k);
+int  MMG3D_Set_requiredTriangle(MMG5_pMesh mesh, MMG5_int k);
 /**
  * \param mesh pointer toward the mesh structure.
  * \param reqIdx table of the indices of the required trias.
@@ -615,13 +664,13 @@ int  MMG3D_Set_requiredTriangle(MMG5_pMesh mesh, int k);
  * \remark Fortran interface:
  * >   SUBROUTINE MMG3D_SET_REQUIREDTRIANGLES(mesh,reqIdx,nreq,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
- * >     INTEGER, DIMENSION(*),INTENT(IN) :: reqIdx\n
- * >     INTEGER, INTENT(IN)           :: nreq\n
+ * >     MMG5F_INT, DIMENSION(*),INTENT(IN) :: reqIdx\n
+ * >     MMG5F_INT, INTENT(IN)         :: nreq\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
-  int  MMG3D_Set_requiredTriangles(MMG5_pMesh mesh, int *reqIdx, int nreq);
+  int  MMG3D_Set_requiredTriangles(MMG5_pMesh mesh, MMG5_int *reqIdx, MMG5_int nreq);
 
 /**
  * \param mesh pointer toward the mesh structure.
@@ -634,12 +683,12 @@ int  MMG3D_Set_requiredTriangle(MMG5_pMesh mesh, int k);
  * \remark Fortran interface:
  * >   SUBROUTINE MMG3D_SET_PARALLELTRIANGLE(mesh,k,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
- * >     INTEGER, INTENT(IN)           :: k\n
+ * >     MMG5F_INT, INTENT(IN)         :: k\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
-int  MMG3D_Set_parallelTriangle(MMG5_pMesh mesh, int k);
+int  MMG3D_Set_parallelTriangle(MMG5_pMesh mesh, MMG5_int k);
 /**
  * \param mesh pointer toward the mesh structure.
  * \param parIdx table of the indices of the parallel trias.
@@ -652,13 +701,13 @@ int  MMG3D_Set_parallelTriangle(MMG5_pMesh mesh, int k);
  * \remark Fortran interface:
  * >   SUBROUTINE MMG3D_SET_PARALLELTRIANGLES(mesh,parIdx,npar,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
- * >     INTEGER, DIMENSION(*),INTENT(IN) :: parIdx\n
- * >     INTEGER, INTENT(IN)           :: npar\n
+ * >     MMG5F_INT, DIMENSION(*),INTENT(IN) :: parIdx\n
+ * >     MMG5F_INT, INTENT(IN)         :: npar\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
- int  MMG3D_Set_parallelTriangles(MMG5_pMesh mesh, int *parIdx, int npar);
+ int  MMG3D_Set_parallelTriangles(MMG5_pMesh mesh, MMG5_int *parIdx, MMG5_int npar);
 
 /**
  * \param mesh pointer toward the mesh structure.
@@ -670,12 +719,12 @@ int  MMG3D_Set_parallelTriangle(MMG5_pMesh mesh, int k);
  * \remark Fortran interface:
  * >   SUBROUTINE MMG3D_SET_RIDGE(mesh,k,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
- * >     INTEGER, INTENT(IN)           :: k\n
+ * >     MMG5F_INT, INTENT(IN)         :: k\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
-int  MMG3D_Set_ridge(MMG5_pMesh mesh, int k);
+int  MMG3D_Set_ridge(MMG5_pMesh mesh, MMG5_int k);
 /**
  * \param mesh pointer toward the mesh structure.
  * \param k edge index.
@@ -686,12 +735,12 @@ int  MMG3D_Set_ridge(MMG5_pMesh mesh, int k);
  * \remark Fortran interface:
  * >   SUBROUTINE MMG3D_SET_REQUIREDEDGE(mesh,k,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
- * >     INTEGER, INTENT(IN)           :: k\n
+ * >     MMG5F_INT, INTENT(IN)         :: k\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
-int  MMG3D_Set_requiredEdge(MMG5_pMesh mesh, int k);
+int  MMG3D_Set_requiredEdge(MMG5_pMesh mesh, MMG5_int k);
 /**
  * \param mesh pointer toward the mesh structure.
  * \param k point index
@@ -706,13 +755,13 @@ int  MMG3D_Set_requiredEdge(MMG5_pMesh mesh, int k);
  * \remark Fortran interface:
  * >   SUBROUTINE MMG3D_SET_NORMALATVERTEX(mesh,k,n0,n1,n2,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
- * >     INTEGER, INTENT(IN)           :: k\n
+ * >     MMG5F_INT, INTENT(IN)         :: k\n
  * >     REAL(KIND=8), INTENT(IN)      :: n0,n1,n2\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
-int  MMG3D_Set_normalAtVertex(MMG5_pMesh mesh, int k, double n0, double n1,
+int  MMG3D_Set_normalAtVertex(MMG5_pMesh mesh, MMG5_int k, double n0, double n1,
                               double n2) ;
 
 /**
@@ -727,12 +776,12 @@ int  MMG3D_Set_normalAtVertex(MMG5_pMesh mesh, int k, double n0, double n1,
  * >   SUBROUTINE MMG3D_SET_SCALARSOL(met,s,pos,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: met\n
  * >     REAL(KIND=8), INTENT(IN)      :: s\n
- * >     INTEGER, INTENT(IN)           :: pos\n
+ * >     MMG5F_INT, INTENT(IN)         :: pos\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
-int  MMG3D_Set_scalarSol(MMG5_pSol met, double s,int pos);
+int  MMG3D_Set_scalarSol(MMG5_pSol met, double s,MMG5_int pos);
 /**
  * \param met pointer toward the sol structure.
  * \param s table of the scalar solutions values.
@@ -765,13 +814,13 @@ int  MMG3D_Set_scalarSols(MMG5_pSol met, double *s);
  * >   SUBROUTINE MMG3D_SET_VECTORSOL(met,vx,vy,vz,pos,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: met\n
  * >     REAL(KIND=8), INTENT(IN)      :: vx,vy,vz\n
- * >     INTEGER, INTENT(IN)           :: pos\n
+ * >     MMG5F_INT, INTENT(IN)         :: pos\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
 int MMG3D_Set_vectorSol(MMG5_pSol met, double vx,double vy, double vz,
-                        int pos);
+                        MMG5_int pos);
 /**
  * \param met pointer toward the sol structure.
  * \param sols table of the vectorial solutions
@@ -807,13 +856,13 @@ int MMG3D_Set_vectorSols(MMG5_pSol met, double *sols);
  * >   SUBROUTINE MMG3D_SET_TENSORSOL(met,m11,m12,m13,m22,m23,m33,pos,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: met\n
  * >     REAL(KIND=8), INTENT(IN)      :: m11,m12,m13,m22,m23,m33\n
- * >     INTEGER, INTENT(IN)           :: pos\n
+ * >     MMG5F_INT, INTENT(IN)         :: pos\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
 int MMG3D_Set_tensorSol(MMG5_pSol met, double m11,double m12, double m13,
-                       double m22,double m23, double m33, int pos);
+                       double m22,double m23, double m33, MMG5_int pos);
 /**
  * \param met pointer toward the sol structure.
  * \param sols table of the tensorial solutions.
@@ -947,13 +996,13 @@ int  MMG3D_Set_localParameter(MMG5_pMesh mesh, MMG5_pSol sol, int typ,
  * \remark Fortran interface:
  * >   SUBROUTINE MMG3D_GET_MESHSIZE(mesh,np,ne,nprism,nt,nquad,na,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
- * >     INTEGER                       :: np,ne,nprism,nt,nquad,na\n
+ * >     MMG5F_INT                     :: np,ne,nprism,nt,nquad,na\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
-int  MMG3D_Get_meshSize(MMG5_pMesh mesh, int* np, int* ne,int *nprism, int* nt,
-                        int* nquad, int* na);
+int  MMG3D_Get_meshSize(MMG5_pMesh mesh, MMG5_int* np, MMG5_int* ne,MMG5_int *nprism, MMG5_int* nt,
+                        MMG5_int* nquad, MMG5_int* na);
 /**
  * \param mesh pointer toward the mesh structure.
  * \param sol pointer toward the sol structure.
@@ -969,13 +1018,14 @@ int  MMG3D_Get_meshSize(MMG5_pMesh mesh, int* np, int* ne,int *nprism, int* nt,
  * \remark Fortran interface:
  * >   SUBROUTINE MMG3D_GET_SOLSIZE(mesh,sol,typEntity,np,typSol,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh,sol\n
- * >     INTEGER                       :: typEntity,np,typSol\n
+ * >     INTEGER                       :: typEntity,typSol\n
+ * >     MMG5F_INT                     :: np\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
 int  MMG3D_Get_solSize(MMG5_pMesh mesh, MMG5_pSol sol, int* typEntity,
-                       int* np,int* typSol);
+                       MMG5_int* np,int* typSol);
 /**
  * \param mesh pointer toward the mesh structure.
  * \param c0 pointer toward the coordinate of the point along the first
@@ -1035,6 +1085,32 @@ int  MMG3D_Get_vertex(MMG5_pMesh mesh, double* c0, double* c1, double* c2,
  */
 int  MMG3D_Get_vertices(MMG5_pMesh mesh, double* vertices, int* refs,
                         int* areCorners, int* areRequired);
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param vertices pointer toward the table of the points coordinates, filled
+ * with an array allocated with malloc (to free by the caller).
+ * The coordinates of the \f$i^{th}\f$ point are stored in
+ * vertices[(i-1)*3]\@3.
+ * \param refs pointer toward the table of the point references (may be NULL).
+ * The ref of the \f$i^th\f$ point is stored in refs[i-1].
+ * \param areCorners pointer toward the table of the flags saying if
+ * points are corners (may be NULL).
+ * areCorners[i-1]=1 if the \f$i^{th}\f$ point is corner.
+ * \param areRequired pointer toward the table of flags saying if points
+ * are required (may be NULL).
+ * areRequired[i-1]=1 if the \f$i^{th}\f$ point is required.
+ * \return 0 if failed, 1 otherwise.
+ *
+ * Get the vertices coordinates, references and flags of a packed mesh without
+ * copying the coordinates in a second array: the array of the mesh points is
+ * packed in place and given to the caller. The mesh has no more points: it can
+ * only be released (the other entities may still be got).
+ *
+ * \remark No fortran interface: the array is allocated by the C library.
+ *
+ */
+int  MMG3D_Release_vertices(MMG5_pMesh mesh, double **vertices, int *refs,
+                            int *areCorners, int *areRequired);
 /**
  * \param mesh pointer toward the mesh structure.
  * \param v0 pointer toward the first vertex of tetrahedron.
@@ -1053,14 +1129,14 @@ int  MMG3D_Get_vertices(MMG5_pMesh mesh, double* vertices, int* refs,
  * >   SUBROUTINE MMG3D_GET_TETRAHEDRON(mesh,v0,v1,v2,v3,ref,isRequired,&\n
  * >                                    retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
- * >     INTEGER, INTENT(OUT)          :: v0,v1,v2,v3\n
+ * >     MMG5F_INT, INTENT(OUT)        :: v0,v1,v2,v3\n
  * >     INTEGER                       :: ref,isRequired\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
-int  MMG3D_Get_tetrahedron(MMG5_pMesh mesh, int* v0, int* v1, int* v2,
-                           int* v3,int* ref, int* isRequired);
+int  MMG3D_Get_tetrahedron(MMG5_pMesh mesh, MMG5_int* v0, MMG5_int* v1, MMG5_int* v2,
+                           MMG5_int* v3,int* ref, int* isRequired);
 /**
  * \param mesh pointer toward the mesh structure.
  * \param tetra pointer toward the table of the tetrahedra vertices.
@@ -1080,14 +1156,37 @@ int  MMG3D_Get_tetrahedron(MMG5_pMesh mesh, int* v0, int* v1, int* v2,
  * > !  SUBROUTINE MMG3D_GET_TETRAHEDRA(mesh,tetra,refs,areRequired,&\n
  * > !                                   retval)\n
  * > !    MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
- * > !    INTEGER, DIMENSION(*),INTENT(OUT) :: tetra\n
+ * > !    MMG5F_INT, DIMENSION(*),INTENT(OUT) :: tetra\n
  * > !    INTEGER, DIMENSION(*)         :: refs,areRequired\n
  * > !    INTEGER, INTENT(OUT)          :: retval\n
  * > !  END SUBROUTINE\n
  *
  */
-int  MMG3D_Get_tetrahedra(MMG5_pMesh mesh, int* tetra,int* refs,
+int  MMG3D_Get_tetrahedra(MMG5_pMesh mesh, MMG5_int* tetra,int* refs,
                           int* areRequired);
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param tetra pointer toward the table of the tetrahedra vertices, filled with
+ * an array allocated with malloc (to free by the caller).
+ * Vertices of the \f$i^{th}\f$ tetra are stored in tetra[(i-1)*4]\@4.
+ * \param refs pointer toward the table of the tetrahedron references (may be
+ * NULL). References of the \f$i^{th}\f$ tetra is stored in refs[i-1].
+ * \param areRequired pointer toward the table of the flags saying if the
+ * tetrahedra are required (may be NULL). areRequired[i-1]=1 if the
+ * \f$i^{th}\f$ tetra is required.
+ * \return 0 if failed, 1 otherwise.
+ *
+ * Get the vertices, references and flags of the tetrahedra of a packed mesh
+ * without copying the vertices in a second array: the array of the mesh
+ * tetrahedra is packed in place and given to the caller. The vertices are given
+ * in the order of the mesh (and of the \a MMG3D_Get_tetrahedron function). The
+ * mesh has no more tetrahedra: it can only be released.
+ *
+ * \remark No fortran interface: the array is allocated by the C library.
+ *
+ */
+int  MMG3D_Release_tetrahedra(MMG5_pMesh mesh, MMG5_int **tetra, int *refs,
+                              int *areRequired);
 /**
  * \param mesh pointer toward the mesh structure.
  * \param v0 pointer toward the first vertex of prism.
@@ -1108,14 +1207,14 @@ int  MMG3D_Get_tetrahedra(MMG5_pMesh mesh, int* tetra,int* refs,
  * >   SUBROUTINE MMG3D_GET_PRISM(mesh,v0,v1,v2,v3,v4,v5,ref,isRequired,&\n
  * >                                    retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
- * >     INTEGER, INTENT(OUT)          :: v0,v1,v2,v3,v4,v5\n
+ * >     MMG5F_INT, INTENT(OUT)        :: v0,v1,v2,v3,v4,v5\n
  * >     INTEGER                       :: ref,isRequired\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
-int  MMG3D_Get_prism(MMG5_pMesh mesh, int* v0, int* v1, int* v2,
-                     int* v3,int* v4,int* v5,int* ref, int* isRequired);
+int  MMG3D_Get_prism(MMG5_pMesh mesh, MMG5_int* v0, MMG5_int* v1, MMG5_int* v2,
+                     MMG5_int* v3,MMG5_int* v4,MMG5_int* v5,int* ref, int* isRequired);
 /**
  * \param mesh pointer toward the mesh structure.
  * \param prisms pointer toward the table of the prisms vertices.
@@ -1135,13 +1234,13 @@ int  MMG3D_Get_prism(MMG5_pMesh mesh, int* v0, int* v1, int* v2,
  * > !  SUBROUTINE MMG3D_GET_PRISMS(mesh,prisms,refs,areRequired,&\n
  * > !                              retval)\n
  * > !    MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
- * > !    INTEGER, DIMENSION(*),INTENT(OUT) :: prisms\n
+ * > !    MMG5F_INT, DIMENSION(*),INTENT(OUT) :: prisms\n
  * > !    INTEGER, DIMENSION(*)         :: refs,areRequired\n
  * > !    INTEGER, INTENT(OUT)          :: retval\n
  * > !  END SUBROUTINE\n
  *
  */
-int  MMG3D_Get_prisms(MMG5_pMesh mesh, int* prisms,int* refs,
+int  MMG3D_Get_prisms(MMG5_pMesh mesh, MMG5_int* prisms,int* refs,
                           int* areRequired);
 /**
  * \param mesh pointer toward the mesh structure.
@@ -1158,13 +1257,13 @@ int  MMG3D_Get_prisms(MMG5_pMesh mesh, int* prisms,int* refs,
  * \remark Fortran interface:
  * >   SUBROUTINE MMG3D_GET_TRIANGLE(mesh,v0,v1,v2,ref,isRequired,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
- * >     INTEGER, INTENT(OUT)          :: v0,v1,v2\n
+ * >     MMG5F_INT, INTENT(OUT)        :: v0,v1,v2\n
  * >     INTEGER                       :: ref,isRequired\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
-int  MMG3D_Get_triangle(MMG5_pMesh mesh, int* v0, int* v1, int* v2, int* ref,
+int  MMG3D_Get_triangle(MMG5_pMesh mesh, MMG5_int* v0, MMG5_int* v1, MMG5_int* v2, int* ref,
                        int* isRequired);
 /**
  * \param mesh pointer toward the mesh structure.
@@ -1184,13 +1283,13 @@ int  MMG3D_Get_triangle(MMG5_pMesh mesh, int* v0, int* v1, int* v2, int* ref,
  *
  * > !  SUBROUTINE MMG3D_GET_TRIANGLES(mesh,tria,refs,areRequired,retval)\n
  * > !    MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
- * > !    INTEGER, DIMENSION(*),INTENT(OUT) :: tria\n
+ * > !    MMG5F_INT, DIMENSION(*),INTENT(OUT) :: tria\n
  * > !    INTEGER, DIMENSION(*)         :: refs,areRequired\n
  * > !    INTEGER, INTENT(OUT)          :: retval\n
  * > !  END SUBROUTINE\n
  *
  */
-int  MMG3D_Get_triangles(MMG5_pMesh mesh, int* tria, int* refs,
+int  MMG3D_Get_triangles(MMG5_pMesh mesh, MMG5_int* tria, int* refs,
                          int* areRequired);
 /**
  * \param mesh pointer toward the mesh structure.
@@ -1208,14 +1307,14 @@ int  MMG3D_Get_triangles(MMG5_pMesh mesh, int* tria, int* refs,
  * \remark Fortran interface:
  * >   SUBROUTINE MMG3D_GET_QUADRILATERAL(mesh,v0,v1,v2,v3,ref,isRequired,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
- * >     INTEGER, INTENT(OUT)          :: v0,v1,v2,v3\n
+ * >     MMG5F_INT, INTENT(OUT)        :: v0,v1,v2,v3\n
  * >     INTEGER                       :: ref,isRequired\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
-int  MMG3D_Get_quadrilateral(MMG5_pMesh mesh, int* v0, int* v1, int* v2,int* v3,
-                          int* ref, int* isRequired);
+int  MMG3D_Get_quadrilateral(MMG5_pMesh mesh, MMG5_int* v0, MMG5_int* v1,
+                             MMG5_int* v2,MMG5_int* v3,int* ref, int* isRequired);
 /**
  * \param mesh pointer toward the mesh structure.
  * \param quads pointer toward the table of the quadrilaterals vertices
@@ -1234,13 +1333,13 @@ int  MMG3D_Get_quadrilateral(MMG5_pMesh mesh, int* v0, int* v1, int* v2,int* v3,
  *
  * > !  SUBROUTINE MMG3D_GET_QUADRILATERALS(mesh,quads,refs,areRequired,retval)\n
  * > !    MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
- * > !    INTEGER, DIMENSION(*),INTENT(OUT) :: quads\n
+ * > !    MMG5F_INT, DIMENSION(*),INTENT(OUT) :: quads\n
  * > !    INTEGER, DIMENSION(*)         :: refs,areRequired\n
  * > !    INTEGER, INTENT(OUT)          :: retval\n
  * > !  END SUBROUTINE\n
  *
  */
-int  MMG3D_Get_quadrilaterals(MMG5_pMesh mesh, int* quads, int* refs,
+int  MMG3D_Get_quadrilaterals(MMG5_pMesh mesh, MMG5_int* quads, int* refs,
                            int* areRequired);
 /**
  * \param mesh pointer toward the mesh structure.
@@ -1256,13 +1355,13 @@ int  MMG3D_Get_quadrilaterals(MMG5_pMesh mesh, int* quads, int* refs,
  * \remark Fortran interface:
  * >   SUBROUTINE MMG3D_GET_EDGE(mesh,e0,e1,ref,isRidge,isRequired,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
- * >     INTEGER, INTENT(OUT)          :: e0,e1\n
+ * >     MMG5F_INT, INTENT(OUT)        :: e0,e1\n
  * >     INTEGER                       :: ref,isRidge,isRequired\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
-int  MMG3D_Get_edge(MMG5_pMesh mesh, int* e0, int* e1, int* ref,
+int  MMG3D_Get_edge(MMG5_pMesh mesh, MMG5_int* e0, MMG5_int* e1, int* ref,
                    int* isRidge, int* isRequired);
 /**
  * \param mesh pointer toward the mesh structure.
@@ -1278,13 +1377,13 @@ int  MMG3D_Get_edge(MMG5_pMesh mesh, int* e0, int* e1, int* ref,
  * \remark Fortran interface:
  * >   SUBROUTINE MMG3D_GET_NORMALATVERTEX(mesh,k,n0,n1,n2,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: mesh\n
- * >     INTEGER, INTENT(IN)           :: k\n
+ * >     MMG5F_INT, INTENT(IN)         :: k\n
  * >     REAL(KIND=8)                  :: n0,n1,n2\n
  * >     INTEGER, INTENT(OUT)          :: retval\n
  * >   END SUBROUTINE\n
  *
  */
-int  MMG3D_Get_normalAtVertex(MMG5_pMesh mesh, int k, double *n0, double *n1,
+int  MMG3D_Get_normalAtVertex(MMG5_pMesh mesh, MMG5_int k, double *n0, double *n1,
                               double *n2) ;
 
 /**
@@ -1394,6 +1493,39 @@ int MMG3D_Get_tensorSol(MMG5_pSol met, double *m11,double *m12, double *m13,
  *
  */
 int MMG3D_Get_tensorSols(MMG5_pSol met, double *sols);
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param sol pointer toward the sol structure.
+ * \param s table of the solutions at mesh vertices, allocated with malloc.
+ * s[size*(i-1)]\@size is the solution at vertex i (size being 1, 3 or 6
+ * for a scalar, vectorial or tensorial solution).
+ * \return 0 if failed, 1 otherwise.
+ *
+ * Set the solutions at mesh vertices without copying them in a second array:
+ * the solution takes the ownership of the \a s array (even if the function
+ * fails), that is resized and reused as the array of the solution. Must be
+ * called after the \a MMG3D_Set_solSize function.
+ *
+ * \remark No fortran interface: the array must be allocated by the C library.
+ *
+ */
+int MMG3D_Adopt_sols(MMG5_pMesh mesh,MMG5_pSol sol,double *s);
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param sol pointer toward the sol structure.
+ * \param s pointer toward the table of the solutions at mesh vertices, filled
+ * with an array allocated with malloc (to free by the caller).
+ * s[size*(i-1)]\@size is the solution at vertex i.
+ * \return 0 if failed, 1 otherwise.
+ *
+ * Get the solutions at mesh vertices without copying them in a second array:
+ * the array of the solution is packed in place and given to the caller. The
+ * solution has no more values: it can only be released.
+ *
+ * \remark No fortran interface: the array is allocated by the C library.
+ *
+ */
+int MMG3D_Release_sols(MMG5_pMesh mesh,MMG5_pSol sol,double **s);
 /**
  * \param mesh pointer toward the mesh structure.
  * \param iparam integer parameter to set (see \a MMG3D_Param structure).
@@ -1946,13 +2078,13 @@ int  MMG3D_searchlen(MMG5_pMesh mesh, MMG5_pSol met, double lmin,
  * \remark Fortran interface:
  * >   SUBROUTINE MMG3D_GET_ADJATET(mesh,kel,listet,retval)\n
  * >     MMG5_DATA_PTR_T, INTENT(INOUT)     :: mesh\n
- * >     INTEGER, INTENT(IN)                :: kel\n
- * >     INTEGER, DIMENSION(4), INTENT(OUT) :: listet\n
+ * >     MMG5F_INT, INTENT(IN)              :: kel\n
+ * >     MMG5F_INT, DIMENSION(4), INTENT(OUT) :: listet\n
  * >     INTEGER, INTENT(OUT)               :: retval\n
  * >   END SUBROUTINE\n
  *
  */
-int MMG3D_Get_adjaTet(MMG5_pMesh mesh,int kel, int listet[4]);
+int MMG3D_Get_adjaTet(MMG5_pMesh mesh,MMG5_int kel, MMG5_int listet[4]);
 /**
  * \param ca pointer toward the coordinates of the first edge's extremity.
  * \param cb pointer toward the coordinates of the second edge's extremity.
@@ -2057,12 +2189,13 @@ void  MMG3D_setfunc(MMG5_pMesh mesh,MMG5_pSol met);
  * \remark Fortran interface:
  * >   SUBROUTINE MMG3D_GET_TETFROMTRIA(mesh,ktri,ktet,iface,retval)\n
  * >     MMG5_DATA_PTR_T, INTENT(IN)              :: mesh\n
- * >     INTEGER, INTENT(IN)                      :: ktri\n
- * >     INTEGER, INTENT(OUT)                     :: ktet,iface,retval\n
+ * >     MMG5F_INT, INTENT(IN)                    :: ktri\n
+ * >     INTEGER, INTENT(OUT)                     :: iface,retval\n
+ * >     MMG5F_INT, INTENT(OUT)                   :: ktet\n
  * >   END SUBROUTINE\n
  *
  */
-int MMG3D_Get_tetFromTria(MMG5_pMesh mesh, int ktri, int *ktet, int *iface);
+int MMG3D_Get_tetFromTria(MMG5_pMesh mesh, MMG5_int ktri, MMG5_int *ktet, int *iface);
 #ifdef __cplusplus
 }
 #endif
@@ -35,65 +35,67 @@
 void MMG3D_setfunc(MMG5_pMesh mesh,MMG5_pSol met) {
   if ( met->size == 1 || ( met->size == 3 && mesh->info.lag >= 0 ) ) {
     if ( mesh->info.optimLES ) {
-      _MMG5_caltet          = _MMG3D_caltetLES_iso;
-      _MMG5_movintpt        = _MMG5_movintpt_iso;
+      mesh->func.caltet      = _MMG3D_caltetLES_iso;
+      mesh->func.movintpt    = _MMG5_movintpt_iso;
     }
     else {
-      _MMG5_caltet          = _MMG5_caltet_iso;
-      _MMG5_movintpt        = _MMG5_movintpt_iso;
+      mesh->func.caltet      = _MMG5_caltet_iso;
+      mesh->func.movintpt    = _MMG5_movintpt_iso;
     }
-    _MMG5_caltri          = _MMG5_caltri_iso;
-    _MMG5_lenedg          = _MMG5_lenedg_iso;
-    MMG3D_lenedgCoor      = _MMG5_lenedgCoor_iso;
-    _MMG5_lenSurfEdg      = _MMG5_lenSurfEdg_iso;
-    _MMG5_intmet          = _MMG5_intmet_iso;
-    _MMG5_lenedgspl       = _MMG5_lenedg_iso;
-    _MMG5_movbdyregpt     = _MMG5_movbdyregpt_iso;
-    _MMG5_movbdyrefpt     = _MMG5_movbdyrefpt_iso;
-    _MMG5_movbdynompt     = _MMG5_movbdynompt_iso;
-    _MMG5_movbdyridpt     = _MMG5_movbdyridpt_iso;
-    _MMG5_interp4bar      = _MMG5_interp4bar_iso;
-    _MMG5_defsiz          = _MMG3D_defsiz_iso;
-    _MMG5_gradsiz         = _MMG5_gradsiz_iso;
+    mesh->func.caltri      = _MMG5_caltri_iso;
+    mesh->func.lenedg      = _MMG5_lenedg_iso;
+    MMG3D_lenedgCoor       = _MMG5_lenedgCoor_iso;
+    mesh->func.lenSurfEdg  = _MMG5_lenSurfEdg_iso;
+    mesh->func.intmet      = _MMG5_intmet_iso;
+    mesh->func.lenedgspl   = _MMG5_lenedg_iso;
+    mesh->func.movbdyregpt = _MMG5_movbdyregpt_iso;
+    mesh->func.movbdyrefpt = _MMG5_movbdyrefpt_iso;
+    mesh->func.movbdynompt = _MMG5_movbdynompt_iso;
+    mesh->func.movbdyridpt = _MMG5_movbdyridpt_iso;
+    mesh->func.interp4bar  = _MMG5_interp4bar_iso;
+    mesh->func.defsiz      = _MMG3D_defsiz_iso;
+    mesh->func.gradsiz     = _MMG5_gradsiz_iso;
 #ifndef PATTERN
-    _MMG5_cavity          = _MMG5_cavity_iso;
-    _MMG3D_octreein       = _MMG3D_octreein_iso;
+    mesh->func.cavity      = _MMG5_cavity_iso;
+    mesh->func.cavityPar   = _MMG5_cavityPar_iso;
+    mesh->func.octreein    = _MMG3D_octreein_iso;
 #endif
   }
   else if ( met->size == 6 ) {
     if ( !met->m && !mesh->info.optim && mesh->info.hsiz<=0. ) {
-      _MMG5_caltet          = _MMG5_caltet_iso;
-      _MMG5_caltri          = _MMG5_caltri_iso;
-      _MMG5_lenedg         = _MMG5_lenedg_iso;
-      MMG3D_lenedgCoor     = _MMG5_lenedgCoor_iso;
-      _MMG5_lenSurfEdg     = _MMG5_lenSurfEdg_iso;
+      mesh->func.caltet      = _MMG5_caltet_iso;
+      mesh->func.caltri      = _MMG5_caltri_iso;
+      mesh->func.lenedg      = _MMG5_lenedg_iso;
+      MMG3D_lenedgCoor       = _MMG5_lenedgCoor_iso;
+      mesh->func.lenSurfEdg  = _MMG5_lenSurfEdg_iso;
     }
     else {
-      _MMG5_caltet         = _MMG5_caltet_ani;
-      _MMG5_caltri         = _MMG5_caltri_ani;
-      _MMG5_lenedg         = _MMG5_lenedg_ani;
-      MMG3D_lenedgCoor     = _MMG5_lenedgCoor_ani;
-      _MMG5_lenSurfEdg     = _MMG5_lenSurfEdg_ani;
+      mesh->func.caltet      = _MMG5_caltet_ani;
+      mesh->func.caltri      = _MMG5_caltri_ani;
+      mesh->func.lenedg      = _MMG5_lenedg_ani;
+      MMG3D_lenedgCoor       = _MMG5_lenedgCoor_ani;
+      mesh->func.lenSurfEdg  = _MMG5_lenSurfEdg_ani;
     }
-    _MMG5_intmet         = _MMG5_intmet_ani;
-    _MMG5_lenedgspl      = _MMG5_lenedg_ani;
-    _MMG5_movintpt       = _MMG5_movintpt_ani;
-   _MMG5_movbdyregpt     = _MMG5_movbdyregpt_ani;
-   _MMG5_movbdyrefpt     = _MMG5_movbdyrefpt_ani;
-   _MMG5_movbdynompt     = _MMG5_movbdynompt_ani;
-   _MMG5_movbdyridpt     = _MMG5_movbdyridpt_ani;
-    _MMG5_interp4bar     = _MMG5_interp4bar_ani;
-    _MMG5_defsiz         = _MMG3D_defsiz_ani;
-    _MMG5_gradsiz        = _MMG5_gradsiz_ani;
+    mesh->func.intmet      = _MMG5_intmet_ani;
+    mesh->func.lenedgspl   = _MMG5_lenedg_ani;
+    mesh->func.movintpt    = _MMG5_movintpt_ani;
+    mesh->func.movbdyregpt = _MMG5_movbdyregpt_ani;
+    mesh->func.movbdyrefpt = _MMG5_movbdyrefpt_ani;
+    mesh->func.movbdynompt = _MMG5_movbdynompt_ani;
+    mesh->func.movbdyridpt = _MMG5_movbdyridpt_ani;
+    mesh->func.interp4bar  = _MMG5_interp4bar_ani;
+    mesh->func.defsiz      = _MMG3D_defsiz_ani;
+    mesh->func.gradsiz     = _MMG5_gradsiz_ani;
 #ifndef PATTERN
-    _MMG5_cavity         = _MMG5_cavity_ani;
-    _MMG3D_octreein      = _MMG3D_octreein_ani;
+    mesh->func.cavity      = _MMG5_cavity_ani;
+    mesh->func.cavityPar   = _MMG5_cavityPar_ani;
+    mesh->func.octreein    = _MMG3D_octreein_ani;
 #endif
   }
 }
 
-int MMG3D_Get_adjaTet(MMG5_pMesh mesh, int kel, int listet[4]) {
-  int idx;
+int MMG3D_Get_adjaTet(MMG5_pMesh mesh, MMG5_int kel, MMG5_int listet[4]) {
+  MMG5_int idx;
 
   if ( ! mesh->adja ) {
     if (! MMG3D_hashTetra(mesh, 0))
@@ -122,10 +124,10 @@ int MMG3D_usage(char *prog) {
 #endif
 #ifndef PATTERN
   fprintf(stdout,"-octree val  Specify the max number of points per octree cell \n");
+  fprintf(stdout,"-nthreads n  Number of threads for the point insertion and adjacency\n");
 #endif
-#ifdef USE_SCOTCH
-  fprintf(stdout,"-rn [n]      Turn on or off the renumbering using SCOTCH [1/0] \n");
-#endif
+  fprintf(stdout,"-rn [n]      Renumbering: 0 off, 1 with SCOTCH (if available),\n");
+  fprintf(stdout,"             2 along a Hilbert curve\n");
   fprintf(stdout,"\n");
 
   fprintf(stdout,"-nofem       do not force Mmg to create a finite element mesh \n");
@@ -147,12 +149,16 @@ int MMG3D_defaultValues(MMG5_pMesh mesh) {
 #ifndef PATTERN
   fprintf(stdout,"Max number of point per octree cell (-octree) : %d\n",
           mesh->info.octree);
+  fprintf(stdout,"Number of threads (-nthreads)       : %d\n",
+          mesh->info.nthreads);
 #endif
 #ifdef USE_SCOTCH
   fprintf(stdout,"SCOTCH renumbering                  : enabled\n");
 #else
   fprintf(stdout,"SCOTCH renumbering                  : disabled\n");
 #endif
+  fprintf(stdout,"Renumbering (-rn)                   : %d\n",
+          mesh->info.renum);
   fprintf(stdout,"\n\n");
 
   return 1;
@@ -311,6 +317,20 @@ int MMG3D_parsar(int argc,char *argv[],MMG5_pMesh mesh,MMG5_pSol met) {
           if ( !MMG3D_Set_iparameter(mesh,met,MMG3D_IPARAM_nosurf,1) )
             return 0;
         }
+#ifndef PATTERN
+        else if ( !strcmp(argv[i],"-nthreads") ) {
+          if ( ++i < argc && isdigit(argv[i][0]) ) {
+            if ( !MMG3D_Set_iparameter(mesh,met,MMG3D_IPARAM_nthreads,
+                                       atoi(argv[i])) )
+              return 0;
+          }
+          else {
+            fprintf(stderr,"Missing argument option %s\n",argv[i-1]);
+            MMG3D_usage(argv[0]);
+            return 0;
+          }
+        }
+#endif
         break;
       case 'o':
         if ( !strcmp(argv[i],"-out") ) {
@@ -344,7 +364,6 @@ int MMG3D_parsar(int argc,char *argv[],MMG5_pMesh mesh,MMG5_pSol met) {
             return 0;
         }
         break;
-#ifdef USE_SCOTCH
       case 'r':
         if ( !strcmp(argv[i],"-rn") ) {
           if ( ++i < argc ) {
@@ -365,7 +384,6 @@ int MMG3D_parsar(int argc,char *argv[],MMG5_pMesh mesh,MMG5_pSol met) {
           }
         }
         break;
-#endif
       case 's':
         if ( !strcmp(argv[i],"-sol") ) {
           if ( ++i < argc && isascii(argv[i][0]) && argv[i][0]!='-' ) {
@@ -563,7 +581,7 @@ int MMG3D_mmg3dcheck(MMG5_pMesh mesh,MMG5_pSol met,double critmin, double lmin,
   int       ier;
   char      stim[32];
 
-  _MMG3D_Set_commonFunc();
+  _MMG3D_Set_commonFunc(mesh);
 
   /** Free topologic tables (adja, xpoint, xtetra) resulting from a previous
    * run */
@@ -643,7 +661,7 @@ void MMG3D_searchqua(MMG5_pMesh mesh,MMG5_pSol met,double critmin, int *eltab,
                     char metRidTyp) {
   MMG5_pTetra   pt;
   double   rap;
-  int      k;
+  MMG5_int k;
 
   for (k=1; k<=mesh->ne; k++) {
     pt = &mesh->tetra[k];
@@ -655,7 +673,7 @@ void MMG3D_searchqua(MMG5_pMesh mesh,MMG5_pSol met,double critmin, int *eltab,
       rap = _MMG3D_ALPHAD * _MMG5_caltet33_ani(mesh,met,pt);
     }
     else {
-      rap = _MMG3D_ALPHAD * _MMG5_caltet(mesh,met,pt);
+      rap = _MMG3D_ALPHAD * mesh->func.caltet(mesh,met,pt);
     }
 
     if ( rap == 0.0 || rap < critmin ) {
@@ -665,9 +683,9 @@ void MMG3D_searchqua(MMG5_pMesh mesh,MMG5_pSol met,double critmin, int *eltab,
   return;
 }
 
-int MMG3D_Get_tetFromTria(MMG5_pMesh mesh, int ktri, int *ktet, int *iface)
+int MMG3D_Get_tetFromTria(MMG5_pMesh mesh, MMG5_int ktri, MMG5_int *ktet, int *iface)
 {
-  int val;
+  MMG5_int val;
 
   val = mesh->tria[ktri].cc;
 
@@ -675,7 +693,7 @@ int MMG3D_Get_tetFromTria(MMG5_pMesh mesh, int ktri, int *ktet, int *iface)
 
   *ktet = val/4;
 
-  *iface = val%4;
+  *iface = (int)(val%4);
 
   return 1;
 }
@@ -685,7 +703,7 @@ int MMG3D_searchlen(MMG5_pMesh mesh, MMG5_pSol met, double lmin,
   MMG5_pTetra          pt;
  _MMG5_Hash           hash;
   double          len;
-  int             k,np,nq;
+  MMG5_int        np,nq,k;
   char            ia,i0,i1,ier;
 
   /* Hash all edges in the mesh */
@@ -724,7 +742,7 @@ int MMG3D_searchlen(MMG5_pMesh mesh, MMG5_pSol met, double lmin,
       ier = _MMG5_hashPop(&hash,np,nq);
       if( ier ) {
         if ( (!metRidTyp) && met->m && met->size>1 ) {
-          len = _MMG5_lenedg(mesh,met,ia,pt);
+          len = mesh->func.lenedg(mesh,met,ia,pt);
         }
         else {
           len = _MMG5_lenedg33_ani(mesh,met,ia,pt);
@@ -737,7 +755,7 @@ int MMG3D_searchlen(MMG5_pMesh mesh, MMG5_pSol met, double lmin,
       }
     }
   }
-  _MMG5_DEL_MEM(mesh,hash.item,(hash.max+1)*sizeof(_MMG5_hedge));
+  _MMG5_DEL_MEM(mesh,hash.item,hash.siz*sizeof(_MMG5_hedge));
   return(1);
 }
 
@@ -745,7 +763,8 @@ int MMG3D_doSol(MMG5_pMesh mesh,MMG5_pSol met) {
     MMG5_pTetra  pt;
     MMG5_pPoint  p1,p2;
     double       ux,uy,uz,dd;
-    int          i,k,iadr,ia,ib,ipa,ipb,type;
+    int          i,ia,ib,type;
+    MMG5_int     ipa,ipb,iadr,k;
     int         *mark;
 
     _MMG5_SAFE_CALLOC(mark,mesh->np+1,int,0);
@@ -875,7 +894,8 @@ int MMG3D_doSol(MMG5_pMesh mesh,MMG5_pSol met) {
 int MMG3D_Set_constantSize(MMG5_pMesh mesh,MMG5_pSol met) {
   MMG5_pPoint ppt;
   double      hsiz;
-  int         k,iadr,type;
+  int         type;
+  MMG5_int    k,iadr;
 
   /* Memory alloc */
   if ( met->size==1 ) type=1;
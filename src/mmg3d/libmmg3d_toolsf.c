@@ -153,7 +153,7 @@ FORTRAN_NAME(MMG3D_SEARCHLEN,mmg3d_searchlen,
  * See \ref MMG3D_Get_tetFromTria function in \ref mmg3d/libmmg3d.h file.
  */
 FORTRAN_NAME(MMG3D_GET_TETFROMTRIA,mmg3d_get_tetfromtria,
-             (MMG5_pMesh *mesh,int *ktri, int *ktet, int *iface,int *retval),
+             (MMG5_pMesh *mesh,MMG5_int *ktri, MMG5_int *ktet, int *iface,int *retval),
              (mesh,ktri,ktet,iface,retval)) {
 
   *retval = MMG3D_Get_tetFromTria(*mesh,*ktri,ktet,iface);
@@ -164,7 +164,7 @@ FORTRAN_NAME(MMG3D_GET_TETFROMTRIA,mmg3d_get_tetfromtria,
  * See \ref MMG3D_Get_adjaTet function in \ref mmg3d/libmmg3d.h file.
  */
 FORTRAN_NAME(MMG3D_GET_ADJATET,mmg3d_get_adjatet,
-               (MMG5_pMesh *mesh,int* kel, int listet[4], int* retval),
+               (MMG5_pMesh *mesh,MMG5_int* kel, MMG5_int listet[4], int* retval),
                (mesh,kel,listet,retval)) {
   *retval =  MMG3D_Get_adjaTet(*mesh,*kel,listet);
   return;
@@ -23,7 +23,7 @@
 
 /**
  * \file mmg3d/librnbg_3d.c
- * \brief Functions for scotch renumerotation.
+ * \brief Functions for scotch and space filling curve renumerotation.
  * \author Algiane Froehly (Inria/UBordeaux)
  * \author Cedric Lachat (Inria/UBordeaux)
  * \version 5
@@ -33,10 +33,6 @@
 
 #include "mmg3d.h"
 
-#ifdef USE_SCOTCH
-
-#include "librnbg.h"
-
 /**
  * \param tetras pointer toward a table containing the tetra structures.
  * \param *perm pointer toward the permutation table (to perform in place
@@ -48,9 +44,9 @@
  *
  */
 static inline
-void _MMG5_swapTet(MMG5_pTetra tetras/*, int* adja*/, int* perm, int ind1, int ind2) {
+void _MMG5_swapTet(MMG5_pTetra tetras/*, int* adja*/, MMG5_int* perm, MMG5_int ind1, MMG5_int ind2) {
   MMG5_Tetra pttmp;
-  int        tmp;
+  MMG5_int   tmp;
 
   /* Commentated part: swap for adja table if we don't free it in renumbering *
    * function (faster but need of 4*mesh->nemax*sizeof(int) extra bytes ) */
@@ -96,6 +92,10 @@ void _MMG5_swapTet(MMG5_pTetra tetras/*, int* adja*/, int* perm, int ind1, int i
   perm[ind1] = tmp;
 }
 
+#ifdef USE_SCOTCH
+
+#include "librnbg.h"
+
 /**
  * \param boxVertNbr number of vertices by box.
  * \param mesh pointer toward the mesh structure.
@@ -114,8 +114,10 @@ int _MMG5_mmg3dRenumbering(int boxVertNbr, MMG5_pMesh mesh, MMG5_pSol sol) {
   SCOTCH_Num  edgeNbr;
   SCOTCH_Num  *vertTab, *edgeTab, *permVrtTab;
   SCOTCH_Graph graf ;
-  int    vertNbr, nodeGlbIdx, tetraIdx, ballTetIdx;
-  int    i, j, k;
+  int    vertNbr, nodeGlbIdx, ballTetIdx;
+  MMG5_int tetraIdx;
+  int    i;
+  MMG5_int j,k;
   int    edgeSiz;
   int    *vertOldTab, *permNodTab, nereal, npreal;
   int    *adja,iadr;
@@ -238,7 +240,7 @@ int _MMG5_mmg3dRenumbering(int boxVertNbr, MMG5_pMesh mesh, MMG5_pSol sol) {
   }
 
   /* free adjacents to gain memory space */
-  _MMG5_DEL_MEM(mesh,mesh->adja,(4*mesh->nemax+5)*sizeof(int));
+  _MMG5_DEL_MEM(mesh,mesh->adja,(4*mesh->nemax+5)*sizeof(MMG5_int));
 
   /* Building the graph by calling Scotch functions */
   SCOTCH_graphInit(&graf) ;
@@ -389,3 +391,175 @@ int _MMG5_mmg3dRenumbering(int boxVertNbr, MMG5_pMesh mesh, MMG5_pSol sol) {
 }
 #endif
 
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \return 1 if success, 0 if fail (lack of memory, the xtetra table is
+ * unchanged).
+ *
+ * Store the xtetras in the order of the tetras and remove the unused ones.
+ *
+ */
+static int _MMG3D_sfcPackXTetra(MMG5_pMesh mesh) {
+  MMG5_pTetra  pt;
+  MMG5_pxTetra xtetra;
+  int          nxt;
+  MMG5_int     k;
+
+  if ( !mesh->xt ) return(1);
+
+  _MMG5_ADD_MEM(mesh,(mesh->xt+1)*sizeof(MMG5_xTetra),"xtetra copy",return(0));
+  _MMG5_SAFE_MALLOC(xtetra,mesh->xt+1,MMG5_xTetra,0);
+
+  nxt = 0;
+  for (k=1; k<=mesh->ne; k++) {
+    pt = &mesh->tetra[k];
+    if ( !MG_EOK(pt) || !pt->xt ) continue;
+    memcpy(&xtetra[++nxt],&mesh->xtetra[pt->xt],sizeof(MMG5_xTetra));
+    pt->xt = nxt;
+  }
+  memcpy(&mesh->xtetra[1],&xtetra[1],nxt*sizeof(MMG5_xTetra));
+  memset(&mesh->xtetra[nxt+1],0,(mesh->xt-nxt)*sizeof(MMG5_xTetra));
+
+  _MMG5_DEL_MEM(mesh,xtetra,(mesh->xt+1)*sizeof(MMG5_xTetra));
+  mesh->xt = nxt;
+
+  return(1);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param sol pointer toward the solution structure.
+ * \return 0 if the renumbering fail and we can't rebuild tetrahedra hashtable,
+ * 1 otherwise.
+ *
+ * Renumber the tetrahedra along the Hilbert curve (through their barycenters),
+ * then the vertices in the order of their first appearance in the tetrahedra
+ * (the vertices that don't belong to a tetra are stored after), then the
+ * xtetra and the xpoints. Doesn't need scotch.
+ *
+ */
+int _MMG3D_sfcRenumbering(MMG5_pMesh mesh, MMG5_pSol sol) {
+  MMG5_pTetra  pt;
+  MMG5_pPrism  pp;
+  _MMG5_sfcKey *keys;
+  double       min[3],scale,c[3];
+  int          *permNod,nereal,npreal,i,j;
+  MMG5_int     k,*permTet;
+
+  /* Position of the tetra along the curve */
+  _MMG5_sfcBoundingBox(mesh,min,&scale);
+
+  _MMG5_ADD_MEM(mesh,(mesh->ne+1)*sizeof(_MMG5_sfcKey),"sfc keys",return(1));
+  _MMG5_SAFE_MALLOC(keys,mesh->ne+1,_MMG5_sfcKey,1);
+
+  nereal = 0;
+  for (k=1; k<=mesh->ne; k++) {
+    pt = &mesh->tetra[k];
+    if ( !MG_EOK(pt) ) continue;
+
+    for (i=0; i<3; i++) {
+      c[i] = 0.;
+      for (j=0; j<4; j++)
+        c[i] += mesh->point[pt->v[j]].c[i];
+      c[i] *= 0.25;
+    }
+    keys[nereal].key = _MMG5_hilbertKey(c,min,scale,3);
+    keys[nereal].idx = k;
+    ++nereal;
+  }
+  qsort(keys,nereal,sizeof(_MMG5_sfcKey),_MMG5_sfcCompKey);
+
+  _MMG5_ADD_MEM(mesh,(mesh->ne+1)*sizeof(MMG5_int),"permTet",
+                _MMG5_DEL_MEM(mesh,keys,(mesh->ne+1)*sizeof(_MMG5_sfcKey));
+                return(1));
+  _MMG5_SAFE_CALLOC(permTet,mesh->ne+1,MMG5_int,1);
+
+  for (k=0; k<nereal; k++)
+    permTet[keys[k].idx] = k+1;
+  _MMG5_DEL_MEM(mesh,keys,(mesh->ne+1)*sizeof(_MMG5_sfcKey));
+
+  _MMG5_ADD_MEM(mesh,(mesh->np+1)*sizeof(int),"permNodTab",
+                _MMG5_DEL_MEM(mesh,permTet,(mesh->ne+1)*sizeof(MMG5_int));
+                return(1));
+  _MMG5_SAFE_CALLOC(permNod,mesh->np+1,int,1);
+
+  /* Adjacencies are rebuilt at the end */
+  if ( mesh->adja )
+    _MMG5_DEL_MEM(mesh,mesh->adja,(4*mesh->nemax+5)*sizeof(MMG5_int));
+
+  /* Permute tetras */
+  for (k=1; k<=mesh->ne; k++) {
+    while ( permTet[k] != k && permTet[k] )
+      _MMG5_swapTet(mesh->tetra,permTet,k,permTet[k]);
+  }
+  _MMG5_DEL_MEM(mesh,permTet,(mesh->ne+1)*sizeof(MMG5_int));
+
+  /* New numbering of the nodes */
+  npreal = 0;
+  for (k=1; k<=nereal; k++) {
+    pt = &mesh->tetra[k];
+    for (j=0; j<4; j++) {
+      if ( !permNod[pt->v[j]] ) permNod[pt->v[j]] = ++npreal;
+    }
+  }
+  for (k=1; k<=mesh->nprism; k++) {
+    pp = &mesh->prism[k];
+    if ( !MG_EOK(pp) ) continue;
+    for (j=0; j<6; j++) {
+      if ( !permNod[pp->v[j]] ) permNod[pp->v[j]] = ++npreal;
+    }
+  }
+  for (k=1; k<=mesh->np; k++) {
+    if ( !permNod[k] && MG_VOK(&mesh->point[k]) ) permNod[k] = ++npreal;
+  }
+
+  /* Modify the numbering of the nodes of each tetra, prism and quadra */
+  for (k=1; k<=nereal; k++) {
+    for (j=0; j<4; j++)
+      mesh->tetra[k].v[j] = permNod[mesh->tetra[k].v[j]];
+  }
+  for (k=1; k<=mesh->nprism; k++) {
+    for (j=0; j<6; j++)
+      mesh->prism[k].v[j] = permNod[mesh->prism[k].v[j]];
+  }
+  for (k=1; k<=mesh->nquad; k++) {
+    for (j=0; j<4; j++)
+      mesh->quadra[k].v[j] = permNod[mesh->quadra[k].v[j]];
+  }
+
+  /* Permute nodes and sol */
+  for (k=1; k<=mesh->np; k++) {
+    while ( permNod[k] != k && permNod[k] )
+      _MMG5_swapNod(mesh->point,sol->m,permNod,k,permNod[k],sol->size);
+  }
+  _MMG5_DEL_MEM(mesh,permNod,(mesh->np+1)*sizeof(int));
+
+  mesh->ne = nereal;
+  mesh->np = npreal;
+
+  if ( mesh->np == mesh->npmax )
+    mesh->npnil = 0;
+  else
+    mesh->npnil = mesh->np + 1;
+
+  if ( mesh->ne == mesh->nemax )
+    mesh->nenil = 0;
+  else
+    mesh->nenil = mesh->ne + 1;
+
+  if ( mesh->npnil )
+    for (k=mesh->npnil; k<mesh->npmax-1; k++)
+      mesh->point[k].tmp  = k+1;
+
+  if ( mesh->nenil )
+    for (k=mesh->nenil; k<mesh->nemax-1; k++)
+      mesh->tetra[k].v[3] = k+1;
+
+  /* Boundary entities in the new order (skipped if we lack of memory) */
+  _MMG3D_sfcPackXTetra(mesh);
+  _MMG5_sfcPackXPoint(mesh);
+
+  if( !MMG3D_hashTetra(mesh,0) ) return(0);
+
+  return(1);
+}
@@ -60,7 +60,8 @@ static void _MMG5_endcod() {
  */
 static inline
 int _MMG5_countLocalParamAtTet( MMG5_pMesh mesh,_MMG5_iNode **bdyRefs) {
-  int         npar,k,ier;
+  int         npar,ier;
+  MMG5_int    k;
 
   /** Count the number of different boundary references and list it */
   (*bdyRefs) = NULL;
@@ -68,7 +69,7 @@ int _MMG5_countLocalParamAtTet( MMG5_pMesh mesh,_MMG5_iNode **bdyRefs) {
   k = mesh->ne? mesh->tetra[1].ref : 0;
 
   /* Try to alloc the first node */
-  ier = _MMG5_Add_inode( mesh, bdyRefs, k );
+  ier = _MMG5_Add_inode( mesh, bdyRefs, (int)k );
   if ( ier < 0 ) {
     fprintf(stderr,"\n  ## Error: %s: unable to allocate the first boundary"
            " reference node.\n",__func__);
@@ -198,7 +199,7 @@ int _MMG3D_defaultOption(MMG5_pMesh mesh,MMG5_pSol met) {
   double    hsiz;
   char      stim[32];
 
-  _MMG3D_Set_commonFunc();
+  _MMG3D_Set_commonFunc(mesh);
 
   signal(SIGABRT,_MMG5_excfun);
   signal(SIGFPE,_MMG5_excfun);
@@ -299,8 +300,6 @@ int main(int argc,char *argv[]) {
   fprintf(stdout,"     %s\n",MG_CPY);
   fprintf(stdout,"     %s %s\n",__DATE__,__TIME__);
 
-  _MMG3D_Set_commonFunc();
-
   /* Print timer at exit */
   atexit(_MMG5_endcod);
 
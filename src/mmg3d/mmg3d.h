@@ -47,7 +47,7 @@ extern "C" {
     of point ip with coordinates o and tag tag*/
 #define _MMG5_POINT_REALLOC(mesh,sol,ip,wantedGap,law,o,tag,retval ) do \
   {                                                                     \
-    int klink;                                                          \
+    MMG5_int klink;                                                     \
                                                                         \
     _MMG5_TAB_RECALLOC(mesh,mesh->point,mesh->npmax,wantedGap,MMG5_Point, \
                        "larger point table",law,retval);                \
@@ -75,7 +75,7 @@ extern "C" {
     of tetra jel */
 #define _MMG5_TETRA_REALLOC(mesh,jel,wantedGap,law,retval) do           \
   {                                                                     \
-    int klink,oldSiz;                                                   \
+    MMG5_int klink,oldSiz;                                              \
                                                                         \
     oldSiz = mesh->nemax;                                               \
     _MMG5_TAB_RECALLOC(mesh,mesh->tetra,mesh->nemax,wantedGap,MMG5_Tetra, \
@@ -87,10 +87,10 @@ extern "C" {
                                                                         \
     if ( mesh->adja ) {                                                 \
       /* adja table */                                                  \
-      _MMG5_ADD_MEM(mesh,4*(mesh->nemax-oldSiz)*sizeof(int),            \
+      _MMG5_ADD_MEM(mesh,4*(mesh->nemax-oldSiz)*sizeof(MMG5_int),       \
                     "larger adja table",law);            \
-      _MMG5_SAFE_RECALLOC(mesh->adja,4*mesh->ne+5,4*mesh->nemax+5,int   \
-                          ,"larger adja table",retval);                 \
+      _MMG5_SAFE_RECALLOC(mesh->adja,4*mesh->ne+5,4*mesh->nemax+5,      \
+                          MMG5_int,"larger adja table",retval);         \
     }                                                                   \
                                                                         \
     /* We try again to add the point */                                 \
@@ -114,6 +114,27 @@ extern "C" {
 
 #define _MMG3D_SHORTMAX     0x7fff
 
+/** Ratio between the numbers of tetra of an adapted mesh and of regular unit
+ * tetra filling the same metric volume */
+#define _MMG3D_NEUNIT       1.25
+/** Ratio between the numbers of tetra and of points of an adapted mesh */
+#define _MMG3D_NERATIO      5.5
+
+/** Number of elements evaluated at once by the batch quality/length kernels */
+#define _MMG3D_NBATCH       64
+
+/* Runtime selection of the vector instruction set of the batch kernels. The
+ * contractions in fma are disabled so that each version computes exactly the
+ * same values as the scalar functions. */
+#if defined(__GNUC__) && !defined(__clang__) && !defined(__INTEL_COMPILER) \
+  && __GNUC__ >= 6 && defined(__x86_64__) && defined(__linux__)
+#define _MMG3D_BATCH_KERNEL                                             \
+  __attribute__((optimize("fp-contract=off"),                           \
+                 target_clones("avx512f","avx2","default")))
+#else
+#define _MMG3D_BATCH_KERNEL
+#endif
+
 
 /** \brief next vertex of tetra: {1,2,3,0,1,2,3} */
 static const unsigned char _MMG5_inxt3[7] = { 1,2,3,0,1,2,3 };
@@ -168,117 +189,189 @@ static const unsigned char MMG5_permedge[12][6] = {
 typedef struct _MMG3D_octree_s
 {
   struct _MMG3D_octree_s* branches; /*!< pointer toward the subtrees of the current octree */
-  int* v;      /*!< vertex index */
-  int  nbVer;  /*!< number of vertices in the sub tree */
+  MMG5_int* v;     /*!< vertex index */
+  MMG5_int  nbVer; /*!< number of vertices in the sub tree */
   int  depth; /*!< sub tree depth */
 } _MMG3D_octree_s;
 
+/**
+ * Pool of items of same size (branches or vertex lists of the octree
+ * cells), allocated by chunks of \a nitem items.
+ */
+typedef struct _MMG3D_octreePool
+{
+  void   *chunk; /*!< list of the allocated chunks (linked by their first bytes) */
+  void   *free;  /*!< list of the free items (linked by their first bytes) */
+  size_t  siz;   /*!< size of an item (in bytes) */
+  int     nitem; /*!< number of items per chunk */
+} _MMG3D_octreePool;
+
 /**
  * Octree global structure (enriched by global variables).
  */
-typedef struct
+typedef struct _MMG3D_octree
 {
   int nv;  /*!< Max number of points per octree cell */
   int nc; /*!< Max number of cells listed per local search in the octree (-3)*/
   _MMG3D_octree_s* q0; /*!<  Pointer toward the first octree cell */
+  _MMG3D_octreePool br; /*!< Pool of the branches of the cells */
+  _MMG3D_octreePool vl; /*!< Pool of the vertex lists of the cells (below the
+                          maximal depth) */
+  _MMG3D_octree_s** qlist; /*!< Cells listed by the last local search */
+  double* dist; /*!< Distances of the listed cells to the search zone */
 } _MMG3D_octree;
 typedef _MMG3D_octree * _MMG3D_pOctree;
 
+/** Size of the table used to mark the tetra of a cavity (power of 2) */
+#define _MMG3D_CAVSIZ 8192
+
+/**
+ * Marker of the tetrahedra of a Delaunay cavity. If \a key is NULL, the
+ * tetrahedra are marked through their \a flag field (sequential insertion),
+ * otherwise through a thread-private open addressing table, which allows to
+ * build several cavities at the same time.
+ */
+typedef struct _MMG3D_cavMark
+{
+  int  base; /*!< flag of the tetra of the cavity (if key is NULL) */
+  int  cur;  /*!< current generation of the table */
+  MMG5_int *key; /*!< tetra of the cavity (-k if k has been removed from the cavity) */
+  int *gen;  /*!< generation at which the slots of \a key have been filled */
+} _MMG3D_cavMark;
+
+/**
+ * Circumsphere of a tetrahedron, cached by the Delaunay kernel so that the
+ * sphere of a tetra visited by several cavities is computed only once. The
+ * entry is valid only if \a v matches the vertices of the tetra.
+ */
+typedef struct _MMG3D_Sphere
+{
+  double c[3]; /*!< circumcentre */
+  double rad;  /*!< squared radius (negative if the tetra is degenerate) */
+  MMG5_int v[4]; /*!< vertices of the tetra (v[0]=0 if the entry is unset) */
+} _MMG3D_Sphere;
+typedef _MMG3D_Sphere * _MMG3D_pSphere;
+
+/**
+ * Shortest and longest edges of a tetrahedron, cached by the split/collapse
+ * loops so that the lengths of a tetra that is not modified between two sweeps
+ * are computed only once. The entry is valid only if \a v and \a mark match
+ * the vertices and the mark of the tetra.
+ */
+typedef struct _MMG3D_Length
+{
+  double lmin; /*!< length of the shortest edge */
+  double lmax; /*!< length of the longest edge */
+  MMG5_int v[4]; /*!< vertices of the tetra (v[0]=0 if the entry is unset) */
+  int    mark; /*!< mark of the tetra */
+  char   imin; /*!< local index of the shortest edge */
+  char   imax; /*!< local index of the longest edge */
+} _MMG3D_Length;
+typedef _MMG3D_Length * _MMG3D_pLength;
+
 
 /* octree */
 void _MMG3D_initOctree_s( _MMG3D_octree_s* q);
 int _MMG3D_initOctree(MMG5_pMesh,_MMG3D_pOctree* q, int nv);
-void _MMG3D_freeOctree_s(MMG5_pMesh,_MMG3D_octree_s* q, int nv);
+void _MMG3D_freeOctree_s(MMG5_pMesh,_MMG3D_pOctree,_MMG3D_octree_s* q);
 void _MMG3D_freeOctree(MMG5_pMesh,_MMG3D_octree** q);
+void _MMG3D_markOctree(MMG5_pMesh,_MMG3D_pOctree q);
+int _MMG3D_resetOctree(MMG5_pMesh,_MMG3D_pOctree q);
 int _MMG3D_isCellIncluded(double* cellCenter, double l, double* zoneCenter, double l0);
 void _MMG3D_placeInListDouble(double*, double, int, int);
 void _MMG3D_placeInListOctree(_MMG3D_octree_s**, _MMG3D_octree_s*, int, int);
-int _MMG3D_seekIndex (double* distList, double dist, int indexMin, int indexMax);
 int _MMG3D_intersectRect(double *rectin, double *rectinout);
-int _MMG3D_getListSquareRec(_MMG3D_octree_s*,double*,double*,
-                            _MMG3D_octree_s***,double*,double*,double, int, int, int*);
 int  _MMG3D_getListSquare(MMG5_pMesh,double*,_MMG3D_octree*,double*,_MMG3D_octree_s***);
-int _MMG3D_addOctreeRec(MMG5_pMesh,_MMG3D_octree_s*,double*, const int, int);
-int _MMG3D_addOctree(MMG5_pMesh mesh, _MMG3D_octree* q, const int no);
+int _MMG3D_addOctreeRec(MMG5_pMesh,_MMG3D_pOctree,_MMG3D_octree_s*,double*, const MMG5_int);
+int _MMG3D_addOctree(MMG5_pMesh mesh, _MMG3D_octree* q, const MMG5_int no);
 int _MMG3D_delOctreeVertex(MMG5_pMesh,_MMG3D_octree_s* q, int no);
-int _MMG3D_moveOctree(MMG5_pMesh, _MMG3D_pOctree,int, double*, double*);
-void _MMG3D_mergeBranchesRec(_MMG3D_octree_s*, _MMG3D_octree_s*, int, int , int*);
-void _MMG3D_mergeBranches(MMG5_pMesh mesh,_MMG3D_octree_s* q, int dim, int nv);
-int _MMG3D_delOctreeRec(MMG5_pMesh,_MMG3D_octree_s*,double*, const int,const int);
-int _MMG3D_delOctree(MMG5_pMesh mesh, _MMG3D_pOctree q, const int no);
+int _MMG3D_moveOctree(MMG5_pMesh, _MMG3D_pOctree,MMG5_int, double*, double*);
+void _MMG3D_mergeBranchesRec(_MMG3D_octree_s*, _MMG3D_octree_s*, int, int , MMG5_int*);
+void _MMG3D_mergeBranches(MMG5_pMesh mesh,_MMG3D_pOctree,_MMG3D_octree_s* q);
+int _MMG3D_delOctreeRec(MMG5_pMesh,_MMG3D_pOctree,_MMG3D_octree_s*,double*, const MMG5_int);
+int _MMG3D_delOctree(MMG5_pMesh mesh, _MMG3D_pOctree q, const MMG5_int no);
 void _MMG3D_printArbreDepth(_MMG3D_octree_s* q, int depth, int nv, int dim);
 void _MMG3D_printArbre(_MMG3D_octree* q);
 void  _MMG3D_sizeArbreRec(_MMG3D_octree_s* q, int nv, int dim, int*,int*);
 int*  _MMG3D_sizeArbre(_MMG3D_octree* q, int dim);
-int  _MMG3D_octreein_iso(MMG5_pMesh,MMG5_pSol,_MMG3D_pOctree,int,double);
-int  _MMG3D_octreein_ani(MMG5_pMesh,MMG5_pSol,_MMG3D_pOctree,int,double);
+int  _MMG3D_octreein_iso(MMG5_pMesh,MMG5_pSol,_MMG3D_pOctree,MMG5_int,double);
+int  _MMG3D_octreein_ani(MMG5_pMesh,MMG5_pSol,_MMG3D_pOctree,MMG5_int,double);
 
 /* prototypes */
 int  _MMG3D_tetraQual(MMG5_pMesh mesh, MMG5_pSol met,char metRidTyp);
+void _MMG3D_estimSize(MMG5_pMesh mesh,MMG5_pSol met,long long *npest,
+                      long long *neest);
+double *_MMG3D_packCoor(MMG5_pMesh mesh);
+void _MMG3D_freeCoor(MMG5_pMesh mesh,double **coor);
+int  _MMG3D_newLength(MMG5_pMesh mesh);
+void _MMG3D_freeLength(MMG5_pMesh mesh);
+void _MMG3D_extLength(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,char keep,
+                      char *imin,double *lmin,char *imax,double *lmax);
 void _MMG3D_solTruncature(MMG5_pMesh mesh, MMG5_pSol met);
-extern int _MMG5_directsurfball(MMG5_pMesh mesh, int ip, int *list, int ilist, double n[3]);
+extern int _MMG5_directsurfball(MMG5_pMesh mesh, MMG5_int ip, MMG5_int *list, int ilist, double n[3]);
 
 int  _MMG3D_Init_mesh_var( va_list argptr );
 int  _MMG3D_Free_all_var( va_list argptr );
 int  _MMG3D_Free_structures_var( va_list argptr );
 int  _MMG3D_Free_names_var( va_list argptr );
-int  _MMG3D_newPt(MMG5_pMesh mesh,double c[3],int16_t tag);
-int  _MMG3D_newElt(MMG5_pMesh mesh);
-int  _MMG3D_delElt(MMG5_pMesh mesh,int iel);
-void _MMG3D_delPt(MMG5_pMesh mesh,int ip);
+MMG5_int _MMG3D_newPt(MMG5_pMesh mesh,double c[3],int16_t tag);
+MMG5_int _MMG3D_newElt(MMG5_pMesh mesh);
+int  _MMG3D_delElt(MMG5_pMesh mesh,MMG5_int iel);
+void _MMG3D_delPt(MMG5_pMesh mesh,MMG5_int ip);
 int  _MMG3D_zaldy(MMG5_pMesh mesh);
 void _MMG5_freeXTets(MMG5_pMesh mesh);
 void _MMG5_freeXPrisms(MMG5_pMesh mesh);
 extern void _MMG3D_Free_topoTables(MMG5_pMesh mesh);
   char _MMG5_chkedg(MMG5_pMesh mesh,MMG5_pTria pt,char ori,double,double,int);
 int  _MMG5_chkBdryTria(MMG5_pMesh mesh);
-void _MMG5_tet2tri(MMG5_pMesh mesh,int k,char ie,MMG5_Tria *ptt);
+void _MMG5_tet2tri(MMG5_pMesh mesh,MMG5_int k,char ie,MMG5_Tria *ptt);
 int    _MMG5_mmg3dBezierCP(MMG5_pMesh mesh,MMG5_Tria *pt,_MMG5_pBezier pb,char ori);
 extern int    _MMG5_BezierTgt(double c1[3],double c2[3],double n1[3],double n2[3],double t1[3],double t2[3]);
 extern double _MMG5_BezierGeod(double c1[3], double c2[3], double t1[3], double t2[3]);
 int  _MMG3D_bezierInt(_MMG5_pBezier pb,double uv[2],double o[3],double no[3],double to[3]);
-extern int  _MMG5_BezierReg(MMG5_pMesh mesh,int ip0, int ip1, double s, double v[3], double *o, double *no);
-extern int  _MMG5_BezierRef(MMG5_pMesh mesh,int ip0, int ip1, double s, double *o, double *no, double *to);
-extern int  _MMG5_BezierEdge(MMG5_pMesh mesh,int ip0, int ip1, double b0[3], double b1[3],char isrid, double v[3]);
-extern int  _MMG5_BezierRidge(MMG5_pMesh mesh,int ip0, int ip1, double s, double *o, double *no1, double *no2, double *to);
-extern int  _MMG5_BezierNom(MMG5_pMesh mesh,int ip0,int ip1,double s,double *o,double *no,double *to);
-extern int  _MMG5_norface(MMG5_pMesh mesh ,int k, int iface, double v[3]);
-int  _MMG5_boulernm (MMG5_pMesh mesh, int start, int ip, int *ng, int *nr);
-int  _MMG5_boulenm(MMG5_pMesh mesh, int start, int ip, int iface, double n[3],double t[3]);
-int  _MMG5_boulevolp(MMG5_pMesh mesh, int start, int ip, int * list);
-int  _MMG5_boulesurfvolp(MMG5_pMesh mesh,int start,int ip,int iface,int *listv,
-                         int *ilistv,int *lists,int*ilists, int isnm);
-int  _MMG5_bouletrid(MMG5_pMesh,int,int,int,int *,int *,int *,int *,int *,int *);
-int  _MMG5_startedgsurfball(MMG5_pMesh mesh,int nump,int numq,int *list,int ilist);
-int  _MMG5_srcbdy(MMG5_pMesh mesh,int start,int ia);
-int  _MMG5_coquil(MMG5_pMesh mesh, int start, int ia, int * list);
-int  _MMG5_coquilface(MMG5_pMesh mesh, int start,char iface,int,int*,int*,int*,int);
-int _MMG3D_coquilFaceFirstLoop(MMG5_pMesh mesh,int start,int na,int nb,char iface,
-                               char ia,int *list,int *ilist,int *it1,int *it2,
-                               int *piv,int *adj,char *hasadja,int *nbdy,int silent);
-void _MMG3D_coquilFaceSecondLoopInit(MMG5_pMesh mesh,int piv,char *iface,int *i,
-                                     int *list,int *ilist,int *it1,int *pradj,
-                                     int *adj);
-void _MMG5_coquilFaceErrorMessage(MMG5_pMesh mesh, int k1, int k2);
-int16_t _MMG5_coquilTravel(MMG5_pMesh, int, int, int*, int*, char*, int*);
-void _MMG5_openCoquilTravel(MMG5_pMesh, int, int, int*, int*, char*, int*);
-extern int  _MMG5_settag(MMG5_pMesh,int,int,int16_t,int);
-extern int  _MMG5_deltag(MMG5_pMesh,int,int,int16_t);
+extern int  _MMG5_BezierReg(MMG5_pMesh mesh,MMG5_int ip0, MMG5_int ip1, double s, double v[3], double *o, double *no);
+extern int  _MMG5_BezierRef(MMG5_pMesh mesh,MMG5_int ip0, MMG5_int ip1, double s, double *o, double *no, double *to);
+extern int  _MMG5_BezierEdge(MMG5_pMesh mesh,MMG5_int ip0, MMG5_int ip1, double b0[3], double b1[3],char isrid, double v[3]);
+extern int  _MMG5_BezierRidge(MMG5_pMesh mesh,MMG5_int ip0, MMG5_int ip1, double s, double *o, double *no1, double *no2, double *to);
+extern int  _MMG5_BezierNom(MMG5_pMesh mesh,MMG5_int ip0,MMG5_int ip1,double s,double *o,double *no,double *to);
+extern int  _MMG5_norface(MMG5_pMesh mesh ,MMG5_int k, int iface, double v[3]);
+int  _MMG5_boulernm (MMG5_pMesh mesh, MMG5_int start, int ip, int *ng, int *nr);
+int  _MMG5_boulenm(MMG5_pMesh mesh, MMG5_int start, int ip, int iface, double n[3],double t[3]);
+int  _MMG5_boulevolp(MMG5_pMesh mesh, MMG5_int start, MMG5_int ip, MMG5_int * list);
+int  _MMG3D_pointTetra(MMG5_pMesh mesh,char noreq,MMG5_int **pvtet,MMG5_int **ptet);
+int  _MMG5_boulesurfvolp(MMG5_pMesh mesh,MMG5_int start,int ip,int iface,MMG5_int *listv,
+                         int *ilistv,MMG5_int *lists,int*ilists, int isnm);
+int  _MMG5_bouletrid(MMG5_pMesh,MMG5_int,int,int,int *,MMG5_int *,int *,MMG5_int *,MMG5_int *,MMG5_int *);
+int  _MMG5_startedgsurfball(MMG5_pMesh mesh,MMG5_int nump,MMG5_int numq,MMG5_int *list,int ilist);
+int  _MMG5_srcbdy(MMG5_pMesh mesh,MMG5_int start,int ia);
+int  _MMG5_coquil(MMG5_pMesh mesh, MMG5_int start, int ia, MMG5_int * list);
+int  _MMG5_coquilface(MMG5_pMesh mesh, MMG5_int start,char iface,int,MMG5_int*,MMG5_int*,MMG5_int*,int);
+int _MMG3D_coquilFaceFirstLoop(MMG5_pMesh mesh,MMG5_int start,MMG5_int na,MMG5_int nb,char iface,
+                               char ia,MMG5_int *list,int *ilist,MMG5_int *it1,MMG5_int *it2,
+                               MMG5_int *piv,MMG5_int *adj,char *hasadja,int *nbdy,int silent);
+void _MMG3D_coquilFaceSecondLoopInit(MMG5_pMesh mesh,MMG5_int piv,char *iface,int *i,
+                                     MMG5_int *list,int *ilist,MMG5_int *it1,MMG5_int *pradj,
+                                     MMG5_int *adj);
+void _MMG5_coquilFaceErrorMessage(MMG5_pMesh mesh, MMG5_int k1, MMG5_int k2);
+int16_t _MMG5_coquilTravel(MMG5_pMesh, MMG5_int, MMG5_int, MMG5_int*, MMG5_int*, char*, int*);
+void _MMG5_openCoquilTravel(MMG5_pMesh, MMG5_int, MMG5_int, MMG5_int*, MMG5_int*, char*, int*);
+extern int  _MMG5_settag(MMG5_pMesh,MMG5_int,int,int16_t,int);
+extern int  _MMG5_deltag(MMG5_pMesh,MMG5_int,int,int16_t);
 int  _MMG5_setNmTag(MMG5_pMesh mesh, _MMG5_Hash *hash);
-  int  _MMG5_chkcol_int(MMG5_pMesh,MMG5_pSol,int,char,char,int*,int,char);
-  int  _MMG5_chkcol_bdy(MMG5_pMesh,MMG5_pSol,int,char,char,int*,int,int*,int,char);
-int  _MMG5_chkmanicoll(MMG5_pMesh,int,int,int,int,int,char,char);
+  int  _MMG5_chkcol_int(MMG5_pMesh,MMG5_pSol,MMG5_int,char,char,MMG5_int*,int,char);
+  int  _MMG5_chkcol_bdy(MMG5_pMesh,MMG5_pSol,MMG5_int,char,char,MMG5_int*,int,MMG5_int*,int,char);
+int  _MMG5_chkmanicoll(MMG5_pMesh,MMG5_int,int,int,MMG5_int,MMG5_int,char,char);
 int  _MMG5_chkmani(MMG5_pMesh mesh);
-int  _MMG5_colver(MMG5_pMesh,MMG5_pSol,int *,int,char,char);
+MMG5_int _MMG5_colver(MMG5_pMesh,MMG5_pSol,MMG5_int *,int,char,char);
 int  _MMG3D_analys(MMG5_pMesh mesh);
 int  _MMG3D_hashTria(MMG5_pMesh mesh, _MMG5_Hash*);
 int   MMG3D_hashPrism(MMG5_pMesh mesh);
-int  _MMG5_hashPop(_MMG5_Hash *hash,int a,int b);
+int  _MMG5_hashPop(_MMG5_Hash *hash,MMG5_int a,MMG5_int b);
 int  _MMG5_hPop(MMG5_HGeom *hash,int a,int b,int *ref,int16_t *tag);
-int  _MMG5_hTag(MMG5_HGeom *hash,int a,int b,int ref,int16_t tag);
-int  _MMG5_hGet(MMG5_HGeom *hash,int a,int b,int *ref,int16_t *tag);
-int  _MMG5_hEdge(MMG5_pMesh mesh,MMG5_HGeom *hash,int a,int b,int ref,int16_t tag);
-int  _MMG5_hNew(MMG5_pMesh mesh,MMG5_HGeom *hash,int hsiz,int hmax);
+int  _MMG5_hTag(MMG5_HGeom *hash,MMG5_int a,MMG5_int b,int ref,int16_t tag);
+int  _MMG5_hGet(MMG5_HGeom *hash,MMG5_int a,MMG5_int b,int *ref,int16_t *tag);
+int  _MMG5_hEdge(MMG5_pMesh mesh,MMG5_HGeom *hash,MMG5_int a,MMG5_int b,int ref,int16_t tag);
+int  _MMG5_hNew(MMG5_pMesh mesh,MMG5_HGeom *hash,MMG5_int hsiz,MMG5_int hmax);
 int  _MMG5_hGeom(MMG5_pMesh mesh);
 int  _MMG5_bdryIso(MMG5_pMesh );
 int  _MMG5_bdrySet(MMG5_pMesh );
@@ -288,63 +381,64 @@ int  _MMG5_chkfemtopo(MMG5_pMesh mesh);
 int  _MMG5_cntbdypt(MMG5_pMesh mesh, int nump);
 long long _MMG5_memSize(void);
 int  _MMG3D_memOption(MMG5_pMesh mesh);
+int  _MMG3D_presize(MMG5_pMesh mesh,MMG5_pSol met);
 int  _MMG5_mmg3d1_pattern(MMG5_pMesh ,MMG5_pSol );
 int  _MMG5_mmg3d1_delone(MMG5_pMesh ,MMG5_pSol );
 int  _MMG3D_mmg3d2(MMG5_pMesh ,MMG5_pSol );
 int  _MMG5_mmg3dChkmsh(MMG5_pMesh,int,int);
-int  _MMG3D_split1_sim(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6]);
-int  _MMG5_split1(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6],char metRidTyp);
-int  _MMG5_split1b(MMG5_pMesh,MMG5_pSol,int*,int,int,int,char,char);
-int  _MMG5_splitedg(MMG5_pMesh mesh, MMG5_pSol met,int iel, int iar, double crit);
-int  _MMG3D_split2sf_sim(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6]);
-int  _MMG5_split2sf(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6],char);
-int  _MMG3D_split2_sim(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6]);
-int  _MMG5_split2(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6],char);
-int  _MMG3D_split3_sim(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6]);
-int  _MMG5_split3(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6],char);
-int  _MMG3D_split3cone_sim(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6]);
-int  _MMG5_split3cone(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6],char);
-int  _MMG3D_split3op_sim(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6]);
-int  _MMG5_split3op(MMG5_pMesh mesh, MMG5_pSol met, int k, int vx[6],char);
-int  _MMG3D_split4sf_sim(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6]);
-int  _MMG5_split4sf(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6],char);
-int  _MMG3D_split4op_sim(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6]);
-int  _MMG5_split4op(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6],char);
-int  _MMG3D_split5_sim(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6]);
-int  _MMG5_split5(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6],char);
-int  _MMG3D_split6_sim(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6]);
-int  _MMG5_split6(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6],char);
-int  _MMG5_split4bar(MMG5_pMesh mesh,MMG5_pSol met,int k,char);
-int  _MMG3D_simbulgept(MMG5_pMesh mesh,MMG5_pSol met, int *list, int ilist,int);
+int  _MMG3D_split1_sim(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int vx[6]);
+int  _MMG5_split1(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int vx[6],char metRidTyp);
+int  _MMG5_split1b(MMG5_pMesh,MMG5_pSol,MMG5_int*,int,MMG5_int,int,char,char);
+MMG5_int _MMG5_splitedg(MMG5_pMesh mesh, MMG5_pSol met,int iel, int iar, double crit);
+int  _MMG3D_split2sf_sim(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int vx[6]);
+int  _MMG5_split2sf(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int vx[6],char);
+int  _MMG3D_split2_sim(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int vx[6]);
+int  _MMG5_split2(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int vx[6],char);
+int  _MMG3D_split3_sim(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int vx[6]);
+int  _MMG5_split3(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int vx[6],char);
+int  _MMG3D_split3cone_sim(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int vx[6]);
+int  _MMG5_split3cone(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int vx[6],char);
+int  _MMG3D_split3op_sim(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int vx[6]);
+int  _MMG5_split3op(MMG5_pMesh mesh, MMG5_pSol met, MMG5_int k, MMG5_int vx[6],char);
+int  _MMG3D_split4sf_sim(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int vx[6]);
+int  _MMG5_split4sf(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int vx[6],char);
+int  _MMG3D_split4op_sim(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int vx[6]);
+int  _MMG5_split4op(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int vx[6],char);
+int  _MMG3D_split5_sim(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int vx[6]);
+int  _MMG5_split5(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int vx[6],char);
+int  _MMG3D_split6_sim(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int vx[6]);
+int  _MMG5_split6(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int vx[6],char);
+MMG5_int _MMG5_split4bar(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,char);
+int  _MMG3D_simbulgept(MMG5_pMesh mesh,MMG5_pSol met, MMG5_int *list, int ilist,MMG5_int);
 void _MMG5_nsort(int ,double *,char *);
 int    _MMG3D_optlap(MMG5_pMesh ,MMG5_pSol );
-int    _MMG5_movintpt_iso(MMG5_pMesh ,MMG5_pSol,_MMG3D_pOctree, int *, int , int);
+int    _MMG5_movintpt_iso(MMG5_pMesh ,MMG5_pSol,_MMG3D_pOctree, MMG5_int *, int , int);
 int    _MMG3D_movnormal_iso(MMG5_pMesh ,MMG5_pSol ,int ,int );
 int    _MMG5_movintptLES_iso(MMG5_pMesh mesh,MMG5_pSol met,_MMG3D_pOctree,int *,int,int);
-int    _MMG5_movintpt_ani(MMG5_pMesh ,MMG5_pSol,_MMG3D_pOctree,int *,int ,int);
+int    _MMG5_movintpt_ani(MMG5_pMesh ,MMG5_pSol,_MMG3D_pOctree,MMG5_int *,int ,int);
 int    _MMG5_movbdyregpt_iso(MMG5_pMesh, MMG5_pSol,_MMG3D_pOctree,
-                             int*, int, int*, int, int ,int);
+                             MMG5_int*, int, MMG5_int*, int, int ,int);
 int    _MMG5_movbdyregpt_ani(MMG5_pMesh, MMG5_pSol,_MMG3D_pOctree,
-                             int*, int, int*, int, int ,int);
-int    _MMG5_movbdyrefpt_iso(MMG5_pMesh, MMG5_pSol,_MMG3D_pOctree, int*, int,
-                             int*, int ,int);
-int    _MMG5_movbdyrefpt_ani(MMG5_pMesh, MMG5_pSol,_MMG3D_pOctree, int*, int,
-                             int*, int ,int);
-int    _MMG5_movbdynompt_iso(MMG5_pMesh, MMG5_pSol,_MMG3D_pOctree, int*, int,
-                             int*, int ,int);
-int    _MMG5_movbdynompt_ani(MMG5_pMesh, MMG5_pSol,_MMG3D_pOctree, int*, int,
-                             int*, int ,int);
-int    _MMG5_movbdyridpt_iso(MMG5_pMesh, MMG5_pSol,_MMG3D_pOctree, int*, int,
-                             int*, int ,int);
-int    _MMG5_movbdyridpt_ani(MMG5_pMesh, MMG5_pSol,_MMG3D_pOctree, int*, int,
-                             int*, int ,int);
+                             MMG5_int*, int, MMG5_int*, int, int ,int);
+int    _MMG5_movbdyrefpt_iso(MMG5_pMesh, MMG5_pSol,_MMG3D_pOctree, MMG5_int*, int,
+                             MMG5_int*, int ,int);
+int    _MMG5_movbdyrefpt_ani(MMG5_pMesh, MMG5_pSol,_MMG3D_pOctree, MMG5_int*, int,
+                             MMG5_int*, int ,int);
+int    _MMG5_movbdynompt_iso(MMG5_pMesh, MMG5_pSol,_MMG3D_pOctree, MMG5_int*, int,
+                             MMG5_int*, int ,int);
+int    _MMG5_movbdynompt_ani(MMG5_pMesh, MMG5_pSol,_MMG3D_pOctree, MMG5_int*, int,
+                             MMG5_int*, int ,int);
+int    _MMG5_movbdyridpt_iso(MMG5_pMesh, MMG5_pSol,_MMG3D_pOctree, MMG5_int*, int,
+                             MMG5_int*, int ,int);
+int    _MMG5_movbdyridpt_ani(MMG5_pMesh, MMG5_pSol,_MMG3D_pOctree, MMG5_int*, int,
+                             MMG5_int*, int ,int);
 int    _MMG3D_movv_ani(MMG5_pMesh ,MMG5_pSol ,int ,int );
 int    _MMG3D_movv_iso(MMG5_pMesh ,MMG5_pSol ,int ,int );
-int  _MMG3D_normalAdjaTri(MMG5_pMesh,int,char,int,double n[3]);
-int  _MMG5_chkswpbdy(MMG5_pMesh, MMG5_pSol,int*, int, int, int,char);
-int  _MMG5_swpbdy(MMG5_pMesh,MMG5_pSol,int*,int,int,_MMG3D_pOctree,char);
-int  _MMG5_swpgen(MMG5_pMesh,MMG5_pSol,int, int, int*,_MMG3D_pOctree,char);
-int  _MMG5_chkswpgen(MMG5_pMesh,MMG5_pSol,int,int,int*,int*,double,char);
+int  _MMG3D_normalAdjaTri(MMG5_pMesh,MMG5_int,char,MMG5_int,double n[3]);
+int  _MMG5_chkswpbdy(MMG5_pMesh, MMG5_pSol,MMG5_int*, int, MMG5_int, MMG5_int,char);
+MMG5_int _MMG5_swpbdy(MMG5_pMesh,MMG5_pSol,MMG5_int*,int,MMG5_int,_MMG3D_pOctree,char);
+int  _MMG5_swpgen(MMG5_pMesh,MMG5_pSol,MMG5_int, int, MMG5_int*,_MMG3D_pOctree,char);
+MMG5_int _MMG5_chkswpgen(MMG5_pMesh,MMG5_pSol,MMG5_int,int,int*,MMG5_int*,double,char);
 int  MMG3D_swap23(MMG5_pMesh mesh,MMG5_pSol met,int k,char metRidTyp);
 int  _MMG5_srcface(MMG5_pMesh mesh,int n0,int n1,int n2);
 int _MMG5_chkptonbdy(MMG5_pMesh,int);
@@ -367,23 +461,24 @@ int  _MMG3D_outqua(MMG5_pMesh mesh,MMG5_pSol met);
 int  _MMG3D_prilen(MMG5_pMesh mesh,MMG5_pSol met,char);
 void _MMG3D_solTruncatureForOptim(MMG5_pMesh mesh, MMG5_pSol met);
 void _MMG5_defaultValues(MMG5_pMesh);
-int  _MMG5_intridmet(MMG5_pMesh,MMG5_pSol,int,int,double,double*,double*);
-int  _MMG5_intregmet(MMG5_pMesh,MMG5_pSol,int,char,double, double*);
-int  _MMG5_intvolmet(MMG5_pMesh,MMG5_pSol,int,char,double, double*);
-int _MMG3D_localParamReg(MMG5_pMesh,int,int*,int,int*,int,double*,double*,double*);
-int _MMG3D_localParamNm(MMG5_pMesh,int,int,int,double*,double*,double*);
+int  _MMG5_intridmet(MMG5_pMesh,MMG5_pSol,MMG5_int,MMG5_int,double,double*,double*);
+int  _MMG5_intregmet(MMG5_pMesh,MMG5_pSol,MMG5_int,char,double, double*);
+int  _MMG5_intvolmet(MMG5_pMesh,MMG5_pSol,MMG5_int,char,double, double*);
+int _MMG3D_localParamReg(MMG5_pMesh,MMG5_int,MMG5_int*,int,MMG5_int*,int,double*,double*,double*);
+int _MMG3D_localParamNm(MMG5_pMesh,MMG5_int,int,int,double*,double*,double*);
 int _MMG3D_packMesh(MMG5_pMesh,MMG5_pSol,MMG5_pSol);
 int _MMG3D_bdryBuild(MMG5_pMesh);
 
 /* useful functions to debug */
-int  _MMG3D_indElt(MMG5_pMesh mesh,int kel);
-int  _MMG3D_indPt(MMG5_pMesh mesh,int kp);
+MMG5_int _MMG3D_indElt(MMG5_pMesh mesh,MMG5_int kel);
+MMG5_int _MMG3D_indPt(MMG5_pMesh mesh,MMG5_int kp);
 void _MMG5_printTetra(MMG5_pMesh mesh,char* fileName);
 
 
 #ifdef USE_SCOTCH
 int _MMG5_mmg3dRenumbering(int vertBoxNbr, MMG5_pMesh mesh, MMG5_pSol sol);
 #endif
+int _MMG3D_sfcRenumbering(MMG5_pMesh mesh, MMG5_pSol sol);
 
 int    _MMG5_meancur(MMG5_pMesh mesh,int np,double c[3],int ilist,int *list,double h[3]);
 double _MMG5_surftri(MMG5_pMesh,int,int);
@@ -399,16 +494,20 @@ int  _MMG5_velextLS(MMG5_pMesh ,MMG5_pSol );
 int _MMG5_saveDisp(MMG5_pMesh ,MMG5_pSol );
 
 /* Delaunay functions*/
-int _MMG5_delone(MMG5_pMesh mesh,MMG5_pSol sol,int ip,int *list,int ilist);
-  int _MMG5_cavity_iso(MMG5_pMesh mesh,MMG5_pSol sol,int iel,int ip,int *list,int lon,double volmin);
-  int _MMG5_cavity_ani(MMG5_pMesh mesh,MMG5_pSol sol,int iel,int ip,int *list,int lon,double volmin);
+int _MMG5_delone(MMG5_pMesh mesh,MMG5_pSol sol,MMG5_int ip,MMG5_int *list,int ilist);
+  int _MMG5_cavity_iso(MMG5_pMesh mesh,MMG5_pSol sol,MMG5_int iel,MMG5_int ip,MMG5_int *list,int lon,double volmin);
+  int _MMG5_cavity_ani(MMG5_pMesh mesh,MMG5_pSol sol,MMG5_int iel,MMG5_int ip,MMG5_int *list,int lon,double volmin);
+int _MMG5_cavityPar_iso(MMG5_pMesh mesh,MMG5_pSol sol,_MMG3D_cavMark *cm,MMG5_int ip,MMG5_int *list,int lon,double volmin);
+int _MMG5_cavityPar_ani(MMG5_pMesh mesh,MMG5_pSol sol,_MMG3D_cavMark *cm,MMG5_int ip,MMG5_int *list,int lon,double volmin);
+int  _MMG3D_newSphere(MMG5_pMesh mesh);
+void _MMG3D_freeSphere(MMG5_pMesh mesh);
 int _MMG5_cenrad_iso(MMG5_pMesh mesh,double *ct,double *c,double *rad);
 int _MMG5_cenrad_ani(MMG5_pMesh mesh,double *ct,double *m,double *c,double *rad);
 
 /* mmg3d1.c */
-void _MMG5_tet2tri(MMG5_pMesh mesh,int k,char ie,MMG5_Tria *ptt);
-int  _MMG3D_dichoto(MMG5_pMesh mesh,MMG5_pSol met,int k,int *vx);
-int  _MMG3D_dichoto1b(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ret,int);
+void _MMG5_tet2tri(MMG5_pMesh mesh,MMG5_int k,char ie,MMG5_Tria *ptt);
+int  _MMG3D_dichoto(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int *vx);
+int  _MMG3D_dichoto1b(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int *list,int ret,MMG5_int);
 char _MMG5_chkedg(MMG5_pMesh mesh,MMG5_Tria *pt,char ori,double,double,int);
 int  _MMG5_anatet(MMG5_pMesh mesh,MMG5_pSol met, char typchk, int patternMode) ;
 int  _MMG5_movtet(MMG5_pMesh mesh,MMG5_pSol met,_MMG3D_pOctree octree,
@@ -423,37 +522,21 @@ void  _MMG5_Init_parameters(MMG5_pMesh mesh);
 /* iso/aniso computations */
 double _MMG5_caltet33_ani(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTetra pt);
 extern double _MMG5_lenedgCoor_iso(double*, double*, double*, double*);
-int    _MMG5_intmet_iso(MMG5_pMesh,MMG5_pSol,int,char,int, double);
-int    _MMG5_intmet_ani(MMG5_pMesh,MMG5_pSol,int,char,int, double);
-int    _MMG3D_intmet33_ani(MMG5_pMesh,MMG5_pSol,int,char,int, double);
-int    _MMG5_interp4bar_ani(MMG5_pMesh,MMG5_pSol,int,int,double *);
-int    _MMG5_interp4bar33_ani(MMG5_pMesh,MMG5_pSol,int,int,double *);
-int    _MMG5_interp4bar_iso(MMG5_pMesh,MMG5_pSol,int,int,double *);
+int    _MMG5_intmet_iso(MMG5_pMesh,MMG5_pSol,MMG5_int,char,MMG5_int, double);
+int    _MMG5_intmet_ani(MMG5_pMesh,MMG5_pSol,MMG5_int,char,MMG5_int, double);
+int    _MMG3D_intmet33_ani(MMG5_pMesh,MMG5_pSol,MMG5_int,char,MMG5_int, double);
+int    _MMG5_interp4bar_ani(MMG5_pMesh,MMG5_pSol,MMG5_int,MMG5_int,double *);
+int    _MMG5_interp4bar33_ani(MMG5_pMesh,MMG5_pSol,MMG5_int,MMG5_int,double *);
+int    _MMG5_interp4bar_iso(MMG5_pMesh,MMG5_pSol,MMG5_int,MMG5_int,double *);
 int    _MMG3D_defsiz_iso(MMG5_pMesh,MMG5_pSol );
 int    _MMG3D_defsiz_ani(MMG5_pMesh ,MMG5_pSol );
 int    _MMG5_gradsiz_iso(MMG5_pMesh ,MMG5_pSol );
 int    _MMG5_gradsiz_ani(MMG5_pMesh ,MMG5_pSol );
-double     _MMG5_meansizreg_iso(MMG5_pMesh,MMG5_pSol,int,int*,int,double,double);
+double     _MMG5_meansizreg_iso(MMG5_pMesh,MMG5_pSol,MMG5_int,MMG5_int*,int,double,double);
 int        _MMG3D_chk4ridVertices(MMG5_pMesh mesh,MMG5_pTetra pt);
 extern int _MMG5_moymet(MMG5_pMesh ,MMG5_pSol ,MMG5_pTetra ,double *);
 
 
-double (*_MMG5_lenedg)(MMG5_pMesh ,MMG5_pSol ,int, MMG5_pTetra );
-double (*_MMG5_lenedgspl)(MMG5_pMesh ,MMG5_pSol ,int, MMG5_pTetra );
-double (*_MMG5_caltet)(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTetra pt);
-double (*_MMG5_caltri)(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTria ptt);
-int    (*_MMG5_defsiz)(MMG5_pMesh ,MMG5_pSol );
-int    (*_MMG5_gradsiz)(MMG5_pMesh ,MMG5_pSol );
-int    (*_MMG5_intmet)(MMG5_pMesh,MMG5_pSol,int,char,int, double);
-int    (*_MMG5_interp4bar)(MMG5_pMesh,MMG5_pSol,int,int,double *);
-int    (*_MMG5_movintpt)(MMG5_pMesh ,MMG5_pSol, _MMG3D_pOctree ,int *, int , int );
-int    (*_MMG5_movbdyregpt)(MMG5_pMesh, MMG5_pSol, _MMG3D_pOctree ,int*, int, int*, int, int ,int);
-int    (*_MMG5_movbdyrefpt)(MMG5_pMesh, MMG5_pSol, _MMG3D_pOctree ,int*, int, int*, int ,int);
-int    (*_MMG5_movbdynompt)(MMG5_pMesh, MMG5_pSol, _MMG3D_pOctree ,int*, int, int*, int ,int);
-int    (*_MMG5_movbdyridpt)(MMG5_pMesh, MMG5_pSol, _MMG3D_pOctree ,int*, int, int*, int ,int);
-  int    (*_MMG5_cavity)(MMG5_pMesh ,MMG5_pSol ,int ,int ,int *,int ,double);
-  int    (*_MMG3D_octreein)(MMG5_pMesh ,MMG5_pSol ,_MMG3D_pOctree ,int,double );
-
 /**
  * \param mesh pointer toward the mesh structure.
  *
@@ -464,7 +547,7 @@ static inline
 void _MMG5_warnOrientation(MMG5_pMesh mesh) {
   if ( mesh->xt ) {
     if ( mesh->xt != mesh->ne ) {
-      fprintf(stderr,"\n  ## Warning: %s: %d tetra on %d reoriented.\n",
+      fprintf(stderr,"\n  ## Warning: %s: %" MMG5_PRId " tetra on %" MMG5_PRId " reoriented.\n",
               __func__,mesh->xt,mesh->ne);
       fprintf(stderr,"  Your mesh may be non-conform.\n");
     }
@@ -476,18 +559,35 @@ void _MMG5_warnOrientation(MMG5_pMesh mesh) {
 }
 
 /**
+ * \param mesh pointer toward the mesh structure.
+ * \param k index of a tetra.
+ *
+ * Unset the cached circumsphere and edge lengths of the tetra \a k (to call
+ * when the vertices of \a k are modified).
+ *
+ */
+static inline
+void _MMG3D_unsetCache(MMG5_pMesh mesh,MMG5_int k) {
+  if ( mesh->sph && k <= mesh->sphmax )  mesh->sph[k].v[0] = 0;
+  if ( mesh->ledg && k <= mesh->ledgmax )  mesh->ledg[k].v[0] = 0;
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ *
  * Set common pointer functions between mmgs and mmg3d to the matching mmg3d
  * functions.
  */
 static inline
-void _MMG3D_Set_commonFunc() {
-  _MMG5_bezierCP          = _MMG5_mmg3dBezierCP;
-  _MMG5_chkmsh            = _MMG5_mmg3dChkmsh;
-  _MMG5_indPt             = _MMG3D_indPt;
-  _MMG5_indElt            = _MMG3D_indElt;
+void _MMG3D_Set_commonFunc(MMG5_pMesh mesh) {
+  mesh->func.bezierCP     = _MMG5_mmg3dBezierCP;
+  mesh->func.chkmsh       = _MMG5_mmg3dChkmsh;
+  mesh->func.indPt        = _MMG3D_indPt;
+  mesh->func.indElt       = _MMG3D_indElt;
+  mesh->func.sfcRenumbering = _MMG3D_sfcRenumbering;
 
 #ifdef USE_SCOTCH
-  _MMG5_renumbering       = _MMG5_mmg3dRenumbering;
+  mesh->func.renumbering  = _MMG5_mmg3dRenumbering;
 #endif
 }
 
@@ -38,7 +38,16 @@
 
 #include "inlined_functions_3d.h"
 
-char  ddb;
+#ifdef _OPENMP
+#include <omp.h>
+
+/* number of tetra screened per chunk in the parallel swap of internal edges,
+ * in the parallel collapse and in the parallel analysis of boundary tetra */
+#define _MMG3D_NSWPPAR  4096
+#define _MMG3D_NCOLPAR  4096
+#define _MMG3D_NANAPAR  4096
+#endif
+
 
 /**
  * \param mesh pointer toward the mesh structure.
@@ -49,7 +58,7 @@ char  ddb;
  * Set triangle corresponding to face ie of tetra k.
  *
  */
-void _MMG5_tet2tri(MMG5_pMesh mesh,int k,char ie,MMG5_Tria *ptt) {
+void _MMG5_tet2tri(MMG5_pMesh mesh,MMG5_int k,char ie,MMG5_Tria *ptt) {
   MMG5_pTetra  pt;
   MMG5_pxTetra pxt;
   char    i;
@@ -85,12 +94,13 @@ void _MMG5_tet2tri(MMG5_pMesh mesh,int k,char ie,MMG5_Tria *ptt) {
  * Find acceptable position for splitting.
  *
  */
-int _MMG3D_dichoto(MMG5_pMesh mesh,MMG5_pSol met,int k,int *vx) {
+int _MMG3D_dichoto(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int *vx) {
   MMG5_pTetra  pt;
   MMG5_pPoint  pa,pb,ps;
   double       o[6][3],p[6][3];
   float        to,tp,t;
-  int          ia,ib,ier,it,maxit;
+  int          ier,it,maxit;
+  MMG5_int     ia,ib;
   char         i;
 
   pt = &mesh->tetra[k];
@@ -232,10 +242,11 @@ int _MMG3D_dichoto(MMG5_pMesh mesh,MMG5_pSol met,int k,int *vx) {
  * considered edge, starting from o point.
  *
  */
-int _MMG3D_dichoto1b(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ret,int ip) {
+int _MMG3D_dichoto1b(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int *list,int ret,MMG5_int ip) {
   MMG5_pTetra  pt;
   MMG5_pPoint  p0,p1,ppt;
-  int          iel,np,nq,it,maxit;
+  int          it,maxit;
+  MMG5_int     np,nq,iel;
   double       m[3],o[3],tp,to,t;
   char         ia,ier;
 
@@ -307,9 +318,10 @@ char _MMG5_chkedg(MMG5_pMesh mesh,MMG5_Tria *pt,char ori, double hmax,
 //  MMG5_pPar     par;
   double   n[3][3],t[3][3],nt[3],*n1,*n2,t1[3],t2[3];
   double   ps,ps2,ux,uy,uz,ll,il,alpha,dis,hma2;
-  int      ia,ib,ic;//l,info;
+  //l,info;
+  MMG5_int ia,ib,ic;
   char     i,i1,i2;
-  static char mmgWarn0 = 0, mmgWarn1 = 0;
+  static _MMG5_TLS char mmgWarn0 = 0, mmgWarn1 = 0;
 
   ia   = pt->v[0];
   ib   = pt->v[1];
@@ -534,7 +546,8 @@ char _MMG5_chkedg(MMG5_pMesh mesh,MMG5_Tria *pt,char ori, double hmax,
 int _MMG5_swpmsh(MMG5_pMesh mesh,MMG5_pSol met,_MMG3D_pOctree octree, int typchk) {
   MMG5_pTetra   pt;
   MMG5_pxTetra  pxt;
-  int      k,it,list[MMG3D_LMAX+2],ilist,ret,it1,it2,ns,nns,maxit;
+  int      it,ilist,ret,ns,nns,maxit;
+  MMG5_int k,list[MMG3D_LMAX+2],it1,it2;
   char     i,j,ia,ier;
 
   it = nns = 0;
@@ -585,6 +598,121 @@ int _MMG5_swpmsh(MMG5_pMesh mesh,MMG5_pSol met,_MMG3D_pOctree octree, int typchk
   return(nns);
 }
 
+#ifdef _OPENMP
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param met pointer toward the metric structure.
+ * \param crit coefficient of quality improvment.
+ * \param declic quality threshold of the tetra to process.
+ * \param octree pointer toward the octree structure in delaunay mode and
+ * toward the \a NULL pointer otherwise
+ * \param typchk type of checking permformed for edge length (hmin or LSHORT
+ * criterion).
+ * \param nns pointer to store the number of swapped edges.
+ * \return 1 if success, 0 if the memory is not sufficient (nothing is done),
+ * -1 if fail.
+ *
+ * Parallel version of \ref _MMG5_swptet. The tetra are processed by chunks of
+ * \ref _MMG3D_NSWPPAR elements: the first swappable edge of each tetra is
+ * searched in parallel without modifying the mesh (\ref _MMG5_chkswpgen), then
+ * the swaps are checked again and performed sequentially, in the order of the
+ * tetra, from this edge. The expensive rejection of the unswappable edges is
+ * thus shared between the threads and the result doesn't depend on the number
+ * of threads.
+ *
+ */
+static int
+_MMG5_swptetPar(MMG5_pMesh mesh,MMG5_pSol met,double crit,double declic,
+                _MMG3D_pOctree octree,int typchk,int *nns) {
+  MMG5_pTetra   pt;
+  MMG5_pxTetra  pxt;
+  long long     memsiz;
+  int           *cedg,ilist,it,maxit,ns,nth,tid,ier;
+  MMG5_int      nconf,list[MMG3D_LMAX+2],*lists,*lst,k,k0,k1;
+  char          i;
+
+  nth   = mesh->info.nthreads;
+  maxit = 2;
+  it    = *nns = 0;
+  ier   = 1;
+
+  memsiz = _MMG3D_NSWPPAR*sizeof(int) + nth*(MMG3D_LMAX+2)*sizeof(MMG5_int);
+  _MMG5_ADD_MEM(mesh,memsiz,"parallel swap",return(0));
+  _MMG5_SAFE_CALLOC(cedg,_MMG3D_NSWPPAR,int,0);
+  _MMG5_SAFE_CALLOC(lists,nth*(MMG3D_LMAX+2),MMG5_int,0);
+
+  do {
+    ns = 0;
+    for (k0=1; k0<=mesh->ne; k0+=_MMG3D_NSWPPAR) {
+      k1 = MG_MIN(mesh->ne+1,k0+_MMG3D_NSWPPAR);
+
+      /* 1) first swappable edge of the tetra of the chunk */
+#pragma omp parallel for num_threads(nth) schedule(dynamic,64) \
+  private(tid,lst,pt,pxt,i,ilist)
+      for (k=k0; k<k1; k++) {
+        tid = omp_get_thread_num();
+        lst = &lists[tid*(MMG3D_LMAX+2)];
+
+        cedg[k-k0] = -1;
+        pt = &mesh->tetra[k];
+        if ( !MG_EOK(pt) || (pt->tag & MG_REQ) )  continue;
+        else if ( pt->mark < mesh->mark-2 )  continue;
+
+        if ( pt->qual > declic )  continue;
+
+        for (i=0; i<6; i++) {
+          if ( pt->xt ) {
+            pxt = &mesh->xtetra[pt->xt];
+            if ( pxt->edg[i] || pxt->tag[i] ) continue;
+          }
+          if ( _MMG5_chkswpgen(mesh,met,k,i,&ilist,lst,crit,typchk) ) {
+            cedg[k-k0] = i;
+            break;
+          }
+        }
+      }
+
+      /* 2) swaps, the previous swaps of the chunk may have modified the
+       * shells */
+      for (k=k0; k<k1; k++) {
+        if ( cedg[k-k0] < 0 )  continue;
+
+        pt = &mesh->tetra[k];
+        if ( !MG_EOK(pt) || (pt->tag & MG_REQ) )  continue;
+        else if ( pt->mark < mesh->mark-2 )  continue;
+
+        if ( pt->qual > declic )  continue;
+
+        for (i=cedg[k-k0]; i<6; i++) {
+          if ( pt->xt ) {
+            pxt = &mesh->xtetra[pt->xt];
+            if ( pxt->edg[i] || pxt->tag[i] ) continue;
+          }
+
+          nconf = _MMG5_chkswpgen(mesh,met,k,i,&ilist,list,crit,typchk);
+          if ( nconf ) {
+            ier = _MMG5_swpgen(mesh,met,nconf,ilist,list,octree,typchk);
+            if ( ier > 0 )  ns++;
+            else if ( ier < 0 )  goto end;
+            break;
+          }
+        }
+        ier = 1;
+      }
+    }
+    *nns += ns;
+  }
+  while ( ++it < maxit && ns > 0 );
+
+end:
+  _MMG5_SAFE_FREE(cedg);
+  _MMG5_SAFE_FREE(lists);
+  mesh->memCur -= memsiz;
+
+  return(ier);
+}
+#endif
+
 /**
  * \param mesh pointer toward the mesh structure.
  * \param met pointer toward the metric structure.
@@ -601,12 +729,21 @@ int _MMG5_swptet(MMG5_pMesh mesh,MMG5_pSol met,double crit,double declic,
                  _MMG3D_pOctree octree,int typchk) {
   MMG5_pTetra   pt;
   MMG5_pxTetra  pxt;
-  int      list[MMG3D_LMAX+2],ilist,k,it,nconf,maxit,ns,nns,ier;
+  int      ilist,it,maxit,ns,nns,ier;
+  MMG5_int nconf,list[MMG3D_LMAX+2],k;
   char     i;
 
   maxit = 2;
   it = nns = 0;
 
+#ifdef _OPENMP
+  if ( mesh->info.nthreads > 1 ) {
+    ier = _MMG5_swptetPar(mesh,met,crit,declic,octree,typchk,&nns);
+    if ( ier < 0 )  return(-1);
+    else if ( ier )  goto end;
+  }
+#endif
+
   do {
     ns = 0;
     for (k=1; k<=mesh->ne; k++) {
@@ -635,12 +772,277 @@ int _MMG5_swptet(MMG5_pMesh mesh,MMG5_pSol met,double crit,double declic,
     nns += ns;
   }
   while ( ++it < maxit && ns > 0 );
+
+#ifdef _OPENMP
+end:
+#endif
   if ( (abs(mesh->info.imprim) > 5 || mesh->info.ddebug) && nns > 0 )
     fprintf(stdout,"     %8d edge swapped\n",nns);
 
   return(nns);
 }
 
+#ifdef _OPENMP
+/** Working arrays of the parallel relocation of the internal points */
+typedef struct {
+  MMG5_int *vtet,*tet; /*!< volumic balls of the points (\ref _MMG3D_pointTetra) */
+  uint64_t *cmask;     /*!< colours of the points already coloured, by tetra */
+  int      *col;       /*!< colour of each point, -1 if it is not moved */
+  MMG5_int *cand;      /*!< candidate points in the order of their colouring */
+  MMG5_int *lst;       /*!< candidate points sorted by colour */
+  MMG5_int *vis;       /*!< tetra from which each candidate is visited */
+  double   *oldc;      /*!< initial coordinates of the candidate points */
+} _MMG3D_movPar;
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param tk pointer toward the working arrays.
+ * \return 1 if success, 0 if the memory is not sufficient.
+ *
+ * Allocate the working arrays of \ref _MMG3D_movintptPar. Nothing is allocated
+ * if the authorized memory is too small (the sequential relocation is then
+ * used).
+ *
+ */
+static int _MMG3D_newMovPar(MMG5_pMesh mesh,_MMG3D_movPar *tk) {
+  long long msiz;
+
+  msiz = (long long)(mesh->ne+1)*sizeof(uint64_t)
+    + (long long)(mesh->np+1)*(sizeof(int)+3*sizeof(MMG5_int)+3*sizeof(double));
+  if ( mesh->memCur + msiz > mesh->memMax )  return(0);
+
+  if ( !_MMG3D_pointTetra(mesh,0,&tk->vtet,&tk->tet) )  return(0);
+
+  _MMG5_ADD_MEM(mesh,msiz,"parallel relocation",
+                _MMG5_DEL_MEM(mesh,tk->tet,MG_MAX(1,tk->vtet[mesh->np+1])*sizeof(MMG5_int));
+                _MMG5_DEL_MEM(mesh,tk->vtet,(mesh->np+2)*sizeof(MMG5_int));
+                return(0));
+  _MMG5_SAFE_CALLOC(tk->cmask,mesh->ne+1,uint64_t,0);
+  _MMG5_SAFE_MALLOC(tk->col,mesh->np+1,int,0);
+  _MMG5_SAFE_MALLOC(tk->cand,mesh->np+1,MMG5_int,0);
+  _MMG5_SAFE_MALLOC(tk->lst,mesh->np+1,MMG5_int,0);
+  _MMG5_SAFE_MALLOC(tk->vis,mesh->np+1,MMG5_int,0);
+  _MMG5_SAFE_MALLOC(tk->oldc,3*(mesh->np+1),double,0);
+
+  return(1);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param tk pointer toward the working arrays.
+ *
+ * Free the working arrays of \ref _MMG3D_movintptPar.
+ *
+ */
+static void _MMG3D_freeMovPar(MMG5_pMesh mesh,_MMG3D_movPar *tk) {
+
+  _MMG5_DEL_MEM(mesh,tk->oldc,3*(mesh->np+1)*sizeof(double));
+  _MMG5_DEL_MEM(mesh,tk->vis,(mesh->np+1)*sizeof(MMG5_int));
+  _MMG5_DEL_MEM(mesh,tk->lst,(mesh->np+1)*sizeof(MMG5_int));
+  _MMG5_DEL_MEM(mesh,tk->cand,(mesh->np+1)*sizeof(MMG5_int));
+  _MMG5_DEL_MEM(mesh,tk->col,(mesh->np+1)*sizeof(int));
+  _MMG5_DEL_MEM(mesh,tk->cmask,(mesh->ne+1)*sizeof(uint64_t));
+  _MMG5_DEL_MEM(mesh,tk->tet,MG_MAX(1,tk->vtet[mesh->np+1])*sizeof(MMG5_int));
+  _MMG5_DEL_MEM(mesh,tk->vtet,(mesh->np+2)*sizeof(MMG5_int));
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param ip index of an internal point.
+ * \param vtet pointer toward the position of the balls in \a tet.
+ * \param tet pointer toward the volumic balls.
+ * \param clickVol tetra quality threshold under which we want to move.
+ * \param k0 index of the tetra reached by the sweep.
+ * \return the smallest index greater than \a k0 of the tetra of the ball of
+ * \a ip that we want to improve, 0 if none.
+ *
+ * The sweep of \ref _MMG5_movtet visits the point \a ip from the returned
+ * tetra.
+ *
+ */
+static inline
+MMG5_int _MMG3D_movintptCand(MMG5_pMesh mesh,MMG5_int ip,MMG5_int *vtet,
+                             MMG5_int *tet,double clickVol,MMG5_int k0) {
+  MMG5_pTetra pt;
+  MMG5_int    l,k,kmin;
+
+  kmin = 0;
+  for (l=vtet[ip]; l<vtet[ip+1]; l++) {
+    k  = tet[l];
+    pt = &mesh->tetra[k];
+    if ( k <= k0 || (kmin && k >= kmin) )  continue;
+    else if ( pt->ref < 0 || (pt->tag & MG_REQ) )  continue;
+    else if ( pt->mark < mesh->mark-2 )  continue;
+    if ( pt->qual < clickVol )  kmin = k;
+  }
+  return(kmin);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param met pointer toward the metric structure.
+ * \param octree pointer toward the octree structure.
+ * \param tk pointer toward the working arrays.
+ * \param clickVol tetra quality threshold under which we want to move.
+ * \param improveVol forbid volume degradation during the move.
+ * \param base flag of the points already processed during the sweep.
+ * \param maxit maximum number of sweeps of \ref _MMG5_movtet.
+ * \return the number of moved points.
+ *
+ * Parallel relocation of the internal points (one sweep). The points that
+ * belong to a tetra of quality lower than \a clickVol are coloured (greedily,
+ * in the order of the points) so that two points of a same colour never share
+ * a tetra. The points of a colour don't read nor modify the ball of each
+ * other, so they are moved concurrently, one colour after the other. As in
+ * the sequential sweep, the moves mark the tetra of the balls, which makes
+ * new points eligible if the sweep has not yet reached the marked tetra: they
+ * are searched in the balls of the moved points, coloured and moved in the
+ * same way, until no point moves. The processed points are flagged with
+ * \a base (only the moved ones if \a maxit is 1). The result doesn't depend
+ * on the number of threads. The octree is updated after each group of
+ * colours.
+ *
+ */
+static int _MMG3D_movintptPar(MMG5_pMesh mesh,MMG5_pSol met,_MMG3D_pOctree octree,
+                              _MMG3D_movPar *tk,double clickVol,int improveVol,
+                              unsigned char base,int maxit) {
+  MMG5_pPoint  ppt;
+  MMG5_pTetra  pt;
+  uint64_t     msk;
+  MMG5_int     listv[MMG3D_LMAX+2],ip,iq,l,k,n,nc[67],ncand;
+  int          ilistv,nth,c,ncol,nm,nmc;
+  char         i0,j;
+
+  nth = mesh->info.nthreads;
+
+  /* 1) candidates: the internal points of the tetra that we want to improve */
+#pragma omp parallel for num_threads(nth) schedule(dynamic,1024) private(ppt)
+  for (ip=1; ip<=mesh->np; ip++) {
+    ppt = &mesh->point[ip];
+    tk->col[ip] = -1;
+    if ( !MG_VOK(ppt) || MG_SIN(ppt->tag) || (ppt->tag & MG_BDY) )  continue;
+    else if ( ppt->flag == base )  continue;
+    tk->vis[ip] = _MMG3D_movintptCand(mesh,ip,tk->vtet,tk->tet,clickVol,0);
+    if ( tk->vis[ip] )  tk->col[ip] = 0;
+  }
+  ncand = 0;
+  for (ip=1; ip<=mesh->np; ip++) {
+    if ( !tk->col[ip] )  tk->cand[ncand++] = ip;
+  }
+
+  nm = 0;
+  while ( ncand ) {
+    /* 2) greedy colouring: the colour 64 gathers the points that can't be
+     * coloured, they are moved sequentially */
+    memset(nc,0,67*sizeof(MMG5_int));
+    ncol = 0;
+    for (n=0; n<ncand; n++) {
+      ip  = tk->cand[n];
+      msk = 0;
+      for (l=tk->vtet[ip]; l<tk->vtet[ip+1]; l++)
+        msk |= tk->cmask[tk->tet[l]];
+      for (c=0; c<64; c++)
+        if ( !(msk & ((uint64_t)1 << c)) )  break;
+      if ( c < 64 ) {
+        for (l=tk->vtet[ip]; l<tk->vtet[ip+1]; l++)
+          tk->cmask[tk->tet[l]] |= (uint64_t)1 << c;
+      }
+      tk->col[ip] = c;
+      nc[c+2]++;
+      ncol = MG_MAX(ncol,c+1);
+    }
+    for (c=0; c<ncol; c++)
+      nc[c+2] += nc[c+1];
+    for (n=0; n<ncand; n++) {
+      ip = tk->cand[n];
+      tk->lst[nc[tk->col[ip]+1]++] = ip;
+      /* the colours are valid for this group only */
+      for (l=tk->vtet[ip]; l<tk->vtet[ip+1]; l++)
+        tk->cmask[tk->tet[l]] = 0;
+    }
+
+    /* 3) relocation, colour by colour (the balls don't change): the moved
+     * points are marked by a colour of -2 */
+    nmc = 0;
+    for (c=0; c<ncol; c++) {
+#pragma omp parallel for num_threads(c<64 ? nth : 1) schedule(dynamic,64) \
+  private(ip,ppt,pt,l,k,i0,listv,ilistv) reduction(+:nmc)
+      for (n=nc[c]; n<nc[c+1]; n++) {
+        ip  = tk->lst[n];
+        ppt = &mesh->point[ip];
+        memcpy(&tk->oldc[3*n],ppt->c,3*sizeof(double));
+        tk->col[ip] = -1;
+        if ( maxit != 1 )  ppt->flag = base;
+
+        /* the qualities may have been modified by the previous colours */
+        if ( !_MMG3D_movintptCand(mesh,ip,tk->vtet,tk->tet,clickVol,
+                                  tk->vis[ip]-1) )  continue;
+
+        ilistv = 0;
+        for (l=tk->vtet[ip]; l<tk->vtet[ip+1]; l++) {
+          /* overflow */
+          if ( ilistv > MMG3D_LMAX-3 )  break;
+          k  = tk->tet[l];
+          pt = &mesh->tetra[k];
+          for (i0=0; i0<4; i0++)
+            if ( pt->v[i0] == ip )  break;
+          assert(i0<4);
+          listv[ilistv++] = 4*k+i0;
+        }
+        if ( l < tk->vtet[ip+1] )  continue;
+
+        if ( mesh->func.movintpt(mesh,met,NULL,listv,ilistv,improveVol) ) {
+          ppt->flag   = base;
+          tk->col[ip] = -2;
+          nmc++;
+        }
+      }
+    }
+    nm += nmc;
+
+    /* 4) octree update */
+    if ( octree ) {
+      for (n=0; n<ncand; n++) {
+        ppt = &mesh->point[tk->lst[n]];
+        if ( memcmp(&tk->oldc[3*n],ppt->c,3*sizeof(double)) )
+          _MMG3D_moveOctree(mesh,octree,tk->lst[n],ppt->c,&tk->oldc[3*n]);
+      }
+    }
+
+    /* 5) new candidates: the points of the balls of the moved points, whose
+     * tetra have been marked, visited from a tetra that follows the one of
+     * the moved point */
+    n = ncand;
+    ncand = 0;
+    if ( !nmc )  break;
+    for (l=0; l<n; l++) {
+      ip = tk->lst[l];
+      if ( tk->col[ip] != -2 )  continue;
+      for (k=tk->vtet[ip]; k<tk->vtet[ip+1]; k++) {
+        pt = &mesh->tetra[tk->tet[k]];
+        for (j=0; j<4; j++) {
+          iq  = pt->v[j];
+          ppt = &mesh->point[iq];
+          if ( tk->col[iq] != -1 )  continue;
+          else if ( MG_SIN(ppt->tag) || (ppt->tag & MG_BDY) )  continue;
+          else if ( ppt->flag == base )  continue;
+          tk->vis[iq] = _MMG3D_movintptCand(mesh,iq,tk->vtet,tk->tet,clickVol,
+                                            tk->vis[ip]);
+          if ( tk->vis[iq] ) {
+            tk->col[iq] = 0;
+            tk->cand[ncand++] = iq;
+          }
+        }
+      }
+    }
+    for (l=0; l<n; l++)
+      tk->col[tk->lst[l]] = -1;
+  }
+
+  return(nm);
+}
+#endif
+
 /**
  * \param mesh pointer toward the mesh structure.
  * \param met pointer toward the metric structure.
@@ -665,12 +1067,24 @@ int _MMG5_movtet(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree,
   MMG5_pxTetra       pxt;
   MMG5_Tria          tt;
   double        *n,caltri;
-  int           i,k,ier,nm,nnm,ns,lists[MMG3D_LMAX+2],listv[MMG3D_LMAX+2],ilists,ilistv,it;
+  int           i,ier,nm,nnm,ns,ilists,ilistv,it;
+  MMG5_int      lists[MMG3D_LMAX+2],listv[MMG3D_LMAX+2],k;
   unsigned char j,i0,base;
+  char          par;
+#ifdef _OPENMP
+  _MMG3D_movPar tk;
+#endif
 
   if ( abs(mesh->info.imprim) > 5 || mesh->info.ddebug )
     fprintf(stdout,"  ** OPTIMIZING MESH\n");
 
+  /* the internal points are moved by the parallel sweep */
+  par = 0;
+#ifdef _OPENMP
+  if ( mesh->info.nthreads > 1 && moveVol )
+    par = _MMG3D_newMovPar(mesh,&tk);
+#endif
+
   base = 1;
   for (k=1; k<=mesh->np; k++)
     mesh->point[k].flag = base;
@@ -696,10 +1110,11 @@ int _MMG5_movtet(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree,
           ppt = &mesh->point[pt->v[i0]];
           if ( ppt->flag == base )  continue;
           else if ( MG_SIN(ppt->tag) )  continue;
+          else if ( par && !(ppt->tag & MG_BDY) )  continue;
 
           if( pt->xt && (pxt->ftag[i] & MG_BDY)) {
             _MMG5_tet2tri(mesh,k,i,&tt);
-            caltri = _MMG5_caltri(mesh,met,&tt);
+            caltri = mesh->func.caltri(mesh,met,&tt);
 
             if ( caltri >= clickSurf) {
               j = 3;
@@ -718,33 +1133,33 @@ int _MMG5_movtet(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree,
               ier=_MMG5_boulesurfvolp(mesh,k,i0,i,listv,&ilistv,lists,&ilists,1);
               if( !ier )  continue;
               else if ( ier>0 )
-                ier = _MMG5_movbdynompt(mesh,met,octree,listv,ilistv,lists,ilists,improveVolSurf);
+                ier = mesh->func.movbdynompt(mesh,met,octree,listv,ilistv,lists,ilists,improveVolSurf);
               else
-                return(-1);
+                goto failed;
             }
             else if ( ppt->tag & MG_GEO ) {
               ier=_MMG5_boulesurfvolp(mesh,k,i0,i,listv,&ilistv,lists,&ilists,0);
               if ( !ier )  continue;
               else if ( ier>0 )
-                ier = _MMG5_movbdyridpt(mesh,met,octree,listv,ilistv,lists,ilists,improveVolSurf);
+                ier = mesh->func.movbdyridpt(mesh,met,octree,listv,ilistv,lists,ilists,improveVolSurf);
               else
-                return(-1);
+                goto failed;
             }
             else if ( ppt->tag & MG_REF ) {
               ier=_MMG5_boulesurfvolp(mesh,k,i0,i,listv,&ilistv,lists,&ilists,0);
               if ( !ier )
                 continue;
               else if ( ier>0 )
-                ier = _MMG5_movbdyrefpt(mesh,met,octree,listv,ilistv,lists,ilists,improveVolSurf);
+                ier = mesh->func.movbdyrefpt(mesh,met,octree,listv,ilistv,lists,ilists,improveVolSurf);
               else
-                return(-1);
+                goto failed;
             }
             else {
               ier=_MMG5_boulesurfvolp(mesh,k,i0,i,listv,&ilistv,lists,&ilists,0);
               if ( !ier )
                 continue;
               else if ( ier<0 )
-                return(-1);
+                goto failed;
 
               n = &(mesh->xpoint[ppt->xp].n1[0]);
               // if ( MG_GET(pxt->ori,i) ) {
@@ -758,16 +1173,16 @@ int _MMG5_movtet(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree,
                 if ( !_MMG5_directsurfball(mesh,pt->v[i0],lists,ilists,n) )
                   continue;
               }
-              ier = _MMG5_movbdyregpt(mesh,met,octree,listv,ilistv,
+              ier = mesh->func.movbdyregpt(mesh,met,octree,listv,ilistv,
                                       lists,ilists,improveSurf,improveVolSurf);
-              if (ier < 0 ) return -1;
+              if (ier < 0 ) goto failed;
               else if ( ier )  ns++;
             }
           }
           else if ( moveVol && (pt->qual < clickVol) ) {
             ilistv = _MMG5_boulevolp(mesh,k,i0,listv);
             if ( !ilistv )  continue;
-            ier = _MMG5_movintpt(mesh,met,octree,listv,ilistv,improveVol);
+            ier = mesh->func.movintpt(mesh,met,octree,listv,ilistv,improveVol);
           }
           if ( ier ) {
             nm++;
@@ -778,17 +1193,92 @@ int _MMG5_movtet(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree,
         }
       }
     }
+#ifdef _OPENMP
+    if ( par )
+      nm += _MMG3D_movintptPar(mesh,met,octree,&tk,clickVol,improveVol,
+                               base,maxit);
+#endif
     nnm += nm;
     if ( mesh->info.ddebug )  fprintf(stdout,"     %8d moved, %d geometry\n",nm,ns);
   }
   while( ++it < maxit && nm > 0 );
 
+#ifdef _OPENMP
+  if ( par )  _MMG3D_freeMovPar(mesh,&tk);
+#endif
+
   if ( (abs(mesh->info.imprim) > 5 || mesh->info.ddebug) && nnm )
     fprintf(stdout,"     %8d vertices moved, %d iter.\n",nnm,it);
 
   return(nnm);
+
+failed:
+#ifdef _OPENMP
+  if ( par )  _MMG3D_freeMovPar(mesh,&tk);
+#endif
+  return(-1);
 }
 
+#ifdef _OPENMP
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param met pointer toward the metric structure.
+ * \param typchk type of checking permformed for edge length (hmin or LSHORT criterion).
+ * \param k0 first tetra of the chunk.
+ * \param k1 tetra following the last tetra of the chunk.
+ * \param cshrt pointer to store the short edges of the tetra.
+ * \param cv pointer to store the vertices of the tetra.
+ *
+ * Parallel search of the short edges of the internal tetra \a k0 to \a k1-1 of
+ * \ref _MMG5_coltet. For each tetra \a k, bit \a ia of \a cshrt[k-k0] is set if
+ * the edge \a ia is short enough to be collapsed and bit 6 is set if the tetra
+ * has been processed. The vertices of the tetra are stored in \a cv so that the
+ * result is used only for the tetra not modified by a previous collapse.
+ *
+ * \remark the local parameters are not handled.
+ *
+ */
+static void _MMG3D_chkcolPar(MMG5_pMesh mesh,MMG5_pSol met,char typchk,
+                             MMG5_int k0,MMG5_int k1,unsigned char *cshrt,
+                             MMG5_int *cv) {
+  MMG5_pTetra  pt;
+  MMG5_pPoint  p0,p1;
+  double       ll,ux,uy,uz,hmi2;
+  MMG5_int     k;
+  int          nth;
+  char         ia;
+
+  nth  = mesh->info.nthreads;
+  hmi2 = mesh->info.hmin*mesh->info.hmin;
+
+#pragma omp parallel for num_threads(nth) private(pt,p0,p1,ll,ux,uy,uz,ia)
+  for (k=k0; k<k1; k++) {
+    pt = &mesh->tetra[k];
+    cshrt[k-k0] = 0;
+    if ( !MG_EOK(pt) || (pt->tag & MG_REQ) || pt->xt )  continue;
+
+    memcpy(&cv[4*(k-k0)],pt->v,4*sizeof(MMG5_int));
+    cshrt[k-k0] = 1 << 6;
+    for (ia=0; ia<6; ia++) {
+      if ( typchk == 1 ) {
+        p0 = &mesh->point[pt->v[_MMG5_iare[ia][0]]];
+        p1 = &mesh->point[pt->v[_MMG5_iare[ia][1]]];
+        ux = p1->c[0] - p0->c[0];
+        uy = p1->c[1] - p0->c[1];
+        uz = p1->c[2] - p0->c[2];
+        ll = ux*ux + uy*uy + uz*uz;
+        if ( ll > hmi2*_MMG3D_LSHRT )  continue;
+      }
+      else if ( typchk == 2 ) {
+        ll = mesh->func.lenedg(mesh,met,ia,pt);
+        if ( ll == 0 || ll > _MMG3D_LSHRT )  continue;
+      }
+      cshrt[k-k0] |= 1 << ia;
+    }
+  }
+}
+#endif
+
 /**
  * \param mesh pointer toward the mesh structure.
  * \param met pointer toward the metric structure.
@@ -804,11 +1294,19 @@ static int _MMG5_coltet(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
   MMG5_pPoint     p0,p1;
   MMG5_pPar       par;
   double     ll,ux,uy,uz,hmi2;
-  int        k,nc,list[MMG3D_LMAX+2],ilist,ilists,lists[MMG3D_LMAX+2];
-  int        base,nnm,l,kk,isloc,ifac1;
+  int        nc,ilist,ilists;
+  MMG5_int   list[MMG3D_LMAX+2],lists[MMG3D_LMAX+2],k;
+  int        base,nnm,l,kk,isloc;
+  MMG5_int   ifac1;
   int16_t    tag,isnm;
   char       i,j,ip,iq;
-  int        ier;
+  MMG5_int   ier;
+#ifdef _OPENMP
+  long long     memsiz;
+  unsigned char *cshrt,shrt;
+  MMG5_int      *cv,k0,k1;
+  int           ispar;
+#endif
 
   nc = nnm = 0;
 
@@ -818,11 +1316,50 @@ static int _MMG5_coltet(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
     p0->flag = 0;
   }
 
+#ifdef _OPENMP
+  /* the short edges are searched in parallel by chunks of tetra */
+  ispar = ( mesh->info.nthreads > 1 && !mesh->info.npar );
+  k0 = k1 = 1;
+  cshrt = NULL;
+  cv    = NULL;
+  memsiz = _MMG3D_NCOLPAR*(sizeof(unsigned char)+4*sizeof(MMG5_int));
+  if ( ispar && mesh->memCur + memsiz > mesh->memMax )  ispar = 0;
+  if ( ispar )
+    _MMG5_ADD_MEM(mesh,memsiz,"parallel collapse",ispar=0);
+  if ( ispar ) {
+    /* the sequential search is used if the allocation fails */
+    cshrt = (unsigned char*)calloc(_MMG3D_NCOLPAR,sizeof(unsigned char));
+    cv    = (MMG5_int*)calloc(4*_MMG3D_NCOLPAR,sizeof(MMG5_int));
+    if ( !cshrt || !cv ) {
+      perror("  ## Memory problem: calloc");
+      if ( cshrt )  _MMG5_SAFE_FREE(cshrt);
+      if ( cv )  _MMG5_SAFE_FREE(cv);
+      mesh->memCur -= memsiz;
+      ispar = 0;
+    }
+  }
+#endif
+
   for (k=1; k<=mesh->ne; k++) {
+#ifdef _OPENMP
+    if ( ispar && k >= k1 ) {
+      k0 = k;
+      k1 = MG_MIN(mesh->ne+1,k0+_MMG3D_NCOLPAR);
+      _MMG3D_chkcolPar(mesh,met,typchk,k0,k1,cshrt,cv);
+    }
+#endif
     base = ++mesh->base;
     pt = &mesh->tetra[k];
     if ( !MG_EOK(pt) || (pt->tag & MG_REQ) )   continue;
 
+#ifdef _OPENMP
+    /* the tetra may have been modified by a collapse of the chunk */
+    shrt = 0;
+    if ( ispar && !pt->xt && (cshrt[k-k0] & (1 << 6))
+         && !memcmp(pt->v,&cv[4*(k-k0)],4*sizeof(MMG5_int)) )
+      shrt = cshrt[k-k0];
+#endif
+
     pxt = pt->xt?  &mesh->xtetra[pt->xt] : 0;
 
     for (i=0; i<4; i++) {
@@ -851,7 +1388,7 @@ static int _MMG5_coltet(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
             if ( isnm && mesh->adja[4*(k-1)+1+i] )  continue;
             if (_MMG5_boulesurfvolp(mesh,k,ip,i,
                                     list,&ilist,lists,&ilists,p0->tag & MG_NOM) < 0 )
-              return(-1);
+              goto failed;
           }
           else {
             ilist = _MMG5_boulevolp(mesh,k,ip,list);
@@ -859,6 +1396,12 @@ static int _MMG5_coltet(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
         }
 
         /* check length */
+#ifdef _OPENMP
+        if ( shrt ) {
+          if ( !(shrt & (1 << _MMG5_iarf[i][j])) )  continue;
+        }
+        else
+#endif
         if ( typchk == 1 ) {
           ux = p1->c[0] - p0->c[0];
           uy = p1->c[1] - p0->c[1];
@@ -950,7 +1493,7 @@ static int _MMG5_coltet(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
           if ( ll > hmi2*_MMG3D_LSHRT )  continue;
         }
         else if ( typchk == 2 ) {
-          ll = _MMG5_lenedg(mesh,met,_MMG5_iarf[i][j],pt);
+          ll = mesh->func.lenedg(mesh,met,_MMG5_iarf[i][j],pt);
           // Case of an internal tetra with 4 ridges vertices.
           if ( ll == 0 ) continue;
           if ( ll > _MMG3D_LSHRT )  continue;
@@ -967,7 +1510,7 @@ static int _MMG5_coltet(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
             if ( isnm && mesh->adja[4*(k-1)+1+i] )  continue;
             if (_MMG5_boulesurfvolp(mesh,k,ip,i,
                                     list,&ilist,lists,&ilists,p0->tag & MG_NOM) < 0 )
-              return(-1);
+              goto failed;
           }
           else {
             ilist = _MMG5_boulevolp(mesh,k,ip,list);
@@ -995,13 +1538,13 @@ static int _MMG5_coltet(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
 
         if ( ilist > 0 ) {
           ier = _MMG5_colver(mesh,met,list,ilist,iq,typchk);
-          if ( ier < 0 ) return(-1);
+          if ( ier < 0 ) goto failed;
           else if ( ier ) {
             _MMG3D_delPt(mesh,ier);
             break;
           }
         }
-        else if (ilist < 0 ) return(-1);
+        else if (ilist < 0 ) goto failed;
       }
       if ( ier ) {
         p1->flag = base;
@@ -1014,7 +1557,24 @@ static int _MMG5_coltet(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
   if ( nc > 0 && (abs(mesh->info.imprim) > 5 || mesh->info.ddebug) )
     fprintf(stdout,"     %8d vertices removed, %8d non manifold,\n",nc,nnm);
 
+#ifdef _OPENMP
+  if ( ispar ) {
+    if ( cshrt )  _MMG5_SAFE_FREE(cshrt);
+    if ( cv )  _MMG5_SAFE_FREE(cv);
+    mesh->memCur -= memsiz;
+  }
+#endif
   return(nc);
+
+failed:
+#ifdef _OPENMP
+  if ( ispar ) {
+    if ( cshrt )  _MMG5_SAFE_FREE(cshrt);
+    if ( cv )  _MMG5_SAFE_FREE(cv);
+    mesh->memCur -= memsiz;
+  }
+#endif
+  return(-1);
 }
 
 /**
@@ -1029,14 +1589,15 @@ static inline
 int _MMG3D_delPatternPts(MMG5_pMesh mesh,_MMG5_Hash hash)
 {
   MMG5_pTetra   pt;
-  int           vx[6],k,ia,i,j;
+  int           ia,i,j;
+  MMG5_int      vx[6],k;
 
   /* Delete the useless added points */
   for (k=1; k<=mesh->ne; k++) {
     pt = &mesh->tetra[k];
     if ( !MG_EOK(pt) || (pt->tag & MG_REQ) ) continue;
 
-    memset(vx,0,6*sizeof(int));
+    memset(vx,0,6*sizeof(MMG5_int));
     for (ia=0,i=0; i<3; i++) {
       for (j=i+1; j<4; j++,ia++) {
         if ( pt->xt && (mesh->xtetra[pt->xt].tag[ia] & MG_REQ) ) continue;
@@ -1045,10 +1606,10 @@ int _MMG3D_delPatternPts(MMG5_pMesh mesh,_MMG5_Hash hash)
           _MMG3D_delPt(mesh,vx[ia]);
           if ( !_MMG5_hashUpdate(&hash,pt->v[i],pt->v[j],-1) ) {
             fprintf(stderr,"\n  ## Error: %s: unable to delete point idx"
-                    " along edge %d %d.\n", __func__,
+                    " along edge %" MMG5_PRId " %" MMG5_PRId ".\n", __func__,
                     _MMG3D_indPt(mesh,pt->v[i]),
                     _MMG3D_indPt(mesh,pt->v[j]));
-            _MMG5_DEL_MEM(mesh,hash.item,(hash.max+1)*sizeof(_MMG5_hedge));
+            _MMG5_DEL_MEM(mesh,hash.item,hash.siz*sizeof(_MMG5_hedge));
             return 0;
           }
         }
@@ -1076,7 +1637,8 @@ _MMG5_anatetv(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
   _MMG5_Hash    hash;
   MMG5_pPar     par;
   double   ll,o[3],ux,uy,uz,hma2,mincal;
-  int      l,vx[6],k,ip,ip1,ip2,nap,ns,ne,memlack,ier;
+  int      l,nap,ns,memlack,ier;
+  MMG5_int ip1,ip2,ne,ip,vx[6],k;
   char     i,j,ia;
 
   /** 1. analysis */
@@ -1165,7 +1727,7 @@ _MMG5_anatetv(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
           }
         }
         else if ( typchk == 2 ) {
-          ll = _MMG5_lenedg(mesh,met,i,pt);
+          ll = mesh->func.lenedg(mesh,met,i,pt);
           // Case of an internal tetra with 4 ridges vertices.
           if ( ll == 0 ) continue;
           if ( ll > _MMG3D_LLONG ) {
@@ -1198,7 +1760,7 @@ _MMG5_anatetv(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
           if ( typchk == 1 && (met->size>1) )
             ier = _MMG3D_intmet33_ani(mesh,met,k,i,ip,0.5);
           else
-            ier = _MMG5_intmet(mesh,met,k,i,ip,0.5);
+            ier = mesh->func.intmet(mesh,met,k,i,ip,0.5);
 
           if (!ier) {
             // Unable to compute the metric
@@ -1217,7 +1779,7 @@ _MMG5_anatetv(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
     }
   }
   if ( !nap )  {
-    _MMG5_DEL_MEM(mesh,hash.item,(hash.max+1)*sizeof(_MMG5_hedge));
+    _MMG5_DEL_MEM(mesh,hash.item,hash.siz*sizeof(_MMG5_hedge));
     return(0);
   }
 
@@ -1233,7 +1795,7 @@ split:
              " Volumic patterns skipped.\n",__func__);
    }
 
-   _MMG5_DEL_MEM(mesh,hash.item,(hash.max+1)*sizeof(_MMG5_hedge));
+   _MMG5_DEL_MEM(mesh,hash.item,hash.siz*sizeof(_MMG5_hedge));
    return(0);
  }
 
@@ -1242,7 +1804,7 @@ split:
   for (k=1; k<=ne; k++) {
     pt = &mesh->tetra[k];
     if ( !MG_EOK(pt) || (pt->tag & MG_REQ) )  continue;
-    memset(vx,0,6*sizeof(int));
+    memset(vx,0,6*sizeof(MMG5_int));
     pt->flag = 0;
     for (ia=0,i=0; i<3; i++) {
       for (j=i+1; j<4; j++,ia++) {
@@ -1311,7 +1873,7 @@ split:
   if ( (mesh->info.ddebug || abs(mesh->info.imprim) > 5) && ns > 0 )
     fprintf(stdout,"     %7d splitted\n",nap);
 
-  _MMG5_DEL_MEM(mesh,hash.item,(hash.max+1)*sizeof(_MMG5_hedge));
+  _MMG5_DEL_MEM(mesh,hash.item,hash.siz*sizeof(_MMG5_hedge));
   if ( memlack )  return(-1);
   return(nap);
 }
@@ -1355,135 +1917,359 @@ _MMG3D_storeGeom(MMG5_pPoint ppt, MMG5_pxPoint pxp, double no[3]) {
 /**
  * \param mesh pointer toward the mesh structure.
  * \param met pointer toward the metric structure.
+ * \param k index of the tetra.
  * \param typchk type of checking permformed for edge length (hmax or _MMG3D_LLONG criterion).
- * \return -1 if failed.
- * \return number of new points.
+ * \param ptt pointer toward the virtual triangle of the boundary face.
+ * \return the boundary face of \a k whose edges must be split, -1 if none.
  *
- * Analyze tetra and split on geometric criterion.
+ * Set the flag of the boundary tetra \a k to the edges of its first boundary
+ * face that must be split (w/r Hausdorff or hmax) and store this face in \a
+ * ptt. Only the tetra \a k is modified.
  *
  */
 static int
-_MMG5_anatets(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
+_MMG3D_chkbdyfac(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,char typchk,
+                 MMG5_Tria *ptt) {
   MMG5_pTetra   pt;
-  MMG5_pPoint   ppt,p1,p2;
-  MMG5_Tria     ptt;
   MMG5_xTetra  *pxt;
-  MMG5_xPoint  *pxp;
-  _MMG5_Bezier  pb;
-  _MMG5_Hash    hash;
   MMG5_pPar     par;
-  double        o[3],no[3],to[3],dd,len,hmax,hausd;
-  int           vx[6],k,l,ip,ic,it,nap,nc,ni,ne,ns,ip1,ip2,ier,isloc;
-  char          i,j,j2,ia,i1,i2,ifac;
-  static double uv[3][2] = { {0.5,0.5}, {0.,0.5}, {0.5,0.} };
-  static char   mmgWarn = 0, mmgWarn2 = 0;
+  double        len,hmax,hausd;
+  int           l,isloc;
+  MMG5_int      ip1,ip2;
+  char          i,j,ia,i1,i2;
 
-  /** 1. analysis of boundary elements */
-  if ( !_MMG5_hashNew(mesh,&hash,mesh->np,7*mesh->np) ) return(-1);
-  ns = nap = 0;
+  pt = &mesh->tetra[k];
+  if ( !MG_EOK(pt) || (pt->tag & MG_REQ) || !pt->xt )  return(-1);
 
-  for (k=1; k<=mesh->ne; k++) {
-    pt = &mesh->tetra[k];
-    if ( !MG_EOK(pt) || (pt->tag & MG_REQ) || !pt->xt )  continue;
 
-    /* check boundary face cut w/r Hausdorff or hmax */
-    pt->flag = 0;
-    pxt = &mesh->xtetra[pt->xt];
+  /* check boundary face cut w/r Hausdorff or hmax */
+  pt->flag = 0;
+  pxt = &mesh->xtetra[pt->xt];
 
-    for (i=0; i<4; i++){
-      if ( pxt->ftag[i] & MG_REQ )  continue;
-      if ( pxt->ftag[i] & MG_BDY )  break;
-    }
-    if ( i == 4 )  continue;
+  for (i=0; i<4; i++){
+    if ( pxt->ftag[i] & MG_REQ )  continue;
+    if ( pxt->ftag[i] & MG_BDY )  break;
+  }
+  if ( i == 4 )  return(-1);
 
-    /* virtual triangle */
-    _MMG5_tet2tri(mesh,k,i,&ptt);
-    if ( typchk == 1 ) {
-      if ( !MG_GET(pxt->ori,i) ) continue;
+  /* virtual triangle */
+  _MMG5_tet2tri(mesh,k,i,ptt);
+  if ( typchk == 1 ) {
+    if ( !MG_GET(pxt->ori,i) ) return(-1);
+
+    /* Local parameters for ptt and k */
+    hmax  = mesh->info.hmax;
+    hausd = mesh->info.hausd;
+    isloc = 0;
+
+    if ( mesh->info.parTyp & MG_Tetra ) {
+      for ( l=0; l<mesh->info.npar; ++l ) {
+        par = &mesh->info.par[l];
+
+        if ( par->elt != MMG5_Tetrahedron )  continue;
+        if ( par->ref != pt->ref ) continue;
+
+        hmax = par->hmax;
+        hausd = par->hausd;
+        isloc = 1;
+        break;
+      }
+    }
+    if ( mesh->info.parTyp & MG_Tria ) {
+      if ( isloc ) {
+        for ( l=0; l<mesh->info.npar; ++l ) {
+          par = &mesh->info.par[l];
 
-      /* Local parameters for ptt and k */
-      hmax  = mesh->info.hmax;
-      hausd = mesh->info.hausd;
-      isloc = 0;
+          if ( par->elt != MMG5_Triangle )  continue;
+          if ( par->ref != ptt->ref ) continue;
 
-      if ( mesh->info.parTyp & MG_Tetra ) {
+          hmax = MG_MIN(hmax,par->hmax);
+          hausd = MG_MIN(hausd,par->hausd);
+          break;
+        }
+      }
+      else {
         for ( l=0; l<mesh->info.npar; ++l ) {
           par = &mesh->info.par[l];
 
-          if ( par->elt != MMG5_Tetrahedron )  continue;
-          if ( par->ref != pt->ref ) continue;
+          if ( par->elt != MMG5_Triangle )  continue;
+          if ( par->ref != ptt->ref ) continue;
 
-          hmax = par->hmax;
+          hmax  = par->hmax;
           hausd = par->hausd;
           isloc = 1;
           break;
         }
       }
-      if ( mesh->info.parTyp & MG_Tria ) {
-        if ( isloc ) {
-          for ( l=0; l<mesh->info.npar; ++l ) {
-            par = &mesh->info.par[l];
+    }
 
-            if ( par->elt != MMG5_Triangle )  continue;
-            if ( par->ref != ptt.ref ) continue;
+    if ( !_MMG5_chkedg(mesh,ptt,MG_GET(pxt->ori,i),hmax,hausd,isloc) )
+      return(-1);
 
-            hmax = MG_MIN(hmax,par->hmax);
-            hausd = MG_MIN(hausd,par->hausd);
-            break;
-          }
-        }
-        else {
-          for ( l=0; l<mesh->info.npar; ++l ) {
-            par = &mesh->info.par[l];
+    /* put back flag on tetra */
+    for (j=0; j<3; j++){
+      if ( pxt->tag[_MMG5_iarf[i][j]] & MG_REQ )  continue;
+      if ( MG_GET(ptt->flag,j) )  MG_SET(pt->flag,_MMG5_iarf[i][j]);
+    }
+  }
+  else if ( typchk == 2 ) {
+    for (j=0; j<3; j++) {
+      ia = _MMG5_iarf[i][j];
+      if ( pxt->tag[ia] & MG_REQ )  continue;
+      i1  = _MMG5_iare[ia][0];
+      i2  = _MMG5_iare[ia][1];
+      ip1 = pt->v[i1];
+      ip2 = pt->v[i2];
+      len = mesh->func.lenedg(mesh,met,ia,pt);
 
-            if ( par->elt != MMG5_Triangle )  continue;
-            if ( par->ref != ptt.ref ) continue;
+      assert( isfinite(len) && (len!=-len) );
 
-            hmax  = par->hmax;
-            hausd = par->hausd;
-            isloc = 1;
-            break;
-          }
-        }
+      // Case of an internal tetra with 4 ridges vertices.
+      if ( len == 0 ) continue;
+      if ( len > _MMG3D_LLONG )  MG_SET(pt->flag,ia);
+      /* Treat here the ridges coming from a corner (we can not do that after
+       * because the corner don't have xpoints) */
+      if ( (mesh->point[ip1].tag & MG_CRN) ||  (mesh->point[ip2].tag & MG_CRN) ) {
+        if ( len > _MMG3D_LOPTL )  MG_SET(pt->flag,ia);
       }
+    }
+  }
+  if ( !pt->flag )  return(-1);
 
-      if ( !_MMG5_chkedg(mesh,&ptt,MG_GET(pxt->ori,i),hmax,hausd,isloc) )
-        continue;
+  return(i);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param hash pointer toward the hash table of the new points.
+ * \param k index of the tetra.
+ * \param upd 1 if the normals at the new ridge points may be updated.
+ * \return the number of edges of \a k that are marked, -1 if \a upd is 0 and
+ * the update of a normal is needed (the tetra is then not modified).
+ *
+ * Mark the edges of the tetra \a k that have been split by an adjacent tetra
+ * and update the second normal at the new ridge points.
+ *
+ */
+static int
+_MMG3D_updSplitFlag(MMG5_pMesh mesh,_MMG5_Hash *hash,MMG5_int k,int upd) {
+  MMG5_pTetra   pt;
+  MMG5_pPoint   ppt;
+  MMG5_Tria     ptt;
+  MMG5_xTetra  *pxt;
+  MMG5_xPoint  *pxp;
+  _MMG5_Bezier  pb;
+  double        o[3],no[3],to[3],dd;
+  int           nc,ier,flag;
+  MMG5_int      ip1,ip2,ip;
+  char          i,j,ia;
+  static double uv[3][2] = { {0.5,0.5}, {0.,0.5}, {0.5,0.} };
+
+  pt = &mesh->tetra[k];
+  if ( !MG_EOK(pt) || (pt->tag & MG_REQ) )  return(0);
+  pxt  = pt->xt ? &mesh->xtetra[pt->xt] : 0;
+  flag = pt->flag;
+  nc   = 0;
+
+  /* update face-edge flag */
+  for (i=0; i<4; i++) {
+    /* virtual triangle */
+    memset(&ptt,0,sizeof(MMG5_Tria));
+    if ( pt->xt && pxt->ftag[i] )
+      _MMG5_tet2tri(mesh,k,i,&ptt);
+
+    for (j=0; j<3; j++) {
+      ia  = _MMG5_iarf[i][j];
+      if ( MG_GET(flag,ia) )                    continue;
+      if ( pt->xt && (pxt->tag[ia] & MG_REQ) )  continue;
+      else if ( ptt.tag[j] & MG_REQ )           continue;
+      ip1 = pt->v[_MMG5_iare[ia][0]];
+      ip2 = pt->v[_MMG5_iare[ia][1]];
+      ip  = _MMG5_hashGet(hash,ip1,ip2);
+      if ( ip > 0 ) {
+
+        MG_SET(flag,ia);
+        nc++;
+        /* ridge on a boundary face */
+        if ( !(ptt.tag[j] & MG_GEO) && !(ptt.tag[j] & MG_NOM) )  continue;
+        if ( !upd )  return(-1);
+        ppt = &mesh->point[ip];
+        assert(ppt->xp);
+        pxp = &mesh->xpoint[ppt->xp];
+        if ( pt->xt )  ier = mesh->func.bezierCP(mesh,&ptt,&pb,MG_GET(pxt->ori,i));
+        else  ier = mesh->func.bezierCP(mesh,&ptt,&pb,1);
+        if ( !ier )  continue;
+
+        ier = _MMG3D_bezierInt(&pb,&uv[j][0],o,no,to);
+        if ( !ier )  continue;
+
+        dd = no[0]*pxp->n1[0]+no[1]*pxp->n1[1]+no[2]*pxp->n1[2];
+        if ( dd > 1.0-_MMG5_EPS ) continue;
 
-      /* put back flag on tetra */
-      for (j=0; j<3; j++){
-        if ( pxt->tag[_MMG5_iarf[i][j]] & MG_REQ )  continue;
-        if ( MG_GET(ptt.flag,j) )  MG_SET(pt->flag,_MMG5_iarf[i][j]);
+        memcpy(pxp->n2,no,3*sizeof(double));
       }
     }
-    else if ( typchk == 2 ) {
-      for (j=0; j<3; j++) {
-        ia = _MMG5_iarf[i][j];
-        if ( pxt->tag[ia] & MG_REQ )  continue;
-        i1  = _MMG5_iare[ia][0];
-        i2  = _MMG5_iare[ia][1];
-        ip1 = pt->v[i1];
-        ip2 = pt->v[i2];
-        len = _MMG5_lenedg(mesh,met,ia,pt);
-
-        assert( isfinite(len) && (len!=-len) );
-
-        // Case of an internal tetra with 4 ridges vertices.
-        if ( len == 0 ) continue;
-        if ( len > _MMG3D_LLONG )  MG_SET(pt->flag,ia);
-        /* Treat here the ridges coming from a corner (we can not do that after
-         * because the corner don't have xpoints) */
-        if ( (mesh->point[ip1].tag & MG_CRN) ||  (mesh->point[ip2].tag & MG_CRN) ) {
-          if ( len > _MMG3D_LOPTL )  MG_SET(pt->flag,ia);
-        }
+  }
+  pt->flag = flag;
+
+  return(nc);
+}
+
+#ifdef _OPENMP
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param met pointer toward the metric structure.
+ * \param typchk type of checking permformed for edge length (hmax or _MMG3D_LLONG criterion).
+ * \param k0 first tetra of the chunk.
+ * \param k1 tetra following the last tetra of the chunk.
+ * \param cfac pointer to store the boundary face to split of the tetra.
+ * \param cgeo pointer to store the position, normal and tangent of the
+ * midpoints of the edges to split.
+ *
+ * Parallel analysis of the boundary tetra \a k0 to \a k1-1 of \ref
+ * _MMG5_anatets: the flags of the tetra are set by \ref _MMG3D_chkbdyfac and
+ * the midpoints of the marked edges are evaluated on the Bezier patch of the
+ * face. These computations only depend on the initial mesh. The face (resp.
+ * an edge) is not split if its Bezier patch (resp. the midpoint) can't be
+ * computed, as in the sequential analysis.
+ *
+ */
+static void
+_MMG3D_anatetsPar(MMG5_pMesh mesh,MMG5_pSol met,char typchk,MMG5_int k0,
+                  MMG5_int k1,int *cfac,double *cgeo) {
+  MMG5_pTetra   pt;
+  MMG5_Tria     ptt;
+  MMG5_xTetra  *pxt;
+  _MMG5_Bezier  pb;
+  double        *geo;
+  MMG5_int      k;
+  int           nth,ier;
+  char          i,j,ia;
+  static double uv[3][2] = { {0.5,0.5}, {0.,0.5}, {0.5,0.} };
+
+  nth = mesh->info.nthreads;
+
+#pragma omp parallel for num_threads(nth) schedule(dynamic,64) \
+  private(pt,ptt,pxt,pb,geo,ier,i,j,ia)
+  for (k=k0; k<k1; k++) {
+    i = _MMG3D_chkbdyfac(mesh,met,k,typchk,&ptt);
+    cfac[k-k0] = i;
+    if ( i < 0 )  continue;
+
+    pt  = &mesh->tetra[k];
+    pxt = &mesh->xtetra[pt->xt];
+    geo = &cgeo[27*(k-k0)];
+
+    ier = mesh->func.bezierCP(mesh,&ptt,&pb,MG_GET(pxt->ori,i));
+    if ( !ier ) {
+      pt->flag    = 0;
+      cfac[k-k0] = -1;
+      continue;
+    }
+
+    for (j=0; j<3; j++) {
+      ia = _MMG5_iarf[i][j];
+      if ( !MG_GET(pt->flag,ia) )  continue;
+      if ( pxt->tag[ia] & MG_REQ )  continue;
+      ier = _MMG3D_bezierInt(&pb,&uv[j][0],&geo[9*j],&geo[9*j+3],&geo[9*j+6]);
+      if ( !ier )  MG_CLR(pt->flag,ia);
+    }
+  }
+}
+#endif
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param met pointer toward the metric structure.
+ * \param typchk type of checking permformed for edge length (hmax or _MMG3D_LLONG criterion).
+ * \return -1 if failed.
+ * \return number of new points.
+ *
+ * Analyze tetra and split on geometric criterion.
+ *
+ */
+static int
+_MMG5_anatets(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
+  MMG5_pTetra   pt;
+  MMG5_pPoint   ppt,p1,p2;
+  MMG5_Tria     ptt;
+  MMG5_xTetra  *pxt;
+  MMG5_xPoint  *pxp;
+  _MMG5_Bezier  pb;
+  _MMG5_Hash    hash;
+  double        o[3],no[3],to[3],*geo;
+  int           ic,it,nap,nc,ni,ns,ier;
+  MMG5_int      ne,ip1,ip2,ip,vx[6],k;
+  char          i,j,j2,ia,i1,i2,ifac;
+  static double uv[3][2] = { {0.5,0.5}, {0.,0.5}, {0.5,0.} };
+  static _MMG5_TLS char   mmgWarn = 0, mmgWarn2 = 0;
+#ifdef _OPENMP
+  long long     memsiz;
+  double        *cgeo;
+  int           *cfac,ispar;
+  MMG5_int      k0,k1,kk;
+#endif
+
+  /** 1. analysis of boundary elements */
+  if ( !_MMG5_hashNew(mesh,&hash,mesh->np,7*mesh->np) ) return(-1);
+  ns = nap = 0;
+
+#ifdef _OPENMP
+  /* the analysis of the boundary tetra is made in parallel by chunks */
+  ispar = ( mesh->info.nthreads > 1 );
+  k0 = k1 = 1;
+  cfac = NULL;
+  cgeo = NULL;
+  memsiz = _MMG3D_NANAPAR*(sizeof(int)+27*sizeof(double));
+  if ( ispar && mesh->memCur + memsiz > mesh->memMax )  ispar = 0;
+  if ( ispar )
+    _MMG5_ADD_MEM(mesh,memsiz,"parallel analysis",ispar=0);
+  if ( ispar ) {
+    /* the sequential analysis is used if the allocation fails */
+    cfac = (int*)calloc(_MMG3D_NANAPAR,sizeof(int));
+    cgeo = (double*)calloc(27*_MMG3D_NANAPAR,sizeof(double));
+    if ( !cfac || !cgeo ) {
+      perror("  ## Memory problem: calloc");
+      if ( cfac )  _MMG5_SAFE_FREE(cfac);
+      if ( cgeo )  _MMG5_SAFE_FREE(cgeo);
+      mesh->memCur -= memsiz;
+      ispar = 0;
+    }
+  }
+#endif
+
+  for (k=1; k<=mesh->ne; k++) {
+    geo = NULL;
+#ifdef _OPENMP
+    if ( ispar ) {
+      if ( k >= k1 ) {
+        k0 = k;
+        k1 = MG_MIN(mesh->ne+1,k0+_MMG3D_NANAPAR);
+        _MMG3D_anatetsPar(mesh,met,typchk,k0,k1,cfac,cgeo);
       }
+      i = cfac[k-k0];
+      if ( i < 0 )  continue;
+      _MMG5_tet2tri(mesh,k,i,&ptt);
+      geo = &cgeo[27*(k-k0)];
     }
-    if ( !pt->flag )  continue;
-    ns++;
+    else
+#endif
+    {
+      i = _MMG3D_chkbdyfac(mesh,met,k,typchk,&ptt);
+      if ( i < 0 )  continue;
+    }
+    pt  = &mesh->tetra[k];
+    pxt = &mesh->xtetra[pt->xt];
 
     /* geometric support */
-    ier = _MMG5_bezierCP(mesh,&ptt,&pb,MG_GET(pxt->ori,i));
-    assert(ier);
+    if ( !geo ) {
+      ier = mesh->func.bezierCP(mesh,&ptt,&pb,MG_GET(pxt->ori,i));
+      if ( !ier ) {
+        pt->flag = 0;
+        continue;
+      }
+    }
+    ns++;
 
     /* scan edges in face to split */
     for (j=0; j<3; j++) {
@@ -1497,8 +2283,18 @@ _MMG5_anatets(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
       ip  = _MMG5_hashGet(&hash,ip1,ip2);
       if ( ip > 0 && !(ptt.tag[j] & MG_GEO) )  continue;
 
-      ier = _MMG3D_bezierInt(&pb,&uv[j][0],o,no,to);
-      assert(ier);
+      if ( geo ) {
+        memcpy(o,&geo[9*j],3*sizeof(double));
+        memcpy(no,&geo[9*j+3],3*sizeof(double));
+        memcpy(to,&geo[9*j+6],3*sizeof(double));
+      }
+      else {
+        ier = _MMG3D_bezierInt(&pb,&uv[j][0],o,no,to);
+        if ( !ier ) {
+          MG_CLR(pt->flag,ia);
+          continue;
+        }
+      }
       /* new point along edge */
       if ( !ip ) {
         ip = _MMG3D_newPt(mesh,o,MG_BDY);
@@ -1508,21 +2304,21 @@ _MMG5_anatets(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
                               fprintf(stderr,"\n  ## Error: %s: unable to"
                                       " allocate a new point.\n",__func__);
                               _MMG5_INCREASE_MEM_MESSAGE();
-                              _MMG3D_delPatternPts(mesh,hash);return -1;
+                              _MMG3D_delPatternPts(mesh,hash);goto failed;
                               ,o,MG_BDY,-1);
           // Now pb->p contain a wrong memory address.
           pb.p[0] = &mesh->point[ptt.v[0]];
           pb.p[1] = &mesh->point[ptt.v[1]];
           pb.p[2] = &mesh->point[ptt.v[2]];
         }
-        if ( !_MMG5_hashEdge(mesh,&hash,ip1,ip2,ip) )  return(-1);
+        if ( !_MMG5_hashEdge(mesh,&hash,ip1,ip2,ip) )  goto failed;
         ppt = &mesh->point[ip];
 
         if ( met->m ) {
           if ( typchk == 1 && (met->size>1) )
             ier = _MMG3D_intmet33_ani(mesh,met,k,ia,ip,0.5);
           else
-            ier = _MMG5_intmet(mesh,met,k,ia,ip,0.5);
+            ier = mesh->func.intmet(mesh,met,k,ia,ip,0.5);
 
           if ( !ier ) {
             if ( !mmgWarn ) {
@@ -1530,7 +2326,7 @@ _MMG5_anatets(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
                       " 1 metric.\n",__func__);
               mmgWarn = 1;
             }
-            return(-1);
+            goto failed;
           }
           else if ( ier < 0 ) {
             _MMG3D_delPt(mesh,ip);
@@ -1560,11 +2356,12 @@ _MMG5_anatets(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
               _MMG5_tet2tri(mesh,k,ifac,&ptt);
 
               /* geometric support */
-              ier = _MMG5_bezierCP(mesh,&ptt,&pb,MG_GET(pxt->ori,ifac));
-              assert(ier);
+              ier = mesh->func.bezierCP(mesh,&ptt,&pb,MG_GET(pxt->ori,ifac));
+              geo = NULL;
+              if ( !ier )  continue;
 
               ier = _MMG3D_bezierInt(&pb,&uv[j2][0],o,no,to);
-              assert(ier);
+              if ( !ier )  continue;
 
               if ( !_MMG3D_storeGeom(ppt,pxp,no) ) continue;
             }
@@ -1582,57 +2379,49 @@ _MMG5_anatets(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
     }
   }
   if ( !ns ) {
-    _MMG5_DEL_MEM(mesh,hash.item,(hash.max+1)*sizeof(_MMG5_hedge));
+#ifdef _OPENMP
+    if ( ispar ) {
+      if ( cfac )  _MMG5_SAFE_FREE(cfac);
+      if ( cgeo )  _MMG5_SAFE_FREE(cgeo);
+      mesh->memCur -= memsiz;
+    }
+#endif
+    _MMG5_DEL_MEM(mesh,hash.item,hash.siz*sizeof(_MMG5_hedge));
     return(ns);
   }
 
   /** 2. check if split by adjacent; besides, a triangle may have been splitted and not its adjacent
       (thus, the associated n2 may not exist) : update this normal if need be */
   nc = 0;
+#ifdef _OPENMP
+  k0 = k1 = 1;
+#endif
   for (k=1; k<=mesh->ne; k++) {
-    pt = &mesh->tetra[k];
-    if ( !MG_EOK(pt) || (pt->tag & MG_REQ) )  continue;
-    pxt = pt->xt ? &mesh->xtetra[pt->xt] : 0;
-
-    /* update face-edge flag */
-    for (i=0; i<4; i++) {
-      /* virtual triangle */
-      memset(&ptt,0,sizeof(MMG5_Tria));
-      if ( pt->xt && pxt->ftag[i] )
-        _MMG5_tet2tri(mesh,k,i,&ptt);
-
-      for (j=0; j<3; j++) {
-        ia  = _MMG5_iarf[i][j];
-        if ( MG_GET(pt->flag,ia) )                continue;
-        if ( pt->xt && (pxt->tag[ia] & MG_REQ) )  continue;
-        else if ( ptt.tag[j] & MG_REQ )           continue;
-        ip1 = pt->v[_MMG5_iare[ia][0]];
-        ip2 = pt->v[_MMG5_iare[ia][1]];
-        ip  = _MMG5_hashGet(&hash,ip1,ip2);
-        if ( ip > 0 ) {
-
-          MG_SET(pt->flag,ia);
-          nc++;
-          /* ridge on a boundary face */
-          if ( !(ptt.tag[j] & MG_GEO) && !(ptt.tag[j] & MG_NOM) )  continue;
-          ppt = &mesh->point[ip];
-          assert(ppt->xp);
-          pxp = &mesh->xpoint[ppt->xp];
-          if ( pt->xt )  ier = _MMG5_bezierCP(mesh,&ptt,&pb,MG_GET(pxt->ori,i));
-          else  ier = _MMG5_bezierCP(mesh,&ptt,&pb,1);
-          assert(ier);
-
-          ier = _MMG3D_bezierInt(&pb,&uv[j][0],o,no,to);
-          assert(ier);
-
-          dd = no[0]*pxp->n1[0]+no[1]*pxp->n1[1]+no[2]*pxp->n1[2];
-          if ( dd > 1.0-_MMG5_EPS ) continue;
-
-          memcpy(pxp->n2,no,3*sizeof(double));
-        }
+#ifdef _OPENMP
+    if ( ispar ) {
+      if ( k >= k1 ) {
+        k0 = k;
+        k1 = MG_MIN(mesh->ne+1,k0+_MMG3D_NANAPAR);
+#pragma omp parallel for num_threads(mesh->info.nthreads)
+        for (kk=k0; kk<k1; kk++)
+          cfac[kk-k0] = _MMG3D_updSplitFlag(mesh,&hash,kk,0);
+      }
+      /* the normals are updated sequentially */
+      if ( cfac[k-k0] >= 0 ) {
+        nc += cfac[k-k0];
+        continue;
       }
     }
+#endif
+    nc += _MMG3D_updSplitFlag(mesh,&hash,k,1);
   }
+#ifdef _OPENMP
+  if ( ispar ) {
+    if ( cfac )  _MMG5_SAFE_FREE(cfac);
+    if ( cgeo )  _MMG5_SAFE_FREE(cgeo);
+    mesh->memCur -= memsiz;
+  }
+#endif
   if ( mesh->info.ddebug && nc ) {
     fprintf(stdout,"     %d added\n",nc);
     fflush(stdout);
@@ -1649,7 +2438,7 @@ _MMG5_anatets(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
     for (k=1; k<=mesh->ne; k++) {
       pt = &mesh->tetra[k];
       if ( !MG_EOK(pt) || (pt->tag & MG_REQ) || !pt->flag )  continue;
-      memset(vx,0,6*sizeof(int));
+      memset(vx,0,6*sizeof(MMG5_int));
       pt->flag = ic = 0;
       for (ia=0,i=0; i<3; i++) {
         for (j=i+1; j<4; j++,ia++) {
@@ -1735,10 +2524,10 @@ _MMG5_anatets(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
                 if ( !_MMG5_hashUpdate(&hash,pt->v[_MMG5_iare[ia][0]],
                                        pt->v[_MMG5_iare[ia][1]],-1) ) {
                   fprintf(stderr,"\n  ## Error: %s: unable to delete point"
-                          " idx along edge %d %d.\n",
+                          " idx along edge %" MMG5_PRId " %" MMG5_PRId ".\n",
                          __func__,_MMG3D_indPt(mesh,pt->v[_MMG5_iare[ia][0]]),
                          _MMG3D_indPt(mesh,pt->v[_MMG5_iare[ia][1]]));
-                  _MMG5_DEL_MEM(mesh,hash.item,(hash.max+1)*sizeof(_MMG5_hedge));
+                  _MMG5_DEL_MEM(mesh,hash.item,hash.siz*sizeof(_MMG5_hedge));
                   return -1;
                 }
                 _MMG3D_delPt(mesh,vx[ia]);
@@ -1764,7 +2553,7 @@ _MMG5_anatets(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
   for (k=1; k<=ne; k++) {
     pt = &mesh->tetra[k];
     if ( !MG_EOK(pt) || !pt->flag || (pt->tag & MG_REQ) )  continue;
-    memset(vx,0,6*sizeof(int));
+    memset(vx,0,6*sizeof(MMG5_int));
     for (ia=0,i=0; i<3; i++) {
       for (j=i+1; j<4; j++,ia++) {
         if ( MG_GET(pt->flag,ia) )  {
@@ -1831,8 +2620,18 @@ _MMG5_anatets(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
   if ( (mesh->info.ddebug || abs(mesh->info.imprim) > 5) && ns > 0 )
     fprintf(stdout,"       %7d elements splitted\n",nap);
 
-  _MMG5_DEL_MEM(mesh,hash.item,(hash.max+1)*sizeof(_MMG5_hedge));
+  _MMG5_DEL_MEM(mesh,hash.item,hash.siz*sizeof(_MMG5_hedge));
   return(nap);
+
+failed:
+#ifdef _OPENMP
+  if ( ispar ) {
+    if ( cfac )  _MMG5_SAFE_FREE(cfac);
+    if ( cgeo )  _MMG5_SAFE_FREE(cgeo);
+    mesh->memCur -= memsiz;
+  }
+#endif
+  return(-1);
 }
 
 
@@ -1851,7 +2650,8 @@ static int _MMG5_anatet4(MMG5_pMesh mesh, MMG5_pSol met,int *nf, char typchk) {
   MMG5_pTetra  pt;
   MMG5_pPoint  ppt;
   MMG5_pxTetra pxt;
-  int          k,ns,ier;
+  int          ns;
+  MMG5_int     ier,k;
   char         nbdy,j;
 
   ns = 0;
@@ -1905,7 +2705,8 @@ static int _MMG5_anatet4(MMG5_pMesh mesh, MMG5_pSol met,int *nf, char typchk) {
 static int _MMG5_anatet4rid(MMG5_pMesh mesh, MMG5_pSol met,int *nf, char typchk) {
   MMG5_pTetra  pt;
   MMG5_pPoint  ppt;
-  int          k,ns,ier;
+  int          ns;
+  MMG5_int     ier,k;
   char         nrid,j;
 
   ns = 0;
@@ -1961,7 +2762,7 @@ int _MMG5_anatet(MMG5_pMesh mesh,MMG5_pSol met,char typchk, int patternMode) {
     if ( typchk==2 && lastit==1 )  ++mesh->info.fem;
 
     /* memory free */
-    _MMG5_DEL_MEM(mesh,mesh->adja,(4*mesh->nemax+5)*sizeof(int));
+    _MMG5_DEL_MEM(mesh,mesh->adja,(4*mesh->nemax+5)*sizeof(MMG5_int));
 
     if ( !mesh->info.noinsert ) {
       /* split or swap tetra with more than 2 bdry faces */
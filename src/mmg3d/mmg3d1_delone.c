@@ -36,13 +36,21 @@
  */
 #include "mmg3d.h"
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #ifndef PATTERN
 
-char  ddb;
 
 #define _MMG3D_LOPTL_MMG5_DEL     1.41
 #define _MMG3D_LOPTS_MMG5_DEL     0.6
 
+/* number of tetra treated per chunk and max size of the cavities in the
+ * parallel insertion */
+#define _MMG3D_NCAVPAR         4096
+#define _MMG3D_LCAVPAR          256
+
 /* Decomment this part to debug */
 //int MMG_npuiss,MMG_nvol,MMG_npres,MMG_npd;
 
@@ -66,7 +74,7 @@ char  ddb;
  *
  */
 static inline int
-_MMG5_boucle_for(MMG5_pMesh mesh, MMG5_pSol met,_MMG3D_pOctree octree,int ne,
+_MMG5_boucle_for(MMG5_pMesh mesh, MMG5_pSol met,_MMG3D_pOctree octree,MMG5_int ne,
                  int* ifilt,int* ns,int* nc,int* warn,int it) {
   MMG5_pTetra  pt;
   MMG5_pxTetra pxt;
@@ -74,17 +82,19 @@ _MMG5_boucle_for(MMG5_pMesh mesh, MMG5_pSol met,_MMG3D_pOctree octree,int ne,
   MMG5_pPoint  p0,p1,ppt;
   MMG5_pxPoint pxp;
   double       dd,len,lmax,o[3],to[3],no1[3],no2[3],v[3];
-  int          k,ip,ip1,ip2,list[MMG3D_LMAX+2],ilist,lists[MMG3D_LMAX+2],ilists,ref;
+  int          k,ilist,ilists,ref;
+  MMG5_int     ip,ip1,ip2,list[MMG3D_LMAX+2],lists[MMG3D_LMAX+2];
   int16_t      tag;
-  char         imax,j,i,i1,i2,ifa0,ifa1;
-  int          lon,ret,ier;
+  char         imax,imin,j,i,i1,i2,ifa0,ifa1;
+  int          lon,ret;
+  MMG5_int     ier;
   double       lmin,lfilt;
-  int          imin,iq;
+  MMG5_int     iq;
   int          ii;
   double       lmaxtet,lmintet,volmin;
   int          imaxtet,imintet,base;
   char         chkRidTet;
-  static char  mmgWarn0 = 0;
+  static _MMG5_TLS char  mmgWarn0 = 0;
 
   /*first try to adapt the bdry so very strict criterion on the volume for Delaunay insertion*/
   volmin=1e-15;
@@ -101,21 +111,7 @@ _MMG5_boucle_for(MMG5_pMesh mesh, MMG5_pSol met,_MMG3D_pOctree octree,int ne,
     pxt = pt->xt ? &mesh->xtetra[pt->xt] : 0;
 
     /* 1) find longest and shortest edge  and try to manage it */
-    imax = -1; lmax = 0.0;
-    imin = -1; lmin = DBL_MAX;
-    for (ii=0; ii<6; ii++) {
-      if ( pt->xt && (pxt->tag[ii] & MG_REQ) )  continue;
-      len = _MMG5_lenedg(mesh,met,ii,pt);
-
-      if ( len > lmax ) {
-        lmax = len;
-        imax = ii;
-      }
-      if ( len < lmin ) {
-        lmin = len;
-        imin = ii;
-      }
-    }
+    _MMG3D_extLength(mesh,met,k,0,&imin,&lmin,&imax,&lmax);
     if ( imax==-1 ) {
       if ( (mesh->info.ddebug || mesh->info.imprim > 5 ) ) {
         if ( !mmgWarn0 ) {
@@ -211,7 +207,7 @@ _MMG5_boucle_for(MMG5_pMesh mesh, MMG5_pSol met,_MMG3D_pOctree octree,int ne,
                               o,tag,-1);
         }
         if ( met->m ) {
-          if ( _MMG5_intmet(mesh,met,k,imax,ip,0.5) <=0 ) {
+          if ( mesh->func.intmet(mesh,met,k,imax,ip,0.5) <=0 ) {
             _MMG3D_delPt(mesh,ip);
             goto collapse;
           }
@@ -290,7 +286,7 @@ _MMG5_boucle_for(MMG5_pMesh mesh, MMG5_pSol met,_MMG3D_pOctree octree,int ne,
                               o,MG_NOTAG,-1);
         }
         if ( met->m ) {
-          if ( _MMG5_intmet(mesh,met,k,imax,ip,0.5)<=0 ) {
+          if ( mesh->func.intmet(mesh,met,k,imax,ip,0.5)<=0 ) {
             _MMG3D_delPt(mesh,ip);
             goto collapse;
           }
@@ -335,7 +331,7 @@ _MMG5_boucle_for(MMG5_pMesh mesh, MMG5_pSol met,_MMG3D_pOctree octree,int ne,
                               o,MG_NOTAG,-1);
         }
         if ( met->m ) {
-          if ( _MMG5_intmet(mesh,met,k,imax,ip,0.5)<=0 ) {
+          if ( mesh->func.intmet(mesh,met,k,imax,ip,0.5)<=0 ) {
             _MMG3D_delPt(mesh,ip);
             goto collapse;
           };
@@ -347,12 +343,12 @@ _MMG5_boucle_for(MMG5_pMesh mesh, MMG5_pSol met,_MMG3D_pOctree octree,int ne,
         }
         else lfilt = 0.2;
 
-        if ( octree && !_MMG3D_octreein(mesh,met,octree,ip,lfilt) ) {
+        if ( octree && !mesh->func.octreein(mesh,met,octree,ip,lfilt) ) {
           _MMG3D_delPt(mesh,ip);
           (*ifilt)++;
           goto collapse;
         } else {
-          lon = _MMG5_cavity(mesh,met,k,ip,list,ilist/2,volmin);
+          lon = mesh->func.cavity(mesh,met,k,ip,list,ilist/2,volmin);
           if ( lon < 1 ) {
             // MMG_npd++; // decomment to debug
             _MMG3D_delPt(mesh,ip);
@@ -457,7 +453,7 @@ _MMG5_boucle_for(MMG5_pMesh mesh, MMG5_pSol met,_MMG3D_pOctree octree,int ne,
       if ( (ii==imintet) && (lmintet < _MMG3D_LOPTS_MMG5_DEL)) continue;
       if ( (ii==imaxtet) && (lmaxtet > _MMG3D_LOPTL_MMG5_DEL) ) continue;
 
-      len = _MMG5_lenedg(mesh,met,ii,pt);
+      len = mesh->func.lenedg(mesh,met,ii,pt);
 
       imax = ii;
       lmax = len;
@@ -535,7 +531,7 @@ _MMG5_boucle_for(MMG5_pMesh mesh, MMG5_pSol met,_MMG3D_pOctree octree,int ne,
                                 ,o,tag,-1);
           }
           if ( met->m ) {
-            if ( _MMG5_intmet(mesh,met,k,imax,ip,0.5)<=0 ) {
+            if ( mesh->func.intmet(mesh,met,k,imax,ip,0.5)<=0 ) {
               _MMG3D_delPt(mesh,ip);
               goto collapse2;
             }
@@ -613,7 +609,7 @@ _MMG5_boucle_for(MMG5_pMesh mesh, MMG5_pSol met,_MMG3D_pOctree octree,int ne,
                                 ,o,MG_NOTAG,-1);
           }
           if ( met->m ) {
-            if ( _MMG5_intmet(mesh,met,k,imax,ip,0.5)<=0 ) {
+            if ( mesh->func.intmet(mesh,met,k,imax,ip,0.5)<=0 ) {
               _MMG3D_delPt(mesh,ip);
               goto collapse2;
             }
@@ -656,7 +652,7 @@ _MMG5_boucle_for(MMG5_pMesh mesh, MMG5_pSol met,_MMG3D_pOctree octree,int ne,
                                 o,MG_NOTAG,-1);
           }
           if ( met->m ) {
-            if ( _MMG5_intmet(mesh,met,k,imax,ip,0.5)<=0 ) {
+            if ( mesh->func.intmet(mesh,met,k,imax,ip,0.5)<=0 ) {
               _MMG3D_delPt(mesh,ip);
               goto collapse2;
             }
@@ -667,12 +663,12 @@ _MMG5_boucle_for(MMG5_pMesh mesh, MMG5_pSol met,_MMG3D_pOctree octree,int ne,
           }
           else lfilt = 0.2;
 
-          if (  /*it &&*/  octree && !_MMG3D_octreein(mesh,met,octree,ip,lfilt) ) {
+          if (  /*it &&*/  octree && !mesh->func.octreein(mesh,met,octree,ip,lfilt) ) {
             _MMG3D_delPt(mesh,ip);
             (*ifilt)++;
             goto collapse2;
           } else {
-            lon = _MMG5_cavity(mesh,met,k,ip,list,ilist/2,volmin);
+            lon = mesh->func.cavity(mesh,met,k,ip,list,ilist/2,volmin);
             if ( lon < 1 ) {
               // MMG_npd++; // decomment to debug
               _MMG3D_delPt(mesh,ip);
@@ -834,6 +830,247 @@ _MMG5_optbad(MMG5_pMesh mesh, MMG5_pSol met,_MMG3D_pOctree octree) {
   return(1);
 }
 
+#ifdef _OPENMP
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param met pointer toward the metric structure.
+ * \param octree pointer toward the octree structure.
+ * \param ne number of elements.
+ * \param ifilt pointer to store the number of vertices filtered by the octree.
+ * \param ns pointer to store the number of vertices insertions.
+ * \param warn pointer to store a flag that warn the user in case of
+ * reallocation difficulty.
+ * \return -1 if fail and we don't save the mesh, 0 if fail but we try to save
+ * the mesh, 1 otherwise.
+ *
+ * Parallel Delaunay insertion of the midpoints of the long edges of the
+ * internal tetra. The tetra are processed by chunks of \ref _MMG3D_NCAVPAR
+ * elements: the edges to split and their cavities are computed in parallel
+ * without modifying the mesh, then the cavities are inserted sequentially,
+ * in the order of the tetra, if they don't overlap nor touch a cavity already
+ * inserted in the chunk. Thus the result doesn't depend on the number of
+ * threads. The remaining edges are processed by \ref _MMG5_boucle_for.
+ *
+ */
+static int
+_MMG5_boucle_forPar(MMG5_pMesh mesh, MMG5_pSol met,_MMG3D_pOctree octree,MMG5_int ne,
+                    int* ifilt,int* ns,int* warn) {
+  MMG5_pTetra    pt;
+  MMG5_pPoint    p0,p1;
+  _MMG3D_cavMark *cm;
+  double         lmin,lmax,lfilt,volmin,o[3],*clen;
+  long long      memsiz;
+  int            *cedg,*clon;
+  MMG5_int       *cip,*adja,*lst,*cel,*cav,*ccav,*lists;
+  int            k0,kk,ic,nc,i,imax,ilist,lon,ret,base,w;
+  MMG5_int       ip,jel,k,k1;
+  int            nth,tid,ier;
+  char           emin,emax;
+
+  volmin = 1e-15;
+  nth    = mesh->info.nthreads;
+  ier    = 1;
+
+  memsiz = _MMG3D_NCAVPAR*(2*sizeof(int)+2*sizeof(MMG5_int)+sizeof(double))
+    + _MMG3D_NCAVPAR*_MMG3D_LCAVPAR*sizeof(MMG5_int)
+    + nth*(sizeof(_MMG3D_cavMark)+_MMG3D_CAVSIZ*(sizeof(int)+sizeof(MMG5_int))
+           +(MMG3D_LMAX+2)*sizeof(MMG5_int));
+  _MMG5_ADD_MEM(mesh,memsiz,"parallel insertion",return(0));
+  _MMG5_SAFE_CALLOC(cel,_MMG3D_NCAVPAR,MMG5_int,0);
+  _MMG5_SAFE_CALLOC(cedg,_MMG3D_NCAVPAR,int,0);
+  _MMG5_SAFE_CALLOC(cip,_MMG3D_NCAVPAR,MMG5_int,0);
+  _MMG5_SAFE_CALLOC(clon,_MMG3D_NCAVPAR,int,0);
+  _MMG5_SAFE_CALLOC(clen,_MMG3D_NCAVPAR,double,0);
+  _MMG5_SAFE_CALLOC(ccav,_MMG3D_NCAVPAR*_MMG3D_LCAVPAR,MMG5_int,0);
+  _MMG5_SAFE_CALLOC(lists,nth*(MMG3D_LMAX+2),MMG5_int,0);
+  _MMG5_SAFE_CALLOC(cm,nth,_MMG3D_cavMark,0);
+  for (tid=0; tid<nth; tid++) {
+    _MMG5_SAFE_CALLOC(cm[tid].key,_MMG3D_CAVSIZ,MMG5_int,0);
+    _MMG5_SAFE_CALLOC(cm[tid].gen,_MMG3D_CAVSIZ,int,0);
+  }
+
+  /* the flags of the tetra must be lower than the bases of the insertions */
+  for (k=1; k<=mesh->ne; k++) {
+    if ( mesh->tetra[k].flag > mesh->base )
+      mesh->base = mesh->tetra[k].flag;
+  }
+
+  for (k0=1; k0<=ne && !(*warn); k0+=_MMG3D_NCAVPAR) {
+    k1 = MG_MIN(ne+1,k0+_MMG3D_NCAVPAR);
+
+    /* 1) longest edge of the internal tetra */
+#pragma omp parallel for num_threads(nth) private(pt,lmin,lmax,emin,emax)
+    for (k=k0; k<k1; k++) {
+      pt = &mesh->tetra[k];
+      cedg[k-k0] = -1;
+      if ( !MG_EOK(pt) || (pt->tag & MG_REQ) || pt->xt )  continue;
+      else if ( pt->mark < mesh->mark-1 )  continue;
+
+      /* the lengths are cached for the sequential sweep */
+      _MMG3D_extLength(mesh,met,k,0,&emin,&lmin,&emax,&lmax);
+      if ( emax == -1 || lmax < _MMG3D_LOPTL_MMG5_DEL )  continue;
+
+      cedg[k-k0] = emax;
+      clen[k-k0] = lmax;
+    }
+
+    /* 2) creation of the midpoints */
+    nc = 0;
+    for (k=k0; k<k1; k++) {
+      imax = cedg[k-k0];
+      if ( imax < 0 )  continue;
+      lmax = clen[k-k0];
+
+      pt = &mesh->tetra[k];
+      p0 = &mesh->point[pt->v[_MMG5_iare[imax][0]]];
+      p1 = &mesh->point[pt->v[_MMG5_iare[imax][1]]];
+      o[0] = 0.5*(p0->c[0] + p1->c[0]);
+      o[1] = 0.5*(p0->c[1] + p1->c[1]);
+      o[2] = 0.5*(p0->c[2] + p1->c[2]);
+      ip = _MMG3D_newPt(mesh,o,MG_NOTAG);
+
+      if ( !ip )  {
+        /* reallocation of point table */
+        _MMG5_POINT_REALLOC(mesh,met,ip,mesh->gap,
+                            *warn=1;
+                            goto cavity,
+                            o,MG_NOTAG,-1);
+      }
+      if ( met->m ) {
+        if ( mesh->func.intmet(mesh,met,k,imax,ip,0.5)<=0 ) {
+          _MMG3D_delPt(mesh,ip);
+          continue;
+        }
+      }
+      cel[nc]  = k;
+      cedg[nc] = imax;
+      clen[nc] = lmax;
+      cip[nc]  = ip;
+      ++nc;
+    }
+
+  cavity:
+    if ( !nc )  continue;
+
+    /* 3) cavities of the midpoints */
+#pragma omp parallel for num_threads(nth) schedule(dynamic,64) \
+  private(tid,lst,ilist,lon)
+    for (ic=0; ic<nc; ic++) {
+      tid = omp_get_thread_num();
+      lst = &lists[tid*(MMG3D_LMAX+2)];
+
+      clon[ic] = 0;
+      ilist = _MMG5_coquil(mesh,cel[ic],cedg[ic],lst);
+      if ( ilist <= 0 || ilist%2 )  continue;
+
+      lon = mesh->func.cavityPar(mesh,met,&cm[tid],cip[ic],lst,ilist/2,volmin);
+      if ( lon < 1 || lon > _MMG3D_LCAVPAR )  continue;
+
+      memcpy(&ccav[ic*_MMG3D_LCAVPAR],lst,lon*sizeof(MMG5_int));
+      clon[ic] = lon;
+    }
+
+    /* 4) insertion of the independent cavities */
+    w = mesh->base+1;
+    for (ic=0; ic<nc; ic++) {
+      ip  = cip[ic];
+      lon = clon[ic];
+      cav = &ccav[ic*_MMG3D_LCAVPAR];
+
+      /* the cavity must not touch a cavity inserted in this chunk */
+      for (kk=0; kk<lon; kk++) {
+        pt = &mesh->tetra[cav[kk]];
+        if ( !MG_EOK(pt) || pt->flag >= w )  break;
+
+        adja = &mesh->adja[4*(cav[kk]-1)+1];
+        for (i=0; i<4; i++) {
+          jel = adja[i] >> 2;
+          if ( jel && mesh->tetra[jel].flag >= w )  break;
+        }
+        if ( i < 4 )  break;
+      }
+      if ( !lon || kk < lon ) {
+        _MMG3D_delPt(mesh,ip);
+        continue;
+      }
+
+      /* Delaunay */
+      lfilt = ( clen[ic] < 1.6 ) ? 0.7 : 0.2;
+      if ( octree && !mesh->func.octreein(mesh,met,octree,ip,lfilt) ) {
+        _MMG3D_delPt(mesh,ip);
+        (*ifilt)++;
+        continue;
+      }
+
+      base = ++mesh->base;
+      for (kk=0; kk<lon; kk++)
+        mesh->tetra[cav[kk]].flag = base;
+
+      ret = _MMG5_delone(mesh,met,ip,cav,lon);
+      if ( ret > 0 ) {
+        if ( octree ) {
+          _MMG3D_addOctree(mesh,octree,ip);
+        }
+        (*ns)++;
+      }
+      else if ( ret == 0 ) {
+        _MMG3D_delPt(mesh,ip);
+      }
+      else { /*allocation problem ==> saveMesh*/
+        _MMG3D_delPt(mesh,ip);
+        for (++ic; ic<nc; ic++)
+          _MMG3D_delPt(mesh,cip[ic]);
+        ier = 0;
+        break;
+      }
+    }
+    if ( !ier )  break;
+  }
+
+  for (tid=0; tid<nth; tid++) {
+    _MMG5_SAFE_FREE(cm[tid].key);
+    _MMG5_SAFE_FREE(cm[tid].gen);
+  }
+  _MMG5_SAFE_FREE(cm);
+  _MMG5_SAFE_FREE(lists);
+  _MMG5_SAFE_FREE(ccav);
+  _MMG5_SAFE_FREE(clen);
+  _MMG5_SAFE_FREE(clon);
+  _MMG5_SAFE_FREE(cip);
+  _MMG5_SAFE_FREE(cedg);
+  _MMG5_SAFE_FREE(cel);
+  mesh->memCur -= memsiz;
+
+  return(ier);
+}
+#endif
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param met pointer toward the metric structure.
+ * \param octree pointer toward the octree structure.
+ * \return 0 if fail, 1 otherwise.
+ *
+ * Renumber the mesh if needed (see \ref _MMG5_scotchCall) and update the
+ * octree accordingly.
+ *
+ */
+static int
+_MMG3D_renumbering(MMG5_pMesh mesh,MMG5_pSol met,_MMG3D_pOctree octree) {
+  int ier;
+
+  /* the points of the octree are marked to be found after the renumbering */
+  if ( octree )  _MMG3D_markOctree(mesh,octree);
+
+  ier = _MMG5_scotchCall(mesh,met);
+  if ( !ier ) return(0);
+
+  if ( ier == 2 && octree ) {
+    if ( !_MMG3D_resetOctree(mesh,octree) ) return(0);
+  }
+  return(1);
+}
+
 /**
  * \param mesh pointer toward the mesh structure.
  * \param met pointer toward the metric structure.
@@ -848,7 +1085,8 @@ _MMG5_optbad(MMG5_pMesh mesh, MMG5_pSol met,_MMG3D_pOctree octree) {
  */
 static int
 _MMG5_adpsplcol(MMG5_pMesh mesh,MMG5_pSol met,_MMG3D_pOctree octree, int* warn) {
-  int        nfilt,ifilt,ne,ier;
+  int        nfilt,ifilt,ier;
+  MMG5_int   ne;
   int        ns,nc,it,nnc,nns,nnf,nnm,maxit,nf,nm,noptim;
   double     maxgap,dd;
 
@@ -857,6 +1095,11 @@ _MMG5_adpsplcol(MMG5_pMesh mesh,MMG5_pSol met,_MMG3D_pOctree octree, int* warn)
   noptim = 0;
   maxit = 50;
   mesh->gap = maxgap = 0.5;
+
+  /* The extreme edge lengths of the tetra that are not modified are kept
+   * from one sweep to the next */
+  _MMG3D_newLength(mesh);
+
   // MMG_npuiss = MMG_nvol = MMG_npres = MMG_npd = 0; // decomment to debug
   do {
     if ( !mesh->info.noinsert ) {
@@ -864,8 +1107,28 @@ _MMG5_adpsplcol(MMG5_pMesh mesh,MMG5_pSol met,_MMG3D_pOctree octree, int* warn)
       ns = nc = 0;
       ifilt = 0;
       ne = mesh->ne;
+
+      /* The points do not move during the insertions: the circumspheres of
+       * the tetra can be kept from one cavity to the next (iso only, the
+       * aniso sphere depends on the metric of the inserted point) */
+      if ( mesh->func.cavity == _MMG5_cavity_iso )  _MMG3D_newSphere(mesh);
+
+#ifdef _OPENMP
+      if ( mesh->info.nthreads > 1 ) {
+        ier = _MMG5_boucle_forPar(mesh,met,octree,ne,&ifilt,&ns,warn);
+        if ( ier<=0 ) {
+          _MMG3D_freeSphere(mesh);
+          _MMG3D_freeLength(mesh);
+          return -1;
+        }
+      }
+#endif
       ier = _MMG5_boucle_for(mesh,met,octree,ne,&ifilt,&ns,&nc,warn,it);
-      if ( ier<=0 ) return -1;
+      _MMG3D_freeSphere(mesh);
+      if ( ier<=0 ) {
+        _MMG3D_freeLength(mesh);
+        return -1;
+      }
     } /* End conditional loop on mesh->info.noinsert */
     else  ns = nc = ifilt = 0;
 
@@ -874,6 +1137,7 @@ _MMG5_adpsplcol(MMG5_pMesh mesh,MMG5_pSol met,_MMG3D_pOctree octree, int* warn)
       if ( nf < 0 ) {
         fprintf(stderr,"\n  ## Error: %s: unable to improve mesh. Exiting.\n",
           __func__);
+        _MMG3D_freeLength(mesh);
         return(0);
       }
       nnf += nf;
@@ -882,6 +1146,7 @@ _MMG5_adpsplcol(MMG5_pMesh mesh,MMG5_pSol met,_MMG3D_pOctree octree, int* warn)
       if ( nf < 0 ) {
         fprintf(stderr,"\n  ## Error: %s: unable to improve mesh. Exiting.\n",
           __func__);
+        _MMG3D_freeLength(mesh);
         return(0);
       }
     } else {
@@ -895,6 +1160,7 @@ _MMG5_adpsplcol(MMG5_pMesh mesh,MMG5_pSol met,_MMG3D_pOctree octree, int* warn)
 
       if ( nm < 0 ) {
         fprintf(stderr,"\n  ## Error: %s: Unable to improve mesh.\n",__func__);
+        _MMG3D_freeLength(mesh);
         return(0);
       }
     }
@@ -935,6 +1201,8 @@ _MMG5_adpsplcol(MMG5_pMesh mesh,MMG5_pSol met,_MMG3D_pOctree octree, int* warn)
   }
   while( ++it < maxit && (noptim || nc+ns > 0) );
 
+  _MMG3D_freeLength(mesh);
+
   if ( mesh->info.imprim > 0 ) {
     if ( (abs(mesh->info.imprim) < 5) && ( nnc || nns ) ) {
       fprintf(stdout,"     %8d filtered, %8d splitted, %8d collapsed,"
@@ -1178,7 +1446,7 @@ _MMG5_adptet_delone(MMG5_pMesh mesh,MMG5_pSol met,_MMG3D_pOctree octree) {
   }
 
   /* renumerotation if available */
-  if ( !_MMG5_scotchCall(mesh,met) )
+  if ( !_MMG3D_renumbering(mesh,met,octree) )
     return(0);
 
   if(mesh->info.optimLES) {
@@ -1229,7 +1497,7 @@ int _MMG5_mmg3d1_delone(MMG5_pMesh mesh,MMG5_pSol met) {
     fprintf(stdout,"  ** COMPUTATIONAL MESH\n");
 
   /* define metric map */
-  if ( !_MMG5_defsiz(mesh,met) ) {
+  if ( !mesh->func.defsiz(mesh,met) ) {
     fprintf(stderr,"\n  ## Metric undefined. Exit program.\n");
     if ( octree )
       /*free octree*/
@@ -1239,7 +1507,7 @@ int _MMG5_mmg3d1_delone(MMG5_pMesh mesh,MMG5_pSol met) {
 
   if ( mesh->info.hgrad > 0. ) {
     if ( mesh->info.imprim > 0 )   fprintf(stdout,"\n  -- GRADATION : %8f\n",exp(mesh->info.hgrad));
-    if ( !_MMG5_gradsiz(mesh,met) ) {
+    if ( !mesh->func.gradsiz(mesh,met) ) {
       fprintf(stderr,"\n  ## Gradation problem. Exit program.\n");
       if ( octree )
         /*free octree*/
@@ -1259,6 +1527,9 @@ int _MMG5_mmg3d1_delone(MMG5_pMesh mesh,MMG5_pSol met) {
     return(0);
   }
 
+  /* size the tables for the adapted mesh */
+  if ( !_MMG3D_presize(mesh,met) )  return(0);
+
 #ifdef DEBUG
   puts("---------------------------Fin anatet---------------------");
   _MMG3D_outqua(mesh,met);
@@ -54,13 +54,14 @@ static int _MMG5_adpspl(MMG5_pMesh mesh,MMG5_pSol met, int* warn) {
  MMG5_Tria    ptt;
  MMG5_pPoint  p0,p1,ppt;
  MMG5_pxPoint pxp;
- double       dd,len,lmax,o[3],to[3],no1[3],no2[3],v[3];
- int          k,ip,ip1,ip2,list[MMG3D_LMAX+2],ilist;
+ double       dd,lmin,lmax,o[3],to[3],no1[3],no2[3],v[3];
+ int          ilist;
+ MMG5_int     ip1,ip2,ip,list[MMG3D_LMAX+2],k;
  int          ns,ref,ier;
  int16_t      tag;
- char         imax,j,i,i1,i2,ifa0,ifa1;
+ char         imin,imax,j,i,i1,i2,ifa0,ifa1;
  char         chkRidTet;
- static char  mmgWarn    = 0;
+ static _MMG5_TLS char  mmgWarn    = 0;
 
   *warn=0;
   ns = 0;
@@ -73,17 +74,8 @@ static int _MMG5_adpspl(MMG5_pMesh mesh,MMG5_pSol met, int* warn) {
     if ( !MG_EOK(pt) || (pt->tag & MG_REQ) )   continue;
     pxt = pt->xt ? &mesh->xtetra[pt->xt] : 0;
 
-    /* find longest edge */
-    imax = -1; lmax = 0.0;
-    for (i=0; i<6; i++) {
-      if ( pt->xt && (pxt->tag[i] & MG_REQ) )  continue;
-      len = _MMG5_lenedg(mesh,met,i,pt);
-
-      if ( len > lmax ) {
-        lmax = len;
-        imax = i;
-      }
-    }
+    /* find longest edge (the shortest one is cached for _MMG5_adpcol) */
+    _MMG3D_extLength(mesh,met,k,1,&imin,&lmin,&imax,&lmax);
     if ( imax==-1 ) {
       if ( !mmgWarn ) {
         fprintf(stderr,
@@ -167,7 +159,7 @@ static int _MMG5_adpspl(MMG5_pMesh mesh,MMG5_pSol met, int* warn) {
                             ,o,tag,-1);
       }
       if ( met->m ) {
-        ier = _MMG5_intmet(mesh,met,k,imax,ip,0.5);
+        ier = mesh->func.intmet(mesh,met,k,imax,ip,0.5);
         if ( !ier ) {
           _MMG3D_delPt(mesh,ip);
           return(-1);
@@ -240,7 +232,7 @@ static int _MMG5_adpspl(MMG5_pMesh mesh,MMG5_pSol met, int* warn) {
                             ,o,MG_NOTAG,-1);
       }
       if ( met->m ) {
-        ier = _MMG5_intmet(mesh,met,k,imax,ip,0.5);
+        ier = mesh->func.intmet(mesh,met,k,imax,ip,0.5);
         if ( !ier ) {
           _MMG3D_delPt(mesh,ip);
           return(-1);
@@ -284,12 +276,12 @@ static int _MMG5_adpcol(MMG5_pMesh mesh,MMG5_pSol met) {
   MMG5_pTetra     pt;
   MMG5_pxTetra    pxt;
   MMG5_pPoint     p0,p1;
-  double     len,lmin;
-  int        k,ip,iq,list[MMG3D_LMAX+2],ilist,lists[MMG3D_LMAX+2],ilists,nc;
-  int        ier;
+  double     lmin,lmax;
+  int        ilist,ilists,nc;
+  MMG5_int   ip,iq,ier,list[MMG3D_LMAX+2],lists[MMG3D_LMAX+2],k;
   int16_t    tag;
-  char       imin,j,i,i1,i2,ifa0,ifa1;
-  static char mmgWarn = 0;
+  char       imin,imax,j,i,i1,i2,ifa0,ifa1;
+  static _MMG5_TLS char mmgWarn = 0;
 
   nc = 0;
   for (k=1; k<=mesh->ne; k++) {
@@ -298,16 +290,7 @@ static int _MMG5_adpcol(MMG5_pMesh mesh,MMG5_pSol met) {
     pxt = pt->xt ? &mesh->xtetra[pt->xt] : 0;
 
     /* find shortest edge */
-    imin = -1; lmin = DBL_MAX;
-    for (i=0; i<6; i++) {
-      if ( pt->xt && (pxt->tag[i] & MG_REQ) )  continue;
-      len = _MMG5_lenedg(mesh,met,i,pt);
-
-      if ( len < lmin ) {
-        lmin = len;
-        imin = i;
-      }
-    }
+    _MMG3D_extLength(mesh,met,k,1,&imin,&lmin,&imax,&lmax);
     if ( imin==-1 ) {
       if ( !mmgWarn ) {
         fprintf(stderr,
@@ -389,29 +372,42 @@ static int _MMG5_adptet(MMG5_pMesh mesh,MMG5_pSol met) {
   maxit = 10;
   mesh->gap = maxgap = 0.5;
   do {
+    /* The points do not move during the splits and collapses: the edge
+     * lengths of the tetra that are not modified by the splits can be reused
+     * by the collapses */
+    _MMG3D_newLength(mesh);
+
     if ( !mesh->info.noinsert ) {
       ns = _MMG5_adpspl(mesh,met,&warn);
       if ( ns < 0 ) {
         fprintf(stderr,"\n  ## Error: %s: unable to complete mesh."
                 " Exit program.\n",__func__);
+        _MMG3D_freeLength(mesh);
         return(0);
       }
     }
     else  ns = 0;
 
-    /* renumbering if available and needed */
-    if ( it==1 && !_MMG5_scotchCall(mesh,met) )
-      return(0);
+    /* renumbering if available and needed (the renumbering changes the
+     * vertices of the cached tetra) */
+    if ( it==1 ) {
+      _MMG3D_freeLength(mesh);
+      if ( !_MMG5_scotchCall(mesh,met) )
+        return(0);
+      _MMG3D_newLength(mesh);
+    }
 
     if ( !mesh->info.noinsert ) {
       nc = _MMG5_adpcol(mesh,met);
       if ( nc < 0 ) {
         fprintf(stderr,"\n  ## Error: %s: unable to complete mesh."
                 " Exit program.\n",__func__);
+        _MMG3D_freeLength(mesh);
         return(0);
       }
     }
     else  nc = 0;
+    _MMG3D_freeLength(mesh);
 
     if ( !mesh->info.nomove ) {
       nm = _MMG5_movtet(mesh,met,NULL,1.,1.,1,0,0,0,1);
@@ -581,14 +577,14 @@ int _MMG5_mmg3d1_pattern(MMG5_pMesh mesh,MMG5_pSol met) {
     fprintf(stdout,"  ** COMPUTATIONAL MESH\n");
 
   /* define metric map */
-  if ( !_MMG5_defsiz(mesh,met) ) {
+  if ( !mesh->func.defsiz(mesh,met) ) {
     fprintf(stderr,"\n  ## Metric undefined. Exit program.\n");
     return(0);
   }
 
   if ( mesh->info.hgrad > 0. ) {
     if ( mesh->info.imprim > 0 )   fprintf(stdout,"\n  -- GRADATION : %8f\n",exp(mesh->info.hgrad));
-    if ( !_MMG5_gradsiz(mesh,met) ) {
+    if ( !mesh->func.gradsiz(mesh,met) ) {
       fprintf(stderr,"\n  ## Gradation problem. Exit program.\n");
       return(0);
     }
@@ -602,6 +598,9 @@ int _MMG5_mmg3d1_pattern(MMG5_pMesh mesh,MMG5_pSol met) {
     return(0);
   }
 
+  /* size the tables for the adapted mesh */
+  if ( !_MMG3D_presize(mesh,met) )  return(0);
+
   /* renumbering if available */
   if ( !_MMG5_scotchCall(mesh,met) )
     return(0);
@@ -35,7 +35,6 @@
 
 #include "mmg3d.h"
 
-extern char  ddb;
 
 /**
  * \remark Not used.
@@ -88,19 +87,20 @@ _MMG5_invsl(double A[3][3],double b[3],double r[3]) {
  */
 
 static int
-_MMG5_ismaniball(MMG5_pMesh mesh,MMG5_pSol sol,int k,int indp) {
+_MMG5_ismaniball(MMG5_pMesh mesh,MMG5_pSol sol,MMG5_int k,int indp) {
   MMG5_pTetra  pt,pt1;
   double       v,v0,v1,v2;
-  int         *adja,list[MMG3D_LMAX+1],bdy[MMG3D_LMAX+1],ibdy,np,ilist,base,cur,iel,jel,res,l;
+  int         ibdy,ilist,base,cur,l;
+  MMG5_int    np,*adja,jel,list[MMG3D_LMAX+1],res,bdy[MMG3D_LMAX+1],iel;
   char         i,i0,i1,i2,j0,j1,j2,j,ip,nzeros,nopp,nsame;
-  static char  mmgWarn0 = 0;
+  static _MMG5_TLS char  mmgWarn0 = 0;
 
   pt = &mesh->tetra[k];
   np = pt->v[indp];
   if ( fabs(sol->m[np]-mesh->info.ls) > _MMG5_EPSD2 )  return(1);
 
-  memset(bdy,0,(MMG3D_LMAX+1)*sizeof(int));
-  memset(list,0,(MMG3D_LMAX+1)*sizeof(int));
+  memset(bdy,0,(MMG3D_LMAX+1)*sizeof(MMG5_int));
+  memset(list,0,(MMG3D_LMAX+1)*sizeof(MMG5_int));
 
   /* Sign of a starting point in ball of np */
   for (j=0; j<3; j++) {
@@ -249,7 +249,7 @@ _MMG5_ismaniball(MMG5_pMesh mesh,MMG5_pSol sol,int k,int indp) {
   base = ++mesh->base;
   pt->flag = base;
 
-  memset(list,0,(MMG3D_LMAX+1)*sizeof(int));
+  memset(list,0,(MMG3D_LMAX+1)*sizeof(MMG5_int));
   ilist = cur = 0;
   list[ilist] = res;
   ilist++;
@@ -352,7 +352,8 @@ _MMG5_ismaniball(MMG5_pMesh mesh,MMG5_pSol sol,int k,int indp) {
 static int _MMG3D_snpval_ls(MMG5_pMesh mesh,MMG5_pSol sol,double *tmp) {
   MMG5_pTetra   pt;
   MMG5_pPoint   p0;
-  int      k,nc,ns,ip;
+  int      nc,ns;
+  MMG5_int ip,k;
   char     i;
 
   /* create tetra adjacency */
@@ -373,7 +374,7 @@ static int _MMG3D_snpval_ls(MMG5_pMesh mesh,MMG5_pSol sol,double *tmp) {
     if ( !MG_VOK(p0) ) continue;
     if ( fabs(sol->m[k]-mesh->info.ls) < _MMG5_EPS ) {
       if ( mesh->info.ddebug )
-        fprintf(stderr,"  ## Warning: %s: snapping value %d; "
+        fprintf(stderr,"  ## Warning: %s: snapping value %" MMG5_PRId "; "
                 "previous value: %E.\n",__func__,k,fabs(sol->m[k]));
 
       tmp[k] = ( fabs(sol->m[k]-mesh->info.ls) < _MMG5_EPSD ) ?
@@ -406,7 +407,7 @@ static int _MMG3D_snpval_ls(MMG5_pMesh mesh,MMG5_pSol sol,double *tmp) {
     fprintf(stdout,"     %8d points snapped, %d corrected\n",ns,nc);
 
   /* memory free */
-  _MMG5_DEL_MEM(mesh,mesh->adja,(4*mesh->nemax+5)*sizeof(int));
+  _MMG5_DEL_MEM(mesh,mesh->adja,(4*mesh->nemax+5)*sizeof(MMG5_int));
 
   return(1);
 }
@@ -426,9 +427,10 @@ static int _MMG3D_cuttet_ls(MMG5_pMesh mesh, MMG5_pSol sol/*,double *tmp*/){
   MMG5_pPoint   p0,p1;
   _MMG5_Hash    hash;
   double        c[3],v0,v1,s;
-  int           vx[6],nb,k,ip0,ip1,np,ns,ne,ier;
+  int           nb,ns,ier;
+  MMG5_int      ip0,ip1,ne,np,vx[6],k;
   char          ia,j,npneg;
-  static char   mmgWarn = 0;
+  static _MMG5_TLS char   mmgWarn = 0;
   /* Commented because unused */
   /*MMG5_pPoint  p[4];*/
   /*double   *grad,A[3][3],b[3],*g0,*g1,area,a,d,dd,s1,s2;*/
@@ -630,7 +632,7 @@ static int _MMG3D_cuttet_ls(MMG5_pMesh mesh, MMG5_pSol sol/*,double *tmp*/){
     pt = &mesh->tetra[k];
     if ( !MG_EOK(pt) || (pt->tag & MG_REQ) )  continue;
     pt->flag = 0;
-    memset(vx,0,6*sizeof(int));
+    memset(vx,0,6*sizeof(MMG5_int));
     for (ia=0; ia<6; ia++) {
       vx[ia] = _MMG5_hashGet(&hash,pt->v[_MMG5_iare[ia][0]],pt->v[_MMG5_iare[ia][1]]);
       if ( vx[ia] > 0 )  MG_SET(pt->flag,ia);
@@ -666,7 +668,7 @@ static int _MMG3D_cuttet_ls(MMG5_pMesh mesh, MMG5_pSol sol/*,double *tmp*/){
   if ( (mesh->info.ddebug || abs(mesh->info.imprim) > 5) && ns > 0 )
     fprintf(stdout,"     %7d splitted\n",ns);
 
-  _MMG5_DEL_MEM(mesh,hash.item,(hash.max+1)*sizeof(_MMG5_hedge));
+  _MMG5_DEL_MEM(mesh,hash.item,hash.siz*sizeof(_MMG5_hedge));
   return(ns);
 }
 
@@ -682,7 +684,7 @@ static int _MMG3D_cuttet_ls(MMG5_pMesh mesh, MMG5_pSol sol/*,double *tmp*/){
 static int _MMG3D_setref_ls(MMG5_pMesh mesh, MMG5_pSol sol) {
   MMG5_pTetra   pt;
   double        v;
-  int      k,ip;
+  MMG5_int ip,k;
   char     nmns,npls,nz,i;
 
   for (k=1; k<=mesh->ne; k++) {
@@ -722,10 +724,11 @@ static int _MMG3D_setref_ls(MMG5_pMesh mesh, MMG5_pSol sol) {
  * Beware : may return 0 when implicit boundary is tangent to outer boundary
  *
  */
-int _MMG5_chkmaniball(MMG5_pMesh mesh, int start, char ip){
+int _MMG5_chkmaniball(MMG5_pMesh mesh, MMG5_int start, char ip){
   MMG5_pTetra    pt,pt1;
-  int       ref,base,ilist,nump,k,cur,k1,nref;
-  int       *adja,list[MMG3D_LMAX+2];
+  int       ref,base,ilist,cur,nref;
+  MMG5_int  nump,k1,k;
+  MMG5_int  *adja,list[MMG3D_LMAX+2];
   char      i,l,j;
 
   base = ++mesh->base;
@@ -816,7 +819,7 @@ int _MMG5_chkmaniball(MMG5_pMesh mesh, int start, char ip){
     pt = &mesh->tetra[k];
     if( pt->ref == ref ) {
       fprintf(stderr,"   *** Topological problem:");
-      fprintf(stderr," non manifold surface at point %d \n",nump);
+      fprintf(stderr," non manifold surface at point %" MMG5_PRId " \n",nump);
       return(0);
     }
   }
@@ -827,10 +830,10 @@ int _MMG5_chkmaniball(MMG5_pMesh mesh, int start, char ip){
 /** Check whether implicit surface enclosed in volume is orientable */
 int _MMG5_chkmani(MMG5_pMesh mesh){
   MMG5_pTetra  pt,pt1;
-  int          k,iel,ref;
-  int         *adja;
+  int          ref;
+  MMG5_int    *adja,iel,k;
   char         i,j,ip,cnt;
-  static char  mmgWarn0 = 0;
+  static _MMG5_TLS char  mmgWarn0 = 0;
 
   for(k=1; k<=mesh->np; k++){
     mesh->point[k].flag = 0;
@@ -901,8 +904,7 @@ int _MMG5_chkmani(MMG5_pMesh mesh){
  */
 int _MMG5_chkmani2(MMG5_pMesh mesh,MMG5_pSol sol) {
   MMG5_pTetra    pt,pt1;
-  int       k,iel;
-  int       *adja;
+  MMG5_int  *adja,iel,k;
   char      i,j,ip,cnt;
 
   for(k=1; k<=mesh->np; k++){
@@ -919,7 +921,7 @@ int _MMG5_chkmani2(MMG5_pMesh mesh,MMG5_pSol sol) {
       if( sol->m[pt->v[j]]-mesh->info.ls == 0.0 ) cnt++;
     }
     if(cnt == 4) {
-      fprintf(stderr,"\n  ## Error: %s: tetra %d: 4 vertices on implicit boundary.\n",
+      fprintf(stderr,"\n  ## Error: %s: tetra %" MMG5_PRId ": 4 vertices on implicit boundary.\n",
               __func__,k);
       return 0;
     }
@@ -942,7 +944,7 @@ int _MMG5_chkmani2(MMG5_pMesh mesh,MMG5_pSol sol) {
 
         if(!_MMG5_chkmaniball(mesh,k,ip)){
           fprintf(stderr,"\n  ## Error: %s: non orientable implicit surface:"
-                  " ball of point %d.\n",__func__,pt->v[ip]);
+                  " ball of point %" MMG5_PRId ".\n",__func__,pt->v[ip]);
           return 0;
         }
       }
@@ -968,10 +970,11 @@ int _MMG5_chkmani2(MMG5_pMesh mesh,MMG5_pSol sol) {
  * not in shell of (np,nq).
  *
  */
-int _MMG5_chkmanicoll(MMG5_pMesh mesh,int k,int iface,int iedg,int ndepmin,int ndepplus,char isminp,char isplp) {
+int _MMG5_chkmanicoll(MMG5_pMesh mesh,MMG5_int k,int iface,int iedg,MMG5_int ndepmin,MMG5_int ndepplus,char isminp,char isplp) {
   MMG5_pTetra    pt,pt1;
-  int       nump,numq,ilist,ref,cur,stor,iel,jel,base,ndepmq,ndeppq;
-  int       list[MMG3D_LMAX+2],*adja,*adja1;
+  int       ilist,ref,cur,base;
+  MMG5_int  nump,numq,jel,ndepmq,ndeppq,stor,iel;
+  MMG5_int  *adja,*adja1,list[MMG3D_LMAX+2];
   char      i,j,ip,jp,iq,jq,voy,indp,indq,isminq,isplq,ismin,ispl;
 
   ilist = 0;
@@ -1045,7 +1048,7 @@ int _MMG5_chkmanicoll(MMG5_pMesh mesh,int k,int iface,int iedg,int ndepmin,int n
       cur++;
     }
 
-    memset(list,0,(MMG3D_LMAX+2)*sizeof(int));
+    memset(list,0,(MMG3D_LMAX+2)*sizeof(MMG5_int));
     ilist = 0;
   }
 
@@ -1432,7 +1435,7 @@ int _MMG5_chkmanicoll(MMG5_pMesh mesh,int k,int iface,int iedg,int ndepmin,int n
         /* Only tets of the shell of (np,nq) can be added, unless future ball is non manifold */
         if ( indq == -1 ) {
           fprintf(stderr,"\n  ## Warning: %s: we should rarely passed here. "
-                  "tetra %d =  %d %d %d %d, ref = %d.",__func__,
+                  "tetra %" MMG5_PRId " =  %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId ", ref = %d.",__func__,
                   jel,pt1->v[0],pt1->v[1],pt1->v[2],pt1->v[3],pt1->ref);
           return(0);
         }
@@ -1473,7 +1476,7 @@ int _MMG5_chkmanicoll(MMG5_pMesh mesh,int k,int iface,int iedg,int ndepmin,int n
         /* Only tets of the shell of (np,nq) can be added, unless future ball is non manifold */
         if ( indp == -1 ) {
           fprintf(stderr,"\n  ## Warning: %s: we should rarely passed here. "
-                  "tetra %d =  %d %d %d %d, ref = %d\n",__func__,
+                  "tetra %" MMG5_PRId " =  %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId ", ref = %d\n",__func__,
                   jel,pt1->v[0],pt1->v[1],pt1->v[2],pt1->v[3],pt1->ref);
           return(0);
         }
@@ -1553,7 +1556,7 @@ int _MMG3D_mmg3d2(MMG5_pMesh mesh,MMG5_pSol sol) {
     return(0);
   }
 
-  _MMG5_DEL_MEM(mesh,mesh->adja,(4*mesh->nemax+5)*sizeof(int));
+  _MMG5_DEL_MEM(mesh,mesh->adja,(4*mesh->nemax+5)*sizeof(MMG5_int));
   _MMG5_DEL_MEM(mesh,mesh->tria,(mesh->nt+1)*sizeof(MMG5_Tria));
 
   mesh->nt = 0;
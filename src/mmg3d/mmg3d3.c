@@ -41,13 +41,13 @@
 
 #define _MMG5_DEGTOL  1.e-1
 
-extern char  ddb;
 
 /** Calculate an estimate of the average (isotropic) length of edges in the mesh */
 double _MMG5_estavglen(MMG5_pMesh mesh) {
   MMG5_pTetra    pt;
   MMG5_pPoint    p1,p2;
-  int       k,na;
+  int       na;
+  MMG5_int  k;
   double    len,lent,dna;
   char      i,i1,i2;
   
@@ -107,9 +107,10 @@ static int _MMG5_spllag(MMG5_pMesh mesh,MMG5_pSol disp,MMG5_pSol met,int itdeg,
   MMG5_pPoint  p0,p1;
   double       len,lmax,o[3],hma2;
   double      *m1,*m2,*mp;
-  int          k,ip,ip1,ip2,list[MMG3D_LMAX+2],ilist,ns,ier,iadr;
+  int          ip,ip1,ip2,list[MMG3D_LMAX+2],ilist,ns,ier,iadr;
+  MMG5_int     k;
   char         imax,i,i1,i2;
-  static char  mmgWarn0 = 0;
+  static _MMG5_TLS char  mmgWarn0 = 0;
   
   *warn=0;
   ns = 0;
@@ -179,7 +180,7 @@ static int _MMG5_spllag(MMG5_pMesh mesh,MMG5_pSol disp,MMG5_pSol met,int itdeg,
     
     /* Interpolation of metric, if any */
     if ( met->m ) {
-      if ( !_MMG5_intmet(mesh,met,k,imax,ip,0.5) ) {
+      if ( !mesh->func.intmet(mesh,met,k,imax,ip,0.5) ) {
         _MMG3D_delPt(mesh,ip);
         return(-1);
       }
@@ -231,7 +232,8 @@ static int _MMG5_spllag(MMG5_pMesh mesh,MMG5_pSol disp,MMG5_pSol met,int itdeg,
 int _MMG5_swptetlag(MMG5_pMesh mesh,MMG5_pSol met,double crit,_MMG3D_pOctree octree,int itdeg) {
   MMG5_pTetra   pt;
   MMG5_pxTetra  pxt;
-  int      list[MMG3D_LMAX+2],ilist,k,it,nconf,maxit,ns,nns,ier;
+  int      list[MMG3D_LMAX+2],ilist,it,nconf,maxit,ns,nns,ier;
+  MMG5_int k;
   char     i;
   
   maxit = 2;
@@ -279,7 +281,8 @@ int _MMG5_swptetlag(MMG5_pMesh mesh,MMG5_pSol met,double crit,_MMG3D_pOctree oct
 int _MMG5_movtetlag(MMG5_pMesh mesh,MMG5_pSol met, int itdeg) {
   MMG5_pTetra        pt;
   MMG5_pPoint        ppt;
-  int           k,ier,nm,nnm,listv[MMG3D_LMAX+2],ilistv,it;
+  int           ier,nm,nnm,listv[MMG3D_LMAX+2],ilistv,it;
+  MMG5_int      k;
   unsigned char i,base;
   int           maxit;
   
@@ -338,7 +341,8 @@ static int _MMG5_coltetlag(MMG5_pMesh mesh,MMG5_pSol met,int itdeg) {
   MMG5_pTetra     pt;
   MMG5_pPoint     p0,p1;
   double     ll,ux,uy,uz,hmi2;
-  int        k,nc,list[MMG3D_LMAX+2],ilist,base,nnm;
+  int        nc,list[MMG3D_LMAX+2],ilist,base,nnm;
+  MMG5_int   k;
   int        ier;
   char       i,j,ip,iq,isnm;
 
@@ -406,7 +410,8 @@ int _MMG5_chkmovmesh(MMG5_pMesh mesh,MMG5_pSol disp,short t) {
   MMG5_pTetra  pt;
   MMG5_pPoint  ppt;
   double       *v,c[4][3],tau;
-  int          k,np;
+  int          np;
+  MMG5_int     k;
   char         i,j;
   
   /* Pseudo time-step = fraction of disp to perform */
@@ -477,7 +482,8 @@ int _MMG5_dispmesh(MMG5_pMesh mesh,MMG5_pSol disp,short t,int itdeg) {
   MMG5_pTetra   pt;
   MMG5_pPoint   ppt;
   double        *v,tau,ctau,c[4][3],ocal,ncal;
-  int           k,np;
+  int           np;
+  MMG5_int      k;
   char          i,j;
   
   tau = (double)t /_MMG3D_SHORTMAX;
@@ -530,7 +536,7 @@ int _MMG5_dispmesh(MMG5_pMesh mesh,MMG5_pSol disp,short t,int itdeg) {
 /** For debugging purposes: save disp */
 int _MMG5_saveDisp(MMG5_pMesh mesh,MMG5_pSol disp) {
   FILE        *out;
-  int         k;
+  MMG5_int    k;
   char        data[256],*ptr;
   
   strcpy(data,disp->namein);
@@ -557,7 +563,8 @@ int _MMG5_saveDisp(MMG5_pMesh mesh,MMG5_pSol disp) {
 /** Lagrangian node displacement and meshing */
 int _MMG5_mmg3d3(MMG5_pMesh mesh,MMG5_pSol disp,MMG5_pSol met) {
   double  avlen,tau;
-  int     itdc,itmn,maxitmn,maxitdc,nspl,ns,nm,nc,iit,k,warn;
+  int     itdc,itmn,maxitmn,maxitdc,nspl,ns,nm,nc,iit,warn;
+  MMG5_int k;
   int     nns,nnm,nnc,nnspl,nnns,nnnm,nnnc,nnnspl;
   short   t;
   char    ier;
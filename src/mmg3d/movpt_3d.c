@@ -53,23 +53,21 @@
  *
  */
 int _MMG5_movintpt_iso(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree,
-                       int *list,int ilist,int improve) {
-  MMG5_pTetra               pt,pt0;
-  MMG5_pPoint               p0,p1,p2,p3,ppt0;
-  double               vol,totvol;
+                       MMG5_int *list,int ilist,int improve) {
+  MMG5_pTetra               pt;
+  MMG5_pPoint               p0,p1,p2,p3,ppt;
+  double               vol,totvol,c[3],oldc[3];
   double               calold,calnew,*callist;
   double len1,len2;
   int    iloc;
-  int                  k,iel,i0;
+  int                  k;
+  MMG5_int             iel,i0;
 
   // Dynamic alloc for windows comptibility
   _MMG5_SAFE_MALLOC(callist, ilist, double,0);
 
-  pt0    = &mesh->tetra[0];
-  ppt0   = &mesh->point[0];
-  memset(ppt0,0,sizeof(MMG5_Point));
-
   /* Coordinates of optimal point */
+  c[0] = c[1] = c[2] = 0.;
   calold = DBL_MAX;
   totvol = 0.0;
   for (k=0; k<ilist; k++) {
@@ -83,9 +81,9 @@ int _MMG5_movintpt_iso(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree,
     vol= _MMG5_det4pt(p0->c,p1->c,p2->c,p3->c);
     totvol += vol;
     /* barycenter */
-    ppt0->c[0] += 0.25 * vol*(p0->c[0] + p1->c[0] + p2->c[0] + p3->c[0]);
-    ppt0->c[1] += 0.25 * vol*(p0->c[1] + p1->c[1] + p2->c[1] + p3->c[1]);
-    ppt0->c[2] += 0.25 * vol*(p0->c[2] + p1->c[2] + p2->c[2] + p3->c[2]);
+    c[0] += 0.25 * vol*(p0->c[0] + p1->c[0] + p2->c[0] + p3->c[0]);
+    c[1] += 0.25 * vol*(p0->c[1] + p1->c[1] + p2->c[1] + p3->c[1]);
+    c[2] += 0.25 * vol*(p0->c[2] + p1->c[2] + p2->c[2] + p3->c[2]);
     calold = MG_MIN(calold, pt->qual);
   }
   if (totvol < _MMG5_EPSD2) {
@@ -94,44 +92,53 @@ int _MMG5_movintpt_iso(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree,
   }
 
   totvol = 1.0 / totvol;
-  ppt0->c[0] *= totvol;
-  ppt0->c[1] *= totvol;
-  ppt0->c[2] *= totvol;
-
-  /* Check new position validity */
+  c[0] *= totvol;
+  c[1] *= totvol;
+  c[2] *= totvol;
+
+  /* Check new position validity: the point is moved in place (and restored
+   * if the move is rejected), so only its ball is read and written */
+  ppt = &mesh->point[mesh->tetra[list[0]/4].v[list[0]%4]];
+  memcpy(oldc,ppt->c,3*sizeof(double));
   calnew = DBL_MAX;
   for (k=0; k<ilist; k++) {
     iel = list[k] / 4;
     i0  = list[k] % 4;
     pt  = &mesh->tetra[iel];
-    memcpy(pt0,pt,sizeof(MMG5_Tetra));
-    pt0->v[i0] = 0;
-    callist[k] = _MMG5_orcal(mesh,met,0);
-    if (callist[k] < _MMG5_NULKAL) {
-      _MMG5_SAFE_FREE(callist);
-      return(0);
-    }
-    calnew = MG_MIN(calnew,callist[k]);
 
     if ( improve==2 ) {
       for ( iloc = 0; iloc < 3; ++iloc ) {
+        memcpy(ppt->c,oldc,3*sizeof(double));
         len1 =  _MMG5_lenedg_iso(mesh,met,_MMG5_arpt[i0][iloc],pt);
-        len2 =  _MMG5_lenedg_iso(mesh,met,_MMG5_arpt[i0][iloc],pt0);
+        memcpy(ppt->c,c,3*sizeof(double));
+        len2 =  _MMG5_lenedg_iso(mesh,met,_MMG5_arpt[i0][iloc],pt);
         if ( (len1 < _MMG3D_LOPTL && len2 >= _MMG3D_LOPTL) ||
              (len1 > _MMG3D_LOPTL && len2 >len1 ) ) {
+          memcpy(ppt->c,oldc,3*sizeof(double));
           _MMG5_SAFE_FREE(callist);
           return 0;
         }
 
         if ( (len1 > _MMG3D_LOPTS && len2 <= _MMG3D_LOPTS) ||
              (len1 < _MMG3D_LOPTS && len2 <len1 ) ) {
+          memcpy(ppt->c,oldc,3*sizeof(double));
           _MMG5_SAFE_FREE(callist);
           return 0;
         }
       }
     }
 
+    memcpy(ppt->c,c,3*sizeof(double));
+    callist[k] = mesh->func.caltet(mesh,met,pt);
+    if (callist[k] < _MMG5_NULKAL) {
+      memcpy(ppt->c,oldc,3*sizeof(double));
+      _MMG5_SAFE_FREE(callist);
+      return(0);
+    }
+    calnew = MG_MIN(calnew,callist[k]);
   }
+  memcpy(ppt->c,oldc,3*sizeof(double));
+
   if (calold < _MMG5_EPSOK && calnew <= calold) {
     _MMG5_SAFE_FREE(callist);
     return(0);
@@ -151,12 +158,11 @@ int _MMG5_movintpt_iso(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree,
 
   /* update position */
   if ( octree )
-    _MMG3D_moveOctree(mesh, octree, pt->v[i0], ppt0->c, p0->c);
+    _MMG3D_moveOctree(mesh, octree, pt->v[i0], c, p0->c);
 
-  p0 = &mesh->point[pt->v[i0]];
-  p0->c[0] = ppt0->c[0];
-  p0->c[1] = ppt0->c[1];
-  p0->c[2] = ppt0->c[2];
+  ppt->c[0] = c[0];
+  ppt->c[1] = c[1];
+  ppt->c[2] = c[2];
   for (k=0; k<ilist; k++) {
     (&mesh->tetra[list[k]/4])->qual=callist[k];
     (&mesh->tetra[list[k]/4])->mark=mesh->mark;
@@ -311,7 +317,7 @@ int _MMG5_movintptLES_iso(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree,
        iel = list[k] / 4;
        pt  = &mesh->tetra[iel];
        memcpy(pt0,pt,sizeof(MMG5_Tetra));
-       callist[k] = _MMG5_caltet(mesh,met,pt0);//_MMG5_orcal(mesh,met,0);
+       callist[k] = mesh->func.caltet(mesh,met,pt0);//_MMG5_orcal(mesh,met,0);
        if (calold < _MMG5_EPSOK && callist[k] <= calold) {
          break;
        } else if ((callist[k] < _MMG5_EPSOK)) {
@@ -365,8 +371,8 @@ int _MMG5_movintptLES_iso(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree,
  *
  * \remark the metric is not interpolated at the new position.
  */
-int _MMG5_movbdyregpt_iso(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree, int *listv,
-                          int ilistv,int *lists,int ilists,
+int _MMG5_movbdyregpt_iso(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree, MMG5_int *listv,
+                          int ilistv,MMG5_int *lists,int ilists,
                           int improveSurf,int improveVol) {
   MMG5_pTetra       pt,pt0;
   MMG5_pxTetra      pxt;
@@ -378,9 +384,10 @@ int _MMG5_movbdyregpt_iso(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree,
   double            detloc,oppt[2],step,lambda[3];
   double            ll,m[2],uv[2],o[3],no[3],to[3];
   double            calold,calnew,caltmp,*callist;
-  int               k,kel,iel,l,n0,na,nb,ntempa,ntempb,ntempc,nut,nxp;
+  int               l,nut;
+  MMG5_int          n0,na,nb,ntempa,ntempb,ntempc,nxp,k,iel,kel;
   unsigned char     i0,iface,i;
-  static char       mmgErr0=0,mmgErr1=0;
+  static _MMG5_TLS char       mmgErr0=0,mmgErr1=0;
 
   step = 0.1;
   nut    = 0;
@@ -571,7 +578,7 @@ int _MMG5_movbdyregpt_iso(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree,
 
   _MMG5_tet2tri(mesh,iel,iface,&tt);
 
-  if(!_MMG5_bezierCP(mesh,&tt,&b,MG_GET(pxt->ori,iface))){
+  if(!mesh->func.bezierCP(mesh,&tt,&b,MG_GET(pxt->ori,iface))){
     if( !mmgErr0 ) {
       mmgErr0 = 1;
       fprintf(stderr,"\n  ## Error: %s: function _MMG5_bezierCP return 0.\n",
@@ -679,14 +686,14 @@ int _MMG5_movbdyregpt_iso(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree,
     iface       = lists[l] % 4;
 
     _MMG5_tet2tri(mesh,k,iface,&tt);
-    calold = MG_MIN(calold,_MMG5_caltri(mesh,met,&tt));
+    calold = MG_MIN(calold,mesh->func.caltri(mesh,met,&tt));
 
     for( i=0 ; i<3 ; i++ )
       if ( tt.v[i] == n0 )      break;
     assert(i<3);
     tt.v[i] = 0;
 
-    caltmp = _MMG5_caltri(mesh,met,&tt);
+    caltmp = mesh->func.caltri(mesh,met,&tt);
     if ( caltmp < _MMG5_EPSD2 ) {
       /* We don't check the input triangle qualities, thus we may have a very
        * bad triangle in our mesh */
@@ -779,8 +786,8 @@ int _MMG5_movbdyregpt_iso(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree,
  *
  * \remark the metric is not interpolated at the new position.
  */
-int _MMG5_movbdyrefpt_iso(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree, int *listv,
-                          int ilistv, int *lists, int ilists,
+int _MMG5_movbdyrefpt_iso(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree, MMG5_int *listv,
+                          int ilistv, MMG5_int *lists, int ilists,
                           int improve){
   MMG5_pTetra           pt,pt0;
   MMG5_pxTetra          pxt;
@@ -790,7 +797,8 @@ int _MMG5_movbdyrefpt_iso(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree,
   MMG5_pPar             par;
   double                step,ll1old,ll2old,o[3],no[3],to[3];
   double                calold,calnew,caltmp,*callist,hmax,hausd;
-  int                   l,iel,ip0,ipa,ipb,iptmpa,iptmpb,ip1,ip2,ip,nxp;
+  int                   l;
+  MMG5_int              ip0,ipa,ipb,iptmpa,iptmpb,nxp,ip1,ip2,ip,iel;
   int                   isloc,j;
   int16_t               tag;
   unsigned char         i,i0,ie,iface,iea,ieb;
@@ -988,7 +996,7 @@ int _MMG5_movbdyrefpt_iso(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree,
     pxt         = &mesh->xtetra[pt->xt];
 
     _MMG5_tet2tri(mesh,iel,iface,&tt);
-    calold = MG_MIN(calold,_MMG5_caltri(mesh,met,&tt));
+    calold = MG_MIN(calold,mesh->func.caltri(mesh,met,&tt));
 
     for( i=0 ; i<3 ; i++ )
       if ( tt.v[i] == ip0 )      break;
@@ -996,7 +1004,7 @@ int _MMG5_movbdyrefpt_iso(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree,
 
     tt.v[i] = 0;
 
-    caltmp = _MMG5_caltri(mesh,met,&tt);
+    caltmp = mesh->func.caltri(mesh,met,&tt);
     if ( caltmp < _MMG5_EPSD2 ) {
       /* We don't check the input triangle qualities, thus we may have a very
        * bad triangle in our mesh */
@@ -1131,8 +1139,8 @@ int _MMG5_movbdyrefpt_iso(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree,
  *
  * \remark the metric is not interpolated at the new position.
  */
-int _MMG5_movbdynompt_iso(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree, int *listv,
-                          int ilistv, int *lists, int ilists,
+int _MMG5_movbdynompt_iso(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree, MMG5_int *listv,
+                          int ilistv, MMG5_int *lists, int ilists,
                           int improve){
   MMG5_pTetra       pt,pt0;
   MMG5_pxTetra      pxt;
@@ -1142,7 +1150,8 @@ int _MMG5_movbdynompt_iso(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree,
   MMG5_pPar         par;
   double            step,ll1old,ll2old,calold,calnew,caltmp,*callist;
   double            o[3],no[3],to[3],hmax,hausd;
-  int               ip0,ip1,ip2,ip,iel,ipa,ipb,l,iptmpa,iptmpb,nxp;
+  int               l;
+  MMG5_int          ip0,ipa,ipb,iptmpa,iptmpb,nxp,ip1,ip2,ip,iel;
   int               j,isloc;
   int16_t           tag;
   char              iface,i,i0,iea,ieb,ie;
@@ -1338,7 +1347,7 @@ int _MMG5_movbdynompt_iso(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree,
     pxt         = &mesh->xtetra[pt->xt];
 
     _MMG5_tet2tri(mesh,iel,iface,&tt);
-    caltmp = _MMG5_caltri(mesh,met,&tt);
+    caltmp = mesh->func.caltri(mesh,met,&tt);
     calold = MG_MIN(calold,caltmp);
 
     for( i=0 ; i<3 ; i++ )
@@ -1347,7 +1356,7 @@ int _MMG5_movbdynompt_iso(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree,
 
     tt.v[i] = 0;
 
-    caltmp = _MMG5_caltri(mesh,met,&tt);
+    caltmp = mesh->func.caltri(mesh,met,&tt);
     if ( caltmp < _MMG5_EPSD2 ) {
       /* We don't check the input triangle qualities, thus we may have a very
        * bad triangle in our mesh */
@@ -1478,8 +1487,8 @@ int _MMG5_movbdynompt_iso(MMG5_pMesh mesh,MMG5_pSol met, _MMG3D_pOctree octree,
  * Move boundary ridge point, whose volumic and surfacic balls are passed.
  *
  */
-int _MMG5_movbdyridpt_iso(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree, int *listv,
-                          int ilistv,int *lists,int ilists,
+int _MMG5_movbdyridpt_iso(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree, MMG5_int *listv,
+                          int ilistv,MMG5_int *lists,int ilists,
                           int improve) {
   MMG5_pTetra          pt,pt0;
   MMG5_pxTetra         pxt;
@@ -1489,7 +1498,8 @@ int _MMG5_movbdyridpt_iso(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree,
   MMG5_pPar            par;
   double               step,ll1old,ll2old,o[3],no1[3],no2[3],to[3];
   double               calold,calnew,caltmp,*callist,hmax,hausd;
-  int                  l,iel,ip0,ipa,ipb,iptmpa,iptmpb,ip1,ip2,ip,nxp;
+  int                  l;
+  MMG5_int             ip0,ipa,ipb,iptmpa,iptmpb,nxp,ip1,ip2,ip,iel;
   int                  j,isloc;
   int16_t              tag;
   unsigned char        i,i0,ie,iface,iea,ieb;
@@ -1690,7 +1700,7 @@ int _MMG5_movbdyridpt_iso(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree,
     pxt         = &mesh->xtetra[pt->xt];
 
     _MMG5_tet2tri(mesh,iel,iface,&tt);
-    calold = MG_MIN(calold,_MMG5_caltri(mesh,met,&tt));
+    calold = MG_MIN(calold,mesh->func.caltri(mesh,met,&tt));
 
     for (i=0; i<3; i++) {
       if ( tt.v[i] == ip0 )      break;
@@ -1699,7 +1709,7 @@ int _MMG5_movbdyridpt_iso(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree,
 
     tt.v[i] = 0;
 
-    caltmp = _MMG5_caltri(mesh,met,&tt);
+    caltmp = mesh->func.caltri(mesh,met,&tt);
     if ( caltmp < _MMG5_EPSD2 )        return(0);
     calnew = MG_MIN(calnew,caltmp);
 
@@ -1820,7 +1830,8 @@ int _MMG5_movbdyridpt_iso(MMG5_pMesh mesh, MMG5_pSol met, _MMG3D_pOctree octree,
 int _MMG3D_movv_ani(MMG5_pMesh mesh,MMG5_pSol sol,int k,int ib) {
   MMG5_pTetra   pt,pt1;
   MMG5_pPoint   ppa,ppb,p1,p2,p3;
-  int           j,iadr,ipb,iter,maxiter,l,lon,iel,i1,i2,i3,list[MMG3D_LMAX+2];
+  int           j,iter,maxiter,l,lon;
+  MMG5_int      iadr,ipb,i1,i2,i3,list[MMG3D_LMAX+2],iel;
   double        *mp,coe,qualtet[MMG3D_LMAX+2];
   double        ax,ay,az,bx,by,bz,nx,ny,nz,dd,len,qual,oldc[3];
 
@@ -1891,7 +1902,7 @@ int _MMG3D_movv_ani(MMG5_pMesh mesh,MMG5_pSol sol,int k,int ib) {
       iel = list[l] / 4 ;
       pt1 = &mesh->tetra[iel];
 
-      qual = _MMG5_caltet(mesh,sol,pt1);
+      qual = mesh->func.caltet(mesh,sol,pt1);
       /*warning if we increase the coefficient (ex 1.4), the mesh quality becomes poor very quickly*/
       if ( qual*1.01 <= pt1->qual) break;
       qualtet[l] = qual;
@@ -1931,7 +1942,8 @@ int _MMG3D_movv_ani(MMG5_pMesh mesh,MMG5_pSol sol,int k,int ib) {
 int _MMG3D_movnormal_iso(MMG5_pMesh mesh,MMG5_pSol sol,int k,int ib) {
   MMG5_pTetra pt,pt1;
   MMG5_pPoint ppa,ppb,p1,p2,p3;
-  int         j,ipb,iter,maxiter,l,lon,iel,i1,i2,i3,list[MMG3D_LMAX+2];
+  int         j,iter,maxiter,l,lon;
+  MMG5_int    ipb,i1,i2,i3,list[MMG3D_LMAX+2],iel;
   double      coe,crit,qualtet[MMG3D_LMAX+2];
   double      ax,ay,az,bx,by,bz,nx,ny,nz,dd,len,qual,oldc[3],oldp[3];
 
@@ -2010,7 +2022,7 @@ int _MMG3D_movnormal_iso(MMG5_pMesh mesh,MMG5_pSol sol,int k,int ib) {
     for (l=0; l<lon; l++) {
       iel = list[l] / 4;
       pt1 = &mesh->tetra[iel];
-      qual = _MMG5_caltet(mesh,sol,pt1);
+      qual = mesh->func.caltet(mesh,sol,pt1);
       if ( qual < crit ) {
         break;
       }
@@ -2038,7 +2050,8 @@ int _MMG3D_movnormal_iso(MMG5_pMesh mesh,MMG5_pSol sol,int k,int ib) {
 int _MMG3D_movv_iso(MMG5_pMesh mesh,MMG5_pSol sol,int k,int ib) {
   MMG5_pTetra pt,pt1;
   MMG5_pPoint ppa,ppb,p1,p2,p3;
-  int         j,iadr,ipb,iter,maxiter,l,lon,iel,i1,i2,i3,list[MMG3D_LMAX+2];;
+  int         j,iter,maxiter,l,lon;;
+  MMG5_int    iadr,ipb,i1,i2,i3,list[MMG3D_LMAX+2],iel;
   double      hp,coe,crit,qualtet[MMG3D_LMAX+2];;
   double      ax,ay,az,bx,by,bz,nx,ny,nz,dd,len,qual,oldc[3];
 
@@ -2121,7 +2134,7 @@ int _MMG3D_movv_iso(MMG5_pMesh mesh,MMG5_pSol sol,int k,int ib) {
     for (l=0; l<lon; l++) {
       iel = list[l] / 4;
       pt1 = &mesh->tetra[iel];
-      qual = _MMG5_caltet(mesh,sol,pt1);
+      qual = mesh->func.caltet(mesh,sol,pt1);
       if ( qual < crit )  break;
       qualtet[l] = qual;
 
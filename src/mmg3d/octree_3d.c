@@ -42,6 +42,115 @@
 #include "mmg3d.h"
 #include <stdio.h>
 
+/** Number of items allocated at once by the octree pools */
+#define _MMG3D_OCTREE_POOL 256
+
+/** Size of the stack of the local search (at most 7 pending branches by
+ * level of the tree and the 8 branches of the current cell) */
+#define _MMG3D_OCTREE_STACK 256
+
+/**
+ * Cell of the octree to visit during a local search, with its centre and
+ * the part of the search rectangle that it contains.
+ */
+typedef struct {
+  _MMG3D_octree_s *q;
+  double           center[3];
+  double           rect[6];
+} _MMG3D_octreeFrame;
+
+/**
+ * \param pool pointer toward the pool.
+ * \param siz size of an item (in bytes).
+ * \param nitem number of items allocated at once.
+ *
+ * Initialisation of a pool of items of size \a siz.
+ *
+ */
+static inline
+void _MMG3D_initPool(_MMG3D_octreePool *pool, size_t siz, int nitem)
+{
+  pool->chunk = NULL;
+  pool->free  = NULL;
+  /* a free item stores the address of the next one */
+  pool->siz   = (siz + sizeof(void*) - 1) / sizeof(void*) * sizeof(void*);
+  pool->nitem = nitem;
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param pool pointer toward the pool.
+ * \return a pointer toward a free item, NULL if memory saturated.
+ *
+ * Take an item from the pool, allocate a new chunk of items if the pool is
+ * empty.
+ *
+ */
+static inline
+void* _MMG3D_getPool(MMG5_pMesh mesh, _MMG3D_octreePool *pool)
+{
+  char   *chunk,*item;
+  size_t siz;
+  MMG5_int i;
+
+  if ( !pool->free )
+  {
+    siz = sizeof(void*) + pool->nitem*pool->siz;
+    _MMG5_ADD_MEM(mesh,siz,"octree pool",return NULL);
+    _MMG5_SAFE_MALLOC(chunk,siz,char,NULL);
+
+    *(void**)chunk = pool->chunk;
+    pool->chunk    = chunk;
+
+    // link the new items such as they are given in the memory order
+    item = chunk + sizeof(void*);
+    for ( i=0; i<pool->nitem-1; ++i )
+      *(void**)(item+i*pool->siz) = item+(i+1)*pool->siz;
+    *(void**)(item+i*pool->siz) = NULL;
+    pool->free = item;
+  }
+
+  item       = pool->free;
+  pool->free = *(void**)item;
+
+  return item;
+}
+
+/**
+ * \param pool pointer toward the pool.
+ * \param item pointer toward an item taken from \a pool.
+ *
+ * Give back an item to the pool.
+ *
+ */
+static inline
+void _MMG3D_putPool(_MMG3D_octreePool *pool, void *item)
+{
+  *(void**)item = pool->free;
+  pool->free    = item;
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param pool pointer toward the pool.
+ *
+ * Free the chunks of the pool.
+ *
+ */
+static
+void _MMG3D_freePool(MMG5_pMesh mesh, _MMG3D_octreePool *pool)
+{
+  void *chunk;
+
+  while ( pool->chunk )
+  {
+    chunk       = pool->chunk;
+    pool->chunk = *(void**)chunk;
+    _MMG5_DEL_MEM(mesh,chunk,sizeof(void*) + pool->nitem*pool->siz);
+  }
+  pool->free = NULL;
+}
+
 /**
  * \param q pointer toward the octree cell
  *
@@ -67,11 +176,14 @@ void _MMG3D_initOctree_s( _MMG3D_octree_s* q)
  */
 int _MMG3D_initOctree(MMG5_pMesh mesh,_MMG3D_pOctree* q, int nv)
 {
-  int i;
+  MMG5_int i;
 
   _MMG5_ADD_MEM(mesh,sizeof(_MMG3D_octree),"octree structure",
                 return 0);
   _MMG5_SAFE_MALLOC(*q,1, _MMG3D_octree,0);
+  (*q)->q0    = NULL;
+  (*q)->qlist = NULL;
+  (*q)->dist  = NULL;
 
 
   // set nv to the next power of 2
@@ -87,6 +199,17 @@ int _MMG3D_initOctree(MMG5_pMesh mesh,_MMG3D_pOctree* q, int nv)
   // Number maximum of cells listed for the zone search
   (*q)->nc = MG_MAX(2048/nv,16);
 
+  // The branches and the vertex lists of the cells are taken from pools
+  _MMG3D_initPool(&(*q)->br,(1<<mesh->dim)*sizeof(_MMG3D_octree_s),
+                  _MMG3D_OCTREE_POOL);
+  _MMG3D_initPool(&(*q)->vl,nv*sizeof(MMG5_int),_MMG3D_OCTREE_POOL);
+
+  // Lists filled by the zone search
+  _MMG5_ADD_MEM(mesh,(*q)->nc*(sizeof(_MMG3D_octree_s*)+sizeof(double)),
+                "octree search lists",return 0);
+  _MMG5_SAFE_MALLOC((*q)->qlist,(*q)->nc,_MMG3D_octree_s*,0);
+  _MMG5_SAFE_MALLOC((*q)->dist,(*q)->nc,double,0);
+
   _MMG5_ADD_MEM(mesh,sizeof(_MMG3D_octree_s),"initial octree cell",
                 return 0);
 
@@ -107,33 +230,40 @@ int _MMG3D_initOctree(MMG5_pMesh mesh,_MMG3D_pOctree* q, int nv)
 
 /**
  * \param mesh pointer toward the mesh structure.
+ * \param oc pointer toward the global octree
  * \param q pointer toward the octree cell
- * \param nv number of vertices in the cell subtree
  *
- * Free the octree cell.
+ * Free the octree cell: its branches and vertex lists go back to the pools
+ * of the global octree.
  *
  */
-void _MMG3D_freeOctree_s(MMG5_pMesh mesh,_MMG3D_octree_s* q, int nv)
+void _MMG3D_freeOctree_s(MMG5_pMesh mesh,_MMG3D_pOctree oc,_MMG3D_octree_s* q)
 {
-  int nbBitsInt,depthMax,dim,i,sizTab,sizBr,nvTemp;
+  int nbBitsInt,depthMax,dim,i,sizTab,sizBr,nv;
+  MMG5_int nvTemp;
 
   dim       = mesh->dim;
   sizBr     = 1<<dim;
   nbBitsInt = sizeof(int64_t)*8;
   depthMax  = nbBitsInt/dim - 1;
+  nv        = oc->nv;
 
-  if (q->nbVer>nv && q->depth < depthMax )
+  if ( q->branches )
   {
     for ( i = 0; i<sizBr; i++)
     {
-      _MMG3D_freeOctree_s(mesh,&(q->branches[i]), nv);
+      _MMG3D_freeOctree_s(mesh,oc,&(q->branches[i]));
     }
-    _MMG5_DEL_MEM(mesh,q->branches,sizBr*sizeof(_MMG3D_octree_s));
+    _MMG3D_putPool(&oc->br,q->branches);
     q->branches = NULL;
   }
-  else if (q->nbVer>0)
+  else if ( q->v )
   {
-    if ( q->nbVer<= nv )
+    if ( q->depth < depthMax )
+    {
+      _MMG3D_putPool(&oc->vl,q->v);
+    }
+    else if ( q->nbVer<= nv )
     {
       nvTemp = q->nbVer;
       nvTemp--;
@@ -144,25 +274,17 @@ void _MMG3D_freeOctree_s(MMG5_pMesh mesh,_MMG3D_octree_s* q, int nv)
       nvTemp |= nvTemp >> 16;
       nvTemp++;
 
-      _MMG5_DEL_MEM(mesh,q->v,nvTemp*sizeof(int));
-      q->v = NULL;
-      q->nbVer = 0;
-    }else
+      _MMG5_DEL_MEM(mesh,q->v,nvTemp*sizeof(MMG5_int));
+    }
+    else
     {
-      if ( q->depth != depthMax )
-      {
-        sizTab = nv;
-      }else
-      {
-        sizTab = (q->nbVer%nv != 0)? 1 : 0;
-        sizTab = nv * ((int)(q->nbVer/nv) + sizTab);
-      }
-      assert(q->v);
-      _MMG5_DEL_MEM(mesh,q->v,sizTab*sizeof(int));
-      q->v = NULL;
-      q->nbVer = 0;
+      sizTab = (q->nbVer%nv != 0)? 1 : 0;
+      sizTab = nv * ((int)(q->nbVer/nv) + sizTab);
+      _MMG5_DEL_MEM(mesh,q->v,sizTab*sizeof(MMG5_int));
     }
+    q->v = NULL;
   }
+  q->nbVer = 0;
 }
 
 /**
@@ -174,14 +296,98 @@ void _MMG3D_freeOctree_s(MMG5_pMesh mesh,_MMG3D_octree_s* q, int nv)
  */
 void _MMG3D_freeOctree(MMG5_pMesh mesh,_MMG3D_pOctree *q)
 {
-  _MMG3D_freeOctree_s(mesh,(*q)->q0, (*q)->nv);
-  _MMG5_DEL_MEM(mesh,(*q)->q0,sizeof(_MMG3D_octree_s));
-  (*q)->q0 = NULL;
+  if ( (*q)->q0 )
+  {
+    _MMG3D_freeOctree_s(mesh,*q,(*q)->q0);
+    _MMG5_DEL_MEM(mesh,(*q)->q0,sizeof(_MMG3D_octree_s));
+  }
+  _MMG3D_freePool(mesh,&(*q)->br);
+  _MMG3D_freePool(mesh,&(*q)->vl);
+  if ( (*q)->qlist )
+  {
+    _MMG5_DEL_MEM(mesh,(*q)->qlist,(*q)->nc*sizeof(_MMG3D_octree_s*));
+    _MMG5_DEL_MEM(mesh,(*q)->dist,(*q)->nc*sizeof(double));
+  }
   _MMG5_DEL_MEM(mesh,*q,sizeof(_MMG3D_octree));
   *q = NULL;
 }
 
 
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param q pointer toward an octree cell.
+ *
+ * Mark (through their \a tmp field) the points stored in the cell \a q and in
+ * its subtrees.
+ *
+ */
+static void _MMG3D_markOctree_s(MMG5_pMesh mesh,_MMG3D_octree_s* q)
+{
+  MMG5_int i;
+  int      sizBr;
+
+  if ( q->branches )
+  {
+    sizBr = 1<<mesh->dim;
+    for ( i = 0; i<sizBr; i++)
+      _MMG3D_markOctree_s(mesh,&(q->branches[i]));
+  }
+  else if ( q->v )
+  {
+    for ( i = 0; i<q->nbVer; i++)
+      mesh->point[q->v[i]].tmp = 1;
+  }
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param q pointer toward the global octree.
+ *
+ * Mark (through their \a tmp field) the points stored in the octree, to store
+ * again the same points in \ref _MMG3D_resetOctree after a renumbering of the
+ * points. The octree contains the internal points and the boundary points
+ * inserted during the remeshing, thus it can't be rebuilt from the point tags.
+ *
+ */
+void _MMG3D_markOctree(MMG5_pMesh mesh,_MMG3D_pOctree q)
+{
+  MMG5_int i;
+
+  for (i=1;i<=mesh->np; ++i)
+    mesh->point[i].tmp = 0;
+
+  _MMG3D_markOctree_s(mesh,q->q0);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param q pointer toward the global octree.
+ * \return 1 if ok 0 if memory saturated
+ *
+ * Empty the octree and fill it again with the mesh points marked by \ref
+ * _MMG3D_markOctree (needed after a renumbering of the points).
+ *
+ */
+int _MMG3D_resetOctree(MMG5_pMesh mesh,_MMG3D_pOctree q)
+{
+  MMG5_int i;
+
+  _MMG3D_freeOctree_s(mesh,q,q->q0);
+  _MMG3D_initOctree_s(q->q0);
+
+  for (i=1;i<=mesh->np; ++i)
+  {
+    if ( !MG_VOK(&mesh->point[i]) )  continue;
+    if ( !mesh->point[i].tmp ) continue;
+
+    mesh->point[i].tmp = 0;
+    if(!_MMG3D_addOctree(mesh, q, i))
+      return 0;
+
+  }
+  return 1;
+}
+
 /**
  * \param q pointer toward the global octree.
  * \param ver coordinates of the point.
@@ -233,7 +439,7 @@ int64_t _MMG3D_getOctreeCoordinate(_MMG3D_pOctree q, double* ver, int dim)
  * into the octree. (ie: one move at a time in the mesh and the octree)
  *
  */
-int _MMG3D_moveOctree(MMG5_pMesh mesh, _MMG3D_pOctree q, int no, double* newVer, double* oldVer)
+int _MMG3D_moveOctree(MMG5_pMesh mesh, _MMG3D_pOctree q, MMG5_int no, double* newVer, double* oldVer)
 {
   int oldCoor, newCoor;
   double pt[3];
@@ -253,12 +459,12 @@ int _MMG3D_moveOctree(MMG5_pMesh mesh, _MMG3D_pOctree q, int no, double* newVer,
   {
     /* delOctree */
     memcpy(&pt, oldVer ,dim*sizeof(double));
-    if (!_MMG3D_delOctreeRec(mesh, q->q0, pt , no, q->nv))
+    if (!_MMG3D_delOctreeRec(mesh, q, q->q0, pt , no))
       return 0;
 
     /* addOctree */
     memcpy(&pt, newVer ,dim*sizeof(double));
-    if(!_MMG3D_addOctreeRec(mesh, q->q0, pt , no, q->nv))
+    if(!_MMG3D_addOctreeRec(mesh, q, q->q0, pt , no))
       return 0;
   }
   return 1;
@@ -335,52 +541,6 @@ void _MMG3D_placeInListOctree(_MMG3D_octree_s** qlist, _MMG3D_octree_s* q, int i
   qlist[index+1] = q;
 }
 
-/**
- * \param distList ordered list of value from smallest to largest.
- * \param dist value to be compared to elements in the list.
- * \param indexMin minimum index of the list.
- * \param indexMax maximum index of the list.
- *
- * \return Index of the biggest value of disList that is strictly
- * smaller than dist. Only search in the bounds of indexMin and indexMax.
- *
- */
-int _MMG3D_seekIndex (double* distList, double dist, int indexMin, int indexMax)
-{
-  int indexMed;
-
-  if (indexMin > indexMax)
-    _MMG3D_seekIndex(distList, dist, indexMax, indexMin);
-  else if (indexMax - indexMin <2)
-  {
-    #ifdef DEBUG
-      if (indexMin >= 60 || indexMax>=60)
-        fprintf(stderr,"\n  ## Error: %s: index should not be that large %i %i.\n",
-                __func__,indexMin, indexMax);
-    #endif
-    if (dist > distList[indexMax])
-      return indexMax;
-    else
-      return indexMin;
-  }
-  else
-  {
-    indexMed = (indexMin + indexMax)/2;
-
-    #ifdef DEBUG
-      if (indexMed >= 60 || indexMed < 0)
-        fprintf(stderr,"\n  ## Error: %s: index should not be that large %i.\n",
-                __func__,indexMed);
-    #endif
-
-    if (dist > distList[indexMed])
-      _MMG3D_seekIndex(distList, dist, indexMed, indexMax);
-    else
-      _MMG3D_seekIndex(distList, dist, indexMin, indexMed);
-  }
-  return 1;
-}
-
 /**
  * \param rectin rectangle to intersect, is not modified.
  * \param rectinout rectangle to intersect, is set to the intersection.
@@ -428,137 +588,121 @@ int _MMG3D_intersectRect(double *rectin, double *rectinout)
 }
 
 /**
- * \param q pointer toward the octree cell.
- * \param center coordinates of the centre of the current subtree.
- * \param rect rectangle that we want to intersect with the subtree. We define
+ * \param q pointer toward the global octree structure.
+ * \param rect rectangle that we want to intersect with the octree. We define
  * it given: the coordinates of one corner of the rectange and the length of
  * the rectangle in each dimension.
- * \param qlist pointer toward the list of pointer over the sub octrees that
- *  intersect \a rect.
- * \param dist pointer toward the list of distances between center of
- * the octree cells in qlist and the last 3 elements are the coordinates
- * of the center of the whole recangle.
- * \param ani metric of the point.
- * \param l0 radius of the search zone.
- * \param nc number max of cell in the list +3 (the three last.
- * \param dim dimension =3.
+ * \param zone coordinates of the center of the search zone.
  * \param index number of octree cells that intersect \a rect
  *
  * \return 0 if the rectangle doesn't intersect the octree (possible due to the
  * surface reconstruction), 1 otherwise.
  *
- * List the number of octree cells that intersect the rectangle
- * \a rect. To avoid counting of the cells, a maximum is set.
+ * List in \a q->qlist the octree cells that intersect the rectangle \a rect,
+ * from the closest to the farthest of the center of the search zone. The
+ * tree is traversed with an explicit stack, in the order of a recursive
+ * depth-first traversal. To avoid counting of the cells, a maximum is set.
  *
  */
-int _MMG3D_getListSquareRec(_MMG3D_octree_s* q, double* center, double* rect,
-                            _MMG3D_octree_s*** qlist, double* dist, double* ani, double l0, int nc, int dim, int* index)
+static
+int _MMG3D_getListSquareCells(_MMG3D_pOctree q, double* rect, double* zone,
+                              int* index)
 {
-  double recttemp[6];
-  double centertemp[3];
-  int    recCenter[6];
-  double l = 1./(1<<(q->depth+1));
-  double distTemp;
-  double x,y,z;
-  int indexTemp,i,j,k,nBranch;
+  _MMG3D_octreeFrame stack[_MMG3D_OCTREE_STACK],br[8],cur;
+  _MMG3D_octree_s    *cell;
+  double             *rectcur,*recttemp,*center,*centertemp;
+  double             l,distTemp,x,y,z;
+  int                recCenter[6];
+  int                nstack,nbr,indexTemp,i,j,k,nBranch;
+
+  stack[0].q = q->q0;
+  for (i = 0; i < 3; ++i)
+    stack[0].center[i] = 0.5;
+  memcpy(stack[0].rect,rect,6*sizeof(double));
+  nstack = 1;
+
+  while ( nstack )
+  {
+    cur     = stack[--nstack];
+    cell    = cur.q;
+    center  = cur.center;
+    rectcur = cur.rect;
 
-  // number max of octree cells listed for one search
-  if ((*index)>nc-4)
-    return 1;
+    // number max of octree cells listed for one search
+    if ((*index)>q->nc-4)
+      continue;
 
-  // check if the current cell is included in the search zone, can avoid
-  // the loop over the vertices. Never occured in tests unless nc==4, in that
-  // case, there is no gain in computing time.
-  //~ if (q->nbVer>0 && _MMG3D_isCellIncluded(center, l, &(dist[nc-3]), l0))
-  //~ {
-    //~ (*index)=nc-3;
-    //~ fprintf(stdout,"Included cell found\n");
-    //~ return;
-  //~ }
-
-  if (q->branches==NULL && q->v != NULL)
-  {
-    // the vector dist is of size nc whereas qlist allows nc-3 inputs
-    // so the 3 last values can contain the coordinates of the center
-    // of the search volume.
-    x = dist[nc-3] - center[0];
-    y = dist[nc-2] - center[1];
-    z = dist[nc-1] - center[2];
-
-    // Should be replaced with distance in metric?
-    distTemp = x*x+y*y+z*z;
-
-    // Here the anisotropic distance not tested (not so important, this only
-    // reorders the cells)
-    //~ distTemp = ani[0]*x*x+ani[3]*y*y+ani[5]*z*z+
-                //~ 2*(ani[1]*x*y+ani[2]*x*z+ani[4]*y*z);
-    if (*index > 0)
+    if (cell->branches==NULL && cell->v != NULL)
     {
-      indexTemp = _MMG3D_seekIndex(dist,distTemp,0, *index-1);
-      if (indexTemp+1<*index)
-      {
-        _MMG3D_placeInListDouble(dist, distTemp, indexTemp, *index);
-        _MMG3D_placeInListOctree((*qlist), q, indexTemp, *index);
-      }else
-      {
-        dist[*index]=distTemp;
-        (*qlist)[*index]=q;
-      }
-    }
-    else
-    {
-      dist[*index]=distTemp;
-      (*qlist)[*index]=q;
-    }
+      x = zone[0] - center[0];
+      y = zone[1] - center[1];
+      z = zone[2] - center[2];
 
-    (*index)++;
+      // Should be replaced with distance in metric?
+      distTemp = x*x+y*y+z*z;
 
-  }else if (q->branches!=NULL)
-  {
+      // Here the anisotropic distance not tested (not so important, this only
+      // reorders the cells)
+      for ( indexTemp = *index-1;
+            indexTemp >= 0 && q->dist[indexTemp] >= distTemp; --indexTemp );
 
-    // check the position of the search zone in the current cell
-    for (i=0;i<3;i++)
-    {
-      recCenter[i] = (rect[i]>center[i]);
-      recCenter[i+3] = ((rect[i]+rect[i+3])>center[i]);
-    }
+      _MMG3D_placeInListDouble(q->dist, distTemp, indexTemp, *index);
+      _MMG3D_placeInListOctree(q->qlist, cell, indexTemp, *index);
 
-    // three loop describing the 8 branches in binary (k,j,i):(0,0,0),(0,0,1)....(1,1,1)
-    for(i=0;i<2;i++)
+      (*index)++;
+    }
+    else if (cell->branches!=NULL)
     {
-      for(j=0;j<2;j++)
+      l = 1./(1<<(cell->depth+1));
+
+      // check the position of the search zone in the current cell
+      for (i=0;i<3;i++)
+      {
+        recCenter[i] = (rectcur[i]>center[i]);
+        recCenter[i+3] = ((rectcur[i]+rectcur[i+3])>center[i]);
+      }
+
+      // three loop describing the 8 branches in binary (k,j,i):(0,0,0),(0,0,1)....(1,1,1)
+      nbr = 0;
+      for(i=0;i<2;i++)
       {
-        for(k=0;k<2;k++)
+        for(j=0;j<2;j++)
         {
-          // test if that branch intersects the rectangle
-          if (((i && recCenter[3]) || (!i && !recCenter[0])) &&
-              ((j && recCenter[4]) || (!j && !recCenter[1]))&&
-              ((k && recCenter[5]) || (!k && !recCenter[2])))
+          for(k=0;k<2;k++)
           {
-            // set the branch number
-            nBranch = i+2*j+4*k;
-
-            // set recttemp to the cell size of the branch nBranch
-            recttemp[0] = center[0]-l*(1-i);
-            recttemp[1] = center[1]-l*(1-j);
-            recttemp[2] = center[2]-l*(1-k);
-            recttemp[3] = recttemp[4] = recttemp[5] = l;
-            // intersect the rectangle and the cell and store it in recttemp
-            if ( !_MMG3D_intersectRect(rect,recttemp) ) return 0;
-
-            // set the new center
-            centertemp[0] = center[0]-l/2+i*l;
-            centertemp[1] = center[1]-l/2+j*l;
-            centertemp[2] = center[2]-l/2+k*l;
-
-            // recursive call in the branch
-            if ( !_MMG3D_getListSquareRec(&(q->branches[nBranch]),
-                                          centertemp, recttemp, qlist, dist,
-                                          ani, l0, nc, dim, index) )
-              return 0;
+            // test if that branch intersects the rectangle
+            if (((i && recCenter[3]) || (!i && !recCenter[0])) &&
+                ((j && recCenter[4]) || (!j && !recCenter[1]))&&
+                ((k && recCenter[5]) || (!k && !recCenter[2])))
+            {
+              // set the branch number
+              nBranch = i+2*j+4*k;
+              br[nbr].q = &(cell->branches[nBranch]);
+
+              // set recttemp to the cell size of the branch nBranch
+              recttemp = br[nbr].rect;
+              recttemp[0] = center[0]-l*(1-i);
+              recttemp[1] = center[1]-l*(1-j);
+              recttemp[2] = center[2]-l*(1-k);
+              recttemp[3] = recttemp[4] = recttemp[5] = l;
+              // intersect the rectangle and the cell and store it in recttemp
+              if ( !_MMG3D_intersectRect(rectcur,recttemp) ) return 0;
+
+              // set the new center
+              centertemp = br[nbr].center;
+              centertemp[0] = center[0]-l/2+i*l;
+              centertemp[1] = center[1]-l/2+j*l;
+              centertemp[2] = center[2]-l/2+k*l;
+              ++nbr;
+            }
           }
         }
       }
+
+      // the first branch is on top of the stack
+      assert(nstack+nbr <= _MMG3D_OCTREE_STACK);
+      while ( nbr )
+        stack[nstack++] = br[--nbr];
     }
   }
   return 1;
@@ -572,7 +716,8 @@ int _MMG3D_getListSquareRec(_MMG3D_octree_s* q, double* center, double* rect,
  * it given: the coordinates of one corner of the rectangle and the length of
  * the rectangle in each dimension.
  * \param qlist pointer toward the list of pointer over the sub octrees that
- *  intersect \a rect.
+ *  intersect \a rect (it points toward \a q->qlist, so it is valid until the
+ *  next search and must not be freed).
  *
  * \return index, the number of subtrees in the list, -1 if fail.
  *
@@ -582,68 +727,34 @@ int _MMG3D_getListSquareRec(_MMG3D_octree_s* q, double* center, double* rect,
 int _MMG3D_getListSquare(MMG5_pMesh mesh, double* ani, _MMG3D_pOctree q, double* rect,
                          _MMG3D_octree_s*** qlist)
 {
-  double rect2[6], center[3], *dist;
-  double l0;
-  int    i,index,dim;
-
-  dim = mesh->dim;
-  index = 0;
-
-  memcpy(&rect2, rect, sizeof(double)*dim*2);
+  double zone[3];
+  int    index;
 
   //instead of counting exactly the number of cells to be listed, the
-  //maximum size is set to nc-3 (so the list dist can have nc-3 values + 3 coordinates of
-  //the center of the rectangle)
-  index = q->nc-3;
-
-  _MMG5_ADD_MEM(mesh,q->nc*sizeof(_MMG3D_octree_s*),"octree cell",return -1);
-
-  _MMG5_SAFE_MALLOC(*qlist,index,_MMG3D_octree_s*,-1);
-  _MMG5_SAFE_MALLOC(dist,index+3,double,-1);
+  //maximum size is set to nc-3
+  *qlist = q->qlist;
 
   // Set the center of the zone search
-  dist[q->nc-3] = rect[0]+rect[3]/2;
-  dist[q->nc-2] = rect[1]+rect[4]/2;
-  dist[q->nc-1] = rect[2]+rect[5]/2;
-
-  // Set the radius of the zone search (used for cell inclusion test if activated)
-  l0 = rect[3]/2;
-
-  // Initialization of the octree cell list
-  for (i = 0; i<index; i++)
-    (*qlist)[i] = NULL;
+  zone[0] = rect[0]+rect[3]/2;
+  zone[1] = rect[1]+rect[4]/2;
+  zone[2] = rect[2]+rect[5]/2;
 
   index = 0;
-
-  // Set center of the first octree cell
-  for (i = 0; i < dim; ++i)
-    center[i] = 0.5;
-
-  // Avoid modification of input parameter rect
-  memcpy(&rect2, rect, sizeof(double)*dim*2);
-
-  if ( !_MMG3D_getListSquareRec(q->q0, center, rect2, qlist, dist, ani, l0,
-                                q->nc, dim, &index) )
+  if ( !_MMG3D_getListSquareCells(q, rect, zone, &index) )
     return -1;
 
-
   if (index>q->nc-4)
-  {
-    _MMG5_SAFE_FREE(dist);
     return -1;
-  }
-
-  _MMG5_SAFE_FREE(dist);
 
   return index;
 }
 
 /**
  * \param mesh pointer toward the mesh structure.
+ * \param oc pointer toward the global octree.
  * \param q pointer toward an octree cell.
  * \param ver vertex coordinates scaled such that the quadrant is [0;1]x[0;1]x[0;1]
  * \param no vertex index in the mesh.
- * \param nv maximum number of points in an octree cell.
  * \return 1 if ok 0 if memory saturated
  *
  * Add vertex in the suitable quadrant of the octree. This function is
@@ -651,14 +762,15 @@ int _MMG3D_getListSquare(MMG5_pMesh mesh, double* ani, _MMG3D_pOctree q, double*
  * coordinates are scaled such as the quadrant is the [0;1]x[0;1]x[0;1] box.
  *
  */
-int _MMG3D_addOctreeRec(MMG5_pMesh mesh, _MMG3D_octree_s* q, double* ver,
-                         const int no, int nv)
+int _MMG3D_addOctreeRec(MMG5_pMesh mesh, _MMG3D_pOctree oc, _MMG3D_octree_s* q,
+                        double* ver, const MMG5_int no)
 {
   double   pt[3];
   int      dim, nbBitsInt,depthMax,i,j,k;
-  int      quadrant,sizBr;
-  int      sizeRealloc;
+  int      quadrant,sizBr,nv;
+  MMG5_int sizeRealloc;
 
+  nv        = oc->nv;
   nbBitsInt = sizeof(int64_t)*8;
   dim       = mesh->dim;
   depthMax  = nbBitsInt/dim - 1; // maximum depth is to allow integer coordinates
@@ -669,18 +781,10 @@ int _MMG3D_addOctreeRec(MMG5_pMesh mesh, _MMG3D_octree_s* q, double* ver,
     if (q->nbVer < nv)  // not at the maximum number of vertice in the cell
     {
 
-      if(q->nbVer == 0)  // first vertex list allocation
-      {
-        _MMG5_ADD_MEM(mesh,sizeof(int),"octree vertice table", return 0);
-        _MMG5_SAFE_MALLOC(q->v,1,int,0);
-      }
-      else if(!(q->nbVer & (q->nbVer - 1))) //is a power of 2 -> reallocation of the vertex list
+      if(q->nbVer == 0)  // first vertex: the list can store nv vertices
       {
-        sizeRealloc = q->nbVer;
-        sizeRealloc<<=1;
-        _MMG5_ADD_MEM(mesh,(sizeRealloc-sizeRealloc/2)*sizeof(int),"octree realloc",
-                      return 0);
-        _MMG5_SAFE_REALLOC(q->v,sizeRealloc,int,"octree",0);
+        q->v = (MMG5_int*)_MMG3D_getPool(mesh,&oc->vl);
+        if ( !q->v ) return 0;
       }
 
       q->v[q->nbVer] = no;
@@ -690,9 +794,8 @@ int _MMG3D_addOctreeRec(MMG5_pMesh mesh, _MMG3D_octree_s* q, double* ver,
     else if (q->nbVer == nv && q->branches==NULL)  //vertex list at maximum -> cell subdivision
     {
       /* creation of sub-branch and relocation of vertices in the sub-branches */
-      _MMG5_ADD_MEM(mesh,sizBr*sizeof(_MMG3D_octree_s),"octree branches",
-                    return 0);
-      _MMG5_SAFE_MALLOC(q->branches,sizBr,_MMG3D_octree_s,0);
+      q->branches = (_MMG3D_octree_s*)_MMG3D_getPool(mesh,&oc->br);
+      if ( !q->branches ) return 0;
 
       for ( i = 0; i<sizBr; i++)
       {
@@ -712,14 +815,15 @@ int _MMG3D_addOctreeRec(MMG5_pMesh mesh, _MMG3D_octree_s* q, double* ver,
             pt[k] *= 2;
           }
         }
-        if (!_MMG3D_addOctreeRec(mesh, q, pt, q->v[i],nv))
+        if (!_MMG3D_addOctreeRec(mesh, oc, q, pt, q->v[i]))
           return 0;
         q->nbVer--;
       }
-      if (!_MMG3D_addOctreeRec(mesh, q, ver, no, nv))
+      if (!_MMG3D_addOctreeRec(mesh, oc, q, ver, no))
         return 0;
       q->nbVer--;
-      _MMG5_DEL_MEM(mesh,q->v,nv*sizeof(int));
+      _MMG3D_putPool(&oc->vl,q->v);
+      q->v = NULL;
 
     }else // Recursive call in the corresponding sub cell
     {
@@ -732,7 +836,7 @@ int _MMG3D_addOctreeRec(MMG5_pMesh mesh, _MMG3D_octree_s* q, double* ver,
       }
 
       q->nbVer++;
-      if (!_MMG3D_addOctreeRec(mesh, &(q->branches[quadrant]), ver, no, nv))
+      if (!_MMG3D_addOctreeRec(mesh, oc, &(q->branches[quadrant]), ver, no))
         return 0;
     }
   }else // maximum octree depth reached
@@ -741,24 +845,24 @@ int _MMG3D_addOctreeRec(MMG5_pMesh mesh, _MMG3D_octree_s* q, double* ver,
     {
       if(q->nbVer == 0) // first allocation
       {
-        _MMG5_ADD_MEM(mesh,sizeof(int),"octree vertices table",
+        _MMG5_ADD_MEM(mesh,sizeof(MMG5_int),"octree vertices table",
                       return 0);
-        _MMG5_SAFE_MALLOC(q->v,1,int,0);
+        _MMG5_SAFE_MALLOC(q->v,1,MMG5_int,0);
       }
       else if(!(q->nbVer & (q->nbVer - 1))) //is a power of 2 -> normal reallocation
       {
         sizeRealloc = q->nbVer;
         sizeRealloc<<=1;
-        _MMG5_ADD_MEM(mesh,(sizeRealloc-sizeRealloc/2)*sizeof(int),"octree realloc",
+        _MMG5_ADD_MEM(mesh,(sizeRealloc-sizeRealloc/2)*sizeof(MMG5_int),"octree realloc",
                       return 0);
-        _MMG5_SAFE_REALLOC(q->v,sizeRealloc,int,"octree",0);
+        _MMG5_SAFE_REALLOC(q->v,sizeRealloc,MMG5_int,"octree",0);
       }
     }
     else if (q->nbVer%nv == 0) // special reallocation of the vertex list because it is at maximum depth
     {
-      _MMG5_ADD_MEM(mesh,nv*sizeof(int),"octree realloc",
+      _MMG5_ADD_MEM(mesh,nv*sizeof(MMG5_int),"octree realloc",
                     return 0);
-      _MMG5_SAFE_REALLOC(q->v,q->nbVer+nv,int,"octree",0);
+      _MMG5_SAFE_REALLOC(q->v,q->nbVer+nv,MMG5_int,"octree",0);
     }
 
     q->v[q->nbVer] = no;
@@ -776,7 +880,7 @@ int _MMG3D_addOctreeRec(MMG5_pMesh mesh, _MMG3D_octree_s* q, double* ver,
  * Add the vertex of index \a no to the octree.
  *
  */
-int _MMG3D_addOctree(MMG5_pMesh mesh, _MMG3D_pOctree q, const int no)
+int _MMG3D_addOctree(MMG5_pMesh mesh, _MMG3D_pOctree q, const MMG5_int no)
 {
   double pt[3];
   int    dim;
@@ -784,7 +888,7 @@ int _MMG3D_addOctree(MMG5_pMesh mesh, _MMG3D_pOctree q, const int no)
   dim = mesh->dim;
   assert(no<=mesh->np);
   memcpy(&pt, mesh->point[no].c ,dim*sizeof(double));
-  if (!_MMG3D_addOctreeRec(mesh, q->q0, pt , no, q->nv))
+  if (!_MMG3D_addOctreeRec(mesh, q, q->q0, pt , no))
   {
     return 0;
   }
@@ -797,28 +901,35 @@ int _MMG3D_addOctree(MMG5_pMesh mesh, _MMG3D_pOctree q, const int no)
  * \param no index of the point to delete from the octree
  * \return 1 if ok 0 if memory saturated
  *
- * Delete the vertex of index \a no from the terminal octree cell, merge
- * the cells if necessary.
+ * Delete the vertex of index \a no from the terminal octree cell (the vertex
+ * lists of the cells below the maximal depth have a fixed size).
  *
  */
 int _MMG3D_delOctreeVertex(MMG5_pMesh mesh, _MMG3D_octree_s* q, int indNo)
 {
-  int i;
-  int* vTemp;
+  int i,nbBitsInt,depthMax;
+  MMG5_int* vTemp;
+
+  nbBitsInt = sizeof(int64_t)*8;
+  depthMax  = nbBitsInt/mesh->dim - 1;
 
   assert(q->v);
   assert(q->nbVer>indNo);
   for(i=0; i<q->nbVer; ++i)
     assert(q->v[i]>0);
-  memmove(&q->v[indNo],&q->v[indNo+1], (q->nbVer-indNo-1)*sizeof(int));
+  memmove(&q->v[indNo],&q->v[indNo+1], (q->nbVer-indNo-1)*sizeof(MMG5_int));
   --(q->nbVer);
+
+  // below the maximal depth, the list comes from the pool and is not resized
+  if ( q->depth < depthMax )  return 1;
+
   if (!(q->nbVer & (q->nbVer - 1)) && q->nbVer > 0) // is a power of 2
   {
-    _MMG5_ADD_MEM(mesh,q->nbVer*sizeof(int),"octree index",
+    _MMG5_ADD_MEM(mesh,q->nbVer*sizeof(MMG5_int),"octree index",
                   return 0);
-    _MMG5_SAFE_MALLOC(vTemp,q->nbVer,int,0);
-    memcpy(vTemp, q->v,q->nbVer*sizeof(int));
-    _MMG5_DEL_MEM(mesh,q->v,2*q->nbVer*sizeof(int));
+    _MMG5_SAFE_MALLOC(vTemp,q->nbVer,MMG5_int,0);
+    memcpy(vTemp, q->v,q->nbVer*sizeof(MMG5_int));
+    _MMG5_DEL_MEM(mesh,q->v,2*q->nbVer*sizeof(MMG5_int));
 
     q->v = vTemp;
   }
@@ -836,7 +947,7 @@ int _MMG3D_delOctreeVertex(MMG5_pMesh mesh, _MMG3D_octree_s* q, int indNo)
  * contain no more than nv vertices.
  *
  */
-void _MMG3D_mergeBranchesRec(_MMG3D_octree_s* q0, _MMG3D_octree_s* q, int dim, int nv, int* index)
+void _MMG3D_mergeBranchesRec(_MMG3D_octree_s* q0, _MMG3D_octree_s* q, int dim, int nv, MMG5_int* index)
 {
   int i;
 
@@ -845,7 +956,7 @@ void _MMG3D_mergeBranchesRec(_MMG3D_octree_s* q0, _MMG3D_octree_s* q, int dim, i
 
     assert(*index+q->nbVer<=nv);
 
-    memcpy(&(q0->v[*index]), q->v, q->nbVer*sizeof(int));
+    memcpy(&(q0->v[*index]), q->v, q->nbVer*sizeof(MMG5_int));
     (*index)+= q->nbVer;
     for(i = 0; i<(*index); ++i)
       assert(q0->v[i]>0);
@@ -858,19 +969,20 @@ void _MMG3D_mergeBranchesRec(_MMG3D_octree_s* q0, _MMG3D_octree_s* q, int dim, i
 
 /**
  * \param mesh pointer toward the mesh structure.
+ * \param oc pointer toward the global octree.
  * \param q pointer toward an octree cell.
- * \param dim dimension of the space (=3)
- * \param nv maximum number of points in an octree cell.
  *
  * Merge branches that have a parent counting less than nv vertices.
  *
  */
-void _MMG3D_mergeBranches(MMG5_pMesh mesh,_MMG3D_octree_s* q, int dim, int nv)
+void _MMG3D_mergeBranches(MMG5_pMesh mesh,_MMG3D_pOctree oc,_MMG3D_octree_s* q)
 {
-  int index;
+  MMG5_int index;
   int i;
-  int sizBr;
-  sizBr = 1<<dim;
+  int dim,nv;
+
+  dim   = mesh->dim;
+  nv    = oc->nv;
   index = 0;
   assert(q->v);
   assert(q->branches);
@@ -879,17 +991,18 @@ void _MMG3D_mergeBranches(MMG5_pMesh mesh,_MMG3D_octree_s* q, int dim, int nv)
   for (i = 0; i<(1<<dim); ++i)
   {
     _MMG3D_mergeBranchesRec(q, &(q->branches[i]), dim, nv, &index);
-    _MMG3D_freeOctree_s(mesh,&(q->branches[i]), nv);
+    _MMG3D_freeOctree_s(mesh,oc,&(q->branches[i]));
   }
-  _MMG5_DEL_MEM(mesh,q->branches,sizBr*sizeof(_MMG3D_octree_s));
+  _MMG3D_putPool(&oc->br,q->branches);
+  q->branches = NULL;
 }
 
 /**
  * \param mesh pointer toward the mesh structure.
+ * \param oc pointer toward the global octree.
  * \param q pointer toward an octree cell.
  * \param ver vertex coordinates scaled such that the quadrant is [0;1]x[0;1]x[0;1]
  * \param no vertex index in the mesh.
- * \param nv maximum number of points in an octree cell.
  * \return 1 if ok 0 if memory saturated
  *
  * Delete vertex \a no from the octree. This function is recursively
@@ -898,12 +1011,18 @@ void _MMG3D_mergeBranches(MMG5_pMesh mesh,_MMG3D_octree_s* q, int dim, int nv)
  * quadrant is the [0;1]x[0;1]x[0;1] box.
  *
  */
-int _MMG3D_delOctreeRec(MMG5_pMesh mesh, _MMG3D_octree_s* q, double* ver, const int no, const int nv)
+int _MMG3D_delOctreeRec(MMG5_pMesh mesh, _MMG3D_pOctree oc, _MMG3D_octree_s* q,
+                        double* ver, const MMG5_int no)
 {
   int i;
   int quadrant;
   int dim = mesh->dim;
-  int nbVerTemp;
+  int nv  = oc->nv;
+  int nbBitsInt,depthMax;
+  MMG5_int nbVerTemp;
+
+  nbBitsInt = sizeof(int64_t)*8;
+  depthMax  = nbBitsInt/dim - 1;
 
   if (q->v)
   {
@@ -915,7 +1034,15 @@ int _MMG3D_delOctreeRec(MMG5_pMesh mesh, _MMG3D_octree_s* q, double* ver, const
           return 0;
         if ( q->nbVer == 0)
         {
-          _MMG5_DEL_MEM(mesh,q->v,sizeof(int));
+          if ( q->depth < depthMax )
+          {
+            _MMG3D_putPool(&oc->vl,q->v);
+            q->v = NULL;
+          }
+          else
+          {
+            _MMG5_DEL_MEM(mesh,q->v,sizeof(MMG5_int));
+          }
         }
         break;
       }
@@ -934,15 +1061,14 @@ int _MMG3D_delOctreeRec(MMG5_pMesh mesh, _MMG3D_octree_s* q, double* ver, const
     nbVerTemp = q->branches[quadrant].nbVer;
 
     // warning: calling recursively here is not optimal
-    if(!_MMG3D_delOctreeRec(mesh, &(q->branches[quadrant]), ver, no, nv))
+    if(!_MMG3D_delOctreeRec(mesh, oc, &(q->branches[quadrant]), ver, no))
       return 0;
 
     if (nbVerTemp > q->branches[quadrant].nbVer)
     {
-      _MMG5_ADD_MEM(mesh,nv*sizeof(int),"octree vertices table",
-                    return 0);
-      _MMG5_SAFE_MALLOC(q->v,nv,int,0);
-      _MMG3D_mergeBranches(mesh,q,dim,nv);
+      q->v = (MMG5_int*)_MMG3D_getPool(mesh,&oc->vl);
+      if ( !q->v ) return 0;
+      _MMG3D_mergeBranches(mesh,oc,q);
     }else
     {
       ++q->nbVer;
@@ -960,7 +1086,7 @@ int _MMG3D_delOctreeRec(MMG5_pMesh mesh, _MMG3D_octree_s* q, double* ver, const
 
     --q->nbVer;
     nbVerTemp = q->branches[quadrant].nbVer;
-    if(!_MMG3D_delOctreeRec(mesh, &(q->branches[quadrant]), ver, no, nv))
+    if(!_MMG3D_delOctreeRec(mesh, oc, &(q->branches[quadrant]), ver, no))
       return 0;
     if (nbVerTemp <= q->branches[quadrant].nbVer) // test if deletion worked
     {
@@ -979,7 +1105,7 @@ int _MMG3D_delOctreeRec(MMG5_pMesh mesh, _MMG3D_octree_s* q, double* ver, const
  * Delete the vertex \a no from the octree structure.
  *
  */
-int _MMG3D_delOctree(MMG5_pMesh mesh, _MMG3D_pOctree q, const int no)
+int _MMG3D_delOctree(MMG5_pMesh mesh, _MMG3D_pOctree q, const MMG5_int no)
 {
   double pt[3];
   int    dim;
@@ -989,7 +1115,7 @@ int _MMG3D_delOctree(MMG5_pMesh mesh, _MMG3D_pOctree q, const int no)
   assert(MG_VOK(&mesh->point[no]));
 
   memcpy(&pt, mesh->point[no].c ,dim*sizeof(double));
-  if(!_MMG3D_delOctreeRec(mesh, q->q0, pt , no, q->nv))
+  if(!_MMG3D_delOctreeRec(mesh, q, q->q0, pt , no))
   {
     return 0;
   }
@@ -1019,7 +1145,7 @@ void _MMG3D_printArbreDepth(_MMG3D_octree_s* q, int depth, int nv, int dim)
     }
   }else if (q->depth == depth)
   {
-    fprintf(stdout,"%i ",q->nbVer);
+    fprintf(stdout,"%" MMG5_PRId " ",q->nbVer);
   }
 }
 
@@ -1082,7 +1208,7 @@ void _MMG3D_printSubArbre(_MMG3D_octree_s* q, int nv, int dim)
 void _MMG3D_sizeArbreRec(_MMG3D_octree_s* q, int nv, int dim,int* s1, int* s2)
 {
   int i;
-  int nVer;
+  MMG5_int nVer;
   if (q->branches != NULL)
   {
     for (i= 0; i <(1<<dim); i++)
@@ -1102,7 +1228,7 @@ void _MMG3D_sizeArbreRec(_MMG3D_octree_s* q, int nv, int dim,int* s1, int* s2)
     nVer |= nVer >> 16;
     nVer++;
     nVer = (nVer < nv) ? nVer : ((q->nbVer-0.1)/nv+1)*nv;
-    (*s2) += nVer*sizeof(int);
+    (*s2) += nVer*sizeof(MMG5_int);
     (*s1) += sizeof(_MMG3D_octree_s);
   }else
   {
@@ -1159,7 +1285,7 @@ int _MMG3D_sizeArbreLinkRec(_MMG3D_octree_s* q, int nv, int dim)
     return sizeBranches;
   }else if(q->v != NULL)
   {
-    return sizeof(int)+sizeof(_MMG3D_octree_s);
+    return sizeof(MMG5_int)+sizeof(_MMG3D_octree_s);
   }else
   {
     return sizeof(_MMG3D_octree_s);
@@ -1179,7 +1305,7 @@ int _MMG3D_sizeArbreLink(_MMG3D_pOctree q)
   int dim;
 
   dim = 3;
-  return _MMG3D_sizeArbreLinkRec(q->q0, q->nv, dim)+q->q0->nbVer*sizeof(int);
+  return _MMG3D_sizeArbreLinkRec(q->q0, q->nv, dim)+q->q0->nbVer*sizeof(MMG5_int);
 }
 
 /**
@@ -1189,15 +1315,16 @@ int _MMG3D_sizeArbreLink(_MMG3D_pOctree q)
  *
  */
 static inline
-int NearNeighborSquare(MMG5_pMesh mesh, double* ani, _MMG3D_pOctree q, int no, double l, int dim)
+MMG5_int NearNeighborSquare(MMG5_pMesh mesh, double* ani, _MMG3D_pOctree q, MMG5_int no, double l, int dim)
 {
   MMG5_pPoint   ppt,ppt1;
   _MMG3D_octree_s** qlist;
-  int ns,nver;
+  int ns;
+  MMG5_int nver;
   double *rect;
   double lmin =10;
   double x,y,z;
-  int nmin;
+  MMG5_int nmin;
   int i, j;
 
   nmin = 0;
@@ -1237,7 +1364,6 @@ int NearNeighborSquare(MMG5_pMesh mesh, double* ani, _MMG3D_pOctree q, int no, d
     }
   }
 
-  _MMG5_SAFE_FREE(qlist);
   _MMG5_SAFE_FREE(rect);
 
   if (sqrt(lmin)<l)
@@ -1259,11 +1385,12 @@ int NearNeighborSquare(MMG5_pMesh mesh, double* ani, _MMG3D_pOctree q, int no, d
  * metric).
  *
  */
-int _MMG3D_octreein_iso(MMG5_pMesh mesh,MMG5_pSol sol,_MMG3D_pOctree octree,int ip,double lmax) {
+int _MMG3D_octreein_iso(MMG5_pMesh mesh,MMG5_pSol sol,_MMG3D_pOctree octree,MMG5_int ip,double lmax) {
   MMG5_pPoint     ppt,pp1;
   _MMG3D_octree_s **lococ;
   double          d2,ux,uy,uz,hpi,hp1,hpi2,methalo[6];
-  int             ip1,i,j;
+  int             i,j;
+  MMG5_int        ip1;
   int             ncells;
   double          ani[6];
   //double          dmax;
@@ -1292,11 +1419,8 @@ int _MMG3D_octreein_iso(MMG5_pMesh mesh,MMG5_pSol sol,_MMG3D_pOctree octree,int
 
   ncells = _MMG3D_getListSquare(mesh, ani, octree, methalo, &lococ);
   if (ncells < 0)
-  {
-
-    _MMG5_DEL_MEM(mesh,lococ,octree->nc*sizeof(_MMG3D_octree_s*));
     return(0);
-  }
+
   /* Check the octree cells */
   for ( i=0; i<ncells; ++i )
   {
@@ -1316,13 +1440,9 @@ int _MMG3D_octreein_iso(MMG5_pMesh mesh,MMG5_pSol sol,_MMG3D_pOctree octree,int
       d2 = ux*ux + uy*uy + uz*uz;
 
       if ( d2 < hp1 || d2 < hpi2*hpi2 )
-      {
-        _MMG5_DEL_MEM(mesh,lococ,octree->nc*sizeof(_MMG3D_octree_s*));
         return(0);
-      }
     }
   }
-  _MMG5_DEL_MEM(mesh,lococ,octree->nc*sizeof(_MMG3D_octree_s*));
   return(1);
 }
 
@@ -1338,12 +1458,13 @@ int _MMG3D_octreein_iso(MMG5_pMesh mesh,MMG5_pSol sol,_MMG3D_pOctree octree,int
  * anisotropic metric).
  *
  */
-int _MMG3D_octreein_ani(MMG5_pMesh mesh,MMG5_pSol sol,_MMG3D_pOctree octree,int ip,double lmax) {
+int _MMG3D_octreein_ani(MMG5_pMesh mesh,MMG5_pSol sol,_MMG3D_pOctree octree,MMG5_int ip,double lmax) {
   MMG5_pPoint     ppt,pp1;
   _MMG3D_octree_s **lococ;
   double          d2,ux,uy,uz,methalo[6];
   double          det,dmi, *ma, *mb,m1,m2,m3,dx,dy,dz;
-  int             iadr,ip1,i,j;
+  int             i,j;
+  MMG5_int        iadr,ip1;
   int             ncells;
   // double          dmax;
 
@@ -1388,13 +1509,11 @@ int _MMG3D_octreein_ani(MMG5_pMesh mesh,MMG5_pSol sol,_MMG3D_pOctree octree,int
   methalo[4] = 2*dy;
   methalo[5] = 2*dz;
 
-  // this function allocates lococ, it has to be deleted after the call
+  // lococ points toward the search list of the octree (valid until the next search)
   ncells = _MMG3D_getListSquare(mesh,ma,octree, methalo, &lococ);
   if (ncells < 0)
-  {
-    _MMG5_DEL_MEM(mesh,lococ,octree->nc*sizeof(_MMG3D_octree_s*));
     return(0);
-  }
+
   /* Check the octree cells */
   for ( i=0; i<ncells; ++i )
   {
@@ -1410,24 +1529,18 @@ int _MMG3D_octreein_ani(MMG5_pMesh mesh,MMG5_pSol sol,_MMG3D_pOctree octree,int
       d2 = ma[0]*ux*ux + ma[3]*uy*uy + ma[5]*uz*uz
         + 2.0*(ma[1]*ux*uy + ma[2]*ux*uz + ma[4]*uy*uz);
       if ( d2 < dmi )
-      {
-        _MMG5_DEL_MEM(mesh,lococ,octree->nc*sizeof(_MMG3D_octree_s*));
         return 0;
-      }
       else
       {
         iadr = ip1*sol->size;
         mb   = &sol->m[iadr];
         d2   = mb[0]*ux*ux + mb[3]*uy*uy + mb[5]*uz*uz
           + 2.0*(mb[1]*ux*uy + mb[2]*ux*uz + mb[4]*uy*uz);
-        if ( d2 < dmi ) {
-          _MMG5_DEL_MEM(mesh,lococ,octree->nc*sizeof(_MMG3D_octree_s*));
+        if ( d2 < dmi )
           return(0);
-        }
       }
     }
   }
 
-  _MMG5_DEL_MEM(mesh,lococ,octree->nc*sizeof(_MMG3D_octree_s*));
   return(1);
 }
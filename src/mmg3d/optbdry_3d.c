@@ -47,7 +47,8 @@ int MMG3D_movetetrapoints(MMG5_pMesh mesh,MMG5_pSol met,_MMG3D_pOctree octree,in
   MMG5_pxTetra  pxt;
   MMG5_pPoint   ppt;
   double        *n;
-  int           i,j,i0,ier,lists[MMG3D_LMAX+2],listv[MMG3D_LMAX+2],ilists,ilistv;
+  int           i,j,i0,ier,ilists,ilistv;
+  MMG5_int      lists[MMG3D_LMAX+2],listv[MMG3D_LMAX+2];
   int           improve,internal,nm,maxit,base,ns;
 
   improve = 1;
@@ -84,7 +85,7 @@ int MMG3D_movetetrapoints(MMG5_pMesh mesh,MMG5_pSol met,_MMG3D_pOctree octree,in
           ier=_MMG5_boulesurfvolp(mesh,k,i0,i,listv,&ilistv,lists,&ilists,1);
           if( !ier )  continue;
           else if ( ier>0 )
-            ier = _MMG5_movbdynompt(mesh,met,octree,listv,ilistv,lists,ilists,improve);
+            ier = mesh->func.movbdynompt(mesh,met,octree,listv,ilistv,lists,ilists,improve);
           else
             return(-1);
         }
@@ -92,7 +93,7 @@ int MMG3D_movetetrapoints(MMG5_pMesh mesh,MMG5_pSol met,_MMG3D_pOctree octree,in
           ier=_MMG5_boulesurfvolp(mesh,k,i0,i,listv,&ilistv,lists,&ilists,0);
           if ( !ier )  continue;
           else if ( ier>0 )
-            ier = _MMG5_movbdyridpt(mesh,met,octree,listv,ilistv,lists,ilists,improve);
+            ier = mesh->func.movbdyridpt(mesh,met,octree,listv,ilistv,lists,ilists,improve);
           else
             return(-1);
         }
@@ -101,7 +102,7 @@ int MMG3D_movetetrapoints(MMG5_pMesh mesh,MMG5_pSol met,_MMG3D_pOctree octree,in
           if ( !ier )
             continue;
           else if ( ier>0 )
-            ier = _MMG5_movbdyrefpt(mesh,met,octree,listv,ilistv,lists,ilists,improve);
+            ier = mesh->func.movbdyrefpt(mesh,met,octree,listv,ilistv,lists,ilists,improve);
           else
             return(-1);
         }
@@ -118,7 +119,7 @@ int MMG3D_movetetrapoints(MMG5_pMesh mesh,MMG5_pSol met,_MMG3D_pOctree octree,in
               continue;
           }
 //#warning CECILE a modifier pour opttyp
-          ier = _MMG5_movbdyregpt(mesh,met, octree, listv,ilistv,lists,ilists,improve,improve);
+          ier = mesh->func.movbdyregpt(mesh,met, octree, listv,ilistv,lists,ilists,improve,improve);
           if ( ier )  ns++;
         }
       }
@@ -153,11 +154,11 @@ int MMG3D_movetetrapoints(MMG5_pMesh mesh,MMG5_pSol met,_MMG3D_pOctree octree,in
  * Try to remove point i of tet k, try the three edges of k containing i.
  *
  */
-int _MMG3D_coledges(MMG5_pMesh mesh,MMG5_pSol met,int k,int i) {
+int _MMG3D_coledges(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int i) {
   MMG5_pTetra pt;
   double      len;
-  int         ied,iedg,iq,i1,ilistcol,listcol[MMG3D_LMAX+2];
-  int         ier;
+  int         ied,iedg,iq,i1,ilistcol;
+  MMG5_int    ier,listcol[MMG3D_LMAX+2];
   char        iface,ief;
 
   pt = &mesh->tetra[k];
@@ -165,7 +166,7 @@ int _MMG3D_coledges(MMG5_pMesh mesh,MMG5_pSol met,int k,int i) {
    /*3 possibilities to remove the vertex ib*/
     for(ied = 0 ; ied<3 ;ied++) {
       iedg  = _MMG5_arpt[i][ied];
-      len =  _MMG5_lenedg(mesh,met,iedg,pt);
+      len =  mesh->func.lenedg(mesh,met,iedg,pt);
 
       if(len > 1.1) continue;
       iface = _MMG5_ifar[iedg][0];
@@ -208,7 +209,8 @@ int _MMG3D_coledges(MMG5_pMesh mesh,MMG5_pSol met,int k,int i) {
  */
 int _MMG3D_deletePoint(MMG5_pMesh mesh,  MMG5_pSol met,_MMG3D_pOctree octree,
                        int k,int i) {
-  int         il,ilist,iel,ip,list[MMG3D_LMAX+2];
+  int         il,ilist;
+  MMG5_int    list[MMG3D_LMAX+2],iel,ip;
 
   ilist = _MMG5_boulevolp(mesh,k,i,list);
   if (ilist > 30 ) return(0);
@@ -238,8 +240,10 @@ int _MMG3D_deletePoint(MMG5_pMesh mesh,  MMG5_pSol met,_MMG3D_pOctree octree,
 int MMG3D_optbdry(MMG5_pMesh mesh,MMG5_pSol met,_MMG3D_pOctree octree,int k) {
   MMG5_pTetra  pt;
   MMG5_pxTetra pxt;
-  int          ib,i,j,ipb,list[MMG3D_LMAX+2];
-  int          iedg,ier,ilist,ied,ia,it1,it2,ret,imove;
+  int          ib,i,j;
+  MMG5_int     ipb,list[MMG3D_LMAX+2];
+  int          iedg,ilist,ied,ia,ret,imove;
+  MMG5_int     ier,it1,it2;
 
   imove = 0;
 
@@ -43,8 +43,10 @@ int _MMG3D_optlap(MMG5_pMesh mesh,MMG5_pSol sol) {
   MMG5_pTetra    pt,pt1;
   MMG5_pPoint    ppt,pptb,ppta;
 
-  int       it,i,k,lon,l,iel,ipt,list[MMG3D_LMAX+2];
-  int       maxiter,ipta,iptb,ipt0,ipt1,ipt2,ipt3,*compt;
+  int       it,lon,l;
+  MMG5_int  ipt,list[MMG3D_LMAX+2],i,k,iel;
+  int       maxiter,*compt;
+  MMG5_int  ipta,iptb,ipt0,ipt1,ipt2,ipt3;
   double    vol,ax,ay,az,bx,by,bz;
   double    *nv,*pos,res,dd,ox,oy,oz,declic;
   double LLAMBDA  = 0.33;
@@ -256,7 +258,7 @@ int _MMG3D_optlap(MMG5_pMesh mesh,MMG5_pSol sol) {
       for(k=1 ; k<=mesh->ne ; k++) {
         pt = &mesh->tetra[k];
         if(!pt->v[0]) continue;
-        pt->qual = _MMG5_caltet(mesh,sol,pt);
+        pt->qual = mesh->func.caltet(mesh,sol,pt);
       }
       if( mesh->info.imprim > 5) fprintf(stdout,"              LAPLACIAN : %8f\n",res);
     } else {
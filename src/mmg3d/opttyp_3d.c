@@ -67,7 +67,8 @@ static int MMG3D_typelt(MMG5_pMesh mesh,int iel,int *item) {
   double    abx,aby,abz,acx,acy,acz,adx,ady,adz,v1,v2,v3,vol;
   double    bcx,bcy,bcz,bdx,bdy,bdz,cdx,cdy,cdz,h[6],volchk,ssmall;
   double    s[4],dd,rapmin,rapmax,surmin,surmax;
-  int       i,k,ia,ib,ic,id,isur,isurmax,isurmin,iarmax,iarmin;
+  int       i,k,isur,isurmax,isurmin,iarmax,iarmin;
+  MMG5_int  ia,ib,ic,id;
   int       nobtus,naigu;
   short     i0,i1,i2;
   double    EPSVOL = 0.001;
@@ -325,7 +326,8 @@ static int MMG3D_typelt(MMG5_pMesh mesh,int iel,int *item) {
 int _MMG3D_swpItem(MMG5_pMesh mesh,  MMG5_pSol met,_MMG3D_pOctree octree,int k,int iar) {
   MMG5_pTetra   pt;
   MMG5_pxTetra  pxt;
-  int           list[MMG3D_LMAX+2],lon,nconf,ier;
+  int           lon,ier;
+  MMG5_int      nconf,list[MMG3D_LMAX+2];
   double        OCRIT = 1.01;
 
   ier = 0;
@@ -392,20 +394,22 @@ int _MMG3D_splitItem(MMG5_pMesh mesh,  MMG5_pSol met,_MMG3D_pOctree octree,
   double        len;
   double        LLONG2 = 0.1;
   int           ier,j;
+  MMG5_int      ip;
 
-  ier = 0;
+  ip = 0;
   pt = &mesh->tetra[k];
 
   if ( mesh->info.noinsert ) return 0;
 
-  len = _MMG5_lenedg(mesh,met,iar,pt);
+  len = mesh->func.lenedg(mesh,met,iar,pt);
   if(len > LLONG2) {
-    ier = _MMG5_splitedg(mesh,met,k,iar,OCRIT);
+    ip = _MMG5_splitedg(mesh,met,k,iar,OCRIT);
   }
+  ier = ( ip > 0 ) ? 1 : (int)ip;
 
-  if ( ier && !mesh->info.nomove ) {
+  if ( ier > 0 && !mesh->info.nomove ) {
     for(j=0 ; j<4 ; j++) {
-      if(pt->v[j] == ier) break;
+      if(pt->v[j] == ip) break;
     }
     assert(j<4);
     if(met->size!=1)
@@ -465,7 +469,8 @@ int MMG3D_opttyp(MMG5_pMesh mesh, MMG5_pSol met,_MMG3D_pOctree octree) {
   MMG5_pxTetra   pxt;
   double         crit;
   int            k,ityp,cs[10],ds[10],item[2];
-  int            ier,i,nd,ne,npeau;
+  int            i,nd,npeau;
+  MMG5_int       ne,ier;
   int            it,maxit,ntot,base;
 //  double         OCRIT = 1.01;
   int            nbdy,nbdy2 ;
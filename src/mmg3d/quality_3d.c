@@ -34,7 +34,344 @@
 
 #include "inlined_functions_3d.h"
 
-extern char ddb;
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \return pointer toward the packed coordinates, NULL if the memory is not
+ * sufficient.
+ *
+ * Copy the coordinates of the points in a contiguous array (coordinates of
+ * the point \a k at position \a 3k). The loops over all the tetra may then
+ * load only the hot data of the points instead of the whole \ref MMG5_Point
+ * structures (useful when consecutive tetra have distant vertices). The array
+ * is counted in the mesh memory and must be freed by \ref _MMG3D_freeCoor.
+ *
+ */
+double *_MMG3D_packCoor(MMG5_pMesh mesh) {
+  double  *coor;
+  MMG5_int k;
+
+  if ( mesh->memCur + (long long)(3*(mesh->np+1)*sizeof(double)) > mesh->memMax )
+    return(NULL);
+
+  _MMG5_ADD_MEM(mesh,3*(mesh->np+1)*sizeof(double),"packed coordinates",
+                return(NULL));
+  _MMG5_SAFE_MALLOC(coor,3*(mesh->np+1),double,NULL);
+
+  coor[0] = coor[1] = coor[2] = 0.;
+  for (k=1; k<=mesh->np; k++)
+    memcpy(&coor[3*k],mesh->point[k].c,3*sizeof(double));
+
+  return(coor);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param coor pointer toward the packed coordinates.
+ *
+ * Free the array allocated by \ref _MMG3D_packCoor.
+ *
+ */
+void _MMG3D_freeCoor(MMG5_pMesh mesh,double **coor) {
+  _MMG5_DEL_MEM(mesh,*coor,3*(mesh->np+1)*sizeof(double));
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \return 1 if the cache is allocated, 0 otherwise.
+ *
+ * Allocate the cache of the extreme edge lengths of the tetra. If the memory
+ * is not sufficient, the lengths are computed at each call of \ref
+ * _MMG3D_extLength.
+ *
+ */
+int _MMG3D_newLength(MMG5_pMesh mesh) {
+
+  if ( mesh->ledg )  return(1);
+
+  if ( mesh->memCur + (long long)((mesh->nemax+1)*sizeof(_MMG3D_Length))
+       > mesh->memMax )
+    return(0);
+
+  _MMG5_ADD_MEM(mesh,(mesh->nemax+1)*sizeof(_MMG3D_Length),"length cache",
+                return(0));
+  _MMG5_SAFE_CALLOC(mesh->ledg,mesh->nemax+1,_MMG3D_Length,0);
+  mesh->ledgmax = mesh->nemax;
+
+  return(1);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ *
+ * Free the cache of the extreme edge lengths of the tetra.
+ *
+ */
+void _MMG3D_freeLength(MMG5_pMesh mesh) {
+
+  if ( !mesh->ledg )  return;
+
+  _MMG5_DEL_MEM(mesh,mesh->ledg,(mesh->ledgmax+1)*sizeof(_MMG3D_Length));
+  mesh->ledgmax = 0;
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param met pointer toward the metric structure.
+ * \param k index of the tetra.
+ * \param keep 1 to cache the lengths whatever the mark of the tetra (the
+ * points must not move until the cache is freed).
+ * \param imin pointer toward the local index of the shortest edge (-1 if all
+ * the edges are required).
+ * \param lmin pointer toward the length of the shortest edge.
+ * \param imax pointer toward the local index of the longest edge (-1 if no
+ * edge has a positive length).
+ * \param lmax pointer toward the length of the longest edge.
+ *
+ * Get the shortest and longest non required edges of the tetra \a k, from the
+ * cache if the tetra is unchanged since their computation (same vertices and
+ * same mark). The operators that move the points or modify a tetra mark it
+ * with \a mesh->mark: the lengths of a tetra are thus cached only if its mark
+ * is lower, unless \a keep is set.
+ *
+ */
+void _MMG3D_extLength(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,char keep,
+                      char *imin,double *lmin,char *imax,double *lmax) {
+  MMG5_pTetra    pt;
+  MMG5_pxTetra   pxt;
+  _MMG3D_pLength pl;
+  double         len;
+  char           i;
+
+  pt = &mesh->tetra[k];
+  pl = ( mesh->ledg && k <= mesh->ledgmax ) ? &mesh->ledg[k] : NULL;
+
+  if ( pl && pl->mark == pt->mark && pl->v[0] == pt->v[0]
+       && pl->v[1] == pt->v[1] && pl->v[2] == pt->v[2]
+       && pl->v[3] == pt->v[3] ) {
+    *imin = pl->imin;
+    *lmin = pl->lmin;
+    *imax = pl->imax;
+    *lmax = pl->lmax;
+    return;
+  }
+
+  pxt = pt->xt ? &mesh->xtetra[pt->xt] : 0;
+  *imax = -1; *lmax = 0.0;
+  *imin = -1; *lmin = DBL_MAX;
+  for (i=0; i<6; i++) {
+    if ( pt->xt && (pxt->tag[i] & MG_REQ) )  continue;
+    len = mesh->func.lenedg(mesh,met,i,pt);
+
+    if ( len > *lmax ) {
+      *lmax = len;
+      *imax = i;
+    }
+    if ( len < *lmin ) {
+      *lmin = len;
+      *imin = i;
+    }
+  }
+  if ( !pl )  return;
+
+  if ( keep || pt->mark < mesh->mark ) {
+    memcpy(pl->v,pt->v,4*sizeof(MMG5_int));
+    pl->mark = pt->mark;
+    pl->imin = *imin;
+    pl->lmin = *lmin;
+    pl->imax = *imax;
+    pl->lmax = *lmax;
+  }
+  else
+    pl->v[0] = 0;
+}
+
+/**
+ * \param n number of tetra of the batch.
+ * \param c coordinates of the vertices of the tetra of the batch (\a c[3*i+j][l]
+ * is the coordinate \a j of the vertex \a i of the tetra \a l).
+ * \param qual computed qualities (without the checks of degeneracy).
+ * \param vol computed volumes (times 6).
+ * \param rap computed sums of the squared edge lengths.
+ *
+ * Vectorized part of \ref _MMG5_caltet_iso_4pt for a batch of tetra: the
+ * operations are the same but the degeneracy checks are left to the caller.
+ *
+ */
+_MMG3D_BATCH_KERNEL
+static
+void _MMG3D_caltetKernel_iso(MMG5_int n,double c[12][_MMG3D_NBATCH],double *qual,
+                             double *vol,double *rap) {
+  double       abx,aby,abz,acx,acy,acz,adx,ady,adz,bcx,bcy,bcz,bdx,bdy,bdz;
+  double       cdx,cdy,cdz;
+  double       v1,v2,v3,r;
+  int          l;
+
+  for (l=0; l<n; l++) {
+    /* volume */
+    abx = c[3][l] - c[0][l];
+    aby = c[4][l] - c[1][l];
+    abz = c[5][l] - c[2][l];
+    r = abx*abx + aby*aby + abz*abz;
+
+    acx = c[6][l] - c[0][l];
+    acy = c[7][l] - c[1][l];
+    acz = c[8][l] - c[2][l];
+    r += acx*acx + acy*acy + acz*acz;
+
+    adx = c[9][l]  - c[0][l];
+    ady = c[10][l] - c[1][l];
+    adz = c[11][l] - c[2][l];
+    r += adx*adx + ady*ady + adz*adz;
+
+    v1  = acy*adz - acz*ady;
+    v2  = acz*adx - acx*adz;
+    v3  = acx*ady - acy*adx;
+    vol[l] = abx * v1 + aby * v2 + abz * v3;
+
+    bcx = c[6][l] - c[3][l];
+    bcy = c[7][l] - c[4][l];
+    bcz = c[8][l] - c[5][l];
+    r += bcx*bcx + bcy*bcy + bcz*bcz;
+
+    bdx = c[9][l]  - c[3][l];
+    bdy = c[10][l] - c[4][l];
+    bdz = c[11][l] - c[5][l];
+    r += bdx*bdx + bdy*bdy + bdz*bdz;
+
+    cdx = c[9][l]  - c[6][l];
+    cdy = c[10][l] - c[7][l];
+    cdz = c[11][l] - c[8][l];
+    r += cdx*cdx + cdy*cdy + cdz*cdz;
+
+    /* quality = vol / len^3/2 */
+    rap[l]  = r;
+    qual[l] = vol[l] / (r * sqrt(r));
+  }
+}
+
+/**
+ * \param coor packed coordinates of the points.
+ * \param pt pointer toward the first tetra of the batch.
+ * \param n number of tetra of the batch (at most \a _MMG3D_NBATCH).
+ * \param qual computed qualities (0 for the unused tetra).
+ *
+ * Compute the isotropic qualities of the \a n consecutive tetra starting at \a
+ * pt. Same values as \ref _MMG5_caltet_iso.
+ *
+ */
+static
+void _MMG3D_caltetBatch_iso(double *coor,MMG5_pTetra pt,MMG5_int n,double *qual) {
+  double c[12][_MMG3D_NBATCH],vol[_MMG3D_NBATCH],rap[_MMG3D_NBATCH],*a;
+  int    l,i,j;
+
+  for (l=0; l<n; l++) {
+    if ( !MG_EOK(&pt[l]) ) {
+      for (j=0; j<12; j++)  c[j][l] = 0.0;
+      continue;
+    }
+    for (i=0; i<4; i++) {
+      a = &coor[3*pt[l].v[i]];
+      for (j=0; j<3; j++)  c[3*i+j][l] = a[j];
+    }
+  }
+  _MMG3D_caltetKernel_iso(n,c,qual,vol,rap);
+
+  for (l=0; l<n; l++) {
+    if ( vol[l] < _MMG5_EPSD2 || rap[l] < _MMG5_EPSD2 )  qual[l] = 0.0;
+  }
+}
+
+
+/**
+ * \param coor packed coordinates of the points.
+ * \param m isotropic metric.
+ * \param ip1 first extremity of the edge.
+ * \param ip2 second extremity of the edge.
+ * \return The isotropic length of the edge.
+ *
+ * Same as \ref _MMG5_lenSurfEdg_iso with the packed coordinates.
+ *
+ */
+static inline
+double _MMG3D_lenedgPacked_iso(double *coor,double *m,MMG5_int ip1,MMG5_int ip2) {
+  double   *c1,*c2,h1,h2,l,r,len;
+
+  c1 = &coor[3*ip1];
+  c2 = &coor[3*ip2];
+  h1 = m[ip1];
+  h2 = m[ip2];
+  l = (c2[0]-c1[0])*(c2[0]-c1[0]) + (c2[1]-c1[1])*(c2[1]-c1[1]) \
+    + (c2[2]-c1[2])*(c2[2]-c1[2]);
+  l = sqrt(l);
+  r = h2 / h1 - 1.0;
+  len = fabs(r) < _MMG5_EPS ? l / h1 : l / (h2-h1) * log(r+1.0);
+
+  return(len);
+}
+
+/**
+ * \param n number of edges of the batch.
+ * \param c coordinates of the extremities of the edges of the batch (\a
+ * c[3*i+j][l] is the coordinate \a j of the extremity \a i of the edge \a l).
+ * \param h sizes at the extremities of the edges of the batch.
+ * \param len euclidean lengths of the edges.
+ * \param r ratios of the sizes at the extremities minus 1.
+ *
+ * Vectorized part of \ref _MMG3D_lenedgPacked_iso for a batch of edges.
+ *
+ */
+_MMG3D_BATCH_KERNEL
+static
+void _MMG3D_lenedgKernel_iso(int n,double c[6][_MMG3D_NBATCH],
+                             double h[2][_MMG3D_NBATCH],double *len,double *r) {
+  double l;
+  int    k;
+
+  for (k=0; k<n; k++) {
+    l = (c[3][k]-c[0][k])*(c[3][k]-c[0][k]) + (c[4][k]-c[1][k])*(c[4][k]-c[1][k]) \
+      + (c[5][k]-c[2][k])*(c[5][k]-c[2][k]);
+    len[k] = sqrt(l);
+    r[k]   = h[1][k] / h[0][k] - 1.0;
+  }
+}
+
+/**
+ * \param coor packed coordinates of the points.
+ * \param m isotropic metric.
+ * \param n number of edges of the batch (at most \a _MMG3D_NBATCH).
+ * \param ip1 first extremities of the edges.
+ * \param ip2 second extremities of the edges.
+ * \param len computed lengths.
+ *
+ * Compute the isotropic lengths of a batch of edges. Same values as \ref
+ * _MMG3D_lenedgPacked_iso.
+ *
+ */
+static
+void _MMG3D_lenedgBatch_iso(double *coor,double *m,int n,MMG5_int *ip1,MMG5_int *ip2,
+                            double *len) {
+  double c[6][_MMG3D_NBATCH],h[2][_MMG3D_NBATCH],r[_MMG3D_NBATCH];
+  int    k,j;
+
+  for (k=0; k<n; k++) {
+    for (j=0; j<3; j++) {
+      c[j][k]   = coor[3*ip1[k]+j];
+      c[3+j][k] = coor[3*ip2[k]+j];
+    }
+    h[0][k] = m[ip1[k]];
+    h[1][k] = m[ip2[k]];
+  }
+  _MMG3D_lenedgKernel_iso(n,c,h,len,r);
+
+  for (k=0; k<n; k++) {
+    len[k] = fabs(r[k]) < _MMG5_EPS ?
+      len[k] / h[0][k] : len[k] / (h[1][k]-h[0][k]) * log(r[k]+1.0);
+  }
+}
 
 /**
  * \param mesh pointer toward the mesh structure.
@@ -46,30 +383,67 @@ extern char ddb;
  *
  */
 int _MMG3D_tetraQual(MMG5_pMesh mesh, MMG5_pSol met,char metRidTyp) {
-  MMG5_pTetra pt;
-  double      minqual;
-  int         k,iel;
+  MMG5_pTetra    pt;
+  _MMG5_quaStat  *st,*ps;
+  double         *coor,qual[_MMG3D_NBATCH];
+  int            nth,ier;
+  MMG5_int       k0,k,n;
 
-  minqual = 2./_MMG3D_ALPHAD;
+#ifdef _OPENMP
+  nth = MG_MAX(1,mesh->info.nthreads);
+#else
+  nth = 1;
+#endif
 
-  /*compute tet quality*/
-  for (k=1; k<=mesh->ne; k++) {
-    pt = &mesh->tetra[k];
-     if( !MG_EOK(pt) )   continue;
+  /* no tetra is counted: iel stores the index of the worst tetra */
+  _MMG5_SAFE_CALLOC(st,nth,_MMG5_quaStat,0);
+  _MMG5_initQuaStat(st,nth,2./_MMG3D_ALPHAD,0.);
 
-     if ( !metRidTyp && met->size == 6 && met->m ) {
-       pt->qual = _MMG5_caltet33_ani(mesh,met,pt);
-     }
-     else
-       pt->qual = _MMG5_orcal(mesh,met,k);
+  /* isotropic quality: use the packed coordinates */
+  coor = NULL;
+  if ( met->size == 1 && !mesh->info.optimLES )
+    coor = _MMG3D_packCoor(mesh);
 
-    if ( pt->qual < minqual ) {
-      minqual = pt->qual;
-      iel     = k;
+  /*compute tet quality*/
+#pragma omp parallel num_threads(nth) private(pt,ps,k,n,qual)
+  {
+#ifdef _OPENMP
+    ps = &st[omp_get_thread_num()];
+#else
+    ps = st;
+#endif
+#pragma omp for schedule(static)
+    for (k0=1; k0<=mesh->ne; k0+=_MMG3D_NBATCH) {
+      n = MG_MIN(_MMG3D_NBATCH,mesh->ne-k0+1);
+      if ( coor )
+        _MMG3D_caltetBatch_iso(coor,&mesh->tetra[k0],n,qual);
+
+      for (k=k0; k<k0+n; k++) {
+        pt = &mesh->tetra[k];
+        if( !MG_EOK(pt) )   continue;
+
+        if ( coor )
+          pt->qual = qual[k-k0];
+        else if ( !metRidTyp && met->size == 6 && met->m ) {
+          pt->qual = _MMG5_caltet33_ani(mesh,met,pt);
+        }
+        else
+          pt->qual = _MMG5_orcal(mesh,met,k);
+
+        if ( pt->qual < ps->rapmin ) {
+          ps->rapmin = pt->qual;
+          ps->iel    = k;
+        }
+      }
     }
   }
+  if ( coor )  _MMG3D_freeCoor(mesh,&coor);
 
-  return ( _MMG5_minQualCheck(iel,minqual,_MMG3D_ALPHAD) );
+  _MMG5_mergeQuaStat(st,nth,0);
+  ier = _MMG5_minQualCheck(st[0].iel,st[0].rapmin,_MMG3D_ALPHAD);
+
+  _MMG5_SAFE_FREE(st);
+  return(ier);
 }
 
 /**
@@ -90,7 +464,8 @@ inline double _MMG5_caltet33_ani(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTetra pt) {
   double       h1,h2,h3,h4,h5,h6,det,vol,rap,v1,v2,v3,num;
   double       *a,*b,*c,*d;
   double       mm[6];
-  int          ip[4],iad0,iad1,iad2,iad3,k;
+  int          k;
+  MMG5_int     ip[4],iad0,iad1,iad2,iad3;
 
   ip[0] = pt->v[0];
   ip[1] = pt->v[1];
@@ -176,6 +551,75 @@ inline double _MMG5_caltet33_ani(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTetra pt) {
 }
 
 
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param met pointer toward the metric structure.
+ * \param coor packed coordinates of the points (NULL if not used).
+ * \param metRidTyp Type of storage of ridges metrics: 0 for classic storage,
+ * 1 for special storage.
+ * \param pt pointer toward a tetra.
+ * \param ia local index of the edge in \a pt.
+ * \return the length of the edge \a ia of \a pt.
+ *
+ * Compute the length of an edge for the edge statistics.
+ *
+ */
+static inline
+double _MMG3D_lenedgStat(MMG5_pMesh mesh,MMG5_pSol met,double *coor,
+                         char metRidTyp,MMG5_pTetra pt,int ia) {
+
+  if ( coor )
+    return(_MMG3D_lenedgPacked_iso(coor,met->m,pt->v[_MMG5_iare[ia][0]],
+                                   pt->v[_MMG5_iare[ia][1]]));
+  else if ( (!metRidTyp) && met->size==6 && met->m )
+    return(_MMG5_lenedg33_ani(mesh,met,ia,pt));
+
+  return(mesh->func.lenedg(mesh,met,ia,pt));
+}
+
+/**
+ * \param st pointer toward the statistics of the current range of edges.
+ * \param len length of the edge.
+ * \param np first extremity of the edge.
+ * \param nq second extremity of the edge.
+ * \param bd pointer toward the table of the length span.
+ *
+ * Add the length of the edge \a np \a nq to the statistics.
+ *
+ */
+static inline
+void _MMG3D_lenStatAdd(_MMG5_lenStat *st,double len,MMG5_int np,MMG5_int nq,double *bd) {
+  int i;
+
+  if ( !len ) {
+    ++st->nullEdge;
+    return;
+  }
+  st->avlen += len;
+  st->ned ++;
+
+  if( len < st->lmin ) {
+    st->lmin = len;
+    st->amin = np;
+    st->bmin = nq;
+  }
+
+  if ( len > st->lmax ) {
+    st->lmax = len;
+    st->amax = np;
+    st->bmax = nq;
+  }
+
+  /* Locate size of edge among given table */
+  for(i=0; i<8; i++) {
+    if ( bd[i] <= len && len < bd[i+1] ) {
+      st->hl[i]++;
+      break;
+    }
+  }
+  if( i == 8 ) st->hl[8]++;
+}
+
 /**
  * \param mesh pointer toward the mesh structure.
  * \param met pointer toward the metric structure.
@@ -185,23 +629,28 @@ inline double _MMG5_caltet33_ani(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTetra pt) {
  *
  * Compute sizes of edges of the mesh, and displays histo.
  *
+ * Each edge is analyzed by the first tetra of its shell found when popping
+ * the edges from the hash table. This pop is sequential but the lengths are
+ * computed in parallel afterwards, the tetra storing the edges that they
+ * analyze in a bit mask (if the memory is sufficient).
+ *
  */
 int _MMG3D_prilen(MMG5_pMesh mesh, MMG5_pSol met, char metRidTyp) {
   MMG5_pTetra     pt;
   MMG5_pPoint     ppt;
   _MMG5_Hash      hash;
-  double          len,avlen,lmin,lmax;
-  int             k,np,nq,amin,bmin,amax,bmax,ned,hl[9],nullEdge,n;
-  char            ia,i0,i1,ier,i;
+  _MMG5_lenStat   *st,*ps;
+  double          *coor,len[_MMG3D_NBATCH];
+  int             n,nth;
+  MMG5_int        np,nq,ip1[_MMG3D_NBATCH],ip2[_MMG3D_NBATCH],k;
+  char            ia,i0,i1,ier,i,*own;
   static double   bd[9]= {0.0, 0.3, 0.6, 0.7071, 0.9, 1.3, 1.4142, 2.0, 5.0};
 
-  memset(hl,0,9*sizeof(int));
-  ned = 0;
-  avlen = 0.0;
-  lmax = 0.0;
-  lmin = 1.e30;
-  amin = amax = bmin = bmax = 0;
-  nullEdge = 0;
+#ifdef _OPENMP
+  nth = MG_MAX(1,mesh->info.nthreads);
+#else
+  nth = 1;
+#endif
 
   /* Hash all edges in the mesh */
   if ( !_MMG5_hashNew(mesh,&hash,mesh->np,7*mesh->np) )  return(0);
@@ -224,6 +673,21 @@ int _MMG3D_prilen(MMG5_pMesh mesh, MMG5_pSol met, char metRidTyp) {
     }
   }
 
+  _MMG5_SAFE_CALLOC(st,nth,_MMG5_lenStat,0);
+  _MMG5_initLenStat(st,nth,1.e30);
+
+  /* isotropic lengths: use the packed coordinates */
+  coor = NULL;
+  if ( met->size == 1 && met->m )
+    coor = _MMG3D_packCoor(mesh);
+
+  /* bit ia of own[k] is set if the edge ia of k is analyzed by k */
+  own = NULL;
+  if ( mesh->memCur + (long long)((mesh->ne+1)*sizeof(char)) <= mesh->memMax ) {
+    _MMG5_ADD_MEM(mesh,(mesh->ne+1)*sizeof(char),"edge owners",return(0));
+    _MMG5_SAFE_CALLOC(own,mesh->ne+1,char,0);
+  }
+
   /* Pop edges from hash table, and analyze their length */
   for(k=1; k<=mesh->ne; k++) {
     pt = &mesh->tetra[k];
@@ -245,51 +709,71 @@ int _MMG3D_prilen(MMG5_pMesh mesh, MMG5_pSol met, char metRidTyp) {
 
       /* Remove edge from hash ; ier = 1 if edge has been found */
       ier = _MMG5_hashPop(&hash,np,nq);
-      if( ier ) {
-        if ( (!metRidTyp) && met->size==6 && met->m ) {
-          len = _MMG5_lenedg33_ani(mesh,met,ia,pt);
-        }
-        else
-          len = _MMG5_lenedg(mesh,met,ia,pt);
+      if( !ier )  continue;
 
+      if ( own )
+        own[k] |= 1 << ia;
+      else
+        _MMG3D_lenStatAdd(st,_MMG3D_lenedgStat(mesh,met,coor,metRidTyp,pt,ia),
+                          np,nq,bd);
+    }
+  }
+  _MMG5_DEL_MEM(mesh,hash.item,hash.siz*sizeof(_MMG5_hedge));
 
-        if ( !len ) {
-          ++nullEdge;
-        }
-        else {
-          avlen += len;
-          ned ++;
-
-          if( len < lmin ) {
-            lmin = len;
-            amin = np;
-            bmin = nq;
-          }
-
-          if ( len > lmax ) {
-            lmax = len;
-            amax = np;
-            bmax = nq;
+  if ( own ) {
+#pragma omp parallel num_threads(nth) private(pt,ia,ps,i,np,nq,n,ip1,ip2,len)
+    {
+#ifdef _OPENMP
+      ps = &st[omp_get_thread_num()];
+#else
+      ps = st;
+#endif
+      n = 0;
+#pragma omp for schedule(static)
+      for(k=1; k<=mesh->ne; k++) {
+        if ( !own[k] )  continue;
+        pt = &mesh->tetra[k];
+
+        for(ia=0; ia<6; ia++) {
+          if ( !(own[k] & (1 << ia)) )  continue;
+          np = pt->v[_MMG5_iare[ia][0]];
+          nq = pt->v[_MMG5_iare[ia][1]];
+          if ( !coor ) {
+            _MMG3D_lenStatAdd(ps,_MMG3D_lenedgStat(mesh,met,coor,metRidTyp,pt,ia),
+                              np,nq,bd);
+            continue;
           }
 
-          /* Locate size of edge among given table */
-          for(i=0; i<8; i++) {
-            if ( bd[i] <= len && len < bd[i+1] ) {
-              hl[i]++;
-              break;
-            }
+          /* isotropic lengths: evaluated by batches */
+          ip1[n]   = np;
+          ip2[n++] = nq;
+          if ( n == _MMG3D_NBATCH ) {
+            _MMG3D_lenedgBatch_iso(coor,met->m,n,ip1,ip2,len);
+            for (i=0; i<n; i++)
+              _MMG3D_lenStatAdd(ps,len[i],ip1[i],ip2[i],bd);
+            n = 0;
           }
-          if( i == 8 ) hl[8]++;
         }
       }
+      /* last batch of the thread */
+      if ( n ) {
+        _MMG3D_lenedgBatch_iso(coor,met->m,n,ip1,ip2,len);
+        for (i=0; i<n; i++)
+          _MMG3D_lenStatAdd(ps,len[i],ip1[i],ip2[i],bd);
+      }
     }
+    _MMG5_DEL_MEM(mesh,own,(mesh->ne+1)*sizeof(char));
   }
+  if ( coor )  _MMG3D_freeCoor(mesh,&coor);
+
+  _MMG5_mergeLenStat(st,nth);
 
   /* Display histogram */
-  _MMG5_displayHisto(mesh, ned, &avlen, amin, bmin, lmin,
-                     amax, bmax, lmax,nullEdge, &bd[0], &hl[0],1);
+  _MMG5_displayHisto(mesh, st[0].ned, &st[0].avlen, st[0].amin, st[0].bmin,
+                     st[0].lmin, st[0].amax, st[0].bmax, st[0].lmax,
+                     st[0].nullEdge, &bd[0], &st[0].hl[0],1);
 
-  _MMG5_DEL_MEM(mesh,hash.item,(hash.max+1)*sizeof(_MMG5_hedge));
+  _MMG5_SAFE_FREE(st);
   return(1);
 }
 
@@ -303,67 +787,93 @@ int _MMG3D_prilen(MMG5_pMesh mesh, MMG5_pSol met, char metRidTyp) {
  */
 static int _MMG3D_printquaLES(MMG5_pMesh mesh,MMG5_pSol met) {
   MMG5_pTetra    pt;
+  _MMG5_quaStat  *st,*ps;
   double         rap,rapmin,rapmax,rapavg,med,good;
-  int            k,iel,ok,nex,his[5];
-  static char    mmgWarn0=0;
+  int            nth;
+  MMG5_int       iel,nex,*his,k;
+  char           warn;
+  static _MMG5_TLS char    mmgWarn0=0;
 
-  /*compute tet quality*/
-  for (k=1; k<=mesh->ne; k++) {
-    pt = &mesh->tetra[k];
-     if( !MG_EOK(pt) )   continue;
+#ifdef _OPENMP
+  nth = MG_MAX(1,mesh->info.nthreads);
+#else
+  nth = 1;
+#endif
 
-     pt->qual = _MMG5_orcal(mesh,met,k);
-  }
-  if ( mesh->info.imprim <= 0 ) return 1;
+  _MMG5_SAFE_CALLOC(st,nth,_MMG5_quaStat,0);
+  _MMG5_initQuaStat(st,nth,0.0,1.0);
+  warn = mmgWarn0;
 
-  rapmin  = 0.0;
-  rapmax  = 1.0;
-  rapavg  = med = good = 0.0;
-  iel     = 0;
+  /*compute tet quality and its statistics*/
+#pragma omp parallel num_threads(nth) private(pt,ps,rap)
+  {
+#ifdef _OPENMP
+    ps = &st[omp_get_thread_num()];
+#else
+    ps = st;
+#endif
+#pragma omp for schedule(static)
+    for (k=1; k<=mesh->ne; k++) {
+      pt = &mesh->tetra[k];
+      if( !MG_EOK(pt) ) {
+        ps->nex++;
+        continue;
+      }
 
-  for (k=0; k<5; k++)  his[k] = 0;
+      pt->qual = _MMG5_orcal(mesh,met,k);
+      if ( mesh->info.imprim <= 0 )  continue;
 
-  nex = ok = 0;
-  for (k=1; k<=mesh->ne; k++) {
-    pt = &mesh->tetra[k];
-    if( !MG_EOK(pt) ) {
-      nex++;
-      continue;
-    }
-    ok++;
-    if ( (!mmgWarn0) && (_MMG5_orvol(mesh->point,pt->v) < 0.0) ) {
-      mmgWarn0 = 1;
-      fprintf(stderr,"  ## Warning: %s: at least 1 negative volume.\n",__func__);
-    }
-    rap = 1 - _MMG3D_ALPHAD * pt->qual;
-    if ( rap > rapmin ) {
-      rapmin = rap;
-      iel    = ok;
+      ps->ok++;
+      if ( (!warn) && (!ps->neg) && (_MMG5_orvol(mesh->point,pt->v) < 0.0) )
+        ps->neg = 1;
+
+      rap = 1 - _MMG3D_ALPHAD * pt->qual;
+      if ( rap > ps->rapmin ) {
+        ps->rapmin = rap;
+        ps->iel    = ps->ok;
+      }
+      if ( rap < 0.9 )  ps->med++;
+      if ( rap < 0.6 ) ps->good++;
+      // if ( rap < _MMG3D_BADKAL )  mesh->info.badkal = 1;
+      ps->rapavg += rap;
+      ps->rapmax  = MG_MIN(ps->rapmax,rap);
+      if(rap < 0.6)
+        ps->his[0] += 1;
+      else if(rap < 0.9)
+        ps->his[1] += 1;
+      else if(rap < 0.93)
+        ps->his[2] += 1;
+      else if(rap < 0.99)
+        ps->his[3] += 1;
+      else
+        ps->his[4] += 1;
     }
-    if ( rap < 0.9 )  med++;
-    if ( rap < 0.6 ) good++;
-    // if ( rap < _MMG3D_BADKAL )  mesh->info.badkal = 1;
-    rapavg += rap;
-    rapmax  = MG_MIN(rapmax,rap);
-    if(rap < 0.6)
-      his[0] += 1;
-    else if(rap < 0.9)
-      his[1] += 1;
-    else if(rap < 0.93)
-      his[2] += 1;
-    else if(rap < 0.99)
-      his[3] += 1;
-    else
-      his[4] += 1;
+  }
+  if ( mesh->info.imprim <= 0 ) {
+    _MMG5_SAFE_FREE(st);
+    return 1;
+  }
 
+  _MMG5_mergeQuaStat(st,nth,1);
+  if ( st[0].neg ) {
+    mmgWarn0 = 1;
+    fprintf(stderr,"  ## Warning: %s: at least 1 negative volume.\n",__func__);
   }
+  rapmin = st[0].rapmin;
+  rapmax = st[0].rapmax;
+  rapavg = st[0].rapavg;
+  med    = st[0].med;
+  good   = st[0].good;
+  iel    = st[0].iel;
+  nex    = st[0].nex;
+  his    = st[0].his;
 
   fprintf(stdout,"\n  -- MESH QUALITY");
   fprintf(stdout," (LES)");
-  fprintf(stdout,"  %d\n",mesh->ne - nex);
+  fprintf(stdout,"  %" MMG5_PRId "\n",mesh->ne - nex);
 
 #ifndef DEBUG
-  fprintf(stdout,"     BEST   %8.6f  AVRG.   %8.6f  WRST.   %8.6f (%d)\n",
+  fprintf(stdout,"     BEST   %8.6f  AVRG.   %8.6f  WRST.   %8.6f (%" MMG5_PRId ")\n",
           rapmax,rapavg / (mesh->ne-nex),rapmin,iel);
 #else
   fprintf(stdout,"     BEST   %e  AVRG.   %e  WRST.   %e (%d)\n => %d %d %d %d\n",
@@ -377,22 +887,45 @@ static int _MMG3D_printquaLES(MMG5_pMesh mesh,MMG5_pSol met) {
   fprintf(stdout,"  %6.2f %% < 0.6\n",100.0*(good/(float)(mesh->ne-nex)));
   if ( abs(mesh->info.imprim) > 3 ) {
     fprintf(stdout,"                  %6.2f %% < 0.9\n",100.0*( med/(float)(mesh->ne-nex)));
-    fprintf(stdout,"     %5.2f < Q < %5.2f   %7d   %6.2f %%\n",
+    fprintf(stdout,"     %5.2f < Q < %5.2f   %7" MMG5_PRId "   %6.2f %%\n",
             0.0,0.6,his[0],100.*(his[0]/(float)(mesh->ne-nex)));
-    fprintf(stdout,"     %5.2f < Q < %5.2f   %7d   %6.2f %%\n",
+    fprintf(stdout,"     %5.2f < Q < %5.2f   %7" MMG5_PRId "   %6.2f %%\n",
             0.6,0.9,his[1],100.*(his[1]/(float)(mesh->ne-nex)));
-    fprintf(stdout,"     %5.2f < Q < %5.2f   %7d   %6.2f %%\n",
+    fprintf(stdout,"     %5.2f < Q < %5.2f   %7" MMG5_PRId "   %6.2f %%\n",
             0.9,0.93,his[2],100.*(his[2]/(float)(mesh->ne-nex)));
-    fprintf(stdout,"     %5.2f < Q < %5.2f   %7d   %6.2f %%\n",
+    fprintf(stdout,"     %5.2f < Q < %5.2f   %7" MMG5_PRId "   %6.2f %%\n",
             0.93,0.99,his[3],100.*(his[3]/(float)(mesh->ne-nex)));
-    fprintf(stdout,"     %5.2f < Q           %7d   %6.2f %%\n",
+    fprintf(stdout,"     %5.2f < Q           %7" MMG5_PRId "   %6.2f %%\n",
             0.99,his[4],100.*(his[4]/(float)(mesh->ne-nex)));
   }
 
+  _MMG5_SAFE_FREE(st);
   return(1);
 }
 
+/**
+ * \param st pointer toward the statistics of the current range of tetra.
+ * \param rap normalized quality of the last counted tetra.
+ *
+ * Add the quality of the last counted tetra to the statistics.
+ *
+ */
+static inline
+void _MMG3D_quaStatAdd(_MMG5_quaStat *st,double rap) {
+  int ir;
 
+  if ( rap < st->rapmin ) {
+    st->rapmin = rap;
+    st->iel    = st->ok;
+  }
+  if ( rap > 0.5 )  st->med++;
+  if ( rap > 0.12 ) st->good++;
+  if ( rap < _MMG3D_BADKAL )  st->badkal = 1;
+  st->rapavg += rap;
+  st->rapmax  = MG_MAX(st->rapmax,rap);
+  ir = MG_MIN(4,(int)(5.0*rap));
+  st->his[ir] += 1;
+}
 
 /**
  * \param mesh pointer toward the mesh structure.
@@ -403,68 +936,99 @@ static int _MMG3D_printquaLES(MMG5_pMesh mesh,MMG5_pSol met) {
  *
  */
 int _MMG3D_inqua(MMG5_pMesh mesh,MMG5_pSol met) {
-  MMG5_pTetra pt;
-  double      rap,rapmin,rapmax,rapavg,med,good;
-  int         i,k,iel,ok,ir,imax,nex,his[5];
-  static char mmgWarn0 = 0;
+  MMG5_pTetra    pt;
+  _MMG5_quaStat  *st,*ps;
+  double         rapmin,rapmax,rapavg,med,good,*coor,qual[_MMG3D_NBATCH];
+  int            i,imax,nth,ier;
+  MMG5_int       iel,nex,*his,k0,k,n;
+  char           warn;
+  static _MMG5_TLS char mmgWarn0 = 0;
 
   if( mesh->info.optimLES ) return(_MMG3D_printquaLES(mesh,met));
 
-  /*compute tet quality*/
-  for (k=1; k<=mesh->ne; k++) {
-    pt = &mesh->tetra[k];
-     if( !MG_EOK(pt) )   continue;
+#ifdef _OPENMP
+  nth = MG_MAX(1,mesh->info.nthreads);
+#else
+  nth = 1;
+#endif
 
-     if ( met->m ) {
-       if ( met->size == 6) {
-         pt->qual = _MMG5_caltet33_ani(mesh,met,pt);
-       }
-       else
-         pt->qual = _MMG5_orcal(mesh,met,k);
-     }
-     else // -A option
-       pt->qual = _MMG5_caltet_iso(mesh,met,pt);
-  }
-  if ( mesh->info.imprim <= 0 ) return 1;
+  _MMG5_SAFE_CALLOC(st,nth,_MMG5_quaStat,0);
+  _MMG5_initQuaStat(st,nth,2.0,0.0);
+  warn = mmgWarn0;
 
-  rapmin  = 2.0;
-  rapmax  = 0.0;
-  rapavg  = med = good = 0.0;
-  iel     = 0;
+  /* isotropic quality: use the packed coordinates */
+  coor = NULL;
+  if ( !met->m || met->size == 1 )
+    coor = _MMG3D_packCoor(mesh);
 
-  for (k=0; k<5; k++)  his[k] = 0;
+  /*compute tet quality and its statistics*/
+#pragma omp parallel num_threads(nth) private(pt,ps,k,n,qual)
+  {
+#ifdef _OPENMP
+    ps = &st[omp_get_thread_num()];
+#else
+    ps = st;
+#endif
+#pragma omp for schedule(static)
+    for (k0=1; k0<=mesh->ne; k0+=_MMG3D_NBATCH) {
+      n = MG_MIN(_MMG3D_NBATCH,mesh->ne-k0+1);
+      if ( coor )
+        _MMG3D_caltetBatch_iso(coor,&mesh->tetra[k0],n,qual);
+
+      for (k=k0; k<k0+n; k++) {
+        pt = &mesh->tetra[k];
+        if( !MG_EOK(pt) ) {
+          ps->nex++;
+          continue;
+        }
 
-  nex = ok = 0;
-  for (k=1; k<=mesh->ne; k++) {
-    pt = &mesh->tetra[k];
-    if( !MG_EOK(pt) ) {
-      nex++;
-      continue;
-    }
-    ok++;
-    if ( (!mmgWarn0) && (_MMG5_orvol(mesh->point,pt->v) < 0.0) ) {
-      mmgWarn0 = 1;
-      fprintf(stderr,"  ## Warning: %s: at least 1 negative volume\n",__func__);
-    }
-    rap = _MMG3D_ALPHAD * pt->qual;
-    if ( rap < rapmin ) {
-      rapmin = rap;
-      iel    = ok;
+        if ( coor )
+          pt->qual = qual[k-k0];
+        else if ( met->m ) {
+          if ( met->size == 6) {
+            pt->qual = _MMG5_caltet33_ani(mesh,met,pt);
+          }
+          else
+            pt->qual = _MMG5_orcal(mesh,met,k);
+        }
+        else // -A option
+          pt->qual = _MMG5_caltet_iso(mesh,met,pt);
+
+        if ( mesh->info.imprim <= 0 )  continue;
+
+        ps->ok++;
+        if ( (!warn) && (!ps->neg) && (_MMG5_orvol(mesh->point,pt->v) < 0.0) )
+          ps->neg = 1;
+        _MMG3D_quaStatAdd(ps,_MMG3D_ALPHAD * pt->qual);
+      }
     }
-    if ( rap > 0.5 )  med++;
-    if ( rap > 0.12 ) good++;
-    if ( rap < _MMG3D_BADKAL )  mesh->info.badkal = 1;
-    rapavg += rap;
-    rapmax  = MG_MAX(rapmax,rap);
-    ir = MG_MIN(4,(int)(5.0*rap));
-    his[ir] += 1;
   }
+  if ( coor )  _MMG3D_freeCoor(mesh,&coor);
+  if ( mesh->info.imprim <= 0 ) {
+    _MMG5_SAFE_FREE(st);
+    return 1;
+  }
+
+  _MMG5_mergeQuaStat(st,nth,0);
+  if ( st[0].neg ) {
+    mmgWarn0 = 1;
+    fprintf(stderr,"  ## Warning: %s: at least 1 negative volume\n",__func__);
+  }
+  if ( st[0].badkal )  mesh->info.badkal = 1;
+  rapmin = st[0].rapmin;
+  rapmax = st[0].rapmax;
+  rapavg = st[0].rapavg;
+  med    = st[0].med;
+  good   = st[0].good;
+  iel    = st[0].iel;
+  nex    = st[0].nex;
+  his    = st[0].his;
 
   fprintf(stdout,"\n  -- MESH QUALITY");
-  fprintf(stdout,"  %d\n",mesh->ne - nex);
+  fprintf(stdout,"  %" MMG5_PRId "\n",mesh->ne - nex);
 
 #ifndef DEBUG
-  fprintf(stdout,"     BEST   %8.6f  AVRG.   %8.6f  WRST.   %8.6f (%d)\n",
+  fprintf(stdout,"     BEST   %8.6f  AVRG.   %8.6f  WRST.   %8.6f (%" MMG5_PRId ")\n",
           rapmax,rapavg / (mesh->ne-nex),rapmin,iel);
 #else
   fprintf(stdout,"     BEST   %e  AVRG.   %e  WRST.   %e (%d)\n => %d %d %d %d\n",
@@ -481,13 +1045,15 @@ int _MMG3D_inqua(MMG5_pMesh mesh,MMG5_pSol met) {
       fprintf(stdout,"                  %6.2f %% >  0.5\n",100.0*( med/(float)(mesh->ne-nex)));
       imax = MG_MIN(4,(int)(5.*rapmax));
       for (i=imax; i>=(int)(5*rapmin); i--) {
-        fprintf(stdout,"     %5.1f < Q < %5.1f   %7d   %6.2f %%\n",
+        fprintf(stdout,"     %5.1f < Q < %5.1f   %7" MMG5_PRId "   %6.2f %%\n",
                 i/5.,i/5.+0.2,his[i],100.*(his[i]/(float)(mesh->ne-nex)));
       }
     }
   }
 
-  return ( _MMG5_minQualCheck(iel,rapmin,_MMG3D_ALPHAD) );
+  ier = _MMG5_minQualCheck(iel,rapmin,_MMG3D_ALPHAD);
+  _MMG5_SAFE_FREE(st);
+  return(ier);
 }
 
 /**
@@ -500,72 +1066,101 @@ int _MMG3D_inqua(MMG5_pMesh mesh,MMG5_pSol met) {
  *
  */
 int _MMG3D_outqua(MMG5_pMesh mesh,MMG5_pSol met) {
-  MMG5_pTetra pt;
-  MMG5_pPoint ppt;
-  double      rap,rapmin,rapmax,rapavg,med,good;
-  int         i,k,iel,ok,ir,imax,nex,his[5],n,nrid;
-  static char mmgWarn0 = 0;
+  MMG5_pTetra    pt;
+  MMG5_pPoint    ppt;
+  _MMG5_quaStat  *st,*ps;
+  double         rapmin,rapmax,rapavg,med,good,*coor,qual[_MMG3D_NBATCH];
+  int            i,imax,n,nth,ier;
+  MMG5_int       iel,nex,nrid,*his,k0,k,nb;
+  char           warn;
+  static _MMG5_TLS char mmgWarn0 = 0;
 
   if( mesh->info.optimLES ) return(_MMG3D_printquaLES(mesh,met));
 
-  /*compute tet quality*/
-  for (k=1; k<=mesh->ne; k++) {
-    pt = &mesh->tetra[k];
-    if( !MG_EOK(pt) )   continue;
-    pt->qual = _MMG5_orcal(mesh,met,k);
-  }
-
-  if ( mesh->info.imprim <= 0 ) return 1;
+#ifdef _OPENMP
+  nth = MG_MAX(1,mesh->info.nthreads);
+#else
+  nth = 1;
+#endif
 
-  rapmin  = 2.0;
-  rapmax  = 0.0;
-  rapavg  = med = good = 0.0;
-  iel     = 0;
+  _MMG5_SAFE_CALLOC(st,nth,_MMG5_quaStat,0);
+  _MMG5_initQuaStat(st,nth,2.0,0.0);
+  warn = mmgWarn0;
 
-  for (k=0; k<5; k++)  his[k] = 0;
+  /* isotropic quality: use the packed coordinates */
+  coor = NULL;
+  if ( met->size == 1 )
+    coor = _MMG3D_packCoor(mesh);
 
-  nex = ok = nrid = 0;
-  for (k=1; k<=mesh->ne; k++) {
-    pt = &mesh->tetra[k];
-    if( !MG_EOK(pt) ) {
-      nex++;
-      continue;
-    }
-    ok++;
-    if ( (!mmgWarn0) && (_MMG5_orvol(mesh->point,pt->v) < 0.0) ) {
-      mmgWarn0 = 1;
-      fprintf(stderr,"  ## Warning: %s: at least 1 negative volume.\n",
-              __func__);
-    }
-    n = 0;
-    for(i=0 ; i<4 ; i++) {
-      ppt = &mesh->point[pt->v[i]];
-      if(!(MG_SIN(ppt->tag) || MG_NOM & ppt->tag) && (ppt->tag & MG_GEO)) continue;
-      n++;
-    }
-    if(!n) {
-      nrid++;
-      continue;
-    }
-    rap = _MMG3D_ALPHAD * pt->qual;
-    if ( rap < rapmin ) {
-      rapmin = rap;
-      iel    = ok;
+  /*compute tet quality and its statistics*/
+#pragma omp parallel num_threads(nth) private(pt,ppt,ps,i,k,n,nb,qual)
+  {
+#ifdef _OPENMP
+    ps = &st[omp_get_thread_num()];
+#else
+    ps = st;
+#endif
+#pragma omp for schedule(static)
+    for (k0=1; k0<=mesh->ne; k0+=_MMG3D_NBATCH) {
+      nb = MG_MIN(_MMG3D_NBATCH,mesh->ne-k0+1);
+      if ( coor )
+        _MMG3D_caltetBatch_iso(coor,&mesh->tetra[k0],nb,qual);
+
+      for (k=k0; k<k0+nb; k++) {
+        pt = &mesh->tetra[k];
+        if( !MG_EOK(pt) ) {
+          ps->nex++;
+          continue;
+        }
+        pt->qual = coor ? qual[k-k0] : _MMG5_orcal(mesh,met,k);
+
+        if ( mesh->info.imprim <= 0 )  continue;
+
+        ps->ok++;
+        if ( (!warn) && (!ps->neg) && (_MMG5_orvol(mesh->point,pt->v) < 0.0) )
+          ps->neg = 1;
+        n = 0;
+        for(i=0 ; i<4 ; i++) {
+          ppt = &mesh->point[pt->v[i]];
+          if(!(MG_SIN(ppt->tag) || MG_NOM & ppt->tag) && (ppt->tag & MG_GEO)) continue;
+          n++;
+        }
+        if(!n) {
+          ps->nrid++;
+          continue;
+        }
+        _MMG3D_quaStatAdd(ps,_MMG3D_ALPHAD * pt->qual);
+      }
     }
-    if ( rap > 0.5 )  med++;
-    if ( rap > 0.12 ) good++;
-    if ( rap < _MMG3D_BADKAL )  mesh->info.badkal = 1;
-    rapavg += rap;
-    rapmax  = MG_MAX(rapmax,rap);
-    ir = MG_MIN(4,(int)(5.0*rap));
-    his[ir] += 1;
   }
+  if ( coor )  _MMG3D_freeCoor(mesh,&coor);
+  if ( mesh->info.imprim <= 0 ) {
+    _MMG5_SAFE_FREE(st);
+    return 1;
+  }
+
+  _MMG5_mergeQuaStat(st,nth,0);
+  if ( st[0].neg ) {
+    mmgWarn0 = 1;
+    fprintf(stderr,"  ## Warning: %s: at least 1 negative volume.\n",
+            __func__);
+  }
+  if ( st[0].badkal )  mesh->info.badkal = 1;
+  rapmin = st[0].rapmin;
+  rapmax = st[0].rapmax;
+  rapavg = st[0].rapavg;
+  med    = st[0].med;
+  good   = st[0].good;
+  iel    = st[0].iel;
+  nex    = st[0].nex;
+  nrid   = st[0].nrid;
+  his    = st[0].his;
 
   fprintf(stdout,"\n  -- MESH QUALITY");
-  fprintf(stdout,"  %d\n",mesh->ne - nex);
+  fprintf(stdout,"  %" MMG5_PRId "\n",mesh->ne - nex);
 
 #ifndef DEBUG
-  fprintf(stdout,"     BEST   %8.6f  AVRG.   %8.6f  WRST.   %8.6f (%d)\n",
+  fprintf(stdout,"     BEST   %8.6f  AVRG.   %8.6f  WRST.   %8.6f (%" MMG5_PRId ")\n",
           rapmax,rapavg / (mesh->ne-nex),rapmin,iel);
 #else
   fprintf(stdout,"     BEST   %e  AVRG.   %e  WRST.   %e (%d)\n => %d %d %d %d\n",
@@ -583,14 +1178,71 @@ int _MMG3D_outqua(MMG5_pMesh mesh,MMG5_pSol met) {
       fprintf(stdout,"                  %6.2f %% >  0.5\n",100.0*( med/(float)(mesh->ne-nex)));
       imax = MG_MIN(4,(int)(5.*rapmax));
       for (i=imax; i>=(int)(5*rapmin); i--) {
-        fprintf(stdout,"     %5.1f < Q < %5.1f   %7d   %6.2f %%\n",
+        fprintf(stdout,"     %5.1f < Q < %5.1f   %7" MMG5_PRId "   %6.2f %%\n",
                 i/5.,i/5.+0.2,his[i],100.*(his[i]/(float)(mesh->ne-nex)));
       }
-      if ( met->size==6 && nrid ) fprintf(stdout,"\n  ## WARNING: %d TETRA WITH 4 RIDGES POINTS\n",nrid);
+      if ( met->size==6 && nrid ) fprintf(stdout,"\n  ## WARNING: %" MMG5_PRId " TETRA WITH 4 RIDGES POINTS\n",nrid);
+    }
+  }
+
+  ier = _MMG5_minQualCheck(iel,rapmin,_MMG3D_ALPHAD);
+  _MMG5_SAFE_FREE(st);
+  return(ier);
+}
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param met pointer toward the metric structure.
+ * \param npest estimated number of points of the adapted mesh.
+ * \param neest estimated number of tetra of the adapted mesh.
+ *
+ * Estimate the size of the mesh adapted to the metric \a met from the volume
+ * of the mesh in the metric (much cheaper than \ref _MMG5_countelt). The
+ * metric is averaged over each tetra.
+ *
+ */
+void _MMG3D_estimSize(MMG5_pMesh mesh,MMG5_pSol met,
+                      long long *npest,long long *neest) {
+  MMG5_pTetra  pt;
+  double       vol,volm,h,mm[6],det;
+  MMG5_int     k;
+#ifdef _OPENMP
+  int          nth;
+#endif
+
+#ifdef _OPENMP
+  nth = MG_MAX(1,mesh->info.nthreads);
+#endif
+
+  volm = 0.0;
+#pragma omp parallel for num_threads(nth) private(pt,vol,h,mm,det) reduction(+:volm)
+  for (k=1; k<=mesh->ne; k++) {
+    pt = &mesh->tetra[k];
+    if ( !MG_EOK(pt) )  continue;
+
+    vol = _MMG5_orvol(mesh->point,pt->v) / 6.0;
+    if ( vol <= 0.0 )  continue;
+
+    if ( met->size == 1 ) {
+      h = 0.25 * (met->m[pt->v[0]] + met->m[pt->v[1]]
+                  + met->m[pt->v[2]] + met->m[pt->v[3]]);
+      if ( h < _MMG5_EPSD )  continue;
+      volm += vol / (h*h*h);
+    }
+    else {
+      if ( !_MMG5_moymet(mesh,met,pt,mm) )  continue;
+      det = mm[0] * ( mm[3]*mm[5] - mm[4]*mm[4])
+        - mm[1] * ( mm[1]*mm[5] - mm[2]*mm[4])
+        + mm[2] * ( mm[1]*mm[4] - mm[2]*mm[3]);
+      if ( det <= 0.0 )  continue;
+      volm += vol * sqrt(det);
     }
   }
 
-  return ( _MMG5_minQualCheck(iel,rapmin,_MMG3D_ALPHAD) );
+  /* number of regular tetra with unit edges in the metric volume, corrected
+   * by the observed density of the adapted meshes */
+  *neest = (long long)(_MMG3D_NEUNIT * volm * 6.0 * sqrt(2.0));
+  *npest = (long long)(*neest / _MMG3D_NERATIO);
 }
 
 /**
@@ -610,7 +1262,8 @@ int _MMG5_countelt(MMG5_pMesh mesh,MMG5_pSol sol, double *weightelt, long *npcib
   int      isbdry;
   double   dned,dnface,dnint/*,dnins*/,w,lenavg,lent[6];
   double   dnpdel,dnadd,leninv,dnaddloc,dnpdelloc;
-  int      list[MMG3D_LMAX],ddebug=0,ib,nv;
+  MMG5_int list[MMG3D_LMAX];
+  int      ddebug=0,ib,nv;
   long     nptot;
   //FILE *inm;
 
@@ -640,7 +1293,7 @@ int _MMG5_countelt(MMG5_pMesh mesh,MMG5_pSol sol, double *weightelt, long *npcib
     for(ib=0 ; ib<6 ; ib++) {
       ipa = _MMG5_iare[ib][0];
       ipb = _MMG5_iare[ib][1];
-      lent[ib] = _MMG5_lenedg(mesh,sol,ib,pt);
+      lent[ib] = mesh->func.lenedg(mesh,sol,ib,pt);
       if ( lent[ib]==0 ) nv--;
       lenavg+=lent[ib];
     }
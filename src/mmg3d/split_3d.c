@@ -35,7 +35,6 @@
 
 #include "inlined_functions_3d.h"
 
-extern char  ddb;
 
 /**
  * \param mesh pointer toward the mesh structure.
@@ -47,7 +46,7 @@ extern char  ddb;
  * Simulate the splitting of 1 edge of element
  *
  */
-int _MMG3D_split1_sim(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6]) {
+int _MMG3D_split1_sim(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int vx[6]) {
   MMG5_pTetra         pt,pt0;
   double              vold,vnew;
   unsigned char       tau[4];
@@ -113,11 +112,11 @@ int _MMG3D_split1_sim(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6]) {
  * Split 1 edge of tetra \a k.
  *
  */
-int _MMG5_split1(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6],char metRidTyp) {
+int _MMG5_split1(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int vx[6],char metRidTyp) {
   MMG5_pTetra         pt,pt1;
   MMG5_xTetra         xt,xt1;
   MMG5_pxTetra        pxt0;
-  int                 iel;
+  MMG5_int            iel;
   char                i,isxt,isxt1;
   unsigned char       tau[4];
   const unsigned char *taued;
@@ -261,8 +260,8 @@ nextstep1:
  *
  */
 static inline
-int _MMG3D_normalDeviation(MMG5_pMesh mesh , int  start, char   iface, char ia,
-                           int        idx  , int  ip   , double n0[3])
+int _MMG3D_normalDeviation(MMG5_pMesh mesh , MMG5_int  start, char   iface, char ia,
+                           int        idx  , MMG5_int  ip   , double n0[3])
 {
   MMG5_Tria tt0;
   double    n1[3];
@@ -313,14 +312,14 @@ int _MMG3D_normalDeviation(MMG5_pMesh mesh , int  start, char   iface, char ia,
  * position o and tag \a tag, to be inserted at an edge, whose shell is passed.
  *
  */
-int _MMG3D_simbulgept(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ret,int ip) {
+int _MMG3D_simbulgept(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int *list,int ret,MMG5_int ip) {
   MMG5_pTetra    pt,pt0;
   MMG5_pxTetra   pxt;
   MMG5_pPoint    ppt0;
   double         calold,calnew,caltmp;
   double         n0[6],n1[6];
-  int            j,k,iel,ilist,idx,iface,ier,sum1,sum2,mins1,mins2,maxs1,maxs2;
-  int            is0,is1,is2;
+  int            j,k,ilist,idx,iface,ier;
+  MMG5_int       is0,is1,is2,sum1,sum2,iel,mins1,mins2,maxs1,maxs2;
   char           ie,ia,ib,complete,wrongOri;
 
   ilist = ret / 2;
@@ -449,11 +448,12 @@ int _MMG3D_simbulgept(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ret,int ip) {
  * tetra \a start through the edge \a ia (in local numbering of the face).
  *
  */
-int _MMG3D_normalAdjaTri(MMG5_pMesh mesh , int start, char iface, int ia,
+int _MMG3D_normalAdjaTri(MMG5_pMesh mesh , MMG5_int start, char iface, MMG5_int ia,
                          double n[3]                                     )
 {
   MMG5_Tria tt;
-  int       iedgeOpp,list[MMG3D_LMAX+2],it1,it2,it;
+  int       iedgeOpp;
+  MMG5_int  list[MMG3D_LMAX+2],it1,it2,it;
 
   iedgeOpp = _MMG5_iarf[iface][ia];
 
@@ -498,14 +498,15 @@ int _MMG3D_normalAdjaTri(MMG5_pMesh mesh , int start, char iface, int ia,
  * sense).
  *
  */
-int _MMG5_split1b(MMG5_pMesh mesh, MMG5_pSol met,int *list, int ret, int ip,
+int _MMG5_split1b(MMG5_pMesh mesh, MMG5_pSol met,MMG5_int *list, int ret, MMG5_int ip,
                   int cas,char metRidTyp,char chkRidTet){
   MMG5_pTetra          pt,pt1,pt0;
   MMG5_xTetra          xt,xt1;
   MMG5_pxTetra         pxt0;
   double               lmin,lmax,len;
-  int                  ilist,k,open,iel,jel,*newtet,nump,*adja,j;
-  int                 *adjan,nei2,nei3,mel;
+  int                  ilist,k,open,j;
+  MMG5_int             nump,jel,*newtet,*adja,iel;
+  MMG5_int            *adjan,nei2,nei3,mel;
   char                 ie,tau[4],isxt,isxt1,i,voy;
   const unsigned char *taued;
 
@@ -522,7 +523,7 @@ int _MMG5_split1b(MMG5_pMesh mesh, MMG5_pSol met,int *list, int ret, int ip,
         if ( (!metRidTyp) && met->m && met->size>1 )
           len = _MMG5_lenedg33_ani(mesh,met,i,pt);
         else
-          len  = _MMG5_lenedg(mesh,met,i,pt);
+          len  = mesh->func.lenedg(mesh,met,i,pt);
         if ( len < lmin) {
           lmin = len;
         }
@@ -579,7 +580,7 @@ int _MMG5_split1b(MMG5_pMesh mesh, MMG5_pSol met,int *list, int ret, int ip,
       if ( (!metRidTyp) && met->m && met->size>1 )
         len = _MMG5_lenedgspl33_ani(mesh,met,taued[5],pt0);
       else
-        len = _MMG5_lenedgspl(mesh,met,taued[5],pt0);
+        len = mesh->func.lenedgspl(mesh,met,taued[5],pt0);
       if ( len < lmin )  break;
       memcpy(pt0,pt,sizeof(MMG5_Tetra));
 
@@ -593,13 +594,13 @@ int _MMG5_split1b(MMG5_pMesh mesh, MMG5_pSol met,int *list, int ret, int ip,
       if ( (!metRidTyp) && met->m && met->size>1 )
         len = _MMG5_lenedgspl33_ani(mesh,met,taued[5],pt0);
       else
-        len = _MMG5_lenedgspl(mesh,met,taued[5],pt0);
+        len = mesh->func.lenedgspl(mesh,met,taued[5],pt0);
       if ( len < lmin )  break;
     }
     if ( j < ilist )  return(0);
   }
 
-  _MMG5_SAFE_CALLOC(newtet,ilist,int,-1);
+  _MMG5_SAFE_CALLOC(newtet,ilist,MMG5_int,-1);
 
   iel = list[0] / 6;
   ie  = list[0] % 6;
@@ -640,13 +641,14 @@ int _MMG5_split1b(MMG5_pMesh mesh, MMG5_pSol met,int *list, int ret, int ip,
                           _MMG5_INCREASE_MEM_MESSAGE();
                           k--;
                           for ( ; k>=0 ; --k ) {
-                            if ( !_MMG3D_delElt(mesh,abs(newtet[k])) ) return -1;
+                            if ( !_MMG3D_delElt(mesh,MMG5_abs(newtet[k])) ) return -1;
                           }
                           return(-1),-1);
       pt  = &mesh->tetra[iel];
     }
     pt1 = &mesh->tetra[jel];
     memcpy(pt1,pt,sizeof(MMG5_Tetra));
+    _MMG3D_unsetCache(mesh,iel);
 
     if ( pt->v[tau[0]] == nump )
       newtet[k] = jel;
@@ -660,7 +662,7 @@ int _MMG5_split1b(MMG5_pMesh mesh, MMG5_pSol met,int *list, int ret, int ip,
     iel = list[0] / 6;
     ie  = list[0] % 6;
     pt = &mesh->tetra[iel];
-    jel = abs(newtet[0]);
+    jel = MMG5_abs(newtet[0]);
     pt1 = &mesh->tetra[jel];
 
     pxt0 = 0;
@@ -796,7 +798,7 @@ int _MMG5_split1b(MMG5_pMesh mesh, MMG5_pSol met,int *list, int ret, int ip,
     iel = list[k] / 6;
     ie  = list[k] % 6;
     pt = &mesh->tetra[iel];
-    jel = abs(newtet[k]);
+    jel = MMG5_abs(newtet[k]);
     pt1 = &mesh->tetra[jel];
 
     pxt0 = 0;
@@ -903,10 +905,10 @@ int _MMG5_split1b(MMG5_pMesh mesh, MMG5_pSol met,int *list, int ret, int ip,
       if ( (list[1] / 6) == (nei2 / 4) ) {
         if ( MG_SMSGN(newtet[0],newtet[1]) ) {  //new elt of list[0] goes with new elt of list[1]
           adja[tau[2]] = nei2;
-          adjan[tau[2]] = 4*abs(newtet[1])+(nei2 %4);
+          adjan[tau[2]] = 4*MMG5_abs(newtet[1])+(nei2 %4);
         }
         else {
-          adja[tau[2]] = 4*abs(newtet[1])+(nei2 %4);
+          adja[tau[2]] = 4*MMG5_abs(newtet[1])+(nei2 %4);
           adjan[tau[2]] = nei2;
         }
 
@@ -919,10 +921,10 @@ int _MMG5_split1b(MMG5_pMesh mesh, MMG5_pSol met,int *list, int ret, int ip,
           assert((list[ilist-1] / 6) == (nei3 / 4));
           if ( MG_SMSGN(newtet[0],newtet[ilist-1]) ) {
             adja[tau[3]] = nei3;
-            adjan[tau[3]] = 4*abs(newtet[ilist-1])+(nei3 %4);
+            adjan[tau[3]] = 4*MMG5_abs(newtet[ilist-1])+(nei3 %4);
           }
           else {
-            adja[tau[3]] = 4*abs(newtet[ilist-1])+(nei3 %4);
+            adja[tau[3]] = 4*MMG5_abs(newtet[ilist-1])+(nei3 %4);
             adjan[tau[3]] = nei3;
           }
         }
@@ -932,10 +934,10 @@ int _MMG5_split1b(MMG5_pMesh mesh, MMG5_pSol met,int *list, int ret, int ip,
         assert((list[1] / 6) == (nei3 / 4));
         if ( MG_SMSGN(newtet[0],newtet[1]) ) {
           adja[tau[3]] = nei3;
-          adjan[tau[3]] = 4*abs(newtet[1])+(nei3 %4);
+          adjan[tau[3]] = 4*MMG5_abs(newtet[1])+(nei3 %4);
         }
         else {
-          adja[tau[3]] = 4*abs(newtet[1])+(nei3 %4);
+          adja[tau[3]] = 4*MMG5_abs(newtet[1])+(nei3 %4);
           adjan[tau[3]] = nei3;
         }
 
@@ -948,10 +950,10 @@ int _MMG5_split1b(MMG5_pMesh mesh, MMG5_pSol met,int *list, int ret, int ip,
           assert((list[ilist-1]) / 6 == (nei2 / 4));
           if ( MG_SMSGN(newtet[0],newtet[ilist-1]) ) {
             adja[tau[2]] = nei2;
-            adjan[tau[2]] = 4*abs(newtet[ilist-1])+(nei2 %4);
+            adjan[tau[2]] = 4*MMG5_abs(newtet[ilist-1])+(nei2 %4);
           }
           else {
-            adja[tau[2]] = 4*abs(newtet[ilist-1])+(nei2 %4);
+            adja[tau[2]] = 4*MMG5_abs(newtet[ilist-1])+(nei2 %4);
             adjan[tau[2]] = nei2;
           }
         }
@@ -962,10 +964,10 @@ int _MMG5_split1b(MMG5_pMesh mesh, MMG5_pSol met,int *list, int ret, int ip,
       if ( (list[ilist-2] / 6) == (nei2 / 4) ) {
         if ( MG_SMSGN(newtet[ilist-1],newtet[ilist-2]) ) {
           adja[tau[2]] = nei2;
-          adjan[tau[2]] = 4*abs(newtet[ilist-2])+(nei2 %4);
+          adjan[tau[2]] = 4*MMG5_abs(newtet[ilist-2])+(nei2 %4);
         }
         else {
-          adja[tau[2]] = 4*abs(newtet[ilist-2])+(nei2 %4);
+          adja[tau[2]] = 4*MMG5_abs(newtet[ilist-2])+(nei2 %4);
           adjan[tau[2]] = nei2;
         }
 
@@ -978,10 +980,10 @@ int _MMG5_split1b(MMG5_pMesh mesh, MMG5_pSol met,int *list, int ret, int ip,
           assert((list[0]) / 6 == (nei3 / 4));
           if ( MG_SMSGN(newtet[ilist-1],newtet[0]) ) {
             adja[tau[3]] = nei3;
-            adjan[tau[3]] = 4*abs(newtet[0])+(nei3 %4);
+            adjan[tau[3]] = 4*MMG5_abs(newtet[0])+(nei3 %4);
           }
           else {
-            adja[tau[3]] = 4*abs(newtet[0])+(nei3 %4);
+            adja[tau[3]] = 4*MMG5_abs(newtet[0])+(nei3 %4);
             adjan[tau[3]] = nei3;
           }
         }
@@ -991,10 +993,10 @@ int _MMG5_split1b(MMG5_pMesh mesh, MMG5_pSol met,int *list, int ret, int ip,
         assert((list[ilist-2] / 6) == (nei3 / 4));
         if ( MG_SMSGN(newtet[ilist-1],newtet[ilist-2]) ) {
           adja[tau[3]] = nei3;
-          adjan[tau[3]] = 4*abs(newtet[ilist-2])+(nei3 %4);
+          adjan[tau[3]] = 4*MMG5_abs(newtet[ilist-2])+(nei3 %4);
         }
         else {
-          adja[tau[3]] = 4*abs(newtet[ilist-2])+(nei3 %4);
+          adja[tau[3]] = 4*MMG5_abs(newtet[ilist-2])+(nei3 %4);
           adjan[tau[3]] = nei3;
         }
 
@@ -1007,10 +1009,10 @@ int _MMG5_split1b(MMG5_pMesh mesh, MMG5_pSol met,int *list, int ret, int ip,
           assert((list[0]) / 6 == (nei2 / 4));
           if ( MG_SMSGN(newtet[ilist-1],newtet[0]) ) {
             adja[tau[2]] = nei2;
-            adjan[tau[2]] = 4*abs(newtet[0])+(nei2 %4);
+            adjan[tau[2]] = 4*MMG5_abs(newtet[0])+(nei2 %4);
           }
           else {
-            adja[tau[2]] = 4*abs(newtet[0])+(nei2 %4);
+            adja[tau[2]] = 4*MMG5_abs(newtet[0])+(nei2 %4);
             adjan[tau[2]] = nei2;
           }
         }
@@ -1021,20 +1023,20 @@ int _MMG5_split1b(MMG5_pMesh mesh, MMG5_pSol met,int *list, int ret, int ip,
       if ( (list[k-1] / 6) == (nei2 / 4) ) {
         if ( MG_SMSGN(newtet[k],newtet[k-1]) ) {
           adja[tau[2]] = nei2;
-          adjan[tau[2]] = 4*abs(newtet[k-1])+(nei2 %4);
+          adjan[tau[2]] = 4*MMG5_abs(newtet[k-1])+(nei2 %4);
         }
         else {
-          adja[tau[2]] = 4*abs(newtet[k-1])+(nei2 %4);
+          adja[tau[2]] = 4*MMG5_abs(newtet[k-1])+(nei2 %4);
           adjan[tau[2]] = nei2;
         }
 
         assert((list[k+1]) / 6 == (nei3 / 4));
         if ( MG_SMSGN(newtet[k],newtet[k+1]) ) {
           adja[tau[3]] = nei3;
-          adjan[tau[3]] = 4*abs(newtet[k+1])+(nei3 %4);
+          adjan[tau[3]] = 4*MMG5_abs(newtet[k+1])+(nei3 %4);
         }
         else {
-          adja[tau[3]] = 4*abs(newtet[k+1])+(nei3 %4);
+          adja[tau[3]] = 4*MMG5_abs(newtet[k+1])+(nei3 %4);
           adjan[tau[3]] = nei3;
         }
       }
@@ -1043,20 +1045,20 @@ int _MMG5_split1b(MMG5_pMesh mesh, MMG5_pSol met,int *list, int ret, int ip,
         assert((list[k-1] / 6) == (nei3 / 4));
         if ( MG_SMSGN(newtet[k],newtet[k-1]) ) {
           adja[tau[3]] = nei3;
-          adjan[tau[3]] = 4*abs(newtet[k-1])+(nei3 %4);
+          adjan[tau[3]] = 4*MMG5_abs(newtet[k-1])+(nei3 %4);
         }
         else {
-          adja[tau[3]] = 4*abs(newtet[k-1])+(nei3 %4);
+          adja[tau[3]] = 4*MMG5_abs(newtet[k-1])+(nei3 %4);
           adjan[tau[3]] = nei3;
         }
 
         assert((list[k+1]) / 6 == (nei2 / 4));
         if ( MG_SMSGN(newtet[k],newtet[k+1]) ) {
           adja[tau[2]] = nei2;
-          adjan[tau[2]] = 4*abs(newtet[k+1])+(nei2 %4);
+          adjan[tau[2]] = 4*MMG5_abs(newtet[k+1])+(nei2 %4);
         }
         else {
-          adja[tau[2]] = 4*abs(newtet[k+1])+(nei2 %4);
+          adja[tau[2]] = 4*MMG5_abs(newtet[k+1])+(nei2 %4);
           adjan[tau[2]] = nei2;
         }
       }
@@ -1101,7 +1103,7 @@ int _MMG5_split1b(MMG5_pMesh mesh, MMG5_pSol met,int *list, int ret, int ip,
  * Simulate split of two edges that belong to a common face
  *
  */
-int _MMG3D_split2sf_sim(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6]){
+int _MMG3D_split2sf_sim(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int vx[6]){
   MMG5_pTetra         pt,pt0;
   double              vold,vnew;
   unsigned char       tau[4],imin;
@@ -1211,12 +1213,12 @@ int _MMG3D_split2sf_sim(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6]){
  * Split of two edges that belong to a common face : 1 tetra becomes 3
  *
  */
-int _MMG5_split2sf(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6],char metRidTyp){
+int _MMG5_split2sf(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int vx[6],char metRidTyp){
   MMG5_pTetra         pt[3];
   MMG5_xTetra         xt[3];
   MMG5_pxTetra        pxt0;
-  int                 iel,i;
-  int                 newtet[3];
+  int                 i;
+  MMG5_int            iel,newtet[3];
   char                flg,imin,firstxt,isxt[3];
   unsigned char       tau[4];
   const unsigned char *taued;
@@ -1443,7 +1445,7 @@ int _MMG5_split2sf(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6],char metRidTyp)
  *  Simulate split of two opposite edges.
  *
  */
-int _MMG3D_split2_sim(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6]){
+int _MMG3D_split2_sim(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int vx[6]){
   MMG5_pTetra         pt,pt0;
   double              vold,vnew;
   unsigned char       tau[4];
@@ -1505,12 +1507,12 @@ int _MMG3D_split2_sim(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6]){
  * Split of two OPPOSITE edges
  *
  */
-int _MMG5_split2(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6],char metRidTyp) {
+int _MMG5_split2(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int vx[6],char metRidTyp) {
   MMG5_pTetra         pt[4];
   MMG5_xTetra         xt[4];
   MMG5_pxTetra        pxt0;
-  int                 i,iel;
-  int                 newtet[4];
+  int                 i;
+  MMG5_int            iel,newtet[4];
   char                flg,firstxt,isxt[4];
   unsigned char       tau[4];
   const unsigned char *taued;
@@ -1708,7 +1710,7 @@ int _MMG5_split2(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6],char metRidTyp) {
 }
 
 /** Simulate split of 1 face (3 edges) */
-int _MMG3D_split3_sim(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6]) {
+int _MMG3D_split3_sim(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int vx[6]) {
   MMG5_pTetra         pt,pt0;
   double              vold,vnew;
   unsigned char       tau[4];
@@ -1779,12 +1781,12 @@ int _MMG3D_split3_sim(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6]) {
  * 1 face (3 edges) subdivided
  *
  */
-int _MMG5_split3(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6],char metRidTyp) {
+int _MMG5_split3(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int vx[6],char metRidTyp) {
   MMG5_pTetra         pt[4];
   MMG5_xTetra         xt[4];
   MMG5_pxTetra        pxt0;
-  int                 iel,i;
-  int                 newtet[4];
+  int                 i;
+  MMG5_int            iel,newtet[4];
   char                flg,firstxt,isxt[4];
   unsigned char       tau[4];
   const unsigned char *taued;
@@ -1991,7 +1993,7 @@ int _MMG5_split3(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6],char metRidTyp) {
  *  Simulate split of 3 edges in cone configuration.
  *
  */
-int _MMG3D_split3cone_sim(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6]) {
+int _MMG3D_split3cone_sim(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int vx[6]) {
   MMG5_pTetra         pt,pt0;
   double              vold,vnew;
   unsigned char       tau[4],ia,ib;
@@ -2172,12 +2174,12 @@ int _MMG3D_split3cone_sim(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6]) {
  * Split 3 edge in cone configuration
  *
  */
-int _MMG5_split3cone(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6],char metRidTyp) {
+int _MMG5_split3cone(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int vx[6],char metRidTyp) {
   MMG5_pTetra         pt[4];
   MMG5_xTetra         xt[4];
   MMG5_pxTetra        pxt0;
-  int                 iel,i;
-  int                 newtet[4];
+  int                 i;
+  MMG5_int            iel,newtet[4];
   char                flg,firstxt,isxt[4],ia,ib;
   unsigned char       tau[4];
   const unsigned char *taued;
@@ -2550,7 +2552,7 @@ int _MMG5_split3cone(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6],char metRidTy
  *
  */
 static inline
-void _MMG3D_configSplit3op(MMG5_pTetra pt,int vx[6],unsigned char tau[4],
+void _MMG3D_configSplit3op(MMG5_pTetra pt,MMG5_int vx[6],unsigned char tau[4],
                            const unsigned char **taued,
                            unsigned char sym[4],  unsigned char symed[6],
                            unsigned char *ip0,unsigned char *ip1,
@@ -2706,7 +2708,7 @@ void _MMG3D_configSplit3op(MMG5_pTetra pt,int vx[6],unsigned char tau[4],
  *  Simulate split of 3 edges in opposite configuration.
  *
  */
-int _MMG3D_split3op_sim(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6]) {
+int _MMG3D_split3op_sim(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int vx[6]) {
   MMG5_pTetra         pt,pt0;
   double              vold,vnew;
   unsigned char       tau[4],sym[4],symed[6],ip0,ip1,ip2,ip3,ie0,ie1,ie2,ie3;
@@ -2838,12 +2840,11 @@ int _MMG3D_split3op_sim(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6]) {
  * Split 3 opposite edges in a tetra
  *
  */
-int _MMG5_split3op(MMG5_pMesh mesh, MMG5_pSol met, int k, int vx[6],char metRidTyp){
+int _MMG5_split3op(MMG5_pMesh mesh, MMG5_pSol met, MMG5_int k, MMG5_int vx[6],char metRidTyp){
   MMG5_pTetra          pt[5];
   MMG5_xTetra          xt[5];
   MMG5_pxTetra         pxt0;
-  int                  iel;
-  int                  newtet[5];
+  MMG5_int             iel,newtet[5];
   unsigned char        imin12,imin03,tau[4],sym[4],symed[6],ip0,ip1,ip2,ip3,ie0,ie1;
   unsigned char        ie2,ie3,ie4,ie5,isxt[5],firstxt,i;
   const unsigned char *taued=NULL;
@@ -3288,14 +3289,14 @@ int _MMG5_split3op(MMG5_pMesh mesh, MMG5_pSol met, int k, int vx[6],char metRidT
  * NEEDED ?
  *
  */
-int _MMG5_split4bar(MMG5_pMesh mesh, MMG5_pSol met, int k,char metRidTyp) {
+MMG5_int _MMG5_split4bar(MMG5_pMesh mesh, MMG5_pSol met, MMG5_int k,char metRidTyp) {
   MMG5_pTetra   pt[4];
   MMG5_pPoint   ppt;
   MMG5_xTetra   xt[4];
   MMG5_pxTetra  pxt0;
   double        o[3],cb[4];
-  int           i,ib,iel;
-  int           newtet[4];
+  int           i;
+  MMG5_int      ib,iel,newtet[4];
   unsigned char isxt[4],firstxt;
 
   pt[0] = &mesh->tetra[k];
@@ -3328,7 +3329,7 @@ int _MMG5_split4bar(MMG5_pMesh mesh, MMG5_pSol met, int k,char metRidTyp) {
     if ( !metRidTyp && met->size > 1 )
       _MMG5_interp4bar33_ani(mesh,met,k,ib,cb);
     else
-      _MMG5_interp4bar(mesh,met,k,ib,cb);
+      mesh->func.interp4bar(mesh,met,k,ib,cb);
   }
 
   /* create 3 new tetras */
@@ -3516,7 +3517,7 @@ int _MMG5_split4bar(MMG5_pMesh mesh, MMG5_pSol met, int k,char metRidTyp) {
  *
  */
 static inline
-void _MMG3D_configSplit4sf(MMG5_pTetra pt,int vx[6],unsigned char tau[4],
+void _MMG3D_configSplit4sf(MMG5_pTetra pt,MMG5_int vx[6],unsigned char tau[4],
                            const unsigned char **taued,
                            unsigned char *imin23,unsigned char *imin12) {
 
@@ -3594,7 +3595,7 @@ void _MMG3D_configSplit4sf(MMG5_pTetra pt,int vx[6],unsigned char tau[4],
  *  Simulate split of 4 edges in a configuration when 3 lie on the same face.
  *
  */
-int _MMG3D_split4sf_sim(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6]) {
+int _MMG3D_split4sf_sim(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int vx[6]) {
   MMG5_pTetra         pt,pt0;
   double              vold,vnew;
   unsigned char       tau[4];
@@ -3697,12 +3698,11 @@ int _MMG3D_split4sf_sim(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6]) {
  * Split 4 edges in a configuration when 3 lie on the same face
  *
  */
-int _MMG5_split4sf(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6],char metRidTyp) {
+int _MMG5_split4sf(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int vx[6],char metRidTyp) {
   MMG5_pTetra         pt[6];
   MMG5_xTetra         xt[6];
   MMG5_pxTetra        pxt0;
-  int                 iel;
-  int                 newtet[6];
+  MMG5_int            iel,newtet[6];
   char                firstxt,isxt[6],j,i;
   unsigned char       tau[4],imin23,imin12;
   const unsigned char *taued = NULL;
@@ -3934,7 +3934,7 @@ int _MMG5_split4sf(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6],char metRidTyp)
  *  Simulate split of 4 edges in opposite configuration.
  *
  */
-int _MMG3D_split4op_sim(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6]) {
+int _MMG3D_split4op_sim(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int vx[6]) {
   MMG5_pTetra         pt,pt0;
   double              vold,vnew;
   unsigned char       tau[4];
@@ -4055,12 +4055,11 @@ int _MMG3D_split4op_sim(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6]) {
  * Split 4 edges in a configuration when no 3 edges lie on the same face
  *
  */
-int _MMG5_split4op(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6],char metRidTyp) {
+int _MMG5_split4op(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int vx[6],char metRidTyp) {
   MMG5_pTetra         pt[6];
   MMG5_xTetra         xt[6];
   MMG5_pxTetra        pxt0;
-  int                 iel;
-  int                 newtet[6];
+  MMG5_int            iel,newtet[6];
   char                flg,firstxt,isxt[6],i,j,imin01,imin23;
   unsigned char       tau[4];
   const unsigned char *taued;
@@ -4326,7 +4325,7 @@ int _MMG5_split4op(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6],char metRidTyp)
  *
  */
 static inline
-void _MMG3D_configSplit5(MMG5_pTetra pt,int vx[6],unsigned char tau[4],
+void _MMG3D_configSplit5(MMG5_pTetra pt,MMG5_int vx[6],unsigned char tau[4],
                          const unsigned char **taued,unsigned char *imin) {
 
   /* set permutation of vertices and edges ; reference configuration : 62 */
@@ -4375,7 +4374,7 @@ void _MMG3D_configSplit5(MMG5_pTetra pt,int vx[6],unsigned char tau[4],
  *  Simulate split of 5 edges.
  *
  */
-int _MMG3D_split5_sim(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6]) {
+int _MMG3D_split5_sim(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int vx[6]) {
   MMG5_pTetra         pt,pt0;
   double              vold,vnew;
   unsigned char       tau[4];
@@ -4466,12 +4465,12 @@ int _MMG3D_split5_sim(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6]) {
  * Split 5 edges
  *
  */
-int _MMG5_split5(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6],char metRidTyp) {
+int _MMG5_split5(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int vx[6],char metRidTyp) {
   MMG5_pTetra         pt[7];
   MMG5_xTetra         xt[7];
   MMG5_pxTetra        pxt0;
-  int                 iel,i,j;
-  int                 newtet[7];
+  int                 i,j;
+  MMG5_int            iel,newtet[7];
   char                firstxt,isxt[7];
   unsigned char       tau[4],imin;
   const unsigned char *taued=NULL;
@@ -4704,7 +4703,7 @@ int _MMG5_split5(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6],char metRidTyp) {
  *  Simulate split of 6 edges.
  *
  */
-int _MMG3D_split6_sim(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6]) {
+int _MMG3D_split6_sim(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int vx[6]) {
   MMG5_pTetra         pt,pt0;
   double              vold,vnew;
 
@@ -4773,12 +4772,12 @@ int _MMG3D_split6_sim(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6]) {
  * split all faces (6 edges)
  *
  */
-int _MMG5_split6(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6],char metRidTyp) {
+int _MMG5_split6(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int vx[6],char metRidTyp) {
   MMG5_pTetra    pt[8];
   MMG5_xTetra    xt0,xt;
   MMG5_pxTetra   pxt;
-  int       i,j,iel,nxt0;
-  int       newtet[8];
+  int       i,j;
+  MMG5_int  nxt0,iel,newtet[8];
   char      isxt0,isxt;
 
   pt[0]  = &mesh->tetra[k];
@@ -5152,11 +5151,12 @@ int _MMG5_split6(MMG5_pMesh mesh,MMG5_pSol met,int k,int vx[6],char metRidTyp) {
  *
  */
 static inline
-int _MMG3D_chksplit(MMG5_pMesh mesh, MMG5_pSol met,int ip,
-                    int* list,int ret,double crit) {
+int _MMG3D_chksplit(MMG5_pMesh mesh, MMG5_pSol met,MMG5_int ip,
+                    MMG5_int* list,int ret,double crit) {
   MMG5_pTetra   pt0,pt1;
   double        cal,critloc;
-  int           l,jel,na,ipb,lon;
+  int           l,ipb,lon;
+  MMG5_int      jel,na;
 
   lon = ret/2;
   critloc = 1.;
@@ -5173,19 +5173,19 @@ int _MMG3D_chksplit(MMG5_pMesh mesh, MMG5_pSol met,int ip,
     na  = list[l] % 6;
     pt1 = &mesh->tetra[jel];
 
-    memcpy(pt0->v,pt1->v,4*sizeof(int));
+    memcpy(pt0->v,pt1->v,4*sizeof(MMG5_int));
     ipb = _MMG5_iare[na][0];
     pt0->v[ipb] = ip;
-    cal = _MMG5_caltet(mesh,met,pt0);
+    cal = mesh->func.caltet(mesh,met,pt0);
     if ( cal < critloc ) {
       _MMG3D_delPt(mesh,ip);
       return(0);
     }
 
-    memcpy(pt0->v,pt1->v,4*sizeof(int));
+    memcpy(pt0->v,pt1->v,4*sizeof(MMG5_int));
     ipb = _MMG5_iare[na][1];
     pt0->v[ipb] = ip;
-    cal = _MMG5_caltet(mesh,met,pt0);
+    cal = mesh->func.caltet(mesh,met,pt0);
     if ( cal < critloc ) {
       _MMG3D_delPt(mesh,ip);
       return(0);
@@ -5204,12 +5204,13 @@ int _MMG3D_chksplit(MMG5_pMesh mesh, MMG5_pSol met,int ip,
  * Split edge iar of iel and verify that every new tet have a better quality than crit
  *
  */
-int _MMG5_splitedg(MMG5_pMesh mesh, MMG5_pSol met,int iel, int iar, double crit){
+MMG5_int _MMG5_splitedg(MMG5_pMesh mesh, MMG5_pSol met,int iel, int iar, double crit){
   MMG5_pTetra  pt;
   MMG5_pxTetra pxt;
   MMG5_pPoint  p0,p1;
   double       o[3];
-  int          list[MMG3D_LMAX+2],i0,i1,ip,warn,lon,ier;
+  int          warn,lon,ier;
+  MMG5_int     i0,i1,ip,list[MMG3D_LMAX+2];
   int16_t      tag;
 
   warn = 0;
@@ -5259,7 +5260,7 @@ int _MMG5_splitedg(MMG5_pMesh mesh, MMG5_pSol met,int iel, int iar, double crit)
     _MMG5_INCREASE_MEM_MESSAGE();
   }
 
-  ier = _MMG5_intmet(mesh,met,iel,iar,ip,0.5);
+  ier = mesh->func.intmet(mesh,met,iel,iar,ip,0.5);
   if ( !ier ) {
     _MMG3D_delPt(mesh,ip);
     return(0);
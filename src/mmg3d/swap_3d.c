@@ -34,7 +34,6 @@
 
 #include "inlined_functions_3d.h"
 
-extern char ddb;
 
 /**
  * \param mesh pointer toward the mesh structure.
@@ -52,8 +51,8 @@ extern char ddb;
  * provided).
  *
  */
-int _MMG5_chkswpbdy(MMG5_pMesh mesh, MMG5_pSol met, int *list,int ilist,
-                    int it1,int it2,char typchk) {
+int _MMG5_chkswpbdy(MMG5_pMesh mesh, MMG5_pSol met, MMG5_int *list,int ilist,
+                    MMG5_int it1,MMG5_int it2,char typchk) {
   MMG5_pTetra   pt,pt0;
   MMG5_pxTetra  pxt;
   MMG5_pPoint   p0,p1,ppt0;
@@ -61,7 +60,8 @@ int _MMG5_chkswpbdy(MMG5_pMesh mesh, MMG5_pSol met, int *list,int ilist,
   MMG5_pPar     par;
   double        b0[3],b1[3],n[3],v[3],c[3],ux,uy,uz,ps,disnat,dischg;
   double        cal1,cal2,calnat,calchg,calold,calnew,caltmp,hausd;
-  int           iel,iel1,iel2,np,nq,na1,na2,k,nminus,nplus,isloc,l,info;
+  int           k,nminus,nplus,isloc,l,info;
+  MMG5_int      np,nq,na1,na2,iel,iel1,iel2;
   char          ifa1,ifa2,ia,ip,iq,ia1,ia2,j,isshell,ier;
 
   iel = list[0] / 6;
@@ -305,8 +305,8 @@ int _MMG5_chkswpbdy(MMG5_pMesh mesh, MMG5_pSol met, int *list,int ilist,
     cal2 = _MMG5_caltri33_ani(mesh,met,&tt2);
   }
   else {
-    cal1 = _MMG5_caltri(mesh,met,&tt1);
-    cal2 = _MMG5_caltri(mesh,met,&tt2);
+    cal1 = mesh->func.caltri(mesh,met,&tt1);
+    cal2 = mesh->func.caltri(mesh,met,&tt2);
   }
 
   calnat = MG_MIN(cal1,cal2);
@@ -320,8 +320,8 @@ int _MMG5_chkswpbdy(MMG5_pMesh mesh, MMG5_pSol met, int *list,int ilist,
     cal2 = _MMG5_caltri33_ani(mesh,met,&tt2);
   }
   else {
-    cal1 = _MMG5_caltri(mesh,met,&tt1);
-    cal2 = _MMG5_caltri(mesh,met,&tt2);
+    cal1 = mesh->func.caltri(mesh,met,&tt1);
+    cal2 = mesh->func.caltri(mesh,met,&tt2);
   }
 
   calchg = MG_MIN(cal1,cal2);
@@ -340,7 +340,7 @@ int _MMG5_chkswpbdy(MMG5_pMesh mesh, MMG5_pSol met, int *list,int ilist,
         return(0);
     }
     else {
-      if ( _MMG5_intmet(mesh,met,list[0]/6,list[0]%6,0,0.5) <= 0 )
+      if ( mesh->func.intmet(mesh,met,list[0]/6,list[0]%6,0,0.5) <= 0 )
         return(0);
     }
   }
@@ -427,14 +427,15 @@ int _MMG5_chkswpbdy(MMG5_pMesh mesh, MMG5_pSol met, int *list,int ilist,
  * Swap boundary edge whose shell is provided.
  *
  */
-int _MMG5_swpbdy(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ret,int it1,
+MMG5_int _MMG5_swpbdy(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int *list,int ret,MMG5_int it1,
                  _MMG3D_pOctree octree, char typchk) {
   MMG5_pTetra   pt,pt1;
   MMG5_pPoint   p0,p1;
-  int           iel,iel1,ilist,np,nq,nm;
+  int           ilist;
+  MMG5_int      np,nq,nm,iel,iel1;
   double        c[3];
   char          ia,iface1,j,ipa,im;
-  int           ier;
+  MMG5_int      ier;
 #ifndef NDEBUG
   int           na;
 #endif
@@ -487,7 +488,7 @@ int _MMG5_swpbdy(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ret,int it1,
       if ( _MMG3D_intmet33_ani(mesh,met,iel,ia,nm,0.5)<=0 )  return(0);
     }
     else {
-      if ( _MMG5_intmet(mesh,met,iel,ia,nm,0.5)<=0 )  return(0);
+      if ( mesh->func.intmet(mesh,met,iel,ia,nm,0.5)<=0 )  return(0);
     }
   }
 
@@ -507,7 +508,7 @@ int _MMG5_swpbdy(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ret,int it1,
   }
 
   /* Collapse m on na after taking (new) ball of m */
-  memset(list,0,(MMG3D_LMAX+2)*sizeof(int));
+  memset(list,0,(MMG3D_LMAX+2)*sizeof(MMG5_int));
   for (j=0; j<3; j++) {
     im = _MMG5_idir[iface1][j];
     if ( pt1->v[im] == nm )  break;
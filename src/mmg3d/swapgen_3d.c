@@ -51,20 +51,25 @@
  * return \f$4*k+i\f$ the index of point corresponding to the swapped
  * configuration. The shell of edge is built during the process.
  *
+ * \remark the mesh is not modified, thus the function may be called
+ * concurrently on different edges.
+ *
  */
-int _MMG5_chkswpgen(MMG5_pMesh mesh,MMG5_pSol met,int start,int ia,
-                    int *ilist,int *list,double crit,char typchk) {
+MMG5_int _MMG5_chkswpgen(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int start,int ia,
+                    int *ilist,MMG5_int *list,double crit,char typchk) {
   MMG5_pTetra    pt,pt0;
+  MMG5_Tetra     tet0;
   MMG5_pPoint    p0;
   double         calold,calnew,caltmp;
-  int            na,nb,np,adj,piv,npol,refdom,k,l,iel;
-  int            *adja,pol[MMG3D_LMAX+2];
+  int            npol,refdom,k,l;
+  MMG5_int       na,nb,np,piv,adj,iel;
+  MMG5_int       *adja,pol[MMG3D_LMAX+2];
   char           i,ipa,ipb,ip,ier,ifac;
 
   pt  = &mesh->tetra[start];
   refdom = pt->ref;
 
-  pt0 = &mesh->tetra[0];
+  pt0 = &tet0;
   na  = pt->v[_MMG5_iare[ia][0]];
   nb  = pt->v[_MMG5_iare[ia][1]];
   calold = pt->qual;
@@ -205,7 +210,7 @@ int _MMG5_chkswpgen(MMG5_pMesh mesh,MMG5_pSol met,int start,int ia,
       if ( typchk==1 && met->size > 1 && met->m )
         caltmp = _MMG5_caltet33_ani(mesh,met,pt0);
       else
-        caltmp = _MMG5_orcal(mesh,met,0);
+        caltmp = mesh->func.caltet(mesh,met,pt0);
 
       calnew = MG_MIN(calnew,caltmp);
 
@@ -219,7 +224,7 @@ int _MMG5_chkswpgen(MMG5_pMesh mesh,MMG5_pSol met,int start,int ia,
       if ( typchk==1 && met->size > 1 && met->m )
         caltmp = _MMG5_caltet33_ani(mesh,met,pt0);
       else
-        caltmp = _MMG5_orcal(mesh,met,0);
+        caltmp = mesh->func.caltet(mesh,met,pt0);
 
       calnew = MG_MIN(calnew,caltmp);
 
@@ -247,14 +252,15 @@ int _MMG5_chkswpgen(MMG5_pMesh mesh,MMG5_pSol met,int start,int ia,
  * Perform swap of edge whose shell is passed according to configuration nconf.
  *
  */
-int _MMG5_swpgen(MMG5_pMesh mesh,MMG5_pSol met,int nconf,int ilist,int *list,
+int _MMG5_swpgen(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int nconf,int ilist,MMG5_int *list,
                  _MMG3D_pOctree octree, char typchk) {
   MMG5_pTetra    pt;
   MMG5_pPoint    p0,p1;
-  int       iel,na,nb,np,nball,ret,start;
+  int       nball,ret;
+  MMG5_int  na,nb,np,start,iel;
   double    m[3];
   char      ia,ip,iq;
-  int       ier;
+  MMG5_int  ier;
 
   iel = list[0] / 6;
   ia  = list[0] % 6;
@@ -284,7 +290,7 @@ int _MMG5_swpgen(MMG5_pMesh mesh,MMG5_pSol met,int nconf,int ilist,int *list,
       if ( _MMG3D_intmet33_ani(mesh,met,iel,ia,np,0.5)<=0 )  return(0);
     }
     else {
-      if ( _MMG5_intmet(mesh,met,iel,ia,np,0.5)<=0 ) return(0);
+      if ( mesh->func.intmet(mesh,met,iel,ia,np,0.5)<=0 ) return(0);
     }
   }
 
@@ -314,7 +320,7 @@ int _MMG5_swpgen(MMG5_pMesh mesh,MMG5_pSol met,int nconf,int ilist,int *list,
   }
   assert(ip<4);
 
-  memset(list,0,(MMG3D_LMAX+2)*sizeof(int));
+  memset(list,0,(MMG3D_LMAX+2)*sizeof(MMG5_int));
   nball = _MMG5_boulevolp(mesh,start,ip,list);
 
   ier = _MMG5_colver(mesh,met,list,nball,iq,typchk);
@@ -347,8 +353,8 @@ int MMG3D_swap23(MMG5_pMesh mesh,MMG5_pSol met,int k,char metRidTyp) {
   MMG5_xTetra          xt[3];
   MMG5_pxTetra         pxt0,pxt1;
   double               vold0,vold,vnew;
-  int                  k1,conf0,conf1,*adja,iel,np,xt1;
-  int                  adj0_2,adj0_3,adj1_1,adj1_2,adj1_3;
+  int                  conf0,conf1;
+  MMG5_int             np,xt1,iel,*adja,adj0_2,adj0_3,adj1_1,adj1_2,adj1_3,k1;
   char                 j0,j1,i,isxt[3];
   unsigned char        tau0[4],tau1[4];
   const unsigned char *taued0,*taued1;
@@ -35,7 +35,6 @@
 
 #include "mmg3d.h"
 
-extern char ddb;
 
 /** naive (increasing) sorting algorithm, for very small tabs ; permutation is stored in perm */
 inline void _MMG5_nsort(int n,double *val,char *perm){
@@ -56,7 +55,7 @@ inline void _MMG5_nsort(int n,double *val,char *perm){
 
 
 /** Compute normal to face iface of tetra k, exterior to tetra k */
-inline int _MMG5_norface(MMG5_pMesh mesh,int k,int iface,double n[3]) {
+inline int _MMG5_norface(MMG5_pMesh mesh,MMG5_int k,int iface,double n[3]) {
   MMG5_pTetra     pt;
 
   pt = &mesh->tetra[k];
@@ -70,8 +69,9 @@ inline int _MMG5_norface(MMG5_pMesh mesh,int k,int iface,double n[3]) {
 /** If need be, invert the travelling sense of surfacic ball so that it is travelled in
     the direct sense with respect to direction n anchored at point ip (ip = global num.):
     return 2 = orientation reversed, 1 otherwise */
-inline int _MMG5_directsurfball(MMG5_pMesh mesh, int ip, int *list, int ilist, double n[3]){
-    int             j,aux,iel;
+inline int _MMG5_directsurfball(MMG5_pMesh mesh, MMG5_int ip, MMG5_int *list, int ilist, double n[3]){
+    int             j;
+    MMG5_int        aux,iel;
     double          nt[3],ps;
     unsigned char   iface;
 
@@ -94,9 +94,10 @@ inline int _MMG5_directsurfball(MMG5_pMesh mesh, int ip, int *list, int ilist, d
 /** If need be, reorder the surfacic ball of point ip, so that its first element has
     edge (p,q) (nump,q = global num) as edge _MMG5_iprv2[ip] of face iface.
     return 2 = orientation reversed, 1 otherwise */
-int _MMG5_startedgsurfball(MMG5_pMesh mesh,int nump,int numq,int *list,int ilist) {
+int _MMG5_startedgsurfball(MMG5_pMesh mesh,MMG5_int nump,MMG5_int numq,MMG5_int *list,int ilist) {
     MMG5_pTetra          pt;
-    int             iel,tmp,l;
+    int             l;
+    MMG5_int        iel,tmp;
     unsigned char   iface,ip,ipt;
 
     iel = list[0]/4;
@@ -130,7 +131,7 @@ int _MMG5_startedgsurfball(MMG5_pMesh mesh,int nump,int numq,int *list,int ilist
 
 /** Compute point located at parameter value step from point ip0, as well as interpolate
     of normals, tangent for a RIDGE edge */
-inline int _MMG5_BezierRidge(MMG5_pMesh mesh,int ip0,int ip1,double s,double *o,double *no1,double *no2,double *to){
+inline int _MMG5_BezierRidge(MMG5_pMesh mesh,MMG5_int ip0,MMG5_int ip1,double s,double *o,double *no1,double *no2,double *to){
     MMG5_pPoint    p0,p1;
     double    ux,uy,uz,n01[3],n02[3],n11[3],n12[3],t0[3],t1[3];
     double    ps,ps2,b0[3],b1[3],bn[3],ll,il,ntemp[3],dd,alpha;
@@ -312,7 +313,7 @@ inline int _MMG5_BezierRidge(MMG5_pMesh mesh,int ip0,int ip1,double s,double *o,
 
 /** Compute point located at parameter value step from point ip0, as well as interpolate
     of normals, tangent for a REF edge */
-inline int _MMG5_BezierRef(MMG5_pMesh mesh,int ip0,int ip1,double s,double *o,double *no,double *to) {
+inline int _MMG5_BezierRef(MMG5_pMesh mesh,MMG5_int ip0,MMG5_int ip1,double s,double *o,double *no,double *to) {
     MMG5_pPoint          p0,p1;
     double          ux,uy,uz,n01[3],n02[3],n11[3],n12[3],ntemp[3],t0[3],t1[3];
     double          ps,b0[3],b1[3],bn[3],ll,il,dd,alpha,ps2;
@@ -467,7 +468,7 @@ inline int _MMG5_BezierRef(MMG5_pMesh mesh,int ip0,int ip1,double s,double *o,do
 
 /** Compute point located at parameter value step from point ip0, as well as interpolate
     of normals, tangent for a NOM edge */
-inline int _MMG5_BezierNom(MMG5_pMesh mesh,int ip0,int ip1,double s,double *o,double *no,double *to) {
+inline int _MMG5_BezierNom(MMG5_pMesh mesh,MMG5_int ip0,MMG5_int ip1,double s,double *o,double *no,double *to) {
     MMG5_pPoint      p0,p1;
     double      ux,uy,uz,il,ll,ps,alpha,dd;
     double      t0[3],t1[3],b0[3],b1[3],n0[3],n1[3],bn[3];
@@ -609,7 +610,7 @@ inline int _MMG5_BezierNom(MMG5_pMesh mesh,int ip0,int ip1,double s,double *o,do
 
 /** Compute point located at parameter value step from point ip0, as well as interpolate
     of normals, tangent for a regular edge ; v = ref vector (normal) for choice of normals if need be */
-inline int _MMG5_BezierReg(MMG5_pMesh mesh,int ip0, int ip1, double s, double v[3], double *o, double *no){
+inline int _MMG5_BezierReg(MMG5_pMesh mesh,MMG5_int ip0, MMG5_int ip1, double s, double v[3], double *o, double *no){
     MMG5_pPoint p0,p1;
     double b0[3],b1[3],bn[3],t0[3],t1[3],np0[3],np1[3],alpha,ux,uy,uz,ps1,ps2,ll,il,dd,*n1,*n2;
 
@@ -771,9 +772,10 @@ inline int _MMG5_BezierReg(MMG5_pMesh mesh,int ip0, int ip1, double s, double v[
 }
 
 /** find the element number in packed numerotation */
-int _MMG3D_indElt(MMG5_pMesh mesh, int kel) {
+MMG5_int _MMG3D_indElt(MMG5_pMesh mesh, MMG5_int kel) {
     MMG5_pTetra pt;
-    int    ne, k;
+    int    ne;
+    MMG5_int k;
 
     ne = 0;
     for (k=1; k<=mesh->ne; k++) {
@@ -787,9 +789,10 @@ int _MMG3D_indElt(MMG5_pMesh mesh, int kel) {
 }
 
 /** find the point number in packed numerotation */
-int _MMG3D_indPt(MMG5_pMesh mesh, int kp) {
+MMG5_int _MMG3D_indPt(MMG5_pMesh mesh, MMG5_int kp) {
     MMG5_pPoint ppt;
-    int         np, k;
+    int         np;
+    MMG5_int    k;
 
     np = 0;
     for (k=1; k<=mesh->np; k++) {
@@ -806,17 +809,17 @@ int _MMG3D_indPt(MMG5_pMesh mesh, int kp) {
 void _MMG5_printTetra(MMG5_pMesh mesh,char* fileName) {
     MMG5_pTetra  pt;
     MMG5_pxTetra pxt;
-    int     k;
+    MMG5_int k;
     FILE    *inm;
 
     inm = fopen(fileName,"w");
 
-    fprintf(inm,"----------> %d _MMG5_TETRAHEDRAS <----------\n",mesh->ne);
+    fprintf(inm,"----------> %" MMG5_PRId " _MMG5_TETRAHEDRAS <----------\n",mesh->ne);
     for(k=1; k<=mesh->ne; k++) {
         pt = &mesh->tetra[k];
-        fprintf(inm,"num %d -> %d %d %d %d\n",k,pt->v[0],pt->v[1],
+        fprintf(inm,"num %" MMG5_PRId " -> %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId "\n",k,pt->v[0],pt->v[1],
                 pt->v[2],pt->v[3]);
-        fprintf(inm,"ref,tag,xt  -> %d %d %d\n",pt->ref,pt->tag,pt->xt);
+        fprintf(inm,"ref,tag,xt  -> %d %d %" MMG5_PRId "\n",pt->ref,pt->tag,pt->xt);
         if ( pt->xt ) {
             pxt = &mesh->xtetra[pt->xt];
             fprintf(inm,"tag   -> %d %d %d %d %d %d\n",pxt->tag[0],pxt->tag[1],
@@ -853,14 +856,15 @@ void _MMG5_printTetra(MMG5_pMesh mesh,char* fileName) {
  * ball of point must be provided).
  *
  */
-int _MMG3D_localParamReg(MMG5_pMesh mesh,int ip,int *listv,int ilistv,
-                         int *lists,int ilists,
+int _MMG3D_localParamReg(MMG5_pMesh mesh,MMG5_int ip,MMG5_int *listv,int ilistv,
+                         MMG5_int *lists,int ilists,
                          double* hausd_ip,double *hmin_ip,double *hmax_ip) {
 
   MMG5_pTetra pt;
   MMG5_pPar   par;
   double      hausd, hmin, hmax;
-  int         l,k,isloc,ifac1;
+  int         l,k,isloc;
+  MMG5_int    ifac1;
 
   hausd = mesh->info.hausd;
   hmin  = mesh->info.hmin;
@@ -988,16 +992,18 @@ int _MMG3D_localParamReg(MMG5_pMesh mesh,int ip,int *listv,int ilistv,
  * Compute the local parameters at non manifold point \a ip.
  *
  */
-int _MMG3D_localParamNm(MMG5_pMesh mesh,int iel,int iface,int ia,
+int _MMG3D_localParamNm(MMG5_pMesh mesh,MMG5_int iel,int iface,int ia,
                          double* hausd_ip,double *hmin_ip,double *hmax_ip) {
 
   MMG5_pTetra  pt;
   MMG5_pxTetra pxt;
   MMG5_pPar    par;
   double       hausd, hmin, hmax;
-  int          l,k,isloc,ifac1,ifac2;
-  int          listv[MMG3D_LMAX+2],ilistv;
-  static char  mmgWarn0;
+  int          l,k,isloc;
+  MMG5_int     ifac1,ifac2;
+  int          ilistv;
+  MMG5_int     listv[MMG3D_LMAX+2];
+  static _MMG5_TLS char  mmgWarn0;
 
 
   hausd = mesh->info.hausd;
@@ -91,7 +91,7 @@ static inline
 void _MMG3D_Init_woalloc_mesh(MMG5_pMesh mesh, MMG5_pSol sol, MMG5_pSol disp
   ) {
 
-  _MMG3D_Set_commonFunc();
+  _MMG3D_Set_commonFunc(mesh);
 
   (mesh)->dim   = 3;
   (mesh)->ver   = 2;
@@ -428,13 +428,13 @@ int _MMG3D_Free_structures_var(va_list argptr)
     _MMG5_DEL_MEM((*mesh),(*mesh)->edge,((*mesh)->na+1)*sizeof(MMG5_Edge));
 
   if ( (*mesh)->adjt )
-    _MMG5_DEL_MEM(*mesh,(*mesh)->adjt,(3*(*mesh)->nt+4)*sizeof(int));
+    _MMG5_DEL_MEM(*mesh,(*mesh)->adjt,(3*(*mesh)->nt+4)*sizeof(MMG5_int));
 
   if ( (*mesh)->adja )
-    _MMG5_DEL_MEM((*mesh),(*mesh)->adja,(4*(*mesh)->nemax+5)*sizeof(int));
+    _MMG5_DEL_MEM((*mesh),(*mesh)->adja,(4*(*mesh)->nemax+5)*sizeof(MMG5_int));
 
   if ( (*mesh)->adjapr )
-    _MMG5_DEL_MEM((*mesh),(*mesh)->adjapr,(5*(*mesh)->nprism+6)*sizeof(int));
+    _MMG5_DEL_MEM((*mesh),(*mesh)->adjapr,(5*(*mesh)->nprism+6)*sizeof(MMG5_int));
 
   if ( (*mesh)->htab.geom )
     _MMG5_DEL_MEM((*mesh),(*mesh)->htab.geom,((*mesh)->htab.max+1)*sizeof(MMG5_hgeom));
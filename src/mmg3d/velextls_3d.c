@@ -50,7 +50,8 @@ int* _MMG5_packLS(MMG5_pMesh mesh,MMG5_pSol disp,LSst *lsst,int *npfin) {
   MMG5_pxTetra   pxt;
   MMG5_pPoint    p0;
   double         u[3];
-  int            k,n,ip,iel,jel,nlay,npf,ntf,ilist,ilisto,ilistck,vper[4],*list,*perm,*invperm,*adja;
+  int            n,ip,iel,jel,nlay,npf,ntf,ilist,ilisto,ilistck,vper[4],*list,*perm,*invperm,*adja;
+  MMG5_int       k;
   int            refdirh,refdirnh;
   char           i,j,jface;
   
@@ -286,7 +287,8 @@ int* _MMG5_packLS(MMG5_pMesh mesh,MMG5_pSol disp,LSst *lsst,int *npfin) {
 /** Transfer solution from the submesh to the global mesh */
 int _MMG5_unpackLS(MMG5_pMesh mesh,MMG5_pSol disp,LSst *lsst,int npf,int *invperm) {
   double     *u;
-  int        k,ip;
+  int        ip;
+  MMG5_int   k;
   char       i;
   
   u = LS_getSol(lsst);
@@ -36,9 +36,9 @@
 #include "mmg3d.h"
 
 /** get new point address */
-int _MMG3D_newPt(MMG5_pMesh mesh,double c[3],int16_t tag) {
+MMG5_int _MMG3D_newPt(MMG5_pMesh mesh,double c[3],int16_t tag) {
   MMG5_pPoint  ppt;
-  int     curpt;
+  MMG5_int curpt;
 
   if ( !mesh->npnil )  return(0);
   curpt = mesh->npnil;
@@ -72,7 +72,7 @@ int _MMG3D_newPt(MMG5_pMesh mesh,double c[3],int16_t tag) {
   return(curpt);
 }
 
-void _MMG3D_delPt(MMG5_pMesh mesh,int ip) {
+void _MMG3D_delPt(MMG5_pMesh mesh,MMG5_int ip) {
   MMG5_pPoint   ppt;
   MMG5_xPoint  *pxp;
 
@@ -91,8 +91,8 @@ void _MMG3D_delPt(MMG5_pMesh mesh,int ip) {
 }
 
 /** get new elt address */
-int _MMG3D_newElt(MMG5_pMesh mesh) {
-  int     curiel;
+MMG5_int _MMG3D_newElt(MMG5_pMesh mesh) {
+  MMG5_int curiel;
 
   if ( !mesh->nenil )  return(0);
   curiel = mesh->nenil;
@@ -101,6 +101,7 @@ int _MMG3D_newElt(MMG5_pMesh mesh) {
   mesh->nenil = mesh->tetra[curiel].v[3];
   mesh->tetra[curiel].v[3] = 0;
   mesh->tetra[curiel].mark=mesh->mark;
+  _MMG3D_unsetCache(mesh,curiel);
 
   return(curiel);
 }
@@ -114,20 +115,21 @@ int _MMG3D_newElt(MMG5_pMesh mesh) {
  * Delete the element \a iel
  *
  */
-int _MMG3D_delElt(MMG5_pMesh mesh,int iel) {
+int _MMG3D_delElt(MMG5_pMesh mesh,MMG5_int iel) {
   MMG5_pTetra   pt;
-  int      iadr;
+  MMG5_int iadr;
 
   pt = &mesh->tetra[iel];
   if ( !MG_EOK(pt) ) {
-    fprintf(stderr,"\n  ## INVALID ELEMENT %d.\n",iel);
+    fprintf(stderr,"\n  ## INVALID ELEMENT %" MMG5_PRId ".\n",iel);
     return(0);
   }
   memset(pt,0,sizeof(MMG5_Tetra));
+  _MMG3D_unsetCache(mesh,iel);
   pt->v[3] = mesh->nenil;
   iadr = 4*(iel-1) + 1;
   if ( mesh->adja )
-    memset(&mesh->adja[iadr],0,4*sizeof(int));
+    memset(&mesh->adja[iadr],0,4*sizeof(MMG5_int));
   mesh->nenil = iel;
   if ( iel == mesh->ne ) {
     while ( !MG_EOK((&mesh->tetra[mesh->ne])) )  mesh->ne--;
@@ -175,7 +177,7 @@ int _MMG3D_memOption(MMG5_pMesh mesh) {
      * point+tria+tets+adja+adjt+sol+item */
     bytes = sizeof(MMG5_Point) + sizeof(MMG5_xPoint) +
       6*sizeof(MMG5_Tetra) + ctri*sizeof(MMG5_xTetra) +
-      4*6*sizeof(int) + ctri*3*sizeof(int) +
+      4*6*sizeof(MMG5_int) + ctri*3*sizeof(MMG5_int) +
       sizeof(MMG5_Sol)+4*sizeof(_MMG5_hedge);
 
 #ifdef USE_SCOTCH
@@ -221,9 +223,9 @@ int _MMG3D_memOption(MMG5_pMesh mesh) {
             mesh->memMax/million);
   }
   if ( abs(mesh->info.imprim) > 5 || mesh->info.ddebug ) {
-    fprintf(stdout,"  _MMG3D_NPMAX    %d\n",mesh->npmax);
-    fprintf(stdout,"  _MMG3D_NTMAX    %d\n",mesh->ntmax);
-    fprintf(stdout,"  _MMG3D_NEMAX    %d\n",mesh->nemax);
+    fprintf(stdout,"  _MMG3D_NPMAX    %" MMG5_PRId "\n",mesh->npmax);
+    fprintf(stdout,"  _MMG3D_NTMAX    %" MMG5_PRId "\n",mesh->ntmax);
+    fprintf(stdout,"  _MMG3D_NEMAX    %" MMG5_PRId "\n",mesh->nemax);
   }
 
   return 1;
@@ -238,7 +240,7 @@ int _MMG3D_memOption(MMG5_pMesh mesh) {
  *
  */
 int _MMG3D_zaldy(MMG5_pMesh mesh) {
-  int     k;
+  MMG5_int k;
 
   if ( !_MMG3D_memOption(mesh) )  return 0;
 
@@ -290,6 +292,104 @@ int _MMG3D_zaldy(MMG5_pMesh mesh) {
   return(1);
 }
 
+/**
+ * \param mesh pointer toward the mesh
+ * \param met pointer toward the metric
+ *
+ * \return 1 if success, 0 if fail
+ *
+ * Enlarge once the point and tetra tables (and the metric and adjacency
+ * tables) to the sizes of the adapted mesh estimated from the metric, so that
+ * they are not reallocated in the middle of the adaptation. At most the half of
+ * the remaining memory is used by the enlargement, the tables being reallocated
+ * as usual if the estimation is too small.
+ *
+ * The new entries are linked after the existing empty entries so the numbering
+ * of the created points and tetra is the same as with larger initial tables.
+ *
+ */
+int _MMG3D_presize(MMG5_pMesh mesh,MMG5_pSol met) {
+  long long  npest,neest,bytes,avail;
+  double     ratio;
+  MMG5_int   npmax,nemax,k;
+
+  if ( !met->m || met->npmax != mesh->npmax )  return(1);
+
+  _MMG3D_estimSize(mesh,met,&npest,&neest);
+
+  if ( abs(mesh->info.imprim) > 4 || mesh->info.ddebug ) {
+    fprintf(stdout,"  ** ESTIMATED SIZE  %lld POINTS  %lld TETRA\n",
+            npest,neest);
+  }
+
+  /* 10% of margin */
+  npest = MG_MIN((long long)(1.1*npest),INT_MAX/8);
+  neest = MG_MIN((long long)(1.1*neest),INT_MAX/8);
+  npmax = MG_MAX(mesh->npmax,(int)npest);
+  nemax = MG_MAX(mesh->nemax,(int)neest);
+  if ( npmax == mesh->npmax && nemax == mesh->nemax )  return(1);
+
+  bytes = (long long)(npmax-mesh->npmax)*
+    (sizeof(MMG5_Point)+met->size*sizeof(double));
+  bytes += (long long)(nemax-mesh->nemax)*
+    (sizeof(MMG5_Tetra)+(mesh->adja ? 4*sizeof(MMG5_int) : 0));
+  avail = (mesh->memMax-mesh->memCur)/2;
+  if ( bytes > avail ) {
+    ratio = avail > 0 ? (double)avail/(double)bytes : 0.0;
+    npmax = mesh->npmax + (int)(ratio*(npmax-mesh->npmax));
+    nemax = mesh->nemax + (int)(ratio*(nemax-mesh->nemax));
+  }
+
+  if ( npmax > mesh->npmax ) {
+    _MMG5_ADD_MEM(mesh,(npmax-mesh->npmax)*sizeof(MMG5_Point),
+                  "larger point table",return(0));
+    _MMG5_SAFE_RECALLOC(mesh->point,mesh->npmax+1,npmax+1,MMG5_Point,
+                        "larger point table",0);
+    _MMG5_ADD_MEM(mesh,(met->size*(npmax-met->npmax))*sizeof(double),
+                  "larger solution",return(0));
+    _MMG5_SAFE_RECALLOC(met->m,met->size*(met->npmax+1),met->size*(npmax+1),
+                        double,"larger solution",0);
+    met->npmax = npmax;
+
+    /* link the new points after the empty ones */
+    if ( !mesh->npnil )
+      mesh->npnil = mesh->npmax;
+    else {
+      for (k=mesh->npnil; mesh->point[k].tmp; k=mesh->point[k].tmp) ;
+      mesh->point[k].tmp = mesh->npmax;
+    }
+    for (k=mesh->npmax; k<npmax-1; k++)
+      mesh->point[k].tmp  = k+1;
+    mesh->npmax = npmax;
+  }
+
+  if ( nemax > mesh->nemax ) {
+    _MMG5_ADD_MEM(mesh,(nemax-mesh->nemax)*sizeof(MMG5_Tetra),
+                  "larger tetra table",return(0));
+    _MMG5_SAFE_RECALLOC(mesh->tetra,mesh->nemax+1,nemax+1,MMG5_Tetra,
+                        "larger tetra table",0);
+    if ( mesh->adja ) {
+      _MMG5_ADD_MEM(mesh,4*(nemax-mesh->nemax)*sizeof(MMG5_int),
+                    "larger adja table",return(0));
+      _MMG5_SAFE_RECALLOC(mesh->adja,4*mesh->nemax+5,4*nemax+5,MMG5_int,
+                          "larger adja table",0);
+    }
+
+    /* link the new tetra after the empty ones */
+    if ( !mesh->nenil )
+      mesh->nenil = mesh->nemax;
+    else {
+      for (k=mesh->nenil; mesh->tetra[k].v[3]; k=mesh->tetra[k].v[3]) ;
+      mesh->tetra[k].v[3] = mesh->nemax;
+    }
+    for (k=mesh->nemax; k<nemax-1; k++)
+      mesh->tetra[k].v[3] = k+1;
+    mesh->nemax = nemax;
+  }
+
+  return(1);
+}
+
 /**
  * \param mesh pointer toward the mesh structure.
  *
@@ -298,7 +398,7 @@ int _MMG3D_zaldy(MMG5_pMesh mesh) {
  */
 void _MMG5_freeXTets(MMG5_pMesh mesh) {
   MMG5_pTetra pt;
-  int    k;
+  MMG5_int k;
 
   for (k=1; k<=mesh->ne; k++) {
     pt     = &mesh->tetra[k];
@@ -317,7 +417,7 @@ void _MMG5_freeXTets(MMG5_pMesh mesh) {
  */
 void _MMG5_freeXPrisms(MMG5_pMesh mesh) {
   MMG5_pPrism pp;
-  int    k;
+  MMG5_int k;
 
   for (k=1; k<=mesh->nprism; k++) {
     pp      = &mesh->prism[k];
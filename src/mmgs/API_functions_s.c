@@ -81,11 +81,11 @@ void MMGS_Init_parameters(MMG5_pMesh mesh) {
   /* Init common parameters for mmgs and mmgs. */
   _MMG5_Init_parameters(mesh);
 
-  mesh->info.renum    = 0;   /* [0/1], Turn off/on the renumbering using SCOTCH; */
+  mesh->info.renum    = 0;   /* [0/1/2], Turn off/on the renumbering (1: SCOTCH, 2: Hilbert curve); */
 
 }
 
-int MMGS_Set_solSize(MMG5_pMesh mesh, MMG5_pSol sol, int typEntity, int np, int typSol) {
+int MMGS_Set_solSize(MMG5_pMesh mesh, MMG5_pSol sol, int typEntity, MMG5_int np, int typSol) {
 
   if ( ( (mesh->info.imprim > 5) || mesh->info.ddebug ) && sol->m )
     fprintf(stderr,"\n  ## Warning: %s: old solution deletion.\n",__func__);
@@ -129,8 +129,8 @@ int MMGS_Set_solSize(MMG5_pMesh mesh, MMG5_pSol sol, int typEntity, int np, int
   return(1);
 }
 
-int MMGS_Set_meshSize(MMG5_pMesh mesh, int np, int nt, int na) {
-  int k;
+int MMGS_Set_meshSize(MMG5_pMesh mesh, MMG5_int np, MMG5_int nt, MMG5_int na) {
+  MMG5_int k;
 
   if ( ( (mesh->info.imprim > 5) || mesh->info.ddebug ) &&
        ( mesh->point || mesh->tria || mesh->edge) )
@@ -198,16 +198,16 @@ int MMGS_Set_meshSize(MMG5_pMesh mesh, int np, int nt, int na) {
 
   /* stats */
   if ( abs(mesh->info.imprim) > 6 ) {
-    fprintf(stdout,"     NUMBER OF VERTICES     %8d\n",mesh->np);
+    fprintf(stdout,"     NUMBER OF VERTICES     %8" MMG5_PRId "\n",mesh->np);
     if ( mesh->na ) {
-      fprintf(stdout,"     NUMBER OF EDGES        %8d\n",mesh->na);
+      fprintf(stdout,"     NUMBER OF EDGES        %8" MMG5_PRId "\n",mesh->na);
     }
-    fprintf(stdout,"     NUMBER OF TRIANGLES    %8d\n",mesh->nt);
+    fprintf(stdout,"     NUMBER OF TRIANGLES    %8" MMG5_PRId "\n",mesh->nt);
   }
   return(1);
 }
 
-int MMGS_Get_solSize(MMG5_pMesh mesh, MMG5_pSol sol, int* typEntity, int* np, int* typSol) {
+int MMGS_Get_solSize(MMG5_pMesh mesh, MMG5_pSol sol, int* typEntity, MMG5_int* np, int* typSol) {
 
   if ( typEntity != NULL )
     *typEntity = MMG5_Vertex;
@@ -233,7 +233,7 @@ int MMGS_Get_solSize(MMG5_pMesh mesh, MMG5_pSol sol, int* typEntity, int* np, in
   return(1);
 }
 
-int MMGS_Get_meshSize(MMG5_pMesh mesh, int* np, int* nt, int* na) {
+int MMGS_Get_meshSize(MMG5_pMesh mesh, MMG5_int* np, MMG5_int* nt, MMG5_int* na) {
 
   if ( np != NULL )
     *np = mesh->np;
@@ -245,7 +245,7 @@ int MMGS_Get_meshSize(MMG5_pMesh mesh, int* np, int* nt, int* na) {
   return(1);
 }
 
-int MMGS_Set_vertex(MMG5_pMesh mesh, double c0, double c1, double c2, int ref, int pos) {
+int MMGS_Set_vertex(MMG5_pMesh mesh, double c0, double c1, double c2, int ref, MMG5_int pos) {
 
   if ( !mesh->np ) {
     fprintf(stderr,"\n  ## Error: %s: you must set the number of points with the",
@@ -256,15 +256,15 @@ int MMGS_Set_vertex(MMG5_pMesh mesh, double c0, double c1, double c2, int ref, i
 
   if ( pos > mesh->npmax ) {
     fprintf(stderr,"\n  ## Error: %s: unable to allocate a new point.\n",__func__);
-    fprintf(stderr,"    max number of points: %d\n",mesh->npmax);
+    fprintf(stderr,"    max number of points: %" MMG5_PRId "\n",mesh->npmax);
     _MMG5_INCREASE_MEM_MESSAGE();
     return(0);
   }
 
   if ( pos > mesh->np ) {
-    fprintf(stderr,"\n  ## Error: %s: attempt to set new vertex at position %d.",
+    fprintf(stderr,"\n  ## Error: %s: attempt to set new vertex at position %" MMG5_PRId ".",
             __func__,pos);
-    fprintf(stderr," Overflow of the given number of vertices: %d\n",mesh->np);
+    fprintf(stderr," Overflow of the given number of vertices: %" MMG5_PRId "\n",mesh->np);
     fprintf(stderr,"\n  ## Check the mesh size, its compactness or the position");
     fprintf(stderr," of the vertex.\n");
     return(0);
@@ -284,7 +284,7 @@ int MMGS_Set_vertex(MMG5_pMesh mesh, double c0, double c1, double c2, int ref, i
 int  MMGS_Set_vertices(MMG5_pMesh mesh, double *vertices,int *refs) {
 
   MMG5_pPoint ppt;
-  int i,j;
+  MMG5_int i,j;
 
   /*coordinates vertices*/
   for (i=1;i<=mesh->np;i++)
@@ -319,7 +319,7 @@ int MMGS_Get_vertex(MMG5_pMesh mesh, double* c0, double* c1, double* c2, int* re
     fprintf(stderr,"     You must pass here exactly one time (the first time ");
     fprintf(stderr,"you call the MMGS_Get_vertex function).\n");
     fprintf(stderr,"     If not, the number of call of this function");
-    fprintf(stderr," exceed the number of points: %d\n ",mesh->np);
+    fprintf(stderr," exceed the number of points: %" MMG5_PRId "\n ",mesh->np);
    }
  }
 
@@ -328,7 +328,7 @@ int MMGS_Get_vertex(MMG5_pMesh mesh, double* c0, double* c1, double* c2, int* re
   if ( mesh->npi > mesh->np ) {
     fprintf(stderr,"\n  ## Error: %s: unable to get point.\n",__func__);
     fprintf(stderr,"     The number of call of MMGS_Get_vertex function");
-    fprintf(stderr," can not exceed the number of points: %d\n ",mesh->np);
+    fprintf(stderr," can not exceed the number of points: %" MMG5_PRId "\n ",mesh->np);
     return(0);
   }
 
@@ -358,7 +358,7 @@ int MMGS_Get_vertex(MMG5_pMesh mesh, double* c0, double* c1, double* c2, int* re
 int  MMGS_Get_vertices(MMG5_pMesh mesh, double* vertices, int* refs,
                         int* areCorners, int* areRequired) {
   MMG5_pPoint ppt;
-  int i,j;
+  MMG5_int i,j;
 
   for (i=1;i<=mesh->np;i++)
   {
@@ -391,7 +391,7 @@ int  MMGS_Get_vertices(MMG5_pMesh mesh, double* vertices, int* refs,
   return 1;
 }
 
-int MMGS_Set_triangle(MMG5_pMesh mesh, int v0, int v1, int v2, int ref,int pos) {
+int MMGS_Set_triangle(MMG5_pMesh mesh, MMG5_int v0, MMG5_int v1, MMG5_int v2, int ref,MMG5_int pos) {
 
   if ( !mesh->nt ) {
     fprintf(stderr,"\n  ## Error: %s: You must set the number of triangles"
@@ -403,15 +403,15 @@ int MMGS_Set_triangle(MMG5_pMesh mesh, int v0, int v1, int v2, int ref,int pos)
   if ( pos > mesh->ntmax ) {
     fprintf(stderr,"\n  ## Error: %s: unable to allocate a new triangle.\n",
             __func__);
-    fprintf(stderr,"    max number of triangle: %d\n",mesh->ntmax);
+    fprintf(stderr,"    max number of triangle: %" MMG5_PRId "\n",mesh->ntmax);
     _MMG5_INCREASE_MEM_MESSAGE();
     return(0);
   }
 
   if ( pos > mesh->nt ) {
-    fprintf(stderr,"\n  ## Error: %s: attempt to set new triangle at position %d.",
+    fprintf(stderr,"\n  ## Error: %s: attempt to set new triangle at position %" MMG5_PRId ".",
             __func__,pos);
-    fprintf(stderr," Overflow of the given number of triangles: %d\n",mesh->nt);
+    fprintf(stderr," Overflow of the given number of triangles: %" MMG5_PRId "\n",mesh->nt);
     fprintf(stderr,"\n  ## Check the mesh size, its compactness or the position");
     fprintf(stderr," of the triangle.\n");
     return(0);
@@ -429,7 +429,7 @@ int MMGS_Set_triangle(MMG5_pMesh mesh, int v0, int v1, int v2, int ref,int pos)
   return(1);
 }
 
-int MMGS_Get_triangle(MMG5_pMesh mesh, int* v0, int* v1, int* v2, int* ref
+int MMGS_Get_triangle(MMG5_pMesh mesh, MMG5_int* v0, MMG5_int* v1, MMG5_int* v2, int* ref
                       ,int* isRequired) {
   MMG5_pTria  ptt;
 
@@ -441,7 +441,7 @@ int MMGS_Get_triangle(MMG5_pMesh mesh, int* v0, int* v1, int* v2, int* ref
       fprintf(stderr,"     You must pass here exactly one time (the first time ");
       fprintf(stderr,"you call the MMGS_Get_triangle function).\n");
       fprintf(stderr,"     If not, the number of call of this function");
-      fprintf(stderr," exceed the number of triangles: %d\n ",mesh->nt);
+      fprintf(stderr," exceed the number of triangles: %" MMG5_PRId "\n ",mesh->nt);
     }
   }
 
@@ -450,7 +450,7 @@ int MMGS_Get_triangle(MMG5_pMesh mesh, int* v0, int* v1, int* v2, int* ref
   if ( mesh->nti > mesh->nt ) {
     fprintf(stderr,"\n  ## Error: %s: unable to get triangle.\n",__func__);
     fprintf(stderr,"    The number of call of MMGS_Get_triangle function");
-    fprintf(stderr," can not exceed the number of triangles: %d\n ",mesh->nt);
+    fprintf(stderr," can not exceed the number of triangles: %" MMG5_PRId "\n ",mesh->nt);
     return(0);
   }
 
@@ -472,9 +472,9 @@ int MMGS_Get_triangle(MMG5_pMesh mesh, int* v0, int* v1, int* v2, int* ref
   return(1);
 }
 
-int  MMGS_Set_triangles(MMG5_pMesh mesh, int *tria, int *refs) {
+int  MMGS_Set_triangles(MMG5_pMesh mesh, MMG5_int *tria, int *refs) {
   MMG5_pTria ptt;
-  int         i, j;
+  MMG5_int    i,j;
 
    for (i=1;i<=mesh->nt;i++)
    {
@@ -494,9 +494,9 @@ int  MMGS_Set_triangles(MMG5_pMesh mesh, int *tria, int *refs) {
    return 1;
 }
 
-int  MMGS_Get_triangles(MMG5_pMesh mesh, int *tria, int *refs, int *areRequired) {
+int  MMGS_Get_triangles(MMG5_pMesh mesh, MMG5_int *tria, int *refs, int *areRequired) {
   MMG5_pTria ptt;
-  int         i, j;
+  MMG5_int    i,j;
 
    for (i=1;i<=mesh->nt;i++)
    {
@@ -520,7 +520,7 @@ int  MMGS_Get_triangles(MMG5_pMesh mesh, int *tria, int *refs, int *areRequired)
 }
 
 
-int MMGS_Set_edge(MMG5_pMesh mesh, int v0, int v1, int ref, int pos) {
+int MMGS_Set_edge(MMG5_pMesh mesh, MMG5_int v0, MMG5_int v1, int ref, MMG5_int pos) {
 
   if ( !mesh->na ) {
     fprintf(stderr,"\n  ## Error: %s: You must set the number of edges with the",
@@ -531,14 +531,14 @@ int MMGS_Set_edge(MMG5_pMesh mesh, int v0, int v1, int ref, int pos) {
   if ( pos > mesh->namax ) {
     fprintf(stderr,"\n  ## Error: %s: unable to allocate a new edge.\n",
             __func__);
-    fprintf(stderr,"    max number of edge: %d\n",mesh->namax);
+    fprintf(stderr,"    max number of edge: %" MMG5_PRId "\n",mesh->namax);
     _MMG5_INCREASE_MEM_MESSAGE();
     return(0);
   }
   if ( pos > mesh->na ) {
-    fprintf(stderr,"\n  ## Error: %s: attempt to set new edge at position %d.",
+    fprintf(stderr,"\n  ## Error: %s: attempt to set new edge at position %" MMG5_PRId ".",
             __func__,pos);
-    fprintf(stderr," Overflow of the given number of edges: %d\n",mesh->na);
+    fprintf(stderr," Overflow of the given number of edges: %" MMG5_PRId "\n",mesh->na);
     fprintf(stderr,"\n  ## Check the mesh size, its compactness or the position");
     fprintf(stderr," of the edge.\n");
     return(0);
@@ -552,7 +552,7 @@ int MMGS_Set_edge(MMG5_pMesh mesh, int v0, int v1, int ref, int pos) {
   return(1);
 }
 
-int MMGS_Get_edge(MMG5_pMesh mesh, int* e0, int* e1, int* ref
+int MMGS_Get_edge(MMG5_pMesh mesh, MMG5_int* e0, MMG5_int* e1, int* ref
                   ,int* isRidge, int* isRequired) {
 
   if ( mesh->nai == mesh->na ) {
@@ -563,7 +563,7 @@ int MMGS_Get_edge(MMG5_pMesh mesh, int* e0, int* e1, int* ref
       fprintf(stderr,"     You must pass here exactly one time (the first time ");
       fprintf(stderr,"you call the MMGS_Get_edge function).\n");
       fprintf(stderr,"     If not, the number of call of this function");
-      fprintf(stderr," exceed the number of edges: %d\n ",mesh->na);
+      fprintf(stderr," exceed the number of edges: %" MMG5_PRId "\n ",mesh->na);
     }
   }
 
@@ -572,7 +572,7 @@ int MMGS_Get_edge(MMG5_pMesh mesh, int* e0, int* e1, int* ref
   if ( mesh->nai > mesh->na ) {
     fprintf(stderr,"\n  ## Error: %s: unable to get edge.\n",__func__);
     fprintf(stderr,"    The number of call of MMGS_Get_edge function");
-    fprintf(stderr," can not exceed the number of edges: %d\n ",mesh->na);
+    fprintf(stderr," can not exceed the number of edges: %" MMG5_PRId "\n ",mesh->na);
     return(0);
   }
 
@@ -598,19 +598,19 @@ int MMGS_Get_edge(MMG5_pMesh mesh, int* e0, int* e1, int* ref
   return(1);
 }
 
-int MMGS_Set_corner(MMG5_pMesh mesh, int k) {
+int MMGS_Set_corner(MMG5_pMesh mesh, MMG5_int k) {
   assert ( k <= mesh->np );
   mesh->point[k].tag |= MG_CRN;
   return(1);
 }
 
-int MMGS_Set_requiredVertex(MMG5_pMesh mesh, int k) {
+int MMGS_Set_requiredVertex(MMG5_pMesh mesh, MMG5_int k) {
   assert ( k <= mesh->np );
   mesh->point[k].tag |= MG_REQ;
   return(1);
 }
 
-int MMGS_Set_requiredTriangle(MMG5_pMesh mesh, int k) {
+int MMGS_Set_requiredTriangle(MMG5_pMesh mesh, MMG5_int k) {
   assert ( k <= mesh->nt );
   mesh->tria[k].tag[0] |= MG_REQ;
   mesh->tria[k].tag[1] |= MG_REQ;
@@ -618,19 +618,19 @@ int MMGS_Set_requiredTriangle(MMG5_pMesh mesh, int k) {
   return(1);
 }
 
-int MMGS_Set_ridge(MMG5_pMesh mesh, int k) {
+int MMGS_Set_ridge(MMG5_pMesh mesh, MMG5_int k) {
   assert ( k <= mesh->na );
   mesh->edge[k].tag |= MG_GEO;
   return(1);
 }
 
-int MMGS_Set_requiredEdge(MMG5_pMesh mesh, int k) {
+int MMGS_Set_requiredEdge(MMG5_pMesh mesh, MMG5_int k) {
   assert ( k <= mesh->na );
   mesh->edge[k].tag |= MG_REQ;
   return(1);
 }
 
-int MMGS_Set_normalAtVertex(MMG5_pMesh mesh, int k, double n0, double n1, double n2) {
+int MMGS_Set_normalAtVertex(MMG5_pMesh mesh, MMG5_int k, double n0, double n1, double n2) {
 
   assert ( k <= mesh->np );
   mesh->point[k].n[0] = n0;
@@ -642,7 +642,7 @@ int MMGS_Set_normalAtVertex(MMG5_pMesh mesh, int k, double n0, double n1, double
   return(1);
 }
 
-int MMGS_Get_normalAtVertex(MMG5_pMesh mesh, int k, double *n0, double *n1, double *n2) {
+int MMGS_Get_normalAtVertex(MMG5_pMesh mesh, MMG5_int k, double *n0, double *n1, double *n2) {
 
   assert ( k <= mesh->np );
   (*n0) = mesh->point[k].n[0];
@@ -652,7 +652,7 @@ int MMGS_Get_normalAtVertex(MMG5_pMesh mesh, int k, double *n0, double *n1, doub
   return(1);
 }
 
-int MMGS_Set_scalarSol(MMG5_pSol met, double s, int pos) {
+int MMGS_Set_scalarSol(MMG5_pSol met, double s, MMG5_int pos) {
 
   if ( !met->np ) {
     fprintf(stderr,"\n  ## Error: %s: You must set the number of solution"
@@ -670,14 +670,14 @@ int MMGS_Set_scalarSol(MMG5_pSol met, double s, int pos) {
   if ( pos >= met->npmax ) {
     fprintf(stderr,"\n  ## Error: %s: unable to set a new solution.\n",
             __func__);
-    fprintf(stderr,"    max number of solutions: %d\n",met->npmax);
+    fprintf(stderr,"    max number of solutions: %" MMG5_PRId "\n",met->npmax);
     return(0);
   }
 
   if ( pos > met->np ) {
     fprintf(stderr,"\n  ## Error: %s: attempt to set new solution at"
-            " position %d.",__func__,pos);
-    fprintf(stderr," Overflow of the given number of solutions: %d\n",met->np);
+            " position %" MMG5_PRId ".",__func__,pos);
+    fprintf(stderr," Overflow of the given number of solutions: %" MMG5_PRId "\n",met->np);
     fprintf(stderr,"\n  ## Check the solution size, its compactness or the position");
     fprintf(stderr," of the solution.\n");
     return(0);
@@ -698,7 +698,7 @@ int MMGS_Get_scalarSol(MMG5_pSol met, double* s) {
       fprintf(stderr,"     You must pass here exactly one time (the first time ");
       fprintf(stderr,"you call the MMGS_Get_scalarSol function).\n");
       fprintf(stderr,"     If not, the number of call of this function");
-      fprintf(stderr," exceed the number of points: %d\n ",met->np);
+      fprintf(stderr," exceed the number of points: %" MMG5_PRId "\n ",met->np);
     }
   }
 
@@ -707,7 +707,7 @@ int MMGS_Get_scalarSol(MMG5_pSol met, double* s) {
   if ( met->npi > met->np ) {
     fprintf(stderr,"\n  ## Error: %s: unable to get solution.\n",__func__);
     fprintf(stderr,"     The number of call of MMGS_Get_scalarSol function");
-    fprintf(stderr," can not exceed the number of points: %d\n ",met->np);
+    fprintf(stderr," can not exceed the number of points: %" MMG5_PRId "\n ",met->np);
     return(0);
   }
 
@@ -717,7 +717,7 @@ int MMGS_Get_scalarSol(MMG5_pSol met, double* s) {
 }
 
 int MMGS_Set_scalarSols(MMG5_pSol met, double *s ) {
-  int k;
+  MMG5_int k;
 
   if ( !met->np ) {
     fprintf(stderr,"\n  ## Error: %s: You must set the number of solution"
@@ -734,7 +734,7 @@ int MMGS_Set_scalarSols(MMG5_pSol met, double *s ) {
 }
 
 int MMGS_Get_scalarSols(MMG5_pSol met, double* s) {
-  int k;
+  MMG5_int k;
 
   for ( k=0; k<met->np; ++k )
     s[k]  = met->m[k+1];
@@ -743,7 +743,7 @@ int MMGS_Get_scalarSols(MMG5_pSol met, double* s) {
 }
 
 
-int MMGS_Set_vectorSol(MMG5_pSol met, double vx,double vy, double vz, int pos) {
+int MMGS_Set_vectorSol(MMG5_pSol met, double vx,double vy, double vz, MMG5_int pos) {
 
   if ( !met->np ) {
     fprintf(stderr,"\n  ## Error: %s: You must set the number of"
@@ -761,14 +761,14 @@ int MMGS_Set_vectorSol(MMG5_pSol met, double vx,double vy, double vz, int pos) {
   if ( pos >= met->npmax ) {
     fprintf(stderr,"\n  ## Error: %s: unable to set a new solution.\n",
             __func__);
-    fprintf(stderr,"    max number of solutions: %d\n",met->npmax);
+    fprintf(stderr,"    max number of solutions: %" MMG5_PRId "\n",met->npmax);
     return(0);
   }
 
   if ( pos > met->np ) {
-    fprintf(stderr,"\n  ## Error: %s: attempt to set new solution at position %d.",
+    fprintf(stderr,"\n  ## Error: %s: attempt to set new solution at position %" MMG5_PRId ".",
             __func__,pos);
-    fprintf(stderr," Overflow of the given number of solutions: %d\n",met->np);
+    fprintf(stderr," Overflow of the given number of solutions: %" MMG5_PRId "\n",met->np);
     fprintf(stderr,"\n  ## Check the solution size, its compactness or the position");
     fprintf(stderr," of the solution.\n");
     return(0);
@@ -792,7 +792,7 @@ int MMGS_Get_vectorSol(MMG5_pSol met, double* vx, double* vy, double* vz) {
       fprintf(stderr,"     You must pass here exactly one time (the first time ");
       fprintf(stderr,"you call the MMGS_Get_vectorSol function).\n");
       fprintf(stderr,"     If not, the number of call of this function");
-      fprintf(stderr," exceed the number of points: %d\n ",met->np);
+      fprintf(stderr," exceed the number of points: %" MMG5_PRId "\n ",met->np);
     }
   }
 
@@ -801,7 +801,7 @@ int MMGS_Get_vectorSol(MMG5_pSol met, double* vx, double* vy, double* vz) {
   if ( met->npi > met->np ) {
     fprintf(stderr,"\n  ## Error: %s: unable to get solution.\n",__func__);
     fprintf(stderr,"     The number of call of MMGS_Get_vectorSol function");
-    fprintf(stderr," can not exceed the number of points: %d\n ",met->np);
+    fprintf(stderr," can not exceed the number of points: %" MMG5_PRId "\n ",met->np);
     return(0);
   }
 
@@ -815,7 +815,7 @@ int MMGS_Get_vectorSol(MMG5_pSol met, double* vx, double* vy, double* vz) {
 
 int MMGS_Set_vectorSols(MMG5_pSol met, double *sols) {
   double *m;
-  int k,j;
+  MMG5_int k,j;
 
   if ( !met->np ) {
     fprintf(stderr,"\n  ## Error: %s: You must set the number of"
@@ -838,7 +838,7 @@ int MMGS_Set_vectorSols(MMG5_pSol met, double *sols) {
 
 int MMGS_Get_vectorSols(MMG5_pSol met, double* sols) {
   double *m;
-  int k, j;
+  MMG5_int k,j;
 
   for ( k=0; k<met->np; ++k ) {
     j = 3*k;
@@ -852,7 +852,7 @@ int MMGS_Get_vectorSols(MMG5_pSol met, double* sols) {
 }
 
 int MMGS_Set_tensorSol(MMG5_pSol met, double m11,double m12, double m13,
-                       double m22,double m23, double m33, int pos) {
+                       double m22,double m23, double m33, MMG5_int pos) {
 
   if ( !met->np ) {
     fprintf(stderr,"\n  ## Error: %s: You must set the number of"
@@ -870,14 +870,14 @@ int MMGS_Set_tensorSol(MMG5_pSol met, double m11,double m12, double m13,
   if ( pos >= met->npmax ) {
     fprintf(stderr,"\n  ## Error: %s: unable to set a new solution.\n",
             __func__);
-    fprintf(stderr,"    max number of solutions: %d\n",met->npmax);
+    fprintf(stderr,"    max number of solutions: %" MMG5_PRId "\n",met->npmax);
     return(0);
   }
 
   if ( pos > met->np ) {
     fprintf(stderr,"\n  ## Error: %s: attempt to set new solution"
-            " at position %d.",__func__,pos);
-    fprintf(stderr," Overflow of the given number of solutions: %d\n",met->np);
+            " at position %" MMG5_PRId ".",__func__,pos);
+    fprintf(stderr," Overflow of the given number of solutions: %" MMG5_PRId "\n",met->np);
     fprintf(stderr,"\n  ## Check the solution size, its compactness or the position");
     fprintf(stderr," of the solution.\n");
     return(0);
@@ -906,7 +906,7 @@ int MMGS_Get_tensorSol(MMG5_pSol met, double *m11,double *m12, double *m13,
       fprintf(stderr,"     You must pass here exactly one time (the first time ");
       fprintf(stderr,"you call the MMGS_Get_tensorSol function).\n");
       fprintf(stderr,"     If not, the number of call of this function");
-      fprintf(stderr," exceed the number of points: %d\n ",met->np);
+      fprintf(stderr," exceed the number of points: %" MMG5_PRId "\n ",met->np);
     }
   }
 
@@ -915,7 +915,7 @@ int MMGS_Get_tensorSol(MMG5_pSol met, double *m11,double *m12, double *m13,
   if ( met->npi > met->np ) {
     fprintf(stderr,"\n  ## Error: %s: unable to get solution.\n",__func__);
     fprintf(stderr,"     The number of call of MMGS_Get_tensorSol function");
-    fprintf(stderr," can not exceed the number of points: %d\n ",met->np);
+    fprintf(stderr," can not exceed the number of points: %" MMG5_PRId "\n ",met->np);
     return(0);
   }
 
@@ -932,7 +932,7 @@ int MMGS_Get_tensorSol(MMG5_pSol met, double *m11,double *m12, double *m13,
 
 int MMGS_Set_tensorSols(MMG5_pSol met, double *sols) {
   double *m;
-  int k,j;
+  MMG5_int k,j;
 
   if ( !met->np ) {
     fprintf(stderr,"\n  ## Error: %s: You must set the number"
@@ -958,7 +958,7 @@ int MMGS_Set_tensorSols(MMG5_pSol met, double *sols) {
 
 int MMGS_Get_tensorSols(MMG5_pSol met, double *sols) {
   double *m;
-  int k,j;
+  MMG5_int k,j;
 
   for ( k=0; k<met->np; ++k ) {
     j = 6*k;
@@ -1098,11 +1098,9 @@ int MMGS_Set_iparameter(MMG5_pMesh mesh, MMG5_pSol sol, int iparam, int val){
     }
 
     break;
-#ifdef USE_SCOTCH
   case MMGS_IPARAM_renum :
     mesh->info.renum    = val;
     break;
-#endif
   default :
     fprintf(stderr,"\n  ## Error: %s: unknown type of parameter\n",__func__);
     return(0);
@@ -1148,11 +1146,9 @@ int MMGS_Get_iparameter(MMG5_pMesh mesh, int iparam) {
   case MMGS_IPARAM_numberOfLocalParam :
     return ( mesh->info.npar );
     break;
-#ifdef USE_SCOTCH
   case MMGS_IPARAM_renum :
     return ( mesh->info.renum );
     break;
-#endif
   default :
     fprintf(stderr,"\n  ## Error: %s: unknown type of parameter\n",__func__);
     return 0;
@@ -139,7 +139,7 @@ FORTRAN_NAME(MMGS_SET_OUTPUTSOLNAME,mmgs_set_outputsolname,
  */
 FORTRAN_NAME(MMGS_SET_SOLSIZE,mmgs_set_solsize,
              (MMG5_pMesh *mesh, MMG5_pSol *sol, int* typEntity,
-              int* np, int* typSol, int* retval),
+              MMG5_int* np, int* typSol, int* retval),
              (mesh, sol, typEntity, np, typSol, retval)) {
   *retval = MMGS_Set_solSize(*mesh,*sol,*typEntity,*np,*typSol);
   return;
@@ -149,7 +149,7 @@ FORTRAN_NAME(MMGS_SET_SOLSIZE,mmgs_set_solsize,
  * See \ref MMGS_Set_meshSize function in \ref mmgs/libmmgs.h file.
  */
 FORTRAN_NAME(MMGS_SET_MESHSIZE,mmgs_set_meshsize,
-             (MMG5_pMesh *mesh, int *np, int *nt, int *na, int *retval),
+             (MMG5_pMesh *mesh, MMG5_int *np, MMG5_int *nt, MMG5_int *na, int *retval),
              (mesh,np,nt,na,retval)) {
   *retval = MMGS_Set_meshSize(*mesh,*np,*nt,*na);
   return;
@@ -159,7 +159,7 @@ FORTRAN_NAME(MMGS_SET_MESHSIZE,mmgs_set_meshsize,
  * See \ref MMGS_Get_solSize function in \ref mmgs/libmmgs.h file.
  */
 FORTRAN_NAME(MMGS_GET_SOLSIZE,mmgs_get_solsize,
-             (MMG5_pMesh *mesh, MMG5_pSol *sol, int* typEntity, int* np, int* typSol, int* retval),
+             (MMG5_pMesh *mesh, MMG5_pSol *sol, int* typEntity, MMG5_int* np, int* typSol, int* retval),
              (mesh,sol,typEntity,np,typSol,retval)) {
 
   *retval = MMGS_Get_solSize(*mesh,*sol,typEntity,np,typSol);
@@ -170,7 +170,7 @@ FORTRAN_NAME(MMGS_GET_SOLSIZE,mmgs_get_solsize,
  * See \ref MMGS_Get_meshSize function in \ref mmgs/libmmgs.h file.
  */
 FORTRAN_NAME(MMGS_GET_MESHSIZE,mmgs_get_meshsize,
-             (MMG5_pMesh *mesh, int* np, int* nt, int* na, int* retval),
+             (MMG5_pMesh *mesh, MMG5_int* np, MMG5_int* nt, MMG5_int* na, int* retval),
              (mesh,np,nt, na,retval)) {
 
   *retval = MMGS_Get_meshSize(*mesh,np,nt,na);
@@ -182,7 +182,7 @@ FORTRAN_NAME(MMGS_GET_MESHSIZE,mmgs_get_meshsize,
  */
 FORTRAN_NAME(MMGS_SET_VERTEX,mmgs_set_vertex,
              (MMG5_pMesh *mesh, double* c0, double* c1, double* c2, int* ref,
-              int* pos, int* retval),
+              MMG5_int* pos, int* retval),
              (mesh,c0,c1,c2,ref,pos,retval)) {
 
   *retval = MMGS_Set_vertex(*mesh,*c0,*c1,*c2,*ref,*pos);
@@ -224,7 +224,7 @@ FORTRAN_NAME(MMGS_GET_VERTICES,mmgs_get_vertices,
  * See \ref MMGS_Set_triangle function in \ref mmgs/libmmgs.h file.
  */
 FORTRAN_NAME(MMGS_SET_TRIANGLE,mmgs_set_triangle,
-             (MMG5_pMesh *mesh, int* v0, int* v1, int* v2, int* ref,int* pos,
+             (MMG5_pMesh *mesh, MMG5_int* v0, MMG5_int* v1, MMG5_int* v2, int* ref,MMG5_int* pos,
               int* retval),
              (mesh,v0,v1,v2,ref,pos,retval)) {
   *retval = MMGS_Set_triangle(*mesh, *v0, *v1, *v2, *ref, *pos);
@@ -235,7 +235,7 @@ FORTRAN_NAME(MMGS_SET_TRIANGLE,mmgs_set_triangle,
  * See \ref MMGS_Get_triangle function in \ref mmgs/libmmgs.h file.
  */
 FORTRAN_NAME(MMGS_GET_TRIANGLE,mmgs_get_triangle,
-             (MMG5_pMesh *mesh, int* v0, int* v1, int* v2, int* ref
+             (MMG5_pMesh *mesh, MMG5_int* v0, MMG5_int* v1, MMG5_int* v2, int* ref
               ,int* isRequired, int* retval),
              (mesh,v0,v1,v2,ref,isRequired,retval)) {
   *retval = MMGS_Get_triangle(*mesh,v0,v1,v2,ref,isRequired);
@@ -245,7 +245,7 @@ FORTRAN_NAME(MMGS_GET_TRIANGLE,mmgs_get_triangle,
  * See \ref MMGS_Set_triangles function in \ref mmgs/libmmgs.h file.
  */
 FORTRAN_NAME(MMGS_SET_TRIANGLES,mmgs_set_triangles,
-             (MMG5_pMesh *mesh, int* tria, int* refs,
+             (MMG5_pMesh *mesh, MMG5_int* tria, int* refs,
               int* retval),
              (mesh,tria,refs,retval)) {
   *retval = MMGS_Set_triangles(*mesh, tria, refs);
@@ -256,7 +256,7 @@ FORTRAN_NAME(MMGS_SET_TRIANGLES,mmgs_set_triangles,
  * See \ref MMGS_Get_triangles function in \ref mmgs/libmmgs.h file.
  */
 FORTRAN_NAME(MMGS_GET_TRIANGLES,mmgs_get_triangles,
-             (MMG5_pMesh *mesh, int* tria, int* refs,int* areRequired,
+             (MMG5_pMesh *mesh, MMG5_int* tria, int* refs,int* areRequired,
               int* retval),
              (mesh,tria,refs,areRequired,retval)) {
   *retval = MMGS_Get_triangles(*mesh,tria,refs,areRequired);
@@ -267,7 +267,7 @@ FORTRAN_NAME(MMGS_GET_TRIANGLES,mmgs_get_triangles,
  * See \ref MMGS_Set_edge function in \ref mmgs/libmmgs.h file.
  */
 FORTRAN_NAME(MMGS_SET_EDGE,mmgs_set_edge,
-             (MMG5_pMesh *mesh, int *v0, int *v1, int *ref, int *pos, int* retval),
+             (MMG5_pMesh *mesh, MMG5_int *v0, MMG5_int *v1, int *ref, MMG5_int *pos, int* retval),
              (mesh,v0,v1,ref,pos,retval)){
   *retval = MMGS_Set_edge(*mesh,*v0,*v1,*ref,*pos);
   return;
@@ -276,7 +276,7 @@ FORTRAN_NAME(MMGS_SET_EDGE,mmgs_set_edge,
 /**
  * See \ref MMGS_Get_edge function in \ref mmgs/libmmgs.h file.
  */
-FORTRAN_NAME(MMGS_GET_EDGE,mmgs_get_edge,(MMG5_pMesh *mesh, int* e0, int* e1, int* ref
+FORTRAN_NAME(MMGS_GET_EDGE,mmgs_get_edge,(MMG5_pMesh *mesh, MMG5_int* e0, MMG5_int* e1, int* ref
                                           ,int* isRidge, int* isRequired, int* retval),
              (mesh,e0,e1,ref,isRidge,isRequired,retval)) {
   *retval = MMGS_Get_edge(*mesh,e0,e1,ref,isRidge,isRequired);
@@ -286,7 +286,7 @@ FORTRAN_NAME(MMGS_GET_EDGE,mmgs_get_edge,(MMG5_pMesh *mesh, int* e0, int* e1, in
 /**
  * See \ref MMGS_Set_corner function in \ref mmgs/libmmgs.h file.
  */
-FORTRAN_NAME(MMGS_SET_CORNER,mmgs_set_corner,(MMG5_pMesh *mesh, int *k, int* retval),
+FORTRAN_NAME(MMGS_SET_CORNER,mmgs_set_corner,(MMG5_pMesh *mesh, MMG5_int *k, int* retval),
              (mesh,k,retval)) {
   *retval =  MMGS_Set_corner(*mesh,*k);
   return;
@@ -296,7 +296,7 @@ FORTRAN_NAME(MMGS_SET_CORNER,mmgs_set_corner,(MMG5_pMesh *mesh, int *k, int* ret
  * See \ref MMGS_Set_requiredVertex function in \ref mmgs/libmmgs.h file.
  */
 FORTRAN_NAME(MMGS_SET_REQUIREDVERTEX,mmgs_set_requiredvertex,
-             (MMG5_pMesh *mesh, int *k, int* retval),
+             (MMG5_pMesh *mesh, MMG5_int *k, int* retval),
              (mesh,k,retval)) {
   *retval =  MMGS_Set_requiredVertex(*mesh,*k);
   return;
@@ -305,7 +305,7 @@ FORTRAN_NAME(MMGS_SET_REQUIREDVERTEX,mmgs_set_requiredvertex,
  * See \ref MMGS_Set_requiredTriangle function in \ref mmgs/libmmgs.h file.
  */
 FORTRAN_NAME(MMGS_SET_REQUIREDTRIANGLE,mmgs_set_requiredtriangle,
-             (MMG5_pMesh *mesh, int *k, int* retval),
+             (MMG5_pMesh *mesh, MMG5_int *k, int* retval),
              (mesh,k,retval)) {
   *retval = MMGS_Set_requiredTriangle(*mesh, *k);
   return;
@@ -315,7 +315,7 @@ FORTRAN_NAME(MMGS_SET_REQUIREDTRIANGLE,mmgs_set_requiredtriangle,
  * See \ref MMGS_Set_ridge function in \ref mmgs/libmmgs.h file.
  */
 FORTRAN_NAME(MMGS_SET_RIDGE,mmgs_set_ridge,
-             (MMG5_pMesh *mesh, int *k, int* retval),
+             (MMG5_pMesh *mesh, MMG5_int *k, int* retval),
              (mesh,k,retval)) {
   *retval = MMGS_Set_ridge(*mesh,*k);
   return;
@@ -325,7 +325,7 @@ FORTRAN_NAME(MMGS_SET_RIDGE,mmgs_set_ridge,
  * See \ref MMGS_Set_requiredEdge function in \ref mmgs/libmmgs.h file.
  */
 FORTRAN_NAME(MMGS_SET_REQUIREDEDGE,mmgs_set_requirededge,
-             (MMG5_pMesh *mesh, int *k, int* retval),
+             (MMG5_pMesh *mesh, MMG5_int *k, int* retval),
              (mesh,k,retval)) {
   *retval = MMGS_Set_requiredEdge(*mesh,*k);
   return;
@@ -335,7 +335,7 @@ FORTRAN_NAME(MMGS_SET_REQUIREDEDGE,mmgs_set_requirededge,
  * See \ref MMGS_Set_normalAtVertex function in \ref mmgs/libmmgs.h file.
  */
 FORTRAN_NAME(MMGS_SET_NORMALATVERTEX,mmgs_set_normalatvertex,
-             (MMG5_pMesh *mesh, int *k, double* n0, double* n1, double* n2,int* retval),
+             (MMG5_pMesh *mesh, MMG5_int *k, double* n0, double* n1, double* n2,int* retval),
              (mesh,k,n0,n1,n2,retval)) {
   *retval = MMGS_Set_normalAtVertex(*mesh,*k, *n0, *n1, *n2);
   return;
@@ -344,7 +344,7 @@ FORTRAN_NAME(MMGS_SET_NORMALATVERTEX,mmgs_set_normalatvertex,
  * See \ref MMGS_Get_normalAtVertex function in \ref mmgs/libmmgs.h file.
  */
 FORTRAN_NAME(MMGS_GET_NORMALATVERTEX,mmgs_get_normalatvertex,
-             (MMG5_pMesh *mesh, int *k, double* n0, double* n1, double* n2,int* retval),
+             (MMG5_pMesh *mesh, MMG5_int *k, double* n0, double* n1, double* n2,int* retval),
              (mesh,k,n0,n1,n2,retval)) {
   *retval = MMGS_Get_normalAtVertex(*mesh,*k, n0, n1, n2);
   return;
@@ -354,7 +354,7 @@ FORTRAN_NAME(MMGS_GET_NORMALATVERTEX,mmgs_get_normalatvertex,
  * See \ref MMGS_Set_scalarSol function in \ref mmgs/libmmgs.h file.
  */
 FORTRAN_NAME(MMGS_SET_SCALARSOL,mmgs_set_scalarsol,
-             (MMG5_pSol *met, double *s, int *pos, int* retval),
+             (MMG5_pSol *met, double *s, MMG5_int *pos, int* retval),
              (met,s,pos,retval)) {
   *retval = MMGS_Set_scalarSol(*met,*s,*pos);
   return;
@@ -394,7 +394,7 @@ FORTRAN_NAME(MMGS_GET_SCALARSOLS,mmgs_get_scalarsols,
  */
 FORTRAN_NAME(MMGS_SET_VECTORSOL,mmgs_set_vectorsol,
              (MMG5_pSol *met, double *vx, double *vy, double *vz,
-              int *pos, int* retval),
+              MMG5_int *pos, int* retval),
              (met,vx,vy,vz,pos,retval)) {
   *retval = MMGS_Set_vectorSol(*met,*vx,*vy,*vz,*pos);
   return;
@@ -434,7 +434,7 @@ FORTRAN_NAME(MMGS_GET_VECTORSOLS,mmgs_get_vectorsols,
  */
 FORTRAN_NAME(MMGS_SET_TENSORSOL,mmgs_set_tensorsol,
              (MMG5_pSol *met, double* m11,double *m12, double *m13,
-              double* m22,double *m23, double *m33, int *pos, int* retval),
+              double* m22,double *m23, double *m33, MMG5_int *pos, int* retval),
              (met,m11,m12,m13,m22,m23,m33,pos,retval)) {
   *retval = MMGS_Set_tensorSol(*met,*m11,*m12,*m13,*m22,*m23,*m33,*pos);
   return;
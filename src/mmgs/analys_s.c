@@ -45,8 +45,10 @@
  */
 static int setadj(MMG5_pMesh mesh){
   MMG5_pTria   pt,pt1;
-  int          *adja,*adjb,adji1,adji2,*pile,iad,ipil,ip1,ip2,gen;
-  int          k,kk,iel,jel,nvf,nf,nr,nt,nre,nreq,ncc,ned,ref;
+  int          ipil,gen;
+  MMG5_int     *adja,*adjb,adji1,adji2,*pile,iad,ip1,ip2;
+  int          nvf,nf,nr,nt,nre,nreq,ncc,ned,ref;
+  MMG5_int     k,kk,iel,jel;
   int16_t      tag;
   char         i,ii,i1,i2,ii1,ii2,voy;
 
@@ -55,7 +57,7 @@ static int setadj(MMG5_pMesh mesh){
 
   nvf = nf = ncc = ned = 0;
 
-  _MMG5_SAFE_MALLOC(pile,mesh->nt+1,int,0);
+  _MMG5_SAFE_MALLOC(pile,mesh->nt+1,MMG5_int,0);
 
   pile[1] = 1;
   ipil    = 1;
@@ -235,7 +237,8 @@ static int setadj(MMG5_pMesh mesh){
 static void nmpoints(MMG5_pMesh mesh) {
   MMG5_pTria      pt;
   MMG5_pPoint     p0;
-  int        k,np,numt,iel,jel,nmp,*adja;
+  int        nmp;
+  MMG5_int   k,np,jel,*adja,iel,numt;
   char       i0,i1,i,jp;
   
   nmp = 0;
@@ -338,7 +341,7 @@ static void nmpoints(MMG5_pMesh mesh) {
 /*       pt = &mesh->tria[k]; */
 /*       if ( !MG_EOK(pt) )  continue; */
 
-/*       kal = _MMG5_calelt(mesh,NULL,pt); */
+/*       kal = mesh->func.caltri(mesh,NULL,pt); */
 /*       if ( kal > declic )  continue; */
 
 /*       p[0] = &mesh->point[pt->v[0]]; */
@@ -417,7 +420,8 @@ static void nmpoints(MMG5_pMesh mesh) {
 static int setdhd(MMG5_pMesh mesh) {
   MMG5_pTria    pt,pt1;
   double   n1[3],n2[3],dhd;
-  int     *adja,k,kk,nr;
+  int     nr;
+  MMG5_int k,*adja,kk;
   char     i,ii,i1,i2;
 
   nr = 0;
@@ -462,7 +466,8 @@ static int _MMG5_singul(MMG5_pMesh mesh) {
   MMG5_pTria     pt;
   MMG5_pPoint    ppt,p1,p2;
   double         ux,uy,uz,vx,vy,vz,dd;
-  int            list[_MMGS_LMAX+2],listref[_MMGS_LMAX+2],k,nc,xp,nr,ns,nre;
+  int            listref[_MMGS_LMAX+2],nc,xp,nr,ns,nre;
+  MMG5_int       k,list[_MMGS_LMAX+2];
   char           i;
 
   nre = nc = 0;
@@ -553,7 +558,8 @@ static int norver(MMG5_pMesh mesh) {
   MMG5_pPoint    ppt;
   MMG5_pxPoint   go;
   double         n[3],dd;
-  int            *adja,k,kk,ier,xp,nn,nt,nf,nnr;
+  int            ier,xp,nn,nt,nf,nnr;
+  MMG5_int       k,*adja,kk;
   char           i,ii,i1;
 
   if ( abs(mesh->info.imprim) > 4 || mesh->info.ddebug )
@@ -689,7 +695,8 @@ static int regnor(MMG5_pMesh mesh) {
   MMG5_pTria    pt;
   MMG5_pPoint   ppt,p0;
   double  *tabl,n[3],lm1,lm2,dd,nx,ny,nz,res0,res;
-  int      i,k,iad,it,nn,nit,iel,ilist,list[_MMGS_LMAX];
+  int      i,it,nn,nit,ilist;
+  MMG5_int k,iad,iel,list[_MMGS_LMAX];
 
   /* assign seed to vertex */
   for (k=1; k<=mesh->nt; k++) {
@@ -45,16 +45,17 @@
  * Compute movement of an internal point whose ball is passed.
  *
  */
-int movintpt_ani(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist) {
+int movintpt_ani(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int *list,int ilist) {
   MMG5_pTria     pt,pt0;
   MMG5_pPoint    p0,p1,ppt0;
   _MMG5_Bezier   pb;
   double         r[3][3],ux,uy,uz,*n,area,lispoi[3*_MMGS_LMAX+1],*m0;//,m[6],mo[6];
   double         gv[2],detloc,step,lambda[3],o[3],no[3],to[3],uv[2];
   double         calold,calnew,caltmp;
-  int            k,iel,kel,nump,nbeg,nend;
+  int            k,kel;
+  MMG5_int       nump,nbeg,nend,iel;
   char           i0,i1,i2,ier;
-  static int     warn=0;
+  static _MMG5_TLS int     warn=0;
   step = 0.1;
 
   /* Make sure ball of point is closed */
@@ -119,7 +120,7 @@ int movintpt_ani(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist) {
   for (k=0; k<ilist; k++) {
     iel = list[k] / 3;
     pt = &mesh->tria[iel];
-    if ( !_MMG5_bezierCP(mesh,pt,&pb,1) )  return(0);
+    if ( !mesh->func.bezierCP(mesh,pt,&pb,1) )  return(0);
 
     /* Compute integral of sqrt(T^J(xi)  M(P(xi)) J(xi)) * P(xi) over the triangle */
     if ( !_MMG5_elementWeight(mesh,met,pt,p0,&pb,r,gv) ) {
@@ -186,7 +187,7 @@ int movintpt_ani(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist) {
   i0  = list[kel] % 3;
   pt  = &mesh->tria[iel];
 
-  ier = _MMG5_bezierCP(mesh,pt,&pb,1);
+  ier = mesh->func.bezierCP(mesh,pt,&pb,1);
   assert(ier);
 
   /* Now, for Bezier interpolation, one should identify which of i,i1,i2 is 0,1,2
@@ -261,7 +262,7 @@ int movintpt_ani(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist) {
 }
 
 /* Compute movement of a ref, or ridge point whose ball is passed */
-int movridpt_ani(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist) {
+int movridpt_ani(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int *list,int ilist) {
   MMG5_pTria    pt,pt0;
   MMG5_pPoint   p0,p1,p2,ppt0;
   MMG5_pxPoint  go;
@@ -269,9 +270,10 @@ int movridpt_ani(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist) {
   double       *m0,*m00,step,l1old,l2old,ll1old,ll2old,uv[2],o[3],nn1[3],nn2[3],to[3],mo[6];
   double        lam0,lam1,lam2,*no1,*no2,*np1,*np2;
   double        psn11,psn12,ps2,l1new,l2new,dd1,dd2,ddt,calold,calnew;
-  int           it1,it2,ip0,ip1,ip2,k,iel,ier;
+  int           k,ier;
+  MMG5_int      ip0,ip1,ip2,iel,it1,it2;
   char          voy1,voy2,isrid,isrid1,isrid2,i0,i1,i2;
-  static char   mmgWarn0 = 0;
+  static _MMG5_TLS char   mmgWarn0 = 0;
 
   step  = 0.2;
   isrid1 = isrid2 = 0;
@@ -349,8 +351,8 @@ int movridpt_ani(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist) {
   p2  = &mesh->point[ip2];
   m0  = &met->m[6*ip0];
 
-  l1old = _MMG5_lenSurfEdg(mesh,met,ip0,ip1,1);
-  l2old = _MMG5_lenSurfEdg(mesh,met,ip0,ip2,1);
+  l1old = mesh->func.lenSurfEdg(mesh,met,ip0,ip1,1);
+  l2old = mesh->func.lenSurfEdg(mesh,met,ip0,ip2,1);
 
   if ( (!l1old) || (!l2old) ) return 0;
 
@@ -363,7 +365,7 @@ int movridpt_ani(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist) {
     isrid = isrid2;
     pt = &mesh->tria[it2];
 
-    ier = _MMG5_bezierCP(mesh,pt,&b,1);
+    ier = mesh->func.bezierCP(mesh,pt,&b,1);
     assert(ier);
 
     /* fill table uv */
@@ -405,7 +407,7 @@ int movridpt_ani(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist) {
     isrid = isrid1;
     pt = &mesh->tria[it1];
 
-    ier = _MMG5_bezierCP(mesh,pt,&b,1);
+    ier = mesh->func.bezierCP(mesh,pt,&b,1);
     assert(ier);
 
     /* fill table uv */
@@ -813,8 +815,8 @@ int movridpt_ani(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist) {
   memcpy(m00,mo,6*sizeof(double));
 
   /* Check whether proposed move is admissible under consideration of distances */
-  l1new = _MMG5_lenSurfEdg(mesh,met,0,ip1,1);
-  l2new = _MMG5_lenSurfEdg(mesh,met,0,ip2,1);
+  l1new = mesh->func.lenSurfEdg(mesh,met,0,ip1,1);
+  l2new = mesh->func.lenSurfEdg(mesh,met,0,ip2,1);
 
   if ( (!l1new) || (!l2new) ) return 0;
 
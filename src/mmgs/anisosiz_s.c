@@ -48,14 +48,15 @@
  * size.
  *
  */
-static int _MMG5_defmetsin(MMG5_pMesh mesh,MMG5_pSol met,int it,int ip) {
+static int _MMG5_defmetsin(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int it,int ip) {
   MMG5_pTria         pt;
   MMG5_pPoint        p0;
   MMG5_pPar          par;
   double             *m,n[3],isqhmin,isqhmax,b0[3],b1[3],ps1,tau[3];
   double             ntau2,gammasec[3];
   double             c[3],kappa,maxkappa,alpha,hausd,hausd_v;
-  int                ilist,list[_MMGS_LMAX+2],k,i,iel,idp,isloc,init_s;
+  int                ilist,k,i,isloc,init_s;
+  MMG5_int           idp,list[_MMGS_LMAX+2],iel;
   unsigned char      i0,i1,i2;
 
   pt  = &mesh->tria[it];
@@ -180,18 +181,20 @@ static int _MMG5_defmetsin(MMG5_pMesh mesh,MMG5_pSol met,int it,int ip) {
  * and at each time, metric tensor has to be recomputed, depending on the side.
  *
  */
-static int _MMG5_defmetrid(MMG5_pMesh mesh,MMG5_pSol met,int it,int ip) {
+static int _MMG5_defmetrid(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int it,int ip) {
   MMG5_pTria     pt;
   MMG5_pPoint    p0,p1,p2;
   _MMG5_Bezier   b;
   MMG5_pPar      par;
-  int            k,iel,idp,ilist1,ilist2,ilist,*list,list1[_MMGS_LMAX+2];
-  int            list2[_MMGS_LMAX+2],iprid[2],ier,isloc;
+  int            k,ilist1,ilist2,ilist;
+  MMG5_int       idp,iel,list1[_MMGS_LMAX+2],*list;
+  int            ier,isloc;
+  MMG5_int       iprid[2],list2[_MMGS_LMAX+2];
   double         *m,isqhmin,isqhmax,*n1,*n2,*n,*t,trot[2],u[2];
   double         r[3][3],lispoi[3*_MMGS_LMAX+1],ux,uy,uz,det,bcu[3];
   double         detg,detd;
   unsigned char  i,i0,i1,i2;
-  static char    mmgWarn0=0;
+  static _MMG5_TLS char    mmgWarn0=0;
 
   pt  = &mesh->tria[it];
   idp = pt->v[ip];
@@ -323,7 +326,7 @@ static int _MMG5_defmetrid(MMG5_pMesh mesh,MMG5_pSol met,int it,int ip) {
     iel = list[k] / 3;
     i0  = list[k] % 3;
     pt = &mesh->tria[iel];
-    if ( !_MMG5_bezierCP(mesh,pt,&b,1) )  continue;
+    if ( !mesh->func.bezierCP(mesh,pt,&b,1) )  continue;
 
     /* Barycentric coordinates of vector u in tria iel */
     detg = lispoi[3*k+1]*u[1] - lispoi[3*k+2]*u[0];
@@ -358,17 +361,18 @@ static int _MMG5_defmetrid(MMG5_pMesh mesh,MMG5_pSol met,int it,int ip) {
  * geometric approx of the surface.
  *
  */
-static int _MMG5_defmetref(MMG5_pMesh mesh,MMG5_pSol met,int it,int ip) {
+static int _MMG5_defmetref(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int it,int ip) {
   MMG5_pTria         pt;
   MMG5_pPoint        p0,p1;
   _MMG5_Bezier       b;
   MMG5_pPar          par;
-  int                i,ilist,list[_MMGS_LMAX+2],k,iel,ipref[2],idp,isloc;
+  int                i,ilist,k,isloc;
+  MMG5_int           ipref[2],idp,list[_MMGS_LMAX+2],iel;
   double             *m,isqhmin,isqhmax,*n,r[3][3],lispoi[3*_MMGS_LMAX+1];
   double             ux,uy,uz,det2d,intm[3],c[3];
   double             tAA[6],tAb[3],hausd;
   unsigned char      i0,i1,i2;
-  static char        mmgWarn0=0;
+  static _MMG5_TLS char        mmgWarn0=0;
 
   ipref[0] = ipref[1] = 0;
   pt  = &mesh->tria[it];
@@ -494,7 +498,7 @@ static int _MMG5_defmetref(MMG5_pMesh mesh,MMG5_pSol met,int it,int ip) {
     iel = list[k] / 3;
     i0  = list[k] % 3;
     pt = &mesh->tria[iel];
-    _MMG5_bezierCP(mesh,pt,&b,1);
+    mesh->func.bezierCP(mesh,pt,&b,1);
 
 
     /* 1. Fill matrice tAA and second member tAb with A=(\sum X_{P_i}^2 \sum
@@ -544,12 +548,13 @@ static int _MMG5_defmetref(MMG5_pMesh mesh,MMG5_pSol met,int it,int ip) {
  * the geometric approx of the surface.
  *
  */
-static int _MMG5_defmetreg(MMG5_pMesh mesh,MMG5_pSol met,int it,int ip) {
+static int _MMG5_defmetreg(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int it,int ip) {
   MMG5_pTria          pt;
   MMG5_pPoint         p0,p1;
   _MMG5_Bezier        b;
   MMG5_pPar           par;
-  int                 ilist,list[_MMGS_LMAX+2],k,iel,idp,isloc,i;
+  int                 ilist,k,isloc,i;
+  MMG5_int            idp,list[_MMGS_LMAX+2],iel;
   double              *n,*m,r[3][3],ux,uy,uz,lispoi[3*_MMGS_LMAX+1];
   double              det2d,c[3],isqhmin,isqhmax;
   double              tAA[6],tAb[3],hausd;
@@ -639,7 +644,7 @@ static int _MMG5_defmetreg(MMG5_pMesh mesh,MMG5_pSol met,int it,int ip) {
     iel = list[k] / 3;
     i0  = list[k] % 3;
     pt = &mesh->tria[iel];
-    _MMG5_bezierCP(mesh,pt,&b,1);
+    mesh->func.bezierCP(mesh,pt,&b,1);
 
     /* 1. Fill matrice tAA and second member tAb with A=(\sum X_{P_i}^2 \sum
      * Y_{P_i}^2 \sum X_{P_i}Y_{P_i}) and b=\sum Z_{P_i} with P_i the physical
@@ -692,7 +697,7 @@ static int _MMG5_defmetreg(MMG5_pMesh mesh,MMG5_pSol met,int it,int ip) {
  *
  */
 static inline
-int _MMGS_intextmet(MMG5_pMesh mesh,MMG5_pSol met,int np,double me[6]) {
+int _MMGS_intextmet(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int np,double me[6]) {
   MMG5_pPoint         p0;
   double              *n;
   double              dummy_n[3];
@@ -725,9 +730,9 @@ int _MMGS_defsiz_ani(MMG5_pMesh mesh,MMG5_pSol met) {
   MMG5_pTria    pt;
   MMG5_pPoint   ppt;
   double        mm[6];
-  int           k;
+  MMG5_int      k;
   char          i,ismet;
-  static char   mmgErr=0;
+  static _MMG5_TLS char   mmgErr=0;
 
   if ( abs(mesh->info.imprim) > 5 || mesh->info.ddebug )
     fprintf(stdout,"  ** Defining anisotropic map\n");
@@ -746,8 +751,8 @@ int _MMGS_defsiz_ani(MMG5_pMesh mesh,MMG5_pSol met) {
   else {
     ismet = 0;
 
-     _MMG5_calelt     = _MMG5_caltri_ani;
-     _MMG5_lenSurfEdg = _MMG5_lenSurfEdg_ani;
+     mesh->func.caltri     = _MMG5_caltri_ani;
+     mesh->func.lenSurfEdg = _MMG5_lenSurfEdg_ani;
 
      if ( !MMGS_Set_solSize(mesh,met,MMG5_Vertex,mesh->np,3) )
        return 0;
@@ -784,7 +789,7 @@ int _MMGS_defsiz_ani(MMG5_pMesh mesh,MMG5_pSol met) {
         if ( !_MMGS_intextmet(mesh,met,pt->v[i],mm) ) {
           if ( !mmgErr ) {
             fprintf(stderr,"\n  ## Error: %s: unable to intersect metrics"
-                    " at point %d.\n",__func__,
+                    " at point %" MMG5_PRId ".\n",__func__,
                     _MMGS_indPt(mesh,pt->v[i]));
             mmgErr = 1;
           }
@@ -815,7 +820,8 @@ int gradsiz_ani(MMG5_pMesh mesh,MMG5_pSol met) {
   MMG5_pTria   pt;
   MMG5_pPoint  p1,p2;
   double  *m,mv;
-  int     k,it,nup,nu,maxit;
+  int     it,nup,nu,maxit;
+  MMG5_int k;
   char    i,ier,i1,i2;
 
   if ( abs(mesh->info.imprim) > 5 || mesh->info.ddebug )
@@ -35,7 +35,6 @@
 
 #include "mmgs.h"
 
-extern char ddb;
 
 /**
  * \param mesh pointer toward the mesh structure.
@@ -55,7 +54,7 @@ int _MMG5_mmgsBezierCP(MMG5_pMesh mesh,MMG5_Tria *pt,_MMG5_pBezier pb,
                        char ori) {
   MMG5_pPoint    p[3];
   double         *n1,*n2,nt[3],ps,ps2,dd,ux,uy,uz,ll;
-  int            ia,ib,ic;
+  MMG5_int       ia,ib,ic;
   char           i,i1,i2;
 
   ia   = pt->v[0];
@@ -46,10 +46,11 @@
  * crossing ridge.
  *
  */
-int boulet(MMG5_pMesh mesh,int start,int ip,int *list) {
+int boulet(MMG5_pMesh mesh,MMG5_int start,int ip,MMG5_int *list) {
   MMG5_pTria    pt;
   MMG5_pPoint   ppt;
-  int           *adja,k,ilist;
+  int           ilist;
+  MMG5_int      *adja,k;
   char          i,i1,i2;
 
   pt = &mesh->tria[start];
@@ -108,10 +109,11 @@ int boulet(MMG5_pMesh mesh,int start,int ip,int *list) {
  * crossing ridge. Check whether resulting configuration is manifold.
  *
  */
-int boulechknm(MMG5_pMesh mesh,int start,int ip,int *list) {
+int boulechknm(MMG5_pMesh mesh,MMG5_int start,int ip,MMG5_int *list) {
   MMG5_pTria    pt;
   MMG5_pPoint   ppt;
-  int           *adja,k,ilist,base,iel;
+  int           ilist,base;
+  MMG5_int      *adja,k,iel;
   char          i,i1,i2,ia,iq,voy;
 
   base = ++mesh->base;
@@ -239,9 +241,10 @@ int boulechknm(MMG5_pMesh mesh,int start,int ip,int *list) {
 }
 
 /* return all vertices connected to ip, list[0] = ip */
-int boulep(MMG5_pMesh mesh,int start,int ip,int *list) {
+int boulep(MMG5_pMesh mesh,MMG5_int start,int ip,MMG5_int *list) {
   MMG5_pTria    pt;
-  int     *adja,k,ilist;
+  int     ilist;
+  MMG5_int *adja,k;
   char     i,i1,i2;
 
   pt = &mesh->tria[start];
@@ -309,10 +312,11 @@ int boulep(MMG5_pMesh mesh,int start,int ip,int *list) {
  * point of the ridge. Both lists are returned enumerated in direct order.
  *
  */
-int bouletrid(MMG5_pMesh mesh,int start,int ip,int *il1,int *l1,int *il2,int *l2,int *ip0,int *ip1) {
+int bouletrid(MMG5_pMesh mesh,MMG5_int start,int ip,int *il1,MMG5_int *l1,int *il2,MMG5_int *l2,MMG5_int *ip0,MMG5_int *ip1) {
   MMG5_pTria           pt;
   MMG5_pPoint          ppt;
-  int                  idp,k,kold,*adja,iel,*ilist1,*ilist2,*list1,*list2,aux;
+  int                  *ilist1,*ilist2;
+  MMG5_int             idp,*adja,k,kold,iel,*list1,*list2,aux;
   unsigned char        i,iold,i1,i2,ipn;
   double               *n1,*n2,nt[3],ps1,ps2;
 
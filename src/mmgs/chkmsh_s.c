@@ -48,11 +48,12 @@
 int _MMG5_mmgsChkmsh(MMG5_pMesh mesh,int severe,int base) {
     MMG5_pPoint         ppt;
     MMG5_pTria          pt1,pt2;
-    int                 adj,adj1,k,kk,l,nk,i,j,ip,lon,len;
-    int                 *adja,*adjb,list[_MMGS_LMAX+2];
+    int                 l,i,j,lon,len;
+    MMG5_int            k,kk,ip,adj,adj1,nk;
+    MMG5_int            *adja,*adjb,list[_MMGS_LMAX+2];
     char                voy,voy1,i1,i2,j1,j2;
-    static char         mmgErr0=0,mmgErr1=0,mmgErr2=0,mmgErr3=0,mmgErr4=0;
-    static char         mmgErr5=0,mmgErr6=0,mmgErr7=0;
+    static _MMG5_TLS char         mmgErr0=0,mmgErr1=0,mmgErr2=0,mmgErr3=0,mmgErr4=0;
+    static _MMG5_TLS char         mmgErr5=0,mmgErr6=0,mmgErr7=0;
 
     for (k=1; k<=mesh->nt; k++) {
         pt1 = &mesh->tria[k];
@@ -69,12 +70,12 @@ int _MMG5_mmgsChkmsh(MMG5_pMesh mesh,int severe,int base) {
               if ( !mmgErr0 ) {
                 mmgErr0 = 1;
                 fprintf(stderr,"  ## Error: %s: 0. at least 1 missing edge"
-                        " tag (%d %d)\n",__func__,_MMGS_indElt(mesh,k),
+                        " tag (%" MMG5_PRId " %" MMG5_PRId ")\n",__func__,_MMGS_indElt(mesh,k),
                         _MMGS_indElt(mesh,adj));
-                fprintf(stderr,"triangle %d: %d %d %d \n",_MMGS_indElt(mesh,k),
+                fprintf(stderr,"triangle %" MMG5_PRId ": %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " \n",_MMGS_indElt(mesh,k),
                         _MMGS_indPt(mesh,pt1->v[0]),_MMGS_indPt(mesh,pt1->v[1]),
                         _MMGS_indPt(mesh,pt1->v[2]));
-                fprintf(stderr,"tag (%d): %d %d %d \n",_MMGS_indElt(mesh,k),
+                fprintf(stderr,"tag (%" MMG5_PRId "): %d %d %d \n",_MMGS_indElt(mesh,k),
                         pt1->tag[0],pt1->tag[1],pt1->tag[2]);
               }
               return(0);
@@ -83,12 +84,12 @@ int _MMG5_mmgsChkmsh(MMG5_pMesh mesh,int severe,int base) {
               if ( !mmgErr1 ) {
                 mmgErr1 = 1;
                 fprintf(stderr,"\n  ## Error: %s: 1. at least 1 wrong adjacency"
-                        " (%d %d)\n",
+                        " (%" MMG5_PRId " %" MMG5_PRId ")\n",
                         __func__,_MMGS_indElt(mesh,k),_MMGS_indElt(mesh,adj));
-                fprintf(stderr,"triangle %d: %d %d %d \n",_MMGS_indElt(mesh,k),
+                fprintf(stderr,"triangle %" MMG5_PRId ": %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " \n",_MMGS_indElt(mesh,k),
                         _MMGS_indPt(mesh,pt1->v[0]),_MMGS_indPt(mesh,pt1->v[1]),
                         _MMGS_indPt(mesh,pt1->v[2]));
-                fprintf(stderr,"adj (%d): %d %d %d \n",_MMGS_indElt(mesh,k),
+                fprintf(stderr,"adj (%" MMG5_PRId "): %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " \n",_MMGS_indElt(mesh,k),
                         _MMGS_indElt(mesh,adja[0]/3),_MMGS_indElt(mesh,adja[1]/3),
                         _MMGS_indElt(mesh,adja[2]/3));
               }
@@ -99,12 +100,12 @@ int _MMG5_mmgsChkmsh(MMG5_pMesh mesh,int severe,int base) {
               if ( !mmgErr2 ) {
                 mmgErr2 = 1;
                 fprintf(stderr,"\n  ## Error: %s: 4. At least 1 invalid adjacent"
-                        " (%d %d)\n",__func__,_MMGS_indElt(mesh,adj),
+                        " (%" MMG5_PRId " %" MMG5_PRId ")\n",__func__,_MMGS_indElt(mesh,adj),
                         _MMGS_indElt(mesh,k));
-                fprintf(stderr,"vertices of k   %d: %d %d %d\n",
+                fprintf(stderr,"vertices of k   %" MMG5_PRId ": %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId "\n",
                         _MMGS_indElt(mesh,k),_MMGS_indPt(mesh,pt1->v[0]),
                         _MMGS_indPt(mesh,pt1->v[1]),_MMGS_indPt(mesh,pt1->v[2]));
-                fprintf(stderr,"vertices of adj %d: %d %d %d \n",
+                fprintf(stderr,"vertices of adj %" MMG5_PRId ": %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " \n",
                         _MMGS_indElt(mesh,adj),_MMGS_indPt(mesh,pt2->v[0]),
                         _MMGS_indPt(mesh,pt2->v[1]),_MMGS_indPt(mesh,pt2->v[2]));
               }
@@ -112,7 +113,7 @@ int _MMG5_mmgsChkmsh(MMG5_pMesh mesh,int severe,int base) {
             }
             if ( (pt1->tag[i] != pt2->tag[voy]) || (pt1->edg[i] != pt2->edg[voy] ) ) {
                 fprintf(stderr,"\n  ## Error: %s: 3. at least 1 wrong"
-                        " tag/ref (%d %d)"
+                        " tag/ref (%" MMG5_PRId " %" MMG5_PRId ")"
                         "  %d - %d\n",__func__,_MMGS_indElt(mesh,k),
                         _MMGS_indElt(mesh,adj),pt1->tag[i],pt2->tag[voy]);
                 return(0);
@@ -124,19 +125,19 @@ int _MMG5_mmgsChkmsh(MMG5_pMesh mesh,int severe,int base) {
               if ( !mmgErr3 ) {
                 mmgErr3 = 1;
                 fprintf(stderr,"\n  ## Error: %s: 2. at least 1 wrong"
-                        " adjacency (%d %d)\n",__func__, _MMGS_indElt(mesh,k),
+                        " adjacency (%" MMG5_PRId " %" MMG5_PRId ")\n",__func__, _MMGS_indElt(mesh,k),
                          _MMGS_indElt(mesh,adj1));
-                fprintf(stderr,"vertices of %d: %d %d %d \n",_MMGS_indElt(mesh,k),
+                fprintf(stderr,"vertices of %" MMG5_PRId ": %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " \n",_MMGS_indElt(mesh,k),
                         _MMGS_indPt(mesh,pt1->v[0]),_MMGS_indPt(mesh,pt1->v[1]),
                         _MMGS_indPt(mesh,pt1->v[2]));
-                fprintf(stderr,"vertices of adj %d: %d %d %d \n",
+                fprintf(stderr,"vertices of adj %" MMG5_PRId ": %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId " \n",
                         _MMGS_indElt(mesh,adj),
                         _MMGS_indPt(mesh,pt2->v[0]),_MMGS_indPt(mesh,pt2->v[1]),
                         _MMGS_indPt(mesh,pt2->v[2]));
-                fprintf(stderr,"adj(%d): %d %d %d\n",_MMGS_indElt(mesh,k),
+                fprintf(stderr,"adj(%" MMG5_PRId "): %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId "\n",_MMGS_indElt(mesh,k),
                         _MMGS_indElt(mesh,adja[0]/3),_MMGS_indElt(mesh,adja[1]/3),
                         _MMGS_indElt(mesh,adja[2]/3));
-                fprintf(stderr,"adj(%d): %d %d %d\n",_MMGS_indElt(mesh,adj),
+                fprintf(stderr,"adj(%" MMG5_PRId "): %" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId "\n",_MMGS_indElt(mesh,adj),
                         _MMGS_indElt(mesh,adjb[0]/3),_MMGS_indElt(mesh,adjb[1]/3),
                         _MMGS_indElt(mesh,adjb[2]/3));
               }
@@ -149,7 +150,7 @@ int _MMG5_mmgsChkmsh(MMG5_pMesh mesh,int severe,int base) {
                   if ( !mmgErr4 ) {
                     mmgErr4 = 1;
                     fprintf(stderr,"\n  ## Error: %s: 8. at least 1 wrong"
-                            " orientation (%d %d).\n",__func__,_MMGS_indElt(mesh,k),
+                            " orientation (%" MMG5_PRId " %" MMG5_PRId ").\n",__func__,_MMGS_indElt(mesh,k),
                             _MMGS_indElt(mesh,adj));
                   }
                   return(0);
@@ -174,9 +175,9 @@ int _MMG5_mmgsChkmsh(MMG5_pMesh mesh,int severe,int base) {
               if ( !mmgErr5 ) {
                 mmgErr5 = 1;
                 fprintf(stderr,"\n  ## Error: %s: 6. at least 1 unused"
-                        " vertex (%d  %d)\n",__func__,
+                        " vertex (%" MMG5_PRId "  %" MMG5_PRId ")\n",__func__,
                         _MMGS_indElt(mesh,k),_MMGS_indPt(mesh,ip));
-                fprintf(stderr,"%d %d %d\n",_MMGS_indPt(mesh,pt1->v[0]),
+                fprintf(stderr,"%" MMG5_PRId " %" MMG5_PRId " %" MMG5_PRId "\n",_MMGS_indPt(mesh,pt1->v[0]),
                         _MMGS_indPt(mesh,pt1->v[1]),_MMGS_indPt(mesh,pt1->v[2]));
               }
               return(0);
@@ -193,7 +194,7 @@ int _MMG5_mmgsChkmsh(MMG5_pMesh mesh,int severe,int base) {
                   if ( !mmgErr6 ) {
                     mmgErr6 = 1;
                     fprintf(stderr,"\n  ## Error: %s: 5. at least 1 wrong"
-                            " ball (%d, %d).\n",__func__,_MMGS_indPt(mesh,ip),
+                            " ball (%" MMG5_PRId ", %" MMG5_PRId ").\n",__func__,_MMGS_indPt(mesh,ip),
                             _MMGS_indPt(mesh,pt2->v[nk]));
                   }
                   return(0);
@@ -213,7 +214,7 @@ int _MMG5_mmgsChkmsh(MMG5_pMesh mesh,int severe,int base) {
               if ( !mmgErr7 ) {
                 mmgErr7 = 1;
                 fprintf(stderr,"\n  ## Error: %s: 7. at least 1 incorrect"
-                        " ball (%d: %d %d).\n",__func__,_MMGS_indPt(mesh,ip),lon,len);
+                        " ball (%" MMG5_PRId ": %d %d).\n",__func__,_MMGS_indPt(mesh,ip),lon,len);
                 ppt->tag |= MG_CRN + MG_REQ;
               }
               return 0;
@@ -235,7 +236,7 @@ int chkeigen(MMG5_pMesh mesh,MMG5_pSol met,int k,double lambda[3]) {
     MMG5_pxPoint   go;
     int            ord;
     double         *m,*n,r[3][3],mr[6],mtan[3],vp[2][2];
-    static char    mmgWarn=0;
+    static _MMG5_TLS char    mmgWarn=0;
 
     p0 = &mesh->point[k];
     assert( MG_VOK(p0) );
@@ -292,9 +293,9 @@ int chkmet(MMG5_pMesh mesh,MMG5_pSol met) {
     MMG5_pxPoint   go;
     double         *m,*n,isqhmin,isqhmax,r[3][3],mr[6],mtan[3];
     double         vp[2][2],lambda[2];
-    int            k;
+    MMG5_int       k;
     char           i;
-    static char    mmgWarn0=0,mmgWarn1=0,mmgWarn2=0,mmgWarn3=0;
+    static _MMG5_TLS char    mmgWarn0=0,mmgWarn1=0,mmgWarn2=0,mmgWarn3=0;
 
     isqhmin = 1.0 / (mesh->info.hmin*mesh->info.hmin);
     isqhmax = 1.0 / (mesh->info.hmax*mesh->info.hmax);
@@ -310,7 +311,7 @@ int chkmet(MMG5_pMesh mesh,MMG5_pSol met) {
               if ( !mmgWarn0 ) {
                 mmgWarn0=1;
                 fprintf(stderr,"\n   ## Error: %s: at least 1 wrong definition"
-                        " of singular metric point (%d: "
+                        " of singular metric point (%" MMG5_PRId ": "
                         "met %f %f %f %f %f %f).\n",__func__,
                         _MMGS_indPt(mesh,k),m[0],m[1],m[2],m[3],m[4],m[5]);
               }
@@ -320,7 +321,7 @@ int chkmet(MMG5_pMesh mesh,MMG5_pSol met) {
               if ( !mmgWarn1 ) {
                 mmgWarn1=1;
                 fprintf(stderr,"\n  ## Error: %s: at least 1 wrong definition of"
-                        " singular metric point (%d: "
+                        " singular metric point (%" MMG5_PRId ": "
                         "met %f %f %f %f %f %f).\n",__func__,
                         _MMGS_indPt(mesh,k),m[0],m[1],m[2],m[3],m[4],m[5]);
               }
@@ -334,7 +335,7 @@ int chkmet(MMG5_pMesh mesh,MMG5_pSol met) {
                   if ( !mmgWarn2 ) {
                     mmgWarn2=1;
                     fprintf(stderr,"\n  ## Error: %s: in definition of metric"
-                            " at ridge point (%d: "
+                            " at ridge point (%" MMG5_PRId ": "
                             "met %f %f %f %f %f %f). \n",__func__,
                             _MMGS_indPt(mesh,k),m[0],m[1],m[2],m[3],m[4],m[5]);
                     return 0;
@@ -364,7 +365,7 @@ int chkmet(MMG5_pMesh mesh,MMG5_pSol met) {
               if ( !mmgWarn3 ) {
                 mmgWarn3 = 1;
                 fprintf(stderr,"\n  ## Error: %s: in definition of metric at"
-                        " regular point (%d: "
+                        " regular point (%" MMG5_PRId ": "
                         "met %f %f %f %f %f %f).\n",__func__,_MMGS_indPt(mesh,k),
                         m[0],m[1],m[2],m[3],m[4],m[5]);
                 fprintf(stderr,"eigenvalue : %f \n",lambda[0]);
@@ -376,7 +377,7 @@ int chkmet(MMG5_pMesh mesh,MMG5_pSol met) {
               if ( !mmgWarn3 ) {
                 mmgWarn3 = 1;
                 fprintf(stderr,"\n  ## Error: %s: in definition of metric at"
-                        " regular point (%d: "
+                        " regular point (%" MMG5_PRId ": "
                         "met %f %f %f %f %f %f).\n",__func__,_MMGS_indPt(mesh,k),
                         m[0],m[1],m[2],m[3],m[4],m[5]);
                 fprintf(stderr,"eigenvalue : %f \n",lambda[1]);
@@ -405,9 +406,9 @@ int chknor(MMG5_pMesh mesh) {
     MMG5_pPoint   p0;
     MMG5_pxPoint    go;
     double   dd,ps,*n,nt[3];
-    int      k;
+    MMG5_int k;
     char     i;
-    static char mmgWarn0=0, mmgWarn1=0;
+    static _MMG5_TLS char mmgWarn0=0, mmgWarn1=0;
 
     /* First test : check that all normal vectors at points are non 0 */
     for (k=1; k<=mesh->np; k++) {
@@ -425,7 +426,7 @@ int chknor(MMG5_pMesh mesh) {
           if ( !mmgWarn0 ) {
             mmgWarn0 = 1;
             fprintf(stderr,"\n  ## Error: %s: at least 1 non unitary normal"
-                    " (point: %d normal n1 = %f %f %f). exit program\n",
+                    " (point: %" MMG5_PRId " normal n1 = %f %f %f). exit program\n",
                     __func__,_MMGS_indPt(mesh,k),n[0],n[1],n[2]);
           }
           return 0;
@@ -438,7 +439,7 @@ int chknor(MMG5_pMesh mesh) {
           if ( !mmgWarn0 ) {
             mmgWarn0 = 1;
             fprintf(stderr,"\n  ## Error: %s: at least 1 non unitary normal"
-                    " (point: %d normal n2 = %f %f %f). exit program\n",
+                    " (point: %" MMG5_PRId " normal n2 = %f %f %f). exit program\n",
                     __func__,_MMGS_indPt(mesh,k),n[0],n[1],n[2]);
           }
           return 0;
@@ -465,7 +466,7 @@ int chknor(MMG5_pMesh mesh) {
                       if ( !mmgWarn1 ) {
                         mmgWarn1 = 1;
                         fprintf(stderr,"\n  ## Error: %s: at least 1"
-                                " inconsistant normal (point %d in triangle %d):"
+                                " inconsistant normal (point %" MMG5_PRId " in triangle %" MMG5_PRId "):"
                                 " ps = %f \n",__func__,_MMGS_indPt(mesh,pt->v[i]),
                                 _MMGS_indElt(mesh,k),ps);
                       }
@@ -478,7 +479,7 @@ int chknor(MMG5_pMesh mesh) {
                       if ( !mmgWarn1 ) {
                         mmgWarn1 = 1;
                         fprintf(stderr,"\n  ## Error: %s: at least 1"
-                                " inconsistant normal (point %d in triangle %d):"
+                                " inconsistant normal (point %" MMG5_PRId " in triangle %" MMG5_PRId "):"
                                 " ps = %f \n",__func__,_MMGS_indPt(mesh,pt->v[i]),
                                 _MMGS_indElt(mesh,k),ps);
                       }
@@ -492,7 +493,7 @@ int chknor(MMG5_pMesh mesh) {
                       if ( !mmgWarn1 ) {
                         mmgWarn1 = 1;
                         fprintf(stderr,"\n  ## Error: %s: at least 1"
-                                " inconsistant normal (point %d in triangle %d):"
+                                " inconsistant normal (point %" MMG5_PRId " in triangle %" MMG5_PRId "):"
                                 " ps = %f \n",__func__,_MMGS_indPt(mesh,pt->v[i]),
                                 _MMGS_indElt(mesh,k),ps);
                       }
@@ -507,7 +508,7 @@ int chknor(MMG5_pMesh mesh) {
                   if ( !mmgWarn1 ) {
                     mmgWarn1 = 1;
                     fprintf(stderr,"\n  ## Error: %s: at least 1"
-                            " inconsistant normal (point %d in triangle %d):"
+                            " inconsistant normal (point %" MMG5_PRId " in triangle %" MMG5_PRId "):"
                             " ps = %f \n",__func__,_MMGS_indPt(mesh,pt->v[i]),
                             _MMGS_indElt(mesh,k),ps);
                   }
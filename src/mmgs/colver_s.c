@@ -50,12 +50,13 @@
  * check if geometry preserved by collapsing edge i
  *
  */
-int chkcol(MMG5_pMesh mesh,MMG5_pSol met,int k,char i,int *list,char typchk) {
+int chkcol(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,char i,MMG5_int *list,char typchk) {
   MMG5_pTria     pt,pt0,pt1,pt2;
   MMG5_pPoint    p1,p2;
   double         len,lon,ps,cosnold,cosnnew,kal,n0old[3],n1old[3],n00old[3];
   double         n0new[3],n1new[3],n00new[3];
-  int            *adja,jel,kel,ip1,ip2,l,ll,ilist;
+  int            l,ilist;
+  MMG5_int       *adja,ip1,ip2,kel,jel,ll;
   char           i1,i2,j,jj,j2,lj,open,voy;
 
   pt0 = &mesh->tria[0];
@@ -65,7 +66,7 @@ int chkcol(MMG5_pMesh mesh,MMG5_pSol met,int k,char i,int *list,char typchk) {
   ip1 = pt->v[i1];
   ip2 = pt->v[i2];
   if ( typchk == 2 && met->m ) {
-    lon = _MMG5_lenSurfEdg(mesh,met,ip1,ip2,0);
+    lon = mesh->func.lenSurfEdg(mesh,met,ip1,ip2,0);
     if ( !lon ) return 0;
     lon = MG_MIN(lon,_MMGS_LSHRT);
     lon = MG_MAX(1.0/lon,_MMGS_LLONG);
@@ -98,7 +99,7 @@ int chkcol(MMG5_pMesh mesh,MMG5_pSol met,int k,char i,int *list,char typchk) {
       /* check length */
       if ( typchk == 2 && met->m && !MG_EDG(mesh->point[ip2].tag) ) {
         ip1 = pt1->v[j2];
-        len = _MMG5_lenSurfEdg(mesh,met,ip1,ip2,0);
+        len = mesh->func.lenSurfEdg(mesh,met,ip1,ip2,0);
         if ( len > lon || !len )  return(0);
       }
 
@@ -148,7 +149,7 @@ int chkcol(MMG5_pMesh mesh,MMG5_pSol met,int k,char i,int *list,char typchk) {
 
       /* check quality */
       if ( typchk == 2 && met->m )
-        kal = _MMGS_ALPHAD*_MMG5_calelt(mesh,met,pt0);
+        kal = _MMGS_ALPHAD*mesh->func.caltri(mesh,met,pt0);
       else
         kal = _MMGS_ALPHAD*_MMG5_caltri_iso(mesh,NULL,pt0);
       if ( kal < _MMGS_NULKAL )  return(0);
@@ -207,7 +208,7 @@ int chkcol(MMG5_pMesh mesh,MMG5_pSol met,int k,char i,int *list,char typchk) {
 
     /* check quality */
     if ( typchk == 2 && met->m )
-      kal = _MMGS_ALPHAD*_MMG5_calelt(mesh,met,pt0);
+      kal = _MMGS_ALPHAD*mesh->func.caltri(mesh,met,pt0);
     else
       kal = _MMGS_ALPHAD*_MMG5_caltri_iso(mesh,NULL,pt0);
     if ( kal < _MMGS_NULKAL )  return(0);
@@ -247,7 +248,7 @@ int chkcol(MMG5_pMesh mesh,MMG5_pSol met,int k,char i,int *list,char typchk) {
 
     /* check quality */
     if ( typchk == 2 && met->m )
-      kal = _MMGS_ALPHAD*_MMG5_calelt(mesh,met,pt0);
+      kal = _MMGS_ALPHAD*mesh->func.caltri(mesh,met,pt0);
     else
       kal = _MMGS_ALPHAD*_MMG5_caltri_iso(mesh,NULL,pt0);
     if ( kal < _MMGS_NULKAL )  return(0);
@@ -258,9 +259,9 @@ int chkcol(MMG5_pMesh mesh,MMG5_pSol met,int k,char i,int *list,char typchk) {
 }
 
 /* collapse edge i of k, i1->i2 */
-int colver(MMG5_pMesh mesh,int *list,int ilist) {
+int colver(MMG5_pMesh mesh,MMG5_int *list,int ilist) {
   MMG5_pTria    pt,pt1,pt2;
-  int     *adja,k,iel,jel,kel,ip1,ip2;
+  MMG5_int *adja,ip1,ip2,k,kel,iel,jel;
   char     i,i1,i2,j,jj,open;
 
   iel = list[0] / 3;
@@ -348,9 +349,9 @@ int colver(MMG5_pMesh mesh,int *list,int ilist) {
  * ball of the collapsed point of size 3: the collapsed point is removed.
  *
  */
-int colver3(MMG5_pMesh mesh,int* list) {
+int colver3(MMG5_pMesh mesh,MMG5_int* list) {
   MMG5_pTria   pt,pt1,pt2;
-  int          *adja,iel,jel,kel,mel,ip;
+  MMG5_int     *adja,ip,mel,iel,jel,kel;
   char         i,i1,j,j1,j2,k,m;
 
   /* update of new point for triangle list[0] */
@@ -411,9 +412,9 @@ int colver3(MMG5_pMesh mesh,int* list) {
 
 
 /* collapse point along open ridge */
-int colver2(MMG5_pMesh mesh,int* list) {
+int colver2(MMG5_pMesh mesh,MMG5_int* list) {
   MMG5_pTria   pt,pt1;
-  int          *adja,iel,jel,kel,ip;
+  MMG5_int     *adja,ip,kel,iel,jel;
   char         i1,i2,jj,j2,k;
 
   /* update of new point for triangle list[0] */
@@ -455,7 +456,8 @@ int litcol(MMG5_pMesh mesh,int k,char i,double kali) {
   MMG5_pTria     pt,pt0,pt1;
   MMG5_pPoint    p1,p2;
   double         kal,ps,cosnold,cosnnew,n0old[3],n0new[3],n1old[3],n1new[3],n00old[3],n00new[3];
-  int            *adja,list[_MMGS_LMAX+2],jel,ip2,l,ilist;
+  int            l,ilist;
+  MMG5_int       *adja,ip2,list[_MMGS_LMAX+2],jel;
   char           i1,i2,j,jj,j2,open;
 
   pt0 = &mesh->tria[0];
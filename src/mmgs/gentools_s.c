@@ -38,7 +38,7 @@
 /* Delete all triangle references in mesh */
 int delref(MMG5_pMesh mesh) {
   MMG5_pTria    pt;
-  int      k;
+  MMG5_int k;
 
   for(k=1; k<=mesh->nt; k++) {
     pt = &mesh->tria[k];
@@ -63,11 +63,12 @@ int delref(MMG5_pMesh mesh) {
  */
 int setref(MMG5_pMesh mesh,int start,int ref,int putreq) {
   MMG5_pTria      pt,pt1;
-  int        *list,*adja,cur,base,k,iel,jel,ilist;
+  int        cur,base,k,ilist;
+  MMG5_int   *adja,jel,*list,iel;
   char       j,voy;
 
   ilist = cur = 0;
-  _MMG5_SAFE_CALLOC(list,mesh->nt+1,int,0);
+  _MMG5_SAFE_CALLOC(list,mesh->nt+1,MMG5_int,0);
   base = ++mesh->base;
 
   /* Pile up triangles from start, till a GEO boundary is met */
@@ -119,9 +120,10 @@ int setref(MMG5_pMesh mesh,int start,int ref,int putreq) {
 }
 
 /** find the element number in packed numerotation */
-int _MMGS_indElt(MMG5_pMesh mesh, int kel) {
+MMG5_int _MMGS_indElt(MMG5_pMesh mesh, MMG5_int kel) {
   MMG5_pTria pt;
-  int    ne, k;
+  int    ne;
+  MMG5_int k;
 
   ne = 0;
   for (k=1; k<=mesh->nt; k++) {
@@ -135,9 +137,10 @@ int _MMGS_indElt(MMG5_pMesh mesh, int kel) {
 }
 
 /** find the point number in packed numerotation */
-int _MMGS_indPt(MMG5_pMesh mesh, int kp) {
+MMG5_int _MMGS_indPt(MMG5_pMesh mesh, MMG5_int kp) {
   MMG5_pPoint ppt;
-  int         np, k;
+  int         np;
+  MMG5_int    k;
 
   np = 0;
   for (k=1; k<=mesh->np; k++) {
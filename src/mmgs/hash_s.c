@@ -44,7 +44,7 @@
  */
 static int paktri(MMG5_pMesh mesh) {
   MMG5_pTria   pt,pt1;
-  int          k;
+  MMG5_int     k;
 
   k = 1;
   do {
@@ -84,13 +84,13 @@ int _MMGS_hashTria(MMG5_pMesh mesh) {
   /* tassage */
   if ( !paktri(mesh) )  return 0;
 
-  _MMG5_ADD_MEM(mesh,(3*mesh->ntmax+5)*sizeof(int),"adjacency table",
+  _MMG5_ADD_MEM(mesh,(3*mesh->ntmax+5)*sizeof(MMG5_int),"adjacency table",
                 fprintf(stderr,"  Exit program.\n");
                 return 0);
-  _MMG5_SAFE_CALLOC(mesh->adja,3*mesh->ntmax+5,int,0);
+  _MMG5_SAFE_CALLOC(mesh->adja,3*mesh->ntmax+5,MMG5_int,0);
 
   ier = _MMG5_mmgHashTria(mesh, mesh->adja, &hash, 0);
-  _MMG5_DEL_MEM(mesh,hash.item,(hash.max+1)*sizeof(_MMG5_hedge));
+  _MMG5_DEL_MEM(mesh,hash.item,hash.siz*sizeof(_MMG5_hedge));
 
   return(ier);
 }
@@ -113,24 +113,19 @@ int assignEdge(MMG5_pMesh mesh) {
   _MMG5_Hash  hash;
   MMG5_pTria  pt;
   MMG5_pEdge  pa;
-  int         k,ia;
+  MMG5_int    k,ia;
   char        i,i1,i2;
 
   if ( !mesh->na ) return(1);
 
   /* adjust hash table params */
-  hash.siz  = mesh->na;
-  hash.max  = 3*mesh->na+1;
-  _MMG5_ADD_MEM(mesh,(hash.max+1)*sizeof(_MMG5_Hash),"hash table",return(0));
-  _MMG5_SAFE_CALLOC(hash.item,hash.max+1,_MMG5_hedge,0);
-
-  hash.nxt  = mesh->na;
-  for (k=mesh->na; k<hash.max; k++)
-    hash.item[k].nxt = k+1;
+  if ( !_MMG5_hashNew(mesh,&hash,mesh->na,3*mesh->na) )  return(0);
 
   /* hash mesh edges */
-  for (k=1; k<=mesh->na; k++)
-    _MMG5_hashEdge(mesh,&hash,mesh->edge[k].a,mesh->edge[k].b,k);
+  for (k=1; k<=mesh->na; k++) {
+    if ( !_MMG5_hashEdge(mesh,&hash,mesh->edge[k].a,mesh->edge[k].b,k) )
+      return(0);
+  }
 
   /* set references to triangles */
   for (k=1; k<=mesh->nt; k++) {
@@ -150,7 +145,7 @@ int assignEdge(MMG5_pMesh mesh) {
   }
 
   /* reset edge structure */
-  _MMG5_DEL_MEM(mesh,hash.item,(hash.max+1)*sizeof(_MMG5_hedge));
+  _MMG5_DEL_MEM(mesh,hash.item,hash.siz*sizeof(_MMG5_hedge));
   _MMG5_DEL_MEM(mesh,mesh->edge,(mesh->na+1)*sizeof(MMG5_Edge));
   mesh->na = 0;
 
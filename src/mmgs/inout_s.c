@@ -39,56 +39,6 @@
 #define sw 4
 #define sd 8
 
-int swapbin(int sbin)
-{
-  int inv;
-  char *p_in = (char *) &sbin;
-  char *p = (char *)&inv;
-
-
-  p[0] = p_in[3];
-  p[1] = p_in[2];
-  p[2] = p_in[1];
-  p[3] = p_in[0];
-
-  return(inv);
-  /*unsigned char c1, c2, c3, c4;
-
-    c1 = sbin & 255;
-    c2 = (sbin >> 8) & 255;
-    c3 = (sbin >> 16) & 255;
-    c4 = (sbin >> 24) & 255;
-
-    return ((int)c1 << 24) + ((int)c2 << 16) + ((int)c3 << 8) + c4;   */
-
-}
-float swapf(float sbin)
-{
-  float out;
-  char *p_in = (char *) &sbin;
-  char *p_out = (char *) &out;
-  p_out[0] = p_in[3];
-  p_out[1] = p_in[2];
-  p_out[2] = p_in[1];
-  p_out[3] = p_in[0];
-
-  return(out);
-}
-double swapd(double sbin)
-{
-  float out;
-  char *p_in = (char *) &sbin;
-  char *p_out = (char *) &out;
-  int i;
-
-  for(i=0;i<8;i++)
-  {
-    p_out[i] = p_in[7-i];
-  }
-
-  return(out);
-}
-
 /**
  * \param mesh pointer toward the mesh structure.
  * \param filename name of file.
@@ -99,16 +49,20 @@ double swapd(double sbin)
  */
 int MMGS_loadMesh(MMG5_pMesh mesh, const char *filename) {
   FILE        *inm;
+  _MMG5_BinFile bf;
   MMG5_pTria  pt1,pt2;
   MMG5_pEdge  ped;
   MMG5_pPoint ppt;
   double      *norm,*n,dd;
   float       fc;
   long         posnp,posnt,posne,posncor,posnq,posned,posnr;
-  long         posnpreq,posnormal,posnc1;
-  int         i,k,ia,nq,nri,ip,idn,ng,npreq;
-  int         ncor,bin,iswp,nedreq,posnedreq,bdim,binch,bpos;
-  int         na,*ina,a,b,ref;
+  long         posnpreq,posnormal,posnc1,posnedreq;
+  MMG5_int    i,k,ia,ip,idn;
+  MMG5_int    nq,nri,ng,npreq;
+  int         bin;
+  MMG5_int    ncor,nedreq;
+  MMG5_int    na,*ina,a,b;
+  int         ref;
   char        *ptr,*data,chaine[128];
 
 
@@ -116,8 +70,8 @@ int MMGS_loadMesh(MMG5_pMesh mesh, const char *filename) {
   posned = posnr = posnpreq = posnc1 = npreq = 0;
   posnedreq = posnormal = 0;
   ncor = nri = ng = nedreq = nq = 0;
+  ina = NULL;
   bin = 0;
-  iswp = 0;
   mesh->np = mesh->nt = mesh->nti = mesh->npi = 0;
 
   _MMG5_SAFE_CALLOC(data,strlen(filename)+7,char,0);
@@ -168,173 +122,76 @@ int MMGS_loadMesh(MMG5_pMesh mesh, const char *filename) {
         }
         continue;
       } else if(!strncmp(chaine,"Vertices",strlen("Vertices"))) {
-        fscanf(inm,"%d",&mesh->npi);
+        fscanf(inm,"%" MMG5_SCNd,&mesh->npi);
         posnp = ftell(inm);
         continue;
       } else if(!strncmp(chaine,"RequiredVertices",strlen("RequiredVertices"))) {
-        fscanf(inm,"%d",&npreq);
+        fscanf(inm,"%" MMG5_SCNd,&npreq);
         posnpreq = ftell(inm);
         continue;
       } else if(!strncmp(chaine,"Triangles",strlen("Triangles"))) {
-        fscanf(inm,"%d",&mesh->nti);
+        fscanf(inm,"%" MMG5_SCNd,&mesh->nti);
         posnt = ftell(inm);
         continue;
       } else if(!strncmp(chaine,"Quadrilaterals",strlen("Quadrilaterals"))) {
-        fscanf(inm,"%d",&nq);
+        fscanf(inm,"%" MMG5_SCNd,&nq);
         posnq = ftell(inm);
         continue;
       } else if(!strncmp(chaine,"Corners",strlen("Corners"))) {
-        fscanf(inm,"%d",&ncor);
+        fscanf(inm,"%" MMG5_SCNd,&ncor);
         posncor = ftell(inm);
         continue;
       } else if(!strncmp(chaine,"Edges",strlen("Edges"))) {
-        fscanf(inm,"%d",&mesh->na);
+        fscanf(inm,"%" MMG5_SCNd,&mesh->na);
         posned = ftell(inm);
         continue;
       } else if(!strncmp(chaine,"RequiredEdges",strlen("RequiredEdges"))) {
-        fscanf(inm,"%d",&nedreq);
+        fscanf(inm,"%" MMG5_SCNd,&nedreq);
         posnedreq = ftell(inm);
         continue;
       } else if(!strncmp(chaine,"Ridges",strlen("Ridges"))) {
-        fscanf(inm,"%d",&nri);
+        fscanf(inm,"%" MMG5_SCNd,&nri);
         posnr = ftell(inm);
         continue;
       } else if(!ng && !strncmp(chaine,"Normals",strlen("Normals"))) {
-        fscanf(inm,"%d",&ng);
+        fscanf(inm,"%" MMG5_SCNd,&ng);
         posnormal = ftell(inm);
         continue;
       } else if(!strncmp(chaine,"NormalAtVertices",strlen("NormalAtVertices"))) {
-        fscanf(inm,"%d",&mesh->nc1);
+        fscanf(inm,"%" MMG5_SCNd,&mesh->nc1);
         posnc1 = ftell(inm);
         continue;
       }
     }
   } else { //binary file
-    bdim = 0;
-    fread(&mesh->ver,sw,1,inm);
-    iswp=0;
-    if(mesh->ver==16777216)
-      iswp=1;
-    else if(mesh->ver!=1) {
-      fprintf(stdout,"BAD FILE ENCODING\n");
+    if ( !_MMG5_openBinFile(inm,&bf) ) {
+      fclose(inm);
+      return(0);
     }
-    fread(&mesh->ver,sw,1,inm);
-    if(iswp) mesh->ver = swapbin(mesh->ver);
-    while(fread(&binch,sw,1,inm)!=0 && binch!=54 ) {
-      if(iswp) binch=swapbin(binch);
-      if(binch==54) break;
-      if(!bdim && binch==3) {  //Dimension
-        fread(&bdim,sw,1,inm);  //NulPos=>20
-        if(iswp) bdim=swapbin(bdim);
-        fread(&bdim,sw,1,inm);
-        if(iswp) bdim=swapbin(bdim);
-        mesh->dim = bdim;
-        if(bdim!=3) {
-          fprintf(stderr,"BAD MESH DIMENSION : %d\n",mesh->dim);
-          return(-1);
-        }
-        continue;
-      } else if(!mesh->npi && binch==4) {  //Vertices
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=swapbin(bpos);
-        fread(&mesh->npi,sw,1,inm);
-        if(iswp) mesh->npi=swapbin(mesh->npi);
-        posnp = ftell(inm);
-        rewind(inm);
-        fseek(inm,bpos,SEEK_SET);
-        continue;
-      } else if(binch==15) {  //RequiredVertices
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=swapbin(bpos);
-        fread(&npreq,sw,1,inm);
-        if(iswp) npreq=swapbin(npreq);
-        posnpreq = ftell(inm);
-        rewind(inm);
-        fseek(inm,bpos,SEEK_SET);
-        continue;
-      } else if(!mesh->nti && binch==6) {//Triangles
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=swapbin(bpos);
-        fread(&mesh->nti,sw,1,inm);
-        if(iswp) mesh->nti=swapbin(mesh->nti);
-        posnt = ftell(inm);
-        rewind(inm);
-        fseek(inm,bpos,SEEK_SET);
-        continue;
-      } else if(binch==7) {//Quadrilaterals
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=swapbin(bpos);
-        fread(&nq,sw,1,inm);
-        if(iswp) nq=swapbin(nq);
-        posnq = ftell(inm);
-        rewind(inm);
-        fseek(inm,bpos,SEEK_SET);
-        continue;
-      } else if(!ncor && binch==13) { //Corners
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=swapbin(bpos);
-        fread(&ncor,sw,1,inm);
-        if(iswp) ncor=swapbin(ncor);
-        posncor = ftell(inm);
-        rewind(inm);
-        fseek(inm,bpos,SEEK_SET);
-        continue;
-      } else if(!mesh->na && binch==5) { //Edges
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=swapbin(bpos);
-        fread(&mesh->na,sw,1,inm);
-        if(iswp) mesh->na=swapbin(mesh->na);
-        posned = ftell(inm);
-        rewind(inm);
-        fseek(inm,bpos,SEEK_SET);
-        continue;
-      } else if(binch==16) {  //RequiredEdges
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=swapbin(bpos);
-        fread(&nedreq,sw,1,inm);
-        if(iswp) nedreq=swapbin(nedreq);
-        posnedreq = ftell(inm);
-        rewind(inm);
-        fseek(inm,bpos,SEEK_SET);
-        continue;
-      } else if(binch==14) {  //Ridges
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=swapbin(bpos);
-        fread(&nri,sw,1,inm);
-        if(iswp) nri=swapbin(nri);
-        posnr = ftell(inm);
-        rewind(inm);
-        fseek(inm,bpos,SEEK_SET);
-        continue;
-      } else if(!ng && binch==60) {  //Normals
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=swapbin(bpos);
-        fread(&ng,sw,1,inm);
-        if(iswp) ng=swapbin(ng);
-        posnormal = ftell(inm);
-        rewind(inm);
-        fseek(inm,bpos,SEEK_SET);
-        continue;
-      } else if(binch==20) {  //NormalAtVertices
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=swapbin(bpos);
-        fread(&mesh->nc1,sw,1,inm);
-        if(iswp) mesh->nc1=swapbin(mesh->nc1);
-        posnc1 = ftell(inm);
-        rewind(inm);
-        fseek(inm,bpos,SEEK_SET);
-        continue;
-      } else {
-        fread(&bpos,sw,1,inm); //NulPos
-        if(iswp) bpos=swapbin(bpos);
-        rewind(inm);
-        fseek(inm,bpos,SEEK_SET);
-      }
+    mesh->ver = bf.ver;
+    mesh->dim = (int)bf.nel[3]; //Dimension
+    if ( mesh->dim!=3 ) {
+      fprintf(stderr,"BAD MESH DIMENSION : %d\n",mesh->dim);
+      _MMG5_closeBinFile(&bf);
+      fclose(inm);
+      return(-1);
     }
+    mesh->npi = bf.nel[4];  posnp     = bf.pos[4];  //Vertices
+    npreq     = bf.nel[15]; posnpreq  = bf.pos[15]; //RequiredVertices
+    mesh->nti = bf.nel[6];  posnt     = bf.pos[6];  //Triangles
+    nq        = bf.nel[7];  posnq     = bf.pos[7];  //Quadrilaterals
+    ncor      = bf.nel[13]; posncor   = bf.pos[13]; //Corners
+    mesh->na  = bf.nel[5];  posned    = bf.pos[5];  //Edges
+    nedreq    = bf.nel[16]; posnedreq = bf.pos[16]; //RequiredEdges
+    nri       = bf.nel[14]; posnr     = bf.pos[14]; //Ridges
+    ng        = bf.nel[60]; posnormal = bf.pos[60]; //Normals
+    mesh->nc1 = bf.nel[20]; posnc1    = bf.pos[20]; //NormalAtVertices
   }
 
   if ( !mesh->npi || !mesh->nti ) {
     fprintf(stdout,"  ** MISSING DATA\n");
+    if ( bin ) _MMG5_closeBinFile(&bf);
+    fclose(inm);
     return(0);
   }
   mesh->np = mesh->npi;
@@ -344,38 +201,32 @@ int MMGS_loadMesh(MMG5_pMesh mesh, const char *filename) {
   if ( !_MMGS_zaldy(mesh) )  return(0);
 
   /* read vertices */
-
-  rewind(inm);
-  fseek(inm,posnp,SEEK_SET);
+  if ( bin ) {
+    /* copy the vertex and triangle blocks straight from the mapped file */
+    if ( !_MMG5_binReadPoints(mesh,&bf,3) ||
+         !_MMG5_binCopyElt(&bf,posnt,mesh->nti,3,
+                           mesh->tria[1].v,sizeof(MMG5_Tria)) ) {
+      _MMG5_closeBinFile(&bf);
+      fclose(inm);
+      return(0);
+    }
+  }
+  else {
+    rewind(inm);
+    fseek(inm,posnp,SEEK_SET);
+  }
   for (k=1; k<=mesh->np; k++) {
     ppt = &mesh->point[k];
-    if (mesh->ver < 2) { /*float*/
-      if (!bin) {
+    if ( !bin ) {
+      if (mesh->ver < 2) { /*float*/
         for (i=0 ; i<3 ; i++) {
           fscanf(inm,"%f",&fc);
           ppt->c[i] = (double) fc;
         }
         fscanf(inm,"%d",&ppt->ref);
-      } else {
-        for (i=0 ; i<3 ; i++) {
-          fread(&fc,sw,1,inm);
-          if(iswp) fc=swapf(fc);
-          ppt->c[i] = (double) fc;
-        }
-        fread(&ppt->ref,sw,1,inm);
-        if(iswp) ppt->ref=swapbin(ppt->ref);
       }
-    } else {
-      if (!bin)
+      else
         fscanf(inm,"%lf %lf %lf %d",&ppt->c[0],&ppt->c[1],&ppt->c[2],&ppt->ref);
-      else {
-        for (i=0 ; i<3 ; i++) {
-          fread(&ppt->c[i],sd,1,inm);
-          if(iswp) ppt->c[i]=swapd(ppt->c[i]);
-        }
-        fread(&ppt->ref,sw,1,inm);
-        if(iswp) ppt->ref=swapbin(ppt->ref);
-      }
     }
     ppt->tag = MG_NUL;
   }
@@ -383,18 +234,10 @@ int MMGS_loadMesh(MMG5_pMesh mesh, const char *filename) {
   /* read triangles and set seed */
   rewind(inm);
   fseek(inm,posnt,SEEK_SET);
-  for (k=1; k<=mesh->nt; k++) {
+  for (k=1; k<=mesh->nti; k++) {
     pt1 = &mesh->tria[k];
     if (!bin)
-      fscanf(inm,"%d %d %d %d",&pt1->v[0],&pt1->v[1],&pt1->v[2],&pt1->ref);
-    else {
-      for (i=0 ; i<3 ; i++) {
-        fread(&pt1->v[i],sw,1,inm);
-        if(iswp) pt1->v[i]=swapbin(pt1->v[i]);
-      }
-      fread(&pt1->ref,sw,1,inm);
-      if(iswp) pt1->ref=swapbin(pt1->ref);
-    }
+      fscanf(inm,"%" MMG5_SCNd " %" MMG5_SCNd " %" MMG5_SCNd " %d",&pt1->v[0],&pt1->v[1],&pt1->v[2],&pt1->ref);
     for (i=0; i<3; i++) {
       ppt = &mesh->point[pt1->v[i]];
       ppt->tag &= ~MG_NUL;
@@ -412,16 +255,12 @@ int MMGS_loadMesh(MMG5_pMesh mesh, const char *filename) {
       pt2 = &mesh->tria[mesh->nti];
 
       if (!bin)
-        fscanf(inm,"%d %d %d %d %d",&pt1->v[0],&pt1->v[1],&pt1->v[2],&pt2->v[2],&pt1->ref);
+        fscanf(inm,"%" MMG5_SCNd " %" MMG5_SCNd " %" MMG5_SCNd " %" MMG5_SCNd " %d",&pt1->v[0],&pt1->v[1],&pt1->v[2],&pt2->v[2],&pt1->ref);
       else {
-        for (i=0 ; i<3 ; i++) {
-          fread(&pt1->v[i],sw,1,inm);
-          if(iswp) pt1->v[i]=swapbin(pt1->v[i]);
-        }
-        fread(&pt2->v[2],sw,1,inm);
-        if(iswp) pt2->v[2]=swapbin(pt2->v[2]);
-        fread(&pt1->ref,sw,1,inm);
-        if(iswp) pt1->ref=swapbin(pt1->ref);
+        for (i=0 ; i<3 ; i++)
+          pt1->v[i] = _MMG5_binInt(&bf,posnq+(5*(k-1)+i)*sw);
+        pt2->v[2] = _MMG5_binInt(&bf,posnq+(5*(k-1)+3)*sw);
+        pt1->ref  = _MMG5_binInt(&bf,posnq+(5*(k-1)+4)*sw);
       }
       pt2->v[0] = pt1->v[0];
       pt2->v[1] = pt1->v[2];
@@ -441,13 +280,11 @@ int MMGS_loadMesh(MMG5_pMesh mesh, const char *filename) {
     fseek(inm,posncor,SEEK_SET);
     for (k=1; k<=ncor; k++) {
       if(!bin)
-        fscanf(inm,"%d",&i);
-      else {
-        fread(&i,sw,1,inm);
-        if(iswp) i=swapbin(i);
-      }
+        fscanf(inm,"%" MMG5_SCNd,&i);
+      else
+        i = _MMG5_binInt(&bf,posncor+(k-1)*sw);
       if(i>mesh->np) {
-        fprintf(stderr,"\n  ## Warning: %s: corner number %8d ignored.\n",
+        fprintf(stderr,"\n  ## Warning: %s: corner number %8" MMG5_PRId " ignored.\n",
                 __func__,i);
       } else {
         ppt = &mesh->point[i];
@@ -462,13 +299,11 @@ int MMGS_loadMesh(MMG5_pMesh mesh, const char *filename) {
     fseek(inm,posnpreq,SEEK_SET);
     for (k=1; k<=npreq; k++) {
       if(!bin)
-        fscanf(inm,"%d",&i);
-      else {
-        fread(&i,sw,1,inm);
-        if(iswp) i=swapbin(i);
-      }
+        fscanf(inm,"%" MMG5_SCNd,&i);
+      else
+        i = _MMG5_binInt(&bf,posnpreq+(k-1)*sw);
       if(i>mesh->np) {
-        fprintf(stderr,"\n  ## Warning: %s: required Vertices number %8d ignored\n",
+        fprintf(stderr,"\n  ## Warning: %s: required Vertices number %8" MMG5_PRId " ignored\n",
                 __func__,i);
       } else {
         ppt = &mesh->point[i];
@@ -489,18 +324,15 @@ int MMGS_loadMesh(MMG5_pMesh mesh, const char *filename) {
     /* Skip edges with MG_ISO refs */
     if( mesh->info.iso ) {
       mesh->na = 0;
-      _MMG5_SAFE_CALLOC(ina,na+1,int,0);
+      _MMG5_SAFE_CALLOC(ina,na+1,MMG5_int,0);
 
       for (k=1; k<=na; k++) {
         if (!bin)
-          fscanf(inm,"%d %d %d",&a,&b,&ref);
+          fscanf(inm,"%" MMG5_SCNd " %" MMG5_SCNd " %d",&a,&b,&ref);
         else {
-          fread(&a,sw,1,inm);
-          if(iswp) a=swapbin(a);
-          fread(&b,sw,1,inm);
-          if(iswp) b=swapbin(b);
-          fread(&ref,sw,1,inm);
-          if(iswp) ref=swapbin(ref);
+          a   = _MMG5_binInt(&bf,posned+3*(k-1)*sw);
+          b   = _MMG5_binInt(&bf,posned+(3*k-2)*sw);
+          ref = _MMG5_binInt(&bf,posned+(3*k-1)*sw);
         }
         if ( abs(ref) != MG_ISO ) {
           ped = &mesh->edge[++mesh->na];
@@ -522,17 +354,15 @@ int MMGS_loadMesh(MMG5_pMesh mesh, const char *filename) {
       }
     }
     else {
+      if ( bin && !_MMG5_binCopyElt(&bf,posned,mesh->na,2,
+                                    &mesh->edge[1].a,sizeof(MMG5_Edge)) ) {
+        _MMG5_closeBinFile(&bf);
+        fclose(inm);
+        return(0);
+      }
       for (k=1; k<=mesh->na; k++) {
         if (!bin)
-          fscanf(inm,"%d %d %d",&mesh->edge[k].a,&mesh->edge[k].b,&mesh->edge[k].ref);
-        else {
-          fread(&mesh->edge[k].a,sw,1,inm);
-          if(iswp) mesh->edge[k].a=swapbin(mesh->edge[k].a);
-          fread(&mesh->edge[k].b,sw,1,inm);
-          if(iswp) mesh->edge[k].b=swapbin(mesh->edge[k].b);
-          fread(&mesh->edge[k].ref,sw,1,inm);
-          if(iswp) mesh->edge[k].ref=swapbin(mesh->edge[k].ref);
-        }
+          fscanf(inm,"%" MMG5_SCNd " %" MMG5_SCNd " %d",&mesh->edge[k].a,&mesh->edge[k].b,&mesh->edge[k].ref);
         mesh->edge[k].tag |= MG_REF;
         mesh->point[mesh->edge[k].a].tag |= MG_REF;
         mesh->point[mesh->edge[k].b].tag |= MG_REF;
@@ -545,13 +375,11 @@ int MMGS_loadMesh(MMG5_pMesh mesh, const char *filename) {
       fseek(inm,posnr,SEEK_SET);
       for (k=1; k<=nri; k++) {
         if(!bin)
-          fscanf(inm,"%d",&ia);
-        else {
-          fread(&ia,sw,1,inm);
-          if(iswp) ia=swapbin(ia);
-        }
+          fscanf(inm,"%" MMG5_SCNd,&ia);
+        else
+          ia = _MMG5_binInt(&bf,posnr+(k-1)*sw);
         if ( (ia>na) || (ia<0) ) {
-          fprintf(stderr,"\n  ## Warning: %s: ridge number %8d ignored.\n",
+          fprintf(stderr,"\n  ## Warning: %s: ridge number %8" MMG5_PRId " ignored.\n",
                   __func__,ia);
         }
         else {
@@ -572,13 +400,11 @@ int MMGS_loadMesh(MMG5_pMesh mesh, const char *filename) {
       fseek(inm,posnedreq,SEEK_SET);
       for (k=1; k<=nedreq; k++) {
         if(!bin)
-          fscanf(inm,"%d",&ia);
-        else {
-          fread(&ia,sw,1,inm);
-          if(iswp) ia=swapbin(ia);
-        }
+          fscanf(inm,"%" MMG5_SCNd,&ia);
+        else
+          ia = _MMG5_binInt(&bf,posnedreq+(k-1)*sw);
         if ( (ia>na) || (ia<0) ) {
-          fprintf(stderr,"\n  ## Warning: %s: required edge number %8d ignored\n",
+          fprintf(stderr,"\n  ## Warning: %s: required edge number %8" MMG5_PRId " ignored\n",
                   __func__,ia);
         }
         else {
@@ -606,33 +432,25 @@ int MMGS_loadMesh(MMG5_pMesh mesh, const char *filename) {
   if ( ng > 0 ) {
     _MMG5_SAFE_CALLOC(norm,3*ng+1,double,0);
 
+    if ( bin && !_MMG5_binReadNormals(&bf,ng,norm) ) {
+      _MMG5_SAFE_FREE(norm);
+      _MMG5_closeBinFile(&bf);
+      fclose(inm);
+      return(0);
+    }
     rewind(inm);
     fseek(inm,posnormal,SEEK_SET);
     for (k=1; k<=ng; k++) {
       n = &norm[3*(k-1)+1];
-      if ( mesh->ver == 1 ) {
-        if (!bin) {
+      if ( !bin ) {
+        if ( mesh->ver == 1 ) {
           for (i=0 ; i<3 ; i++) {
             fscanf(inm,"%f",&fc);
             n[i] = (double) fc;
           }
-        } else {
-          for (i=0 ; i<3 ; i++) {
-            fread(&fc,sw,1,inm);
-            if(iswp) fc=swapf(fc);
-            n[i] = (double) fc;
-          }
         }
-      }
-      else {
-        if (!bin)
+        else
           fscanf(inm,"%lf %lf %lf",&n[0],&n[1],&n[2]);
-        else {
-          for (i=0 ; i<3 ; i++) {
-            fread(&n[i],sd,1,inm);
-            if(iswp) n[i]=swapd(n[i]);
-          }
-        }
       }
       dd = n[0]*n[0] + n[1]*n[1] + n[2]*n[2];
       if ( dd > _MMG5_EPSD2 ) {
@@ -648,12 +466,10 @@ int MMGS_loadMesh(MMG5_pMesh mesh, const char *filename) {
 
     for (k=1; k<=mesh->nc1; k++) {
       if (!bin)
-        fscanf(inm,"%d %d",&ip,&idn);
+        fscanf(inm,"%" MMG5_SCNd " %" MMG5_SCNd,&ip,&idn);
       else {
-        fread(&ip,sw,1,inm);
-        if(iswp) ip=swapbin(ip);
-        fread(&idn,sw,1,inm);
-        if(iswp) idn=swapbin(idn);
+        ip  = _MMG5_binInt(&bf,posnc1+2*(k-1)*sw);
+        idn = _MMG5_binInt(&bf,posnc1+(2*k-1)*sw);
       }
       if ( idn > 0 && ip < mesh->np+1 )
         memcpy(&mesh->point[ip].n,&norm[3*(idn-1)+1],3*sizeof(double));
@@ -662,38 +478,34 @@ int MMGS_loadMesh(MMG5_pMesh mesh, const char *filename) {
   }
 
   if ( abs(mesh->info.imprim) > 4 ) {
-    fprintf(stdout,"     NUMBER OF VERTICES   %8d / %8d   CORNERS/REQ. %d / %d\n",mesh->npi,mesh->npmax,ncor,npreq);
-    fprintf(stdout,"     NUMBER OF TRIANGLES  %8d / %8d\n",mesh->nti,mesh->ntmax);
+    fprintf(stdout,"     NUMBER OF VERTICES   %8" MMG5_PRId " / %8" MMG5_PRId "   CORNERS/REQ. %" MMG5_PRId " / %" MMG5_PRId "\n",mesh->npi,mesh->npmax,ncor,npreq);
+    fprintf(stdout,"     NUMBER OF TRIANGLES  %8" MMG5_PRId " / %8" MMG5_PRId "\n",mesh->nti,mesh->ntmax);
 
     if ( mesh->na )
-      fprintf(stdout,"     NUMBER OF EDGES      %8d  RIDGES %6d\n",mesh->na,nri);
+      fprintf(stdout,"     NUMBER OF EDGES      %8" MMG5_PRId "  RIDGES %6" MMG5_PRId "\n",mesh->na,nri);
   }
+  if ( bin ) _MMG5_closeBinFile(&bf);
   fclose(inm);
   return(1);
 }
 
 int MMGS_loadMshMesh(MMG5_pMesh mesh,MMG5_pSol sol,const char *filename) {
-  FILE*       inm;
-  long        posNodes,posElts,*posNodeData;
-  int         ier,bin,iswp,nelts,nsols;
+  _MMG5_MshFile msh;
+  int         ier;
 
   mesh->dim = 3;
 
-  ier = MMG5_loadMshMesh_part1(mesh,filename,&inm,
-                               &posNodes,&posElts,&posNodeData,
-                               &bin,&iswp,&nelts,&nsols);
+  ier = MMG5_loadMshMesh_part1(mesh,filename,&msh);
   if ( ier < 1 )  return (ier);
 
-  if ( nsols > 1 ) {
-    fprintf(stderr,"SEVERAL SOLUTION => IGNORED: %d\n",nsols);
-    fclose(inm);
-    _MMG5_SAFE_FREE(posNodeData);
+  if ( msh.nsols > 1 ) {
+    fprintf(stderr,"SEVERAL SOLUTION => IGNORED: %d\n",msh.nsols);
+    _MMG5_freeMshFile(&msh);
     return(-1);
   }
 
   if ( !_MMGS_zaldy(mesh) ) {
-    fclose(inm);
-    _MMG5_SAFE_FREE(posNodeData);
+    _MMG5_freeMshFile(&msh);
     return(0);
   }
 
@@ -703,26 +515,21 @@ int MMGS_loadMshMesh(MMG5_pMesh mesh,MMG5_pSol sol,const char *filename) {
     fprintf(stderr,"  ** MISSING DATA.\n");
     fprintf(stderr," Check that your mesh contains triangles.\n");
     fprintf(stderr," Exit program.\n");
-    fclose(inm);
-    _MMG5_SAFE_FREE(posNodeData);
+    _MMG5_freeMshFile(&msh);
     return(-1);
   }
 
 
   if (mesh->npmax < mesh->np || mesh->ntmax < mesh->nt ) {
-    fclose(inm);
-    _MMG5_SAFE_FREE(posNodeData);
+    _MMG5_freeMshFile(&msh);
     return(-1);
   }
 
-  ier = MMG5_loadMshMesh_part2( mesh, &sol,&inm,
-                                posNodes,posElts,posNodeData,
-                                bin,iswp,nelts);
-  _MMG5_SAFE_FREE(posNodeData);
+  ier = MMG5_loadMshMesh_part2(mesh,&sol,&msh);
   if ( ier < 1 ) return ( ier );
 
   /* Check the metric type */
-  ier = MMG5_chkMetricType(mesh,&sol->type,inm);
+  ier = MMG5_chkMetricType(mesh,&sol->type,NULL);
 
   /* No metric in the input file but we will automatically compute it */
   if ( !mesh->nsols ) mesh->nsols=1;
@@ -732,27 +539,22 @@ int MMGS_loadMshMesh(MMG5_pMesh mesh,MMG5_pSol sol,const char *filename) {
 
 
 int MMGS_loadMshMesh_and_allData(MMG5_pMesh mesh,MMG5_pSol *sol,const char *filename) {
-  FILE*       inm;
-  long        posNodes,posElts,*posNodeData;
-  int         ier,bin,iswp,nelts,nsols;
+  _MMG5_MshFile msh;
+  int         ier;
 
   mesh->dim = 3;
 
-  ier = MMG5_loadMshMesh_part1(mesh,filename,&inm,
-                               &posNodes,&posElts,&posNodeData,
-                               &bin,&iswp,&nelts,&nsols);
+  ier = MMG5_loadMshMesh_part1(mesh,filename,&msh);
   if ( ier < 1 )  return (ier);
 
   if ( *sol )  _MMG5_DEL_MEM(mesh,*sol,(mesh->nsols)*sizeof(MMG5_Sol));
-  _MMG5_ADD_MEM(mesh,nsols*sizeof(MMG5_Sol),"solutions array",
-                printf("  Exit program.\n"); fclose(inm);
-                _MMG5_SAFE_FREE(posNodeData);
+  _MMG5_ADD_MEM(mesh,msh.nsols*sizeof(MMG5_Sol),"solutions array",
+                printf("  Exit program.\n"); _MMG5_freeMshFile(&msh);
                 return -1);
-  _MMG5_SAFE_CALLOC(*sol,nsols,MMG5_Sol,-1);
+  _MMG5_SAFE_CALLOC(*sol,msh.nsols,MMG5_Sol,-1);
 
   if ( !_MMGS_zaldy(mesh) ) {
-    fclose(inm);
-    _MMG5_SAFE_FREE(posNodeData);
+    _MMG5_freeMshFile(&msh);
     return(0);
   }
 
@@ -762,26 +564,49 @@ int MMGS_loadMshMesh_and_allData(MMG5_pMesh mesh,MMG5_pSol *sol,const char *file
     fprintf(stderr,"  ** MISSING DATA.\n");
     fprintf(stderr," Check that your mesh contains triangles.\n");
     fprintf(stderr," Exit program.\n");
-    fclose(inm);
-    _MMG5_SAFE_FREE(posNodeData);
+    _MMG5_freeMshFile(&msh);
     return(-1);
   }
 
 
   if (mesh->npmax < mesh->np || mesh->ntmax < mesh->nt ) {
-    fclose(inm);
-    _MMG5_SAFE_FREE(posNodeData);
+    _MMG5_freeMshFile(&msh);
     return(-1);
   }
 
-  ier = MMG5_loadMshMesh_part2( mesh, sol,&inm,
-                                posNodes,posElts,posNodeData,
-                                bin,iswp,nelts);
-  _MMG5_SAFE_FREE(posNodeData);
+  ier = MMG5_loadMshMesh_part2(mesh,sol,&msh);
 
   return ier;
 }
 
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param data unused.
+ * \param k index of the triangle.
+ * \param buf buffer in which we write.
+ * \return the number of written characters (0 if the triangle is unused).
+ *
+ * Format the triangle \a k for the \a Triangles field of a \a .mesh file.
+ *
+ */
+static int _MMGS_asciiTria(MMG5_pMesh mesh,void *data,MMG5_int k,char *buf) {
+  MMG5_pTria pt;
+  int        i,len;
+
+  pt = &mesh->tria[k];
+  if ( !MG_EOK(pt) )  return(0);
+
+  len = 0;
+  for ( i=0; i<3; ++i ) {
+    len += _MMG5_fmtInt(buf+len,mesh->point[pt->v[i]].tmp);
+    buf[len++] = ' ';
+  }
+  len += _MMG5_fmtInt(buf+len,abs(pt->ref));
+  buf[len++] = '\n';
+
+  return(len);
+}
+
 /**
  * \param mesh pointer toward the mesh structure.
  * \param filename name of file.
@@ -798,8 +623,9 @@ int MMGS_saveMesh(MMG5_pMesh mesh, const char* filename) {
   MMG5_pPoint  ppt;
   MMG5_pTria   pt;
   MMG5_pxPoint go;
-  int          k,np,nt,nc,ng,nn,nr,nre;
-  int          bin,binch,bpos;
+  MMG5_int     np,nt,nc,ng,nn,nr,nre,k;
+  int          bin,binch;
+  int64_t      bpos;
   // int          outm;
   char         *data,*ptr,chaine[128];
 
@@ -861,7 +687,7 @@ int MMGS_saveMesh(MMG5_pMesh mesh, const char* filename) {
     binch = 3; //Dimension
     fwrite(&binch,sw,1,inm);
     bpos = 20; //Pos
-    fwrite(&bpos,sw,1,inm);
+    _MMG5_FWRITE_POS(bpos,inm,return(0));
     binch = 3;
     fwrite(&binch,sw,1,inm);
 
@@ -883,20 +709,24 @@ int MMGS_saveMesh(MMG5_pMesh mesh, const char* filename) {
   if(!bin) {
     strcpy(&chaine[0],"\n\nVertices\n");
     fprintf(inm,"%s",chaine);
-    fprintf(inm,"%d\n",np);
+    fprintf(inm,"%" MMG5_PRId "\n",np);
   } else {
     binch = 4; //Vertices
     fwrite(&binch,sw,1,inm);
-    bpos += 12+(1+3*mesh->ver)*4*np; //NullPos
-    fwrite(&bpos,sw,1,inm);
-    fwrite(&np,sw,1,inm);
+    bpos += 12+(1+3*mesh->ver)*4*(int64_t)np; //NullPos
+    _MMG5_FWRITE_POS(bpos,inm,return(0));
+    _MMG5_FWRITE_IDX(np,inm);
+  }
+  if ( !bin && !_MMG5_saveAsciiRecords(mesh,inm,mesh->np,
+                                       3*_MMG5_ASCIIDBL+_MMG5_ASCIIINT,
+                                       _MMG5_asciiVertex3D,NULL) ) {
+    fclose(inm);
+    return(0);
   }
   for (k=1; k<=mesh->np; k++) {
     ppt = &mesh->point[k];
     if ( MG_VOK(ppt) ) {
-      if(!bin) {
-        fprintf(inm,"%.15lg %.15lg %.15lg %d\n",ppt->c[0],ppt->c[1],ppt->c[2],abs(ppt->ref));
-      } else {
+      if(bin) {
         fwrite((unsigned char*)&ppt->c[0],sd,1,inm);
         fwrite((unsigned char*)&ppt->c[1],sd,1,inm);
         fwrite((unsigned char*)&ppt->c[2],sd,1,inm);
@@ -918,25 +748,28 @@ int MMGS_saveMesh(MMG5_pMesh mesh, const char* filename) {
   if(!bin) {
     strcpy(&chaine[0],"\n\nTriangles\n");
     fprintf(inm,"%s",chaine);
-    fprintf(inm,"%d \n",nt);
+    fprintf(inm,"%" MMG5_PRId " \n",nt);
   } else {
     binch = 6; //Triangles
     fwrite(&binch,sw,1,inm);
-    bpos += 12+16*nt; //Pos
-    fwrite(&bpos,sw,1,inm);
-    fwrite(&nt,sw,1,inm);
+    bpos += 12+16*(int64_t)nt; //Pos
+    _MMG5_FWRITE_POS(bpos,inm,return(0));
+    _MMG5_FWRITE_IDX(nt,inm);
   }
 
-  for (k=1; k<=mesh->nt; k++) {
-    pt = &mesh->tria[k];
-    if ( MG_EOK(pt) ) {
-      if(!bin) {
-        fprintf(inm,"%d %d %d %d\n",mesh->point[pt->v[0]].tmp,mesh->point[pt->v[1]].tmp
-                ,mesh->point[pt->v[2]].tmp,abs(pt->ref));
-      } else {
-        fwrite(&mesh->point[pt->v[0]].tmp,sw,1,inm);
-        fwrite(&mesh->point[pt->v[1]].tmp,sw,1,inm);
-        fwrite(&mesh->point[pt->v[2]].tmp,sw,1,inm);
+  if(!bin) {
+    if ( !_MMG5_saveAsciiRecords(mesh,inm,mesh->nt,4*_MMG5_ASCIIINT,
+                                 _MMGS_asciiTria,NULL) ) {
+      fclose(inm);
+      return(0);
+    }
+  } else {
+    for (k=1; k<=mesh->nt; k++) {
+      pt = &mesh->tria[k];
+      if ( MG_EOK(pt) ) {
+        _MMG5_FWRITE_IDX(mesh->point[pt->v[0]].tmp,inm);
+        _MMG5_FWRITE_IDX(mesh->point[pt->v[1]].tmp,inm);
+        _MMG5_FWRITE_IDX(mesh->point[pt->v[2]].tmp,inm);
         pt->ref = abs(pt->ref);
         fwrite(&pt->ref,sw,1,inm);
       }
@@ -948,21 +781,21 @@ int MMGS_saveMesh(MMG5_pMesh mesh, const char* filename) {
     if(!bin) {
       strcpy(&chaine[0],"\n\nCorners\n");
       fprintf(inm,"%s",chaine);
-      fprintf(inm,"%d\n",nc);
+      fprintf(inm,"%" MMG5_PRId "\n",nc);
     } else {
       binch = 13; //
       fwrite(&binch,sw,1,inm);
-      bpos += 12+4*nc; //NullPos
-      fwrite(&bpos,sw,1,inm);
-      fwrite(&nc,sw,1,inm);
+      bpos += 12+4*(int64_t)nc; //NullPos
+      _MMG5_FWRITE_POS(bpos,inm,return(0));
+      _MMG5_FWRITE_IDX(nc,inm);
     }
     for (k=1; k<=mesh->np; k++) {
       ppt = &mesh->point[k];
       if ( MG_VOK(ppt) && ppt->tag & MG_CRN ) {
         if(!bin) {
-          fprintf(inm,"%d \n",ppt->tmp);
+          fprintf(inm,"%" MMG5_PRId " \n",ppt->tmp);
         } else {
-          fwrite(&ppt->tmp,sw,1,inm);
+          _MMG5_FWRITE_IDX(ppt->tmp,inm);
         }
       }
     }
@@ -971,21 +804,21 @@ int MMGS_saveMesh(MMG5_pMesh mesh, const char* filename) {
     if(!bin) {
       strcpy(&chaine[0],"\n\nRequiredVertices\n");
       fprintf(inm,"%s",chaine);
-      fprintf(inm,"%d\n",nre);
+      fprintf(inm,"%" MMG5_PRId "\n",nre);
     } else {
       binch = 15; //
       fwrite(&binch,sw,1,inm);
-      bpos += 12+4*nre; //NullPos
-      fwrite(&bpos,sw,1,inm);
-      fwrite(&nre,sw,1,inm);
+      bpos += 12+4*(int64_t)nre; //NullPos
+      _MMG5_FWRITE_POS(bpos,inm,return(0));
+      _MMG5_FWRITE_IDX(nre,inm);
     }
     for (k=1; k<=mesh->np; k++) {
       ppt = &mesh->point[k];
       if ( MG_VOK(ppt) && ppt->tag & MG_REQ ) {
         if(!bin) {
-          fprintf(inm,"%d \n",ppt->tmp);
+          fprintf(inm,"%" MMG5_PRId " \n",ppt->tmp);
         } else {
-          fwrite(&ppt->tmp,sw,1,inm);
+          _MMG5_FWRITE_IDX(ppt->tmp,inm);
         }
       }
     }
@@ -996,22 +829,22 @@ int MMGS_saveMesh(MMG5_pMesh mesh, const char* filename) {
     if(!bin) {
       strcpy(&chaine[0],"\n\nEdges\n");
       fprintf(inm,"%s",chaine);
-      fprintf(inm,"%d\n",mesh->na);
+      fprintf(inm,"%" MMG5_PRId "\n",mesh->na);
     } else {
       binch = 5; //Edges
       fwrite(&binch,sw,1,inm);
-      bpos += 12 + 3*4*mesh->na;//Pos
-      fwrite(&bpos,sw,1,inm);
-      fwrite(&mesh->na,sw,1,inm);
+      bpos += 12 + 3*4*(int64_t)mesh->na;//Pos
+      _MMG5_FWRITE_POS(bpos,inm,return(0));
+      _MMG5_FWRITE_IDX(mesh->na,inm);
     }
     nre = nr = 0;
     for (k=1; k<=mesh->na; k++) {
       if(!bin) {
-        fprintf(inm,"%d %d %d \n",
+        fprintf(inm,"%" MMG5_PRId " %" MMG5_PRId " %d \n",
                 mesh->edge[k].a,mesh->edge[k].b,mesh->edge[k].ref);
       } else {
-        fwrite(&mesh->edge[k].a,sw,1,inm);
-        fwrite(&mesh->edge[k].b,sw,1,inm);
+        _MMG5_FWRITE_IDX(mesh->edge[k].a,inm);
+        _MMG5_FWRITE_IDX(mesh->edge[k].b,inm);
         fwrite(&mesh->edge[k].ref,sw,1,inm);
       }
       if ( mesh->edge[k].tag & MG_REQ )  nre++;
@@ -1022,20 +855,20 @@ int MMGS_saveMesh(MMG5_pMesh mesh, const char* filename) {
       if(!bin) {
         strcpy(&chaine[0],"\n\nRidges\n");
         fprintf(inm,"%s",chaine);
-        fprintf(inm,"%d\n",nr);
+        fprintf(inm,"%" MMG5_PRId "\n",nr);
       } else {
         binch = 14; //Ridges
         fwrite(&binch,sw,1,inm);
-        bpos += 12 + 4*nr;//Pos
-        fwrite(&bpos,sw,1,inm);
-        fwrite(&nr,sw,1,inm);
+        bpos += 12 + 4*(int64_t)nr;//Pos
+        _MMG5_FWRITE_POS(bpos,inm,return(0));
+        _MMG5_FWRITE_IDX(nr,inm);
       }
       for (k=1; k<=mesh->na; k++) {
         if ( mesh->edge[k].tag & MG_GEO ) {
           if(!bin) {
-            fprintf(inm,"%d \n",k);
+            fprintf(inm,"%" MMG5_PRId " \n",k);
           } else {
-            fwrite(&k,sw,1,inm);
+            _MMG5_FWRITE_IDX(k,inm);
           }
         }
       }
@@ -1044,20 +877,20 @@ int MMGS_saveMesh(MMG5_pMesh mesh, const char* filename) {
       if(!bin) {
         strcpy(&chaine[0],"\n\nRequiredEdges\n");
         fprintf(inm,"%s",chaine);
-        fprintf(inm,"%d\n",nre);
+        fprintf(inm,"%" MMG5_PRId "\n",nre);
       } else {
         binch = 16; //RequiredEdges
         fwrite(&binch,sw,1,inm);
-        bpos += 12 + 4*nre;//Pos
-        fwrite(&bpos,sw,1,inm);
-        fwrite(&nre,sw,1,inm);
+        bpos += 12 + 4*(int64_t)nre;//Pos
+        _MMG5_FWRITE_POS(bpos,inm,return(0));
+        _MMG5_FWRITE_IDX(nre,inm);
       }
       for (k=1; k<=mesh->na; k++)
         if ( mesh->edge[k].tag & MG_REQ )  {
           if(!bin) {
-            fprintf(inm,"%d \n",k);
+            fprintf(inm,"%" MMG5_PRId " \n",k);
           } else {
-            fwrite(&k,sw,1,inm);
+            _MMG5_FWRITE_IDX(k,inm);
           }
         }
     }
@@ -1068,13 +901,13 @@ int MMGS_saveMesh(MMG5_pMesh mesh, const char* filename) {
     if(!bin) {
       strcpy(&chaine[0],"\n\nNormals\n");
       fprintf(inm,"%s",chaine);
-      fprintf(inm,"%d\n",nn);
+      fprintf(inm,"%" MMG5_PRId "\n",nn);
     } else {
       binch = 60; //normals
       fwrite(&binch,sw,1,inm);
-      bpos += 12+(3*mesh->ver)*4*nn; //Pos
-      fwrite(&bpos,sw,1,inm);
-      fwrite(&nn,sw,1,inm);
+      bpos += 12+(3*mesh->ver)*4*(int64_t)nn; //Pos
+      _MMG5_FWRITE_POS(bpos,inm,return(0));
+      _MMG5_FWRITE_IDX(nn,inm);
     }
     for (k=1; k<=mesh->np; k++) {
       ppt = &mesh->point[k];
@@ -1105,24 +938,24 @@ int MMGS_saveMesh(MMG5_pMesh mesh, const char* filename) {
     if(!bin) {
       strcpy(&chaine[0],"\n\nNormalAtVertices\n");
       fprintf(inm,"%s",chaine);
-      fprintf(inm,"%d\n",nn);
+      fprintf(inm,"%" MMG5_PRId "\n",nn);
     } else {
       binch = 20; //normalatvertices
       fwrite(&binch,sw,1,inm);
-      bpos += 12 + 2*4*nn;//Pos
-      fwrite(&bpos,sw,1,inm);
-      fwrite(&nn,sw,1,inm);
+      bpos += 12 + 2*4*(int64_t)nn;//Pos
+      _MMG5_FWRITE_POS(bpos,inm,return(0));
+      _MMG5_FWRITE_IDX(nn,inm);
     }
     nn = 0;
     for (k=1; k<=mesh->np; k++) {
       ppt = &mesh->point[k];
       if ( MG_VOK(ppt) && !((ppt->tag & MG_GEO) || (ppt->tag & MG_CRN) ) ) {
         if(!bin) {
-          fprintf(inm,"%d %d\n",ppt->tmp,++nn);
+          fprintf(inm,"%" MMG5_PRId " %" MMG5_PRId "\n",ppt->tmp,++nn);
         } else {
-          fwrite(&ppt->tmp,sw,1,inm);
+          _MMG5_FWRITE_IDX(ppt->tmp,inm);
           ++nn;
-          fwrite(&nn,sw,1,inm);
+          _MMG5_FWRITE_IDX(nn,inm);
         }
       }
     }
@@ -1154,13 +987,13 @@ int MMGS_saveMesh(MMG5_pMesh mesh, const char* filename) {
     if(!bin) {
       strcpy(&chaine[0],"\n\nTangents\n");
       fprintf(inm,"%s",chaine);
-      fprintf(inm,"%d\n",ng);
+      fprintf(inm,"%" MMG5_PRId "\n",ng);
     } else {
       binch = 59; //tangent
       fwrite(&binch,sw,1,inm);
-      bpos += 12+(3*mesh->ver)*4*ng; //Pos
-      fwrite(&bpos,sw,1,inm);
-      fwrite(&ng,sw,1,inm);
+      bpos += 12+(3*mesh->ver)*4*(int64_t)ng; //Pos
+      _MMG5_FWRITE_POS(bpos,inm,return(0));
+      _MMG5_FWRITE_IDX(ng,inm);
     }
     for (k=1; k<=mesh->np; k++) {
       ppt = &mesh->point[k];
@@ -1177,37 +1010,37 @@ int MMGS_saveMesh(MMG5_pMesh mesh, const char* filename) {
     if(!bin) {
       strcpy(&chaine[0],"\n\nTangentAtVertices\n");
       fprintf(inm,"%s",chaine);
-      fprintf(inm,"%d\n",ng);
+      fprintf(inm,"%" MMG5_PRId "\n",ng);
     } else {
       binch = 61; //tangentatvertices
       fwrite(&binch,sw,1,inm);
-      bpos += 12 + 2*4*ng;//Pos
-      fwrite(&bpos,sw,1,inm);
-      fwrite(&ng,sw,1,inm);
+      bpos += 12 + 2*4*(int64_t)ng;//Pos
+      _MMG5_FWRITE_POS(bpos,inm,return(0));
+      _MMG5_FWRITE_IDX(ng,inm);
     }
     ng = 0;
     for (k=1; k<=mesh->np; k++) {
       ppt = &mesh->point[k];
       if ( MG_VOK(ppt) && MG_EDG(ppt->tag) ) {
         if(!bin) {
-          fprintf(inm,"%d %d\n",ppt->tmp,++ng);
+          fprintf(inm,"%" MMG5_PRId " %" MMG5_PRId "\n",ppt->tmp,++ng);
         } else {
-          fwrite(&ppt->tmp,sw,1,inm);
+          _MMG5_FWRITE_IDX(ppt->tmp,inm);
           ++ng;
-          fwrite(&(ng),sw,1,inm);
+          _MMG5_FWRITE_IDX(ng,inm);
         }
       }
     }
   }
 
   if ( abs(mesh->info.imprim) > 4 ) {
-    fprintf(stdout,"     NUMBER OF VERTICES   %8d  CORNERS    %6d\n",np,nc);
-    fprintf(stdout,"     NUMBER OF TRIANGLES  %8d\n",nt);
+    fprintf(stdout,"     NUMBER OF VERTICES   %8" MMG5_PRId "  CORNERS    %6" MMG5_PRId "\n",np,nc);
+    fprintf(stdout,"     NUMBER OF TRIANGLES  %8" MMG5_PRId "\n",nt);
 
     if ( mesh->na )
-      fprintf(stdout,"     NUMBER OF EDGES      %8d  RIDGES     %6d\n",mesh->na,nr);
+      fprintf(stdout,"     NUMBER OF EDGES      %8" MMG5_PRId "  RIDGES     %6" MMG5_PRId "\n",mesh->na,nr);
     if ( nn+ng )
-      fprintf(stdout,"     NUMBER OF NORMALS    %8d  TANGENTS   %6d\n",nn,ng);
+      fprintf(stdout,"     NUMBER OF NORMALS    %8" MMG5_PRId "  TANGENTS   %6" MMG5_PRId "\n",nn,ng);
   }
   /*fin fichier*/
   if(!bin) {
@@ -1244,8 +1077,10 @@ int MMGS_loadSol(MMG5_pMesh mesh,MMG5_pSol met,const char* filename) {
 
   FILE       *inm;
   long        posnp;
-  int         iswp,ier,dim;
-  int         k,ver,bin,np,nsols,*type;
+  int         iswp,ier;
+  MMG5_int    dim;
+  int         ver,bin,nsols,*type;
+  MMG5_int    k,np;
 
   /** Read the file header */
   ier =  MMG5_loadSolHeader(filename,3,&inm,&ver,&bin,&iswp,&np,&dim,&nsols,
@@ -1262,8 +1097,8 @@ int MMGS_loadSol(MMG5_pMesh mesh,MMG5_pSol met,const char* filename) {
 
   if ( mesh->np != np ) {
     fprintf(stderr,"  ** MISMATCHES DATA: THE NUMBER OF VERTICES IN "
-            "THE MESH (%d) DIFFERS FROM THE NUMBER OF VERTICES IN "
-            "THE SOLUTION (%d) \n",mesh->np,np);
+            "THE MESH (%" MMG5_PRId ") DIFFERS FROM THE NUMBER OF VERTICES IN "
+            "THE SOLUTION (%" MMG5_PRId ") \n",mesh->np,np);
     fclose(inm);
     _MMG5_SAFE_FREE(type);
     return(-1);
@@ -1282,20 +1117,28 @@ int MMGS_loadSol(MMG5_pMesh mesh,MMG5_pSol met,const char* filename) {
   if ( ver ) met->ver = ver;
 
   /* Read mesh solutions */
-  rewind(inm);
-  fseek(inm,posnp,SEEK_SET);
-
-  /* isotropic metric */
-  if ( met->ver == 1 ) {
-    /* Simple precision */
-    for (k=1; k<=mesh->np; k++) {
-      MMG5_readFloatSol3D(met,inm,bin,iswp,k);
+  if ( bin ) {
+    if ( !MMG5_readBinSols(met,1,inm,posnp) ) {
+      fclose(inm);
+      return(-1);
     }
   }
   else {
-    /* Double precision */
-    for (k=1; k<=mesh->np; k++) {
-      MMG5_readDoubleSol3D(met,inm,bin,iswp,k);
+    rewind(inm);
+    fseek(inm,posnp,SEEK_SET);
+
+    /* isotropic metric */
+    if ( met->ver == 1 ) {
+      /* Simple precision */
+      for (k=1; k<=mesh->np; k++) {
+        MMG5_readFloatSol3D(met,inm,bin,iswp,k);
+      }
+    }
+    else {
+      /* Double precision */
+      for (k=1; k<=mesh->np; k++) {
+        MMG5_readDoubleSol3D(met,inm,bin,iswp,k);
+      }
     }
   }
 
@@ -1320,10 +1163,12 @@ int MMGS_loadAllSols(MMG5_pMesh mesh,MMG5_pSol *sol, const char *filename) {
   MMG5_pSol   psl;
   FILE       *inm;
   long        posnp;
-  int         iswp,ier,dim;
-  int         j,k,ver,bin,np,nsols,*type;
+  int         iswp,ier;
+  MMG5_int    dim;
+  int         j,ver,bin,nsols,*type;
+  MMG5_int    k,np;
   char        data[10];
-  static char mmgWarn = 0;
+  static _MMG5_TLS char mmgWarn = 0;
 
   /** Read the file header */
   ier =  MMG5_loadSolHeader(filename,3,&inm,&ver,&bin,&iswp,&np,&dim,&nsols,
@@ -1332,8 +1177,8 @@ int MMGS_loadAllSols(MMG5_pMesh mesh,MMG5_pSol *sol, const char *filename) {
 
   if ( mesh->np != np ) {
     fprintf(stderr,"  ** MISMATCHES DATA: THE NUMBER OF VERTICES IN "
-            "THE MESH (%d) DIFFERS FROM THE NUMBER OF VERTICES IN "
-            "THE SOLUTION (%d) \n",mesh->np,np);
+            "THE MESH (%" MMG5_PRId ") DIFFERS FROM THE NUMBER OF VERTICES IN "
+            "THE SOLUTION (%" MMG5_PRId ") \n",mesh->np,np);
     fclose(inm);
     _MMG5_SAFE_FREE(type);
     return(-1);
@@ -1383,27 +1228,36 @@ int MMGS_loadAllSols(MMG5_pMesh mesh,MMG5_pSol *sol, const char *filename) {
   _MMG5_SAFE_FREE(type);
 
   /* read mesh solutions */
-  rewind(inm);
-  fseek(inm,posnp,SEEK_SET);
-
-  if ( (*sol)[0].ver == 1 ) {
-    /* Simple precision */
-    for (k=1; k<=mesh->np; k++) {
-      for ( j=0; j<nsols; ++j ) {
-        psl = *sol + j;
-        MMG5_readFloatSol3D(psl,inm,bin,iswp,k);
-      }
+  if ( bin ) {
+    if ( !MMG5_readBinSols(*sol,nsols,inm,posnp) ) {
+      fclose(inm);
+      return(-1);
     }
   }
   else {
-    /* Double precision */
-    for (k=1; k<=mesh->np; k++) {
-      for ( j=0; j<nsols; ++j ) {
-        psl = *sol + j;
-        MMG5_readDoubleSol3D(psl,inm,bin,iswp,k);
+    rewind(inm);
+    fseek(inm,posnp,SEEK_SET);
+
+    if ( (*sol)[0].ver == 1 ) {
+      /* Simple precision */
+      for (k=1; k<=mesh->np; k++) {
+        for ( j=0; j<nsols; ++j ) {
+          psl = *sol + j;
+          MMG5_readFloatSol3D(psl,inm,bin,iswp,k);
+        }
+      }
+    }
+    else {
+      /* Double precision */
+      for (k=1; k<=mesh->np; k++) {
+        for ( j=0; j<nsols; ++j ) {
+          psl = *sol + j;
+          MMG5_readDoubleSol3D(psl,inm,bin,iswp,k);
+        }
       }
     }
   }
+
   fclose(inm);
 
   /* stats */
@@ -1424,7 +1278,8 @@ int MMGS_loadAllSols(MMG5_pMesh mesh,MMG5_pSol *sol, const char *filename) {
 int MMGS_saveSol(MMG5_pMesh mesh,MMG5_pSol met, const char *filename) {
   FILE*        inm;
   MMG5_pPoint  ppt;
-  int          binch,bin,ier,k;
+  int          binch,bin,ier;
+  MMG5_int     k;
 
   if ( !met->m )  return(-1);
 
@@ -1435,12 +1290,20 @@ int MMGS_saveSol(MMG5_pMesh mesh,MMG5_pSol met, const char *filename) {
 
   if ( ier < 1 )  return ier;
 
-  for (k=1; k<=mesh->np; k++) {
-    ppt = &mesh->point[k];
-    if ( !MG_VOK(ppt) ) continue;
+  if(!bin) {
+    if ( !MMG5_saveAsciiSols(mesh,met,1,inm,1) ) {
+      fclose(inm);
+      return(0);
+    }
+  }
+  else {
+    for (k=1; k<=mesh->np; k++) {
+      ppt = &mesh->point[k];
+      if ( !MG_VOK(ppt) ) continue;
 
-    MMG5_writeDoubleSol3D(mesh,met,inm,bin,k,1);
-    fprintf(inm,"\n");
+      MMG5_writeDoubleSol3D(mesh,met,inm,bin,k,1);
+      fprintf(inm,"\n");
+    }
   }
 
   /*fin fichier*/
@@ -1467,7 +1330,8 @@ int MMGS_saveAllSols(MMG5_pMesh mesh,MMG5_pSol *sol, const char *filename) {
   MMG5_pSol    psl;
   FILE*        inm;
   MMG5_pPoint  ppt;
-  int          binch,bin,ier,k,j;
+  int          binch,bin,ier,j;
+  MMG5_int     k;
   int          *type,*size;
 
   if ( !(*sol)[0].m )  return(-1);
@@ -1489,15 +1353,23 @@ int MMGS_saveAllSols(MMG5_pMesh mesh,MMG5_pSol *sol, const char *filename) {
 
   if ( ier < 1 )  return ier;
 
-  for (k=1; k<=mesh->np; k++) {
-    ppt = &mesh->point[k];
-    if ( !MG_VOK(ppt) ) continue;
+  if(!bin) {
+    if ( !MMG5_saveAsciiSols(mesh,*sol,mesh->nsols,inm,0) ) {
+      fclose(inm);
+      return(0);
+    }
+  }
+  else {
+    for (k=1; k<=mesh->np; k++) {
+      ppt = &mesh->point[k];
+      if ( !MG_VOK(ppt) ) continue;
 
-    for ( j=0; j<mesh->nsols; ++j ) {
-      psl = *sol+j;
-      MMG5_writeDoubleSol3D(mesh,psl,inm,bin,k,0);
+      for ( j=0; j<mesh->nsols; ++j ) {
+        psl = *sol+j;
+        MMG5_writeDoubleSol3D(mesh,psl,inm,bin,k,0);
+      }
+      fprintf(inm,"\n");
     }
-    fprintf(inm,"\n");
   }
 
   /* End file */
@@ -35,7 +35,6 @@
 
 #include "mmgs.h"
 
-extern char ddb;
 
 
 
@@ -54,7 +53,7 @@ extern char ddb;
  * \f$ p_1-p_2 \f$ must not be a ridge.
  *
  * */
-int intregmet(MMG5_pMesh mesh,MMG5_pSol met,int k,char i,double s,double mr[6]) {
+int intregmet(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,char i,double s,double mr[6]) {
   MMG5_pTria     pt;
 
   pt  = &mesh->tria[k];
@@ -74,9 +73,9 @@ int intregmet(MMG5_pMesh mesh,MMG5_pSol met,int k,char i,double s,double mr[6])
  * Linear interpolation of sizemap along edge i of tria k.
  *
  */
-int intmet_iso(MMG5_pMesh mesh,MMG5_pSol met,int k,char i,int ip,double s) {
+int intmet_iso(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,char i,MMG5_int ip,double s) {
   MMG5_pTria  pt;
-  int    ip1,ip2;
+  MMG5_int ip1,ip2;
   char   i1,i2;
 
   pt  = &mesh->tria[k];
@@ -101,12 +100,13 @@ int intmet_iso(MMG5_pMesh mesh,MMG5_pSol met,int k,char i,int ip,double s) {
  * \a k for special storage of ridges metrics (after defsiz call).
  *
  */
-int intmet_ani(MMG5_pMesh mesh,MMG5_pSol met,int k,char i,int ip,double s) {
+int intmet_ani(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,char i,MMG5_int ip,double s) {
   MMG5_pTria    pt;
   MMG5_pPoint   ppt;
   MMG5_pxPoint  go;
   double        *m;
-  int           ip1, ip2, i1, i2;
+  int           i1, i2;
+  MMG5_int      ip1,ip2;
 
   pt  = &mesh->tria[k];
   i1  = _MMG5_inxt2[i];
@@ -140,10 +140,11 @@ int intmet_ani(MMG5_pMesh mesh,MMG5_pSol met,int k,char i,int ip,double s) {
  * \a k for classic storage of ridges metrics (before defsiz call).
  *
  */
-int _MMGS_intmet33_ani(MMG5_pMesh mesh,MMG5_pSol met,int k,char i,int ip,double s) {
+int _MMGS_intmet33_ani(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,char i,MMG5_int ip,double s) {
   MMG5_pTria    pt;
   double        *mr,*m,*n;
-  int           ip1, ip2, i1, i2;
+  int           i1, i2;
+  MMG5_int      ip1,ip2;
 
   pt  = &mesh->tria[k];
   i1  = _MMG5_inxt2[i];
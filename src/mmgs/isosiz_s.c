@@ -54,7 +54,8 @@ int _MMGS_defsiz_iso(MMG5_pMesh mesh,MMG5_pSol met) {
   MMG5_pPar     par;
   double   n[3][3],t[3][3],nt[3],c1[3],c2[3],*n1,*n2,*t1,*t2;
   double   ps,ps2,ux,uy,uz,ll,l,lm,dd,M1,M2,hausd,hmin,hmax;
-  int      k,j,ip1,ip2,isloc;
+  int      j,isloc;
+  MMG5_int k,ip1,ip2;
   char     i,i1,i2;
 
   if ( abs(mesh->info.imprim) > 5 || mesh->info.ddebug )
@@ -261,7 +262,8 @@ int gradsiz_iso(MMG5_pMesh mesh,MMG5_pSol met) {
   MMG5_pTria    pt;
   MMG5_pPoint   p1,p2;
   double   ll,hn,h1,h2;
-  int      k,nu,nup,it,maxit,ip1,ip2;
+  int      nu,nup,it,maxit;
+  MMG5_int k,ip1,ip2;
   char     i,i1,i2;
 
   if ( abs(mesh->info.imprim) > 5 || mesh->info.ddebug )
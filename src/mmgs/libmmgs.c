@@ -59,11 +59,11 @@
 /** Free adja, xtetra and xpoint tables */
 static inline
 void _MMGS_Free_topoTables(MMG5_pMesh mesh) {
-  int k;
+  MMG5_int k;
 
   mesh->xp = 0;
   if ( mesh->adja )
-    _MMG5_DEL_MEM(mesh,mesh->adja,(3*mesh->ntmax+5)*sizeof(int));
+    _MMG5_DEL_MEM(mesh,mesh->adja,(3*mesh->ntmax+5)*sizeof(MMG5_int));
 
   if ( mesh->xpoint )
     _MMG5_DEL_MEM(mesh,mesh->xpoint,(mesh->xpmax+1)*sizeof(MMG5_xPoint));
@@ -87,8 +87,10 @@ static inline
 int _MMGS_packMesh(MMG5_pMesh mesh,MMG5_pSol met) {
   MMG5_pTria    pt,ptnew;
   MMG5_pPoint   ppt,pptnew;
-  int           np,nc,nr, k,nt,nbl,imet,imetnew,i,na,jel;
-  int           iadr,iadrnew,iadrv,*adjav,*adja,*adjanew,voy;
+  int           np,nc,nr,nt,nbl,imetnew,i,na;
+  MMG5_int      k,imet,jel;
+  int           iadrnew,voy;
+  MMG5_int      iadr,*adjav,*adja,*adjanew,iadrv;
   char          i1,i2;
 
   /* compact vertices */
@@ -230,17 +232,17 @@ int _MMGS_packMesh(MMG5_pMesh mesh,MMG5_pSol met) {
     mesh->tria[k].v[2] = k+1;
 
   /* to could save the mesh, the adjacency have to be correct */
-  if ( mesh->info.ddebug && (!_MMG5_chkmsh(mesh,1,1) ) ) {
+  if ( mesh->info.ddebug && (!mesh->func.chkmsh(mesh,1,1) ) ) {
     fprintf(stderr,"\n  ##  Warning: %s: invalid mesh.\n",__func__);
     return(0);
   }
 
   if ( mesh->info.imprim > 0 ) {
-    fprintf(stdout,"     NUMBER OF VERTICES   %8d   CORNERS %8d\n",mesh->np,nc);
-    fprintf(stdout,"     NUMBER OF TRIANGLES  %8d\n",mesh->nt);
+    fprintf(stdout,"     NUMBER OF VERTICES   %8" MMG5_PRId "   CORNERS %8d\n",mesh->np,nc);
+    fprintf(stdout,"     NUMBER OF TRIANGLES  %8" MMG5_PRId "\n",mesh->nt);
 
     if ( mesh->na )
-      fprintf(stdout,"     NUMBER OF EDGES      %8d   RIDGES  %8d\n",mesh->na,nr);
+      fprintf(stdout,"     NUMBER OF EDGES      %8" MMG5_PRId "   RIDGES  %8d\n",mesh->na,nr);
   }
   return(1);
 }
@@ -254,7 +256,7 @@ int MMGS_mmgsls(MMG5_pMesh mesh,MMG5_pSol met)
     fprintf(stdout,"\n  %s\n   MODULE MMGS: %s (%s)\n  %s\n",MG_STR,MG_VER,MG_REL,MG_STR);
   }
 
-  _MMGS_Set_commonFunc();
+  _MMGS_Set_commonFunc(mesh);
 
   /** Free topologic tables (adja, xpoint, xtetra) resulting from a previous
    * run */
@@ -407,7 +409,7 @@ int MMGS_mmgslib(MMG5_pMesh mesh,MMG5_pSol met)
     fprintf(stdout,"\n  %s\n   MODULE MMGS: %s (%s)\n  %s\n",MG_STR,MG_VER,MG_REL,MG_STR);
   }
 
-  _MMGS_Set_commonFunc();
+  _MMGS_Set_commonFunc(mesh);
 
   /** Free topologic tables (adja, xpoint, xtetra) resulting from a previous
    * run */
@@ -38,28 +38,28 @@
 
 void MMGS_setfunc(MMG5_pMesh mesh,MMG5_pSol met) {
   if ( met->size < 6 ) {
-    _MMG5_calelt      = _MMG5_caltri_iso;
-    _MMG5_lenSurfEdg  = _MMG5_lenSurfEdg_iso;
-    _MMG5_defsiz      = _MMGS_defsiz_iso;
-    gradsiz           = gradsiz_iso;
-    intmet            = intmet_iso;
-    movintpt          = movintpt_iso;
-    movridpt          = movridpt_iso;
+    mesh->func.caltri       = _MMG5_caltri_iso;
+    mesh->func.lenSurfEdg   = _MMG5_lenSurfEdg_iso;
+    mesh->func.defsiz       = _MMGS_defsiz_iso;
+    mesh->func.gradsiz      = gradsiz_iso;
+    mesh->func.intmet       = intmet_iso;
+    mesh->func.movsurfintpt = movintpt_iso;
+    mesh->func.movridpt     = movridpt_iso;
   }
   else {
     if ( !met->m ) {
-      _MMG5_calelt     = _MMG5_caltri_iso;
-      _MMG5_lenSurfEdg = _MMG5_lenSurfEdg_iso;
+      mesh->func.caltri     = _MMG5_caltri_iso;
+      mesh->func.lenSurfEdg = _MMG5_lenSurfEdg_iso;
     }
     else {
-      _MMG5_calelt     = _MMG5_caltri_ani;
-      _MMG5_lenSurfEdg = _MMG5_lenSurfEdg_ani;
+      mesh->func.caltri     = _MMG5_caltri_ani;
+      mesh->func.lenSurfEdg = _MMG5_lenSurfEdg_ani;
     }
-    _MMG5_defsiz  = _MMGS_defsiz_ani;
-    gradsiz       = gradsiz_ani;
-    intmet        = intmet_ani;
-    movintpt      = movintpt_ani;
-    movridpt      = movridpt_ani;
+    mesh->func.defsiz       = _MMGS_defsiz_ani;
+    mesh->func.gradsiz      = gradsiz_ani;
+    mesh->func.intmet       = intmet_ani;
+    mesh->func.movsurfintpt = movintpt_ani;
+    mesh->func.movridpt     = movridpt_ani;
   }
 }
 
@@ -69,9 +69,8 @@ int MMGS_usage(char *prog) {
   fprintf(stdout,"-A           enable anisotropy (without metric file).\n");
   fprintf(stdout,"-keep-ref    preserve initial domain references in level-set mode.\n");
   fprintf(stdout,"-nreg        normal regul.\n");
-#ifdef USE_SCOTCH
-  fprintf(stdout,"-rn [n]      Turn on or off the renumbering using SCOTCH [0/1] \n");
-#endif
+  fprintf(stdout,"-rn [n]      Renumbering: 0 off, 1 with SCOTCH (if available),\n");
+  fprintf(stdout,"             2 along a Hilbert curve\n");
   fprintf(stdout,"\n\n");
 
   return 1;
@@ -85,6 +84,8 @@ int MMGS_defaultValues(MMG5_pMesh mesh) {
 #else
   fprintf(stdout,"SCOTCH renumbering                  : disabled\n");
 #endif
+  fprintf(stdout,"Renumbering (-rn)                   : %d\n",
+          mesh->info.renum);
   fprintf(stdout,"\n\n");
 
   return 1;
@@ -247,7 +248,6 @@ int MMGS_parsar(int argc,char *argv[],MMG5_pMesh mesh,MMG5_pSol met) {
           return 0;
         }
         break;
-#ifdef USE_SCOTCH
       case 'r':
         if ( !strcmp(argv[i],"-rn") ) {
           if ( ++i < argc ) {
@@ -268,7 +268,6 @@ int MMGS_parsar(int argc,char *argv[],MMG5_pMesh mesh,MMG5_pSol met) {
           }
         }
         break;
-#endif
       case 's':
         if ( !strcmp(argv[i],"-sol") ) {
           if ( ++i < argc && isascii(argv[i][0]) && argv[i][0]!='-' ) {
@@ -377,7 +376,7 @@ void MMGS_destockOptions(MMG5_pMesh mesh, MMG5_Info *info) {
   return;
 }
 
-int MMGS_Get_adjaTri(MMG5_pMesh mesh, int kel, int listri[3]) {
+int MMGS_Get_adjaTri(MMG5_pMesh mesh, MMG5_int kel, MMG5_int listri[3]) {
 
   if ( ! mesh->adja ) {
     if (! _MMGS_hashTria(mesh))
@@ -392,10 +391,11 @@ int MMGS_Get_adjaTri(MMG5_pMesh mesh, int kel, int listri[3]) {
 }
 
 inline
-int MMGS_Get_adjaVerticesFast(MMG5_pMesh mesh, int ip,int start, int lispoi[MMGS_LMAX])
+int MMGS_Get_adjaVerticesFast(MMG5_pMesh mesh, MMG5_int ip,MMG5_int start, MMG5_int lispoi[MMGS_LMAX])
 {
   MMG5_pTria pt;
-  int k,prevk,nbpoi,iploc,i,i1,i2,*adja;
+  int nbpoi,iploc,i1,i2;
+  MMG5_int k,*adja,prevk,i;
 
   pt   = &mesh->tria[start];
 
@@ -411,7 +411,7 @@ int MMGS_Get_adjaVerticesFast(MMG5_pMesh mesh, int ip,int start, int lispoi[MMGS
   do {
     if ( nbpoi == MMGS_LMAX ) {
       fprintf(stderr,"\n  ## Warning: %s: unable to compute adjacent"
-              " vertices of the vertex %d:\nthe ball of point contain too many"
+              " vertices of the vertex %" MMG5_PRId ":\nthe ball of point contain too many"
               " elements.\n",__func__,ip);
       return(0);
     }
@@ -432,7 +432,7 @@ int MMGS_Get_adjaVerticesFast(MMG5_pMesh mesh, int ip,int start, int lispoi[MMGS
   /* store the last point of the boundary triangle */
   if ( nbpoi == MMGS_LMAX ) {
     fprintf(stderr,"\n  ## Warning: %s: unable to compute adjacent vertices of the"
-            " vertex %d:\nthe ball of point contain too many elements.\n",
+            " vertex %" MMG5_PRId ":\nthe ball of point contain too many elements.\n",
             __func__,ip);
     return(0);
   }
@@ -451,7 +451,7 @@ int MMGS_Get_adjaVerticesFast(MMG5_pMesh mesh, int ip,int start, int lispoi[MMGS
 
     if ( nbpoi == MMGS_LMAX ) {
       fprintf(stderr,"\n  ## Warning: %s: unable to compute adjacent vertices of the"
-              " vertex %d:\nthe ball of point contain too many elements.\n",
+              " vertex %" MMG5_PRId ":\nthe ball of point contain too many elements.\n",
               __func__,ip);
       return(0);
     }
@@ -469,7 +469,8 @@ int MMGS_Get_adjaVerticesFast(MMG5_pMesh mesh, int ip,int start, int lispoi[MMGS
 int MMGS_Set_constantSize(MMG5_pMesh mesh,MMG5_pSol met) {
   MMG5_pPoint ppt;
   double      hsiz;
-  int         k,iadr,type;
+  int         type;
+  MMG5_int    k,iadr;
 
   /* Memory alloc */
   if ( met->size==1 ) type=1;
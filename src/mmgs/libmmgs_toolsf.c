@@ -104,7 +104,7 @@ FORTRAN_NAME(MMGS_DESTOCKOPTIONS,mmgs_destockoptions,
  * See \ref MMGS_Get_adjaTri function in \ref mmgs/libmmgs.h file.
  */
 FORTRAN_NAME(MMGS_GET_ADJATRI,mmgs_get_adjatri,
-               (MMG5_pMesh *mesh,int* kel, int* listri, int* retval),
+               (MMG5_pMesh *mesh,MMG5_int* kel, MMG5_int* listri, int* retval),
                (mesh,kel,listri,retval)) {
   *retval =  MMGS_Get_adjaTri(*mesh,*kel,listri);
   return;
@@ -114,7 +114,7 @@ FORTRAN_NAME(MMGS_GET_ADJATRI,mmgs_get_adjatri,
  * See \ref MMGS_Get_adjaVerticesFast function in \ref mmgs/libmmgs.h file.
  */
 FORTRAN_NAME(MMGS_GET_ADJAVERTICESFAST,mmgs_get_adjaverticesfast,
-               (MMG5_pMesh *mesh,int* ip, int *start, int* lispoi, int* retval),
+               (MMG5_pMesh *mesh,MMG5_int* ip, MMG5_int *start, MMG5_int* lispoi, int* retval),
                (mesh,ip,start,lispoi,retval)) {
   *retval =  MMGS_Get_adjaVerticesFast(*mesh,*ip, *start,lispoi);
   return;
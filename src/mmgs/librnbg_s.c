@@ -23,7 +23,7 @@
 
 /**
  * \file mmgs/librnbg_s.c
- * \brief Functions for scotch renumerotation.
+ * \brief Functions for scotch and space filling curve renumerotation.
  * \author Cedric Lachat (Inria/UBordeaux)
  * \version 5
  * \date 2013
@@ -32,10 +32,6 @@
 
 #include "mmgs.h"
 
-#ifdef USE_SCOTCH
-
-#include "librnbg.h"
-
 /**
  * \param trias pointer toward a table containing the tetra structures.
  * \param *perm pointer toward the permutation table (to perform in place
@@ -47,9 +43,9 @@
  *
  */
 static inline
-void _MMG5_swapTri(MMG5_pTria trias, int* perm, int ind1, int ind2) {
+void _MMG5_swapTri(MMG5_pTria trias, MMG5_int* perm, MMG5_int ind1, MMG5_int ind2) {
   MMG5_Tria pttmp;
-  int   tmp;
+  MMG5_int tmp;
 
   /* 2-- swap the triangles */
   memcpy(&pttmp       ,&trias[ind2],sizeof(MMG5_Tria));
@@ -62,6 +58,10 @@ void _MMG5_swapTri(MMG5_pTria trias, int* perm, int ind1, int ind2) {
   perm[ind1] = tmp;
 }
 
+#ifdef USE_SCOTCH
+
+#include "librnbg.h"
+
 /**
  * \param boxVertNbr number of vertices by box.
  * \param mesh pointer toward the mesh structure.
@@ -79,8 +79,10 @@ int _MMG5_mmgsRenumbering(int boxVertNbr, MMG5_pMesh mesh, MMG5_pSol sol) {
   SCOTCH_Num edgeNbr;
   SCOTCH_Num *vertTab, *edgeTab, *permVrtTab;
   SCOTCH_Graph graf ;
-  int    vertNbr, nodeGlbIdx, triaIdx, ballTriIdx;
-  int    i, j, k;
+  int    vertNbr, nodeGlbIdx, ballTriIdx;
+  MMG5_int triaIdx;
+  int    i;
+  MMG5_int j,k;
   int    edgeSiz;
   int    *vertOldTab, *permNodTab, ntreal, npreal;
   int    *adja,iadr;
@@ -201,7 +203,7 @@ int _MMG5_mmgsRenumbering(int boxVertNbr, MMG5_pMesh mesh, MMG5_pSol sol) {
   }
 
   /* free adjacents to gain memory space */
-  _MMG5_DEL_MEM(mesh,mesh->adja,(3*mesh->ntmax+5)*sizeof(int));
+  _MMG5_DEL_MEM(mesh,mesh->adja,(3*mesh->ntmax+5)*sizeof(MMG5_int));
 
   /* Building the graph by calling Scotch functions */
   SCOTCH_graphInit(&graf) ;
@@ -323,3 +325,123 @@ int _MMG5_mmgsRenumbering(int boxVertNbr, MMG5_pMesh mesh, MMG5_pSol sol) {
   return 1;
 }
 #endif
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ * \param sol pointer toward the solution structure.
+ * \return 0 if the renumbering fail and we can't rebuild triangles hashtable,
+ * 1 otherwise.
+ *
+ * Renumber the triangles along the Hilbert curve (through their barycenters),
+ * then the vertices in the order of their first appearance in the triangles
+ * (the vertices that don't belong to a triangle are stored after), then the
+ * xpoints. Doesn't need scotch.
+ *
+ */
+int _MMGS_sfcRenumbering(MMG5_pMesh mesh, MMG5_pSol sol) {
+  MMG5_pTria   pt;
+  _MMG5_sfcKey *keys;
+  double       min[3],scale,c[3];
+  int          *permNod,ntreal,npreal,i,j;
+  MMG5_int     k,*permTri;
+
+  /* Position of the triangles along the curve */
+  _MMG5_sfcBoundingBox(mesh,min,&scale);
+
+  _MMG5_ADD_MEM(mesh,(mesh->nt+1)*sizeof(_MMG5_sfcKey),"sfc keys",return(1));
+  _MMG5_SAFE_MALLOC(keys,mesh->nt+1,_MMG5_sfcKey,1);
+
+  ntreal = 0;
+  for (k=1; k<=mesh->nt; k++) {
+    pt = &mesh->tria[k];
+    if ( !MG_EOK(pt) ) continue;
+
+    for (i=0; i<3; i++) {
+      c[i] = 0.;
+      for (j=0; j<3; j++)
+        c[i] += mesh->point[pt->v[j]].c[i];
+      c[i] /= 3.;
+    }
+    keys[ntreal].key = _MMG5_hilbertKey(c,min,scale,3);
+    keys[ntreal].idx = k;
+    ++ntreal;
+  }
+  qsort(keys,ntreal,sizeof(_MMG5_sfcKey),_MMG5_sfcCompKey);
+
+  _MMG5_ADD_MEM(mesh,(mesh->nt+1)*sizeof(MMG5_int),"permTri",
+                _MMG5_DEL_MEM(mesh,keys,(mesh->nt+1)*sizeof(_MMG5_sfcKey));
+                return(1));
+  _MMG5_SAFE_CALLOC(permTri,mesh->nt+1,MMG5_int,1);
+
+  for (k=0; k<ntreal; k++)
+    permTri[keys[k].idx] = k+1;
+  _MMG5_DEL_MEM(mesh,keys,(mesh->nt+1)*sizeof(_MMG5_sfcKey));
+
+  _MMG5_ADD_MEM(mesh,(mesh->np+1)*sizeof(int),"permNodTab",
+                _MMG5_DEL_MEM(mesh,permTri,(mesh->nt+1)*sizeof(MMG5_int));
+                return(1));
+  _MMG5_SAFE_CALLOC(permNod,mesh->np+1,int,1);
+
+  /* Adjacencies are rebuilt at the end */
+  if ( mesh->adja )
+    _MMG5_DEL_MEM(mesh,mesh->adja,(3*mesh->ntmax+5)*sizeof(MMG5_int));
+
+  /* Permute triangles */
+  for (k=1; k<=mesh->nt; k++) {
+    while ( permTri[k] != k && permTri[k] )
+      _MMG5_swapTri(mesh->tria,permTri,k,permTri[k]);
+  }
+  _MMG5_DEL_MEM(mesh,permTri,(mesh->nt+1)*sizeof(MMG5_int));
+
+  /* New numbering of the nodes */
+  npreal = 0;
+  for (k=1; k<=ntreal; k++) {
+    pt = &mesh->tria[k];
+    for (j=0; j<3; j++) {
+      if ( !permNod[pt->v[j]] ) permNod[pt->v[j]] = ++npreal;
+    }
+  }
+  for (k=1; k<=mesh->np; k++) {
+    if ( !permNod[k] && MG_VOK(&mesh->point[k]) ) permNod[k] = ++npreal;
+  }
+
+  for (k=1; k<=ntreal; k++) {
+    for (j=0; j<3; j++)
+      mesh->tria[k].v[j] = permNod[mesh->tria[k].v[j]];
+  }
+
+  /* Permute nodes and sol */
+  for (k=1; k<=mesh->np; k++) {
+    while ( permNod[k] != k && permNod[k] )
+      _MMG5_swapNod(mesh->point,sol->m,permNod,k,permNod[k],sol->size);
+  }
+  _MMG5_DEL_MEM(mesh,permNod,(mesh->np+1)*sizeof(int));
+
+  mesh->nt = ntreal;
+  mesh->np = npreal;
+
+  if ( mesh->np == mesh->npmax )
+    mesh->npnil = 0;
+  else
+    mesh->npnil = mesh->np + 1;
+
+  if ( mesh->nt == mesh->ntmax )
+    mesh->nenil = 0;
+  else
+    mesh->nenil = mesh->nt + 1;
+
+  if ( mesh->npnil )
+    for (k=mesh->npnil; k<mesh->npmax-1; k++)
+      mesh->point[k].tmp  = k+1;
+
+  if ( mesh->nenil )
+    for (k=mesh->nenil; k<mesh->ntmax-1; k++)
+      mesh->tria[k].v[2] = k+1;
+
+  /* xpoints in the order of the points (skipped if we lack of memory) */
+  _MMG5_sfcPackXPoint(mesh);
+
+  if( !_MMGS_hashTria(mesh) ) return(0);
+
+  return(1);
+}
@@ -193,7 +193,7 @@ int _MMGS_defaultOption(MMG5_pMesh mesh,MMG5_pSol met) {
   double    hsiz;
   char      stim[32];
 
-  _MMGS_Set_commonFunc();
+  _MMGS_Set_commonFunc(mesh);
 
   signal(SIGABRT,_MMG5_excfun);
   signal(SIGFPE,_MMG5_excfun);
@@ -274,8 +274,6 @@ int main(int argc,char *argv[]) {
   fprintf(stdout,"     %s\n",MG_CPY);
   fprintf(stdout,"     %s %s\n",__DATE__,__TIME__);
 
-  _MMGS_Set_commonFunc();
-
   /* Print timer at exit */
   atexit(_MMG5_endcod);
 
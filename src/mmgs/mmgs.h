@@ -66,7 +66,7 @@ extern "C" {
     of point ip with coordinates o and tag tag*/
 #define _MMGS_POINT_REALLOC(mesh,sol,ip,wantedGap,law,o,tag,retval ) do \
   {                                                                     \
-    int klink;                                                          \
+    MMG5_int klink;                                                     \
                                                                         \
     _MMG5_TAB_RECALLOC(mesh,mesh->point,mesh->npmax,wantedGap,MMG5_Point, \
                        "larger point table",law,retval);                \
@@ -93,7 +93,7 @@ extern "C" {
     of tria jel */
 #define _MMGS_TRIA_REALLOC( mesh,jel,wantedGap,law,retval ) do          \
   {                                                                     \
-    int klink,oldSiz;                                                   \
+    MMG5_int klink,oldSiz;                                              \
                                                                         \
     oldSiz = mesh->ntmax;                                               \
     _MMG5_TAB_RECALLOC(mesh,mesh->tria,mesh->ntmax,wantedGap,MMG5_Tria, \
@@ -105,10 +105,10 @@ extern "C" {
                                                                         \
     if ( mesh->adja ) {                                                 \
       /* adja table */                                                  \
-      _MMG5_ADD_MEM(mesh,3*(mesh->ntmax-oldSiz)*sizeof(int),            \
+      _MMG5_ADD_MEM(mesh,3*(mesh->ntmax-oldSiz)*sizeof(MMG5_int),       \
                     "larger adja table",law);                           \
-      _MMG5_SAFE_RECALLOC(mesh->adja,3*mesh->nt+5,3*mesh->ntmax+5,int   \
-                          ,"larger adja table",retval);                 \
+      _MMG5_SAFE_RECALLOC(mesh->adja,3*mesh->nt+5,3*mesh->ntmax+5,      \
+                          MMG5_int,"larger adja table",retval);         \
     }                                                                   \
                                                                         \
     /* We try again to add the point */                                 \
@@ -131,39 +131,39 @@ int  _MMGS_hashTria(MMG5_pMesh );
 int  curvpo(MMG5_pMesh ,MMG5_pSol );
 int  _MMG5_mmgs1(MMG5_pMesh ,MMG5_pSol );
 int  _MMGS_mmgs2(MMG5_pMesh ,MMG5_pSol );
-int  boulet(MMG5_pMesh mesh,int start,int ip,int *list);
-int  boulechknm(MMG5_pMesh mesh,int start,int ip,int *list);
-int  boulep(MMG5_pMesh mesh,int start,int ip,int *list);
-int  bouletrid(MMG5_pMesh mesh,int start,int ip,int *il1,int *l1,int *il2,int *l2,int *ip0,int *ip1);
-int  _MMGS_newPt(MMG5_pMesh mesh,double c[3],double n[3]);
-void _MMGS_delPt(MMG5_pMesh mesh,int ip);
-int  _MMGS_newElt(MMG5_pMesh mesh);
-int  _MMGS_delElt(MMG5_pMesh mesh,int iel);
-int  chkedg(MMG5_pMesh ,int );
+int  boulet(MMG5_pMesh mesh,MMG5_int start,int ip,MMG5_int *list);
+int  boulechknm(MMG5_pMesh mesh,MMG5_int start,int ip,MMG5_int *list);
+int  boulep(MMG5_pMesh mesh,MMG5_int start,int ip,MMG5_int *list);
+int  bouletrid(MMG5_pMesh mesh,MMG5_int start,int ip,int *il1,MMG5_int *l1,int *il2,MMG5_int *l2,MMG5_int *ip0,MMG5_int *ip1);
+MMG5_int _MMGS_newPt(MMG5_pMesh mesh,double c[3],double n[3]);
+void _MMGS_delPt(MMG5_pMesh mesh,MMG5_int ip);
+MMG5_int _MMGS_newElt(MMG5_pMesh mesh);
+int  _MMGS_delElt(MMG5_pMesh mesh,MMG5_int iel);
+int  chkedg(MMG5_pMesh ,MMG5_int );
 int  _MMG5_mmgsBezierCP(MMG5_pMesh ,MMG5_Tria*, _MMG5_pBezier, char ori);
 int  _MMGS_bezierInt(_MMG5_pBezier ,double *,double *,double *,double *);
-int  _MMGS_simbulgept(MMG5_pMesh mesh,MMG5_pSol met, int k,int i,int ip);
-int  _MMGS_split1_sim(MMG5_pMesh mesh,MMG5_pSol met,int k,int i, int *vx);
-int  _MMG5_split2_sim(MMG5_pMesh mesh,MMG5_pSol met,int k,int *vx);
-int  _MMGS_split3_sim(MMG5_pMesh mesh,MMG5_pSol met,int k,int *vx);
-int  _MMGS_split1(MMG5_pMesh mesh,MMG5_pSol met,int k,int i,int *vx);
-int  _MMGS_split2(MMG5_pMesh mesh,MMG5_pSol met,int k,int *vx);
-int  _MMGS_split3(MMG5_pMesh mesh,MMG5_pSol met,int k,int *vx);
-int  split1b(MMG5_pMesh mesh,int k,char i,int ip);
-int  chkcol(MMG5_pMesh mesh,MMG5_pSol met,int k,char i,int *list,char typchk);
-int  colver(MMG5_pMesh mesh,int *list,int ilist);
-int  colver3(MMG5_pMesh mesh,int*list);
-int  colver2(MMG5_pMesh mesh,int *ilist);
-int  swapar(MMG5_pMesh mesh,int k,int i);
-int  chkswp(MMG5_pMesh mesh,MMG5_pSol met,int k,int i,char typchk);
+int  _MMGS_simbulgept(MMG5_pMesh mesh,MMG5_pSol met, MMG5_int k,int i,MMG5_int ip);
+int  _MMGS_split1_sim(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,int i, MMG5_int *vx);
+int  _MMG5_split2_sim(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int *vx);
+int  _MMGS_split3_sim(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int *vx);
+int  _MMGS_split1(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,int i,MMG5_int *vx);
+int  _MMGS_split2(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int *vx);
+int  _MMGS_split3(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int *vx);
+int  split1b(MMG5_pMesh mesh,MMG5_int k,char i,MMG5_int ip);
+int  chkcol(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,char i,MMG5_int *list,char typchk);
+int  colver(MMG5_pMesh mesh,MMG5_int *list,int ilist);
+int  colver3(MMG5_pMesh mesh,MMG5_int*list);
+int  colver2(MMG5_pMesh mesh,MMG5_int *ilist);
+int  swapar(MMG5_pMesh mesh,MMG5_int k,int i);
+int  chkswp(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,int i,char typchk);
 int  swpedg(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist,char typchk);
 char typelt(MMG5_pPoint p[3],char *ia);
 int  litswp(MMG5_pMesh mesh,int k,char i,double kal);
 int  litcol(MMG5_pMesh mesh,int k,char i,double kal);
 int  _MMG5_mmgsChkmsh(MMG5_pMesh,int,int);
 int  paratmet(double c0[3],double n0[3],double m[6],double c1[3],double n1[3],double mt[6]);
-int  intregmet(MMG5_pMesh mesh,MMG5_pSol met,int k,char i,double s,double mr[6]);
-int  _MMG5_intridmet(MMG5_pMesh,MMG5_pSol,int,int,double,double*,double*);
+int  intregmet(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,char i,double s,double mr[6]);
+int  _MMG5_intridmet(MMG5_pMesh,MMG5_pSol,MMG5_int,MMG5_int,double,double*,double*);
 int  setref(MMG5_pMesh,int,int,int);
 int  delref(MMG5_pMesh);
 int  chkmet(MMG5_pMesh,MMG5_pSol);
@@ -174,50 +174,47 @@ int _MMGS_memOption(MMG5_pMesh mesh);
 #ifdef USE_SCOTCH
 int _MMG5_mmgsRenumbering(int vertBoxNbr, MMG5_pMesh mesh, MMG5_pSol sol);
 #endif
+int _MMGS_sfcRenumbering(MMG5_pMesh mesh, MMG5_pSol sol);
 
 /* useful functions to debug */
-int  _MMGS_indElt(MMG5_pMesh mesh,int kel);
-int  _MMGS_indPt(MMG5_pMesh mesh,int kp);
+MMG5_int _MMGS_indElt(MMG5_pMesh mesh,MMG5_int kel);
+MMG5_int _MMGS_indPt(MMG5_pMesh mesh,MMG5_int kp);
 
 /* function pointers */
 /* init structures */
 void  _MMG5_Init_parameters(MMG5_pMesh mesh);
 /* iso/aniso computations */
-extern double caleltsig_ani(MMG5_pMesh mesh,MMG5_pSol met,int iel);
-extern double caleltsig_iso(MMG5_pMesh mesh,MMG5_pSol met,int iel);
+extern double caleltsig_ani(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int iel);
+extern double caleltsig_iso(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int iel);
 int    _MMGS_defsiz_iso(MMG5_pMesh mesh,MMG5_pSol met);
 int    _MMGS_defsiz_ani(MMG5_pMesh mesh,MMG5_pSol met);
 void   _MMG5_defaultValues(MMG5_pMesh);
 int    gradsiz_iso(MMG5_pMesh mesh,MMG5_pSol met);
 int    gradsiz_ani(MMG5_pMesh mesh,MMG5_pSol met);
-int    intmet_iso(MMG5_pMesh mesh,MMG5_pSol met,int k,char i,int ip,double s);
-int    intmet_ani(MMG5_pMesh mesh,MMG5_pSol met,int k,char i,int ip,double s);
-int    _MMGS_intmet33_ani(MMG5_pMesh,MMG5_pSol,int,char,int,double);
-int    movridpt_iso(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist);
-int    movintpt_iso(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist);
-int    movridpt_ani(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist);
-int    movintpt_ani(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist);
+int    intmet_iso(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,char i,MMG5_int ip,double s);
+int    intmet_ani(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,char i,MMG5_int ip,double s);
+int    _MMGS_intmet33_ani(MMG5_pMesh,MMG5_pSol,MMG5_int,char,MMG5_int,double);
+int    movridpt_iso(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int *list,int ilist);
+int    movintpt_iso(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int *list,int ilist);
+int    movridpt_ani(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int *list,int ilist);
+int    movintpt_ani(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int *list,int ilist);
 int    _MMGS_prilen(MMG5_pMesh mesh,MMG5_pSol met,int);
 
-double (*_MMG5_calelt)(MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTria ptt);
-int    (*_MMG5_defsiz)(MMG5_pMesh mesh,MMG5_pSol met);
-int    (*gradsiz)(MMG5_pMesh mesh,MMG5_pSol met);
-int    (*intmet)(MMG5_pMesh mesh,MMG5_pSol met,int k,char i,int ip,double s);
-int    (*movridpt)(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist);
-int    (*movintpt)(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist);
-
 /**
+ * \param mesh pointer toward the mesh structure.
+ *
  * Set common pointer functions between mmgs and mmg3d to the matching mmgs
  * functions.
  */
 static inline
-void _MMGS_Set_commonFunc() {
-  _MMG5_bezierCP          = _MMG5_mmgsBezierCP;
-  _MMG5_chkmsh            = _MMG5_mmgsChkmsh;
-  _MMG5_indPt             = _MMGS_indPt;
-  _MMG5_indElt            = _MMGS_indElt;
+void _MMGS_Set_commonFunc(MMG5_pMesh mesh) {
+  mesh->func.bezierCP     = _MMG5_mmgsBezierCP;
+  mesh->func.chkmsh       = _MMG5_mmgsChkmsh;
+  mesh->func.indPt        = _MMGS_indPt;
+  mesh->func.indElt       = _MMGS_indElt;
+  mesh->func.sfcRenumbering = _MMGS_sfcRenumbering;
 #ifdef USE_SCOTCH
-  _MMG5_renumbering       = _MMG5_mmgsRenumbering;
+  mesh->func.renumbering  = _MMG5_mmgsRenumbering;
 #endif
 }
 
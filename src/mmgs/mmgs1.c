@@ -35,7 +35,6 @@
 #include "mmgs.h"
 
 
-char ddb;
 
 /**
  * \param mesh pointer toward the mesh structure.
@@ -47,12 +46,13 @@ char ddb;
  * Find acceptable position for splitting.
  *
  */
-int _MMGS_dichoto(MMG5_pMesh mesh,MMG5_pSol met,int k,int *vx) {
+int _MMGS_dichoto(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int *vx) {
   MMG5_pTria   pt;
   MMG5_pPoint  pa,pb,ps;
   double       o[3][3],p[3][3];
   float        to,tp,t;
-  int          i1,i2,ia,ib,ier,it,maxit;
+  int          i1,i2,ier,it,maxit;
+  MMG5_int     ia,ib;
   char         i,j;
 
   pt = &mesh->tria[k];
@@ -148,10 +148,11 @@ int _MMGS_dichoto(MMG5_pMesh mesh,MMG5_pSol met,int k,int *vx) {
  * Find acceptable position for _MMG5_split1b, starting from point ip.
  *
  */
-int _MMGS_dichoto1b(MMG5_pMesh mesh, MMG5_pSol met, int iel, int ia, int ip) {
+int _MMGS_dichoto1b(MMG5_pMesh mesh, MMG5_pSol met, MMG5_int iel, int ia, MMG5_int ip) {
   MMG5_pTria   pt;
   MMG5_pPoint  p0,p1,ppt;
-  int          np,nq,it,maxit,i1,i2;
+  int          it,maxit,i1,i2;
+  MMG5_int     np,nq;
   double       m[3],o[3],tp,to,t;
   char         ier;
 
@@ -203,7 +204,7 @@ int _MMGS_dichoto1b(MMG5_pMesh mesh, MMG5_pSol met, int iel, int ia, int ip) {
 }
 
 /* check if edge need to be split and return a binary coding the numbers of the edges of tria iel that should be split according to a hausdorff distance criterion */
-int chkedg(MMG5_pMesh mesh,int iel) {
+int chkedg(MMG5_pMesh mesh,MMG5_int iel) {
   MMG5_pTria    pt;
   MMG5_pPoint   p[3];
   MMG5_pPar     par;
@@ -211,7 +212,7 @@ int chkedg(MMG5_pMesh mesh,int iel) {
   double   ps,ps2,cosn,ux,uy,uz,ll,li,dd,hausd,hmax;
   int      l,isloc;
   char     i,i1,i2;
-  static char mmgWarn0 = 0, mmgWarn1 = 0;
+  static _MMG5_TLS char mmgWarn0 = 0, mmgWarn1 = 0;
 
   pt   = &mesh->tria[iel];
   p[0] = &mesh->point[pt->v[0]];
@@ -388,7 +389,8 @@ int chkedg(MMG5_pMesh mesh,int iel) {
 
 static int swpmsh(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
   MMG5_pTria    pt;
-  int      k,it,ns,nns,maxit;
+  int      it,ns,nns,maxit;
+  MMG5_int k;
   char     i;
 
   it = nns = 0;
@@ -421,7 +423,8 @@ static int swpmsh(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
 static int movtri(MMG5_pMesh mesh,MMG5_pSol met,int maxit) {
   MMG5_pTria    pt;
   MMG5_pPoint   ppt;
-  int      it,k,ier,base,nm,ns,nnm,list[_MMGS_LMAX+2],ilist;
+  int      it,ier,base,nm,ns,nnm,ilist;
+  MMG5_int k,list[_MMGS_LMAX+2];
   char     i;
 
   if ( abs(mesh->info.imprim) > 5 || mesh->info.ddebug )
@@ -448,11 +451,11 @@ static int movtri(MMG5_pMesh mesh,MMG5_pSol met,int maxit) {
         if ( !ilist ) continue;
 
         if ( MG_EDG(ppt->tag) ) {
-          ier = movridpt(mesh,met,list,ilist);
+          ier = mesh->func.movridpt(mesh,met,list,ilist);
           if ( ier )  ns++;
         }
         else
-          ier = movintpt(mesh,met,list,ilist);
+          ier = mesh->func.movsurfintpt(mesh,met,list,ilist);
         if ( ier ) {
           nm++;
           ppt->flag = base;
@@ -482,7 +485,8 @@ static inline
 int _MMGS_delPatternPts(MMG5_pMesh mesh,_MMG5_Hash hash)
 {
   MMG5_pTria   pt;
-  int          vx[3],k,i,i1,i2;
+  int          i,i1,i2;
+  MMG5_int     k,vx[3];
 
   /* Delete the useless added points */
   for (k=1; k<=mesh->nt; k++) {
@@ -498,10 +502,10 @@ int _MMGS_delPatternPts(MMG5_pMesh mesh,_MMG5_Hash hash)
         _MMGS_delPt(mesh,vx[i]);
         if ( !_MMG5_hashUpdate(&hash,pt->v[i1],pt->v[i2],0) ) {
           fprintf(stderr,"\n  ## Error: %s: unable to delete point idx"
-                  " along edge %d %d.\n", __func__,
+                  " along edge %" MMG5_PRId " %" MMG5_PRId ".\n", __func__,
                   _MMGS_indPt(mesh,pt->v[i1]),
                   _MMGS_indPt(mesh,pt->v[i2]));
-          _MMG5_DEL_MEM(mesh,hash.item,(hash.max+1)*sizeof(_MMG5_hedge));
+          _MMG5_DEL_MEM(mesh,hash.item,hash.siz*sizeof(_MMG5_hedge));
           return 0;
         }
       }
@@ -520,17 +524,18 @@ int _MMGS_delPatternPts(MMG5_pMesh mesh,_MMG5_Hash hash)
  * Analyze triangles and split if needed
  *
  */
-static int anaelt(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
+static MMG5_int anaelt(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
   MMG5_pTria    pt;
   MMG5_pPoint   ppt,p1,p2;
   _MMG5_Hash    hash;
   _MMG5_Bezier  pb;
   MMG5_pxPoint  go;
   double        s,o[3],no[3],to[3],dd,len;
-  int           vx[3],i,j,ip,ip1,ip2,ier,k,ns,nc,ni,ic,nt,it;
+  int           i,j,ier,ic,it;
+  MMG5_int      k,vx[3],ip,ip1,ip2,ns,nc,ni,nt;
   char          i1,i2;
   static double uv[3][2] = { {0.5,0.5}, {0.,0.5}, {0.5,0.} };
-  static char   mmgWarn0=0,mmgWarn1=0,mmgWarn2=0,mmgWarn3=0;
+  static _MMG5_TLS char   mmgWarn0=0,mmgWarn1=0,mmgWarn2=0,mmgWarn3=0;
 
   if ( !_MMG5_hashNew(mesh,&hash,mesh->np,3*mesh->np) ) return -1;
   ns = 0;
@@ -550,7 +555,7 @@ static int anaelt(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
       for (i=0; i<3; i++) {
         i1 = _MMG5_inxt2[i];
         i2 = _MMG5_iprv2[i];
-        len = _MMG5_lenSurfEdg(mesh,met,pt->v[i1],pt->v[i2],0);
+        len = mesh->func.lenSurfEdg(mesh,met,pt->v[i1],pt->v[i2],0);
         if ( !len ) return -1;
         else if ( len > _MMGS_LLONG )  MG_SET(pt->flag,i);
       }
@@ -559,7 +564,7 @@ static int anaelt(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
     ns++;
 
     /* geometric support */
-    ier = _MMG5_bezierCP(mesh,pt,&pb,1);
+    ier = mesh->func.bezierCP(mesh,pt,&pb,1);
     assert(ier);
 
     /* scan edges to split */
@@ -630,7 +635,7 @@ static int anaelt(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
           if ( typchk == 1 && (met->size>1) )
             ier = _MMGS_intmet33_ani(mesh,met,k,i,ip,s);
           else
-            ier = intmet(mesh,met,k,i,ip,s);
+            ier = mesh->func.intmet(mesh,met,k,i,ip,s);
         }
 
         if ( !ier ) {
@@ -670,7 +675,7 @@ static int anaelt(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
     }
   }
   if ( !ns ) {
-    _MMG5_DEL_MEM(mesh,hash.item,(hash.max+1)*sizeof(_MMG5_hedge));
+    _MMG5_DEL_MEM(mesh,hash.item,hash.siz*sizeof(_MMG5_hedge));
     return(ns);
   }
 
@@ -681,7 +686,7 @@ static int anaelt(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
     else if ( pt->flag == 7 )  continue;
 
     /* geometric support */
-    ier = _MMG5_bezierCP(mesh,pt,&pb,1);
+    ier = mesh->func.bezierCP(mesh,pt,&pb,1);
     assert(ier);
     nc = 0;
 
@@ -720,7 +725,7 @@ static int anaelt(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
     if ( nc > 0 )  ++ns;
   }
   if ( mesh->info.ddebug && ns ) {
-    fprintf(stdout,"     %d analyzed  %d proposed\n",mesh->nt,ns);
+    fprintf(stdout,"     %" MMG5_PRId " analyzed  %" MMG5_PRId " proposed\n",mesh->nt,ns);
     fflush(stdout);
   }
 
@@ -796,10 +801,10 @@ static int anaelt(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
               if ( !_MMG5_hashUpdate(&hash,pt->v[_MMG5_iprv2[i]],
                                      pt->v[_MMG5_inxt2[i]],0) ) {
                 fprintf(stderr,"\n  ## Error: %s: unable to delete point"
-                        " idx along edge %d %d.\n",
+                        " idx along edge %" MMG5_PRId " %" MMG5_PRId ".\n",
                         __func__,_MMGS_indPt(mesh,pt->v[_MMG5_iprv2[i]]),
                         _MMGS_indPt(mesh,pt->v[_MMG5_inxt2[i]]));
-                _MMG5_DEL_MEM(mesh,hash.item,(hash.max+1)*sizeof(_MMG5_hedge));
+                _MMG5_DEL_MEM(mesh,hash.item,hash.siz*sizeof(_MMG5_hedge));
                 return -1;
               }
               _MMGS_delPt(mesh,vx[i]);
@@ -813,7 +818,7 @@ static int anaelt(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
   while( ni > 0 && ++it < 40 );
 
   if ( mesh->info.ddebug && nc ) {
-    fprintf(stdout,"     %d corrected,  %d invalid\n",nc,ni);
+    fprintf(stdout,"     %" MMG5_PRId " corrected,  %" MMG5_PRId " invalid\n",nc,ni);
     fflush(stdout);
   }
 
@@ -858,8 +863,8 @@ static int anaelt(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
     if ( !ier ) return -1;
   }
   if ( (mesh->info.ddebug || abs(mesh->info.imprim) > 5) && ns > 0 )
-    fprintf(stdout,"     %7d splitted\n",ns);
-  _MMG5_DEL_MEM(mesh,hash.item,(hash.max+1)*sizeof(_MMG5_hedge));
+    fprintf(stdout,"     %7" MMG5_PRId " splitted\n",ns);
+  _MMG5_DEL_MEM(mesh,hash.item,hash.siz*sizeof(_MMG5_hedge));
 
   return(ns);
 }
@@ -875,13 +880,14 @@ static int anaelt(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
  * Check if splitting edge \a i of element \a k is ok.
  *
  */
-int chkspl(MMG5_pMesh mesh,MMG5_pSol met,int k,int i) {
+MMG5_int chkspl(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,int i) {
   MMG5_pTria    pt,pt1;
   MMG5_pPoint   ppt;
   MMG5_pxPoint    go;
   _MMG5_Bezier   b;
   double   s,uv[2],o[3],no[3],to[3];
-  int     *adja,jel,ip,ier;
+  int     ier;
+  MMG5_int *adja,jel,ip;
   char     i1,i2,j,jj,j2;
 
   if ( mesh->xp > mesh->xpmax-2 )  return(0);
@@ -899,7 +905,7 @@ int chkspl(MMG5_pMesh mesh,MMG5_pSol met,int k,int i) {
     if ( MS_SIN(pt1->tag[jj]) || MS_SIN(pt1->tag[j2]) )  return(0);
   }
 
-  ier = _MMG5_bezierCP(mesh,pt,&b,1);
+  ier = mesh->func.bezierCP(mesh,pt,&b,1);
   assert(ier);
 
   /* create midedge point */
@@ -929,7 +935,7 @@ int chkspl(MMG5_pMesh mesh,MMG5_pSol met,int k,int i) {
   }
   s = 0.5;
 
-  if ( !intmet(mesh,met,k,i,ip,s) ) return(0);
+  if ( !mesh->func.intmet(mesh,met,k,i,ip,s) ) return(0);
 
   return(ip);
 }
@@ -940,7 +946,8 @@ static int colelt(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
   MMG5_pPoint   p1,p2;
   MMG5_pPar     par;
   double        ll,ux,uy,uz,hmin;
-  int           list[_MMGS_LMAX+2],ilist,k,nc,l,isloc,ier;
+  int           ilist,nc,l,isloc,ier;
+  MMG5_int      k,list[_MMGS_LMAX+2];
   char          i,i1,i2;
 
   nc = 0;
@@ -989,7 +996,7 @@ static int colelt(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
         if ( ll > hmin*hmin )  continue;
       }
       else {
-        ll = _MMG5_lenSurfEdg(mesh,met,pt->v[i1],pt->v[i2],0);
+        ll = mesh->func.lenSurfEdg(mesh,met,pt->v[i1],pt->v[i2],0);
         if ( !ll ) return -1;
         if ( ll > _MMGS_LSHRT )  continue;
       }
@@ -1035,7 +1042,8 @@ static int adpspl(MMG5_pMesh mesh,MMG5_pSol met) {
   MMG5_pTria    pt;
   MMG5_pPoint   p1,p2;
   double   len,lmax;
-  int      ip,k,ns,ier;
+  int      ns,ier;
+  MMG5_int k,ip;
   char     i,i1,i2,imax;
 
   ns = 0;
@@ -1050,7 +1058,7 @@ static int adpspl(MMG5_pMesh mesh,MMG5_pSol met) {
     for (i=0; i<3; i++) {
       i1  = _MMG5_inxt2[i];
       i2  = _MMG5_iprv2[i];
-      len = _MMG5_lenSurfEdg(mesh,met,pt->v[i1],pt->v[i2],0);
+      len = mesh->func.lenSurfEdg(mesh,met,pt->v[i1],pt->v[i2],0);
 
       if ( !len ) return -1;
 
@@ -1110,7 +1118,8 @@ static int adpcol(MMG5_pMesh mesh,MMG5_pSol met) {
   MMG5_pTria    pt;
   MMG5_pPoint   p1,p2;
   double   len;
-  int      k,list[_MMGS_LMAX+2],ilist,nc,ier;
+  int      ilist,nc,ier;
+  MMG5_int k,list[_MMGS_LMAX+2];
   char     i,i1,i2;
 
   nc = 0;
@@ -1130,7 +1139,7 @@ static int adpcol(MMG5_pMesh mesh,MMG5_pSol met) {
       p2 = &mesh->point[pt->v[i2]];
       if ( p1->tag & MG_NOM || p2->tag & MG_NOM )  continue;
 
-      len = _MMG5_lenSurfEdg(mesh,met,pt->v[i1],pt->v[i2],0);
+      len = mesh->func.lenSurfEdg(mesh,met,pt->v[i1],pt->v[i2],0);
       if ( !len ) return -1;
       else if ( len > _MMGS_LOPTS )  continue;
 
@@ -1282,7 +1291,8 @@ static int adptri(MMG5_pMesh mesh,MMG5_pSol met) {
 
 /* analyze tetrahedra and split if needed */
 static int anatri(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
-  int     nc,ns,nf,nnc,nns,nnf,it,maxit;
+  int     nc,nf,nnc,nnf,it,maxit;
+  MMG5_int ns,nns;
 
   /* analyze tetras : initial splitting */
   nns = nnc = nnf = it = 0;
@@ -1290,7 +1300,7 @@ static int anatri(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
   do {
     if ( !mesh->info.noinsert ) {
       /* memory free */
-      _MMG5_DEL_MEM(mesh,mesh->adja,(3*mesh->ntmax+5)*sizeof(int));
+      _MMG5_DEL_MEM(mesh,mesh->adja,(3*mesh->ntmax+5)*sizeof(MMG5_int));
       mesh->adja = 0;
 
       /* analyze surface */
@@ -1331,14 +1341,14 @@ static int anatri(MMG5_pMesh mesh,MMG5_pSol met,char typchk) {
     nns += ns;
     nnf += nf;
     if ( (abs(mesh->info.imprim) > 4 || mesh->info.ddebug) && ns+nc > 0 )
-      fprintf(stdout,"     %8d splitted, %8d collapsed, %8d swapped\n",ns,nc,nf);
-    if ( it > 3 && abs(nc-ns) < 0.1 * MG_MAX(nc,ns) )  break;
+      fprintf(stdout,"     %8" MMG5_PRId " splitted, %8d collapsed, %8d swapped\n",ns,nc,nf);
+    if ( it > 3 && MMG5_abs(nc-ns) < 0.1 * MG_MAX(nc,ns) )  break;
   }
   while ( ++it < maxit && ns+nc+nf > 0 );
 
   if ( mesh->info.imprim > 0 ) {
     if ( (abs(mesh->info.imprim) < 5 || mesh->info.ddebug ) && nns+nnc > 0 )
-      fprintf(stdout,"     %8d splitted, %8d collapsed, %8d swapped, %d iter.\n",nns,nnc,nnf,it);
+      fprintf(stdout,"     %8" MMG5_PRId " splitted, %8d collapsed, %8d swapped, %d iter.\n",nns,nnc,nnf,it);
   }
 
   return(1);
@@ -1367,13 +1377,13 @@ int _MMG5_mmgs1(MMG5_pMesh mesh,MMG5_pSol met) {
     fprintf(stdout,"  ** COMPUTATIONAL MESH\n");
 
   /* define metric map */
-  if ( !_MMG5_defsiz(mesh,met) ) {
+  if ( !mesh->func.defsiz(mesh,met) ) {
     fprintf(stderr,"\n  ## Metric undefined. Exit program.\n");
     return(0);
   }
   if ( mesh->info.hgrad > 0. ) {
     if ( mesh->info.imprim > 0 )   fprintf(stdout,"\n  -- GRADATION : %8f\n",exp(mesh->info.hgrad));
-    if (!gradsiz(mesh,met) ) {
+    if (!mesh->func.gradsiz(mesh,met) ) {
       fprintf(stderr,"\n  ## Gradation problem. Exit program.\n");
       return(0);
     }
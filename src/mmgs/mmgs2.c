@@ -51,12 +51,12 @@
  *
  */
 static int
-_MMGS_ismaniball(MMG5_pMesh mesh, MMG5_pSol sol, int start, char istart) {
+_MMGS_ismaniball(MMG5_pMesh mesh, MMG5_pSol sol, MMG5_int start, char istart) {
   MMG5_pTria       pt;
   double           v1, v2;
-  int              *adja,k,ip1,ip2,end1;
+  MMG5_int         *adja,ip1,ip2,k,end1;
   char             i,i1,smsgn;
-  static char      mmgWarn=0;
+  static _MMG5_TLS char      mmgWarn=0;
 
   k = start;
   i = _MMG5_inxt2[istart];
@@ -117,7 +117,7 @@ _MMGS_ismaniball(MMG5_pMesh mesh, MMG5_pSol sol, int start, char istart) {
   if ( k != end1 ) {
     if ( !mmgWarn ) {
       mmgWarn = 1;
-      fprintf(stderr,"\n  ## Warning: %s: triangle %d, point %d; unsnap \n",
+      fprintf(stderr,"\n  ## Warning: %s: triangle %" MMG5_PRId ", point %" MMG5_PRId "; unsnap \n",
               __func__,start,mesh->tria[start].v[istart]);
     }
     return(0);
@@ -140,7 +140,8 @@ int _MMGS_snpval_ls(MMG5_pMesh mesh,MMG5_pSol sol) {
   MMG5_pTria    pt;
   MMG5_pPoint   p0;
   double        *tmp,v1,v2;
-  int           k,nc,ns,ip,ip1,ip2;
+  int           nc,ns;
+  MMG5_int      k,ip,ip1,ip2;
   char          i;
 
   _MMG5_ADD_MEM(mesh,(mesh->npmax+1)*sizeof(double),"temporary table",
@@ -166,7 +167,7 @@ int _MMGS_snpval_ls(MMG5_pMesh mesh,MMG5_pSol sol) {
     if ( !MG_VOK(p0) ) continue;
     if ( fabs(sol->m[k]-mesh->info.ls) < _MMG5_EPS ) {
       if ( mesh->info.ddebug )
-        fprintf(stderr,"  ## Warning: %s: snapping value %d; "
+        fprintf(stderr,"  ## Warning: %s: snapping value %" MMG5_PRId "; "
                 "previous value : %E\n",__func__,k,fabs(sol->m[k]));
 
       tmp[k] = ( fabs(sol->m[k]-mesh->info.ls) < _MMG5_EPSD ) ?
@@ -203,7 +204,7 @@ int _MMGS_snpval_ls(MMG5_pMesh mesh,MMG5_pSol sol) {
     fprintf(stdout,"     %8d points snapped, %d corrected\n",ns,nc);
 
   /* memory free */
-  _MMG5_DEL_MEM(mesh,mesh->adja,(3*mesh->ntmax+5)*sizeof(int));
+  _MMG5_DEL_MEM(mesh,mesh->adja,(3*mesh->ntmax+5)*sizeof(MMG5_int));
   _MMG5_DEL_MEM(mesh,tmp,(mesh->npmax+1)*sizeof(double));
 
   return(1);
@@ -220,9 +221,9 @@ int _MMGS_snpval_ls(MMG5_pMesh mesh,MMG5_pSol sol) {
  * \warning i inxt[i] is one edge of the implicit boundary.
  *
  */
-int _MMGS_chkmaniball(MMG5_pMesh mesh, int start, char istart) {
+int _MMGS_chkmaniball(MMG5_pMesh mesh, MMG5_int start, char istart) {
   MMG5_pTria         pt;
-  int                *adja,k;
+  MMG5_int           *adja,k;
   char               i,i1;
 
   pt = &mesh->tria[start];
@@ -314,9 +315,10 @@ int _MMGS_chkmaniball(MMG5_pMesh mesh, int start, char istart) {
 static
 int _MMGS_chkmanimesh(MMG5_pMesh mesh) {
   MMG5_pTria      pt;
-  int             *adja,k,cnt,iel;
+  int             cnt;
+  MMG5_int        k,*adja,iel;
   char            i,i1;
-  static char     mmgWarn0 = 0;
+  static _MMG5_TLS char     mmgWarn0 = 0;
 
 
   /* First check: check whether one triangle in the mesh has 3 boundary faces */
@@ -386,7 +388,8 @@ static int _MMGS_cuttri_ls(MMG5_pMesh mesh, MMG5_pSol sol){
   MMG5_pPoint  p0,p1;
   _MMG5_Hash   hash;
   double       c[3],v0,v1,s;
-  int          vx[3],nb,k,ip0,ip1,np,ns,nt,ier;
+  int          nb,ns,ier;
+  MMG5_int     k,vx[3],ip0,ip1,np,nt;
   char         ia;
   /* reset point flags and h */
   for (k=1; k<=mesh->np; k++)
@@ -467,7 +470,7 @@ static int _MMGS_cuttri_ls(MMG5_pMesh mesh, MMG5_pSol sol){
     pt = &mesh->tria[k];
     if ( !MG_EOK(pt) )  continue;
     pt->flag = 0;
-    memset(vx,0,3*sizeof(int));
+    memset(vx,0,3*sizeof(MMG5_int));
     for (ia=0; ia<3; ia++) {
       vx[ia] = _MMG5_hashGet(&hash,pt->v[_MMG5_inxt2[ia]],pt->v[_MMG5_iprv2[ia]]);
       if ( vx[ia] ) {
@@ -509,7 +512,7 @@ static int _MMGS_cuttri_ls(MMG5_pMesh mesh, MMG5_pSol sol){
   if ( (mesh->info.ddebug || abs(mesh->info.imprim) > 5) && ns > 0 )
     fprintf(stdout,"     %7d splitted\n",ns);
 
-  _MMG5_DEL_MEM(mesh,hash.item,(hash.max+1)*sizeof(_MMG5_hedge));
+  _MMG5_DEL_MEM(mesh,hash.item,hash.siz*sizeof(_MMG5_hedge));
   return(ns);
 }
 
@@ -524,7 +527,7 @@ static int _MMGS_cuttri_ls(MMG5_pMesh mesh, MMG5_pSol sol){
 static int _MMGS_setref_ls(MMG5_pMesh mesh, MMG5_pSol sol) {
   MMG5_pTria   pt;
   double       v,v1;
-  int          k,ip,ip1;
+  MMG5_int     k,ip,ip1;
   char         nmns,npls,nz,i;
 
   for (k=1; k<=mesh->nt; k++) {
@@ -597,7 +600,7 @@ int _MMGS_mmgs2(MMG5_pMesh mesh,MMG5_pSol sol) {
     return(0);
   }
 
-  _MMG5_DEL_MEM(mesh,mesh->adja,(3*mesh->ntmax+5)*sizeof(int));
+  _MMG5_DEL_MEM(mesh,mesh->adja,(3*mesh->ntmax+5)*sizeof(MMG5_int));
 
   if ( !_MMGS_cuttri_ls(mesh,sol) ) {
     fprintf(stderr,"\n  ## Problem in discretizing implicit function. Exit program.\n");
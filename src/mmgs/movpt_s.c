@@ -38,13 +38,14 @@
 
 
 /* compute movement of an internal point whose ball is passed */
-int movintpt_iso(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist) {
+int movintpt_iso(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int *list,int ilist) {
   MMG5_pPoint   p0,p1,ppt0;
   MMG5_pTria    pt,pt0;
   _MMG5_Bezier   b;
   double   aa,bb,ab,ll,l,mlon,devmean,GV[3],gv[2],cosalpha,sinalpha,r[3][3],*n,lispoi[3*_MMGS_LMAX+1];
   double   ux,uy,uz,det2d,detloc,step,lambda[3],uv[2],o[3],no[3],to[3],Vold,Vnew,calold,calnew,caltmp;
-  int      ier,iel,ipp,k,kel,npt,ibeg,iend;
+  int      ier,npt;
+  MMG5_int ipp,ibeg,iend,iel,k,kel;
   char     i0,i1,i2;
 
   step = 0.1;
@@ -241,7 +242,7 @@ int movintpt_iso(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist) {
   i0 = list[kel]%3;
   pt = &mesh->tria[iel];
 
-  ier = _MMG5_bezierCP(mesh,pt,&b,1);
+  ier = mesh->func.bezierCP(mesh,pt,&b,1);
   assert(ier);
 
   /* Now, for Bezier interpolation, one should identify which of i,i1,i2 is 0,1,2
@@ -329,14 +330,15 @@ int movintpt_iso(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist) {
 }
 
 /* compute movement of a ridge point whose ball (consisting of triangles) is passed */
-int movridpt_iso(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist) {
+int movridpt_iso(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int *list,int ilist) {
   MMG5_pTria   pt,pt0;
   MMG5_pxPoint   go;
   _MMG5_Bezier  b;
   MMG5_pPoint  p0,p1,p2,ppt0;
   double  step,dd1,dd2,ddt,ps2,ll1old,ll1new,ll2old,ll2new,uv[2],o[3],*no1,*no2,*np1,*np2;
   double  nn1[3],nn2[3],psn11,psn12,to[3],calold,calnew,lam0,lam1,lam2;
-  int     ier,k,iel,ip0,ip1,ip2,it1,it2;
+  int     ier,k;
+  MMG5_int ip0,ip1,ip2,iel,it1,it2;
   char    i0,i1,i2,isrid1,isrid2,isrid;
 
   step   = 0.1;
@@ -408,7 +410,7 @@ int movridpt_iso(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist) {
     isrid = isrid2;
     pt = &mesh->tria[it2];
 
-    ier = _MMG5_bezierCP(mesh,pt,&b,1);
+    ier = mesh->func.bezierCP(mesh,pt,&b,1);
     assert(ier);
 
     /* fill table uv with barycentric coor in the tria */
@@ -450,7 +452,7 @@ int movridpt_iso(MMG5_pMesh mesh,MMG5_pSol met,int *list,int ilist) {
     isrid = isrid1;
     pt = &mesh->tria[it1];
 
-    ier = _MMG5_bezierCP(mesh,pt,&b,1);
+    ier = mesh->func.bezierCP(mesh,pt,&b,1);
     assert(ier);
 
     /* fill table uv */
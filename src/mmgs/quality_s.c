@@ -36,7 +36,6 @@
 #include "mmgs.h"
 #include "inlined_functions.h"
 
-extern char  ddb;
 
 /**
  * \param mesh pointer toward the mesh structure.
@@ -49,12 +48,12 @@ extern char  ddb;
  * to normal to vertices.
  *
  */
-inline double caleltsig_ani(MMG5_pMesh mesh,MMG5_pSol met,int iel) {
+inline double caleltsig_ani(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int iel) {
   MMG5_pTria    pt;
   MMG5_pPoint   pa,pb,pc;
   double        ps1,ps2,abx,aby,abz,acx,acy,acz,dd,rap,anisurf;
   double        n[3],pv[3],l[3],*ncomp,*a,*b,*c;
-  int           ia,ib,ic;
+  MMG5_int      ia,ib,ic;
 
   pt = &mesh->tria[iel];
   ia = pt->v[0];
@@ -136,12 +135,12 @@ inline double caleltsig_ani(MMG5_pMesh mesh,MMG5_pSol met,int iel) {
 }
 
 /* Same quality function but puts a sign according to deviation to normal to vertices */
-inline double caleltsig_iso(MMG5_pMesh mesh,MMG5_pSol met,int iel) {
+inline double caleltsig_iso(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int iel) {
   MMG5_pTria     pt;
   MMG5_pPoint    pa,pb,pc;
   double   *a,*b,*c,cal,abx,aby,abz,acx,acy,acz,bcx,bcy,bcz,rap;
   double    n[3],*ncomp,pv[3],ps1,ps2,sqcal,invsqcal;
-  int       ia,ib,ic;
+  MMG5_int  ia,ib,ic;
 
   pt = &mesh->tria[iel];
   ia = pt->v[0];
@@ -282,11 +281,12 @@ int _MMGS_prilen(MMG5_pMesh mesh, MMG5_pSol met, int metRidTyp) {
   MMG5_pTria      pt;
   _MMG5_Hash      hash;
   double          len,avlen,lmin,lmax;
-  int             k,np,nq,amin,bmin,amax,bmax,ned,hl[9],nullEdge;
+  int             ned,nullEdge;
+  MMG5_int        k,np,nq,hl[9],amin,bmin,amax,bmax;
   char            ia,i0,i1,i;
   static double   bd[9]= {0.0, 0.3, 0.6, 0.7071, 0.9, 1.3, 1.4142, 2.0, 5.0};
 
-  memset(hl,0,9*sizeof(int));
+  memset(hl,0,9*sizeof(MMG5_int));
   ned = 0;
   avlen = 0.0;
   lmax = 0.0;
@@ -333,7 +333,7 @@ int _MMGS_prilen(MMG5_pMesh mesh, MMG5_pSol met, int metRidTyp) {
         len = _MMG5_lenSurfEdg33_ani(mesh,met,np,nq,(pt->tag[ia] & MG_GEO));
       }
       else
-        len = _MMG5_lenSurfEdg(mesh,met,np,nq,(pt->tag[ia] & MG_GEO));
+        len = mesh->func.lenSurfEdg(mesh,met,np,nq,(pt->tag[ia] & MG_GEO));
 
       if ( !len ) {
         ++nullEdge;
@@ -370,7 +370,7 @@ int _MMGS_prilen(MMG5_pMesh mesh, MMG5_pSol met, int metRidTyp) {
   _MMG5_displayHisto(mesh, ned, &avlen, amin, bmin, lmin,
                      amax, bmax, lmax, nullEdge, &bd[0], &hl[0],0);
 
-  _MMG5_DEL_MEM(mesh,hash.item,(hash.max+1)*sizeof(_MMG5_hedge));
+  _MMG5_DEL_MEM(mesh,hash.item,hash.siz*sizeof(_MMG5_hedge));
   return(1);
 }
 
@@ -386,7 +386,8 @@ int _MMGS_prilen(MMG5_pMesh mesh, MMG5_pSol met, int metRidTyp) {
 int _MMGS_inqua(MMG5_pMesh mesh,MMG5_pSol met) {
   MMG5_pTria    pt;
   double        rap,rapmin,rapmax,rapavg,med;
-  int           i,k,iel,ok,ir,imax,nex,his[5];
+  int           i,iel,ok,ir,imax,nex,his[5];
+  MMG5_int      k;
 
   rapmin  = 1.0;
   rapmax  = 0.0;
@@ -408,7 +409,7 @@ int _MMGS_inqua(MMG5_pMesh mesh,MMG5_pSol met) {
       rap = _MMGS_ALPHAD * _MMG5_caltri33_ani(mesh,met,pt);
     }
     else
-      rap = _MMGS_ALPHAD * _MMG5_calelt(mesh,NULL,pt);
+      rap = _MMGS_ALPHAD * mesh->func.caltri(mesh,NULL,pt);
 
     if ( rap < rapmin ) {
       rapmin = rap;
@@ -422,7 +423,7 @@ int _MMGS_inqua(MMG5_pMesh mesh,MMG5_pSol met) {
     his[ir] += 1;
   }
 
-  fprintf(stdout,"\n  -- MESH QUALITY   %d\n",mesh->nt - nex);
+  fprintf(stdout,"\n  -- MESH QUALITY   %" MMG5_PRId "\n",mesh->nt - nex);
   fprintf(stdout,"     BEST   %8.6f  AVRG.   %8.6f  WRST.   %8.6f (%d)\n",
           rapmax,rapavg / (mesh->nt-nex),rapmin,iel);
 
@@ -452,7 +453,8 @@ int _MMGS_inqua(MMG5_pMesh mesh,MMG5_pSol met) {
 int _MMGS_outqua(MMG5_pMesh mesh,MMG5_pSol met) {
   MMG5_pTria    pt;
   double        rap,rapmin,rapmax,rapavg,med;
-  int           i,k,iel,ok,ir,imax,nex,his[5];
+  int           i,iel,ok,ir,imax,nex,his[5];
+  MMG5_int      k;
 
   if ( mesh->info.imprim <= 0 ) return 1;
 
@@ -472,7 +474,7 @@ int _MMGS_outqua(MMG5_pMesh mesh,MMG5_pSol met) {
     }
     ok++;
 
-    rap = _MMGS_ALPHAD * _MMG5_calelt(mesh,met,pt);
+    rap = _MMGS_ALPHAD * mesh->func.caltri(mesh,met,pt);
 
     if ( rap < rapmin ) {
       rapmin = rap;
@@ -486,7 +488,7 @@ int _MMGS_outqua(MMG5_pMesh mesh,MMG5_pSol met) {
     his[ir] += 1;
   }
 
-  fprintf(stdout,"\n  -- MESH QUALITY   %d\n",mesh->nt - nex);
+  fprintf(stdout,"\n  -- MESH QUALITY   %" MMG5_PRId "\n",mesh->nt - nex);
   fprintf(stdout,"     BEST   %8.6f  AVRG.   %8.6f  WRST.   %8.6f (%d)\n",
           rapmax,rapavg / (mesh->nt-nex),rapmin,iel);
 
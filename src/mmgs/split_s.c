@@ -47,7 +47,7 @@
  * triangles are not empty (otherwise we can create a 0 surface triangle).
  *
  */
-int _MMGS_split1_sim(MMG5_pMesh mesh,MMG5_pSol met,int k,int i,int *vx) {
+int _MMGS_split1_sim(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,int i,MMG5_int *vx) {
   MMG5_pTria      pt,pt0;
   double          n[3],nref[3],vnew,vold;
   int             is;
@@ -104,10 +104,10 @@ int _MMGS_split1_sim(MMG5_pMesh mesh,MMG5_pSol met,int k,int i,int *vx) {
  * Split element \a k along edge \a i.
  *
  */
-int _MMGS_split1(MMG5_pMesh mesh,MMG5_pSol met,int k,int i,int *vx) {
+int _MMGS_split1(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,int i,MMG5_int *vx) {
   MMG5_pTria      pt,pt1;
   MMG5_pPoint     ppt;
-  int             iel;
+  MMG5_int        iel;
   char            i1,i2;
 
   iel = _MMGS_newElt(mesh);
@@ -155,11 +155,12 @@ int _MMGS_split1(MMG5_pMesh mesh,MMG5_pSol met,int k,int i,int *vx) {
  *
  * \remark Don't work for non-manifold edge.
  */
-int _MMGS_simbulgept(MMG5_pMesh mesh,MMG5_pSol met, int k,int i,int ip) {
+int _MMGS_simbulgept(MMG5_pMesh mesh,MMG5_pSol met, MMG5_int k,int i,MMG5_int ip) {
   MMG5_pTria     pt,pt0;
   MMG5_pPoint    ppt0;
   double         cal;
-  int            kadja,iadja,is;
+  int            is;
+  MMG5_int       kadja,iadja;
 
   pt0  = &mesh->tria[0];
   ppt0 = &mesh->point[0];
@@ -173,13 +174,13 @@ int _MMGS_simbulgept(MMG5_pMesh mesh,MMG5_pSol met, int k,int i,int ip) {
   memcpy(pt0,pt,sizeof(MMG5_Tria));
   is         = _MMG5_iprv2[i];
   pt0->v[is] = 0;
-  cal        = _MMG5_calelt(mesh,met,pt0);
+  cal        = mesh->func.caltri(mesh,met,pt0);
   if ( cal < _MMG5_EPSOK )  return(0);
 
   pt0->v[is] = pt->v[is];
   is         = _MMG5_inxt2[i];
   pt0->v[is] = 0;
-  cal        = _MMG5_calelt(mesh,met,pt0);
+  cal        = mesh->func.caltri(mesh,met,pt0);
   if ( cal < _MMG5_EPSOK )  return(0);
 
   // Check the validity of the two triangles created from the triangle adjacent
@@ -193,13 +194,13 @@ int _MMGS_simbulgept(MMG5_pMesh mesh,MMG5_pSol met, int k,int i,int ip) {
   memcpy(pt0,pt,sizeof(MMG5_Tria));
   is         = _MMG5_iprv2[iadja];
   pt0->v[is] = 0;
-  cal        = _MMG5_calelt(mesh,met,pt0);
+  cal        = mesh->func.caltri(mesh,met,pt0);
   if ( cal < _MMG5_EPSOK )  return(0);
 
   pt0->v[is] = pt->v[is];
   is         = _MMG5_inxt2[iadja];
   pt0->v[is] = 0;
-  cal        = _MMG5_calelt(mesh,met,pt0);
+  cal        = mesh->func.caltri(mesh,met,pt0);
   if ( cal < _MMG5_EPSOK )  return(0);
 
   return(1);
@@ -217,13 +218,14 @@ int _MMGS_simbulgept(MMG5_pMesh mesh,MMG5_pSol met, int k,int i,int ip) {
  *
  * \remark do not call this function in non-manifold case
  */
-int split1b(MMG5_pMesh mesh,int k,char i,int ip) {
+int split1b(MMG5_pMesh mesh,MMG5_int k,char i,MMG5_int ip) {
   MMG5_pTria     pt,pt1;
   MMG5_pPoint    ppt;
   _MMG5_Bezier   b;
   MMG5_pxPoint   go;
   double         uv[2],o[3],no[3],to[3];
-  int            *adja,iel,jel,kel,mel,ier;
+  int            ier;
+  MMG5_int       *adja,jel,mel,iel,kel;
   char           i1,i2,j,j1,j2,m;
 
   iel = _MMGS_newElt(mesh);
@@ -238,7 +240,7 @@ int split1b(MMG5_pMesh mesh,int k,char i,int ip) {
 
   pt1 = &mesh->tria[iel];
   memcpy(pt1,pt,sizeof(MMG5_Tria));
-  memcpy(&mesh->adja[3*(iel-1)+1],&mesh->adja[3*(k-1)+1],3*sizeof(int));
+  memcpy(&mesh->adja[3*(iel-1)+1],&mesh->adja[3*(k-1)+1],3*sizeof(MMG5_int));
 
   ppt = &mesh->point[ip];
   if ( pt->edg[i] )  ppt->ref = pt->edg[i];
@@ -250,7 +252,7 @@ int split1b(MMG5_pMesh mesh,int k,char i,int ip) {
 
   /* update normal n2 if need be */
   if ( jel && pt->tag[i] & MG_GEO ) {
-    ier = _MMG5_bezierCP(mesh,&mesh->tria[jel],&b,1);
+    ier = mesh->func.bezierCP(mesh,&mesh->tria[jel],&b,1);
     assert(ier);
     uv[0] = 0.5;
     uv[1] = 0.5;
@@ -295,7 +297,7 @@ int split1b(MMG5_pMesh mesh,int k,char i,int ip) {
     pt->flag = 0;
     pt->base = mesh->base;
     memcpy(pt1,pt,sizeof(MMG5_Tria));
-    memcpy(&mesh->adja[3*(kel-1)+1],&mesh->adja[3*(jel-1)+1],3*sizeof(int));
+    memcpy(&mesh->adja[3*(kel-1)+1],&mesh->adja[3*(jel-1)+1],3*sizeof(MMG5_int));
 
     j1 = _MMG5_inxt2[j];
     j2 = _MMG5_iprv2[j];
@@ -335,7 +337,7 @@ int split1b(MMG5_pMesh mesh,int k,char i,int ip) {
  * surface triangle).
  *
  */
-int _MMG5_split2_sim(MMG5_pMesh mesh,MMG5_pSol met,int k,int *vx) {
+int _MMG5_split2_sim(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int *vx) {
   MMG5_pTria    pt,pt0;
   double        n[3],nref[3],vold,vnew;
   int           i1,i2,i;
@@ -411,10 +413,10 @@ int _MMG5_split2_sim(MMG5_pMesh mesh,MMG5_pSol met,int k,int *vx) {
  * Split element \a k along the 2 edges \a i1 and \a i2.
  *
  */
-int _MMGS_split2(MMG5_pMesh mesh,MMG5_pSol met,int k,int *vx) {
+int _MMGS_split2(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int *vx) {
   MMG5_pTria    pt,pt1,pt2;
   MMG5_pPoint   p3,p4;
-  int           iel,jel;
+  MMG5_int      iel,jel;
   char          i,i1,i2;
 
   /* create 2 elements */
@@ -484,7 +486,7 @@ int _MMGS_split2(MMG5_pMesh mesh,MMG5_pSol met,int k,int *vx) {
  * triangles are not empty (otherwise we can create a 0 surface triangle).
  *
  */
-int _MMGS_split3_sim(MMG5_pMesh mesh,MMG5_pSol met,int k,int *vx) {
+int _MMGS_split3_sim(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int *vx) {
   MMG5_pTria    pt,pt0;
   double        n[3],nref[3],vnew,vold;
 
@@ -572,10 +574,10 @@ int _MMGS_split3_sim(MMG5_pMesh mesh,MMG5_pSol met,int k,int *vx) {
  * Split element \a k along the 3 edges
  *
  */
-int _MMGS_split3(MMG5_pMesh mesh,MMG5_pSol met,int k,int *vx) {
+int _MMGS_split3(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,MMG5_int *vx) {
   MMG5_pTria    pt,pt1,pt2,pt3;
   MMG5_pPoint   p3,p4,p5;
-  int           iel,jel,kel;
+  MMG5_int      iel,jel,kel;
 
   /* create 3 elements */
   iel = _MMGS_newElt(mesh);
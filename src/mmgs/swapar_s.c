@@ -36,13 +36,14 @@
 #include "mmgs.h"
 
 /* Check whether edge i of triangle k should be swapped for geometric approximation purposes */
-int chkswp(MMG5_pMesh mesh,MMG5_pSol met,int k,int i,char typchk) {
+int chkswp(MMG5_pMesh mesh,MMG5_pSol met,MMG5_int k,int i,char typchk) {
   MMG5_pTria    pt,pt0,pt1;
   MMG5_pPoint   p[3],q;
   MMG5_pPar      par;
   double   np[3][3],nq[3],*nr1,*nr2,nt[3],ps,ps2,*n1,*n2,dd,c1[3],c2[3],hausd;
   double   cosn1,cosn2,calnat,calchg,cal1,cal2,cosnat,coschg,ux,uy,uz,ll,loni,lona;
-  int     *adja,j,kk,l,ip0,ip1,ip2,iq,isloc;
+  int     j,l,isloc;
+  MMG5_int *adja,ip0,ip1,ip2,iq,kk;
   char     ii,i1,i2,jj;
 
   pt0 = &mesh->tria[0];
@@ -94,8 +95,8 @@ int chkswp(MMG5_pMesh mesh,MMG5_pSol met,int k,int i,char typchk) {
 
   /* check length */
   if ( typchk == 2 && met->m ) {
-    loni = _MMG5_lenSurfEdg(mesh,met,ip1,ip2,0);
-    lona = _MMG5_lenSurfEdg(mesh,met,ip0,iq,0);
+    loni = mesh->func.lenSurfEdg(mesh,met,ip1,ip2,0);
+    lona = mesh->func.lenSurfEdg(mesh,met,ip0,iq,0);
     if ( loni > 1.0 )  loni = MG_MIN(1.0 / loni,_MMGS_LSHRT);
     if ( lona > 1.0 )  lona = 1.0 / lona;
     if ( lona < loni || !loni )  return(0);
@@ -233,14 +234,14 @@ int chkswp(MMG5_pMesh mesh,MMG5_pSol met,int k,int i,char typchk) {
     pt0->tag[0] = pt->tag[i];
     pt0->tag[1] = pt->tag[i1];
     pt0->tag[2] = pt->tag[i2];
-    cal1 = _MMG5_calelt(mesh,met,pt0);
+    cal1 = mesh->func.caltri(mesh,met,pt0);
 
     /* BUG ??? pt1 should be here !*/
     pt0->v[0]= ip1;  pt0->v[1]= iq;   pt0->v[2]= ip2;
     pt0->tag[0] = pt->tag[i1];
     pt0->tag[1] = pt->tag[ii];
     pt0->tag[2] = pt->tag[i2];
-    cal2 = _MMG5_calelt(mesh,met,pt0);
+    cal2 = mesh->func.caltri(mesh,met,pt0);
 
     calnat = MG_MIN(cal1,cal2);
     assert(calnat > 0.);
@@ -250,13 +251,13 @@ int chkswp(MMG5_pMesh mesh,MMG5_pSol met,int k,int i,char typchk) {
     pt0->tag[0] = pt->tag[i];
     pt0->tag[1] = pt->tag[i1];
     pt0->tag[2] = pt->tag[ii];
-    cal1 = _MMG5_calelt(mesh,met,pt0);
+    cal1 = mesh->func.caltri(mesh,met,pt0);
 
     pt0->v[0]= ip0;  pt0->v[1]= iq;   pt0->v[2]= ip2;
     pt0->tag[0] = pt->tag[i];
     pt0->tag[1] = pt->tag[ii];
     pt0->tag[2] = pt->tag[i2];
-    cal2 = _MMG5_calelt(mesh,met,pt0);
+    cal2 = mesh->func.caltri(mesh,met,pt0);
 
     calchg = MG_MIN(cal1,cal2);
   }
@@ -293,9 +294,9 @@ int chkswp(MMG5_pMesh mesh,MMG5_pSol met,int k,int i,char typchk) {
  * must be checked outside to prevent the creation of empty elts.
  *
  */
-int swapar(MMG5_pMesh mesh,int k,int i) {
+int swapar(MMG5_pMesh mesh,MMG5_int k,int i) {
   MMG5_pTria    pt,pt1;
-  int     *adja,adj,k11,k21;
+  MMG5_int *adja,adj,k11,k21;
   char     i1,i2,j,jj,j2,v11,v21;
 
   pt   = &mesh->tria[k];
@@ -354,7 +355,7 @@ int swapar(MMG5_pMesh mesh,int k,int i) {
 int litswp(MMG5_pMesh mesh,int k,char i,double kali) {
   MMG5_pTria    pt,pt0,pt1;
   double   kalf,kalt,ps,n1[3],n2[3];
-  int     *adja,ia,ib,ic,id,kk;
+  MMG5_int *adja,ia,ib,ic,id,kk;
   char     ii,i1,i2;
 
   pt0 = &mesh->tria[0];
@@ -382,12 +383,12 @@ int litswp(MMG5_pMesh mesh,int k,char i,double kali) {
 
   /* check quality */
   pt0->v[0] = id;  pt0->v[1] = ic;  pt0->v[2] = ib;
-  kalt = _MMG5_calelt(mesh,NULL,pt0);
+  kalt = mesh->func.caltri(mesh,NULL,pt0);
   kali = MG_MIN(kali,kalt);
   pt0->v[0] = ia;  pt0->v[1] = id;  pt0->v[2] = ic;
-  kalt = _MMG5_calelt(mesh,NULL,pt0);
+  kalt = mesh->func.caltri(mesh,NULL,pt0);
   pt0->v[0] = ia;  pt0->v[1] = ib;  pt0->v[2] = id;
-  kalf = _MMG5_calelt(mesh,NULL,pt0);
+  kalf = mesh->func.caltri(mesh,NULL,pt0);
   kalf = MG_MIN(kalf,kalt);
   if ( kalf > 1.02 * kali ) {
     swapar(mesh,k,i);
@@ -79,7 +79,7 @@ int _MMGS_Alloc_mesh(MMG5_pMesh *mesh, MMG5_pSol *sol) {
 static inline
 void _MMGS_Init_woalloc_mesh(MMG5_pMesh mesh, MMG5_pSol sol ) {
 
-  _MMGS_Set_commonFunc();
+  _MMGS_Set_commonFunc(mesh);
 
   (mesh)->dim   = 3;
   (mesh)->ver   = 2;
@@ -354,7 +354,7 @@ int _MMGS_Free_structures_var(va_list argptr)
     _MMG5_DEL_MEM((*mesh),(*mesh)->edge,((*mesh)->na+1)*sizeof(MMG5_Edge));
 
   if ( (*mesh)->adja )
-    _MMG5_DEL_MEM((*mesh),(*mesh)->adja,(3*(*mesh)->ntmax+5)*sizeof(int));
+    _MMG5_DEL_MEM((*mesh),(*mesh)->adja,(3*(*mesh)->ntmax+5)*sizeof(MMG5_int));
 
   if ( (*mesh)->tria )
     _MMG5_DEL_MEM((*mesh),(*mesh)->tria,((*mesh)->ntmax+1)*sizeof(MMG5_Tria));
@@ -36,9 +36,9 @@
 #include "mmgs.h"
 
 /* get new point address */
-int _MMGS_newPt(MMG5_pMesh mesh,double c[3],double n[3]) {
+MMG5_int _MMGS_newPt(MMG5_pMesh mesh,double c[3],double n[3]) {
   MMG5_pPoint  ppt;
-  int     curpt;
+  MMG5_int curpt;
 
   if ( !mesh->npnil )  return(0);
 
@@ -55,7 +55,7 @@ int _MMGS_newPt(MMG5_pMesh mesh,double c[3],double n[3]) {
   return(curpt);
 }
 
-void _MMGS_delPt(MMG5_pMesh mesh,int ip) {
+void _MMGS_delPt(MMG5_pMesh mesh,MMG5_int ip) {
   MMG5_pPoint   ppt;
 
   ppt = &mesh->point[ip];
@@ -68,8 +68,8 @@ void _MMGS_delPt(MMG5_pMesh mesh,int ip) {
   }
 }
 
-int _MMGS_newElt(MMG5_pMesh mesh) {
-  int     curiel;
+MMG5_int _MMGS_newElt(MMG5_pMesh mesh) {
+  MMG5_int curiel;
 
   if ( !mesh->nenil )  return(0);
   curiel = mesh->nenil;
@@ -90,18 +90,18 @@ int _MMGS_newElt(MMG5_pMesh mesh) {
  * Delete the element \a iel
  *
  */
-int _MMGS_delElt(MMG5_pMesh mesh,int iel) {
+int _MMGS_delElt(MMG5_pMesh mesh,MMG5_int iel) {
   MMG5_pTria    pt;
 
   pt = &mesh->tria[iel];
   if ( !MG_EOK(pt) ) {
-    fprintf(stderr,"\n  ## INVALID ELEMENT %d.\n",iel);
+    fprintf(stderr,"\n  ## INVALID ELEMENT %" MMG5_PRId ".\n",iel);
     return 0;
   }
   memset(pt,0,sizeof(MMG5_Tria));
   pt->v[2] = mesh->nenil;
   if ( mesh->adja )
-    memset(&mesh->adja[3*(iel-1)+1],0,3*sizeof(int));
+    memset(&mesh->adja[3*(iel-1)+1],0,3*sizeof(MMG5_int));
   mesh->nenil = iel;
   if ( iel == mesh->nt ) {
     while ( !MG_EOK((&mesh->tria[mesh->nt])) )  mesh->nt--;
@@ -144,7 +144,7 @@ int _MMGS_memOption(MMG5_pMesh mesh) {
 
     /* point+tria+adja */
     bytes = sizeof(MMG5_Point) + sizeof(MMG5_xPoint) +
-      2*sizeof(MMG5_Tria) + 3*sizeof(int) + sizeof(MMG5_Sol);
+      2*sizeof(MMG5_Tria) + 3*sizeof(MMG5_int) + sizeof(MMG5_Sol);
 
     /* init allocation need _MMG5_MEMMIN B (for mesh->namein/out and
      * sol->namein/out */
@@ -180,8 +180,8 @@ int _MMGS_memOption(MMG5_pMesh mesh) {
   }
 
   if ( abs(mesh->info.imprim) > 5 || mesh->info.ddebug ) {
-    fprintf(stdout,"  _MMGS_NPMAX    %d\n",mesh->npmax);
-    fprintf(stdout,"  _MMGS_NTMAX    %d\n",mesh->ntmax);
+    fprintf(stdout,"  _MMGS_NPMAX    %" MMG5_PRId "\n",mesh->npmax);
+    fprintf(stdout,"  _MMGS_NTMAX    %" MMG5_PRId "\n",mesh->ntmax);
   }
 
   return 1;
@@ -196,7 +196,7 @@ int _MMGS_memOption(MMG5_pMesh mesh) {
  *
  */
 int _MMGS_zaldy(MMG5_pMesh mesh) {
-  int     k;
+  MMG5_int k;
 
   if ( !_MMGS_memOption(mesh) )  return 0;
 